@@ -24,6 +24,19 @@
  * Online:
  *    http://glad.sh/#api=gl%3Acore%3D4.6&extensions=&generator=c&options=
  *
+ * Edited by hand after generation. The options above describe the generated base only;
+ * regenerating drops the following, which must be ported over (gl.c has the same list):
+ *  - On-demand loading: gladLoadGLOnDemand, gladLoadGLOnDemandUserPtr, the glad_on_demand_impl_*
+ *    trampolines and glad_gl_set_on_demand. Not glad's ON_DEMAND option, which installs a
+ *    loader with gladSetGLOnDemandLoader and has no version or extension results.
+ *  - Hashed extension set: GladGLExtensionSet, gladGLHasExtension and the glad_gl_*_extension*
+ *    helpers, in place of glad's glad_gl_get_extensions / glad_gl_has_extension scans.
+ *  - Multi-context dispatch tables: GladGLContext, gladLoadGLContext, gladLoadGLContextUserPtr,
+ *    gladGLContextHasExtension and gladUnloadGLContext. Modelled on glad's MX option, but the
+ *    glad_gl* globals and gladLoadGL stay as they are.
+ *  - gladGLOnDemandLoad, the hook the debug layer uses. The debug layer itself (glad/gl_debug.h,
+ *    gl_debug.c) is a separate file generated from this header by tools/gen_gl_debug.py.
+ *
  */
 
 #ifndef GLAD_GL_H_
@@ -3626,9 +3639,727 @@ GLAD_API_CALL PFNGLWAITSYNCPROC glad_glWaitSync;
 
 
 
+typedef struct GladGLExtension {
+    const char *name;
+    unsigned int length;
+    unsigned int hash;
+} GladGLExtension;
+
+/* The extensions of one context, see gladGLHasExtension */
+typedef struct GladGLExtensionSet {
+    GladGLExtension *entries;
+    unsigned int capacity;
+    unsigned int count;
+} GladGLExtensionSet;
+
+/* Multi-context (MX) dispatch table: the version flags, extensions and entry points of one
+ * context, called as gl->DrawArrays(...) instead of through the glad_gl* globals. Each render
+ * thread loads its own for the context it has current; nothing in it is shared. */
+typedef struct GladGLContext {
+    int VERSION_1_0;
+    int VERSION_1_1;
+    int VERSION_1_2;
+    int VERSION_1_3;
+    int VERSION_1_4;
+    int VERSION_1_5;
+    int VERSION_2_0;
+    int VERSION_2_1;
+    int VERSION_3_0;
+    int VERSION_3_1;
+    int VERSION_3_2;
+    int VERSION_3_3;
+    int VERSION_4_0;
+    int VERSION_4_1;
+    int VERSION_4_2;
+    int VERSION_4_3;
+    int VERSION_4_4;
+    int VERSION_4_5;
+    int VERSION_4_6;
+
+    GladGLExtensionSet extensions;
+
+    PFNGLACTIVESHADERPROGRAMPROC ActiveShaderProgram;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLATTACHSHADERPROC AttachShader;
+    PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+    PFNGLBEGINQUERYPROC BeginQuery;
+    PFNGLBEGINQUERYINDEXEDPROC BeginQueryIndexed;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLBINDBUFFERBASEPROC BindBufferBase;
+    PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+    PFNGLBINDBUFFERSBASEPROC BindBuffersBase;
+    PFNGLBINDBUFFERSRANGEPROC BindBuffersRange;
+    PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLBINDIMAGETEXTUREPROC BindImageTexture;
+    PFNGLBINDIMAGETEXTURESPROC BindImageTextures;
+    PFNGLBINDPROGRAMPIPELINEPROC BindProgramPipeline;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLBINDSAMPLERPROC BindSampler;
+    PFNGLBINDSAMPLERSPROC BindSamplers;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLBINDTEXTUREUNITPROC BindTextureUnit;
+    PFNGLBINDTEXTURESPROC BindTextures;
+    PFNGLBINDTRANSFORMFEEDBACKPROC BindTransformFeedback;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLBINDVERTEXBUFFERPROC BindVertexBuffer;
+    PFNGLBINDVERTEXBUFFERSPROC BindVertexBuffers;
+    PFNGLBLENDCOLORPROC BlendColor;
+    PFNGLBLENDEQUATIONPROC BlendEquation;
+    PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+    PFNGLBLENDEQUATIONSEPARATEIPROC BlendEquationSeparatei;
+    PFNGLBLENDEQUATIONIPROC BlendEquationi;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLBLENDFUNCSEPARATEIPROC BlendFuncSeparatei;
+    PFNGLBLENDFUNCIPROC BlendFunci;
+    PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+    PFNGLBLITNAMEDFRAMEBUFFERPROC BlitNamedFramebuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLBUFFERSTORAGEPROC BufferStorage;
+    PFNGLBUFFERSUBDATAPROC BufferSubData;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus;
+    PFNGLCLAMPCOLORPROC ClampColor;
+    PFNGLCLEARPROC Clear;
+    PFNGLCLEARBUFFERDATAPROC ClearBufferData;
+    PFNGLCLEARBUFFERSUBDATAPROC ClearBufferSubData;
+    PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+    PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+    PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLCLEARDEPTHPROC ClearDepth;
+    PFNGLCLEARDEPTHFPROC ClearDepthf;
+    PFNGLCLEARNAMEDBUFFERDATAPROC ClearNamedBufferData;
+    PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData;
+    PFNGLCLEARNAMEDFRAMEBUFFERFIPROC ClearNamedFramebufferfi;
+    PFNGLCLEARNAMEDFRAMEBUFFERFVPROC ClearNamedFramebufferfv;
+    PFNGLCLEARNAMEDFRAMEBUFFERIVPROC ClearNamedFramebufferiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC ClearNamedFramebufferuiv;
+    PFNGLCLEARSTENCILPROC ClearStencil;
+    PFNGLCLEARTEXIMAGEPROC ClearTexImage;
+    PFNGLCLEARTEXSUBIMAGEPROC ClearTexSubImage;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLCLIPCONTROLPROC ClipControl;
+    PFNGLCOLORMASKPROC ColorMask;
+    PFNGLCOLORMASKIPROC ColorMaski;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC CompressedTextureSubImage1D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC CompressedTextureSubImage2D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC CompressedTextureSubImage3D;
+    PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+    PFNGLCOPYIMAGESUBDATAPROC CopyImageSubData;
+    PFNGLCOPYNAMEDBUFFERSUBDATAPROC CopyNamedBufferSubData;
+    PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+    PFNGLCOPYTEXTURESUBIMAGE1DPROC CopyTextureSubImage1D;
+    PFNGLCOPYTEXTURESUBIMAGE2DPROC CopyTextureSubImage2D;
+    PFNGLCOPYTEXTURESUBIMAGE3DPROC CopyTextureSubImage3D;
+    PFNGLCREATEBUFFERSPROC CreateBuffers;
+    PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLCREATEPROGRAMPIPELINESPROC CreateProgramPipelines;
+    PFNGLCREATEQUERIESPROC CreateQueries;
+    PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers;
+    PFNGLCREATESAMPLERSPROC CreateSamplers;
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLCREATESHADERPROGRAMVPROC CreateShaderProgramv;
+    PFNGLCREATETEXTURESPROC CreateTextures;
+    PFNGLCREATETRANSFORMFEEDBACKSPROC CreateTransformFeedbacks;
+    PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays;
+    PFNGLCULLFACEPROC CullFace;
+    PFNGLDEBUGMESSAGECALLBACKPROC DebugMessageCallback;
+    PFNGLDEBUGMESSAGECONTROLPROC DebugMessageControl;
+    PFNGLDEBUGMESSAGEINSERTPROC DebugMessageInsert;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLDELETEPROGRAMPIPELINESPROC DeleteProgramPipelines;
+    PFNGLDELETEQUERIESPROC DeleteQueries;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLDELETESAMPLERSPROC DeleteSamplers;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLDELETETRANSFORMFEEDBACKSPROC DeleteTransformFeedbacks;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLDEPTHFUNCPROC DepthFunc;
+    PFNGLDEPTHMASKPROC DepthMask;
+    PFNGLDEPTHRANGEPROC DepthRange;
+    PFNGLDEPTHRANGEARRAYVPROC DepthRangeArrayv;
+    PFNGLDEPTHRANGEINDEXEDPROC DepthRangeIndexed;
+    PFNGLDEPTHRANGEFPROC DepthRangef;
+    PFNGLDETACHSHADERPROC DetachShader;
+    PFNGLDISABLEPROC Disable;
+    PFNGLDISABLEVERTEXARRAYATTRIBPROC DisableVertexArrayAttrib;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLDISABLEIPROC Disablei;
+    PFNGLDISPATCHCOMPUTEPROC DispatchCompute;
+    PFNGLDISPATCHCOMPUTEINDIRECTPROC DispatchComputeIndirect;
+    PFNGLDRAWARRAYSPROC DrawArrays;
+    PFNGLDRAWARRAYSINDIRECTPROC DrawArraysIndirect;
+    PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC DrawArraysInstancedBaseInstance;
+    PFNGLDRAWBUFFERPROC DrawBuffer;
+    PFNGLDRAWBUFFERSPROC DrawBuffers;
+    PFNGLDRAWELEMENTSPROC DrawElements;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+    PFNGLDRAWELEMENTSINDIRECTPROC DrawElementsIndirect;
+    PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC DrawElementsInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+    PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+    PFNGLDRAWTRANSFORMFEEDBACKPROC DrawTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC DrawTransformFeedbackInstanced;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC DrawTransformFeedbackStream;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC DrawTransformFeedbackStreamInstanced;
+    PFNGLENABLEPROC Enable;
+    PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLENABLEIPROC Enablei;
+    PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+    PFNGLENDQUERYPROC EndQuery;
+    PFNGLENDQUERYINDEXEDPROC EndQueryIndexed;
+    PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLFINISHPROC Finish;
+    PFNGLFLUSHPROC Flush;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC FlushMappedNamedBufferRange;
+    PFNGLFRAMEBUFFERPARAMETERIPROC FramebufferParameteri;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+    PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+    PFNGLFRONTFACEPROC FrontFace;
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+    PFNGLGENPROGRAMPIPELINESPROC GenProgramPipelines;
+    PFNGLGENQUERIESPROC GenQueries;
+    PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+    PFNGLGENSAMPLERSPROC GenSamplers;
+    PFNGLGENTEXTURESPROC GenTextures;
+    PFNGLGENTRANSFORMFEEDBACKSPROC GenTransformFeedbacks;
+    PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+    PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+    PFNGLGENERATETEXTUREMIPMAPPROC GenerateTextureMipmap;
+    PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC GetActiveAtomicCounterBufferiv;
+    PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+    PFNGLGETACTIVESUBROUTINENAMEPROC GetActiveSubroutineName;
+    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC GetActiveSubroutineUniformName;
+    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC GetActiveSubroutineUniformiv;
+    PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+    PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+    PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+    PFNGLGETBOOLEANVPROC GetBooleanv;
+    PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+    PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+    PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+    PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC GetCompressedTextureImage;
+    PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC GetCompressedTextureSubImage;
+    PFNGLGETDEBUGMESSAGELOGPROC GetDebugMessageLog;
+    PFNGLGETDOUBLEI_VPROC GetDoublei_v;
+    PFNGLGETDOUBLEVPROC GetDoublev;
+    PFNGLGETERRORPROC GetError;
+    PFNGLGETFLOATI_VPROC GetFloati_v;
+    PFNGLGETFLOATVPROC GetFloatv;
+    PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+    PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+    PFNGLGETFRAMEBUFFERPARAMETERIVPROC GetFramebufferParameteriv;
+    PFNGLGETGRAPHICSRESETSTATUSPROC GetGraphicsResetStatus;
+    PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+    PFNGLGETINTEGER64VPROC GetInteger64v;
+    PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+    PFNGLGETINTEGERVPROC GetIntegerv;
+    PFNGLGETINTERNALFORMATI64VPROC GetInternalformati64v;
+    PFNGLGETINTERNALFORMATIVPROC GetInternalformativ;
+    PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+    PFNGLGETNAMEDBUFFERPARAMETERI64VPROC GetNamedBufferParameteri64v;
+    PFNGLGETNAMEDBUFFERPARAMETERIVPROC GetNamedBufferParameteriv;
+    PFNGLGETNAMEDBUFFERPOINTERVPROC GetNamedBufferPointerv;
+    PFNGLGETNAMEDBUFFERSUBDATAPROC GetNamedBufferSubData;
+    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetNamedFramebufferAttachmentParameteriv;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC GetNamedFramebufferParameteriv;
+    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC GetNamedRenderbufferParameteriv;
+    PFNGLGETOBJECTLABELPROC GetObjectLabel;
+    PFNGLGETOBJECTPTRLABELPROC GetObjectPtrLabel;
+    PFNGLGETPOINTERVPROC GetPointerv;
+    PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+    PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+    PFNGLGETPROGRAMINTERFACEIVPROC GetProgramInterfaceiv;
+    PFNGLGETPROGRAMPIPELINEINFOLOGPROC GetProgramPipelineInfoLog;
+    PFNGLGETPROGRAMPIPELINEIVPROC GetProgramPipelineiv;
+    PFNGLGETPROGRAMRESOURCEINDEXPROC GetProgramResourceIndex;
+    PFNGLGETPROGRAMRESOURCELOCATIONPROC GetProgramResourceLocation;
+    PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC GetProgramResourceLocationIndex;
+    PFNGLGETPROGRAMRESOURCENAMEPROC GetProgramResourceName;
+    PFNGLGETPROGRAMRESOURCEIVPROC GetProgramResourceiv;
+    PFNGLGETPROGRAMSTAGEIVPROC GetProgramStageiv;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLGETQUERYBUFFEROBJECTI64VPROC GetQueryBufferObjecti64v;
+    PFNGLGETQUERYBUFFEROBJECTIVPROC GetQueryBufferObjectiv;
+    PFNGLGETQUERYBUFFEROBJECTUI64VPROC GetQueryBufferObjectui64v;
+    PFNGLGETQUERYBUFFEROBJECTUIVPROC GetQueryBufferObjectuiv;
+    PFNGLGETQUERYINDEXEDIVPROC GetQueryIndexediv;
+    PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+    PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+    PFNGLGETQUERYIVPROC GetQueryiv;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLGETSHADERPRECISIONFORMATPROC GetShaderPrecisionFormat;
+    PFNGLGETSHADERSOURCEPROC GetShaderSource;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSTRINGPROC GetString;
+    PFNGLGETSTRINGIPROC GetStringi;
+    PFNGLGETSUBROUTINEINDEXPROC GetSubroutineIndex;
+    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC GetSubroutineUniformLocation;
+    PFNGLGETSYNCIVPROC GetSynciv;
+    PFNGLGETTEXIMAGEPROC GetTexImage;
+    PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+    PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+    PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+    PFNGLGETTEXTUREIMAGEPROC GetTextureImage;
+    PFNGLGETTEXTURELEVELPARAMETERFVPROC GetTextureLevelParameterfv;
+    PFNGLGETTEXTURELEVELPARAMETERIVPROC GetTextureLevelParameteriv;
+    PFNGLGETTEXTUREPARAMETERIIVPROC GetTextureParameterIiv;
+    PFNGLGETTEXTUREPARAMETERIUIVPROC GetTextureParameterIuiv;
+    PFNGLGETTEXTUREPARAMETERFVPROC GetTextureParameterfv;
+    PFNGLGETTEXTUREPARAMETERIVPROC GetTextureParameteriv;
+    PFNGLGETTEXTURESUBIMAGEPROC GetTextureSubImage;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+    PFNGLGETTRANSFORMFEEDBACKI64_VPROC GetTransformFeedbacki64_v;
+    PFNGLGETTRANSFORMFEEDBACKI_VPROC GetTransformFeedbacki_v;
+    PFNGLGETTRANSFORMFEEDBACKIVPROC GetTransformFeedbackiv;
+    PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+    PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+    PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+    PFNGLGETUNIFORMSUBROUTINEUIVPROC GetUniformSubroutineuiv;
+    PFNGLGETUNIFORMDVPROC GetUniformdv;
+    PFNGLGETUNIFORMFVPROC GetUniformfv;
+    PFNGLGETUNIFORMIVPROC GetUniformiv;
+    PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+    PFNGLGETVERTEXARRAYINDEXED64IVPROC GetVertexArrayIndexed64iv;
+    PFNGLGETVERTEXARRAYINDEXEDIVPROC GetVertexArrayIndexediv;
+    PFNGLGETVERTEXARRAYIVPROC GetVertexArrayiv;
+    PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+    PFNGLGETVERTEXATTRIBLDVPROC GetVertexAttribLdv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+    PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+    PFNGLGETNCOMPRESSEDTEXIMAGEPROC GetnCompressedTexImage;
+    PFNGLGETNTEXIMAGEPROC GetnTexImage;
+    PFNGLGETNUNIFORMDVPROC GetnUniformdv;
+    PFNGLGETNUNIFORMFVPROC GetnUniformfv;
+    PFNGLGETNUNIFORMIVPROC GetnUniformiv;
+    PFNGLGETNUNIFORMUIVPROC GetnUniformuiv;
+    PFNGLHINTPROC Hint;
+    PFNGLINVALIDATEBUFFERDATAPROC InvalidateBufferData;
+    PFNGLINVALIDATEBUFFERSUBDATAPROC InvalidateBufferSubData;
+    PFNGLINVALIDATEFRAMEBUFFERPROC InvalidateFramebuffer;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC InvalidateNamedFramebufferData;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC InvalidateNamedFramebufferSubData;
+    PFNGLINVALIDATESUBFRAMEBUFFERPROC InvalidateSubFramebuffer;
+    PFNGLINVALIDATETEXIMAGEPROC InvalidateTexImage;
+    PFNGLINVALIDATETEXSUBIMAGEPROC InvalidateTexSubImage;
+    PFNGLISBUFFERPROC IsBuffer;
+    PFNGLISENABLEDPROC IsEnabled;
+    PFNGLISENABLEDIPROC IsEnabledi;
+    PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLISPROGRAMPIPELINEPROC IsProgramPipeline;
+    PFNGLISQUERYPROC IsQuery;
+    PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+    PFNGLISSAMPLERPROC IsSampler;
+    PFNGLISSHADERPROC IsShader;
+    PFNGLISSYNCPROC IsSync;
+    PFNGLISTEXTUREPROC IsTexture;
+    PFNGLISTRANSFORMFEEDBACKPROC IsTransformFeedback;
+    PFNGLISVERTEXARRAYPROC IsVertexArray;
+    PFNGLLINEWIDTHPROC LineWidth;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLLOGICOPPROC LogicOp;
+    PFNGLMAPBUFFERPROC MapBuffer;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLMAPNAMEDBUFFERPROC MapNamedBuffer;
+    PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange;
+    PFNGLMEMORYBARRIERPROC MemoryBarrier;
+    PFNGLMEMORYBARRIERBYREGIONPROC MemoryBarrierByRegion;
+    PFNGLMINSAMPLESHADINGPROC MinSampleShading;
+    PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC MultiDrawArraysIndirect;
+    PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC MultiDrawArraysIndirectCount;
+    PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect;
+    PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC MultiDrawElementsIndirectCount;
+    PFNGLNAMEDBUFFERDATAPROC NamedBufferData;
+    PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage;
+    PFNGLNAMEDBUFFERSUBDATAPROC NamedBufferSubData;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC NamedFramebufferDrawBuffer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC NamedFramebufferDrawBuffers;
+    PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC NamedFramebufferParameteri;
+    PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC NamedFramebufferReadBuffer;
+    PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREPROC NamedFramebufferTexture;
+    PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC NamedFramebufferTextureLayer;
+    PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC NamedRenderbufferStorageMultisample;
+    PFNGLOBJECTLABELPROC ObjectLabel;
+    PFNGLOBJECTPTRLABELPROC ObjectPtrLabel;
+    PFNGLPATCHPARAMETERFVPROC PatchParameterfv;
+    PFNGLPATCHPARAMETERIPROC PatchParameteri;
+    PFNGLPAUSETRANSFORMFEEDBACKPROC PauseTransformFeedback;
+    PFNGLPIXELSTOREFPROC PixelStoref;
+    PFNGLPIXELSTOREIPROC PixelStorei;
+    PFNGLPOINTPARAMETERFPROC PointParameterf;
+    PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+    PFNGLPOINTPARAMETERIPROC PointParameteri;
+    PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+    PFNGLPOINTSIZEPROC PointSize;
+    PFNGLPOLYGONMODEPROC PolygonMode;
+    PFNGLPOLYGONOFFSETPROC PolygonOffset;
+    PFNGLPOLYGONOFFSETCLAMPPROC PolygonOffsetClamp;
+    PFNGLPOPDEBUGGROUPPROC PopDebugGroup;
+    PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+    PFNGLPROGRAMBINARYPROC ProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+    PFNGLPROGRAMUNIFORM1DPROC ProgramUniform1d;
+    PFNGLPROGRAMUNIFORM1DVPROC ProgramUniform1dv;
+    PFNGLPROGRAMUNIFORM1FPROC ProgramUniform1f;
+    PFNGLPROGRAMUNIFORM1FVPROC ProgramUniform1fv;
+    PFNGLPROGRAMUNIFORM1IPROC ProgramUniform1i;
+    PFNGLPROGRAMUNIFORM1IVPROC ProgramUniform1iv;
+    PFNGLPROGRAMUNIFORM1UIPROC ProgramUniform1ui;
+    PFNGLPROGRAMUNIFORM1UIVPROC ProgramUniform1uiv;
+    PFNGLPROGRAMUNIFORM2DPROC ProgramUniform2d;
+    PFNGLPROGRAMUNIFORM2DVPROC ProgramUniform2dv;
+    PFNGLPROGRAMUNIFORM2FPROC ProgramUniform2f;
+    PFNGLPROGRAMUNIFORM2FVPROC ProgramUniform2fv;
+    PFNGLPROGRAMUNIFORM2IPROC ProgramUniform2i;
+    PFNGLPROGRAMUNIFORM2IVPROC ProgramUniform2iv;
+    PFNGLPROGRAMUNIFORM2UIPROC ProgramUniform2ui;
+    PFNGLPROGRAMUNIFORM2UIVPROC ProgramUniform2uiv;
+    PFNGLPROGRAMUNIFORM3DPROC ProgramUniform3d;
+    PFNGLPROGRAMUNIFORM3DVPROC ProgramUniform3dv;
+    PFNGLPROGRAMUNIFORM3FPROC ProgramUniform3f;
+    PFNGLPROGRAMUNIFORM3FVPROC ProgramUniform3fv;
+    PFNGLPROGRAMUNIFORM3IPROC ProgramUniform3i;
+    PFNGLPROGRAMUNIFORM3IVPROC ProgramUniform3iv;
+    PFNGLPROGRAMUNIFORM3UIPROC ProgramUniform3ui;
+    PFNGLPROGRAMUNIFORM3UIVPROC ProgramUniform3uiv;
+    PFNGLPROGRAMUNIFORM4DPROC ProgramUniform4d;
+    PFNGLPROGRAMUNIFORM4DVPROC ProgramUniform4dv;
+    PFNGLPROGRAMUNIFORM4FPROC ProgramUniform4f;
+    PFNGLPROGRAMUNIFORM4FVPROC ProgramUniform4fv;
+    PFNGLPROGRAMUNIFORM4IPROC ProgramUniform4i;
+    PFNGLPROGRAMUNIFORM4IVPROC ProgramUniform4iv;
+    PFNGLPROGRAMUNIFORM4UIPROC ProgramUniform4ui;
+    PFNGLPROGRAMUNIFORM4UIVPROC ProgramUniform4uiv;
+    PFNGLPROGRAMUNIFORMMATRIX2DVPROC ProgramUniformMatrix2dv;
+    PFNGLPROGRAMUNIFORMMATRIX2FVPROC ProgramUniformMatrix2fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC ProgramUniformMatrix2x3dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC ProgramUniformMatrix2x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC ProgramUniformMatrix2x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC ProgramUniformMatrix2x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX3DVPROC ProgramUniformMatrix3dv;
+    PFNGLPROGRAMUNIFORMMATRIX3FVPROC ProgramUniformMatrix3fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC ProgramUniformMatrix3x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC ProgramUniformMatrix3x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC ProgramUniformMatrix3x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC ProgramUniformMatrix3x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4DVPROC ProgramUniformMatrix4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4FVPROC ProgramUniformMatrix4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC ProgramUniformMatrix4x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC ProgramUniformMatrix4x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC ProgramUniformMatrix4x3dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC ProgramUniformMatrix4x3fv;
+    PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+    PFNGLPUSHDEBUGGROUPPROC PushDebugGroup;
+    PFNGLQUERYCOUNTERPROC QueryCounter;
+    PFNGLREADBUFFERPROC ReadBuffer;
+    PFNGLREADPIXELSPROC ReadPixels;
+    PFNGLREADNPIXELSPROC ReadnPixels;
+    PFNGLRELEASESHADERCOMPILERPROC ReleaseShaderCompiler;
+    PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+    PFNGLRESUMETRANSFORMFEEDBACKPROC ResumeTransformFeedback;
+    PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+    PFNGLSAMPLEMASKIPROC SampleMaski;
+    PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+    PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLSCISSORARRAYVPROC ScissorArrayv;
+    PFNGLSCISSORINDEXEDPROC ScissorIndexed;
+    PFNGLSCISSORINDEXEDVPROC ScissorIndexedv;
+    PFNGLSHADERBINARYPROC ShaderBinary;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLSHADERSTORAGEBLOCKBINDINGPROC ShaderStorageBlockBinding;
+    PFNGLSPECIALIZESHADERPROC SpecializeShader;
+    PFNGLSTENCILFUNCPROC StencilFunc;
+    PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+    PFNGLSTENCILMASKPROC StencilMask;
+    PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+    PFNGLSTENCILOPPROC StencilOp;
+    PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+    PFNGLTEXBUFFERPROC TexBuffer;
+    PFNGLTEXBUFFERRANGEPROC TexBufferRange;
+    PFNGLTEXIMAGE1DPROC TexImage1D;
+    PFNGLTEXIMAGE2DPROC TexImage2D;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+    PFNGLTEXIMAGE3DPROC TexImage3D;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+    PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+    PFNGLTEXPARAMETERFPROC TexParameterf;
+    PFNGLTEXPARAMETERFVPROC TexParameterfv;
+    PFNGLTEXPARAMETERIPROC TexParameteri;
+    PFNGLTEXPARAMETERIVPROC TexParameteriv;
+    PFNGLTEXSTORAGE1DPROC TexStorage1D;
+    PFNGLTEXSTORAGE2DPROC TexStorage2D;
+    PFNGLTEXSTORAGE2DMULTISAMPLEPROC TexStorage2DMultisample;
+    PFNGLTEXSTORAGE3DPROC TexStorage3D;
+    PFNGLTEXSTORAGE3DMULTISAMPLEPROC TexStorage3DMultisample;
+    PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+    PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+    PFNGLTEXTUREBARRIERPROC TextureBarrier;
+    PFNGLTEXTUREBUFFERPROC TextureBuffer;
+    PFNGLTEXTUREBUFFERRANGEPROC TextureBufferRange;
+    PFNGLTEXTUREPARAMETERIIVPROC TextureParameterIiv;
+    PFNGLTEXTUREPARAMETERIUIVPROC TextureParameterIuiv;
+    PFNGLTEXTUREPARAMETERFPROC TextureParameterf;
+    PFNGLTEXTUREPARAMETERFVPROC TextureParameterfv;
+    PFNGLTEXTUREPARAMETERIPROC TextureParameteri;
+    PFNGLTEXTUREPARAMETERIVPROC TextureParameteriv;
+    PFNGLTEXTURESTORAGE1DPROC TextureStorage1D;
+    PFNGLTEXTURESTORAGE2DPROC TextureStorage2D;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC TextureStorage2DMultisample;
+    PFNGLTEXTURESTORAGE3DPROC TextureStorage3D;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC TextureStorage3DMultisample;
+    PFNGLTEXTURESUBIMAGE1DPROC TextureSubImage1D;
+    PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D;
+    PFNGLTEXTURESUBIMAGE3DPROC TextureSubImage3D;
+    PFNGLTEXTUREVIEWPROC TextureView;
+    PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC TransformFeedbackBufferBase;
+    PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC TransformFeedbackBufferRange;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLUNIFORM1DPROC Uniform1d;
+    PFNGLUNIFORM1DVPROC Uniform1dv;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2DPROC Uniform2d;
+    PFNGLUNIFORM2DVPROC Uniform2dv;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3DPROC Uniform3d;
+    PFNGLUNIFORM3DVPROC Uniform3dv;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4DPROC Uniform4d;
+    PFNGLUNIFORM4DVPROC Uniform4dv;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+    PFNGLUNIFORMMATRIX2DVPROC UniformMatrix2dv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX2X3DVPROC UniformMatrix2x3dv;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX2X4DVPROC UniformMatrix2x4dv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX3DVPROC UniformMatrix3dv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX3X2DVPROC UniformMatrix3x2dv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX3X4DVPROC UniformMatrix3x4dv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4DVPROC UniformMatrix4dv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLUNIFORMMATRIX4X2DVPROC UniformMatrix4x2dv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX4X3DVPROC UniformMatrix4x3dv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+    PFNGLUNIFORMSUBROUTINESUIVPROC UniformSubroutinesuiv;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer;
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLUSEPROGRAMSTAGESPROC UseProgramStages;
+    PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+    PFNGLVALIDATEPROGRAMPIPELINEPROC ValidateProgramPipeline;
+    PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding;
+    PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat;
+    PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat;
+    PFNGLVERTEXARRAYATTRIBLFORMATPROC VertexArrayAttribLFormat;
+    PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor;
+    PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERSPROC VertexArrayVertexBuffers;
+    PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+    PFNGLVERTEXATTRIBBINDINGPROC VertexAttribBinding;
+    PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+    PFNGLVERTEXATTRIBFORMATPROC VertexAttribFormat;
+    PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+    PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+    PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+    PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+    PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+    PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+    PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+    PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+    PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+    PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+    PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+    PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+    PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+    PFNGLVERTEXATTRIBIFORMATPROC VertexAttribIFormat;
+    PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+    PFNGLVERTEXATTRIBL1DPROC VertexAttribL1d;
+    PFNGLVERTEXATTRIBL1DVPROC VertexAttribL1dv;
+    PFNGLVERTEXATTRIBL2DPROC VertexAttribL2d;
+    PFNGLVERTEXATTRIBL2DVPROC VertexAttribL2dv;
+    PFNGLVERTEXATTRIBL3DPROC VertexAttribL3d;
+    PFNGLVERTEXATTRIBL3DVPROC VertexAttribL3dv;
+    PFNGLVERTEXATTRIBL4DPROC VertexAttribL4d;
+    PFNGLVERTEXATTRIBL4DVPROC VertexAttribL4dv;
+    PFNGLVERTEXATTRIBLFORMATPROC VertexAttribLFormat;
+    PFNGLVERTEXATTRIBLPOINTERPROC VertexAttribLPointer;
+    PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLVERTEXBINDINGDIVISORPROC VertexBindingDivisor;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLVIEWPORTARRAYVPROC ViewportArrayv;
+    PFNGLVIEWPORTINDEXEDFPROC ViewportIndexedf;
+    PFNGLVIEWPORTINDEXEDFVPROC ViewportIndexedfv;
+    PFNGLWAITSYNCPROC WaitSync;
+} GladGLContext;
+
 GLAD_API_CALL int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr);
 GLAD_API_CALL int gladLoadGL( GLADloadfunc load);
 
+/* Same version and GLAD_GL_* results as gladLoadGL, but the function pointers are only
+ * loaded on their first call; load (and userptr) must stay valid until then. */
+GLAD_API_CALL int gladLoadGLOnDemandUserPtr( GLADuserptrloadfunc load, void *userptr);
+GLAD_API_CALL int gladLoadGLOnDemand( GLADloadfunc load);
+/* Loads name through the on-demand loader; NULL if the last load wasn't on demand. For layers
+ * that swap the glad_gl* pointers (glad/gl_debug.h), which must not keep a trampoline. */
+GLAD_API_CALL GLADapiproc gladGLOnDemandLoad( const char *name);
+
+/* Whether the context GL was last loaded for lists the extension. A hash lookup into the set
+ * built while loading, cheap enough to call from render code; 0 before loading. */
+GLAD_API_CALL int gladGLHasExtension( const char *name);
+
+/* Loads the dispatch table of the context current on the calling thread. Safe to call from
+ * several threads at once for different contexts: only *context is written. Start from a
+ * zeroed GladGLContext; reloading one reuses its extension table, gladUnloadGLContext frees it. */
+GLAD_API_CALL int gladLoadGLContextUserPtr( GladGLContext *context, GLADuserptrloadfunc load, void *userptr);
+GLAD_API_CALL int gladLoadGLContext( GladGLContext *context, GLADloadfunc load);
+GLAD_API_CALL int gladGLContextHasExtension( const GladGLContext *context, const char *name);
+GLAD_API_CALL void gladUnloadGLContext( GladGLContext *context);
+
 
 
 #ifdef __cplusplus
@@ -0,0 +1,64 @@
+/**
+ * Generated by tools/gen_gl_debug.py from glad/gl.h; do not edit.
+ *
+ * SPDX-License-Identifier: (WTFPL OR CC0-1.0) AND Apache-2.0
+ */
+#ifndef GLAD_GL_DEBUG_H_
+#define GLAD_GL_DEBUG_H_
+
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLAD_GL_FUNCTION_COUNT 657
+
+/* One entry point of the debug layer's function table. signature holds two characters for
+ * the return value, then two per parameter: a type and a role.
+ *   type  v void, i signed integer, u unsigned integer (enums, bitfields, booleans too),
+ *         f float, d double, p opaque pointer or handle (const void *, GLsync, callbacks),
+ *         o pointer the call writes through, s string, S array of strings,
+ *         1 2 4 8 array of elements of that many bytes, P array of pointers
+ *   role  - none; B T V F R P S Q X G the name of a buffer, texture, vertex array,
+ *         framebuffer, renderbuffer, program or shader, sampler, query, transform feedback
+ *         or program pipeline, and the same in lower case for an array of such names;
+ *         L uniform location; Y sync object; O offset into a bound buffer (client memory
+ *         for pixels and compressed images when no unpack or pack buffer is bound)
+ * parameters are the parameter names, separated by commas. */
+typedef struct GladGLFunction {
+    const char *name;
+    const char *signature;
+    const char *parameters;
+} GladGLFunction;
+
+GLAD_API_CALL const GladGLFunction glad_gl_functions[GLAD_GL_FUNCTION_COUNT];
+
+/* An argument or result as the debug layer passes it: i and u hold every integer type, p
+ * every pointer, f and d floats and doubles (see the signature's type code). */
+typedef union GladGLArgument {
+    GLint64 i;
+    GLuint64 u;
+    GLfloat f;
+    GLdouble d;
+    const void *p;
+} GladGLArgument;
+
+/* function indexes glad_gl_functions; result is NULL for the pre callback and for void calls. */
+typedef void (*GLADglcallback)(unsigned int function, const GladGLArgument *args, const GladGLArgument *result);
+
+/* Debug layer over the glad_gl* globals (not over GladGLContext tables). Install it after
+ * loading: it wraps the pointers loaded at that time, and loading again replaces the wrappers.
+ * The callbacks run on the calling thread, before and after every wrapped call. */
+GLAD_API_CALL void gladSetGLCallbacks( GLADglcallback pre, GLADglcallback post);
+GLAD_API_CALL void gladInstallGLDebug(void);
+GLAD_API_CALL void gladUninstallGLDebug(void);
+/* Calls function through its glad_gl* pointer (wrapped or not) with args converted back to
+ * the parameter types. Returns 0 if the function is unknown or not loaded. */
+GLAD_API_CALL int gladGLCall( unsigned int function, const GladGLArgument *args, GladGLArgument *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLAD_GL_DEBUG_H_ */
@@ -1,5 +1,16 @@
 /**
  * SPDX-License-Identifier: (WTFPL OR CC0-1.0) AND Apache-2.0
+ *
+ * Generated by glad 2.0.4 with the options listed in glad/gl.h, then edited by hand:
+ *  - On-demand loading: gladLoadGLOnDemand, gladLoadGLOnDemandUserPtr, the glad_on_demand_impl_*
+ *    trampolines and glad_gl_set_on_demand.
+ *  - Hashed extension set: glad_gl_hash_extension, glad_gl_extension_slot,
+ *    glad_gl_reserve_extensions, glad_gl_add_extension, glad_gl_find_extensions and
+ *    gladGLHasExtension.
+ *  - Multi-context dispatch tables: the glad_gl_load_GL_VERSION_*_context loaders,
+ *    glad_gl_find_core_gl_context, gladLoadGLContext, gladLoadGLContextUserPtr,
+ *    gladGLContextHasExtension and gladUnloadGLContext.
+ *  - gladGLOnDemandLoad, for the debug layer in gl_debug.c (generated by tools/gen_gl_debug.py).
  */
 #include <stdio.h>
 #include <stdlib.h>
@@ -704,6 +715,3315 @@ PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
 
 
+/* On-demand loading (gladLoadGLOnDemand): every glad_gl* pointer starts at a trampoline that
+ * loads the real entry point on its first call, stores it over itself and forwards the call.
+ * Threads racing on a first call all store the same pointer. */
+static GLADuserptrloadfunc glad_gl_on_demand_load = NULL;
+static void *glad_gl_on_demand_userptr = NULL;
+
+static GLADapiproc glad_gl_on_demand_loader(const char *name) {
+    GLADapiproc result = NULL;
+    if (glad_gl_on_demand_load != NULL) {
+        result = glad_gl_on_demand_load(glad_gl_on_demand_userptr, name);
+    }
+    /* like a NULL pointer after eager loading, this crashes on the call if nothing was found */
+    return result;
+}
+
+GLADapiproc gladGLOnDemandLoad(const char *name) {
+    return glad_gl_on_demand_load != NULL ? glad_gl_on_demand_load(glad_gl_on_demand_userptr, name) : NULL;
+}
+
+static void GLAD_API_PTR glad_on_demand_impl_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC) glad_gl_on_demand_loader("glActiveShaderProgram");
+    glad_glActiveShaderProgram(pipeline, program);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glActiveTexture(GLenum texture) {
+    glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC) glad_gl_on_demand_loader("glActiveTexture");
+    glad_glActiveTexture(texture);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glAttachShader(GLuint program, GLuint shader) {
+    glad_glAttachShader = (PFNGLATTACHSHADERPROC) glad_gl_on_demand_loader("glAttachShader");
+    glad_glAttachShader(program, shader);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBeginConditionalRender(GLuint id, GLenum mode) {
+    glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC) glad_gl_on_demand_loader("glBeginConditionalRender");
+    glad_glBeginConditionalRender(id, mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBeginQuery(GLenum target, GLuint id) {
+    glad_glBeginQuery = (PFNGLBEGINQUERYPROC) glad_gl_on_demand_loader("glBeginQuery");
+    glad_glBeginQuery(target, id);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC) glad_gl_on_demand_loader("glBeginQueryIndexed");
+    glad_glBeginQueryIndexed(target, index, id);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBeginTransformFeedback(GLenum primitiveMode) {
+    glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glBeginTransformFeedback");
+    glad_glBeginTransformFeedback(primitiveMode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindAttribLocation(GLuint program, GLuint index, const GLchar * name) {
+    glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) glad_gl_on_demand_loader("glBindAttribLocation");
+    glad_glBindAttribLocation(program, index, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindBuffer(GLenum target, GLuint buffer) {
+    glad_glBindBuffer = (PFNGLBINDBUFFERPROC) glad_gl_on_demand_loader("glBindBuffer");
+    glad_glBindBuffer(target, buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC) glad_gl_on_demand_loader("glBindBufferBase");
+    glad_glBindBufferBase(target, index, buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC) glad_gl_on_demand_loader("glBindBufferRange");
+    glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint * buffers) {
+    glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC) glad_gl_on_demand_loader("glBindBuffersBase");
+    glad_glBindBuffersBase(target, first, count, buffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes) {
+    glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC) glad_gl_on_demand_loader("glBindBuffersRange");
+    glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindFragDataLocation(GLuint program, GLuint color, const GLchar * name) {
+    glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC) glad_gl_on_demand_loader("glBindFragDataLocation");
+    glad_glBindFragDataLocation(program, color, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name) {
+    glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) glad_gl_on_demand_loader("glBindFragDataLocationIndexed");
+    glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) glad_gl_on_demand_loader("glBindFramebuffer");
+    glad_glBindFramebuffer(target, framebuffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC) glad_gl_on_demand_loader("glBindImageTexture");
+    glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindImageTextures(GLuint first, GLsizei count, const GLuint * textures) {
+    glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC) glad_gl_on_demand_loader("glBindImageTextures");
+    glad_glBindImageTextures(first, count, textures);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindProgramPipeline(GLuint pipeline) {
+    glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC) glad_gl_on_demand_loader("glBindProgramPipeline");
+    glad_glBindProgramPipeline(pipeline);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) glad_gl_on_demand_loader("glBindRenderbuffer");
+    glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindSampler(GLuint unit, GLuint sampler) {
+    glad_glBindSampler = (PFNGLBINDSAMPLERPROC) glad_gl_on_demand_loader("glBindSampler");
+    glad_glBindSampler(unit, sampler);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindSamplers(GLuint first, GLsizei count, const GLuint * samplers) {
+    glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC) glad_gl_on_demand_loader("glBindSamplers");
+    glad_glBindSamplers(first, count, samplers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindTexture(GLenum target, GLuint texture) {
+    glad_glBindTexture = (PFNGLBINDTEXTUREPROC) glad_gl_on_demand_loader("glBindTexture");
+    glad_glBindTexture(target, texture);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindTextureUnit(GLuint unit, GLuint texture) {
+    glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC) glad_gl_on_demand_loader("glBindTextureUnit");
+    glad_glBindTextureUnit(unit, texture);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindTextures(GLuint first, GLsizei count, const GLuint * textures) {
+    glad_glBindTextures = (PFNGLBINDTEXTURESPROC) glad_gl_on_demand_loader("glBindTextures");
+    glad_glBindTextures(first, count, textures);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindTransformFeedback(GLenum target, GLuint id) {
+    glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glBindTransformFeedback");
+    glad_glBindTransformFeedback(target, id);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindVertexArray(GLuint array) {
+    glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC) glad_gl_on_demand_loader("glBindVertexArray");
+    glad_glBindVertexArray(array);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC) glad_gl_on_demand_loader("glBindVertexBuffer");
+    glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides) {
+    glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC) glad_gl_on_demand_loader("glBindVertexBuffers");
+    glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_glBlendColor = (PFNGLBLENDCOLORPROC) glad_gl_on_demand_loader("glBlendColor");
+    glad_glBlendColor(red, green, blue, alpha);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquation(GLenum mode) {
+    glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC) glad_gl_on_demand_loader("glBlendEquation");
+    glad_glBlendEquation(mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC) glad_gl_on_demand_loader("glBlendEquationSeparate");
+    glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC) glad_gl_on_demand_loader("glBlendEquationSeparatei");
+    glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendEquationi(GLuint buf, GLenum mode) {
+    glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC) glad_gl_on_demand_loader("glBlendEquationi");
+    glad_glBlendEquationi(buf, mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    glad_glBlendFunc = (PFNGLBLENDFUNCPROC) glad_gl_on_demand_loader("glBlendFunc");
+    glad_glBlendFunc(sfactor, dfactor);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC) glad_gl_on_demand_loader("glBlendFuncSeparate");
+    glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC) glad_gl_on_demand_loader("glBlendFuncSeparatei");
+    glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    glad_glBlendFunci = (PFNGLBLENDFUNCIPROC) glad_gl_on_demand_loader("glBlendFunci");
+    glad_glBlendFunci(buf, src, dst);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) glad_gl_on_demand_loader("glBlitFramebuffer");
+    glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC) glad_gl_on_demand_loader("glBlitNamedFramebuffer");
+    glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage) {
+    glad_glBufferData = (PFNGLBUFFERDATAPROC) glad_gl_on_demand_loader("glBufferData");
+    glad_glBufferData(target, size, data, usage);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBufferStorage(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags) {
+    glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC) glad_gl_on_demand_loader("glBufferStorage");
+    glad_glBufferStorage(target, size, data, flags);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data) {
+    glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glBufferSubData");
+    glad_glBufferSubData(target, offset, size, data);
+}
+static GLenum GLAD_API_PTR glad_on_demand_impl_glCheckFramebufferStatus(GLenum target) {
+    glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) glad_gl_on_demand_loader("glCheckFramebufferStatus");
+    return glad_glCheckFramebufferStatus(target);
+}
+static GLenum GLAD_API_PTR glad_on_demand_impl_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+    glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) glad_gl_on_demand_loader("glCheckNamedFramebufferStatus");
+    return glad_glCheckNamedFramebufferStatus(framebuffer, target);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClampColor(GLenum target, GLenum clamp) {
+    glad_glClampColor = (PFNGLCLAMPCOLORPROC) glad_gl_on_demand_loader("glClampColor");
+    glad_glClampColor(target, clamp);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClear(GLbitfield mask) {
+    glad_glClear = (PFNGLCLEARPROC) glad_gl_on_demand_loader("glClear");
+    glad_glClear(mask);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void * data) {
+    glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC) glad_gl_on_demand_loader("glClearBufferData");
+    glad_glClearBufferData(target, internalformat, format, type, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data) {
+    glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glClearBufferSubData");
+    glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC) glad_gl_on_demand_loader("glClearBufferfi");
+    glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC) glad_gl_on_demand_loader("glClearBufferfv");
+    glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value) {
+    glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC) glad_gl_on_demand_loader("glClearBufferiv");
+    glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC) glad_gl_on_demand_loader("glClearBufferuiv");
+    glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    glad_glClearColor = (PFNGLCLEARCOLORPROC) glad_gl_on_demand_loader("glClearColor");
+    glad_glClearColor(red, green, blue, alpha);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearDepth(GLdouble depth) {
+    glad_glClearDepth = (PFNGLCLEARDEPTHPROC) glad_gl_on_demand_loader("glClearDepth");
+    glad_glClearDepth(depth);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearDepthf(GLfloat d) {
+    glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC) glad_gl_on_demand_loader("glClearDepthf");
+    glad_glClearDepthf(d);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void * data) {
+    glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC) glad_gl_on_demand_loader("glClearNamedBufferData");
+    glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data) {
+    glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glClearNamedBufferSubData");
+    glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) glad_gl_on_demand_loader("glClearNamedFramebufferfi");
+    glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) glad_gl_on_demand_loader("glClearNamedFramebufferfv");
+    glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint * value) {
+    glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) glad_gl_on_demand_loader("glClearNamedFramebufferiv");
+    glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) glad_gl_on_demand_loader("glClearNamedFramebufferuiv");
+    glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearStencil(GLint s) {
+    glad_glClearStencil = (PFNGLCLEARSTENCILPROC) glad_gl_on_demand_loader("glClearStencil");
+    glad_glClearStencil(s);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void * data) {
+    glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC) glad_gl_on_demand_loader("glClearTexImage");
+    glad_glClearTexImage(texture, level, format, type, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data) {
+    glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC) glad_gl_on_demand_loader("glClearTexSubImage");
+    glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+static GLenum GLAD_API_PTR glad_on_demand_impl_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) glad_gl_on_demand_loader("glClientWaitSync");
+    return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glClipControl(GLenum origin, GLenum depth) {
+    glad_glClipControl = (PFNGLCLIPCONTROLPROC) glad_gl_on_demand_loader("glClipControl");
+    glad_glClipControl(origin, depth);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    glad_glColorMask = (PFNGLCOLORMASKPROC) glad_gl_on_demand_loader("glColorMask");
+    glad_glColorMask(red, green, blue, alpha);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    glad_glColorMaski = (PFNGLCOLORMASKIPROC) glad_gl_on_demand_loader("glColorMaski");
+    glad_glColorMaski(index, r, g, b, a);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompileShader(GLuint shader) {
+    glad_glCompileShader = (PFNGLCOMPILESHADERPROC) glad_gl_on_demand_loader("glCompileShader");
+    glad_glCompileShader(shader);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data) {
+    glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) glad_gl_on_demand_loader("glCompressedTexImage1D");
+    glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data) {
+    glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) glad_gl_on_demand_loader("glCompressedTexImage2D");
+    glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data) {
+    glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) glad_gl_on_demand_loader("glCompressedTexImage3D");
+    glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) glad_gl_on_demand_loader("glCompressedTexSubImage1D");
+    glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) glad_gl_on_demand_loader("glCompressedTexSubImage2D");
+    glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) glad_gl_on_demand_loader("glCompressedTexSubImage3D");
+    glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) glad_gl_on_demand_loader("glCompressedTextureSubImage1D");
+    glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) glad_gl_on_demand_loader("glCompressedTextureSubImage2D");
+    glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) glad_gl_on_demand_loader("glCompressedTextureSubImage3D");
+    glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glCopyBufferSubData");
+    glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC) glad_gl_on_demand_loader("glCopyImageSubData");
+    glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glCopyNamedBufferSubData");
+    glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC) glad_gl_on_demand_loader("glCopyTexImage1D");
+    glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC) glad_gl_on_demand_loader("glCopyTexImage2D");
+    glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC) glad_gl_on_demand_loader("glCopyTexSubImage1D");
+    glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC) glad_gl_on_demand_loader("glCopyTexSubImage2D");
+    glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC) glad_gl_on_demand_loader("glCopyTexSubImage3D");
+    glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC) glad_gl_on_demand_loader("glCopyTextureSubImage1D");
+    glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC) glad_gl_on_demand_loader("glCopyTextureSubImage2D");
+    glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC) glad_gl_on_demand_loader("glCopyTextureSubImage3D");
+    glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateBuffers(GLsizei n, GLuint * buffers) {
+    glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC) glad_gl_on_demand_loader("glCreateBuffers");
+    glad_glCreateBuffers(n, buffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateFramebuffers(GLsizei n, GLuint * framebuffers) {
+    glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC) glad_gl_on_demand_loader("glCreateFramebuffers");
+    glad_glCreateFramebuffers(n, framebuffers);
+}
+static GLuint GLAD_API_PTR glad_on_demand_impl_glCreateProgram(void) {
+    glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC) glad_gl_on_demand_loader("glCreateProgram");
+    return glad_glCreateProgram();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateProgramPipelines(GLsizei n, GLuint * pipelines) {
+    glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC) glad_gl_on_demand_loader("glCreateProgramPipelines");
+    glad_glCreateProgramPipelines(n, pipelines);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateQueries(GLenum target, GLsizei n, GLuint * ids) {
+    glad_glCreateQueries = (PFNGLCREATEQUERIESPROC) glad_gl_on_demand_loader("glCreateQueries");
+    glad_glCreateQueries(target, n, ids);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC) glad_gl_on_demand_loader("glCreateRenderbuffers");
+    glad_glCreateRenderbuffers(n, renderbuffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateSamplers(GLsizei n, GLuint * samplers) {
+    glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC) glad_gl_on_demand_loader("glCreateSamplers");
+    glad_glCreateSamplers(n, samplers);
+}
+static GLuint GLAD_API_PTR glad_on_demand_impl_glCreateShader(GLenum type) {
+    glad_glCreateShader = (PFNGLCREATESHADERPROC) glad_gl_on_demand_loader("glCreateShader");
+    return glad_glCreateShader(type);
+}
+static GLuint GLAD_API_PTR glad_on_demand_impl_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const* strings) {
+    glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC) glad_gl_on_demand_loader("glCreateShaderProgramv");
+    return glad_glCreateShaderProgramv(type, count, strings);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateTextures(GLenum target, GLsizei n, GLuint * textures) {
+    glad_glCreateTextures = (PFNGLCREATETEXTURESPROC) glad_gl_on_demand_loader("glCreateTextures");
+    glad_glCreateTextures(target, n, textures);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateTransformFeedbacks(GLsizei n, GLuint * ids) {
+    glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC) glad_gl_on_demand_loader("glCreateTransformFeedbacks");
+    glad_glCreateTransformFeedbacks(n, ids);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCreateVertexArrays(GLsizei n, GLuint * arrays) {
+    glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC) glad_gl_on_demand_loader("glCreateVertexArrays");
+    glad_glCreateVertexArrays(n, arrays);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glCullFace(GLenum mode) {
+    glad_glCullFace = (PFNGLCULLFACEPROC) glad_gl_on_demand_loader("glCullFace");
+    glad_glCullFace(mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDebugMessageCallback(GLDEBUGPROC callback, const void * userParam) {
+    glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC) glad_gl_on_demand_loader("glDebugMessageCallback");
+    glad_glDebugMessageCallback(callback, userParam);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled) {
+    glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC) glad_gl_on_demand_loader("glDebugMessageControl");
+    glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf) {
+    glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC) glad_gl_on_demand_loader("glDebugMessageInsert");
+    glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteBuffers(GLsizei n, const GLuint * buffers) {
+    glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC) glad_gl_on_demand_loader("glDeleteBuffers");
+    glad_glDeleteBuffers(n, buffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteFramebuffers(GLsizei n, const GLuint * framebuffers) {
+    glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) glad_gl_on_demand_loader("glDeleteFramebuffers");
+    glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteProgram(GLuint program) {
+    glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC) glad_gl_on_demand_loader("glDeleteProgram");
+    glad_glDeleteProgram(program);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteProgramPipelines(GLsizei n, const GLuint * pipelines) {
+    glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC) glad_gl_on_demand_loader("glDeleteProgramPipelines");
+    glad_glDeleteProgramPipelines(n, pipelines);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteQueries(GLsizei n, const GLuint * ids) {
+    glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC) glad_gl_on_demand_loader("glDeleteQueries");
+    glad_glDeleteQueries(n, ids);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers) {
+    glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) glad_gl_on_demand_loader("glDeleteRenderbuffers");
+    glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteSamplers(GLsizei count, const GLuint * samplers) {
+    glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC) glad_gl_on_demand_loader("glDeleteSamplers");
+    glad_glDeleteSamplers(count, samplers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteShader(GLuint shader) {
+    glad_glDeleteShader = (PFNGLDELETESHADERPROC) glad_gl_on_demand_loader("glDeleteShader");
+    glad_glDeleteShader(shader);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteSync(GLsync sync) {
+    glad_glDeleteSync = (PFNGLDELETESYNCPROC) glad_gl_on_demand_loader("glDeleteSync");
+    glad_glDeleteSync(sync);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteTextures(GLsizei n, const GLuint * textures) {
+    glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC) glad_gl_on_demand_loader("glDeleteTextures");
+    glad_glDeleteTextures(n, textures);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteTransformFeedbacks(GLsizei n, const GLuint * ids) {
+    glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC) glad_gl_on_demand_loader("glDeleteTransformFeedbacks");
+    glad_glDeleteTransformFeedbacks(n, ids);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDeleteVertexArrays(GLsizei n, const GLuint * arrays) {
+    glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC) glad_gl_on_demand_loader("glDeleteVertexArrays");
+    glad_glDeleteVertexArrays(n, arrays);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDepthFunc(GLenum func) {
+    glad_glDepthFunc = (PFNGLDEPTHFUNCPROC) glad_gl_on_demand_loader("glDepthFunc");
+    glad_glDepthFunc(func);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDepthMask(GLboolean flag) {
+    glad_glDepthMask = (PFNGLDEPTHMASKPROC) glad_gl_on_demand_loader("glDepthMask");
+    glad_glDepthMask(flag);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRange(GLdouble n, GLdouble f) {
+    glad_glDepthRange = (PFNGLDEPTHRANGEPROC) glad_gl_on_demand_loader("glDepthRange");
+    glad_glDepthRange(n, f);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble * v) {
+    glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC) glad_gl_on_demand_loader("glDepthRangeArrayv");
+    glad_glDepthRangeArrayv(first, count, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC) glad_gl_on_demand_loader("glDepthRangeIndexed");
+    glad_glDepthRangeIndexed(index, n, f);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDepthRangef(GLfloat n, GLfloat f) {
+    glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC) glad_gl_on_demand_loader("glDepthRangef");
+    glad_glDepthRangef(n, f);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDetachShader(GLuint program, GLuint shader) {
+    glad_glDetachShader = (PFNGLDETACHSHADERPROC) glad_gl_on_demand_loader("glDetachShader");
+    glad_glDetachShader(program, shader);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDisable(GLenum cap) {
+    glad_glDisable = (PFNGLDISABLEPROC) glad_gl_on_demand_loader("glDisable");
+    glad_glDisable(cap);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC) glad_gl_on_demand_loader("glDisableVertexArrayAttrib");
+    glad_glDisableVertexArrayAttrib(vaobj, index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDisableVertexAttribArray(GLuint index) {
+    glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) glad_gl_on_demand_loader("glDisableVertexAttribArray");
+    glad_glDisableVertexAttribArray(index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDisablei(GLenum target, GLuint index) {
+    glad_glDisablei = (PFNGLDISABLEIPROC) glad_gl_on_demand_loader("glDisablei");
+    glad_glDisablei(target, index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC) glad_gl_on_demand_loader("glDispatchCompute");
+    glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDispatchComputeIndirect(GLintptr indirect) {
+    glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC) glad_gl_on_demand_loader("glDispatchComputeIndirect");
+    glad_glDispatchComputeIndirect(indirect);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    glad_glDrawArrays = (PFNGLDRAWARRAYSPROC) glad_gl_on_demand_loader("glDrawArrays");
+    glad_glDrawArrays(mode, first, count);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArraysIndirect(GLenum mode, const void * indirect) {
+    glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC) glad_gl_on_demand_loader("glDrawArraysIndirect");
+    glad_glDrawArraysIndirect(mode, indirect);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) glad_gl_on_demand_loader("glDrawArraysInstanced");
+    glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) glad_gl_on_demand_loader("glDrawArraysInstancedBaseInstance");
+    glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawBuffer(GLenum buf) {
+    glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC) glad_gl_on_demand_loader("glDrawBuffer");
+    glad_glDrawBuffer(buf);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawBuffers(GLsizei n, const GLenum * bufs) {
+    glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC) glad_gl_on_demand_loader("glDrawBuffers");
+    glad_glDrawBuffers(n, bufs);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices) {
+    glad_glDrawElements = (PFNGLDRAWELEMENTSPROC) glad_gl_on_demand_loader("glDrawElements");
+    glad_glDrawElements(mode, count, type, indices);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC) glad_gl_on_demand_loader("glDrawElementsBaseVertex");
+    glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect) {
+    glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC) glad_gl_on_demand_loader("glDrawElementsIndirect");
+    glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount) {
+    glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC) glad_gl_on_demand_loader("glDrawElementsInstanced");
+    glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLuint baseinstance) {
+    glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) glad_gl_on_demand_loader("glDrawElementsInstancedBaseInstance");
+    glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex) {
+    glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) glad_gl_on_demand_loader("glDrawElementsInstancedBaseVertex");
+    glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) glad_gl_on_demand_loader("glDrawElementsInstancedBaseVertexBaseInstance");
+    glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices) {
+    glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC) glad_gl_on_demand_loader("glDrawRangeElements");
+    glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) glad_gl_on_demand_loader("glDrawRangeElementsBaseVertex");
+    glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glDrawTransformFeedback");
+    glad_glDrawTransformFeedback(mode, id);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) glad_gl_on_demand_loader("glDrawTransformFeedbackInstanced");
+    glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) glad_gl_on_demand_loader("glDrawTransformFeedbackStream");
+    glad_glDrawTransformFeedbackStream(mode, id, stream);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) glad_gl_on_demand_loader("glDrawTransformFeedbackStreamInstanced");
+    glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEnable(GLenum cap) {
+    glad_glEnable = (PFNGLENABLEPROC) glad_gl_on_demand_loader("glEnable");
+    glad_glEnable(cap);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC) glad_gl_on_demand_loader("glEnableVertexArrayAttrib");
+    glad_glEnableVertexArrayAttrib(vaobj, index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEnableVertexAttribArray(GLuint index) {
+    glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) glad_gl_on_demand_loader("glEnableVertexAttribArray");
+    glad_glEnableVertexAttribArray(index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEnablei(GLenum target, GLuint index) {
+    glad_glEnablei = (PFNGLENABLEIPROC) glad_gl_on_demand_loader("glEnablei");
+    glad_glEnablei(target, index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEndConditionalRender(void) {
+    glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC) glad_gl_on_demand_loader("glEndConditionalRender");
+    glad_glEndConditionalRender();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEndQuery(GLenum target) {
+    glad_glEndQuery = (PFNGLENDQUERYPROC) glad_gl_on_demand_loader("glEndQuery");
+    glad_glEndQuery(target);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEndQueryIndexed(GLenum target, GLuint index) {
+    glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC) glad_gl_on_demand_loader("glEndQueryIndexed");
+    glad_glEndQueryIndexed(target, index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glEndTransformFeedback(void) {
+    glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glEndTransformFeedback");
+    glad_glEndTransformFeedback();
+}
+static GLsync GLAD_API_PTR glad_on_demand_impl_glFenceSync(GLenum condition, GLbitfield flags) {
+    glad_glFenceSync = (PFNGLFENCESYNCPROC) glad_gl_on_demand_loader("glFenceSync");
+    return glad_glFenceSync(condition, flags);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFinish(void) {
+    glad_glFinish = (PFNGLFINISHPROC) glad_gl_on_demand_loader("glFinish");
+    glad_glFinish();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFlush(void) {
+    glad_glFlush = (PFNGLFLUSHPROC) glad_gl_on_demand_loader("glFlush");
+    glad_glFlush();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) glad_gl_on_demand_loader("glFlushMappedBufferRange");
+    glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) glad_gl_on_demand_loader("glFlushMappedNamedBufferRange");
+    glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC) glad_gl_on_demand_loader("glFramebufferParameteri");
+    glad_glFramebufferParameteri(target, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) glad_gl_on_demand_loader("glFramebufferRenderbuffer");
+    glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC) glad_gl_on_demand_loader("glFramebufferTexture");
+    glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC) glad_gl_on_demand_loader("glFramebufferTexture1D");
+    glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) glad_gl_on_demand_loader("glFramebufferTexture2D");
+    glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC) glad_gl_on_demand_loader("glFramebufferTexture3D");
+    glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) glad_gl_on_demand_loader("glFramebufferTextureLayer");
+    glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glFrontFace(GLenum mode) {
+    glad_glFrontFace = (PFNGLFRONTFACEPROC) glad_gl_on_demand_loader("glFrontFace");
+    glad_glFrontFace(mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenBuffers(GLsizei n, GLuint * buffers) {
+    glad_glGenBuffers = (PFNGLGENBUFFERSPROC) glad_gl_on_demand_loader("glGenBuffers");
+    glad_glGenBuffers(n, buffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenFramebuffers(GLsizei n, GLuint * framebuffers) {
+    glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) glad_gl_on_demand_loader("glGenFramebuffers");
+    glad_glGenFramebuffers(n, framebuffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenProgramPipelines(GLsizei n, GLuint * pipelines) {
+    glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC) glad_gl_on_demand_loader("glGenProgramPipelines");
+    glad_glGenProgramPipelines(n, pipelines);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenQueries(GLsizei n, GLuint * ids) {
+    glad_glGenQueries = (PFNGLGENQUERIESPROC) glad_gl_on_demand_loader("glGenQueries");
+    glad_glGenQueries(n, ids);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) glad_gl_on_demand_loader("glGenRenderbuffers");
+    glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenSamplers(GLsizei count, GLuint * samplers) {
+    glad_glGenSamplers = (PFNGLGENSAMPLERSPROC) glad_gl_on_demand_loader("glGenSamplers");
+    glad_glGenSamplers(count, samplers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenTextures(GLsizei n, GLuint * textures) {
+    glad_glGenTextures = (PFNGLGENTEXTURESPROC) glad_gl_on_demand_loader("glGenTextures");
+    glad_glGenTextures(n, textures);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenTransformFeedbacks(GLsizei n, GLuint * ids) {
+    glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC) glad_gl_on_demand_loader("glGenTransformFeedbacks");
+    glad_glGenTransformFeedbacks(n, ids);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenVertexArrays(GLsizei n, GLuint * arrays) {
+    glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC) glad_gl_on_demand_loader("glGenVertexArrays");
+    glad_glGenVertexArrays(n, arrays);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenerateMipmap(GLenum target) {
+    glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC) glad_gl_on_demand_loader("glGenerateMipmap");
+    glad_glGenerateMipmap(target);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGenerateTextureMipmap(GLuint texture) {
+    glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC) glad_gl_on_demand_loader("glGenerateTextureMipmap");
+    glad_glGenerateTextureMipmap(texture);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint * params) {
+    glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) glad_gl_on_demand_loader("glGetActiveAtomicCounterBufferiv");
+    glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC) glad_gl_on_demand_loader("glGetActiveAttrib");
+    glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC) glad_gl_on_demand_loader("glGetActiveSubroutineName");
+    glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) glad_gl_on_demand_loader("glGetActiveSubroutineUniformName");
+    glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values) {
+    glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) glad_gl_on_demand_loader("glGetActiveSubroutineUniformiv");
+    glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC) glad_gl_on_demand_loader("glGetActiveUniform");
+    glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) {
+    glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) glad_gl_on_demand_loader("glGetActiveUniformBlockName");
+    glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) {
+    glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) glad_gl_on_demand_loader("glGetActiveUniformBlockiv");
+    glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName) {
+    glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC) glad_gl_on_demand_loader("glGetActiveUniformName");
+    glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params) {
+    glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC) glad_gl_on_demand_loader("glGetActiveUniformsiv");
+    glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders) {
+    glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC) glad_gl_on_demand_loader("glGetAttachedShaders");
+    glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetAttribLocation(GLuint program, const GLchar * name) {
+    glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) glad_gl_on_demand_loader("glGetAttribLocation");
+    return glad_glGetAttribLocation(program, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetBooleani_v(GLenum target, GLuint index, GLboolean * data) {
+    glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC) glad_gl_on_demand_loader("glGetBooleani_v");
+    glad_glGetBooleani_v(target, index, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetBooleanv(GLenum pname, GLboolean * data) {
+    glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC) glad_gl_on_demand_loader("glGetBooleanv");
+    glad_glGetBooleanv(pname, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params) {
+    glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC) glad_gl_on_demand_loader("glGetBufferParameteri64v");
+    glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetBufferParameteriv");
+    glad_glGetBufferParameteriv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferPointerv(GLenum target, GLenum pname, void ** params) {
+    glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC) glad_gl_on_demand_loader("glGetBufferPointerv");
+    glad_glGetBufferPointerv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data) {
+    glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glGetBufferSubData");
+    glad_glGetBufferSubData(target, offset, size, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetCompressedTexImage(GLenum target, GLint level, void * img) {
+    glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) glad_gl_on_demand_loader("glGetCompressedTexImage");
+    glad_glGetCompressedTexImage(target, level, img);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void * pixels) {
+    glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) glad_gl_on_demand_loader("glGetCompressedTextureImage");
+    glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void * pixels) {
+    glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) glad_gl_on_demand_loader("glGetCompressedTextureSubImage");
+    glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog) {
+    glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC) glad_gl_on_demand_loader("glGetDebugMessageLog");
+    return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetDoublei_v(GLenum target, GLuint index, GLdouble * data) {
+    glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC) glad_gl_on_demand_loader("glGetDoublei_v");
+    glad_glGetDoublei_v(target, index, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetDoublev(GLenum pname, GLdouble * data) {
+    glad_glGetDoublev = (PFNGLGETDOUBLEVPROC) glad_gl_on_demand_loader("glGetDoublev");
+    glad_glGetDoublev(pname, data);
+}
+static GLenum GLAD_API_PTR glad_on_demand_impl_glGetError(void) {
+    glad_glGetError = (PFNGLGETERRORPROC) glad_gl_on_demand_loader("glGetError");
+    return glad_glGetError();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetFloati_v(GLenum target, GLuint index, GLfloat * data) {
+    glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC) glad_gl_on_demand_loader("glGetFloati_v");
+    glad_glGetFloati_v(target, index, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetFloatv(GLenum pname, GLfloat * data) {
+    glad_glGetFloatv = (PFNGLGETFLOATVPROC) glad_gl_on_demand_loader("glGetFloatv");
+    glad_glGetFloatv(pname, data);
+}
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetFragDataIndex(GLuint program, const GLchar * name) {
+    glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC) glad_gl_on_demand_loader("glGetFragDataIndex");
+    return glad_glGetFragDataIndex(program, name);
+}
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetFragDataLocation(GLuint program, const GLchar * name) {
+    glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC) glad_gl_on_demand_loader("glGetFragDataLocation");
+    return glad_glGetFragDataLocation(program, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
+    glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) glad_gl_on_demand_loader("glGetFramebufferAttachmentParameteriv");
+    glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetFramebufferParameteriv");
+    glad_glGetFramebufferParameteriv(target, pname, params);
+}
+static GLenum GLAD_API_PTR glad_on_demand_impl_glGetGraphicsResetStatus(void) {
+    glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC) glad_gl_on_demand_loader("glGetGraphicsResetStatus");
+    return glad_glGetGraphicsResetStatus();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetInteger64i_v(GLenum target, GLuint index, GLint64 * data) {
+    glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC) glad_gl_on_demand_loader("glGetInteger64i_v");
+    glad_glGetInteger64i_v(target, index, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetInteger64v(GLenum pname, GLint64 * data) {
+    glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC) glad_gl_on_demand_loader("glGetInteger64v");
+    glad_glGetInteger64v(pname, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetIntegeri_v(GLenum target, GLuint index, GLint * data) {
+    glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC) glad_gl_on_demand_loader("glGetIntegeri_v");
+    glad_glGetIntegeri_v(target, index, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetIntegerv(GLenum pname, GLint * data) {
+    glad_glGetIntegerv = (PFNGLGETINTEGERVPROC) glad_gl_on_demand_loader("glGetIntegerv");
+    glad_glGetIntegerv(pname, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 * params) {
+    glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC) glad_gl_on_demand_loader("glGetInternalformati64v");
+    glad_glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint * params) {
+    glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC) glad_gl_on_demand_loader("glGetInternalformativ");
+    glad_glGetInternalformativ(target, internalformat, pname, count, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat * val) {
+    glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC) glad_gl_on_demand_loader("glGetMultisamplefv");
+    glad_glGetMultisamplefv(pname, index, val);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 * params) {
+    glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) glad_gl_on_demand_loader("glGetNamedBufferParameteri64v");
+    glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint * params) {
+    glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetNamedBufferParameteriv");
+    glad_glGetNamedBufferParameteriv(buffer, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void ** params) {
+    glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC) glad_gl_on_demand_loader("glGetNamedBufferPointerv");
+    glad_glGetNamedBufferPointerv(buffer, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void * data) {
+    glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glGetNamedBufferSubData");
+    glad_glGetNamedBufferSubData(buffer, offset, size, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint * params) {
+    glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) glad_gl_on_demand_loader("glGetNamedFramebufferAttachmentParameteriv");
+    glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint * param) {
+    glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetNamedFramebufferParameteriv");
+    glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint * params) {
+    glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetNamedRenderbufferParameteriv");
+    glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC) glad_gl_on_demand_loader("glGetObjectLabel");
+    glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetObjectPtrLabel(const void * ptr, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC) glad_gl_on_demand_loader("glGetObjectPtrLabel");
+    glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetPointerv(GLenum pname, void ** params) {
+    glad_glGetPointerv = (PFNGLGETPOINTERVPROC) glad_gl_on_demand_loader("glGetPointerv");
+    glad_glGetPointerv(pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary) {
+    glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC) glad_gl_on_demand_loader("glGetProgramBinary");
+    glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) glad_gl_on_demand_loader("glGetProgramInfoLog");
+    glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params) {
+    glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC) glad_gl_on_demand_loader("glGetProgramInterfaceiv");
+    glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) glad_gl_on_demand_loader("glGetProgramPipelineInfoLog");
+    glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint * params) {
+    glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC) glad_gl_on_demand_loader("glGetProgramPipelineiv");
+    glad_glGetProgramPipelineiv(pipeline, pname, params);
+}
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC) glad_gl_on_demand_loader("glGetProgramResourceIndex");
+    return glad_glGetProgramResourceIndex(program, programInterface, name);
+}
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar * name) {
+    glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC) glad_gl_on_demand_loader("glGetProgramResourceLocation");
+    return glad_glGetProgramResourceLocation(program, programInterface, name);
+}
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) glad_gl_on_demand_loader("glGetProgramResourceLocationIndex");
+    return glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC) glad_gl_on_demand_loader("glGetProgramResourceName");
+    glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei count, GLsizei * length, GLint * params) {
+    glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC) glad_gl_on_demand_loader("glGetProgramResourceiv");
+    glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values) {
+    glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC) glad_gl_on_demand_loader("glGetProgramStageiv");
+    glad_glGetProgramStageiv(program, shadertype, pname, values);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetProgramiv(GLuint program, GLenum pname, GLint * params) {
+    glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC) glad_gl_on_demand_loader("glGetProgramiv");
+    glad_glGetProgramiv(program, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC) glad_gl_on_demand_loader("glGetQueryBufferObjecti64v");
+    glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC) glad_gl_on_demand_loader("glGetQueryBufferObjectiv");
+    glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) glad_gl_on_demand_loader("glGetQueryBufferObjectui64v");
+    glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC) glad_gl_on_demand_loader("glGetQueryBufferObjectuiv");
+    glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params) {
+    glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC) glad_gl_on_demand_loader("glGetQueryIndexediv");
+    glad_glGetQueryIndexediv(target, index, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params) {
+    glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC) glad_gl_on_demand_loader("glGetQueryObjecti64v");
+    glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params) {
+    glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) glad_gl_on_demand_loader("glGetQueryObjectiv");
+    glad_glGetQueryObjectiv(id, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params) {
+    glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) glad_gl_on_demand_loader("glGetQueryObjectui64v");
+    glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params) {
+    glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC) glad_gl_on_demand_loader("glGetQueryObjectuiv");
+    glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetQueryiv(GLenum target, GLenum pname, GLint * params) {
+    glad_glGetQueryiv = (PFNGLGETQUERYIVPROC) glad_gl_on_demand_loader("glGetQueryiv");
+    glad_glGetQueryiv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetRenderbufferParameteriv");
+    glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params) {
+    glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC) glad_gl_on_demand_loader("glGetSamplerParameterIiv");
+    glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params) {
+    glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC) glad_gl_on_demand_loader("glGetSamplerParameterIuiv");
+    glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params) {
+    glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC) glad_gl_on_demand_loader("glGetSamplerParameterfv");
+    glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params) {
+    glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC) glad_gl_on_demand_loader("glGetSamplerParameteriv");
+    glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) glad_gl_on_demand_loader("glGetShaderInfoLog");
+    glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint * range, GLint * precision) {
+    glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC) glad_gl_on_demand_loader("glGetShaderPrecisionFormat");
+    glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source) {
+    glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC) glad_gl_on_demand_loader("glGetShaderSource");
+    glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetShaderiv(GLuint shader, GLenum pname, GLint * params) {
+    glad_glGetShaderiv = (PFNGLGETSHADERIVPROC) glad_gl_on_demand_loader("glGetShaderiv");
+    glad_glGetShaderiv(shader, pname, params);
+}
+static const GLubyte * GLAD_API_PTR glad_on_demand_impl_glGetString(GLenum name) {
+    glad_glGetString = (PFNGLGETSTRINGPROC) glad_gl_on_demand_loader("glGetString");
+    return glad_glGetString(name);
+}
+static const GLubyte * GLAD_API_PTR glad_on_demand_impl_glGetStringi(GLenum name, GLuint index) {
+    glad_glGetStringi = (PFNGLGETSTRINGIPROC) glad_gl_on_demand_loader("glGetStringi");
+    return glad_glGetStringi(name, index);
+}
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name) {
+    glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC) glad_gl_on_demand_loader("glGetSubroutineIndex");
+    return glad_glGetSubroutineIndex(program, shadertype, name);
+}
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name) {
+    glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) glad_gl_on_demand_loader("glGetSubroutineUniformLocation");
+    return glad_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei * length, GLint * values) {
+    glad_glGetSynciv = (PFNGLGETSYNCIVPROC) glad_gl_on_demand_loader("glGetSynciv");
+    glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels) {
+    glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC) glad_gl_on_demand_loader("glGetTexImage");
+    glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params) {
+    glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC) glad_gl_on_demand_loader("glGetTexLevelParameterfv");
+    glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params) {
+    glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC) glad_gl_on_demand_loader("glGetTexLevelParameteriv");
+    glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameterIiv(GLenum target, GLenum pname, GLint * params) {
+    glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC) glad_gl_on_demand_loader("glGetTexParameterIiv");
+    glad_glGetTexParameterIiv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params) {
+    glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC) glad_gl_on_demand_loader("glGetTexParameterIuiv");
+    glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) {
+    glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC) glad_gl_on_demand_loader("glGetTexParameterfv");
+    glad_glGetTexParameterfv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTexParameteriv(GLenum target, GLenum pname, GLint * params) {
+    glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC) glad_gl_on_demand_loader("glGetTexParameteriv");
+    glad_glGetTexParameteriv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC) glad_gl_on_demand_loader("glGetTextureImage");
+    glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat * params) {
+    glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC) glad_gl_on_demand_loader("glGetTextureLevelParameterfv");
+    glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint * params) {
+    glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC) glad_gl_on_demand_loader("glGetTextureLevelParameteriv");
+    glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint * params) {
+    glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC) glad_gl_on_demand_loader("glGetTextureParameterIiv");
+    glad_glGetTextureParameterIiv(texture, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint * params) {
+    glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC) glad_gl_on_demand_loader("glGetTextureParameterIuiv");
+    glad_glGetTextureParameterIuiv(texture, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat * params) {
+    glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC) glad_gl_on_demand_loader("glGetTextureParameterfv");
+    glad_glGetTextureParameterfv(texture, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint * params) {
+    glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC) glad_gl_on_demand_loader("glGetTextureParameteriv");
+    glad_glGetTextureParameteriv(texture, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC) glad_gl_on_demand_loader("glGetTextureSubImage");
+    glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) {
+    glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) glad_gl_on_demand_loader("glGetTransformFeedbackVarying");
+    glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 * param) {
+    glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) glad_gl_on_demand_loader("glGetTransformFeedbacki64_v");
+    glad_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint * param) {
+    glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC) glad_gl_on_demand_loader("glGetTransformFeedbacki_v");
+    glad_glGetTransformFeedbacki_v(xfb, pname, index, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint * param) {
+    glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC) glad_gl_on_demand_loader("glGetTransformFeedbackiv");
+    glad_glGetTransformFeedbackiv(xfb, pname, param);
+}
+static GLuint GLAD_API_PTR glad_on_demand_impl_glGetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName) {
+    glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) glad_gl_on_demand_loader("glGetUniformBlockIndex");
+    return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices) {
+    glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC) glad_gl_on_demand_loader("glGetUniformIndices");
+    glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static GLint GLAD_API_PTR glad_on_demand_impl_glGetUniformLocation(GLuint program, const GLchar * name) {
+    glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) glad_gl_on_demand_loader("glGetUniformLocation");
+    return glad_glGetUniformLocation(program, name);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params) {
+    glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) glad_gl_on_demand_loader("glGetUniformSubroutineuiv");
+    glad_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformdv(GLuint program, GLint location, GLdouble * params) {
+    glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC) glad_gl_on_demand_loader("glGetUniformdv");
+    glad_glGetUniformdv(program, location, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformfv(GLuint program, GLint location, GLfloat * params) {
+    glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC) glad_gl_on_demand_loader("glGetUniformfv");
+    glad_glGetUniformfv(program, location, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformiv(GLuint program, GLint location, GLint * params) {
+    glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC) glad_gl_on_demand_loader("glGetUniformiv");
+    glad_glGetUniformiv(program, location, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetUniformuiv(GLuint program, GLint location, GLuint * params) {
+    glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC) glad_gl_on_demand_loader("glGetUniformuiv");
+    glad_glGetUniformuiv(program, location, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 * param) {
+    glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC) glad_gl_on_demand_loader("glGetVertexArrayIndexed64iv");
+    glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint * param) {
+    glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC) glad_gl_on_demand_loader("glGetVertexArrayIndexediv");
+    glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint * param) {
+    glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC) glad_gl_on_demand_loader("glGetVertexArrayiv");
+    glad_glGetVertexArrayiv(vaobj, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint * params) {
+    glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC) glad_gl_on_demand_loader("glGetVertexAttribIiv");
+    glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params) {
+    glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC) glad_gl_on_demand_loader("glGetVertexAttribIuiv");
+    glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble * params) {
+    glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC) glad_gl_on_demand_loader("glGetVertexAttribLdv");
+    glad_glGetVertexAttribLdv(index, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer) {
+    glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC) glad_gl_on_demand_loader("glGetVertexAttribPointerv");
+    glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params) {
+    glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC) glad_gl_on_demand_loader("glGetVertexAttribdv");
+    glad_glGetVertexAttribdv(index, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params) {
+    glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC) glad_gl_on_demand_loader("glGetVertexAttribfv");
+    glad_glGetVertexAttribfv(index, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params) {
+    glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC) glad_gl_on_demand_loader("glGetVertexAttribiv");
+    glad_glGetVertexAttribiv(index, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void * pixels) {
+    glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) glad_gl_on_demand_loader("glGetnCompressedTexImage");
+    glad_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC) glad_gl_on_demand_loader("glGetnTexImage");
+    glad_glGetnTexImage(target, level, format, type, bufSize, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble * params) {
+    glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC) glad_gl_on_demand_loader("glGetnUniformdv");
+    glad_glGetnUniformdv(program, location, bufSize, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat * params) {
+    glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC) glad_gl_on_demand_loader("glGetnUniformfv");
+    glad_glGetnUniformfv(program, location, bufSize, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint * params) {
+    glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC) glad_gl_on_demand_loader("glGetnUniformiv");
+    glad_glGetnUniformiv(program, location, bufSize, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint * params) {
+    glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC) glad_gl_on_demand_loader("glGetnUniformuiv");
+    glad_glGetnUniformuiv(program, location, bufSize, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glHint(GLenum target, GLenum mode) {
+    glad_glHint = (PFNGLHINTPROC) glad_gl_on_demand_loader("glHint");
+    glad_glHint(target, mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateBufferData(GLuint buffer) {
+    glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC) glad_gl_on_demand_loader("glInvalidateBufferData");
+    glad_glInvalidateBufferData(buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glInvalidateBufferSubData");
+    glad_glInvalidateBufferSubData(buffer, offset, length);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments) {
+    glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC) glad_gl_on_demand_loader("glInvalidateFramebuffer");
+    glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments) {
+    glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) glad_gl_on_demand_loader("glInvalidateNamedFramebufferData");
+    glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glInvalidateNamedFramebufferSubData");
+    glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC) glad_gl_on_demand_loader("glInvalidateSubFramebuffer");
+    glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateTexImage(GLuint texture, GLint level) {
+    glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC) glad_gl_on_demand_loader("glInvalidateTexImage");
+    glad_glInvalidateTexImage(texture, level);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC) glad_gl_on_demand_loader("glInvalidateTexSubImage");
+    glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsBuffer(GLuint buffer) {
+    glad_glIsBuffer = (PFNGLISBUFFERPROC) glad_gl_on_demand_loader("glIsBuffer");
+    return glad_glIsBuffer(buffer);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsEnabled(GLenum cap) {
+    glad_glIsEnabled = (PFNGLISENABLEDPROC) glad_gl_on_demand_loader("glIsEnabled");
+    return glad_glIsEnabled(cap);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsEnabledi(GLenum target, GLuint index) {
+    glad_glIsEnabledi = (PFNGLISENABLEDIPROC) glad_gl_on_demand_loader("glIsEnabledi");
+    return glad_glIsEnabledi(target, index);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsFramebuffer(GLuint framebuffer) {
+    glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC) glad_gl_on_demand_loader("glIsFramebuffer");
+    return glad_glIsFramebuffer(framebuffer);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsProgram(GLuint program) {
+    glad_glIsProgram = (PFNGLISPROGRAMPROC) glad_gl_on_demand_loader("glIsProgram");
+    return glad_glIsProgram(program);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsProgramPipeline(GLuint pipeline) {
+    glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC) glad_gl_on_demand_loader("glIsProgramPipeline");
+    return glad_glIsProgramPipeline(pipeline);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsQuery(GLuint id) {
+    glad_glIsQuery = (PFNGLISQUERYPROC) glad_gl_on_demand_loader("glIsQuery");
+    return glad_glIsQuery(id);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsRenderbuffer(GLuint renderbuffer) {
+    glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC) glad_gl_on_demand_loader("glIsRenderbuffer");
+    return glad_glIsRenderbuffer(renderbuffer);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsSampler(GLuint sampler) {
+    glad_glIsSampler = (PFNGLISSAMPLERPROC) glad_gl_on_demand_loader("glIsSampler");
+    return glad_glIsSampler(sampler);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsShader(GLuint shader) {
+    glad_glIsShader = (PFNGLISSHADERPROC) glad_gl_on_demand_loader("glIsShader");
+    return glad_glIsShader(shader);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsSync(GLsync sync) {
+    glad_glIsSync = (PFNGLISSYNCPROC) glad_gl_on_demand_loader("glIsSync");
+    return glad_glIsSync(sync);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsTexture(GLuint texture) {
+    glad_glIsTexture = (PFNGLISTEXTUREPROC) glad_gl_on_demand_loader("glIsTexture");
+    return glad_glIsTexture(texture);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsTransformFeedback(GLuint id) {
+    glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glIsTransformFeedback");
+    return glad_glIsTransformFeedback(id);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glIsVertexArray(GLuint array) {
+    glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC) glad_gl_on_demand_loader("glIsVertexArray");
+    return glad_glIsVertexArray(array);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glLineWidth(GLfloat width) {
+    glad_glLineWidth = (PFNGLLINEWIDTHPROC) glad_gl_on_demand_loader("glLineWidth");
+    glad_glLineWidth(width);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glLinkProgram(GLuint program) {
+    glad_glLinkProgram = (PFNGLLINKPROGRAMPROC) glad_gl_on_demand_loader("glLinkProgram");
+    glad_glLinkProgram(program);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glLogicOp(GLenum opcode) {
+    glad_glLogicOp = (PFNGLLOGICOPPROC) glad_gl_on_demand_loader("glLogicOp");
+    glad_glLogicOp(opcode);
+}
+static void * GLAD_API_PTR glad_on_demand_impl_glMapBuffer(GLenum target, GLenum access) {
+    glad_glMapBuffer = (PFNGLMAPBUFFERPROC) glad_gl_on_demand_loader("glMapBuffer");
+    return glad_glMapBuffer(target, access);
+}
+static void * GLAD_API_PTR glad_on_demand_impl_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) glad_gl_on_demand_loader("glMapBufferRange");
+    return glad_glMapBufferRange(target, offset, length, access);
+}
+static void * GLAD_API_PTR glad_on_demand_impl_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC) glad_gl_on_demand_loader("glMapNamedBuffer");
+    return glad_glMapNamedBuffer(buffer, access);
+}
+static void * GLAD_API_PTR glad_on_demand_impl_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC) glad_gl_on_demand_loader("glMapNamedBufferRange");
+    return glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMemoryBarrier(GLbitfield barriers) {
+    glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC) glad_gl_on_demand_loader("glMemoryBarrier");
+    glad_glMemoryBarrier(barriers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMemoryBarrierByRegion(GLbitfield barriers) {
+    glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC) glad_gl_on_demand_loader("glMemoryBarrierByRegion");
+    glad_glMemoryBarrierByRegion(barriers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMinSampleShading(GLfloat value) {
+    glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC) glad_gl_on_demand_loader("glMinSampleShading");
+    glad_glMinSampleShading(value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount) {
+    glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC) glad_gl_on_demand_loader("glMultiDrawArrays");
+    glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawArraysIndirect(GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) glad_gl_on_demand_loader("glMultiDrawArraysIndirect");
+    glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawArraysIndirectCount(GLenum mode, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC) glad_gl_on_demand_loader("glMultiDrawArraysIndirectCount");
+    glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount) {
+    glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC) glad_gl_on_demand_loader("glMultiDrawElements");
+    glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex) {
+    glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) glad_gl_on_demand_loader("glMultiDrawElementsBaseVertex");
+    glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) glad_gl_on_demand_loader("glMultiDrawElementsIndirect");
+    glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC) glad_gl_on_demand_loader("glMultiDrawElementsIndirectCount");
+    glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void * data, GLenum usage) {
+    glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC) glad_gl_on_demand_loader("glNamedBufferData");
+    glad_glNamedBufferData(buffer, size, data, usage);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void * data, GLbitfield flags) {
+    glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC) glad_gl_on_demand_loader("glNamedBufferStorage");
+    glad_glNamedBufferStorage(buffer, size, data, flags);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data) {
+    glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC) glad_gl_on_demand_loader("glNamedBufferSubData");
+    glad_glNamedBufferSubData(buffer, offset, size, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+    glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) glad_gl_on_demand_loader("glNamedFramebufferDrawBuffer");
+    glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum * bufs) {
+    glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) glad_gl_on_demand_loader("glNamedFramebufferDrawBuffers");
+    glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+    glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) glad_gl_on_demand_loader("glNamedFramebufferParameteri");
+    glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+    glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) glad_gl_on_demand_loader("glNamedFramebufferReadBuffer");
+    glad_glNamedFramebufferReadBuffer(framebuffer, src);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) glad_gl_on_demand_loader("glNamedFramebufferRenderbuffer");
+    glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+    glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) glad_gl_on_demand_loader("glNamedFramebufferTexture");
+    glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) glad_gl_on_demand_loader("glNamedFramebufferTextureLayer");
+    glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) glad_gl_on_demand_loader("glNamedRenderbufferStorage");
+    glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) glad_gl_on_demand_loader("glNamedRenderbufferStorageMultisample");
+    glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar * label) {
+    glad_glObjectLabel = (PFNGLOBJECTLABELPROC) glad_gl_on_demand_loader("glObjectLabel");
+    glad_glObjectLabel(identifier, name, length, label);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glObjectPtrLabel(const void * ptr, GLsizei length, const GLchar * label) {
+    glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC) glad_gl_on_demand_loader("glObjectPtrLabel");
+    glad_glObjectPtrLabel(ptr, length, label);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPatchParameterfv(GLenum pname, const GLfloat * values) {
+    glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC) glad_gl_on_demand_loader("glPatchParameterfv");
+    glad_glPatchParameterfv(pname, values);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPatchParameteri(GLenum pname, GLint value) {
+    glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC) glad_gl_on_demand_loader("glPatchParameteri");
+    glad_glPatchParameteri(pname, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPauseTransformFeedback(void) {
+    glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glPauseTransformFeedback");
+    glad_glPauseTransformFeedback();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPixelStoref(GLenum pname, GLfloat param) {
+    glad_glPixelStoref = (PFNGLPIXELSTOREFPROC) glad_gl_on_demand_loader("glPixelStoref");
+    glad_glPixelStoref(pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPixelStorei(GLenum pname, GLint param) {
+    glad_glPixelStorei = (PFNGLPIXELSTOREIPROC) glad_gl_on_demand_loader("glPixelStorei");
+    glad_glPixelStorei(pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameterf(GLenum pname, GLfloat param) {
+    glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC) glad_gl_on_demand_loader("glPointParameterf");
+    glad_glPointParameterf(pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameterfv(GLenum pname, const GLfloat * params) {
+    glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC) glad_gl_on_demand_loader("glPointParameterfv");
+    glad_glPointParameterfv(pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameteri(GLenum pname, GLint param) {
+    glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC) glad_gl_on_demand_loader("glPointParameteri");
+    glad_glPointParameteri(pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPointParameteriv(GLenum pname, const GLint * params) {
+    glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC) glad_gl_on_demand_loader("glPointParameteriv");
+    glad_glPointParameteriv(pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPointSize(GLfloat size) {
+    glad_glPointSize = (PFNGLPOINTSIZEPROC) glad_gl_on_demand_loader("glPointSize");
+    glad_glPointSize(size);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPolygonMode(GLenum face, GLenum mode) {
+    glad_glPolygonMode = (PFNGLPOLYGONMODEPROC) glad_gl_on_demand_loader("glPolygonMode");
+    glad_glPolygonMode(face, mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPolygonOffset(GLfloat factor, GLfloat units) {
+    glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC) glad_gl_on_demand_loader("glPolygonOffset");
+    glad_glPolygonOffset(factor, units);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC) glad_gl_on_demand_loader("glPolygonOffsetClamp");
+    glad_glPolygonOffsetClamp(factor, units, clamp);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPopDebugGroup(void) {
+    glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC) glad_gl_on_demand_loader("glPopDebugGroup");
+    glad_glPopDebugGroup();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPrimitiveRestartIndex(GLuint index) {
+    glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC) glad_gl_on_demand_loader("glPrimitiveRestartIndex");
+    glad_glPrimitiveRestartIndex(index);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramBinary(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length) {
+    glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC) glad_gl_on_demand_loader("glProgramBinary");
+    glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC) glad_gl_on_demand_loader("glProgramParameteri");
+    glad_glProgramParameteri(program, pname, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC) glad_gl_on_demand_loader("glProgramUniform1d");
+    glad_glProgramUniform1d(program, location, v0);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC) glad_gl_on_demand_loader("glProgramUniform1dv");
+    glad_glProgramUniform1dv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC) glad_gl_on_demand_loader("glProgramUniform1f");
+    glad_glProgramUniform1f(program, location, v0);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC) glad_gl_on_demand_loader("glProgramUniform1fv");
+    glad_glProgramUniform1fv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC) glad_gl_on_demand_loader("glProgramUniform1i");
+    glad_glProgramUniform1i(program, location, v0);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC) glad_gl_on_demand_loader("glProgramUniform1iv");
+    glad_glProgramUniform1iv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC) glad_gl_on_demand_loader("glProgramUniform1ui");
+    glad_glProgramUniform1ui(program, location, v0);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC) glad_gl_on_demand_loader("glProgramUniform1uiv");
+    glad_glProgramUniform1uiv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC) glad_gl_on_demand_loader("glProgramUniform2d");
+    glad_glProgramUniform2d(program, location, v0, v1);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC) glad_gl_on_demand_loader("glProgramUniform2dv");
+    glad_glProgramUniform2dv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC) glad_gl_on_demand_loader("glProgramUniform2f");
+    glad_glProgramUniform2f(program, location, v0, v1);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC) glad_gl_on_demand_loader("glProgramUniform2fv");
+    glad_glProgramUniform2fv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC) glad_gl_on_demand_loader("glProgramUniform2i");
+    glad_glProgramUniform2i(program, location, v0, v1);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC) glad_gl_on_demand_loader("glProgramUniform2iv");
+    glad_glProgramUniform2iv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC) glad_gl_on_demand_loader("glProgramUniform2ui");
+    glad_glProgramUniform2ui(program, location, v0, v1);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC) glad_gl_on_demand_loader("glProgramUniform2uiv");
+    glad_glProgramUniform2uiv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC) glad_gl_on_demand_loader("glProgramUniform3d");
+    glad_glProgramUniform3d(program, location, v0, v1, v2);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC) glad_gl_on_demand_loader("glProgramUniform3dv");
+    glad_glProgramUniform3dv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC) glad_gl_on_demand_loader("glProgramUniform3f");
+    glad_glProgramUniform3f(program, location, v0, v1, v2);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC) glad_gl_on_demand_loader("glProgramUniform3fv");
+    glad_glProgramUniform3fv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC) glad_gl_on_demand_loader("glProgramUniform3i");
+    glad_glProgramUniform3i(program, location, v0, v1, v2);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC) glad_gl_on_demand_loader("glProgramUniform3iv");
+    glad_glProgramUniform3iv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC) glad_gl_on_demand_loader("glProgramUniform3ui");
+    glad_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC) glad_gl_on_demand_loader("glProgramUniform3uiv");
+    glad_glProgramUniform3uiv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC) glad_gl_on_demand_loader("glProgramUniform4d");
+    glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC) glad_gl_on_demand_loader("glProgramUniform4dv");
+    glad_glProgramUniform4dv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC) glad_gl_on_demand_loader("glProgramUniform4f");
+    glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC) glad_gl_on_demand_loader("glProgramUniform4fv");
+    glad_glProgramUniform4fv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC) glad_gl_on_demand_loader("glProgramUniform4i");
+    glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC) glad_gl_on_demand_loader("glProgramUniform4iv");
+    glad_glProgramUniform4iv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC) glad_gl_on_demand_loader("glProgramUniform4ui");
+    glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC) glad_gl_on_demand_loader("glProgramUniform4uiv");
+    glad_glProgramUniform4uiv(program, location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2dv");
+    glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2fv");
+    glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x3dv");
+    glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x3fv");
+    glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x4dv");
+    glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix2x4fv");
+    glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3dv");
+    glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3fv");
+    glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x2dv");
+    glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x2fv");
+    glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x4dv");
+    glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix3x4fv");
+    glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4dv");
+    glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4fv");
+    glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x2dv");
+    glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x2fv");
+    glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x3dv");
+    glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) glad_gl_on_demand_loader("glProgramUniformMatrix4x3fv");
+    glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glProvokingVertex(GLenum mode) {
+    glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC) glad_gl_on_demand_loader("glProvokingVertex");
+    glad_glProvokingVertex(mode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar * message) {
+    glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC) glad_gl_on_demand_loader("glPushDebugGroup");
+    glad_glPushDebugGroup(source, id, length, message);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glQueryCounter(GLuint id, GLenum target) {
+    glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC) glad_gl_on_demand_loader("glQueryCounter");
+    glad_glQueryCounter(id, target);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glReadBuffer(GLenum src) {
+    glad_glReadBuffer = (PFNGLREADBUFFERPROC) glad_gl_on_demand_loader("glReadBuffer");
+    glad_glReadBuffer(src);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels) {
+    glad_glReadPixels = (PFNGLREADPIXELSPROC) glad_gl_on_demand_loader("glReadPixels");
+    glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void * data) {
+    glad_glReadnPixels = (PFNGLREADNPIXELSPROC) glad_gl_on_demand_loader("glReadnPixels");
+    glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glReleaseShaderCompiler(void) {
+    glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC) glad_gl_on_demand_loader("glReleaseShaderCompiler");
+    glad_glReleaseShaderCompiler();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) glad_gl_on_demand_loader("glRenderbufferStorage");
+    glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) glad_gl_on_demand_loader("glRenderbufferStorageMultisample");
+    glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glResumeTransformFeedback(void) {
+    glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC) glad_gl_on_demand_loader("glResumeTransformFeedback");
+    glad_glResumeTransformFeedback();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSampleCoverage(GLfloat value, GLboolean invert) {
+    glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC) glad_gl_on_demand_loader("glSampleCoverage");
+    glad_glSampleCoverage(value, invert);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC) glad_gl_on_demand_loader("glSampleMaski");
+    glad_glSampleMaski(maskNumber, mask);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param) {
+    glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC) glad_gl_on_demand_loader("glSamplerParameterIiv");
+    glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param) {
+    glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC) glad_gl_on_demand_loader("glSamplerParameterIuiv");
+    glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC) glad_gl_on_demand_loader("glSamplerParameterf");
+    glad_glSamplerParameterf(sampler, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param) {
+    glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC) glad_gl_on_demand_loader("glSamplerParameterfv");
+    glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC) glad_gl_on_demand_loader("glSamplerParameteri");
+    glad_glSamplerParameteri(sampler, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param) {
+    glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC) glad_gl_on_demand_loader("glSamplerParameteriv");
+    glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glScissor = (PFNGLSCISSORPROC) glad_gl_on_demand_loader("glScissor");
+    glad_glScissor(x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glScissorArrayv(GLuint first, GLsizei count, const GLint * v) {
+    glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC) glad_gl_on_demand_loader("glScissorArrayv");
+    glad_glScissorArrayv(first, count, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC) glad_gl_on_demand_loader("glScissorIndexed");
+    glad_glScissorIndexed(index, left, bottom, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glScissorIndexedv(GLuint index, const GLint * v) {
+    glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC) glad_gl_on_demand_loader("glScissorIndexedv");
+    glad_glScissorIndexedv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glShaderBinary(GLsizei count, const GLuint * shaders, GLenum binaryFormat, const void * binary, GLsizei length) {
+    glad_glShaderBinary = (PFNGLSHADERBINARYPROC) glad_gl_on_demand_loader("glShaderBinary");
+    glad_glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length) {
+    glad_glShaderSource = (PFNGLSHADERSOURCEPROC) glad_gl_on_demand_loader("glShaderSource");
+    glad_glShaderSource(shader, count, string, length);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) glad_gl_on_demand_loader("glShaderStorageBlockBinding");
+    glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glSpecializeShader(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue) {
+    glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC) glad_gl_on_demand_loader("glSpecializeShader");
+    glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    glad_glStencilFunc = (PFNGLSTENCILFUNCPROC) glad_gl_on_demand_loader("glStencilFunc");
+    glad_glStencilFunc(func, ref, mask);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC) glad_gl_on_demand_loader("glStencilFuncSeparate");
+    glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glStencilMask(GLuint mask) {
+    glad_glStencilMask = (PFNGLSTENCILMASKPROC) glad_gl_on_demand_loader("glStencilMask");
+    glad_glStencilMask(mask);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC) glad_gl_on_demand_loader("glStencilMaskSeparate");
+    glad_glStencilMaskSeparate(face, mask);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    glad_glStencilOp = (PFNGLSTENCILOPPROC) glad_gl_on_demand_loader("glStencilOp");
+    glad_glStencilOp(fail, zfail, zpass);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC) glad_gl_on_demand_loader("glStencilOpSeparate");
+    glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    glad_glTexBuffer = (PFNGLTEXBUFFERPROC) glad_gl_on_demand_loader("glTexBuffer");
+    glad_glTexBuffer(target, internalformat, buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC) glad_gl_on_demand_loader("glTexBufferRange");
+    glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels) {
+    glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC) glad_gl_on_demand_loader("glTexImage1D");
+    glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels) {
+    glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC) glad_gl_on_demand_loader("glTexImage2D");
+    glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexImage2DMultisample");
+    glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels) {
+    glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC) glad_gl_on_demand_loader("glTexImage3D");
+    glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexImage3DMultisample");
+    glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterIiv(GLenum target, GLenum pname, const GLint * params) {
+    glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC) glad_gl_on_demand_loader("glTexParameterIiv");
+    glad_glTexParameterIiv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint * params) {
+    glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC) glad_gl_on_demand_loader("glTexParameterIuiv");
+    glad_glTexParameterIuiv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC) glad_gl_on_demand_loader("glTexParameterf");
+    glad_glTexParameterf(target, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params) {
+    glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC) glad_gl_on_demand_loader("glTexParameterfv");
+    glad_glTexParameterfv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC) glad_gl_on_demand_loader("glTexParameteri");
+    glad_glTexParameteri(target, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexParameteriv(GLenum target, GLenum pname, const GLint * params) {
+    glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC) glad_gl_on_demand_loader("glTexParameteriv");
+    glad_glTexParameteriv(target, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC) glad_gl_on_demand_loader("glTexStorage1D");
+    glad_glTexStorage1D(target, levels, internalformat, width);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC) glad_gl_on_demand_loader("glTexStorage2D");
+    glad_glTexStorage2D(target, levels, internalformat, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexStorage2DMultisample");
+    glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC) glad_gl_on_demand_loader("glTexStorage3D");
+    glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTexStorage3DMultisample");
+    glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC) glad_gl_on_demand_loader("glTexSubImage1D");
+    glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC) glad_gl_on_demand_loader("glTexSubImage2D");
+    glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC) glad_gl_on_demand_loader("glTexSubImage3D");
+    glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureBarrier(void) {
+    glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC) glad_gl_on_demand_loader("glTextureBarrier");
+    glad_glTextureBarrier();
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+    glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC) glad_gl_on_demand_loader("glTextureBuffer");
+    glad_glTextureBuffer(texture, internalformat, buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC) glad_gl_on_demand_loader("glTextureBufferRange");
+    glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint * params) {
+    glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC) glad_gl_on_demand_loader("glTextureParameterIiv");
+    glad_glTextureParameterIiv(texture, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint * params) {
+    glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC) glad_gl_on_demand_loader("glTextureParameterIuiv");
+    glad_glTextureParameterIuiv(texture, pname, params);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+    glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC) glad_gl_on_demand_loader("glTextureParameterf");
+    glad_glTextureParameterf(texture, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat * param) {
+    glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC) glad_gl_on_demand_loader("glTextureParameterfv");
+    glad_glTextureParameterfv(texture, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC) glad_gl_on_demand_loader("glTextureParameteri");
+    glad_glTextureParameteri(texture, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureParameteriv(GLuint texture, GLenum pname, const GLint * param) {
+    glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC) glad_gl_on_demand_loader("glTextureParameteriv");
+    glad_glTextureParameteriv(texture, pname, param);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC) glad_gl_on_demand_loader("glTextureStorage1D");
+    glad_glTextureStorage1D(texture, levels, internalformat, width);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC) glad_gl_on_demand_loader("glTextureStorage2D");
+    glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTextureStorage2DMultisample");
+    glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC) glad_gl_on_demand_loader("glTextureStorage3D");
+    glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) glad_gl_on_demand_loader("glTextureStorage3DMultisample");
+    glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC) glad_gl_on_demand_loader("glTextureSubImage1D");
+    glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC) glad_gl_on_demand_loader("glTextureSubImage2D");
+    glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC) glad_gl_on_demand_loader("glTextureSubImage3D");
+    glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    glad_glTextureView = (PFNGLTEXTUREVIEWPROC) glad_gl_on_demand_loader("glTextureView");
+    glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+    glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) glad_gl_on_demand_loader("glTransformFeedbackBufferBase");
+    glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) glad_gl_on_demand_loader("glTransformFeedbackBufferRange");
+    glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode) {
+    glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) glad_gl_on_demand_loader("glTransformFeedbackVaryings");
+    glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1d(GLint location, GLdouble x) {
+    glad_glUniform1d = (PFNGLUNIFORM1DPROC) glad_gl_on_demand_loader("glUniform1d");
+    glad_glUniform1d(location, x);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1dv(GLint location, GLsizei count, const GLdouble * value) {
+    glad_glUniform1dv = (PFNGLUNIFORM1DVPROC) glad_gl_on_demand_loader("glUniform1dv");
+    glad_glUniform1dv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1f(GLint location, GLfloat v0) {
+    glad_glUniform1f = (PFNGLUNIFORM1FPROC) glad_gl_on_demand_loader("glUniform1f");
+    glad_glUniform1f(location, v0);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1fv(GLint location, GLsizei count, const GLfloat * value) {
+    glad_glUniform1fv = (PFNGLUNIFORM1FVPROC) glad_gl_on_demand_loader("glUniform1fv");
+    glad_glUniform1fv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1i(GLint location, GLint v0) {
+    glad_glUniform1i = (PFNGLUNIFORM1IPROC) glad_gl_on_demand_loader("glUniform1i");
+    glad_glUniform1i(location, v0);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1iv(GLint location, GLsizei count, const GLint * value) {
+    glad_glUniform1iv = (PFNGLUNIFORM1IVPROC) glad_gl_on_demand_loader("glUniform1iv");
+    glad_glUniform1iv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1ui(GLint location, GLuint v0) {
+    glad_glUniform1ui = (PFNGLUNIFORM1UIPROC) glad_gl_on_demand_loader("glUniform1ui");
+    glad_glUniform1ui(location, v0);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform1uiv(GLint location, GLsizei count, const GLuint * value) {
+    glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC) glad_gl_on_demand_loader("glUniform1uiv");
+    glad_glUniform1uiv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    glad_glUniform2d = (PFNGLUNIFORM2DPROC) glad_gl_on_demand_loader("glUniform2d");
+    glad_glUniform2d(location, x, y);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2dv(GLint location, GLsizei count, const GLdouble * value) {
+    glad_glUniform2dv = (PFNGLUNIFORM2DVPROC) glad_gl_on_demand_loader("glUniform2dv");
+    glad_glUniform2dv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    glad_glUniform2f = (PFNGLUNIFORM2FPROC) glad_gl_on_demand_loader("glUniform2f");
+    glad_glUniform2f(location, v0, v1);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2fv(GLint location, GLsizei count, const GLfloat * value) {
+    glad_glUniform2fv = (PFNGLUNIFORM2FVPROC) glad_gl_on_demand_loader("glUniform2fv");
+    glad_glUniform2fv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2i(GLint location, GLint v0, GLint v1) {
+    glad_glUniform2i = (PFNGLUNIFORM2IPROC) glad_gl_on_demand_loader("glUniform2i");
+    glad_glUniform2i(location, v0, v1);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2iv(GLint location, GLsizei count, const GLint * value) {
+    glad_glUniform2iv = (PFNGLUNIFORM2IVPROC) glad_gl_on_demand_loader("glUniform2iv");
+    glad_glUniform2iv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    glad_glUniform2ui = (PFNGLUNIFORM2UIPROC) glad_gl_on_demand_loader("glUniform2ui");
+    glad_glUniform2ui(location, v0, v1);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform2uiv(GLint location, GLsizei count, const GLuint * value) {
+    glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC) glad_gl_on_demand_loader("glUniform2uiv");
+    glad_glUniform2uiv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    glad_glUniform3d = (PFNGLUNIFORM3DPROC) glad_gl_on_demand_loader("glUniform3d");
+    glad_glUniform3d(location, x, y, z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3dv(GLint location, GLsizei count, const GLdouble * value) {
+    glad_glUniform3dv = (PFNGLUNIFORM3DVPROC) glad_gl_on_demand_loader("glUniform3dv");
+    glad_glUniform3dv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    glad_glUniform3f = (PFNGLUNIFORM3FPROC) glad_gl_on_demand_loader("glUniform3f");
+    glad_glUniform3f(location, v0, v1, v2);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3fv(GLint location, GLsizei count, const GLfloat * value) {
+    glad_glUniform3fv = (PFNGLUNIFORM3FVPROC) glad_gl_on_demand_loader("glUniform3fv");
+    glad_glUniform3fv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    glad_glUniform3i = (PFNGLUNIFORM3IPROC) glad_gl_on_demand_loader("glUniform3i");
+    glad_glUniform3i(location, v0, v1, v2);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3iv(GLint location, GLsizei count, const GLint * value) {
+    glad_glUniform3iv = (PFNGLUNIFORM3IVPROC) glad_gl_on_demand_loader("glUniform3iv");
+    glad_glUniform3iv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    glad_glUniform3ui = (PFNGLUNIFORM3UIPROC) glad_gl_on_demand_loader("glUniform3ui");
+    glad_glUniform3ui(location, v0, v1, v2);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform3uiv(GLint location, GLsizei count, const GLuint * value) {
+    glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC) glad_gl_on_demand_loader("glUniform3uiv");
+    glad_glUniform3uiv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glUniform4d = (PFNGLUNIFORM4DPROC) glad_gl_on_demand_loader("glUniform4d");
+    glad_glUniform4d(location, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4dv(GLint location, GLsizei count, const GLdouble * value) {
+    glad_glUniform4dv = (PFNGLUNIFORM4DVPROC) glad_gl_on_demand_loader("glUniform4dv");
+    glad_glUniform4dv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    glad_glUniform4f = (PFNGLUNIFORM4FPROC) glad_gl_on_demand_loader("glUniform4f");
+    glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4fv(GLint location, GLsizei count, const GLfloat * value) {
+    glad_glUniform4fv = (PFNGLUNIFORM4FVPROC) glad_gl_on_demand_loader("glUniform4fv");
+    glad_glUniform4fv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    glad_glUniform4i = (PFNGLUNIFORM4IPROC) glad_gl_on_demand_loader("glUniform4i");
+    glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4iv(GLint location, GLsizei count, const GLint * value) {
+    glad_glUniform4iv = (PFNGLUNIFORM4IVPROC) glad_gl_on_demand_loader("glUniform4iv");
+    glad_glUniform4iv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    glad_glUniform4ui = (PFNGLUNIFORM4UIPROC) glad_gl_on_demand_loader("glUniform4ui");
+    glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniform4uiv(GLint location, GLsizei count, const GLuint * value) {
+    glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC) glad_gl_on_demand_loader("glUniform4uiv");
+    glad_glUniform4uiv(location, count, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) glad_gl_on_demand_loader("glUniformBlockBinding");
+    glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC) glad_gl_on_demand_loader("glUniformMatrix2dv");
+    glad_glUniformMatrix2dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC) glad_gl_on_demand_loader("glUniformMatrix2fv");
+    glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC) glad_gl_on_demand_loader("glUniformMatrix2x3dv");
+    glad_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC) glad_gl_on_demand_loader("glUniformMatrix2x3fv");
+    glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC) glad_gl_on_demand_loader("glUniformMatrix2x4dv");
+    glad_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC) glad_gl_on_demand_loader("glUniformMatrix2x4fv");
+    glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC) glad_gl_on_demand_loader("glUniformMatrix3dv");
+    glad_glUniformMatrix3dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC) glad_gl_on_demand_loader("glUniformMatrix3fv");
+    glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC) glad_gl_on_demand_loader("glUniformMatrix3x2dv");
+    glad_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC) glad_gl_on_demand_loader("glUniformMatrix3x2fv");
+    glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC) glad_gl_on_demand_loader("glUniformMatrix3x4dv");
+    glad_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC) glad_gl_on_demand_loader("glUniformMatrix3x4fv");
+    glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC) glad_gl_on_demand_loader("glUniformMatrix4dv");
+    glad_glUniformMatrix4dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC) glad_gl_on_demand_loader("glUniformMatrix4fv");
+    glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC) glad_gl_on_demand_loader("glUniformMatrix4x2dv");
+    glad_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC) glad_gl_on_demand_loader("glUniformMatrix4x2fv");
+    glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC) glad_gl_on_demand_loader("glUniformMatrix4x3dv");
+    glad_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC) glad_gl_on_demand_loader("glUniformMatrix4x3fv");
+    glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices) {
+    glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC) glad_gl_on_demand_loader("glUniformSubroutinesuiv");
+    glad_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glUnmapBuffer(GLenum target) {
+    glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC) glad_gl_on_demand_loader("glUnmapBuffer");
+    return glad_glUnmapBuffer(target);
+}
+static GLboolean GLAD_API_PTR glad_on_demand_impl_glUnmapNamedBuffer(GLuint buffer) {
+    glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC) glad_gl_on_demand_loader("glUnmapNamedBuffer");
+    return glad_glUnmapNamedBuffer(buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUseProgram(GLuint program) {
+    glad_glUseProgram = (PFNGLUSEPROGRAMPROC) glad_gl_on_demand_loader("glUseProgram");
+    glad_glUseProgram(program);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC) glad_gl_on_demand_loader("glUseProgramStages");
+    glad_glUseProgramStages(pipeline, stages, program);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glValidateProgram(GLuint program) {
+    glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC) glad_gl_on_demand_loader("glValidateProgram");
+    glad_glValidateProgram(program);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glValidateProgramPipeline(GLuint pipeline) {
+    glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC) glad_gl_on_demand_loader("glValidateProgramPipeline");
+    glad_glValidateProgramPipeline(pipeline);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+    glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC) glad_gl_on_demand_loader("glVertexArrayAttribBinding");
+    glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC) glad_gl_on_demand_loader("glVertexArrayAttribFormat");
+    glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC) glad_gl_on_demand_loader("glVertexArrayAttribIFormat");
+    glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC) glad_gl_on_demand_loader("glVertexArrayAttribLFormat");
+    glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+    glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC) glad_gl_on_demand_loader("glVertexArrayBindingDivisor");
+    glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC) glad_gl_on_demand_loader("glVertexArrayElementBuffer");
+    glad_glVertexArrayElementBuffer(vaobj, buffer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC) glad_gl_on_demand_loader("glVertexArrayVertexBuffer");
+    glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides) {
+    glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) glad_gl_on_demand_loader("glVertexArrayVertexBuffers");
+    glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1d(GLuint index, GLdouble x) {
+    glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC) glad_gl_on_demand_loader("glVertexAttrib1d");
+    glad_glVertexAttrib1d(index, x);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC) glad_gl_on_demand_loader("glVertexAttrib1dv");
+    glad_glVertexAttrib1dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1f(GLuint index, GLfloat x) {
+    glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) glad_gl_on_demand_loader("glVertexAttrib1f");
+    glad_glVertexAttrib1f(index, x);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1fv(GLuint index, const GLfloat * v) {
+    glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC) glad_gl_on_demand_loader("glVertexAttrib1fv");
+    glad_glVertexAttrib1fv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1s(GLuint index, GLshort x) {
+    glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC) glad_gl_on_demand_loader("glVertexAttrib1s");
+    glad_glVertexAttrib1s(index, x);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib1sv(GLuint index, const GLshort * v) {
+    glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC) glad_gl_on_demand_loader("glVertexAttrib1sv");
+    glad_glVertexAttrib1sv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC) glad_gl_on_demand_loader("glVertexAttrib2d");
+    glad_glVertexAttrib2d(index, x, y);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC) glad_gl_on_demand_loader("glVertexAttrib2dv");
+    glad_glVertexAttrib2dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) glad_gl_on_demand_loader("glVertexAttrib2f");
+    glad_glVertexAttrib2f(index, x, y);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2fv(GLuint index, const GLfloat * v) {
+    glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC) glad_gl_on_demand_loader("glVertexAttrib2fv");
+    glad_glVertexAttrib2fv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC) glad_gl_on_demand_loader("glVertexAttrib2s");
+    glad_glVertexAttrib2s(index, x, y);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib2sv(GLuint index, const GLshort * v) {
+    glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC) glad_gl_on_demand_loader("glVertexAttrib2sv");
+    glad_glVertexAttrib2sv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC) glad_gl_on_demand_loader("glVertexAttrib3d");
+    glad_glVertexAttrib3d(index, x, y, z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC) glad_gl_on_demand_loader("glVertexAttrib3dv");
+    glad_glVertexAttrib3dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC) glad_gl_on_demand_loader("glVertexAttrib3f");
+    glad_glVertexAttrib3f(index, x, y, z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3fv(GLuint index, const GLfloat * v) {
+    glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC) glad_gl_on_demand_loader("glVertexAttrib3fv");
+    glad_glVertexAttrib3fv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC) glad_gl_on_demand_loader("glVertexAttrib3s");
+    glad_glVertexAttrib3s(index, x, y, z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib3sv(GLuint index, const GLshort * v) {
+    glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC) glad_gl_on_demand_loader("glVertexAttrib3sv");
+    glad_glVertexAttrib3sv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nbv(GLuint index, const GLbyte * v) {
+    glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nbv");
+    glad_glVertexAttrib4Nbv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Niv(GLuint index, const GLint * v) {
+    glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC) glad_gl_on_demand_loader("glVertexAttrib4Niv");
+    glad_glVertexAttrib4Niv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nsv(GLuint index, const GLshort * v) {
+    glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nsv");
+    glad_glVertexAttrib4Nsv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC) glad_gl_on_demand_loader("glVertexAttrib4Nub");
+    glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nubv(GLuint index, const GLubyte * v) {
+    glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nubv");
+    glad_glVertexAttrib4Nubv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nuiv(GLuint index, const GLuint * v) {
+    glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nuiv");
+    glad_glVertexAttrib4Nuiv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4Nusv(GLuint index, const GLushort * v) {
+    glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC) glad_gl_on_demand_loader("glVertexAttrib4Nusv");
+    glad_glVertexAttrib4Nusv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4bv(GLuint index, const GLbyte * v) {
+    glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC) glad_gl_on_demand_loader("glVertexAttrib4bv");
+    glad_glVertexAttrib4bv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC) glad_gl_on_demand_loader("glVertexAttrib4d");
+    glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC) glad_gl_on_demand_loader("glVertexAttrib4dv");
+    glad_glVertexAttrib4dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) glad_gl_on_demand_loader("glVertexAttrib4f");
+    glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4fv(GLuint index, const GLfloat * v) {
+    glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC) glad_gl_on_demand_loader("glVertexAttrib4fv");
+    glad_glVertexAttrib4fv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4iv(GLuint index, const GLint * v) {
+    glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC) glad_gl_on_demand_loader("glVertexAttrib4iv");
+    glad_glVertexAttrib4iv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC) glad_gl_on_demand_loader("glVertexAttrib4s");
+    glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4sv(GLuint index, const GLshort * v) {
+    glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC) glad_gl_on_demand_loader("glVertexAttrib4sv");
+    glad_glVertexAttrib4sv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4ubv(GLuint index, const GLubyte * v) {
+    glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC) glad_gl_on_demand_loader("glVertexAttrib4ubv");
+    glad_glVertexAttrib4ubv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4uiv(GLuint index, const GLuint * v) {
+    glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC) glad_gl_on_demand_loader("glVertexAttrib4uiv");
+    glad_glVertexAttrib4uiv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttrib4usv(GLuint index, const GLushort * v) {
+    glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC) glad_gl_on_demand_loader("glVertexAttrib4usv");
+    glad_glVertexAttrib4usv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC) glad_gl_on_demand_loader("glVertexAttribBinding");
+    glad_glVertexAttribBinding(attribindex, bindingindex);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC) glad_gl_on_demand_loader("glVertexAttribDivisor");
+    glad_glVertexAttribDivisor(index, divisor);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC) glad_gl_on_demand_loader("glVertexAttribFormat");
+    glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1i(GLuint index, GLint x) {
+    glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC) glad_gl_on_demand_loader("glVertexAttribI1i");
+    glad_glVertexAttribI1i(index, x);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1iv(GLuint index, const GLint * v) {
+    glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC) glad_gl_on_demand_loader("glVertexAttribI1iv");
+    glad_glVertexAttribI1iv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1ui(GLuint index, GLuint x) {
+    glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC) glad_gl_on_demand_loader("glVertexAttribI1ui");
+    glad_glVertexAttribI1ui(index, x);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI1uiv(GLuint index, const GLuint * v) {
+    glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC) glad_gl_on_demand_loader("glVertexAttribI1uiv");
+    glad_glVertexAttribI1uiv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC) glad_gl_on_demand_loader("glVertexAttribI2i");
+    glad_glVertexAttribI2i(index, x, y);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2iv(GLuint index, const GLint * v) {
+    glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC) glad_gl_on_demand_loader("glVertexAttribI2iv");
+    glad_glVertexAttribI2iv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC) glad_gl_on_demand_loader("glVertexAttribI2ui");
+    glad_glVertexAttribI2ui(index, x, y);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI2uiv(GLuint index, const GLuint * v) {
+    glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC) glad_gl_on_demand_loader("glVertexAttribI2uiv");
+    glad_glVertexAttribI2uiv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC) glad_gl_on_demand_loader("glVertexAttribI3i");
+    glad_glVertexAttribI3i(index, x, y, z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3iv(GLuint index, const GLint * v) {
+    glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC) glad_gl_on_demand_loader("glVertexAttribI3iv");
+    glad_glVertexAttribI3iv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC) glad_gl_on_demand_loader("glVertexAttribI3ui");
+    glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI3uiv(GLuint index, const GLuint * v) {
+    glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC) glad_gl_on_demand_loader("glVertexAttribI3uiv");
+    glad_glVertexAttribI3uiv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4bv(GLuint index, const GLbyte * v) {
+    glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC) glad_gl_on_demand_loader("glVertexAttribI4bv");
+    glad_glVertexAttribI4bv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC) glad_gl_on_demand_loader("glVertexAttribI4i");
+    glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4iv(GLuint index, const GLint * v) {
+    glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC) glad_gl_on_demand_loader("glVertexAttribI4iv");
+    glad_glVertexAttribI4iv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4sv(GLuint index, const GLshort * v) {
+    glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC) glad_gl_on_demand_loader("glVertexAttribI4sv");
+    glad_glVertexAttribI4sv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4ubv(GLuint index, const GLubyte * v) {
+    glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC) glad_gl_on_demand_loader("glVertexAttribI4ubv");
+    glad_glVertexAttribI4ubv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC) glad_gl_on_demand_loader("glVertexAttribI4ui");
+    glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4uiv(GLuint index, const GLuint * v) {
+    glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC) glad_gl_on_demand_loader("glVertexAttribI4uiv");
+    glad_glVertexAttribI4uiv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribI4usv(GLuint index, const GLushort * v) {
+    glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC) glad_gl_on_demand_loader("glVertexAttribI4usv");
+    glad_glVertexAttribI4usv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC) glad_gl_on_demand_loader("glVertexAttribIFormat");
+    glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC) glad_gl_on_demand_loader("glVertexAttribIPointer");
+    glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL1d(GLuint index, GLdouble x) {
+    glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC) glad_gl_on_demand_loader("glVertexAttribL1d");
+    glad_glVertexAttribL1d(index, x);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL1dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC) glad_gl_on_demand_loader("glVertexAttribL1dv");
+    glad_glVertexAttribL1dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC) glad_gl_on_demand_loader("glVertexAttribL2d");
+    glad_glVertexAttribL2d(index, x, y);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL2dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC) glad_gl_on_demand_loader("glVertexAttribL2dv");
+    glad_glVertexAttribL2dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC) glad_gl_on_demand_loader("glVertexAttribL3d");
+    glad_glVertexAttribL3d(index, x, y, z);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL3dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC) glad_gl_on_demand_loader("glVertexAttribL3dv");
+    glad_glVertexAttribL3dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC) glad_gl_on_demand_loader("glVertexAttribL4d");
+    glad_glVertexAttribL4d(index, x, y, z, w);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribL4dv(GLuint index, const GLdouble * v) {
+    glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC) glad_gl_on_demand_loader("glVertexAttribL4dv");
+    glad_glVertexAttribL4dv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC) glad_gl_on_demand_loader("glVertexAttribLFormat");
+    glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC) glad_gl_on_demand_loader("glVertexAttribLPointer");
+    glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC) glad_gl_on_demand_loader("glVertexAttribP1ui");
+    glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC) glad_gl_on_demand_loader("glVertexAttribP1uiv");
+    glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC) glad_gl_on_demand_loader("glVertexAttribP2ui");
+    glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC) glad_gl_on_demand_loader("glVertexAttribP2uiv");
+    glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC) glad_gl_on_demand_loader("glVertexAttribP3ui");
+    glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC) glad_gl_on_demand_loader("glVertexAttribP3uiv");
+    glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC) glad_gl_on_demand_loader("glVertexAttribP4ui");
+    glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC) glad_gl_on_demand_loader("glVertexAttribP4uiv");
+    glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer) {
+    glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) glad_gl_on_demand_loader("glVertexAttribPointer");
+    glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC) glad_gl_on_demand_loader("glVertexBindingDivisor");
+    glad_glVertexBindingDivisor(bindingindex, divisor);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    glad_glViewport = (PFNGLVIEWPORTPROC) glad_gl_on_demand_loader("glViewport");
+    glad_glViewport(x, y, width, height);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glViewportArrayv(GLuint first, GLsizei count, const GLfloat * v) {
+    glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC) glad_gl_on_demand_loader("glViewportArrayv");
+    glad_glViewportArrayv(first, count, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC) glad_gl_on_demand_loader("glViewportIndexedf");
+    glad_glViewportIndexedf(index, x, y, w, h);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glViewportIndexedfv(GLuint index, const GLfloat * v) {
+    glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC) glad_gl_on_demand_loader("glViewportIndexedfv");
+    glad_glViewportIndexedfv(index, v);
+}
+static void GLAD_API_PTR glad_on_demand_impl_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    glad_glWaitSync = (PFNGLWAITSYNCPROC) glad_gl_on_demand_loader("glWaitSync");
+    glad_glWaitSync(sync, flags, timeout);
+}
+
+static void glad_gl_set_on_demand(int on_demand) {
+    glad_glActiveShaderProgram = on_demand ? glad_on_demand_impl_glActiveShaderProgram : NULL;
+    glad_glActiveTexture = on_demand ? glad_on_demand_impl_glActiveTexture : NULL;
+    glad_glAttachShader = on_demand ? glad_on_demand_impl_glAttachShader : NULL;
+    glad_glBeginConditionalRender = on_demand ? glad_on_demand_impl_glBeginConditionalRender : NULL;
+    glad_glBeginQuery = on_demand ? glad_on_demand_impl_glBeginQuery : NULL;
+    glad_glBeginQueryIndexed = on_demand ? glad_on_demand_impl_glBeginQueryIndexed : NULL;
+    glad_glBeginTransformFeedback = on_demand ? glad_on_demand_impl_glBeginTransformFeedback : NULL;
+    glad_glBindAttribLocation = on_demand ? glad_on_demand_impl_glBindAttribLocation : NULL;
+    glad_glBindBuffer = on_demand ? glad_on_demand_impl_glBindBuffer : NULL;
+    glad_glBindBufferBase = on_demand ? glad_on_demand_impl_glBindBufferBase : NULL;
+    glad_glBindBufferRange = on_demand ? glad_on_demand_impl_glBindBufferRange : NULL;
+    glad_glBindBuffersBase = on_demand ? glad_on_demand_impl_glBindBuffersBase : NULL;
+    glad_glBindBuffersRange = on_demand ? glad_on_demand_impl_glBindBuffersRange : NULL;
+    glad_glBindFragDataLocation = on_demand ? glad_on_demand_impl_glBindFragDataLocation : NULL;
+    glad_glBindFragDataLocationIndexed = on_demand ? glad_on_demand_impl_glBindFragDataLocationIndexed : NULL;
+    glad_glBindFramebuffer = on_demand ? glad_on_demand_impl_glBindFramebuffer : NULL;
+    glad_glBindImageTexture = on_demand ? glad_on_demand_impl_glBindImageTexture : NULL;
+    glad_glBindImageTextures = on_demand ? glad_on_demand_impl_glBindImageTextures : NULL;
+    glad_glBindProgramPipeline = on_demand ? glad_on_demand_impl_glBindProgramPipeline : NULL;
+    glad_glBindRenderbuffer = on_demand ? glad_on_demand_impl_glBindRenderbuffer : NULL;
+    glad_glBindSampler = on_demand ? glad_on_demand_impl_glBindSampler : NULL;
+    glad_glBindSamplers = on_demand ? glad_on_demand_impl_glBindSamplers : NULL;
+    glad_glBindTexture = on_demand ? glad_on_demand_impl_glBindTexture : NULL;
+    glad_glBindTextureUnit = on_demand ? glad_on_demand_impl_glBindTextureUnit : NULL;
+    glad_glBindTextures = on_demand ? glad_on_demand_impl_glBindTextures : NULL;
+    glad_glBindTransformFeedback = on_demand ? glad_on_demand_impl_glBindTransformFeedback : NULL;
+    glad_glBindVertexArray = on_demand ? glad_on_demand_impl_glBindVertexArray : NULL;
+    glad_glBindVertexBuffer = on_demand ? glad_on_demand_impl_glBindVertexBuffer : NULL;
+    glad_glBindVertexBuffers = on_demand ? glad_on_demand_impl_glBindVertexBuffers : NULL;
+    glad_glBlendColor = on_demand ? glad_on_demand_impl_glBlendColor : NULL;
+    glad_glBlendEquation = on_demand ? glad_on_demand_impl_glBlendEquation : NULL;
+    glad_glBlendEquationSeparate = on_demand ? glad_on_demand_impl_glBlendEquationSeparate : NULL;
+    glad_glBlendEquationSeparatei = on_demand ? glad_on_demand_impl_glBlendEquationSeparatei : NULL;
+    glad_glBlendEquationi = on_demand ? glad_on_demand_impl_glBlendEquationi : NULL;
+    glad_glBlendFunc = on_demand ? glad_on_demand_impl_glBlendFunc : NULL;
+    glad_glBlendFuncSeparate = on_demand ? glad_on_demand_impl_glBlendFuncSeparate : NULL;
+    glad_glBlendFuncSeparatei = on_demand ? glad_on_demand_impl_glBlendFuncSeparatei : NULL;
+    glad_glBlendFunci = on_demand ? glad_on_demand_impl_glBlendFunci : NULL;
+    glad_glBlitFramebuffer = on_demand ? glad_on_demand_impl_glBlitFramebuffer : NULL;
+    glad_glBlitNamedFramebuffer = on_demand ? glad_on_demand_impl_glBlitNamedFramebuffer : NULL;
+    glad_glBufferData = on_demand ? glad_on_demand_impl_glBufferData : NULL;
+    glad_glBufferStorage = on_demand ? glad_on_demand_impl_glBufferStorage : NULL;
+    glad_glBufferSubData = on_demand ? glad_on_demand_impl_glBufferSubData : NULL;
+    glad_glCheckFramebufferStatus = on_demand ? glad_on_demand_impl_glCheckFramebufferStatus : NULL;
+    glad_glCheckNamedFramebufferStatus = on_demand ? glad_on_demand_impl_glCheckNamedFramebufferStatus : NULL;
+    glad_glClampColor = on_demand ? glad_on_demand_impl_glClampColor : NULL;
+    glad_glClear = on_demand ? glad_on_demand_impl_glClear : NULL;
+    glad_glClearBufferData = on_demand ? glad_on_demand_impl_glClearBufferData : NULL;
+    glad_glClearBufferSubData = on_demand ? glad_on_demand_impl_glClearBufferSubData : NULL;
+    glad_glClearBufferfi = on_demand ? glad_on_demand_impl_glClearBufferfi : NULL;
+    glad_glClearBufferfv = on_demand ? glad_on_demand_impl_glClearBufferfv : NULL;
+    glad_glClearBufferiv = on_demand ? glad_on_demand_impl_glClearBufferiv : NULL;
+    glad_glClearBufferuiv = on_demand ? glad_on_demand_impl_glClearBufferuiv : NULL;
+    glad_glClearColor = on_demand ? glad_on_demand_impl_glClearColor : NULL;
+    glad_glClearDepth = on_demand ? glad_on_demand_impl_glClearDepth : NULL;
+    glad_glClearDepthf = on_demand ? glad_on_demand_impl_glClearDepthf : NULL;
+    glad_glClearNamedBufferData = on_demand ? glad_on_demand_impl_glClearNamedBufferData : NULL;
+    glad_glClearNamedBufferSubData = on_demand ? glad_on_demand_impl_glClearNamedBufferSubData : NULL;
+    glad_glClearNamedFramebufferfi = on_demand ? glad_on_demand_impl_glClearNamedFramebufferfi : NULL;
+    glad_glClearNamedFramebufferfv = on_demand ? glad_on_demand_impl_glClearNamedFramebufferfv : NULL;
+    glad_glClearNamedFramebufferiv = on_demand ? glad_on_demand_impl_glClearNamedFramebufferiv : NULL;
+    glad_glClearNamedFramebufferuiv = on_demand ? glad_on_demand_impl_glClearNamedFramebufferuiv : NULL;
+    glad_glClearStencil = on_demand ? glad_on_demand_impl_glClearStencil : NULL;
+    glad_glClearTexImage = on_demand ? glad_on_demand_impl_glClearTexImage : NULL;
+    glad_glClearTexSubImage = on_demand ? glad_on_demand_impl_glClearTexSubImage : NULL;
+    glad_glClientWaitSync = on_demand ? glad_on_demand_impl_glClientWaitSync : NULL;
+    glad_glClipControl = on_demand ? glad_on_demand_impl_glClipControl : NULL;
+    glad_glColorMask = on_demand ? glad_on_demand_impl_glColorMask : NULL;
+    glad_glColorMaski = on_demand ? glad_on_demand_impl_glColorMaski : NULL;
+    glad_glCompileShader = on_demand ? glad_on_demand_impl_glCompileShader : NULL;
+    glad_glCompressedTexImage1D = on_demand ? glad_on_demand_impl_glCompressedTexImage1D : NULL;
+    glad_glCompressedTexImage2D = on_demand ? glad_on_demand_impl_glCompressedTexImage2D : NULL;
+    glad_glCompressedTexImage3D = on_demand ? glad_on_demand_impl_glCompressedTexImage3D : NULL;
+    glad_glCompressedTexSubImage1D = on_demand ? glad_on_demand_impl_glCompressedTexSubImage1D : NULL;
+    glad_glCompressedTexSubImage2D = on_demand ? glad_on_demand_impl_glCompressedTexSubImage2D : NULL;
+    glad_glCompressedTexSubImage3D = on_demand ? glad_on_demand_impl_glCompressedTexSubImage3D : NULL;
+    glad_glCompressedTextureSubImage1D = on_demand ? glad_on_demand_impl_glCompressedTextureSubImage1D : NULL;
+    glad_glCompressedTextureSubImage2D = on_demand ? glad_on_demand_impl_glCompressedTextureSubImage2D : NULL;
+    glad_glCompressedTextureSubImage3D = on_demand ? glad_on_demand_impl_glCompressedTextureSubImage3D : NULL;
+    glad_glCopyBufferSubData = on_demand ? glad_on_demand_impl_glCopyBufferSubData : NULL;
+    glad_glCopyImageSubData = on_demand ? glad_on_demand_impl_glCopyImageSubData : NULL;
+    glad_glCopyNamedBufferSubData = on_demand ? glad_on_demand_impl_glCopyNamedBufferSubData : NULL;
+    glad_glCopyTexImage1D = on_demand ? glad_on_demand_impl_glCopyTexImage1D : NULL;
+    glad_glCopyTexImage2D = on_demand ? glad_on_demand_impl_glCopyTexImage2D : NULL;
+    glad_glCopyTexSubImage1D = on_demand ? glad_on_demand_impl_glCopyTexSubImage1D : NULL;
+    glad_glCopyTexSubImage2D = on_demand ? glad_on_demand_impl_glCopyTexSubImage2D : NULL;
+    glad_glCopyTexSubImage3D = on_demand ? glad_on_demand_impl_glCopyTexSubImage3D : NULL;
+    glad_glCopyTextureSubImage1D = on_demand ? glad_on_demand_impl_glCopyTextureSubImage1D : NULL;
+    glad_glCopyTextureSubImage2D = on_demand ? glad_on_demand_impl_glCopyTextureSubImage2D : NULL;
+    glad_glCopyTextureSubImage3D = on_demand ? glad_on_demand_impl_glCopyTextureSubImage3D : NULL;
+    glad_glCreateBuffers = on_demand ? glad_on_demand_impl_glCreateBuffers : NULL;
+    glad_glCreateFramebuffers = on_demand ? glad_on_demand_impl_glCreateFramebuffers : NULL;
+    glad_glCreateProgram = on_demand ? glad_on_demand_impl_glCreateProgram : NULL;
+    glad_glCreateProgramPipelines = on_demand ? glad_on_demand_impl_glCreateProgramPipelines : NULL;
+    glad_glCreateQueries = on_demand ? glad_on_demand_impl_glCreateQueries : NULL;
+    glad_glCreateRenderbuffers = on_demand ? glad_on_demand_impl_glCreateRenderbuffers : NULL;
+    glad_glCreateSamplers = on_demand ? glad_on_demand_impl_glCreateSamplers : NULL;
+    glad_glCreateShader = on_demand ? glad_on_demand_impl_glCreateShader : NULL;
+    glad_glCreateShaderProgramv = on_demand ? glad_on_demand_impl_glCreateShaderProgramv : NULL;
+    glad_glCreateTextures = on_demand ? glad_on_demand_impl_glCreateTextures : NULL;
+    glad_glCreateTransformFeedbacks = on_demand ? glad_on_demand_impl_glCreateTransformFeedbacks : NULL;
+    glad_glCreateVertexArrays = on_demand ? glad_on_demand_impl_glCreateVertexArrays : NULL;
+    glad_glCullFace = on_demand ? glad_on_demand_impl_glCullFace : NULL;
+    glad_glDebugMessageCallback = on_demand ? glad_on_demand_impl_glDebugMessageCallback : NULL;
+    glad_glDebugMessageControl = on_demand ? glad_on_demand_impl_glDebugMessageControl : NULL;
+    glad_glDebugMessageInsert = on_demand ? glad_on_demand_impl_glDebugMessageInsert : NULL;
+    glad_glDeleteBuffers = on_demand ? glad_on_demand_impl_glDeleteBuffers : NULL;
+    glad_glDeleteFramebuffers = on_demand ? glad_on_demand_impl_glDeleteFramebuffers : NULL;
+    glad_glDeleteProgram = on_demand ? glad_on_demand_impl_glDeleteProgram : NULL;
+    glad_glDeleteProgramPipelines = on_demand ? glad_on_demand_impl_glDeleteProgramPipelines : NULL;
+    glad_glDeleteQueries = on_demand ? glad_on_demand_impl_glDeleteQueries : NULL;
+    glad_glDeleteRenderbuffers = on_demand ? glad_on_demand_impl_glDeleteRenderbuffers : NULL;
+    glad_glDeleteSamplers = on_demand ? glad_on_demand_impl_glDeleteSamplers : NULL;
+    glad_glDeleteShader = on_demand ? glad_on_demand_impl_glDeleteShader : NULL;
+    glad_glDeleteSync = on_demand ? glad_on_demand_impl_glDeleteSync : NULL;
+    glad_glDeleteTextures = on_demand ? glad_on_demand_impl_glDeleteTextures : NULL;
+    glad_glDeleteTransformFeedbacks = on_demand ? glad_on_demand_impl_glDeleteTransformFeedbacks : NULL;
+    glad_glDeleteVertexArrays = on_demand ? glad_on_demand_impl_glDeleteVertexArrays : NULL;
+    glad_glDepthFunc = on_demand ? glad_on_demand_impl_glDepthFunc : NULL;
+    glad_glDepthMask = on_demand ? glad_on_demand_impl_glDepthMask : NULL;
+    glad_glDepthRange = on_demand ? glad_on_demand_impl_glDepthRange : NULL;
+    glad_glDepthRangeArrayv = on_demand ? glad_on_demand_impl_glDepthRangeArrayv : NULL;
+    glad_glDepthRangeIndexed = on_demand ? glad_on_demand_impl_glDepthRangeIndexed : NULL;
+    glad_glDepthRangef = on_demand ? glad_on_demand_impl_glDepthRangef : NULL;
+    glad_glDetachShader = on_demand ? glad_on_demand_impl_glDetachShader : NULL;
+    glad_glDisable = on_demand ? glad_on_demand_impl_glDisable : NULL;
+    glad_glDisableVertexArrayAttrib = on_demand ? glad_on_demand_impl_glDisableVertexArrayAttrib : NULL;
+    glad_glDisableVertexAttribArray = on_demand ? glad_on_demand_impl_glDisableVertexAttribArray : NULL;
+    glad_glDisablei = on_demand ? glad_on_demand_impl_glDisablei : NULL;
+    glad_glDispatchCompute = on_demand ? glad_on_demand_impl_glDispatchCompute : NULL;
+    glad_glDispatchComputeIndirect = on_demand ? glad_on_demand_impl_glDispatchComputeIndirect : NULL;
+    glad_glDrawArrays = on_demand ? glad_on_demand_impl_glDrawArrays : NULL;
+    glad_glDrawArraysIndirect = on_demand ? glad_on_demand_impl_glDrawArraysIndirect : NULL;
+    glad_glDrawArraysInstanced = on_demand ? glad_on_demand_impl_glDrawArraysInstanced : NULL;
+    glad_glDrawArraysInstancedBaseInstance = on_demand ? glad_on_demand_impl_glDrawArraysInstancedBaseInstance : NULL;
+    glad_glDrawBuffer = on_demand ? glad_on_demand_impl_glDrawBuffer : NULL;
+    glad_glDrawBuffers = on_demand ? glad_on_demand_impl_glDrawBuffers : NULL;
+    glad_glDrawElements = on_demand ? glad_on_demand_impl_glDrawElements : NULL;
+    glad_glDrawElementsBaseVertex = on_demand ? glad_on_demand_impl_glDrawElementsBaseVertex : NULL;
+    glad_glDrawElementsIndirect = on_demand ? glad_on_demand_impl_glDrawElementsIndirect : NULL;
+    glad_glDrawElementsInstanced = on_demand ? glad_on_demand_impl_glDrawElementsInstanced : NULL;
+    glad_glDrawElementsInstancedBaseInstance = on_demand ? glad_on_demand_impl_glDrawElementsInstancedBaseInstance : NULL;
+    glad_glDrawElementsInstancedBaseVertex = on_demand ? glad_on_demand_impl_glDrawElementsInstancedBaseVertex : NULL;
+    glad_glDrawElementsInstancedBaseVertexBaseInstance = on_demand ? glad_on_demand_impl_glDrawElementsInstancedBaseVertexBaseInstance : NULL;
+    glad_glDrawRangeElements = on_demand ? glad_on_demand_impl_glDrawRangeElements : NULL;
+    glad_glDrawRangeElementsBaseVertex = on_demand ? glad_on_demand_impl_glDrawRangeElementsBaseVertex : NULL;
+    glad_glDrawTransformFeedback = on_demand ? glad_on_demand_impl_glDrawTransformFeedback : NULL;
+    glad_glDrawTransformFeedbackInstanced = on_demand ? glad_on_demand_impl_glDrawTransformFeedbackInstanced : NULL;
+    glad_glDrawTransformFeedbackStream = on_demand ? glad_on_demand_impl_glDrawTransformFeedbackStream : NULL;
+    glad_glDrawTransformFeedbackStreamInstanced = on_demand ? glad_on_demand_impl_glDrawTransformFeedbackStreamInstanced : NULL;
+    glad_glEnable = on_demand ? glad_on_demand_impl_glEnable : NULL;
+    glad_glEnableVertexArrayAttrib = on_demand ? glad_on_demand_impl_glEnableVertexArrayAttrib : NULL;
+    glad_glEnableVertexAttribArray = on_demand ? glad_on_demand_impl_glEnableVertexAttribArray : NULL;
+    glad_glEnablei = on_demand ? glad_on_demand_impl_glEnablei : NULL;
+    glad_glEndConditionalRender = on_demand ? glad_on_demand_impl_glEndConditionalRender : NULL;
+    glad_glEndQuery = on_demand ? glad_on_demand_impl_glEndQuery : NULL;
+    glad_glEndQueryIndexed = on_demand ? glad_on_demand_impl_glEndQueryIndexed : NULL;
+    glad_glEndTransformFeedback = on_demand ? glad_on_demand_impl_glEndTransformFeedback : NULL;
+    glad_glFenceSync = on_demand ? glad_on_demand_impl_glFenceSync : NULL;
+    glad_glFinish = on_demand ? glad_on_demand_impl_glFinish : NULL;
+    glad_glFlush = on_demand ? glad_on_demand_impl_glFlush : NULL;
+    glad_glFlushMappedBufferRange = on_demand ? glad_on_demand_impl_glFlushMappedBufferRange : NULL;
+    glad_glFlushMappedNamedBufferRange = on_demand ? glad_on_demand_impl_glFlushMappedNamedBufferRange : NULL;
+    glad_glFramebufferParameteri = on_demand ? glad_on_demand_impl_glFramebufferParameteri : NULL;
+    glad_glFramebufferRenderbuffer = on_demand ? glad_on_demand_impl_glFramebufferRenderbuffer : NULL;
+    glad_glFramebufferTexture = on_demand ? glad_on_demand_impl_glFramebufferTexture : NULL;
+    glad_glFramebufferTexture1D = on_demand ? glad_on_demand_impl_glFramebufferTexture1D : NULL;
+    glad_glFramebufferTexture2D = on_demand ? glad_on_demand_impl_glFramebufferTexture2D : NULL;
+    glad_glFramebufferTexture3D = on_demand ? glad_on_demand_impl_glFramebufferTexture3D : NULL;
+    glad_glFramebufferTextureLayer = on_demand ? glad_on_demand_impl_glFramebufferTextureLayer : NULL;
+    glad_glFrontFace = on_demand ? glad_on_demand_impl_glFrontFace : NULL;
+    glad_glGenBuffers = on_demand ? glad_on_demand_impl_glGenBuffers : NULL;
+    glad_glGenFramebuffers = on_demand ? glad_on_demand_impl_glGenFramebuffers : NULL;
+    glad_glGenProgramPipelines = on_demand ? glad_on_demand_impl_glGenProgramPipelines : NULL;
+    glad_glGenQueries = on_demand ? glad_on_demand_impl_glGenQueries : NULL;
+    glad_glGenRenderbuffers = on_demand ? glad_on_demand_impl_glGenRenderbuffers : NULL;
+    glad_glGenSamplers = on_demand ? glad_on_demand_impl_glGenSamplers : NULL;
+    glad_glGenTextures = on_demand ? glad_on_demand_impl_glGenTextures : NULL;
+    glad_glGenTransformFeedbacks = on_demand ? glad_on_demand_impl_glGenTransformFeedbacks : NULL;
+    glad_glGenVertexArrays = on_demand ? glad_on_demand_impl_glGenVertexArrays : NULL;
+    glad_glGenerateMipmap = on_demand ? glad_on_demand_impl_glGenerateMipmap : NULL;
+    glad_glGenerateTextureMipmap = on_demand ? glad_on_demand_impl_glGenerateTextureMipmap : NULL;
+    glad_glGetActiveAtomicCounterBufferiv = on_demand ? glad_on_demand_impl_glGetActiveAtomicCounterBufferiv : NULL;
+    glad_glGetActiveAttrib = on_demand ? glad_on_demand_impl_glGetActiveAttrib : NULL;
+    glad_glGetActiveSubroutineName = on_demand ? glad_on_demand_impl_glGetActiveSubroutineName : NULL;
+    glad_glGetActiveSubroutineUniformName = on_demand ? glad_on_demand_impl_glGetActiveSubroutineUniformName : NULL;
+    glad_glGetActiveSubroutineUniformiv = on_demand ? glad_on_demand_impl_glGetActiveSubroutineUniformiv : NULL;
+    glad_glGetActiveUniform = on_demand ? glad_on_demand_impl_glGetActiveUniform : NULL;
+    glad_glGetActiveUniformBlockName = on_demand ? glad_on_demand_impl_glGetActiveUniformBlockName : NULL;
+    glad_glGetActiveUniformBlockiv = on_demand ? glad_on_demand_impl_glGetActiveUniformBlockiv : NULL;
+    glad_glGetActiveUniformName = on_demand ? glad_on_demand_impl_glGetActiveUniformName : NULL;
+    glad_glGetActiveUniformsiv = on_demand ? glad_on_demand_impl_glGetActiveUniformsiv : NULL;
+    glad_glGetAttachedShaders = on_demand ? glad_on_demand_impl_glGetAttachedShaders : NULL;
+    glad_glGetAttribLocation = on_demand ? glad_on_demand_impl_glGetAttribLocation : NULL;
+    glad_glGetBooleani_v = on_demand ? glad_on_demand_impl_glGetBooleani_v : NULL;
+    glad_glGetBooleanv = on_demand ? glad_on_demand_impl_glGetBooleanv : NULL;
+    glad_glGetBufferParameteri64v = on_demand ? glad_on_demand_impl_glGetBufferParameteri64v : NULL;
+    glad_glGetBufferParameteriv = on_demand ? glad_on_demand_impl_glGetBufferParameteriv : NULL;
+    glad_glGetBufferPointerv = on_demand ? glad_on_demand_impl_glGetBufferPointerv : NULL;
+    glad_glGetBufferSubData = on_demand ? glad_on_demand_impl_glGetBufferSubData : NULL;
+    glad_glGetCompressedTexImage = on_demand ? glad_on_demand_impl_glGetCompressedTexImage : NULL;
+    glad_glGetCompressedTextureImage = on_demand ? glad_on_demand_impl_glGetCompressedTextureImage : NULL;
+    glad_glGetCompressedTextureSubImage = on_demand ? glad_on_demand_impl_glGetCompressedTextureSubImage : NULL;
+    glad_glGetDebugMessageLog = on_demand ? glad_on_demand_impl_glGetDebugMessageLog : NULL;
+    glad_glGetDoublei_v = on_demand ? glad_on_demand_impl_glGetDoublei_v : NULL;
+    glad_glGetDoublev = on_demand ? glad_on_demand_impl_glGetDoublev : NULL;
+    glad_glGetError = on_demand ? glad_on_demand_impl_glGetError : NULL;
+    glad_glGetFloati_v = on_demand ? glad_on_demand_impl_glGetFloati_v : NULL;
+    glad_glGetFloatv = on_demand ? glad_on_demand_impl_glGetFloatv : NULL;
+    glad_glGetFragDataIndex = on_demand ? glad_on_demand_impl_glGetFragDataIndex : NULL;
+    glad_glGetFragDataLocation = on_demand ? glad_on_demand_impl_glGetFragDataLocation : NULL;
+    glad_glGetFramebufferAttachmentParameteriv = on_demand ? glad_on_demand_impl_glGetFramebufferAttachmentParameteriv : NULL;
+    glad_glGetFramebufferParameteriv = on_demand ? glad_on_demand_impl_glGetFramebufferParameteriv : NULL;
+    glad_glGetGraphicsResetStatus = on_demand ? glad_on_demand_impl_glGetGraphicsResetStatus : NULL;
+    glad_glGetInteger64i_v = on_demand ? glad_on_demand_impl_glGetInteger64i_v : NULL;
+    glad_glGetInteger64v = on_demand ? glad_on_demand_impl_glGetInteger64v : NULL;
+    glad_glGetIntegeri_v = on_demand ? glad_on_demand_impl_glGetIntegeri_v : NULL;
+    glad_glGetIntegerv = on_demand ? glad_on_demand_impl_glGetIntegerv : NULL;
+    glad_glGetInternalformati64v = on_demand ? glad_on_demand_impl_glGetInternalformati64v : NULL;
+    glad_glGetInternalformativ = on_demand ? glad_on_demand_impl_glGetInternalformativ : NULL;
+    glad_glGetMultisamplefv = on_demand ? glad_on_demand_impl_glGetMultisamplefv : NULL;
+    glad_glGetNamedBufferParameteri64v = on_demand ? glad_on_demand_impl_glGetNamedBufferParameteri64v : NULL;
+    glad_glGetNamedBufferParameteriv = on_demand ? glad_on_demand_impl_glGetNamedBufferParameteriv : NULL;
+    glad_glGetNamedBufferPointerv = on_demand ? glad_on_demand_impl_glGetNamedBufferPointerv : NULL;
+    glad_glGetNamedBufferSubData = on_demand ? glad_on_demand_impl_glGetNamedBufferSubData : NULL;
+    glad_glGetNamedFramebufferAttachmentParameteriv = on_demand ? glad_on_demand_impl_glGetNamedFramebufferAttachmentParameteriv : NULL;
+    glad_glGetNamedFramebufferParameteriv = on_demand ? glad_on_demand_impl_glGetNamedFramebufferParameteriv : NULL;
+    glad_glGetNamedRenderbufferParameteriv = on_demand ? glad_on_demand_impl_glGetNamedRenderbufferParameteriv : NULL;
+    glad_glGetObjectLabel = on_demand ? glad_on_demand_impl_glGetObjectLabel : NULL;
+    glad_glGetObjectPtrLabel = on_demand ? glad_on_demand_impl_glGetObjectPtrLabel : NULL;
+    glad_glGetPointerv = on_demand ? glad_on_demand_impl_glGetPointerv : NULL;
+    glad_glGetProgramBinary = on_demand ? glad_on_demand_impl_glGetProgramBinary : NULL;
+    glad_glGetProgramInfoLog = on_demand ? glad_on_demand_impl_glGetProgramInfoLog : NULL;
+    glad_glGetProgramInterfaceiv = on_demand ? glad_on_demand_impl_glGetProgramInterfaceiv : NULL;
+    glad_glGetProgramPipelineInfoLog = on_demand ? glad_on_demand_impl_glGetProgramPipelineInfoLog : NULL;
+    glad_glGetProgramPipelineiv = on_demand ? glad_on_demand_impl_glGetProgramPipelineiv : NULL;
+    glad_glGetProgramResourceIndex = on_demand ? glad_on_demand_impl_glGetProgramResourceIndex : NULL;
+    glad_glGetProgramResourceLocation = on_demand ? glad_on_demand_impl_glGetProgramResourceLocation : NULL;
+    glad_glGetProgramResourceLocationIndex = on_demand ? glad_on_demand_impl_glGetProgramResourceLocationIndex : NULL;
+    glad_glGetProgramResourceName = on_demand ? glad_on_demand_impl_glGetProgramResourceName : NULL;
+    glad_glGetProgramResourceiv = on_demand ? glad_on_demand_impl_glGetProgramResourceiv : NULL;
+    glad_glGetProgramStageiv = on_demand ? glad_on_demand_impl_glGetProgramStageiv : NULL;
+    glad_glGetProgramiv = on_demand ? glad_on_demand_impl_glGetProgramiv : NULL;
+    glad_glGetQueryBufferObjecti64v = on_demand ? glad_on_demand_impl_glGetQueryBufferObjecti64v : NULL;
+    glad_glGetQueryBufferObjectiv = on_demand ? glad_on_demand_impl_glGetQueryBufferObjectiv : NULL;
+    glad_glGetQueryBufferObjectui64v = on_demand ? glad_on_demand_impl_glGetQueryBufferObjectui64v : NULL;
+    glad_glGetQueryBufferObjectuiv = on_demand ? glad_on_demand_impl_glGetQueryBufferObjectuiv : NULL;
+    glad_glGetQueryIndexediv = on_demand ? glad_on_demand_impl_glGetQueryIndexediv : NULL;
+    glad_glGetQueryObjecti64v = on_demand ? glad_on_demand_impl_glGetQueryObjecti64v : NULL;
+    glad_glGetQueryObjectiv = on_demand ? glad_on_demand_impl_glGetQueryObjectiv : NULL;
+    glad_glGetQueryObjectui64v = on_demand ? glad_on_demand_impl_glGetQueryObjectui64v : NULL;
+    glad_glGetQueryObjectuiv = on_demand ? glad_on_demand_impl_glGetQueryObjectuiv : NULL;
+    glad_glGetQueryiv = on_demand ? glad_on_demand_impl_glGetQueryiv : NULL;
+    glad_glGetRenderbufferParameteriv = on_demand ? glad_on_demand_impl_glGetRenderbufferParameteriv : NULL;
+    glad_glGetSamplerParameterIiv = on_demand ? glad_on_demand_impl_glGetSamplerParameterIiv : NULL;
+    glad_glGetSamplerParameterIuiv = on_demand ? glad_on_demand_impl_glGetSamplerParameterIuiv : NULL;
+    glad_glGetSamplerParameterfv = on_demand ? glad_on_demand_impl_glGetSamplerParameterfv : NULL;
+    glad_glGetSamplerParameteriv = on_demand ? glad_on_demand_impl_glGetSamplerParameteriv : NULL;
+    glad_glGetShaderInfoLog = on_demand ? glad_on_demand_impl_glGetShaderInfoLog : NULL;
+    glad_glGetShaderPrecisionFormat = on_demand ? glad_on_demand_impl_glGetShaderPrecisionFormat : NULL;
+    glad_glGetShaderSource = on_demand ? glad_on_demand_impl_glGetShaderSource : NULL;
+    glad_glGetShaderiv = on_demand ? glad_on_demand_impl_glGetShaderiv : NULL;
+    glad_glGetString = on_demand ? glad_on_demand_impl_glGetString : NULL;
+    glad_glGetStringi = on_demand ? glad_on_demand_impl_glGetStringi : NULL;
+    glad_glGetSubroutineIndex = on_demand ? glad_on_demand_impl_glGetSubroutineIndex : NULL;
+    glad_glGetSubroutineUniformLocation = on_demand ? glad_on_demand_impl_glGetSubroutineUniformLocation : NULL;
+    glad_glGetSynciv = on_demand ? glad_on_demand_impl_glGetSynciv : NULL;
+    glad_glGetTexImage = on_demand ? glad_on_demand_impl_glGetTexImage : NULL;
+    glad_glGetTexLevelParameterfv = on_demand ? glad_on_demand_impl_glGetTexLevelParameterfv : NULL;
+    glad_glGetTexLevelParameteriv = on_demand ? glad_on_demand_impl_glGetTexLevelParameteriv : NULL;
+    glad_glGetTexParameterIiv = on_demand ? glad_on_demand_impl_glGetTexParameterIiv : NULL;
+    glad_glGetTexParameterIuiv = on_demand ? glad_on_demand_impl_glGetTexParameterIuiv : NULL;
+    glad_glGetTexParameterfv = on_demand ? glad_on_demand_impl_glGetTexParameterfv : NULL;
+    glad_glGetTexParameteriv = on_demand ? glad_on_demand_impl_glGetTexParameteriv : NULL;
+    glad_glGetTextureImage = on_demand ? glad_on_demand_impl_glGetTextureImage : NULL;
+    glad_glGetTextureLevelParameterfv = on_demand ? glad_on_demand_impl_glGetTextureLevelParameterfv : NULL;
+    glad_glGetTextureLevelParameteriv = on_demand ? glad_on_demand_impl_glGetTextureLevelParameteriv : NULL;
+    glad_glGetTextureParameterIiv = on_demand ? glad_on_demand_impl_glGetTextureParameterIiv : NULL;
+    glad_glGetTextureParameterIuiv = on_demand ? glad_on_demand_impl_glGetTextureParameterIuiv : NULL;
+    glad_glGetTextureParameterfv = on_demand ? glad_on_demand_impl_glGetTextureParameterfv : NULL;
+    glad_glGetTextureParameteriv = on_demand ? glad_on_demand_impl_glGetTextureParameteriv : NULL;
+    glad_glGetTextureSubImage = on_demand ? glad_on_demand_impl_glGetTextureSubImage : NULL;
+    glad_glGetTransformFeedbackVarying = on_demand ? glad_on_demand_impl_glGetTransformFeedbackVarying : NULL;
+    glad_glGetTransformFeedbacki64_v = on_demand ? glad_on_demand_impl_glGetTransformFeedbacki64_v : NULL;
+    glad_glGetTransformFeedbacki_v = on_demand ? glad_on_demand_impl_glGetTransformFeedbacki_v : NULL;
+    glad_glGetTransformFeedbackiv = on_demand ? glad_on_demand_impl_glGetTransformFeedbackiv : NULL;
+    glad_glGetUniformBlockIndex = on_demand ? glad_on_demand_impl_glGetUniformBlockIndex : NULL;
+    glad_glGetUniformIndices = on_demand ? glad_on_demand_impl_glGetUniformIndices : NULL;
+    glad_glGetUniformLocation = on_demand ? glad_on_demand_impl_glGetUniformLocation : NULL;
+    glad_glGetUniformSubroutineuiv = on_demand ? glad_on_demand_impl_glGetUniformSubroutineuiv : NULL;
+    glad_glGetUniformdv = on_demand ? glad_on_demand_impl_glGetUniformdv : NULL;
+    glad_glGetUniformfv = on_demand ? glad_on_demand_impl_glGetUniformfv : NULL;
+    glad_glGetUniformiv = on_demand ? glad_on_demand_impl_glGetUniformiv : NULL;
+    glad_glGetUniformuiv = on_demand ? glad_on_demand_impl_glGetUniformuiv : NULL;
+    glad_glGetVertexArrayIndexed64iv = on_demand ? glad_on_demand_impl_glGetVertexArrayIndexed64iv : NULL;
+    glad_glGetVertexArrayIndexediv = on_demand ? glad_on_demand_impl_glGetVertexArrayIndexediv : NULL;
+    glad_glGetVertexArrayiv = on_demand ? glad_on_demand_impl_glGetVertexArrayiv : NULL;
+    glad_glGetVertexAttribIiv = on_demand ? glad_on_demand_impl_glGetVertexAttribIiv : NULL;
+    glad_glGetVertexAttribIuiv = on_demand ? glad_on_demand_impl_glGetVertexAttribIuiv : NULL;
+    glad_glGetVertexAttribLdv = on_demand ? glad_on_demand_impl_glGetVertexAttribLdv : NULL;
+    glad_glGetVertexAttribPointerv = on_demand ? glad_on_demand_impl_glGetVertexAttribPointerv : NULL;
+    glad_glGetVertexAttribdv = on_demand ? glad_on_demand_impl_glGetVertexAttribdv : NULL;
+    glad_glGetVertexAttribfv = on_demand ? glad_on_demand_impl_glGetVertexAttribfv : NULL;
+    glad_glGetVertexAttribiv = on_demand ? glad_on_demand_impl_glGetVertexAttribiv : NULL;
+    glad_glGetnCompressedTexImage = on_demand ? glad_on_demand_impl_glGetnCompressedTexImage : NULL;
+    glad_glGetnTexImage = on_demand ? glad_on_demand_impl_glGetnTexImage : NULL;
+    glad_glGetnUniformdv = on_demand ? glad_on_demand_impl_glGetnUniformdv : NULL;
+    glad_glGetnUniformfv = on_demand ? glad_on_demand_impl_glGetnUniformfv : NULL;
+    glad_glGetnUniformiv = on_demand ? glad_on_demand_impl_glGetnUniformiv : NULL;
+    glad_glGetnUniformuiv = on_demand ? glad_on_demand_impl_glGetnUniformuiv : NULL;
+    glad_glHint = on_demand ? glad_on_demand_impl_glHint : NULL;
+    glad_glInvalidateBufferData = on_demand ? glad_on_demand_impl_glInvalidateBufferData : NULL;
+    glad_glInvalidateBufferSubData = on_demand ? glad_on_demand_impl_glInvalidateBufferSubData : NULL;
+    glad_glInvalidateFramebuffer = on_demand ? glad_on_demand_impl_glInvalidateFramebuffer : NULL;
+    glad_glInvalidateNamedFramebufferData = on_demand ? glad_on_demand_impl_glInvalidateNamedFramebufferData : NULL;
+    glad_glInvalidateNamedFramebufferSubData = on_demand ? glad_on_demand_impl_glInvalidateNamedFramebufferSubData : NULL;
+    glad_glInvalidateSubFramebuffer = on_demand ? glad_on_demand_impl_glInvalidateSubFramebuffer : NULL;
+    glad_glInvalidateTexImage = on_demand ? glad_on_demand_impl_glInvalidateTexImage : NULL;
+    glad_glInvalidateTexSubImage = on_demand ? glad_on_demand_impl_glInvalidateTexSubImage : NULL;
+    glad_glIsBuffer = on_demand ? glad_on_demand_impl_glIsBuffer : NULL;
+    glad_glIsEnabled = on_demand ? glad_on_demand_impl_glIsEnabled : NULL;
+    glad_glIsEnabledi = on_demand ? glad_on_demand_impl_glIsEnabledi : NULL;
+    glad_glIsFramebuffer = on_demand ? glad_on_demand_impl_glIsFramebuffer : NULL;
+    glad_glIsProgram = on_demand ? glad_on_demand_impl_glIsProgram : NULL;
+    glad_glIsProgramPipeline = on_demand ? glad_on_demand_impl_glIsProgramPipeline : NULL;
+    glad_glIsQuery = on_demand ? glad_on_demand_impl_glIsQuery : NULL;
+    glad_glIsRenderbuffer = on_demand ? glad_on_demand_impl_glIsRenderbuffer : NULL;
+    glad_glIsSampler = on_demand ? glad_on_demand_impl_glIsSampler : NULL;
+    glad_glIsShader = on_demand ? glad_on_demand_impl_glIsShader : NULL;
+    glad_glIsSync = on_demand ? glad_on_demand_impl_glIsSync : NULL;
+    glad_glIsTexture = on_demand ? glad_on_demand_impl_glIsTexture : NULL;
+    glad_glIsTransformFeedback = on_demand ? glad_on_demand_impl_glIsTransformFeedback : NULL;
+    glad_glIsVertexArray = on_demand ? glad_on_demand_impl_glIsVertexArray : NULL;
+    glad_glLineWidth = on_demand ? glad_on_demand_impl_glLineWidth : NULL;
+    glad_glLinkProgram = on_demand ? glad_on_demand_impl_glLinkProgram : NULL;
+    glad_glLogicOp = on_demand ? glad_on_demand_impl_glLogicOp : NULL;
+    glad_glMapBuffer = on_demand ? glad_on_demand_impl_glMapBuffer : NULL;
+    glad_glMapBufferRange = on_demand ? glad_on_demand_impl_glMapBufferRange : NULL;
+    glad_glMapNamedBuffer = on_demand ? glad_on_demand_impl_glMapNamedBuffer : NULL;
+    glad_glMapNamedBufferRange = on_demand ? glad_on_demand_impl_glMapNamedBufferRange : NULL;
+    glad_glMemoryBarrier = on_demand ? glad_on_demand_impl_glMemoryBarrier : NULL;
+    glad_glMemoryBarrierByRegion = on_demand ? glad_on_demand_impl_glMemoryBarrierByRegion : NULL;
+    glad_glMinSampleShading = on_demand ? glad_on_demand_impl_glMinSampleShading : NULL;
+    glad_glMultiDrawArrays = on_demand ? glad_on_demand_impl_glMultiDrawArrays : NULL;
+    glad_glMultiDrawArraysIndirect = on_demand ? glad_on_demand_impl_glMultiDrawArraysIndirect : NULL;
+    glad_glMultiDrawArraysIndirectCount = on_demand ? glad_on_demand_impl_glMultiDrawArraysIndirectCount : NULL;
+    glad_glMultiDrawElements = on_demand ? glad_on_demand_impl_glMultiDrawElements : NULL;
+    glad_glMultiDrawElementsBaseVertex = on_demand ? glad_on_demand_impl_glMultiDrawElementsBaseVertex : NULL;
+    glad_glMultiDrawElementsIndirect = on_demand ? glad_on_demand_impl_glMultiDrawElementsIndirect : NULL;
+    glad_glMultiDrawElementsIndirectCount = on_demand ? glad_on_demand_impl_glMultiDrawElementsIndirectCount : NULL;
+    glad_glNamedBufferData = on_demand ? glad_on_demand_impl_glNamedBufferData : NULL;
+    glad_glNamedBufferStorage = on_demand ? glad_on_demand_impl_glNamedBufferStorage : NULL;
+    glad_glNamedBufferSubData = on_demand ? glad_on_demand_impl_glNamedBufferSubData : NULL;
+    glad_glNamedFramebufferDrawBuffer = on_demand ? glad_on_demand_impl_glNamedFramebufferDrawBuffer : NULL;
+    glad_glNamedFramebufferDrawBuffers = on_demand ? glad_on_demand_impl_glNamedFramebufferDrawBuffers : NULL;
+    glad_glNamedFramebufferParameteri = on_demand ? glad_on_demand_impl_glNamedFramebufferParameteri : NULL;
+    glad_glNamedFramebufferReadBuffer = on_demand ? glad_on_demand_impl_glNamedFramebufferReadBuffer : NULL;
+    glad_glNamedFramebufferRenderbuffer = on_demand ? glad_on_demand_impl_glNamedFramebufferRenderbuffer : NULL;
+    glad_glNamedFramebufferTexture = on_demand ? glad_on_demand_impl_glNamedFramebufferTexture : NULL;
+    glad_glNamedFramebufferTextureLayer = on_demand ? glad_on_demand_impl_glNamedFramebufferTextureLayer : NULL;
+    glad_glNamedRenderbufferStorage = on_demand ? glad_on_demand_impl_glNamedRenderbufferStorage : NULL;
+    glad_glNamedRenderbufferStorageMultisample = on_demand ? glad_on_demand_impl_glNamedRenderbufferStorageMultisample : NULL;
+    glad_glObjectLabel = on_demand ? glad_on_demand_impl_glObjectLabel : NULL;
+    glad_glObjectPtrLabel = on_demand ? glad_on_demand_impl_glObjectPtrLabel : NULL;
+    glad_glPatchParameterfv = on_demand ? glad_on_demand_impl_glPatchParameterfv : NULL;
+    glad_glPatchParameteri = on_demand ? glad_on_demand_impl_glPatchParameteri : NULL;
+    glad_glPauseTransformFeedback = on_demand ? glad_on_demand_impl_glPauseTransformFeedback : NULL;
+    glad_glPixelStoref = on_demand ? glad_on_demand_impl_glPixelStoref : NULL;
+    glad_glPixelStorei = on_demand ? glad_on_demand_impl_glPixelStorei : NULL;
+    glad_glPointParameterf = on_demand ? glad_on_demand_impl_glPointParameterf : NULL;
+    glad_glPointParameterfv = on_demand ? glad_on_demand_impl_glPointParameterfv : NULL;
+    glad_glPointParameteri = on_demand ? glad_on_demand_impl_glPointParameteri : NULL;
+    glad_glPointParameteriv = on_demand ? glad_on_demand_impl_glPointParameteriv : NULL;
+    glad_glPointSize = on_demand ? glad_on_demand_impl_glPointSize : NULL;
+    glad_glPolygonMode = on_demand ? glad_on_demand_impl_glPolygonMode : NULL;
+    glad_glPolygonOffset = on_demand ? glad_on_demand_impl_glPolygonOffset : NULL;
+    glad_glPolygonOffsetClamp = on_demand ? glad_on_demand_impl_glPolygonOffsetClamp : NULL;
+    glad_glPopDebugGroup = on_demand ? glad_on_demand_impl_glPopDebugGroup : NULL;
+    glad_glPrimitiveRestartIndex = on_demand ? glad_on_demand_impl_glPrimitiveRestartIndex : NULL;
+    glad_glProgramBinary = on_demand ? glad_on_demand_impl_glProgramBinary : NULL;
+    glad_glProgramParameteri = on_demand ? glad_on_demand_impl_glProgramParameteri : NULL;
+    glad_glProgramUniform1d = on_demand ? glad_on_demand_impl_glProgramUniform1d : NULL;
+    glad_glProgramUniform1dv = on_demand ? glad_on_demand_impl_glProgramUniform1dv : NULL;
+    glad_glProgramUniform1f = on_demand ? glad_on_demand_impl_glProgramUniform1f : NULL;
+    glad_glProgramUniform1fv = on_demand ? glad_on_demand_impl_glProgramUniform1fv : NULL;
+    glad_glProgramUniform1i = on_demand ? glad_on_demand_impl_glProgramUniform1i : NULL;
+    glad_glProgramUniform1iv = on_demand ? glad_on_demand_impl_glProgramUniform1iv : NULL;
+    glad_glProgramUniform1ui = on_demand ? glad_on_demand_impl_glProgramUniform1ui : NULL;
+    glad_glProgramUniform1uiv = on_demand ? glad_on_demand_impl_glProgramUniform1uiv : NULL;
+    glad_glProgramUniform2d = on_demand ? glad_on_demand_impl_glProgramUniform2d : NULL;
+    glad_glProgramUniform2dv = on_demand ? glad_on_demand_impl_glProgramUniform2dv : NULL;
+    glad_glProgramUniform2f = on_demand ? glad_on_demand_impl_glProgramUniform2f : NULL;
+    glad_glProgramUniform2fv = on_demand ? glad_on_demand_impl_glProgramUniform2fv : NULL;
+    glad_glProgramUniform2i = on_demand ? glad_on_demand_impl_glProgramUniform2i : NULL;
+    glad_glProgramUniform2iv = on_demand ? glad_on_demand_impl_glProgramUniform2iv : NULL;
+    glad_glProgramUniform2ui = on_demand ? glad_on_demand_impl_glProgramUniform2ui : NULL;
+    glad_glProgramUniform2uiv = on_demand ? glad_on_demand_impl_glProgramUniform2uiv : NULL;
+    glad_glProgramUniform3d = on_demand ? glad_on_demand_impl_glProgramUniform3d : NULL;
+    glad_glProgramUniform3dv = on_demand ? glad_on_demand_impl_glProgramUniform3dv : NULL;
+    glad_glProgramUniform3f = on_demand ? glad_on_demand_impl_glProgramUniform3f : NULL;
+    glad_glProgramUniform3fv = on_demand ? glad_on_demand_impl_glProgramUniform3fv : NULL;
+    glad_glProgramUniform3i = on_demand ? glad_on_demand_impl_glProgramUniform3i : NULL;
+    glad_glProgramUniform3iv = on_demand ? glad_on_demand_impl_glProgramUniform3iv : NULL;
+    glad_glProgramUniform3ui = on_demand ? glad_on_demand_impl_glProgramUniform3ui : NULL;
+    glad_glProgramUniform3uiv = on_demand ? glad_on_demand_impl_glProgramUniform3uiv : NULL;
+    glad_glProgramUniform4d = on_demand ? glad_on_demand_impl_glProgramUniform4d : NULL;
+    glad_glProgramUniform4dv = on_demand ? glad_on_demand_impl_glProgramUniform4dv : NULL;
+    glad_glProgramUniform4f = on_demand ? glad_on_demand_impl_glProgramUniform4f : NULL;
+    glad_glProgramUniform4fv = on_demand ? glad_on_demand_impl_glProgramUniform4fv : NULL;
+    glad_glProgramUniform4i = on_demand ? glad_on_demand_impl_glProgramUniform4i : NULL;
+    glad_glProgramUniform4iv = on_demand ? glad_on_demand_impl_glProgramUniform4iv : NULL;
+    glad_glProgramUniform4ui = on_demand ? glad_on_demand_impl_glProgramUniform4ui : NULL;
+    glad_glProgramUniform4uiv = on_demand ? glad_on_demand_impl_glProgramUniform4uiv : NULL;
+    glad_glProgramUniformMatrix2dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix2dv : NULL;
+    glad_glProgramUniformMatrix2fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix2fv : NULL;
+    glad_glProgramUniformMatrix2x3dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix2x3dv : NULL;
+    glad_glProgramUniformMatrix2x3fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix2x3fv : NULL;
+    glad_glProgramUniformMatrix2x4dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix2x4dv : NULL;
+    glad_glProgramUniformMatrix2x4fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix2x4fv : NULL;
+    glad_glProgramUniformMatrix3dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix3dv : NULL;
+    glad_glProgramUniformMatrix3fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix3fv : NULL;
+    glad_glProgramUniformMatrix3x2dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix3x2dv : NULL;
+    glad_glProgramUniformMatrix3x2fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix3x2fv : NULL;
+    glad_glProgramUniformMatrix3x4dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix3x4dv : NULL;
+    glad_glProgramUniformMatrix3x4fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix3x4fv : NULL;
+    glad_glProgramUniformMatrix4dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix4dv : NULL;
+    glad_glProgramUniformMatrix4fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix4fv : NULL;
+    glad_glProgramUniformMatrix4x2dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix4x2dv : NULL;
+    glad_glProgramUniformMatrix4x2fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix4x2fv : NULL;
+    glad_glProgramUniformMatrix4x3dv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix4x3dv : NULL;
+    glad_glProgramUniformMatrix4x3fv = on_demand ? glad_on_demand_impl_glProgramUniformMatrix4x3fv : NULL;
+    glad_glProvokingVertex = on_demand ? glad_on_demand_impl_glProvokingVertex : NULL;
+    glad_glPushDebugGroup = on_demand ? glad_on_demand_impl_glPushDebugGroup : NULL;
+    glad_glQueryCounter = on_demand ? glad_on_demand_impl_glQueryCounter : NULL;
+    glad_glReadBuffer = on_demand ? glad_on_demand_impl_glReadBuffer : NULL;
+    glad_glReadPixels = on_demand ? glad_on_demand_impl_glReadPixels : NULL;
+    glad_glReadnPixels = on_demand ? glad_on_demand_impl_glReadnPixels : NULL;
+    glad_glReleaseShaderCompiler = on_demand ? glad_on_demand_impl_glReleaseShaderCompiler : NULL;
+    glad_glRenderbufferStorage = on_demand ? glad_on_demand_impl_glRenderbufferStorage : NULL;
+    glad_glRenderbufferStorageMultisample = on_demand ? glad_on_demand_impl_glRenderbufferStorageMultisample : NULL;
+    glad_glResumeTransformFeedback = on_demand ? glad_on_demand_impl_glResumeTransformFeedback : NULL;
+    glad_glSampleCoverage = on_demand ? glad_on_demand_impl_glSampleCoverage : NULL;
+    glad_glSampleMaski = on_demand ? glad_on_demand_impl_glSampleMaski : NULL;
+    glad_glSamplerParameterIiv = on_demand ? glad_on_demand_impl_glSamplerParameterIiv : NULL;
+    glad_glSamplerParameterIuiv = on_demand ? glad_on_demand_impl_glSamplerParameterIuiv : NULL;
+    glad_glSamplerParameterf = on_demand ? glad_on_demand_impl_glSamplerParameterf : NULL;
+    glad_glSamplerParameterfv = on_demand ? glad_on_demand_impl_glSamplerParameterfv : NULL;
+    glad_glSamplerParameteri = on_demand ? glad_on_demand_impl_glSamplerParameteri : NULL;
+    glad_glSamplerParameteriv = on_demand ? glad_on_demand_impl_glSamplerParameteriv : NULL;
+    glad_glScissor = on_demand ? glad_on_demand_impl_glScissor : NULL;
+    glad_glScissorArrayv = on_demand ? glad_on_demand_impl_glScissorArrayv : NULL;
+    glad_glScissorIndexed = on_demand ? glad_on_demand_impl_glScissorIndexed : NULL;
+    glad_glScissorIndexedv = on_demand ? glad_on_demand_impl_glScissorIndexedv : NULL;
+    glad_glShaderBinary = on_demand ? glad_on_demand_impl_glShaderBinary : NULL;
+    glad_glShaderSource = on_demand ? glad_on_demand_impl_glShaderSource : NULL;
+    glad_glShaderStorageBlockBinding = on_demand ? glad_on_demand_impl_glShaderStorageBlockBinding : NULL;
+    glad_glSpecializeShader = on_demand ? glad_on_demand_impl_glSpecializeShader : NULL;
+    glad_glStencilFunc = on_demand ? glad_on_demand_impl_glStencilFunc : NULL;
+    glad_glStencilFuncSeparate = on_demand ? glad_on_demand_impl_glStencilFuncSeparate : NULL;
+    glad_glStencilMask = on_demand ? glad_on_demand_impl_glStencilMask : NULL;
+    glad_glStencilMaskSeparate = on_demand ? glad_on_demand_impl_glStencilMaskSeparate : NULL;
+    glad_glStencilOp = on_demand ? glad_on_demand_impl_glStencilOp : NULL;
+    glad_glStencilOpSeparate = on_demand ? glad_on_demand_impl_glStencilOpSeparate : NULL;
+    glad_glTexBuffer = on_demand ? glad_on_demand_impl_glTexBuffer : NULL;
+    glad_glTexBufferRange = on_demand ? glad_on_demand_impl_glTexBufferRange : NULL;
+    glad_glTexImage1D = on_demand ? glad_on_demand_impl_glTexImage1D : NULL;
+    glad_glTexImage2D = on_demand ? glad_on_demand_impl_glTexImage2D : NULL;
+    glad_glTexImage2DMultisample = on_demand ? glad_on_demand_impl_glTexImage2DMultisample : NULL;
+    glad_glTexImage3D = on_demand ? glad_on_demand_impl_glTexImage3D : NULL;
+    glad_glTexImage3DMultisample = on_demand ? glad_on_demand_impl_glTexImage3DMultisample : NULL;
+    glad_glTexParameterIiv = on_demand ? glad_on_demand_impl_glTexParameterIiv : NULL;
+    glad_glTexParameterIuiv = on_demand ? glad_on_demand_impl_glTexParameterIuiv : NULL;
+    glad_glTexParameterf = on_demand ? glad_on_demand_impl_glTexParameterf : NULL;
+    glad_glTexParameterfv = on_demand ? glad_on_demand_impl_glTexParameterfv : NULL;
+    glad_glTexParameteri = on_demand ? glad_on_demand_impl_glTexParameteri : NULL;
+    glad_glTexParameteriv = on_demand ? glad_on_demand_impl_glTexParameteriv : NULL;
+    glad_glTexStorage1D = on_demand ? glad_on_demand_impl_glTexStorage1D : NULL;
+    glad_glTexStorage2D = on_demand ? glad_on_demand_impl_glTexStorage2D : NULL;
+    glad_glTexStorage2DMultisample = on_demand ? glad_on_demand_impl_glTexStorage2DMultisample : NULL;
+    glad_glTexStorage3D = on_demand ? glad_on_demand_impl_glTexStorage3D : NULL;
+    glad_glTexStorage3DMultisample = on_demand ? glad_on_demand_impl_glTexStorage3DMultisample : NULL;
+    glad_glTexSubImage1D = on_demand ? glad_on_demand_impl_glTexSubImage1D : NULL;
+    glad_glTexSubImage2D = on_demand ? glad_on_demand_impl_glTexSubImage2D : NULL;
+    glad_glTexSubImage3D = on_demand ? glad_on_demand_impl_glTexSubImage3D : NULL;
+    glad_glTextureBarrier = on_demand ? glad_on_demand_impl_glTextureBarrier : NULL;
+    glad_glTextureBuffer = on_demand ? glad_on_demand_impl_glTextureBuffer : NULL;
+    glad_glTextureBufferRange = on_demand ? glad_on_demand_impl_glTextureBufferRange : NULL;
+    glad_glTextureParameterIiv = on_demand ? glad_on_demand_impl_glTextureParameterIiv : NULL;
+    glad_glTextureParameterIuiv = on_demand ? glad_on_demand_impl_glTextureParameterIuiv : NULL;
+    glad_glTextureParameterf = on_demand ? glad_on_demand_impl_glTextureParameterf : NULL;
+    glad_glTextureParameterfv = on_demand ? glad_on_demand_impl_glTextureParameterfv : NULL;
+    glad_glTextureParameteri = on_demand ? glad_on_demand_impl_glTextureParameteri : NULL;
+    glad_glTextureParameteriv = on_demand ? glad_on_demand_impl_glTextureParameteriv : NULL;
+    glad_glTextureStorage1D = on_demand ? glad_on_demand_impl_glTextureStorage1D : NULL;
+    glad_glTextureStorage2D = on_demand ? glad_on_demand_impl_glTextureStorage2D : NULL;
+    glad_glTextureStorage2DMultisample = on_demand ? glad_on_demand_impl_glTextureStorage2DMultisample : NULL;
+    glad_glTextureStorage3D = on_demand ? glad_on_demand_impl_glTextureStorage3D : NULL;
+    glad_glTextureStorage3DMultisample = on_demand ? glad_on_demand_impl_glTextureStorage3DMultisample : NULL;
+    glad_glTextureSubImage1D = on_demand ? glad_on_demand_impl_glTextureSubImage1D : NULL;
+    glad_glTextureSubImage2D = on_demand ? glad_on_demand_impl_glTextureSubImage2D : NULL;
+    glad_glTextureSubImage3D = on_demand ? glad_on_demand_impl_glTextureSubImage3D : NULL;
+    glad_glTextureView = on_demand ? glad_on_demand_impl_glTextureView : NULL;
+    glad_glTransformFeedbackBufferBase = on_demand ? glad_on_demand_impl_glTransformFeedbackBufferBase : NULL;
+    glad_glTransformFeedbackBufferRange = on_demand ? glad_on_demand_impl_glTransformFeedbackBufferRange : NULL;
+    glad_glTransformFeedbackVaryings = on_demand ? glad_on_demand_impl_glTransformFeedbackVaryings : NULL;
+    glad_glUniform1d = on_demand ? glad_on_demand_impl_glUniform1d : NULL;
+    glad_glUniform1dv = on_demand ? glad_on_demand_impl_glUniform1dv : NULL;
+    glad_glUniform1f = on_demand ? glad_on_demand_impl_glUniform1f : NULL;
+    glad_glUniform1fv = on_demand ? glad_on_demand_impl_glUniform1fv : NULL;
+    glad_glUniform1i = on_demand ? glad_on_demand_impl_glUniform1i : NULL;
+    glad_glUniform1iv = on_demand ? glad_on_demand_impl_glUniform1iv : NULL;
+    glad_glUniform1ui = on_demand ? glad_on_demand_impl_glUniform1ui : NULL;
+    glad_glUniform1uiv = on_demand ? glad_on_demand_impl_glUniform1uiv : NULL;
+    glad_glUniform2d = on_demand ? glad_on_demand_impl_glUniform2d : NULL;
+    glad_glUniform2dv = on_demand ? glad_on_demand_impl_glUniform2dv : NULL;
+    glad_glUniform2f = on_demand ? glad_on_demand_impl_glUniform2f : NULL;
+    glad_glUniform2fv = on_demand ? glad_on_demand_impl_glUniform2fv : NULL;
+    glad_glUniform2i = on_demand ? glad_on_demand_impl_glUniform2i : NULL;
+    glad_glUniform2iv = on_demand ? glad_on_demand_impl_glUniform2iv : NULL;
+    glad_glUniform2ui = on_demand ? glad_on_demand_impl_glUniform2ui : NULL;
+    glad_glUniform2uiv = on_demand ? glad_on_demand_impl_glUniform2uiv : NULL;
+    glad_glUniform3d = on_demand ? glad_on_demand_impl_glUniform3d : NULL;
+    glad_glUniform3dv = on_demand ? glad_on_demand_impl_glUniform3dv : NULL;
+    glad_glUniform3f = on_demand ? glad_on_demand_impl_glUniform3f : NULL;
+    glad_glUniform3fv = on_demand ? glad_on_demand_impl_glUniform3fv : NULL;
+    glad_glUniform3i = on_demand ? glad_on_demand_impl_glUniform3i : NULL;
+    glad_glUniform3iv = on_demand ? glad_on_demand_impl_glUniform3iv : NULL;
+    glad_glUniform3ui = on_demand ? glad_on_demand_impl_glUniform3ui : NULL;
+    glad_glUniform3uiv = on_demand ? glad_on_demand_impl_glUniform3uiv : NULL;
+    glad_glUniform4d = on_demand ? glad_on_demand_impl_glUniform4d : NULL;
+    glad_glUniform4dv = on_demand ? glad_on_demand_impl_glUniform4dv : NULL;
+    glad_glUniform4f = on_demand ? glad_on_demand_impl_glUniform4f : NULL;
+    glad_glUniform4fv = on_demand ? glad_on_demand_impl_glUniform4fv : NULL;
+    glad_glUniform4i = on_demand ? glad_on_demand_impl_glUniform4i : NULL;
+    glad_glUniform4iv = on_demand ? glad_on_demand_impl_glUniform4iv : NULL;
+    glad_glUniform4ui = on_demand ? glad_on_demand_impl_glUniform4ui : NULL;
+    glad_glUniform4uiv = on_demand ? glad_on_demand_impl_glUniform4uiv : NULL;
+    glad_glUniformBlockBinding = on_demand ? glad_on_demand_impl_glUniformBlockBinding : NULL;
+    glad_glUniformMatrix2dv = on_demand ? glad_on_demand_impl_glUniformMatrix2dv : NULL;
+    glad_glUniformMatrix2fv = on_demand ? glad_on_demand_impl_glUniformMatrix2fv : NULL;
+    glad_glUniformMatrix2x3dv = on_demand ? glad_on_demand_impl_glUniformMatrix2x3dv : NULL;
+    glad_glUniformMatrix2x3fv = on_demand ? glad_on_demand_impl_glUniformMatrix2x3fv : NULL;
+    glad_glUniformMatrix2x4dv = on_demand ? glad_on_demand_impl_glUniformMatrix2x4dv : NULL;
+    glad_glUniformMatrix2x4fv = on_demand ? glad_on_demand_impl_glUniformMatrix2x4fv : NULL;
+    glad_glUniformMatrix3dv = on_demand ? glad_on_demand_impl_glUniformMatrix3dv : NULL;
+    glad_glUniformMatrix3fv = on_demand ? glad_on_demand_impl_glUniformMatrix3fv : NULL;
+    glad_glUniformMatrix3x2dv = on_demand ? glad_on_demand_impl_glUniformMatrix3x2dv : NULL;
+    glad_glUniformMatrix3x2fv = on_demand ? glad_on_demand_impl_glUniformMatrix3x2fv : NULL;
+    glad_glUniformMatrix3x4dv = on_demand ? glad_on_demand_impl_glUniformMatrix3x4dv : NULL;
+    glad_glUniformMatrix3x4fv = on_demand ? glad_on_demand_impl_glUniformMatrix3x4fv : NULL;
+    glad_glUniformMatrix4dv = on_demand ? glad_on_demand_impl_glUniformMatrix4dv : NULL;
+    glad_glUniformMatrix4fv = on_demand ? glad_on_demand_impl_glUniformMatrix4fv : NULL;
+    glad_glUniformMatrix4x2dv = on_demand ? glad_on_demand_impl_glUniformMatrix4x2dv : NULL;
+    glad_glUniformMatrix4x2fv = on_demand ? glad_on_demand_impl_glUniformMatrix4x2fv : NULL;
+    glad_glUniformMatrix4x3dv = on_demand ? glad_on_demand_impl_glUniformMatrix4x3dv : NULL;
+    glad_glUniformMatrix4x3fv = on_demand ? glad_on_demand_impl_glUniformMatrix4x3fv : NULL;
+    glad_glUniformSubroutinesuiv = on_demand ? glad_on_demand_impl_glUniformSubroutinesuiv : NULL;
+    glad_glUnmapBuffer = on_demand ? glad_on_demand_impl_glUnmapBuffer : NULL;
+    glad_glUnmapNamedBuffer = on_demand ? glad_on_demand_impl_glUnmapNamedBuffer : NULL;
+    glad_glUseProgram = on_demand ? glad_on_demand_impl_glUseProgram : NULL;
+    glad_glUseProgramStages = on_demand ? glad_on_demand_impl_glUseProgramStages : NULL;
+    glad_glValidateProgram = on_demand ? glad_on_demand_impl_glValidateProgram : NULL;
+    glad_glValidateProgramPipeline = on_demand ? glad_on_demand_impl_glValidateProgramPipeline : NULL;
+    glad_glVertexArrayAttribBinding = on_demand ? glad_on_demand_impl_glVertexArrayAttribBinding : NULL;
+    glad_glVertexArrayAttribFormat = on_demand ? glad_on_demand_impl_glVertexArrayAttribFormat : NULL;
+    glad_glVertexArrayAttribIFormat = on_demand ? glad_on_demand_impl_glVertexArrayAttribIFormat : NULL;
+    glad_glVertexArrayAttribLFormat = on_demand ? glad_on_demand_impl_glVertexArrayAttribLFormat : NULL;
+    glad_glVertexArrayBindingDivisor = on_demand ? glad_on_demand_impl_glVertexArrayBindingDivisor : NULL;
+    glad_glVertexArrayElementBuffer = on_demand ? glad_on_demand_impl_glVertexArrayElementBuffer : NULL;
+    glad_glVertexArrayVertexBuffer = on_demand ? glad_on_demand_impl_glVertexArrayVertexBuffer : NULL;
+    glad_glVertexArrayVertexBuffers = on_demand ? glad_on_demand_impl_glVertexArrayVertexBuffers : NULL;
+    glad_glVertexAttrib1d = on_demand ? glad_on_demand_impl_glVertexAttrib1d : NULL;
+    glad_glVertexAttrib1dv = on_demand ? glad_on_demand_impl_glVertexAttrib1dv : NULL;
+    glad_glVertexAttrib1f = on_demand ? glad_on_demand_impl_glVertexAttrib1f : NULL;
+    glad_glVertexAttrib1fv = on_demand ? glad_on_demand_impl_glVertexAttrib1fv : NULL;
+    glad_glVertexAttrib1s = on_demand ? glad_on_demand_impl_glVertexAttrib1s : NULL;
+    glad_glVertexAttrib1sv = on_demand ? glad_on_demand_impl_glVertexAttrib1sv : NULL;
+    glad_glVertexAttrib2d = on_demand ? glad_on_demand_impl_glVertexAttrib2d : NULL;
+    glad_glVertexAttrib2dv = on_demand ? glad_on_demand_impl_glVertexAttrib2dv : NULL;
+    glad_glVertexAttrib2f = on_demand ? glad_on_demand_impl_glVertexAttrib2f : NULL;
+    glad_glVertexAttrib2fv = on_demand ? glad_on_demand_impl_glVertexAttrib2fv : NULL;
+    glad_glVertexAttrib2s = on_demand ? glad_on_demand_impl_glVertexAttrib2s : NULL;
+    glad_glVertexAttrib2sv = on_demand ? glad_on_demand_impl_glVertexAttrib2sv : NULL;
+    glad_glVertexAttrib3d = on_demand ? glad_on_demand_impl_glVertexAttrib3d : NULL;
+    glad_glVertexAttrib3dv = on_demand ? glad_on_demand_impl_glVertexAttrib3dv : NULL;
+    glad_glVertexAttrib3f = on_demand ? glad_on_demand_impl_glVertexAttrib3f : NULL;
+    glad_glVertexAttrib3fv = on_demand ? glad_on_demand_impl_glVertexAttrib3fv : NULL;
+    glad_glVertexAttrib3s = on_demand ? glad_on_demand_impl_glVertexAttrib3s : NULL;
+    glad_glVertexAttrib3sv = on_demand ? glad_on_demand_impl_glVertexAttrib3sv : NULL;
+    glad_glVertexAttrib4Nbv = on_demand ? glad_on_demand_impl_glVertexAttrib4Nbv : NULL;
+    glad_glVertexAttrib4Niv = on_demand ? glad_on_demand_impl_glVertexAttrib4Niv : NULL;
+    glad_glVertexAttrib4Nsv = on_demand ? glad_on_demand_impl_glVertexAttrib4Nsv : NULL;
+    glad_glVertexAttrib4Nub = on_demand ? glad_on_demand_impl_glVertexAttrib4Nub : NULL;
+    glad_glVertexAttrib4Nubv = on_demand ? glad_on_demand_impl_glVertexAttrib4Nubv : NULL;
+    glad_glVertexAttrib4Nuiv = on_demand ? glad_on_demand_impl_glVertexAttrib4Nuiv : NULL;
+    glad_glVertexAttrib4Nusv = on_demand ? glad_on_demand_impl_glVertexAttrib4Nusv : NULL;
+    glad_glVertexAttrib4bv = on_demand ? glad_on_demand_impl_glVertexAttrib4bv : NULL;
+    glad_glVertexAttrib4d = on_demand ? glad_on_demand_impl_glVertexAttrib4d : NULL;
+    glad_glVertexAttrib4dv = on_demand ? glad_on_demand_impl_glVertexAttrib4dv : NULL;
+    glad_glVertexAttrib4f = on_demand ? glad_on_demand_impl_glVertexAttrib4f : NULL;
+    glad_glVertexAttrib4fv = on_demand ? glad_on_demand_impl_glVertexAttrib4fv : NULL;
+    glad_glVertexAttrib4iv = on_demand ? glad_on_demand_impl_glVertexAttrib4iv : NULL;
+    glad_glVertexAttrib4s = on_demand ? glad_on_demand_impl_glVertexAttrib4s : NULL;
+    glad_glVertexAttrib4sv = on_demand ? glad_on_demand_impl_glVertexAttrib4sv : NULL;
+    glad_glVertexAttrib4ubv = on_demand ? glad_on_demand_impl_glVertexAttrib4ubv : NULL;
+    glad_glVertexAttrib4uiv = on_demand ? glad_on_demand_impl_glVertexAttrib4uiv : NULL;
+    glad_glVertexAttrib4usv = on_demand ? glad_on_demand_impl_glVertexAttrib4usv : NULL;
+    glad_glVertexAttribBinding = on_demand ? glad_on_demand_impl_glVertexAttribBinding : NULL;
+    glad_glVertexAttribDivisor = on_demand ? glad_on_demand_impl_glVertexAttribDivisor : NULL;
+    glad_glVertexAttribFormat = on_demand ? glad_on_demand_impl_glVertexAttribFormat : NULL;
+    glad_glVertexAttribI1i = on_demand ? glad_on_demand_impl_glVertexAttribI1i : NULL;
+    glad_glVertexAttribI1iv = on_demand ? glad_on_demand_impl_glVertexAttribI1iv : NULL;
+    glad_glVertexAttribI1ui = on_demand ? glad_on_demand_impl_glVertexAttribI1ui : NULL;
+    glad_glVertexAttribI1uiv = on_demand ? glad_on_demand_impl_glVertexAttribI1uiv : NULL;
+    glad_glVertexAttribI2i = on_demand ? glad_on_demand_impl_glVertexAttribI2i : NULL;
+    glad_glVertexAttribI2iv = on_demand ? glad_on_demand_impl_glVertexAttribI2iv : NULL;
+    glad_glVertexAttribI2ui = on_demand ? glad_on_demand_impl_glVertexAttribI2ui : NULL;
+    glad_glVertexAttribI2uiv = on_demand ? glad_on_demand_impl_glVertexAttribI2uiv : NULL;
+    glad_glVertexAttribI3i = on_demand ? glad_on_demand_impl_glVertexAttribI3i : NULL;
+    glad_glVertexAttribI3iv = on_demand ? glad_on_demand_impl_glVertexAttribI3iv : NULL;
+    glad_glVertexAttribI3ui = on_demand ? glad_on_demand_impl_glVertexAttribI3ui : NULL;
+    glad_glVertexAttribI3uiv = on_demand ? glad_on_demand_impl_glVertexAttribI3uiv : NULL;
+    glad_glVertexAttribI4bv = on_demand ? glad_on_demand_impl_glVertexAttribI4bv : NULL;
+    glad_glVertexAttribI4i = on_demand ? glad_on_demand_impl_glVertexAttribI4i : NULL;
+    glad_glVertexAttribI4iv = on_demand ? glad_on_demand_impl_glVertexAttribI4iv : NULL;
+    glad_glVertexAttribI4sv = on_demand ? glad_on_demand_impl_glVertexAttribI4sv : NULL;
+    glad_glVertexAttribI4ubv = on_demand ? glad_on_demand_impl_glVertexAttribI4ubv : NULL;
+    glad_glVertexAttribI4ui = on_demand ? glad_on_demand_impl_glVertexAttribI4ui : NULL;
+    glad_glVertexAttribI4uiv = on_demand ? glad_on_demand_impl_glVertexAttribI4uiv : NULL;
+    glad_glVertexAttribI4usv = on_demand ? glad_on_demand_impl_glVertexAttribI4usv : NULL;
+    glad_glVertexAttribIFormat = on_demand ? glad_on_demand_impl_glVertexAttribIFormat : NULL;
+    glad_glVertexAttribIPointer = on_demand ? glad_on_demand_impl_glVertexAttribIPointer : NULL;
+    glad_glVertexAttribL1d = on_demand ? glad_on_demand_impl_glVertexAttribL1d : NULL;
+    glad_glVertexAttribL1dv = on_demand ? glad_on_demand_impl_glVertexAttribL1dv : NULL;
+    glad_glVertexAttribL2d = on_demand ? glad_on_demand_impl_glVertexAttribL2d : NULL;
+    glad_glVertexAttribL2dv = on_demand ? glad_on_demand_impl_glVertexAttribL2dv : NULL;
+    glad_glVertexAttribL3d = on_demand ? glad_on_demand_impl_glVertexAttribL3d : NULL;
+    glad_glVertexAttribL3dv = on_demand ? glad_on_demand_impl_glVertexAttribL3dv : NULL;
+    glad_glVertexAttribL4d = on_demand ? glad_on_demand_impl_glVertexAttribL4d : NULL;
+    glad_glVertexAttribL4dv = on_demand ? glad_on_demand_impl_glVertexAttribL4dv : NULL;
+    glad_glVertexAttribLFormat = on_demand ? glad_on_demand_impl_glVertexAttribLFormat : NULL;
+    glad_glVertexAttribLPointer = on_demand ? glad_on_demand_impl_glVertexAttribLPointer : NULL;
+    glad_glVertexAttribP1ui = on_demand ? glad_on_demand_impl_glVertexAttribP1ui : NULL;
+    glad_glVertexAttribP1uiv = on_demand ? glad_on_demand_impl_glVertexAttribP1uiv : NULL;
+    glad_glVertexAttribP2ui = on_demand ? glad_on_demand_impl_glVertexAttribP2ui : NULL;
+    glad_glVertexAttribP2uiv = on_demand ? glad_on_demand_impl_glVertexAttribP2uiv : NULL;
+    glad_glVertexAttribP3ui = on_demand ? glad_on_demand_impl_glVertexAttribP3ui : NULL;
+    glad_glVertexAttribP3uiv = on_demand ? glad_on_demand_impl_glVertexAttribP3uiv : NULL;
+    glad_glVertexAttribP4ui = on_demand ? glad_on_demand_impl_glVertexAttribP4ui : NULL;
+    glad_glVertexAttribP4uiv = on_demand ? glad_on_demand_impl_glVertexAttribP4uiv : NULL;
+    glad_glVertexAttribPointer = on_demand ? glad_on_demand_impl_glVertexAttribPointer : NULL;
+    glad_glVertexBindingDivisor = on_demand ? glad_on_demand_impl_glVertexBindingDivisor : NULL;
+    glad_glViewport = on_demand ? glad_on_demand_impl_glViewport : NULL;
+    glad_glViewportArrayv = on_demand ? glad_on_demand_impl_glViewportArrayv : NULL;
+    glad_glViewportIndexedf = on_demand ? glad_on_demand_impl_glViewportIndexedf : NULL;
+    glad_glViewportIndexedfv = on_demand ? glad_on_demand_impl_glViewportIndexedfv : NULL;
+    glad_glWaitSync = on_demand ? glad_on_demand_impl_glWaitSync : NULL;
+}
+
+
 static void glad_gl_load_GL_VERSION_1_0( GLADuserptrloadfunc load, void* userptr) {
     if(!GLAD_GL_VERSION_1_0) return;
     glad_glBlendFunc = (PFNGLBLENDFUNCPROC) load(userptr, "glBlendFunc");
@@ -1425,118 +4745,845 @@ static void glad_gl_load_GL_VERSION_4_6( GLADuserptrloadfunc load, void* userptr
 
 
 
+static void glad_gl_load_GL_VERSION_1_0_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_1_0) return;
+    context->BlendFunc = (PFNGLBLENDFUNCPROC) load(userptr, "glBlendFunc");
+    context->Clear = (PFNGLCLEARPROC) load(userptr, "glClear");
+    context->ClearColor = (PFNGLCLEARCOLORPROC) load(userptr, "glClearColor");
+    context->ClearDepth = (PFNGLCLEARDEPTHPROC) load(userptr, "glClearDepth");
+    context->ClearStencil = (PFNGLCLEARSTENCILPROC) load(userptr, "glClearStencil");
+    context->ColorMask = (PFNGLCOLORMASKPROC) load(userptr, "glColorMask");
+    context->CullFace = (PFNGLCULLFACEPROC) load(userptr, "glCullFace");
+    context->DepthFunc = (PFNGLDEPTHFUNCPROC) load(userptr, "glDepthFunc");
+    context->DepthMask = (PFNGLDEPTHMASKPROC) load(userptr, "glDepthMask");
+    context->DepthRange = (PFNGLDEPTHRANGEPROC) load(userptr, "glDepthRange");
+    context->Disable = (PFNGLDISABLEPROC) load(userptr, "glDisable");
+    context->DrawBuffer = (PFNGLDRAWBUFFERPROC) load(userptr, "glDrawBuffer");
+    context->Enable = (PFNGLENABLEPROC) load(userptr, "glEnable");
+    context->Finish = (PFNGLFINISHPROC) load(userptr, "glFinish");
+    context->Flush = (PFNGLFLUSHPROC) load(userptr, "glFlush");
+    context->FrontFace = (PFNGLFRONTFACEPROC) load(userptr, "glFrontFace");
+    context->GetBooleanv = (PFNGLGETBOOLEANVPROC) load(userptr, "glGetBooleanv");
+    context->GetDoublev = (PFNGLGETDOUBLEVPROC) load(userptr, "glGetDoublev");
+    context->GetError = (PFNGLGETERRORPROC) load(userptr, "glGetError");
+    context->GetFloatv = (PFNGLGETFLOATVPROC) load(userptr, "glGetFloatv");
+    context->GetIntegerv = (PFNGLGETINTEGERVPROC) load(userptr, "glGetIntegerv");
+    context->GetString = (PFNGLGETSTRINGPROC) load(userptr, "glGetString");
+    context->GetTexImage = (PFNGLGETTEXIMAGEPROC) load(userptr, "glGetTexImage");
+    context->GetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC) load(userptr, "glGetTexLevelParameterfv");
+    context->GetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC) load(userptr, "glGetTexLevelParameteriv");
+    context->GetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC) load(userptr, "glGetTexParameterfv");
+    context->GetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC) load(userptr, "glGetTexParameteriv");
+    context->Hint = (PFNGLHINTPROC) load(userptr, "glHint");
+    context->IsEnabled = (PFNGLISENABLEDPROC) load(userptr, "glIsEnabled");
+    context->LineWidth = (PFNGLLINEWIDTHPROC) load(userptr, "glLineWidth");
+    context->LogicOp = (PFNGLLOGICOPPROC) load(userptr, "glLogicOp");
+    context->PixelStoref = (PFNGLPIXELSTOREFPROC) load(userptr, "glPixelStoref");
+    context->PixelStorei = (PFNGLPIXELSTOREIPROC) load(userptr, "glPixelStorei");
+    context->PointSize = (PFNGLPOINTSIZEPROC) load(userptr, "glPointSize");
+    context->PolygonMode = (PFNGLPOLYGONMODEPROC) load(userptr, "glPolygonMode");
+    context->ReadBuffer = (PFNGLREADBUFFERPROC) load(userptr, "glReadBuffer");
+    context->ReadPixels = (PFNGLREADPIXELSPROC) load(userptr, "glReadPixels");
+    context->Scissor = (PFNGLSCISSORPROC) load(userptr, "glScissor");
+    context->StencilFunc = (PFNGLSTENCILFUNCPROC) load(userptr, "glStencilFunc");
+    context->StencilMask = (PFNGLSTENCILMASKPROC) load(userptr, "glStencilMask");
+    context->StencilOp = (PFNGLSTENCILOPPROC) load(userptr, "glStencilOp");
+    context->TexImage1D = (PFNGLTEXIMAGE1DPROC) load(userptr, "glTexImage1D");
+    context->TexImage2D = (PFNGLTEXIMAGE2DPROC) load(userptr, "glTexImage2D");
+    context->TexParameterf = (PFNGLTEXPARAMETERFPROC) load(userptr, "glTexParameterf");
+    context->TexParameterfv = (PFNGLTEXPARAMETERFVPROC) load(userptr, "glTexParameterfv");
+    context->TexParameteri = (PFNGLTEXPARAMETERIPROC) load(userptr, "glTexParameteri");
+    context->TexParameteriv = (PFNGLTEXPARAMETERIVPROC) load(userptr, "glTexParameteriv");
+    context->Viewport = (PFNGLVIEWPORTPROC) load(userptr, "glViewport");
+}
+static void glad_gl_load_GL_VERSION_1_1_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_1_1) return;
+    context->BindTexture = (PFNGLBINDTEXTUREPROC) load(userptr, "glBindTexture");
+    context->CopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC) load(userptr, "glCopyTexImage1D");
+    context->CopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC) load(userptr, "glCopyTexImage2D");
+    context->CopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC) load(userptr, "glCopyTexSubImage1D");
+    context->CopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC) load(userptr, "glCopyTexSubImage2D");
+    context->DeleteTextures = (PFNGLDELETETEXTURESPROC) load(userptr, "glDeleteTextures");
+    context->DrawArrays = (PFNGLDRAWARRAYSPROC) load(userptr, "glDrawArrays");
+    context->DrawElements = (PFNGLDRAWELEMENTSPROC) load(userptr, "glDrawElements");
+    context->GenTextures = (PFNGLGENTEXTURESPROC) load(userptr, "glGenTextures");
+    context->GetPointerv = (PFNGLGETPOINTERVPROC) load(userptr, "glGetPointerv");
+    context->IsTexture = (PFNGLISTEXTUREPROC) load(userptr, "glIsTexture");
+    context->PolygonOffset = (PFNGLPOLYGONOFFSETPROC) load(userptr, "glPolygonOffset");
+    context->TexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC) load(userptr, "glTexSubImage1D");
+    context->TexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC) load(userptr, "glTexSubImage2D");
+}
+static void glad_gl_load_GL_VERSION_1_2_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_1_2) return;
+    context->CopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC) load(userptr, "glCopyTexSubImage3D");
+    context->DrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC) load(userptr, "glDrawRangeElements");
+    context->TexImage3D = (PFNGLTEXIMAGE3DPROC) load(userptr, "glTexImage3D");
+    context->TexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC) load(userptr, "glTexSubImage3D");
+}
+static void glad_gl_load_GL_VERSION_1_3_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_1_3) return;
+    context->ActiveTexture = (PFNGLACTIVETEXTUREPROC) load(userptr, "glActiveTexture");
+    context->CompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) load(userptr, "glCompressedTexImage1D");
+    context->CompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) load(userptr, "glCompressedTexImage2D");
+    context->CompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) load(userptr, "glCompressedTexImage3D");
+    context->CompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) load(userptr, "glCompressedTexSubImage1D");
+    context->CompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) load(userptr, "glCompressedTexSubImage2D");
+    context->CompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) load(userptr, "glCompressedTexSubImage3D");
+    context->GetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) load(userptr, "glGetCompressedTexImage");
+    context->SampleCoverage = (PFNGLSAMPLECOVERAGEPROC) load(userptr, "glSampleCoverage");
+}
+static void glad_gl_load_GL_VERSION_1_4_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_1_4) return;
+    context->BlendColor = (PFNGLBLENDCOLORPROC) load(userptr, "glBlendColor");
+    context->BlendEquation = (PFNGLBLENDEQUATIONPROC) load(userptr, "glBlendEquation");
+    context->BlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC) load(userptr, "glBlendFuncSeparate");
+    context->MultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC) load(userptr, "glMultiDrawArrays");
+    context->MultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC) load(userptr, "glMultiDrawElements");
+    context->PointParameterf = (PFNGLPOINTPARAMETERFPROC) load(userptr, "glPointParameterf");
+    context->PointParameterfv = (PFNGLPOINTPARAMETERFVPROC) load(userptr, "glPointParameterfv");
+    context->PointParameteri = (PFNGLPOINTPARAMETERIPROC) load(userptr, "glPointParameteri");
+    context->PointParameteriv = (PFNGLPOINTPARAMETERIVPROC) load(userptr, "glPointParameteriv");
+}
+static void glad_gl_load_GL_VERSION_1_5_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_1_5) return;
+    context->BeginQuery = (PFNGLBEGINQUERYPROC) load(userptr, "glBeginQuery");
+    context->BindBuffer = (PFNGLBINDBUFFERPROC) load(userptr, "glBindBuffer");
+    context->BufferData = (PFNGLBUFFERDATAPROC) load(userptr, "glBufferData");
+    context->BufferSubData = (PFNGLBUFFERSUBDATAPROC) load(userptr, "glBufferSubData");
+    context->DeleteBuffers = (PFNGLDELETEBUFFERSPROC) load(userptr, "glDeleteBuffers");
+    context->DeleteQueries = (PFNGLDELETEQUERIESPROC) load(userptr, "glDeleteQueries");
+    context->EndQuery = (PFNGLENDQUERYPROC) load(userptr, "glEndQuery");
+    context->GenBuffers = (PFNGLGENBUFFERSPROC) load(userptr, "glGenBuffers");
+    context->GenQueries = (PFNGLGENQUERIESPROC) load(userptr, "glGenQueries");
+    context->GetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC) load(userptr, "glGetBufferParameteriv");
+    context->GetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC) load(userptr, "glGetBufferPointerv");
+    context->GetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC) load(userptr, "glGetBufferSubData");
+    context->GetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) load(userptr, "glGetQueryObjectiv");
+    context->GetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC) load(userptr, "glGetQueryObjectuiv");
+    context->GetQueryiv = (PFNGLGETQUERYIVPROC) load(userptr, "glGetQueryiv");
+    context->IsBuffer = (PFNGLISBUFFERPROC) load(userptr, "glIsBuffer");
+    context->IsQuery = (PFNGLISQUERYPROC) load(userptr, "glIsQuery");
+    context->MapBuffer = (PFNGLMAPBUFFERPROC) load(userptr, "glMapBuffer");
+    context->UnmapBuffer = (PFNGLUNMAPBUFFERPROC) load(userptr, "glUnmapBuffer");
+}
+static void glad_gl_load_GL_VERSION_2_0_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_2_0) return;
+    context->AttachShader = (PFNGLATTACHSHADERPROC) load(userptr, "glAttachShader");
+    context->BindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) load(userptr, "glBindAttribLocation");
+    context->BlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC) load(userptr, "glBlendEquationSeparate");
+    context->CompileShader = (PFNGLCOMPILESHADERPROC) load(userptr, "glCompileShader");
+    context->CreateProgram = (PFNGLCREATEPROGRAMPROC) load(userptr, "glCreateProgram");
+    context->CreateShader = (PFNGLCREATESHADERPROC) load(userptr, "glCreateShader");
+    context->DeleteProgram = (PFNGLDELETEPROGRAMPROC) load(userptr, "glDeleteProgram");
+    context->DeleteShader = (PFNGLDELETESHADERPROC) load(userptr, "glDeleteShader");
+    context->DetachShader = (PFNGLDETACHSHADERPROC) load(userptr, "glDetachShader");
+    context->DisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) load(userptr, "glDisableVertexAttribArray");
+    context->DrawBuffers = (PFNGLDRAWBUFFERSPROC) load(userptr, "glDrawBuffers");
+    context->EnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) load(userptr, "glEnableVertexAttribArray");
+    context->GetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC) load(userptr, "glGetActiveAttrib");
+    context->GetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC) load(userptr, "glGetActiveUniform");
+    context->GetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC) load(userptr, "glGetAttachedShaders");
+    context->GetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) load(userptr, "glGetAttribLocation");
+    context->GetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) load(userptr, "glGetProgramInfoLog");
+    context->GetProgramiv = (PFNGLGETPROGRAMIVPROC) load(userptr, "glGetProgramiv");
+    context->GetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) load(userptr, "glGetShaderInfoLog");
+    context->GetShaderSource = (PFNGLGETSHADERSOURCEPROC) load(userptr, "glGetShaderSource");
+    context->GetShaderiv = (PFNGLGETSHADERIVPROC) load(userptr, "glGetShaderiv");
+    context->GetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) load(userptr, "glGetUniformLocation");
+    context->GetUniformfv = (PFNGLGETUNIFORMFVPROC) load(userptr, "glGetUniformfv");
+    context->GetUniformiv = (PFNGLGETUNIFORMIVPROC) load(userptr, "glGetUniformiv");
+    context->GetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC) load(userptr, "glGetVertexAttribPointerv");
+    context->GetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC) load(userptr, "glGetVertexAttribdv");
+    context->GetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC) load(userptr, "glGetVertexAttribfv");
+    context->GetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC) load(userptr, "glGetVertexAttribiv");
+    context->IsProgram = (PFNGLISPROGRAMPROC) load(userptr, "glIsProgram");
+    context->IsShader = (PFNGLISSHADERPROC) load(userptr, "glIsShader");
+    context->LinkProgram = (PFNGLLINKPROGRAMPROC) load(userptr, "glLinkProgram");
+    context->ShaderSource = (PFNGLSHADERSOURCEPROC) load(userptr, "glShaderSource");
+    context->StencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC) load(userptr, "glStencilFuncSeparate");
+    context->StencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC) load(userptr, "glStencilMaskSeparate");
+    context->StencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC) load(userptr, "glStencilOpSeparate");
+    context->Uniform1f = (PFNGLUNIFORM1FPROC) load(userptr, "glUniform1f");
+    context->Uniform1fv = (PFNGLUNIFORM1FVPROC) load(userptr, "glUniform1fv");
+    context->Uniform1i = (PFNGLUNIFORM1IPROC) load(userptr, "glUniform1i");
+    context->Uniform1iv = (PFNGLUNIFORM1IVPROC) load(userptr, "glUniform1iv");
+    context->Uniform2f = (PFNGLUNIFORM2FPROC) load(userptr, "glUniform2f");
+    context->Uniform2fv = (PFNGLUNIFORM2FVPROC) load(userptr, "glUniform2fv");
+    context->Uniform2i = (PFNGLUNIFORM2IPROC) load(userptr, "glUniform2i");
+    context->Uniform2iv = (PFNGLUNIFORM2IVPROC) load(userptr, "glUniform2iv");
+    context->Uniform3f = (PFNGLUNIFORM3FPROC) load(userptr, "glUniform3f");
+    context->Uniform3fv = (PFNGLUNIFORM3FVPROC) load(userptr, "glUniform3fv");
+    context->Uniform3i = (PFNGLUNIFORM3IPROC) load(userptr, "glUniform3i");
+    context->Uniform3iv = (PFNGLUNIFORM3IVPROC) load(userptr, "glUniform3iv");
+    context->Uniform4f = (PFNGLUNIFORM4FPROC) load(userptr, "glUniform4f");
+    context->Uniform4fv = (PFNGLUNIFORM4FVPROC) load(userptr, "glUniform4fv");
+    context->Uniform4i = (PFNGLUNIFORM4IPROC) load(userptr, "glUniform4i");
+    context->Uniform4iv = (PFNGLUNIFORM4IVPROC) load(userptr, "glUniform4iv");
+    context->UniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC) load(userptr, "glUniformMatrix2fv");
+    context->UniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC) load(userptr, "glUniformMatrix3fv");
+    context->UniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC) load(userptr, "glUniformMatrix4fv");
+    context->UseProgram = (PFNGLUSEPROGRAMPROC) load(userptr, "glUseProgram");
+    context->ValidateProgram = (PFNGLVALIDATEPROGRAMPROC) load(userptr, "glValidateProgram");
+    context->VertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC) load(userptr, "glVertexAttrib1d");
+    context->VertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC) load(userptr, "glVertexAttrib1dv");
+    context->VertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) load(userptr, "glVertexAttrib1f");
+    context->VertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC) load(userptr, "glVertexAttrib1fv");
+    context->VertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC) load(userptr, "glVertexAttrib1s");
+    context->VertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC) load(userptr, "glVertexAttrib1sv");
+    context->VertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC) load(userptr, "glVertexAttrib2d");
+    context->VertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC) load(userptr, "glVertexAttrib2dv");
+    context->VertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) load(userptr, "glVertexAttrib2f");
+    context->VertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC) load(userptr, "glVertexAttrib2fv");
+    context->VertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC) load(userptr, "glVertexAttrib2s");
+    context->VertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC) load(userptr, "glVertexAttrib2sv");
+    context->VertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC) load(userptr, "glVertexAttrib3d");
+    context->VertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC) load(userptr, "glVertexAttrib3dv");
+    context->VertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC) load(userptr, "glVertexAttrib3f");
+    context->VertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC) load(userptr, "glVertexAttrib3fv");
+    context->VertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC) load(userptr, "glVertexAttrib3s");
+    context->VertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC) load(userptr, "glVertexAttrib3sv");
+    context->VertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC) load(userptr, "glVertexAttrib4Nbv");
+    context->VertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC) load(userptr, "glVertexAttrib4Niv");
+    context->VertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC) load(userptr, "glVertexAttrib4Nsv");
+    context->VertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC) load(userptr, "glVertexAttrib4Nub");
+    context->VertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC) load(userptr, "glVertexAttrib4Nubv");
+    context->VertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC) load(userptr, "glVertexAttrib4Nuiv");
+    context->VertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC) load(userptr, "glVertexAttrib4Nusv");
+    context->VertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC) load(userptr, "glVertexAttrib4bv");
+    context->VertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC) load(userptr, "glVertexAttrib4d");
+    context->VertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC) load(userptr, "glVertexAttrib4dv");
+    context->VertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) load(userptr, "glVertexAttrib4f");
+    context->VertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC) load(userptr, "glVertexAttrib4fv");
+    context->VertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC) load(userptr, "glVertexAttrib4iv");
+    context->VertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC) load(userptr, "glVertexAttrib4s");
+    context->VertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC) load(userptr, "glVertexAttrib4sv");
+    context->VertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC) load(userptr, "glVertexAttrib4ubv");
+    context->VertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC) load(userptr, "glVertexAttrib4uiv");
+    context->VertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC) load(userptr, "glVertexAttrib4usv");
+    context->VertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) load(userptr, "glVertexAttribPointer");
+}
+static void glad_gl_load_GL_VERSION_2_1_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_2_1) return;
+    context->UniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC) load(userptr, "glUniformMatrix2x3fv");
+    context->UniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC) load(userptr, "glUniformMatrix2x4fv");
+    context->UniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC) load(userptr, "glUniformMatrix3x2fv");
+    context->UniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC) load(userptr, "glUniformMatrix3x4fv");
+    context->UniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC) load(userptr, "glUniformMatrix4x2fv");
+    context->UniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC) load(userptr, "glUniformMatrix4x3fv");
+}
+static void glad_gl_load_GL_VERSION_3_0_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_3_0) return;
+    context->BeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC) load(userptr, "glBeginConditionalRender");
+    context->BeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC) load(userptr, "glBeginTransformFeedback");
+    context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC) load(userptr, "glBindBufferBase");
+    context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC) load(userptr, "glBindBufferRange");
+    context->BindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC) load(userptr, "glBindFragDataLocation");
+    context->BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) load(userptr, "glBindFramebuffer");
+    context->BindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) load(userptr, "glBindRenderbuffer");
+    context->BindVertexArray = (PFNGLBINDVERTEXARRAYPROC) load(userptr, "glBindVertexArray");
+    context->BlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) load(userptr, "glBlitFramebuffer");
+    context->CheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) load(userptr, "glCheckFramebufferStatus");
+    context->ClampColor = (PFNGLCLAMPCOLORPROC) load(userptr, "glClampColor");
+    context->ClearBufferfi = (PFNGLCLEARBUFFERFIPROC) load(userptr, "glClearBufferfi");
+    context->ClearBufferfv = (PFNGLCLEARBUFFERFVPROC) load(userptr, "glClearBufferfv");
+    context->ClearBufferiv = (PFNGLCLEARBUFFERIVPROC) load(userptr, "glClearBufferiv");
+    context->ClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC) load(userptr, "glClearBufferuiv");
+    context->ColorMaski = (PFNGLCOLORMASKIPROC) load(userptr, "glColorMaski");
+    context->DeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) load(userptr, "glDeleteFramebuffers");
+    context->DeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) load(userptr, "glDeleteRenderbuffers");
+    context->DeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC) load(userptr, "glDeleteVertexArrays");
+    context->Disablei = (PFNGLDISABLEIPROC) load(userptr, "glDisablei");
+    context->Enablei = (PFNGLENABLEIPROC) load(userptr, "glEnablei");
+    context->EndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC) load(userptr, "glEndConditionalRender");
+    context->EndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC) load(userptr, "glEndTransformFeedback");
+    context->FlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) load(userptr, "glFlushMappedBufferRange");
+    context->FramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) load(userptr, "glFramebufferRenderbuffer");
+    context->FramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC) load(userptr, "glFramebufferTexture1D");
+    context->FramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) load(userptr, "glFramebufferTexture2D");
+    context->FramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC) load(userptr, "glFramebufferTexture3D");
+    context->FramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) load(userptr, "glFramebufferTextureLayer");
+    context->GenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) load(userptr, "glGenFramebuffers");
+    context->GenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) load(userptr, "glGenRenderbuffers");
+    context->GenVertexArrays = (PFNGLGENVERTEXARRAYSPROC) load(userptr, "glGenVertexArrays");
+    context->GenerateMipmap = (PFNGLGENERATEMIPMAPPROC) load(userptr, "glGenerateMipmap");
+    context->GetBooleani_v = (PFNGLGETBOOLEANI_VPROC) load(userptr, "glGetBooleani_v");
+    context->GetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC) load(userptr, "glGetFragDataLocation");
+    context->GetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) load(userptr, "glGetFramebufferAttachmentParameteriv");
+    context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC) load(userptr, "glGetIntegeri_v");
+    context->GetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) load(userptr, "glGetRenderbufferParameteriv");
+    context->GetStringi = (PFNGLGETSTRINGIPROC) load(userptr, "glGetStringi");
+    context->GetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC) load(userptr, "glGetTexParameterIiv");
+    context->GetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC) load(userptr, "glGetTexParameterIuiv");
+    context->GetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) load(userptr, "glGetTransformFeedbackVarying");
+    context->GetUniformuiv = (PFNGLGETUNIFORMUIVPROC) load(userptr, "glGetUniformuiv");
+    context->GetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC) load(userptr, "glGetVertexAttribIiv");
+    context->GetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC) load(userptr, "glGetVertexAttribIuiv");
+    context->IsEnabledi = (PFNGLISENABLEDIPROC) load(userptr, "glIsEnabledi");
+    context->IsFramebuffer = (PFNGLISFRAMEBUFFERPROC) load(userptr, "glIsFramebuffer");
+    context->IsRenderbuffer = (PFNGLISRENDERBUFFERPROC) load(userptr, "glIsRenderbuffer");
+    context->IsVertexArray = (PFNGLISVERTEXARRAYPROC) load(userptr, "glIsVertexArray");
+    context->MapBufferRange = (PFNGLMAPBUFFERRANGEPROC) load(userptr, "glMapBufferRange");
+    context->RenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) load(userptr, "glRenderbufferStorage");
+    context->RenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) load(userptr, "glRenderbufferStorageMultisample");
+    context->TexParameterIiv = (PFNGLTEXPARAMETERIIVPROC) load(userptr, "glTexParameterIiv");
+    context->TexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC) load(userptr, "glTexParameterIuiv");
+    context->TransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) load(userptr, "glTransformFeedbackVaryings");
+    context->Uniform1ui = (PFNGLUNIFORM1UIPROC) load(userptr, "glUniform1ui");
+    context->Uniform1uiv = (PFNGLUNIFORM1UIVPROC) load(userptr, "glUniform1uiv");
+    context->Uniform2ui = (PFNGLUNIFORM2UIPROC) load(userptr, "glUniform2ui");
+    context->Uniform2uiv = (PFNGLUNIFORM2UIVPROC) load(userptr, "glUniform2uiv");
+    context->Uniform3ui = (PFNGLUNIFORM3UIPROC) load(userptr, "glUniform3ui");
+    context->Uniform3uiv = (PFNGLUNIFORM3UIVPROC) load(userptr, "glUniform3uiv");
+    context->Uniform4ui = (PFNGLUNIFORM4UIPROC) load(userptr, "glUniform4ui");
+    context->Uniform4uiv = (PFNGLUNIFORM4UIVPROC) load(userptr, "glUniform4uiv");
+    context->VertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC) load(userptr, "glVertexAttribI1i");
+    context->VertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC) load(userptr, "glVertexAttribI1iv");
+    context->VertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC) load(userptr, "glVertexAttribI1ui");
+    context->VertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC) load(userptr, "glVertexAttribI1uiv");
+    context->VertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC) load(userptr, "glVertexAttribI2i");
+    context->VertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC) load(userptr, "glVertexAttribI2iv");
+    context->VertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC) load(userptr, "glVertexAttribI2ui");
+    context->VertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC) load(userptr, "glVertexAttribI2uiv");
+    context->VertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC) load(userptr, "glVertexAttribI3i");
+    context->VertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC) load(userptr, "glVertexAttribI3iv");
+    context->VertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC) load(userptr, "glVertexAttribI3ui");
+    context->VertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC) load(userptr, "glVertexAttribI3uiv");
+    context->VertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC) load(userptr, "glVertexAttribI4bv");
+    context->VertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC) load(userptr, "glVertexAttribI4i");
+    context->VertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC) load(userptr, "glVertexAttribI4iv");
+    context->VertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC) load(userptr, "glVertexAttribI4sv");
+    context->VertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC) load(userptr, "glVertexAttribI4ubv");
+    context->VertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC) load(userptr, "glVertexAttribI4ui");
+    context->VertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC) load(userptr, "glVertexAttribI4uiv");
+    context->VertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC) load(userptr, "glVertexAttribI4usv");
+    context->VertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC) load(userptr, "glVertexAttribIPointer");
+}
+static void glad_gl_load_GL_VERSION_3_1_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_3_1) return;
+    context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC) load(userptr, "glBindBufferBase");
+    context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC) load(userptr, "glBindBufferRange");
+    context->CopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC) load(userptr, "glCopyBufferSubData");
+    context->DrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) load(userptr, "glDrawArraysInstanced");
+    context->DrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC) load(userptr, "glDrawElementsInstanced");
+    context->GetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) load(userptr, "glGetActiveUniformBlockName");
+    context->GetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) load(userptr, "glGetActiveUniformBlockiv");
+    context->GetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC) load(userptr, "glGetActiveUniformName");
+    context->GetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC) load(userptr, "glGetActiveUniformsiv");
+    context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC) load(userptr, "glGetIntegeri_v");
+    context->GetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) load(userptr, "glGetUniformBlockIndex");
+    context->GetUniformIndices = (PFNGLGETUNIFORMINDICESPROC) load(userptr, "glGetUniformIndices");
+    context->PrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC) load(userptr, "glPrimitiveRestartIndex");
+    context->TexBuffer = (PFNGLTEXBUFFERPROC) load(userptr, "glTexBuffer");
+    context->UniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) load(userptr, "glUniformBlockBinding");
+}
+static void glad_gl_load_GL_VERSION_3_2_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_3_2) return;
+    context->ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) load(userptr, "glClientWaitSync");
+    context->DeleteSync = (PFNGLDELETESYNCPROC) load(userptr, "glDeleteSync");
+    context->DrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC) load(userptr, "glDrawElementsBaseVertex");
+    context->DrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) load(userptr, "glDrawElementsInstancedBaseVertex");
+    context->DrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) load(userptr, "glDrawRangeElementsBaseVertex");
+    context->FenceSync = (PFNGLFENCESYNCPROC) load(userptr, "glFenceSync");
+    context->FramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC) load(userptr, "glFramebufferTexture");
+    context->GetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC) load(userptr, "glGetBufferParameteri64v");
+    context->GetInteger64i_v = (PFNGLGETINTEGER64I_VPROC) load(userptr, "glGetInteger64i_v");
+    context->GetInteger64v = (PFNGLGETINTEGER64VPROC) load(userptr, "glGetInteger64v");
+    context->GetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC) load(userptr, "glGetMultisamplefv");
+    context->GetSynciv = (PFNGLGETSYNCIVPROC) load(userptr, "glGetSynciv");
+    context->IsSync = (PFNGLISSYNCPROC) load(userptr, "glIsSync");
+    context->MultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) load(userptr, "glMultiDrawElementsBaseVertex");
+    context->ProvokingVertex = (PFNGLPROVOKINGVERTEXPROC) load(userptr, "glProvokingVertex");
+    context->SampleMaski = (PFNGLSAMPLEMASKIPROC) load(userptr, "glSampleMaski");
+    context->TexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) load(userptr, "glTexImage2DMultisample");
+    context->TexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) load(userptr, "glTexImage3DMultisample");
+    context->WaitSync = (PFNGLWAITSYNCPROC) load(userptr, "glWaitSync");
+}
+static void glad_gl_load_GL_VERSION_3_3_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_3_3) return;
+    context->BindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) load(userptr, "glBindFragDataLocationIndexed");
+    context->BindSampler = (PFNGLBINDSAMPLERPROC) load(userptr, "glBindSampler");
+    context->DeleteSamplers = (PFNGLDELETESAMPLERSPROC) load(userptr, "glDeleteSamplers");
+    context->GenSamplers = (PFNGLGENSAMPLERSPROC) load(userptr, "glGenSamplers");
+    context->GetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC) load(userptr, "glGetFragDataIndex");
+    context->GetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC) load(userptr, "glGetQueryObjecti64v");
+    context->GetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) load(userptr, "glGetQueryObjectui64v");
+    context->GetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC) load(userptr, "glGetSamplerParameterIiv");
+    context->GetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC) load(userptr, "glGetSamplerParameterIuiv");
+    context->GetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC) load(userptr, "glGetSamplerParameterfv");
+    context->GetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC) load(userptr, "glGetSamplerParameteriv");
+    context->IsSampler = (PFNGLISSAMPLERPROC) load(userptr, "glIsSampler");
+    context->QueryCounter = (PFNGLQUERYCOUNTERPROC) load(userptr, "glQueryCounter");
+    context->SamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC) load(userptr, "glSamplerParameterIiv");
+    context->SamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC) load(userptr, "glSamplerParameterIuiv");
+    context->SamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC) load(userptr, "glSamplerParameterf");
+    context->SamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC) load(userptr, "glSamplerParameterfv");
+    context->SamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC) load(userptr, "glSamplerParameteri");
+    context->SamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC) load(userptr, "glSamplerParameteriv");
+    context->VertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC) load(userptr, "glVertexAttribDivisor");
+    context->VertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC) load(userptr, "glVertexAttribP1ui");
+    context->VertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC) load(userptr, "glVertexAttribP1uiv");
+    context->VertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC) load(userptr, "glVertexAttribP2ui");
+    context->VertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC) load(userptr, "glVertexAttribP2uiv");
+    context->VertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC) load(userptr, "glVertexAttribP3ui");
+    context->VertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC) load(userptr, "glVertexAttribP3uiv");
+    context->VertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC) load(userptr, "glVertexAttribP4ui");
+    context->VertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC) load(userptr, "glVertexAttribP4uiv");
+}
+static void glad_gl_load_GL_VERSION_4_0_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_4_0) return;
+    context->BeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC) load(userptr, "glBeginQueryIndexed");
+    context->BindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC) load(userptr, "glBindTransformFeedback");
+    context->BlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC) load(userptr, "glBlendEquationSeparatei");
+    context->BlendEquationi = (PFNGLBLENDEQUATIONIPROC) load(userptr, "glBlendEquationi");
+    context->BlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC) load(userptr, "glBlendFuncSeparatei");
+    context->BlendFunci = (PFNGLBLENDFUNCIPROC) load(userptr, "glBlendFunci");
+    context->DeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC) load(userptr, "glDeleteTransformFeedbacks");
+    context->DrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC) load(userptr, "glDrawArraysIndirect");
+    context->DrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC) load(userptr, "glDrawElementsIndirect");
+    context->DrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC) load(userptr, "glDrawTransformFeedback");
+    context->DrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) load(userptr, "glDrawTransformFeedbackStream");
+    context->EndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC) load(userptr, "glEndQueryIndexed");
+    context->GenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC) load(userptr, "glGenTransformFeedbacks");
+    context->GetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC) load(userptr, "glGetActiveSubroutineName");
+    context->GetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) load(userptr, "glGetActiveSubroutineUniformName");
+    context->GetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) load(userptr, "glGetActiveSubroutineUniformiv");
+    context->GetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC) load(userptr, "glGetProgramStageiv");
+    context->GetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC) load(userptr, "glGetQueryIndexediv");
+    context->GetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC) load(userptr, "glGetSubroutineIndex");
+    context->GetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) load(userptr, "glGetSubroutineUniformLocation");
+    context->GetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) load(userptr, "glGetUniformSubroutineuiv");
+    context->GetUniformdv = (PFNGLGETUNIFORMDVPROC) load(userptr, "glGetUniformdv");
+    context->IsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC) load(userptr, "glIsTransformFeedback");
+    context->MinSampleShading = (PFNGLMINSAMPLESHADINGPROC) load(userptr, "glMinSampleShading");
+    context->PatchParameterfv = (PFNGLPATCHPARAMETERFVPROC) load(userptr, "glPatchParameterfv");
+    context->PatchParameteri = (PFNGLPATCHPARAMETERIPROC) load(userptr, "glPatchParameteri");
+    context->PauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC) load(userptr, "glPauseTransformFeedback");
+    context->ResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC) load(userptr, "glResumeTransformFeedback");
+    context->Uniform1d = (PFNGLUNIFORM1DPROC) load(userptr, "glUniform1d");
+    context->Uniform1dv = (PFNGLUNIFORM1DVPROC) load(userptr, "glUniform1dv");
+    context->Uniform2d = (PFNGLUNIFORM2DPROC) load(userptr, "glUniform2d");
+    context->Uniform2dv = (PFNGLUNIFORM2DVPROC) load(userptr, "glUniform2dv");
+    context->Uniform3d = (PFNGLUNIFORM3DPROC) load(userptr, "glUniform3d");
+    context->Uniform3dv = (PFNGLUNIFORM3DVPROC) load(userptr, "glUniform3dv");
+    context->Uniform4d = (PFNGLUNIFORM4DPROC) load(userptr, "glUniform4d");
+    context->Uniform4dv = (PFNGLUNIFORM4DVPROC) load(userptr, "glUniform4dv");
+    context->UniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC) load(userptr, "glUniformMatrix2dv");
+    context->UniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC) load(userptr, "glUniformMatrix2x3dv");
+    context->UniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC) load(userptr, "glUniformMatrix2x4dv");
+    context->UniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC) load(userptr, "glUniformMatrix3dv");
+    context->UniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC) load(userptr, "glUniformMatrix3x2dv");
+    context->UniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC) load(userptr, "glUniformMatrix3x4dv");
+    context->UniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC) load(userptr, "glUniformMatrix4dv");
+    context->UniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC) load(userptr, "glUniformMatrix4x2dv");
+    context->UniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC) load(userptr, "glUniformMatrix4x3dv");
+    context->UniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC) load(userptr, "glUniformSubroutinesuiv");
+}
+static void glad_gl_load_GL_VERSION_4_1_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_4_1) return;
+    context->ActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC) load(userptr, "glActiveShaderProgram");
+    context->BindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC) load(userptr, "glBindProgramPipeline");
+    context->ClearDepthf = (PFNGLCLEARDEPTHFPROC) load(userptr, "glClearDepthf");
+    context->CreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC) load(userptr, "glCreateShaderProgramv");
+    context->DeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC) load(userptr, "glDeleteProgramPipelines");
+    context->DepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC) load(userptr, "glDepthRangeArrayv");
+    context->DepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC) load(userptr, "glDepthRangeIndexed");
+    context->DepthRangef = (PFNGLDEPTHRANGEFPROC) load(userptr, "glDepthRangef");
+    context->GenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC) load(userptr, "glGenProgramPipelines");
+    context->GetDoublei_v = (PFNGLGETDOUBLEI_VPROC) load(userptr, "glGetDoublei_v");
+    context->GetFloati_v = (PFNGLGETFLOATI_VPROC) load(userptr, "glGetFloati_v");
+    context->GetProgramBinary = (PFNGLGETPROGRAMBINARYPROC) load(userptr, "glGetProgramBinary");
+    context->GetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) load(userptr, "glGetProgramPipelineInfoLog");
+    context->GetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC) load(userptr, "glGetProgramPipelineiv");
+    context->GetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC) load(userptr, "glGetShaderPrecisionFormat");
+    context->GetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC) load(userptr, "glGetVertexAttribLdv");
+    context->IsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC) load(userptr, "glIsProgramPipeline");
+    context->ProgramBinary = (PFNGLPROGRAMBINARYPROC) load(userptr, "glProgramBinary");
+    context->ProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC) load(userptr, "glProgramParameteri");
+    context->ProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC) load(userptr, "glProgramUniform1d");
+    context->ProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC) load(userptr, "glProgramUniform1dv");
+    context->ProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC) load(userptr, "glProgramUniform1f");
+    context->ProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC) load(userptr, "glProgramUniform1fv");
+    context->ProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC) load(userptr, "glProgramUniform1i");
+    context->ProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC) load(userptr, "glProgramUniform1iv");
+    context->ProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC) load(userptr, "glProgramUniform1ui");
+    context->ProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC) load(userptr, "glProgramUniform1uiv");
+    context->ProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC) load(userptr, "glProgramUniform2d");
+    context->ProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC) load(userptr, "glProgramUniform2dv");
+    context->ProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC) load(userptr, "glProgramUniform2f");
+    context->ProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC) load(userptr, "glProgramUniform2fv");
+    context->ProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC) load(userptr, "glProgramUniform2i");
+    context->ProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC) load(userptr, "glProgramUniform2iv");
+    context->ProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC) load(userptr, "glProgramUniform2ui");
+    context->ProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC) load(userptr, "glProgramUniform2uiv");
+    context->ProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC) load(userptr, "glProgramUniform3d");
+    context->ProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC) load(userptr, "glProgramUniform3dv");
+    context->ProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC) load(userptr, "glProgramUniform3f");
+    context->ProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC) load(userptr, "glProgramUniform3fv");
+    context->ProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC) load(userptr, "glProgramUniform3i");
+    context->ProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC) load(userptr, "glProgramUniform3iv");
+    context->ProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC) load(userptr, "glProgramUniform3ui");
+    context->ProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC) load(userptr, "glProgramUniform3uiv");
+    context->ProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC) load(userptr, "glProgramUniform4d");
+    context->ProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC) load(userptr, "glProgramUniform4dv");
+    context->ProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC) load(userptr, "glProgramUniform4f");
+    context->ProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC) load(userptr, "glProgramUniform4fv");
+    context->ProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC) load(userptr, "glProgramUniform4i");
+    context->ProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC) load(userptr, "glProgramUniform4iv");
+    context->ProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC) load(userptr, "glProgramUniform4ui");
+    context->ProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC) load(userptr, "glProgramUniform4uiv");
+    context->ProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) load(userptr, "glProgramUniformMatrix2dv");
+    context->ProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) load(userptr, "glProgramUniformMatrix2fv");
+    context->ProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) load(userptr, "glProgramUniformMatrix2x3dv");
+    context->ProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) load(userptr, "glProgramUniformMatrix2x3fv");
+    context->ProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) load(userptr, "glProgramUniformMatrix2x4dv");
+    context->ProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) load(userptr, "glProgramUniformMatrix2x4fv");
+    context->ProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) load(userptr, "glProgramUniformMatrix3dv");
+    context->ProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) load(userptr, "glProgramUniformMatrix3fv");
+    context->ProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) load(userptr, "glProgramUniformMatrix3x2dv");
+    context->ProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) load(userptr, "glProgramUniformMatrix3x2fv");
+    context->ProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) load(userptr, "glProgramUniformMatrix3x4dv");
+    context->ProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) load(userptr, "glProgramUniformMatrix3x4fv");
+    context->ProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) load(userptr, "glProgramUniformMatrix4dv");
+    context->ProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) load(userptr, "glProgramUniformMatrix4fv");
+    context->ProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) load(userptr, "glProgramUniformMatrix4x2dv");
+    context->ProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) load(userptr, "glProgramUniformMatrix4x2fv");
+    context->ProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) load(userptr, "glProgramUniformMatrix4x3dv");
+    context->ProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) load(userptr, "glProgramUniformMatrix4x3fv");
+    context->ReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC) load(userptr, "glReleaseShaderCompiler");
+    context->ScissorArrayv = (PFNGLSCISSORARRAYVPROC) load(userptr, "glScissorArrayv");
+    context->ScissorIndexed = (PFNGLSCISSORINDEXEDPROC) load(userptr, "glScissorIndexed");
+    context->ScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC) load(userptr, "glScissorIndexedv");
+    context->ShaderBinary = (PFNGLSHADERBINARYPROC) load(userptr, "glShaderBinary");
+    context->UseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC) load(userptr, "glUseProgramStages");
+    context->ValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC) load(userptr, "glValidateProgramPipeline");
+    context->VertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC) load(userptr, "glVertexAttribL1d");
+    context->VertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC) load(userptr, "glVertexAttribL1dv");
+    context->VertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC) load(userptr, "glVertexAttribL2d");
+    context->VertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC) load(userptr, "glVertexAttribL2dv");
+    context->VertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC) load(userptr, "glVertexAttribL3d");
+    context->VertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC) load(userptr, "glVertexAttribL3dv");
+    context->VertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC) load(userptr, "glVertexAttribL4d");
+    context->VertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC) load(userptr, "glVertexAttribL4dv");
+    context->VertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC) load(userptr, "glVertexAttribLPointer");
+    context->ViewportArrayv = (PFNGLVIEWPORTARRAYVPROC) load(userptr, "glViewportArrayv");
+    context->ViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC) load(userptr, "glViewportIndexedf");
+    context->ViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC) load(userptr, "glViewportIndexedfv");
+}
+static void glad_gl_load_GL_VERSION_4_2_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_4_2) return;
+    context->BindImageTexture = (PFNGLBINDIMAGETEXTUREPROC) load(userptr, "glBindImageTexture");
+    context->DrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) load(userptr, "glDrawArraysInstancedBaseInstance");
+    context->DrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) load(userptr, "glDrawElementsInstancedBaseInstance");
+    context->DrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) load(userptr, "glDrawElementsInstancedBaseVertexBaseInstance");
+    context->DrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) load(userptr, "glDrawTransformFeedbackInstanced");
+    context->DrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) load(userptr, "glDrawTransformFeedbackStreamInstanced");
+    context->GetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) load(userptr, "glGetActiveAtomicCounterBufferiv");
+    context->GetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC) load(userptr, "glGetInternalformativ");
+    context->MemoryBarrier = (PFNGLMEMORYBARRIERPROC) load(userptr, "glMemoryBarrier");
+    context->TexStorage1D = (PFNGLTEXSTORAGE1DPROC) load(userptr, "glTexStorage1D");
+    context->TexStorage2D = (PFNGLTEXSTORAGE2DPROC) load(userptr, "glTexStorage2D");
+    context->TexStorage3D = (PFNGLTEXSTORAGE3DPROC) load(userptr, "glTexStorage3D");
+}
+static void glad_gl_load_GL_VERSION_4_3_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_4_3) return;
+    context->BindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC) load(userptr, "glBindVertexBuffer");
+    context->ClearBufferData = (PFNGLCLEARBUFFERDATAPROC) load(userptr, "glClearBufferData");
+    context->ClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC) load(userptr, "glClearBufferSubData");
+    context->CopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC) load(userptr, "glCopyImageSubData");
+    context->DebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC) load(userptr, "glDebugMessageCallback");
+    context->DebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC) load(userptr, "glDebugMessageControl");
+    context->DebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC) load(userptr, "glDebugMessageInsert");
+    context->DispatchCompute = (PFNGLDISPATCHCOMPUTEPROC) load(userptr, "glDispatchCompute");
+    context->DispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC) load(userptr, "glDispatchComputeIndirect");
+    context->FramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC) load(userptr, "glFramebufferParameteri");
+    context->GetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC) load(userptr, "glGetDebugMessageLog");
+    context->GetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) load(userptr, "glGetFramebufferParameteriv");
+    context->GetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC) load(userptr, "glGetInternalformati64v");
+    context->GetObjectLabel = (PFNGLGETOBJECTLABELPROC) load(userptr, "glGetObjectLabel");
+    context->GetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC) load(userptr, "glGetObjectPtrLabel");
+    context->GetPointerv = (PFNGLGETPOINTERVPROC) load(userptr, "glGetPointerv");
+    context->GetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC) load(userptr, "glGetProgramInterfaceiv");
+    context->GetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC) load(userptr, "glGetProgramResourceIndex");
+    context->GetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC) load(userptr, "glGetProgramResourceLocation");
+    context->GetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) load(userptr, "glGetProgramResourceLocationIndex");
+    context->GetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC) load(userptr, "glGetProgramResourceName");
+    context->GetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC) load(userptr, "glGetProgramResourceiv");
+    context->InvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC) load(userptr, "glInvalidateBufferData");
+    context->InvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC) load(userptr, "glInvalidateBufferSubData");
+    context->InvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC) load(userptr, "glInvalidateFramebuffer");
+    context->InvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC) load(userptr, "glInvalidateSubFramebuffer");
+    context->InvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC) load(userptr, "glInvalidateTexImage");
+    context->InvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC) load(userptr, "glInvalidateTexSubImage");
+    context->MultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) load(userptr, "glMultiDrawArraysIndirect");
+    context->MultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) load(userptr, "glMultiDrawElementsIndirect");
+    context->ObjectLabel = (PFNGLOBJECTLABELPROC) load(userptr, "glObjectLabel");
+    context->ObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC) load(userptr, "glObjectPtrLabel");
+    context->PopDebugGroup = (PFNGLPOPDEBUGGROUPPROC) load(userptr, "glPopDebugGroup");
+    context->PushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC) load(userptr, "glPushDebugGroup");
+    context->ShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) load(userptr, "glShaderStorageBlockBinding");
+    context->TexBufferRange = (PFNGLTEXBUFFERRANGEPROC) load(userptr, "glTexBufferRange");
+    context->TexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) load(userptr, "glTexStorage2DMultisample");
+    context->TexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) load(userptr, "glTexStorage3DMultisample");
+    context->TextureView = (PFNGLTEXTUREVIEWPROC) load(userptr, "glTextureView");
+    context->VertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC) load(userptr, "glVertexAttribBinding");
+    context->VertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC) load(userptr, "glVertexAttribFormat");
+    context->VertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC) load(userptr, "glVertexAttribIFormat");
+    context->VertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC) load(userptr, "glVertexAttribLFormat");
+    context->VertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC) load(userptr, "glVertexBindingDivisor");
+}
+static void glad_gl_load_GL_VERSION_4_4_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_4_4) return;
+    context->BindBuffersBase = (PFNGLBINDBUFFERSBASEPROC) load(userptr, "glBindBuffersBase");
+    context->BindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC) load(userptr, "glBindBuffersRange");
+    context->BindImageTextures = (PFNGLBINDIMAGETEXTURESPROC) load(userptr, "glBindImageTextures");
+    context->BindSamplers = (PFNGLBINDSAMPLERSPROC) load(userptr, "glBindSamplers");
+    context->BindTextures = (PFNGLBINDTEXTURESPROC) load(userptr, "glBindTextures");
+    context->BindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC) load(userptr, "glBindVertexBuffers");
+    context->BufferStorage = (PFNGLBUFFERSTORAGEPROC) load(userptr, "glBufferStorage");
+    context->ClearTexImage = (PFNGLCLEARTEXIMAGEPROC) load(userptr, "glClearTexImage");
+    context->ClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC) load(userptr, "glClearTexSubImage");
+}
+static void glad_gl_load_GL_VERSION_4_5_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_4_5) return;
+    context->BindTextureUnit = (PFNGLBINDTEXTUREUNITPROC) load(userptr, "glBindTextureUnit");
+    context->BlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC) load(userptr, "glBlitNamedFramebuffer");
+    context->CheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) load(userptr, "glCheckNamedFramebufferStatus");
+    context->ClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC) load(userptr, "glClearNamedBufferData");
+    context->ClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) load(userptr, "glClearNamedBufferSubData");
+    context->ClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) load(userptr, "glClearNamedFramebufferfi");
+    context->ClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) load(userptr, "glClearNamedFramebufferfv");
+    context->ClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) load(userptr, "glClearNamedFramebufferiv");
+    context->ClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) load(userptr, "glClearNamedFramebufferuiv");
+    context->ClipControl = (PFNGLCLIPCONTROLPROC) load(userptr, "glClipControl");
+    context->CompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) load(userptr, "glCompressedTextureSubImage1D");
+    context->CompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) load(userptr, "glCompressedTextureSubImage2D");
+    context->CompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) load(userptr, "glCompressedTextureSubImage3D");
+    context->CopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) load(userptr, "glCopyNamedBufferSubData");
+    context->CopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC) load(userptr, "glCopyTextureSubImage1D");
+    context->CopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC) load(userptr, "glCopyTextureSubImage2D");
+    context->CopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC) load(userptr, "glCopyTextureSubImage3D");
+    context->CreateBuffers = (PFNGLCREATEBUFFERSPROC) load(userptr, "glCreateBuffers");
+    context->CreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC) load(userptr, "glCreateFramebuffers");
+    context->CreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC) load(userptr, "glCreateProgramPipelines");
+    context->CreateQueries = (PFNGLCREATEQUERIESPROC) load(userptr, "glCreateQueries");
+    context->CreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC) load(userptr, "glCreateRenderbuffers");
+    context->CreateSamplers = (PFNGLCREATESAMPLERSPROC) load(userptr, "glCreateSamplers");
+    context->CreateTextures = (PFNGLCREATETEXTURESPROC) load(userptr, "glCreateTextures");
+    context->CreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC) load(userptr, "glCreateTransformFeedbacks");
+    context->CreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC) load(userptr, "glCreateVertexArrays");
+    context->DisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC) load(userptr, "glDisableVertexArrayAttrib");
+    context->EnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC) load(userptr, "glEnableVertexArrayAttrib");
+    context->FlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) load(userptr, "glFlushMappedNamedBufferRange");
+    context->GenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC) load(userptr, "glGenerateTextureMipmap");
+    context->GetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) load(userptr, "glGetCompressedTextureImage");
+    context->GetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) load(userptr, "glGetCompressedTextureSubImage");
+    context->GetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC) load(userptr, "glGetGraphicsResetStatus");
+    context->GetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) load(userptr, "glGetNamedBufferParameteri64v");
+    context->GetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) load(userptr, "glGetNamedBufferParameteriv");
+    context->GetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC) load(userptr, "glGetNamedBufferPointerv");
+    context->GetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC) load(userptr, "glGetNamedBufferSubData");
+    context->GetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) load(userptr, "glGetNamedFramebufferAttachmentParameteriv");
+    context->GetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) load(userptr, "glGetNamedFramebufferParameteriv");
+    context->GetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) load(userptr, "glGetNamedRenderbufferParameteriv");
+    context->GetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC) load(userptr, "glGetQueryBufferObjecti64v");
+    context->GetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC) load(userptr, "glGetQueryBufferObjectiv");
+    context->GetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) load(userptr, "glGetQueryBufferObjectui64v");
+    context->GetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC) load(userptr, "glGetQueryBufferObjectuiv");
+    context->GetTextureImage = (PFNGLGETTEXTUREIMAGEPROC) load(userptr, "glGetTextureImage");
+    context->GetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC) load(userptr, "glGetTextureLevelParameterfv");
+    context->GetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC) load(userptr, "glGetTextureLevelParameteriv");
+    context->GetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC) load(userptr, "glGetTextureParameterIiv");
+    context->GetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC) load(userptr, "glGetTextureParameterIuiv");
+    context->GetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC) load(userptr, "glGetTextureParameterfv");
+    context->GetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC) load(userptr, "glGetTextureParameteriv");
+    context->GetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC) load(userptr, "glGetTextureSubImage");
+    context->GetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) load(userptr, "glGetTransformFeedbacki64_v");
+    context->GetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC) load(userptr, "glGetTransformFeedbacki_v");
+    context->GetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC) load(userptr, "glGetTransformFeedbackiv");
+    context->GetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC) load(userptr, "glGetVertexArrayIndexed64iv");
+    context->GetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC) load(userptr, "glGetVertexArrayIndexediv");
+    context->GetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC) load(userptr, "glGetVertexArrayiv");
+    context->GetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) load(userptr, "glGetnCompressedTexImage");
+    context->GetnTexImage = (PFNGLGETNTEXIMAGEPROC) load(userptr, "glGetnTexImage");
+    context->GetnUniformdv = (PFNGLGETNUNIFORMDVPROC) load(userptr, "glGetnUniformdv");
+    context->GetnUniformfv = (PFNGLGETNUNIFORMFVPROC) load(userptr, "glGetnUniformfv");
+    context->GetnUniformiv = (PFNGLGETNUNIFORMIVPROC) load(userptr, "glGetnUniformiv");
+    context->GetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC) load(userptr, "glGetnUniformuiv");
+    context->InvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) load(userptr, "glInvalidateNamedFramebufferData");
+    context->InvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) load(userptr, "glInvalidateNamedFramebufferSubData");
+    context->MapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC) load(userptr, "glMapNamedBuffer");
+    context->MapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC) load(userptr, "glMapNamedBufferRange");
+    context->MemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC) load(userptr, "glMemoryBarrierByRegion");
+    context->NamedBufferData = (PFNGLNAMEDBUFFERDATAPROC) load(userptr, "glNamedBufferData");
+    context->NamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC) load(userptr, "glNamedBufferStorage");
+    context->NamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC) load(userptr, "glNamedBufferSubData");
+    context->NamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) load(userptr, "glNamedFramebufferDrawBuffer");
+    context->NamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) load(userptr, "glNamedFramebufferDrawBuffers");
+    context->NamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) load(userptr, "glNamedFramebufferParameteri");
+    context->NamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) load(userptr, "glNamedFramebufferReadBuffer");
+    context->NamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) load(userptr, "glNamedFramebufferRenderbuffer");
+    context->NamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) load(userptr, "glNamedFramebufferTexture");
+    context->NamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) load(userptr, "glNamedFramebufferTextureLayer");
+    context->NamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) load(userptr, "glNamedRenderbufferStorage");
+    context->NamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) load(userptr, "glNamedRenderbufferStorageMultisample");
+    context->ReadnPixels = (PFNGLREADNPIXELSPROC) load(userptr, "glReadnPixels");
+    context->TextureBarrier = (PFNGLTEXTUREBARRIERPROC) load(userptr, "glTextureBarrier");
+    context->TextureBuffer = (PFNGLTEXTUREBUFFERPROC) load(userptr, "glTextureBuffer");
+    context->TextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC) load(userptr, "glTextureBufferRange");
+    context->TextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC) load(userptr, "glTextureParameterIiv");
+    context->TextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC) load(userptr, "glTextureParameterIuiv");
+    context->TextureParameterf = (PFNGLTEXTUREPARAMETERFPROC) load(userptr, "glTextureParameterf");
+    context->TextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC) load(userptr, "glTextureParameterfv");
+    context->TextureParameteri = (PFNGLTEXTUREPARAMETERIPROC) load(userptr, "glTextureParameteri");
+    context->TextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC) load(userptr, "glTextureParameteriv");
+    context->TextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC) load(userptr, "glTextureStorage1D");
+    context->TextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC) load(userptr, "glTextureStorage2D");
+    context->TextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) load(userptr, "glTextureStorage2DMultisample");
+    context->TextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC) load(userptr, "glTextureStorage3D");
+    context->TextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) load(userptr, "glTextureStorage3DMultisample");
+    context->TextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC) load(userptr, "glTextureSubImage1D");
+    context->TextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC) load(userptr, "glTextureSubImage2D");
+    context->TextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC) load(userptr, "glTextureSubImage3D");
+    context->TransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) load(userptr, "glTransformFeedbackBufferBase");
+    context->TransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) load(userptr, "glTransformFeedbackBufferRange");
+    context->UnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC) load(userptr, "glUnmapNamedBuffer");
+    context->VertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC) load(userptr, "glVertexArrayAttribBinding");
+    context->VertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC) load(userptr, "glVertexArrayAttribFormat");
+    context->VertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC) load(userptr, "glVertexArrayAttribIFormat");
+    context->VertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC) load(userptr, "glVertexArrayAttribLFormat");
+    context->VertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC) load(userptr, "glVertexArrayBindingDivisor");
+    context->VertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC) load(userptr, "glVertexArrayElementBuffer");
+    context->VertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC) load(userptr, "glVertexArrayVertexBuffer");
+    context->VertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) load(userptr, "glVertexArrayVertexBuffers");
+}
+static void glad_gl_load_GL_VERSION_4_6_context( GladGLContext *context, GLADuserptrloadfunc load, void* userptr) {
+    if(!context->VERSION_4_6) return;
+    context->MultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC) load(userptr, "glMultiDrawArraysIndirectCount");
+    context->MultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC) load(userptr, "glMultiDrawElementsIndirectCount");
+    context->PolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC) load(userptr, "glPolygonOffsetClamp");
+    context->SpecializeShader = (PFNGLSPECIALIZESHADERPROC) load(userptr, "glSpecializeShader");
+}
+
+
+
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
 #define GLAD_GL_IS_SOME_NEW_VERSION 1
 #else
 #define GLAD_GL_IS_SOME_NEW_VERSION 0
 #endif
 
-static int glad_gl_get_extensions( int version, const char **out_exts, unsigned int *out_num_exts_i, char ***out_exts_i) {
-#if GLAD_GL_IS_SOME_NEW_VERSION
-    if(GLAD_VERSION_MAJOR(version) < 3) {
-#else
-    GLAD_UNUSED(version);
-    GLAD_UNUSED(out_num_exts_i);
-    GLAD_UNUSED(out_exts_i);
-#endif
-        if (glad_glGetString == NULL) {
-            return 0;
-        }
-        *out_exts = (const char *)glad_glGetString(GL_EXTENSIONS);
-#if GLAD_GL_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index = 0;
-        unsigned int num_exts_i = 0;
-        char **exts_i = NULL;
-        if (glad_glGetStringi == NULL || glad_glGetIntegerv == NULL) {
-            return 0;
-        }
-        glad_glGetIntegerv(GL_NUM_EXTENSIONS, (int*) &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **) malloc(num_exts_i * (sizeof *exts_i));
-        }
-        if (exts_i == NULL) {
-            return 0;
-        }
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*) glad_glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp) + 1;
-
-            char *local_str = (char*) malloc(len * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, len * sizeof(char));
-            }
-
-            exts_i[index] = local_str;
-        }
+/* Extension sets: open addressing on an FNV-1a hash, at most half full. Names point into the
+ * driver's strings (glGetStringi results, or the GL_EXTENSIONS string before GL 3.0, which
+ * stay valid while the context lives), so nothing is copied per name; the table is the only
+ * allocation and is reused by later loads. The global loader keeps its set here, a
+ * GladGLContext its own. */
+static GladGLExtensionSet glad_gl_extension_set = { NULL, 0, 0 };
 
-        *out_num_exts_i = num_exts_i;
-        *out_exts_i = exts_i;
+static unsigned int glad_gl_hash_extension(const char *name, unsigned int length) {
+    unsigned int hash = 2166136261u;
+    unsigned int index;
+    for(index = 0; index < length; index++) {
+        hash = (hash ^ (unsigned char) name[index]) * 16777619u;
     }
-#endif
-    return 1;
+    return hash;
 }
-static void glad_gl_free_extensions(char **exts_i, unsigned int num_exts_i) {
-    if (exts_i != NULL) {
-        unsigned int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((void *) (exts_i[index]));
+
+/* The slot holding name, or the empty slot where it would go */
+static unsigned int glad_gl_extension_slot(const GladGLExtensionSet *set, const char *name, unsigned int length, unsigned int hash) {
+    unsigned int mask = set->capacity - 1;
+    unsigned int slot = hash & mask;
+    while(set->entries[slot].name != NULL) {
+        const GladGLExtension *extension = &set->entries[slot];
+        if(extension->hash == hash && extension->length == length && memcmp(extension->name, name, length) == 0) {
+            break;
         }
-        free((void *)exts_i);
-        exts_i = NULL;
+        slot = (slot + 1) & mask;
     }
+    return slot;
 }
-static int glad_gl_has_extension(int version, const char *exts, unsigned int num_exts_i, char **exts_i, const char *ext) {
-    if(GLAD_VERSION_MAJOR(version) < 3 || !GLAD_GL_IS_SOME_NEW_VERSION) {
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+
+static int glad_gl_reserve_extensions(GladGLExtensionSet *set, unsigned int count) {
+    unsigned int capacity = 16;
+    while(capacity < 2 * count) {
+        capacity *= 2;
+    }
+    if(capacity > set->capacity) {
+        free(set->entries);
+        set->entries = (GladGLExtension *) malloc(capacity * sizeof *set->entries);
+        set->capacity = set->entries != NULL ? capacity : 0;
+        set->count = 0;
+        if(set->entries == NULL) {
             return 0;
         }
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-    } else {
-        unsigned int index;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-            if(strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
     }
-    return 0;
+    memset(set->entries, 0, set->capacity * sizeof *set->entries);
+    set->count = 0;
+    return 1;
+}
+
+static void glad_gl_add_extension(GladGLExtensionSet *set, const char *name, unsigned int length) {
+    unsigned int hash = glad_gl_hash_extension(name, length);
+    unsigned int slot = glad_gl_extension_slot(set, name, length, hash);
+    if(length == 0 || set->entries[slot].name != NULL) {
+        return;
+    }
+    set->entries[slot].name = name;
+    set->entries[slot].length = length;
+    set->entries[slot].hash = hash;
+    set->count++;
 }
 
 static GLADapiproc glad_gl_get_proc_from_userptr(void *userptr, const char* name) {
     return (GLAD_GNUC_EXTENSION (GLADapiproc (*)(const char *name)) userptr)(name);
 }
 
-static int glad_gl_find_extensions_gl( int version) {
-    const char *exts = NULL;
-    unsigned int num_exts_i = 0;
-    char **exts_i = NULL;
-    if (!glad_gl_get_extensions(version, &exts, &num_exts_i, &exts_i)) return 0;
-
-    GLAD_UNUSED(glad_gl_has_extension);
-
-    glad_gl_free_extensions(exts_i, num_exts_i);
-
+static int glad_gl_find_extensions(GladGLExtensionSet *set, int version, PFNGLGETSTRINGPROC get_string,
+                                   PFNGLGETSTRINGIPROC get_stringi, PFNGLGETINTEGERVPROC get_integerv) {
+    const char *exts;
+    const char *end;
+    unsigned int count = 1;
+#if GLAD_GL_IS_SOME_NEW_VERSION
+    if(GLAD_VERSION_MAJOR(version) >= 3) {
+        unsigned int index;
+        unsigned int num_exts_i = 0;
+        if (get_stringi == NULL || get_integerv == NULL) {
+            return 0;
+        }
+        get_integerv(GL_NUM_EXTENSIONS, (int*) &num_exts_i);
+        if (!glad_gl_reserve_extensions(set, num_exts_i)) return 0;
+        for(index = 0; index < num_exts_i; index++) {
+            exts = (const char*) get_stringi(GL_EXTENSIONS, index);
+            if(exts != NULL) {
+                glad_gl_add_extension(set, exts, (unsigned int) strlen(exts));
+            }
+        }
+        return 1;
+    }
+#else
+    GLAD_UNUSED(version);
+    GLAD_UNUSED(get_stringi);
+    GLAD_UNUSED(get_integerv);
+#endif
+    if (get_string == NULL) {
+        return 0;
+    }
+    exts = (const char *)get_string(GL_EXTENSIONS);
+    if(exts == NULL) {
+        return glad_gl_reserve_extensions(set, 0);
+    }
+    for(end = exts; *end != '\0'; end++) {
+        count += *end == ' ';
+    }
+    if (!glad_gl_reserve_extensions(set, count)) return 0;
+    while(*exts != '\0') {
+        for(end = exts; *end != ' ' && *end != '\0'; end++);
+        glad_gl_add_extension(set, exts, (unsigned int) (end - exts));
+        exts = *end == ' ' ? end + 1 : end;
+    }
     return 1;
 }
 
-static int glad_gl_find_core_gl(void) {
+static int glad_gl_get_version(PFNGLGETSTRINGPROC get_string) {
     int i;
     const char* version;
     const char* prefixes[] = {
@@ -1548,7 +5595,7 @@ static int glad_gl_find_core_gl(void) {
     };
     int major = 0;
     int minor = 0;
-    version = (const char*) glad_glGetString(GL_VERSION);
+    version = (const char*) get_string(GL_VERSION);
     if (!version) return 0;
     for (i = 0;  prefixes[i];  i++) {
         const size_t length = strlen(prefixes[i]);
@@ -1560,6 +5607,14 @@ static int glad_gl_find_core_gl(void) {
 
     GLAD_IMPL_UTIL_SSCANF(version, "%d.%d", &major, &minor);
 
+    return GLAD_MAKE_VERSION(major, minor);
+}
+
+static int glad_gl_find_core_gl(void) {
+    int version = glad_gl_get_version(glad_glGetString);
+    int major = GLAD_VERSION_MAJOR(version);
+    int minor = version % 10000;
+
     GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
     GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
     GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
@@ -1580,12 +5635,43 @@ static int glad_gl_find_core_gl(void) {
     GLAD_GL_VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
     GLAD_GL_VERSION_4_6 = (major == 4 && minor >= 6) || major > 4;
 
-    return GLAD_MAKE_VERSION(major, minor);
+    return version;
+}
+
+static int glad_gl_find_core_gl_context(GladGLContext *context) {
+    int version = glad_gl_get_version(context->GetString);
+    int major = GLAD_VERSION_MAJOR(version);
+    int minor = version % 10000;
+
+    context->VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+    context->VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+    context->VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+    context->VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+    context->VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+    context->VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+    context->VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+    context->VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+    context->VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+    context->VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+    context->VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+    context->VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+    context->VERSION_4_0 = (major == 4 && minor >= 0) || major > 4;
+    context->VERSION_4_1 = (major == 4 && minor >= 1) || major > 4;
+    context->VERSION_4_2 = (major == 4 && minor >= 2) || major > 4;
+    context->VERSION_4_3 = (major == 4 && minor >= 3) || major > 4;
+    context->VERSION_4_4 = (major == 4 && minor >= 4) || major > 4;
+    context->VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
+    context->VERSION_4_6 = (major == 4 && minor >= 6) || major > 4;
+
+    return version;
 }
 
 int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
     int version;
 
+    glad_gl_set_on_demand(0);
+    glad_gl_on_demand_load = NULL;
+    glad_gl_on_demand_userptr = NULL;
     glad_glGetString = (PFNGLGETSTRINGPROC) load(userptr, "glGetString");
     if(glad_glGetString == NULL) return 0;
     if(glad_glGetString(GL_VERSION) == NULL) return 0;
@@ -1611,7 +5697,7 @@ int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
     glad_gl_load_GL_VERSION_4_5(load, userptr);
     glad_gl_load_GL_VERSION_4_6(load, userptr);
 
-    if (!glad_gl_find_extensions_gl(version)) return 0;
+    if (!glad_gl_find_extensions(&glad_gl_extension_set, version, glad_glGetString, glad_glGetStringi, glad_glGetIntegerv)) return 0;
 
 
 
@@ -1619,10 +5705,102 @@ int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
 }
 
 
+static int glad_gl_has_extension(const GladGLExtensionSet *set, const char *name) {
+    unsigned int length;
+    if(set->count == 0 || name == NULL) {
+        return 0;
+    }
+    length = (unsigned int) strlen(name);
+    return set->entries[glad_gl_extension_slot(set, name, length, glad_gl_hash_extension(name, length))].name != NULL;
+}
+
+int gladGLHasExtension( const char *name) {
+    return glad_gl_has_extension(&glad_gl_extension_set, name);
+}
+
+int gladGLContextHasExtension( const GladGLContext *context, const char *name) {
+    return glad_gl_has_extension(&context->extensions, name);
+}
+
 int gladLoadGL( GLADloadfunc load) {
     return gladLoadGLUserPtr( glad_gl_get_proc_from_userptr, GLAD_GNUC_EXTENSION (void*) load);
 }
 
+int gladLoadGLContextUserPtr( GladGLContext *context, GLADuserptrloadfunc load, void *userptr) {
+    int version;
+    GladGLExtensionSet extensions = context->extensions;
+
+    memset(context, 0, sizeof *context);
+    context->extensions = extensions;
+    context->GetString = (PFNGLGETSTRINGPROC) load(userptr, "glGetString");
+    if(context->GetString == NULL) return 0;
+    if(context->GetString(GL_VERSION) == NULL) return 0;
+    version = glad_gl_find_core_gl_context(context);
+
+    glad_gl_load_GL_VERSION_1_0_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_1_1_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_1_2_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_1_3_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_1_4_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_1_5_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_2_0_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_2_1_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_3_0_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_3_1_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_3_2_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_3_3_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_4_0_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_4_1_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_4_2_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_4_3_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_4_4_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_4_5_context(context, load, userptr);
+    glad_gl_load_GL_VERSION_4_6_context(context, load, userptr);
+
+    if (!glad_gl_find_extensions(&context->extensions, version, context->GetString, context->GetStringi, context->GetIntegerv)) return 0;
+
+    return version;
+}
+
+int gladLoadGLContext( GladGLContext *context, GLADloadfunc load) {
+    return gladLoadGLContextUserPtr(context, glad_gl_get_proc_from_userptr, GLAD_GNUC_EXTENSION (void*) load);
+}
+
+void gladUnloadGLContext( GladGLContext *context) {
+    free(context->extensions.entries);
+    memset(context, 0, sizeof *context);
+}
+
+int gladLoadGLOnDemandUserPtr( GLADuserptrloadfunc load, void *userptr) {
+    int version;
+    PFNGLGETSTRINGPROC get_string;
+
+    /* check for a current context before installing the trampolines: after a failed load every
+     * pointer is NULL again, as after a failed gladLoadGL */
+    get_string = (PFNGLGETSTRINGPROC) load(userptr, "glGetString");
+    if(get_string == NULL) return 0;
+    if(get_string(GL_VERSION) == NULL) return 0;
+
+    glad_gl_on_demand_load = load;
+    glad_gl_on_demand_userptr = userptr;
+    glad_gl_set_on_demand(1);
+    glad_glGetString = get_string;
+    version = glad_gl_find_core_gl();
+
+    if (!glad_gl_find_extensions(&glad_gl_extension_set, version, glad_glGetString, glad_glGetStringi, glad_glGetIntegerv)) {
+        glad_gl_set_on_demand(0);
+        glad_gl_on_demand_load = NULL;
+        glad_gl_on_demand_userptr = NULL;
+        return 0;
+    }
+
+    return version;
+}
+
+int gladLoadGLOnDemand( GLADloadfunc load) {
+    return gladLoadGLOnDemandUserPtr( glad_gl_get_proc_from_userptr, GLAD_GNUC_EXTENSION (void*) load);
+}
+
 
 
  
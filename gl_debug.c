@@ -0,0 +1,9200 @@
+/**
+ * Generated by tools/gen_gl_debug.py from glad/gl.h; do not edit.
+ *
+ * SPDX-License-Identifier: (WTFPL OR CC0-1.0) AND Apache-2.0
+ */
+#include <stddef.h>
+#include <glad/gl_debug.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* glad_gl_functions[i] describes the entry point the debug layer reports as function i. */
+const GladGLFunction glad_gl_functions[GLAD_GL_FUNCTION_COUNT] = {
+    { "glActiveShaderProgram", "v-uGuP", "pipeline,program" },
+    { "glActiveTexture", "v-u-", "texture" },
+    { "glAttachShader", "v-uPuP", "program,shader" },
+    { "glBeginConditionalRender", "v-u-u-", "id,mode" },
+    { "glBeginQuery", "v-u-uQ", "target,id" },
+    { "glBeginQueryIndexed", "v-u-u-uQ", "target,index,id" },
+    { "glBeginTransformFeedback", "v-u-", "primitiveMode" },
+    { "glBindAttribLocation", "v-uPu-s-", "program,index,name" },
+    { "glBindBuffer", "v-u-uB", "target,buffer" },
+    { "glBindBufferBase", "v-u-u-uB", "target,index,buffer" },
+    { "glBindBufferRange", "v-u-u-uBi-i-", "target,index,buffer,offset,size" },
+    { "glBindBuffersBase", "v-u-u-i-4b", "target,first,count,buffers" },
+    { "glBindBuffersRange", "v-u-u-i-4b8-8-", "target,first,count,buffers,offsets,sizes" },
+    { "glBindFragDataLocation", "v-uPu-s-", "program,color,name" },
+    { "glBindFragDataLocationIndexed", "v-uPu-u-s-", "program,colorNumber,index,name" },
+    { "glBindFramebuffer", "v-u-uF", "target,framebuffer" },
+    { "glBindImageTexture", "v-u-uTi-u-i-u-u-", "unit,texture,level,layered,layer,access,format" },
+    { "glBindImageTextures", "v-u-i-4t", "first,count,textures" },
+    { "glBindProgramPipeline", "v-uG", "pipeline" },
+    { "glBindRenderbuffer", "v-u-uR", "target,renderbuffer" },
+    { "glBindSampler", "v-u-uS", "unit,sampler" },
+    { "glBindSamplers", "v-u-i-4s", "first,count,samplers" },
+    { "glBindTexture", "v-u-uT", "target,texture" },
+    { "glBindTextureUnit", "v-u-uT", "unit,texture" },
+    { "glBindTextures", "v-u-i-4t", "first,count,textures" },
+    { "glBindTransformFeedback", "v-u-uX", "target,id" },
+    { "glBindVertexArray", "v-uV", "array" },
+    { "glBindVertexBuffer", "v-u-uBi-i-", "bindingindex,buffer,offset,stride" },
+    { "glBindVertexBuffers", "v-u-i-4b8-4-", "first,count,buffers,offsets,strides" },
+    { "glBlendColor", "v-f-f-f-f-", "red,green,blue,alpha" },
+    { "glBlendEquation", "v-u-", "mode" },
+    { "glBlendEquationSeparate", "v-u-u-", "modeRGB,modeAlpha" },
+    { "glBlendEquationSeparatei", "v-u-u-u-", "buf,modeRGB,modeAlpha" },
+    { "glBlendEquationi", "v-u-u-", "buf,mode" },
+    { "glBlendFunc", "v-u-u-", "sfactor,dfactor" },
+    { "glBlendFuncSeparate", "v-u-u-u-u-", "sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha" },
+    { "glBlendFuncSeparatei", "v-u-u-u-u-u-", "buf,srcRGB,dstRGB,srcAlpha,dstAlpha" },
+    { "glBlendFunci", "v-u-u-u-", "buf,src,dst" },
+    { "glBlitFramebuffer", "v-i-i-i-i-i-i-i-i-u-u-", "srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter" },
+    { "glBlitNamedFramebuffer", "v-uFuFi-i-i-i-i-i-i-i-u-u-", "readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter" },
+    { "glBufferData", "v-u-i-p-u-", "target,size,data,usage" },
+    { "glBufferStorage", "v-u-i-p-u-", "target,size,data,flags" },
+    { "glBufferSubData", "v-u-i-i-p-", "target,offset,size,data" },
+    { "glCheckFramebufferStatus", "u-u-", "target" },
+    { "glCheckNamedFramebufferStatus", "u-uFu-", "framebuffer,target" },
+    { "glClampColor", "v-u-u-", "target,clamp" },
+    { "glClear", "v-u-", "mask" },
+    { "glClearBufferData", "v-u-u-u-u-p-", "target,internalformat,format,type,data" },
+    { "glClearBufferSubData", "v-u-u-i-i-u-u-p-", "target,internalformat,offset,size,format,type,data" },
+    { "glClearBufferfi", "v-u-i-f-i-", "buffer,drawbuffer,depth,stencil" },
+    { "glClearBufferfv", "v-u-i-4-", "buffer,drawbuffer,value" },
+    { "glClearBufferiv", "v-u-i-4-", "buffer,drawbuffer,value" },
+    { "glClearBufferuiv", "v-u-i-4-", "buffer,drawbuffer,value" },
+    { "glClearColor", "v-f-f-f-f-", "red,green,blue,alpha" },
+    { "glClearDepth", "v-d-", "depth" },
+    { "glClearDepthf", "v-f-", "d" },
+    { "glClearNamedBufferData", "v-uBu-u-u-p-", "buffer,internalformat,format,type,data" },
+    { "glClearNamedBufferSubData", "v-uBu-i-i-u-u-p-", "buffer,internalformat,offset,size,format,type,data" },
+    { "glClearNamedFramebufferfi", "v-uFu-i-f-i-", "framebuffer,buffer,drawbuffer,depth,stencil" },
+    { "glClearNamedFramebufferfv", "v-uFu-i-4-", "framebuffer,buffer,drawbuffer,value" },
+    { "glClearNamedFramebufferiv", "v-uFu-i-4-", "framebuffer,buffer,drawbuffer,value" },
+    { "glClearNamedFramebufferuiv", "v-uFu-i-4-", "framebuffer,buffer,drawbuffer,value" },
+    { "glClearStencil", "v-i-", "s" },
+    { "glClearTexImage", "v-uTi-u-u-p-", "texture,level,format,type,data" },
+    { "glClearTexSubImage", "v-uTi-i-i-i-i-i-i-u-u-p-", "texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data" },
+    { "glClientWaitSync", "u-pYu-u-", "sync,flags,timeout" },
+    { "glClipControl", "v-u-u-", "origin,depth" },
+    { "glColorMask", "v-u-u-u-u-", "red,green,blue,alpha" },
+    { "glColorMaski", "v-u-u-u-u-u-", "index,r,g,b,a" },
+    { "glCompileShader", "v-uP", "shader" },
+    { "glCompressedTexImage1D", "v-u-i-u-i-i-i-pO", "target,level,internalformat,width,border,imageSize,data" },
+    { "glCompressedTexImage2D", "v-u-i-u-i-i-i-i-pO", "target,level,internalformat,width,height,border,imageSize,data" },
+    { "glCompressedTexImage3D", "v-u-i-u-i-i-i-i-i-pO", "target,level,internalformat,width,height,depth,border,imageSize,data" },
+    { "glCompressedTexSubImage1D", "v-u-i-i-i-u-i-pO", "target,level,xoffset,width,format,imageSize,data" },
+    { "glCompressedTexSubImage2D", "v-u-i-i-i-i-i-u-i-pO", "target,level,xoffset,yoffset,width,height,format,imageSize,data" },
+    { "glCompressedTexSubImage3D", "v-u-i-i-i-i-i-i-i-u-i-pO", "target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data" },
+    { "glCompressedTextureSubImage1D", "v-uTi-i-i-u-i-pO", "texture,level,xoffset,width,format,imageSize,data" },
+    { "glCompressedTextureSubImage2D", "v-uTi-i-i-i-i-u-i-pO", "texture,level,xoffset,yoffset,width,height,format,imageSize,data" },
+    { "glCompressedTextureSubImage3D", "v-uTi-i-i-i-i-i-i-u-i-pO", "texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data" },
+    { "glCopyBufferSubData", "v-u-u-i-i-i-", "readTarget,writeTarget,readOffset,writeOffset,size" },
+    { "glCopyImageSubData", "v-u-u-i-i-i-i-u-u-i-i-i-i-i-i-i-", "srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth" },
+    { "glCopyNamedBufferSubData", "v-uBuBi-i-i-", "readBuffer,writeBuffer,readOffset,writeOffset,size" },
+    { "glCopyTexImage1D", "v-u-i-u-i-i-i-i-", "target,level,internalformat,x,y,width,border" },
+    { "glCopyTexImage2D", "v-u-i-u-i-i-i-i-i-", "target,level,internalformat,x,y,width,height,border" },
+    { "glCopyTexSubImage1D", "v-u-i-i-i-i-i-", "target,level,xoffset,x,y,width" },
+    { "glCopyTexSubImage2D", "v-u-i-i-i-i-i-i-i-", "target,level,xoffset,yoffset,x,y,width,height" },
+    { "glCopyTexSubImage3D", "v-u-i-i-i-i-i-i-i-i-", "target,level,xoffset,yoffset,zoffset,x,y,width,height" },
+    { "glCopyTextureSubImage1D", "v-uTi-i-i-i-i-", "texture,level,xoffset,x,y,width" },
+    { "glCopyTextureSubImage2D", "v-uTi-i-i-i-i-i-i-", "texture,level,xoffset,yoffset,x,y,width,height" },
+    { "glCopyTextureSubImage3D", "v-uTi-i-i-i-i-i-i-i-", "texture,level,xoffset,yoffset,zoffset,x,y,width,height" },
+    { "glCreateBuffers", "v-i-ob", "n,buffers" },
+    { "glCreateFramebuffers", "v-i-of", "n,framebuffers" },
+    { "glCreateProgram", "uP", "" },
+    { "glCreateProgramPipelines", "v-i-og", "n,pipelines" },
+    { "glCreateQueries", "v-u-i-oq", "target,n,ids" },
+    { "glCreateRenderbuffers", "v-i-or", "n,renderbuffers" },
+    { "glCreateSamplers", "v-i-os", "n,samplers" },
+    { "glCreateShader", "uPu-", "type" },
+    { "glCreateShaderProgramv", "uPu-i-S-", "type,count,strings" },
+    { "glCreateTextures", "v-u-i-ot", "target,n,textures" },
+    { "glCreateTransformFeedbacks", "v-i-ox", "n,ids" },
+    { "glCreateVertexArrays", "v-i-ov", "n,arrays" },
+    { "glCullFace", "v-u-", "mode" },
+    { "glDebugMessageCallback", "v-p-p-", "callback,userParam" },
+    { "glDebugMessageControl", "v-u-u-u-i-4-u-", "source,type,severity,count,ids,enabled" },
+    { "glDebugMessageInsert", "v-u-u-u-u-i-s-", "source,type,id,severity,length,buf" },
+    { "glDeleteBuffers", "v-i-4b", "n,buffers" },
+    { "glDeleteFramebuffers", "v-i-4f", "n,framebuffers" },
+    { "glDeleteProgram", "v-uP", "program" },
+    { "glDeleteProgramPipelines", "v-i-4g", "n,pipelines" },
+    { "glDeleteQueries", "v-i-4q", "n,ids" },
+    { "glDeleteRenderbuffers", "v-i-4r", "n,renderbuffers" },
+    { "glDeleteSamplers", "v-i-4s", "count,samplers" },
+    { "glDeleteShader", "v-uP", "shader" },
+    { "glDeleteSync", "v-pY", "sync" },
+    { "glDeleteTextures", "v-i-4t", "n,textures" },
+    { "glDeleteTransformFeedbacks", "v-i-4x", "n,ids" },
+    { "glDeleteVertexArrays", "v-i-4v", "n,arrays" },
+    { "glDepthFunc", "v-u-", "func" },
+    { "glDepthMask", "v-u-", "flag" },
+    { "glDepthRange", "v-d-d-", "n,f" },
+    { "glDepthRangeArrayv", "v-u-i-8-", "first,count,v" },
+    { "glDepthRangeIndexed", "v-u-d-d-", "index,n,f" },
+    { "glDepthRangef", "v-f-f-", "n,f" },
+    { "glDetachShader", "v-uPuP", "program,shader" },
+    { "glDisable", "v-u-", "cap" },
+    { "glDisableVertexArrayAttrib", "v-uVu-", "vaobj,index" },
+    { "glDisableVertexAttribArray", "v-u-", "index" },
+    { "glDisablei", "v-u-u-", "target,index" },
+    { "glDispatchCompute", "v-u-u-u-", "num_groups_x,num_groups_y,num_groups_z" },
+    { "glDispatchComputeIndirect", "v-i-", "indirect" },
+    { "glDrawArrays", "v-u-i-i-", "mode,first,count" },
+    { "glDrawArraysIndirect", "v-u-pO", "mode,indirect" },
+    { "glDrawArraysInstanced", "v-u-i-i-i-", "mode,first,count,instancecount" },
+    { "glDrawArraysInstancedBaseInstance", "v-u-i-i-i-u-", "mode,first,count,instancecount,baseinstance" },
+    { "glDrawBuffer", "v-u-", "buf" },
+    { "glDrawBuffers", "v-i-4-", "n,bufs" },
+    { "glDrawElements", "v-u-i-u-pO", "mode,count,type,indices" },
+    { "glDrawElementsBaseVertex", "v-u-i-u-pOi-", "mode,count,type,indices,basevertex" },
+    { "glDrawElementsIndirect", "v-u-u-pO", "mode,type,indirect" },
+    { "glDrawElementsInstanced", "v-u-i-u-pOi-", "mode,count,type,indices,instancecount" },
+    { "glDrawElementsInstancedBaseInstance", "v-u-i-u-pOi-u-", "mode,count,type,indices,instancecount,baseinstance" },
+    { "glDrawElementsInstancedBaseVertex", "v-u-i-u-pOi-i-", "mode,count,type,indices,instancecount,basevertex" },
+    { "glDrawElementsInstancedBaseVertexBaseInstance", "v-u-i-u-pOi-i-u-", "mode,count,type,indices,instancecount,basevertex,baseinstance" },
+    { "glDrawRangeElements", "v-u-u-u-i-u-pO", "mode,start,end,count,type,indices" },
+    { "glDrawRangeElementsBaseVertex", "v-u-u-u-i-u-pOi-", "mode,start,end,count,type,indices,basevertex" },
+    { "glDrawTransformFeedback", "v-u-uX", "mode,id" },
+    { "glDrawTransformFeedbackInstanced", "v-u-uXi-", "mode,id,instancecount" },
+    { "glDrawTransformFeedbackStream", "v-u-uXu-", "mode,id,stream" },
+    { "glDrawTransformFeedbackStreamInstanced", "v-u-uXu-i-", "mode,id,stream,instancecount" },
+    { "glEnable", "v-u-", "cap" },
+    { "glEnableVertexArrayAttrib", "v-uVu-", "vaobj,index" },
+    { "glEnableVertexAttribArray", "v-u-", "index" },
+    { "glEnablei", "v-u-u-", "target,index" },
+    { "glEndConditionalRender", "v-", "" },
+    { "glEndQuery", "v-u-", "target" },
+    { "glEndQueryIndexed", "v-u-u-", "target,index" },
+    { "glEndTransformFeedback", "v-", "" },
+    { "glFenceSync", "pYu-u-", "condition,flags" },
+    { "glFinish", "v-", "" },
+    { "glFlush", "v-", "" },
+    { "glFlushMappedBufferRange", "v-u-i-i-", "target,offset,length" },
+    { "glFlushMappedNamedBufferRange", "v-uBi-i-", "buffer,offset,length" },
+    { "glFramebufferParameteri", "v-u-u-i-", "target,pname,param" },
+    { "glFramebufferRenderbuffer", "v-u-u-u-uR", "target,attachment,renderbuffertarget,renderbuffer" },
+    { "glFramebufferTexture", "v-u-u-uTi-", "target,attachment,texture,level" },
+    { "glFramebufferTexture1D", "v-u-u-u-uTi-", "target,attachment,textarget,texture,level" },
+    { "glFramebufferTexture2D", "v-u-u-u-uTi-", "target,attachment,textarget,texture,level" },
+    { "glFramebufferTexture3D", "v-u-u-u-uTi-i-", "target,attachment,textarget,texture,level,zoffset" },
+    { "glFramebufferTextureLayer", "v-u-u-uTi-i-", "target,attachment,texture,level,layer" },
+    { "glFrontFace", "v-u-", "mode" },
+    { "glGenBuffers", "v-i-ob", "n,buffers" },
+    { "glGenFramebuffers", "v-i-of", "n,framebuffers" },
+    { "glGenProgramPipelines", "v-i-og", "n,pipelines" },
+    { "glGenQueries", "v-i-oq", "n,ids" },
+    { "glGenRenderbuffers", "v-i-or", "n,renderbuffers" },
+    { "glGenSamplers", "v-i-os", "count,samplers" },
+    { "glGenTextures", "v-i-ot", "n,textures" },
+    { "glGenTransformFeedbacks", "v-i-ox", "n,ids" },
+    { "glGenVertexArrays", "v-i-ov", "n,arrays" },
+    { "glGenerateMipmap", "v-u-", "target" },
+    { "glGenerateTextureMipmap", "v-uT", "texture" },
+    { "glGetActiveAtomicCounterBufferiv", "v-uPu-u-o-", "program,bufferIndex,pname,params" },
+    { "glGetActiveAttrib", "v-uPu-i-o-o-o-o-", "program,index,bufSize,length,size,type,name" },
+    { "glGetActiveSubroutineName", "v-uPu-u-i-o-o-", "program,shadertype,index,bufSize,length,name" },
+    { "glGetActiveSubroutineUniformName", "v-uPu-u-i-o-o-", "program,shadertype,index,bufSize,length,name" },
+    { "glGetActiveSubroutineUniformiv", "v-uPu-u-u-o-", "program,shadertype,index,pname,values" },
+    { "glGetActiveUniform", "v-uPu-i-o-o-o-o-", "program,index,bufSize,length,size,type,name" },
+    { "glGetActiveUniformBlockName", "v-uPu-i-o-o-", "program,uniformBlockIndex,bufSize,length,uniformBlockName" },
+    { "glGetActiveUniformBlockiv", "v-uPu-u-o-", "program,uniformBlockIndex,pname,params" },
+    { "glGetActiveUniformName", "v-uPu-i-o-o-", "program,uniformIndex,bufSize,length,uniformName" },
+    { "glGetActiveUniformsiv", "v-uPi-4-u-o-", "program,uniformCount,uniformIndices,pname,params" },
+    { "glGetAttachedShaders", "v-uPi-o-op", "program,maxCount,count,shaders" },
+    { "glGetAttribLocation", "i-uPs-", "program,name" },
+    { "glGetBooleani_v", "v-u-u-o-", "target,index,data" },
+    { "glGetBooleanv", "v-u-o-", "pname,data" },
+    { "glGetBufferParameteri64v", "v-u-u-o-", "target,pname,params" },
+    { "glGetBufferParameteriv", "v-u-u-o-", "target,pname,params" },
+    { "glGetBufferPointerv", "v-u-u-o-", "target,pname,params" },
+    { "glGetBufferSubData", "v-u-i-i-o-", "target,offset,size,data" },
+    { "glGetCompressedTexImage", "v-u-i-o-", "target,level,img" },
+    { "glGetCompressedTextureImage", "v-uTi-i-oO", "texture,level,bufSize,pixels" },
+    { "glGetCompressedTextureSubImage", "v-uTi-i-i-i-i-i-i-i-oO", "texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels" },
+    { "glGetDebugMessageLog", "u-u-i-o-o-o-o-o-o-", "count,bufSize,sources,types,ids,severities,lengths,messageLog" },
+    { "glGetDoublei_v", "v-u-u-o-", "target,index,data" },
+    { "glGetDoublev", "v-u-o-", "pname,data" },
+    { "glGetError", "u-", "" },
+    { "glGetFloati_v", "v-u-u-o-", "target,index,data" },
+    { "glGetFloatv", "v-u-o-", "pname,data" },
+    { "glGetFragDataIndex", "i-uPs-", "program,name" },
+    { "glGetFragDataLocation", "i-uPs-", "program,name" },
+    { "glGetFramebufferAttachmentParameteriv", "v-u-u-u-o-", "target,attachment,pname,params" },
+    { "glGetFramebufferParameteriv", "v-u-u-o-", "target,pname,params" },
+    { "glGetGraphicsResetStatus", "u-", "" },
+    { "glGetInteger64i_v", "v-u-u-o-", "target,index,data" },
+    { "glGetInteger64v", "v-u-o-", "pname,data" },
+    { "glGetIntegeri_v", "v-u-u-o-", "target,index,data" },
+    { "glGetIntegerv", "v-u-o-", "pname,data" },
+    { "glGetInternalformati64v", "v-u-u-u-i-o-", "target,internalformat,pname,count,params" },
+    { "glGetInternalformativ", "v-u-u-u-i-o-", "target,internalformat,pname,count,params" },
+    { "glGetMultisamplefv", "v-u-u-o-", "pname,index,val" },
+    { "glGetNamedBufferParameteri64v", "v-uBu-o-", "buffer,pname,params" },
+    { "glGetNamedBufferParameteriv", "v-uBu-o-", "buffer,pname,params" },
+    { "glGetNamedBufferPointerv", "v-uBu-o-", "buffer,pname,params" },
+    { "glGetNamedBufferSubData", "v-uBi-i-o-", "buffer,offset,size,data" },
+    { "glGetNamedFramebufferAttachmentParameteriv", "v-uFu-u-o-", "framebuffer,attachment,pname,params" },
+    { "glGetNamedFramebufferParameteriv", "v-uFu-o-", "framebuffer,pname,param" },
+    { "glGetNamedRenderbufferParameteriv", "v-uRu-o-", "renderbuffer,pname,params" },
+    { "glGetObjectLabel", "v-u-u-i-o-o-", "identifier,name,bufSize,length,label" },
+    { "glGetObjectPtrLabel", "v-p-i-o-o-", "ptr,bufSize,length,label" },
+    { "glGetPointerv", "v-u-o-", "pname,params" },
+    { "glGetProgramBinary", "v-uPi-o-o-o-", "program,bufSize,length,binaryFormat,binary" },
+    { "glGetProgramInfoLog", "v-uPi-o-o-", "program,bufSize,length,infoLog" },
+    { "glGetProgramInterfaceiv", "v-uPu-u-o-", "program,programInterface,pname,params" },
+    { "glGetProgramPipelineInfoLog", "v-uGi-o-o-", "pipeline,bufSize,length,infoLog" },
+    { "glGetProgramPipelineiv", "v-uGu-o-", "pipeline,pname,params" },
+    { "glGetProgramResourceIndex", "u-uPu-s-", "program,programInterface,name" },
+    { "glGetProgramResourceLocation", "i-uPu-s-", "program,programInterface,name" },
+    { "glGetProgramResourceLocationIndex", "i-uPu-s-", "program,programInterface,name" },
+    { "glGetProgramResourceName", "v-uPu-u-i-o-o-", "program,programInterface,index,bufSize,length,name" },
+    { "glGetProgramResourceiv", "v-uPu-u-i-4-i-o-o-", "program,programInterface,index,propCount,props,count,length,params" },
+    { "glGetProgramStageiv", "v-uPu-u-o-", "program,shadertype,pname,values" },
+    { "glGetProgramiv", "v-uPu-o-", "program,pname,params" },
+    { "glGetQueryBufferObjecti64v", "v-uQuBu-i-", "id,buffer,pname,offset" },
+    { "glGetQueryBufferObjectiv", "v-uQuBu-i-", "id,buffer,pname,offset" },
+    { "glGetQueryBufferObjectui64v", "v-uQuBu-i-", "id,buffer,pname,offset" },
+    { "glGetQueryBufferObjectuiv", "v-uQuBu-i-", "id,buffer,pname,offset" },
+    { "glGetQueryIndexediv", "v-u-u-u-o-", "target,index,pname,params" },
+    { "glGetQueryObjecti64v", "v-uQu-o-", "id,pname,params" },
+    { "glGetQueryObjectiv", "v-uQu-o-", "id,pname,params" },
+    { "glGetQueryObjectui64v", "v-uQu-o-", "id,pname,params" },
+    { "glGetQueryObjectuiv", "v-uQu-o-", "id,pname,params" },
+    { "glGetQueryiv", "v-u-u-o-", "target,pname,params" },
+    { "glGetRenderbufferParameteriv", "v-u-u-o-", "target,pname,params" },
+    { "glGetSamplerParameterIiv", "v-uSu-o-", "sampler,pname,params" },
+    { "glGetSamplerParameterIuiv", "v-uSu-o-", "sampler,pname,params" },
+    { "glGetSamplerParameterfv", "v-uSu-o-", "sampler,pname,params" },
+    { "glGetSamplerParameteriv", "v-uSu-o-", "sampler,pname,params" },
+    { "glGetShaderInfoLog", "v-uPi-o-o-", "shader,bufSize,length,infoLog" },
+    { "glGetShaderPrecisionFormat", "v-u-u-o-o-", "shadertype,precisiontype,range,precision" },
+    { "glGetShaderSource", "v-uPi-o-o-", "shader,bufSize,length,source" },
+    { "glGetShaderiv", "v-uPu-o-", "shader,pname,params" },
+    { "glGetString", "1-u-", "name" },
+    { "glGetStringi", "1-u-u-", "name,index" },
+    { "glGetSubroutineIndex", "u-uPu-s-", "program,shadertype,name" },
+    { "glGetSubroutineUniformLocation", "i-uPu-s-", "program,shadertype,name" },
+    { "glGetSynciv", "v-pYu-i-o-o-", "sync,pname,count,length,values" },
+    { "glGetTexImage", "v-u-i-u-u-oO", "target,level,format,type,pixels" },
+    { "glGetTexLevelParameterfv", "v-u-i-u-o-", "target,level,pname,params" },
+    { "glGetTexLevelParameteriv", "v-u-i-u-o-", "target,level,pname,params" },
+    { "glGetTexParameterIiv", "v-u-u-o-", "target,pname,params" },
+    { "glGetTexParameterIuiv", "v-u-u-o-", "target,pname,params" },
+    { "glGetTexParameterfv", "v-u-u-o-", "target,pname,params" },
+    { "glGetTexParameteriv", "v-u-u-o-", "target,pname,params" },
+    { "glGetTextureImage", "v-uTi-u-u-i-oO", "texture,level,format,type,bufSize,pixels" },
+    { "glGetTextureLevelParameterfv", "v-uTi-u-o-", "texture,level,pname,params" },
+    { "glGetTextureLevelParameteriv", "v-uTi-u-o-", "texture,level,pname,params" },
+    { "glGetTextureParameterIiv", "v-uTu-o-", "texture,pname,params" },
+    { "glGetTextureParameterIuiv", "v-uTu-o-", "texture,pname,params" },
+    { "glGetTextureParameterfv", "v-uTu-o-", "texture,pname,params" },
+    { "glGetTextureParameteriv", "v-uTu-o-", "texture,pname,params" },
+    { "glGetTextureSubImage", "v-uTi-i-i-i-i-i-i-u-u-i-oO", "texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels" },
+    { "glGetTransformFeedbackVarying", "v-uPu-i-o-o-o-o-", "program,index,bufSize,length,size,type,name" },
+    { "glGetTransformFeedbacki64_v", "v-uXu-u-o-", "xfb,pname,index,param" },
+    { "glGetTransformFeedbacki_v", "v-uXu-u-o-", "xfb,pname,index,param" },
+    { "glGetTransformFeedbackiv", "v-uXu-o-", "xfb,pname,param" },
+    { "glGetUniformBlockIndex", "u-uPs-", "program,uniformBlockName" },
+    { "glGetUniformIndices", "v-uPi-S-o-", "program,uniformCount,uniformNames,uniformIndices" },
+    { "glGetUniformLocation", "iLuPs-", "program,name" },
+    { "glGetUniformSubroutineuiv", "v-u-iLo-", "shadertype,location,params" },
+    { "glGetUniformdv", "v-uPiLo-", "program,location,params" },
+    { "glGetUniformfv", "v-uPiLo-", "program,location,params" },
+    { "glGetUniformiv", "v-uPiLo-", "program,location,params" },
+    { "glGetUniformuiv", "v-uPiLo-", "program,location,params" },
+    { "glGetVertexArrayIndexed64iv", "v-uVu-u-o-", "vaobj,index,pname,param" },
+    { "glGetVertexArrayIndexediv", "v-uVu-u-o-", "vaobj,index,pname,param" },
+    { "glGetVertexArrayiv", "v-uVu-o-", "vaobj,pname,param" },
+    { "glGetVertexAttribIiv", "v-u-u-o-", "index,pname,params" },
+    { "glGetVertexAttribIuiv", "v-u-u-o-", "index,pname,params" },
+    { "glGetVertexAttribLdv", "v-u-u-o-", "index,pname,params" },
+    { "glGetVertexAttribPointerv", "v-u-u-o-", "index,pname,pointer" },
+    { "glGetVertexAttribdv", "v-u-u-o-", "index,pname,params" },
+    { "glGetVertexAttribfv", "v-u-u-o-", "index,pname,params" },
+    { "glGetVertexAttribiv", "v-u-u-o-", "index,pname,params" },
+    { "glGetnCompressedTexImage", "v-u-i-i-oO", "target,lod,bufSize,pixels" },
+    { "glGetnTexImage", "v-u-i-u-u-i-oO", "target,level,format,type,bufSize,pixels" },
+    { "glGetnUniformdv", "v-uPiLi-o-", "program,location,bufSize,params" },
+    { "glGetnUniformfv", "v-uPiLi-o-", "program,location,bufSize,params" },
+    { "glGetnUniformiv", "v-uPiLi-o-", "program,location,bufSize,params" },
+    { "glGetnUniformuiv", "v-uPiLi-o-", "program,location,bufSize,params" },
+    { "glHint", "v-u-u-", "target,mode" },
+    { "glInvalidateBufferData", "v-uB", "buffer" },
+    { "glInvalidateBufferSubData", "v-uBi-i-", "buffer,offset,length" },
+    { "glInvalidateFramebuffer", "v-u-i-4-", "target,numAttachments,attachments" },
+    { "glInvalidateNamedFramebufferData", "v-uFi-4-", "framebuffer,numAttachments,attachments" },
+    { "glInvalidateNamedFramebufferSubData", "v-uFi-4-i-i-i-i-", "framebuffer,numAttachments,attachments,x,y,width,height" },
+    { "glInvalidateSubFramebuffer", "v-u-i-4-i-i-i-i-", "target,numAttachments,attachments,x,y,width,height" },
+    { "glInvalidateTexImage", "v-uTi-", "texture,level" },
+    { "glInvalidateTexSubImage", "v-uTi-i-i-i-i-i-i-", "texture,level,xoffset,yoffset,zoffset,width,height,depth" },
+    { "glIsBuffer", "u-uB", "buffer" },
+    { "glIsEnabled", "u-u-", "cap" },
+    { "glIsEnabledi", "u-u-u-", "target,index" },
+    { "glIsFramebuffer", "u-uF", "framebuffer" },
+    { "glIsProgram", "u-uP", "program" },
+    { "glIsProgramPipeline", "u-uG", "pipeline" },
+    { "glIsQuery", "u-uQ", "id" },
+    { "glIsRenderbuffer", "u-uR", "renderbuffer" },
+    { "glIsSampler", "u-uS", "sampler" },
+    { "glIsShader", "u-uP", "shader" },
+    { "glIsSync", "u-pY", "sync" },
+    { "glIsTexture", "u-uT", "texture" },
+    { "glIsTransformFeedback", "u-uX", "id" },
+    { "glIsVertexArray", "u-uV", "array" },
+    { "glLineWidth", "v-f-", "width" },
+    { "glLinkProgram", "v-uP", "program" },
+    { "glLogicOp", "v-u-", "opcode" },
+    { "glMapBuffer", "o-u-u-", "target,access" },
+    { "glMapBufferRange", "o-u-i-i-u-", "target,offset,length,access" },
+    { "glMapNamedBuffer", "o-uBu-", "buffer,access" },
+    { "glMapNamedBufferRange", "o-uBi-i-u-", "buffer,offset,length,access" },
+    { "glMemoryBarrier", "v-u-", "barriers" },
+    { "glMemoryBarrierByRegion", "v-u-", "barriers" },
+    { "glMinSampleShading", "v-f-", "value" },
+    { "glMultiDrawArrays", "v-u-4-4-i-", "mode,first,count,drawcount" },
+    { "glMultiDrawArraysIndirect", "v-u-pOi-i-", "mode,indirect,drawcount,stride" },
+    { "glMultiDrawArraysIndirectCount", "v-u-pOi-i-i-", "mode,indirect,drawcount,maxdrawcount,stride" },
+    { "glMultiDrawElements", "v-u-4-u-P-i-", "mode,count,type,indices,drawcount" },
+    { "glMultiDrawElementsBaseVertex", "v-u-4-u-P-i-4-", "mode,count,type,indices,drawcount,basevertex" },
+    { "glMultiDrawElementsIndirect", "v-u-u-pOi-i-", "mode,type,indirect,drawcount,stride" },
+    { "glMultiDrawElementsIndirectCount", "v-u-u-pOi-i-i-", "mode,type,indirect,drawcount,maxdrawcount,stride" },
+    { "glNamedBufferData", "v-uBi-p-u-", "buffer,size,data,usage" },
+    { "glNamedBufferStorage", "v-uBi-p-u-", "buffer,size,data,flags" },
+    { "glNamedBufferSubData", "v-uBi-i-p-", "buffer,offset,size,data" },
+    { "glNamedFramebufferDrawBuffer", "v-uFu-", "framebuffer,buf" },
+    { "glNamedFramebufferDrawBuffers", "v-uFi-4-", "framebuffer,n,bufs" },
+    { "glNamedFramebufferParameteri", "v-uFu-i-", "framebuffer,pname,param" },
+    { "glNamedFramebufferReadBuffer", "v-uFu-", "framebuffer,src" },
+    { "glNamedFramebufferRenderbuffer", "v-uFu-u-uR", "framebuffer,attachment,renderbuffertarget,renderbuffer" },
+    { "glNamedFramebufferTexture", "v-uFu-uTi-", "framebuffer,attachment,texture,level" },
+    { "glNamedFramebufferTextureLayer", "v-uFu-uTi-i-", "framebuffer,attachment,texture,level,layer" },
+    { "glNamedRenderbufferStorage", "v-uRu-i-i-", "renderbuffer,internalformat,width,height" },
+    { "glNamedRenderbufferStorageMultisample", "v-uRi-u-i-i-", "renderbuffer,samples,internalformat,width,height" },
+    { "glObjectLabel", "v-u-u-i-s-", "identifier,name,length,label" },
+    { "glObjectPtrLabel", "v-p-i-s-", "ptr,length,label" },
+    { "glPatchParameterfv", "v-u-4-", "pname,values" },
+    { "glPatchParameteri", "v-u-i-", "pname,value" },
+    { "glPauseTransformFeedback", "v-", "" },
+    { "glPixelStoref", "v-u-f-", "pname,param" },
+    { "glPixelStorei", "v-u-i-", "pname,param" },
+    { "glPointParameterf", "v-u-f-", "pname,param" },
+    { "glPointParameterfv", "v-u-4-", "pname,params" },
+    { "glPointParameteri", "v-u-i-", "pname,param" },
+    { "glPointParameteriv", "v-u-4-", "pname,params" },
+    { "glPointSize", "v-f-", "size" },
+    { "glPolygonMode", "v-u-u-", "face,mode" },
+    { "glPolygonOffset", "v-f-f-", "factor,units" },
+    { "glPolygonOffsetClamp", "v-f-f-f-", "factor,units,clamp" },
+    { "glPopDebugGroup", "v-", "" },
+    { "glPrimitiveRestartIndex", "v-u-", "index" },
+    { "glProgramBinary", "v-uPu-p-i-", "program,binaryFormat,binary,length" },
+    { "glProgramParameteri", "v-uPu-i-", "program,pname,value" },
+    { "glProgramUniform1d", "v-uPiLd-", "program,location,v0" },
+    { "glProgramUniform1dv", "v-uPiLi-8-", "program,location,count,value" },
+    { "glProgramUniform1f", "v-uPiLf-", "program,location,v0" },
+    { "glProgramUniform1fv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform1i", "v-uPiLi-", "program,location,v0" },
+    { "glProgramUniform1iv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform1ui", "v-uPiLu-", "program,location,v0" },
+    { "glProgramUniform1uiv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform2d", "v-uPiLd-d-", "program,location,v0,v1" },
+    { "glProgramUniform2dv", "v-uPiLi-8-", "program,location,count,value" },
+    { "glProgramUniform2f", "v-uPiLf-f-", "program,location,v0,v1" },
+    { "glProgramUniform2fv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform2i", "v-uPiLi-i-", "program,location,v0,v1" },
+    { "glProgramUniform2iv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform2ui", "v-uPiLu-u-", "program,location,v0,v1" },
+    { "glProgramUniform2uiv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform3d", "v-uPiLd-d-d-", "program,location,v0,v1,v2" },
+    { "glProgramUniform3dv", "v-uPiLi-8-", "program,location,count,value" },
+    { "glProgramUniform3f", "v-uPiLf-f-f-", "program,location,v0,v1,v2" },
+    { "glProgramUniform3fv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform3i", "v-uPiLi-i-i-", "program,location,v0,v1,v2" },
+    { "glProgramUniform3iv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform3ui", "v-uPiLu-u-u-", "program,location,v0,v1,v2" },
+    { "glProgramUniform3uiv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform4d", "v-uPiLd-d-d-d-", "program,location,v0,v1,v2,v3" },
+    { "glProgramUniform4dv", "v-uPiLi-8-", "program,location,count,value" },
+    { "glProgramUniform4f", "v-uPiLf-f-f-f-", "program,location,v0,v1,v2,v3" },
+    { "glProgramUniform4fv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform4i", "v-uPiLi-i-i-i-", "program,location,v0,v1,v2,v3" },
+    { "glProgramUniform4iv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniform4ui", "v-uPiLu-u-u-u-", "program,location,v0,v1,v2,v3" },
+    { "glProgramUniform4uiv", "v-uPiLi-4-", "program,location,count,value" },
+    { "glProgramUniformMatrix2dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix2fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix2x3dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix2x3fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix2x4dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix2x4fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix3dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix3fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix3x2dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix3x2fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix3x4dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix3x4fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix4dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix4fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix4x2dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix4x2fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix4x3dv", "v-uPiLi-u-8-", "program,location,count,transpose,value" },
+    { "glProgramUniformMatrix4x3fv", "v-uPiLi-u-4-", "program,location,count,transpose,value" },
+    { "glProvokingVertex", "v-u-", "mode" },
+    { "glPushDebugGroup", "v-u-u-i-s-", "source,id,length,message" },
+    { "glQueryCounter", "v-uQu-", "id,target" },
+    { "glReadBuffer", "v-u-", "src" },
+    { "glReadPixels", "v-i-i-i-i-u-u-oO", "x,y,width,height,format,type,pixels" },
+    { "glReadnPixels", "v-i-i-i-i-u-u-i-oO", "x,y,width,height,format,type,bufSize,data" },
+    { "glReleaseShaderCompiler", "v-", "" },
+    { "glRenderbufferStorage", "v-u-u-i-i-", "target,internalformat,width,height" },
+    { "glRenderbufferStorageMultisample", "v-u-i-u-i-i-", "target,samples,internalformat,width,height" },
+    { "glResumeTransformFeedback", "v-", "" },
+    { "glSampleCoverage", "v-f-u-", "value,invert" },
+    { "glSampleMaski", "v-u-u-", "maskNumber,mask" },
+    { "glSamplerParameterIiv", "v-uSu-4-", "sampler,pname,param" },
+    { "glSamplerParameterIuiv", "v-uSu-4-", "sampler,pname,param" },
+    { "glSamplerParameterf", "v-uSu-f-", "sampler,pname,param" },
+    { "glSamplerParameterfv", "v-uSu-4-", "sampler,pname,param" },
+    { "glSamplerParameteri", "v-uSu-i-", "sampler,pname,param" },
+    { "glSamplerParameteriv", "v-uSu-4-", "sampler,pname,param" },
+    { "glScissor", "v-i-i-i-i-", "x,y,width,height" },
+    { "glScissorArrayv", "v-u-i-4-", "first,count,v" },
+    { "glScissorIndexed", "v-u-i-i-i-i-", "index,left,bottom,width,height" },
+    { "glScissorIndexedv", "v-u-4-", "index,v" },
+    { "glShaderBinary", "v-i-4pu-p-i-", "count,shaders,binaryFormat,binary,length" },
+    { "glShaderSource", "v-uPi-S-4-", "shader,count,string,length" },
+    { "glShaderStorageBlockBinding", "v-uPu-u-", "program,storageBlockIndex,storageBlockBinding" },
+    { "glSpecializeShader", "v-uPs-u-4-4-", "shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue" },
+    { "glStencilFunc", "v-u-i-u-", "func,ref,mask" },
+    { "glStencilFuncSeparate", "v-u-u-i-u-", "face,func,ref,mask" },
+    { "glStencilMask", "v-u-", "mask" },
+    { "glStencilMaskSeparate", "v-u-u-", "face,mask" },
+    { "glStencilOp", "v-u-u-u-", "fail,zfail,zpass" },
+    { "glStencilOpSeparate", "v-u-u-u-u-", "face,sfail,dpfail,dppass" },
+    { "glTexBuffer", "v-u-u-uB", "target,internalformat,buffer" },
+    { "glTexBufferRange", "v-u-u-uBi-i-", "target,internalformat,buffer,offset,size" },
+    { "glTexImage1D", "v-u-i-i-i-i-u-u-pO", "target,level,internalformat,width,border,format,type,pixels" },
+    { "glTexImage2D", "v-u-i-i-i-i-i-u-u-pO", "target,level,internalformat,width,height,border,format,type,pixels" },
+    { "glTexImage2DMultisample", "v-u-i-u-i-i-u-", "target,samples,internalformat,width,height,fixedsamplelocations" },
+    { "glTexImage3D", "v-u-i-i-i-i-i-i-u-u-pO", "target,level,internalformat,width,height,depth,border,format,type,pixels" },
+    { "glTexImage3DMultisample", "v-u-i-u-i-i-i-u-", "target,samples,internalformat,width,height,depth,fixedsamplelocations" },
+    { "glTexParameterIiv", "v-u-u-4-", "target,pname,params" },
+    { "glTexParameterIuiv", "v-u-u-4-", "target,pname,params" },
+    { "glTexParameterf", "v-u-u-f-", "target,pname,param" },
+    { "glTexParameterfv", "v-u-u-4-", "target,pname,params" },
+    { "glTexParameteri", "v-u-u-i-", "target,pname,param" },
+    { "glTexParameteriv", "v-u-u-4-", "target,pname,params" },
+    { "glTexStorage1D", "v-u-i-u-i-", "target,levels,internalformat,width" },
+    { "glTexStorage2D", "v-u-i-u-i-i-", "target,levels,internalformat,width,height" },
+    { "glTexStorage2DMultisample", "v-u-i-u-i-i-u-", "target,samples,internalformat,width,height,fixedsamplelocations" },
+    { "glTexStorage3D", "v-u-i-u-i-i-i-", "target,levels,internalformat,width,height,depth" },
+    { "glTexStorage3DMultisample", "v-u-i-u-i-i-i-u-", "target,samples,internalformat,width,height,depth,fixedsamplelocations" },
+    { "glTexSubImage1D", "v-u-i-i-i-u-u-pO", "target,level,xoffset,width,format,type,pixels" },
+    { "glTexSubImage2D", "v-u-i-i-i-i-i-u-u-pO", "target,level,xoffset,yoffset,width,height,format,type,pixels" },
+    { "glTexSubImage3D", "v-u-i-i-i-i-i-i-i-u-u-pO", "target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels" },
+    { "glTextureBarrier", "v-", "" },
+    { "glTextureBuffer", "v-uTu-uB", "texture,internalformat,buffer" },
+    { "glTextureBufferRange", "v-uTu-uBi-i-", "texture,internalformat,buffer,offset,size" },
+    { "glTextureParameterIiv", "v-uTu-4-", "texture,pname,params" },
+    { "glTextureParameterIuiv", "v-uTu-4-", "texture,pname,params" },
+    { "glTextureParameterf", "v-uTu-f-", "texture,pname,param" },
+    { "glTextureParameterfv", "v-uTu-4-", "texture,pname,param" },
+    { "glTextureParameteri", "v-uTu-i-", "texture,pname,param" },
+    { "glTextureParameteriv", "v-uTu-4-", "texture,pname,param" },
+    { "glTextureStorage1D", "v-uTi-u-i-", "texture,levels,internalformat,width" },
+    { "glTextureStorage2D", "v-uTi-u-i-i-", "texture,levels,internalformat,width,height" },
+    { "glTextureStorage2DMultisample", "v-uTi-u-i-i-u-", "texture,samples,internalformat,width,height,fixedsamplelocations" },
+    { "glTextureStorage3D", "v-uTi-u-i-i-i-", "texture,levels,internalformat,width,height,depth" },
+    { "glTextureStorage3DMultisample", "v-uTi-u-i-i-i-u-", "texture,samples,internalformat,width,height,depth,fixedsamplelocations" },
+    { "glTextureSubImage1D", "v-uTi-i-i-u-u-pO", "texture,level,xoffset,width,format,type,pixels" },
+    { "glTextureSubImage2D", "v-uTi-i-i-i-i-u-u-pO", "texture,level,xoffset,yoffset,width,height,format,type,pixels" },
+    { "glTextureSubImage3D", "v-uTi-i-i-i-i-i-i-u-u-pO", "texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels" },
+    { "glTextureView", "v-uTu-uTu-u-u-u-u-", "texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers" },
+    { "glTransformFeedbackBufferBase", "v-uXu-uB", "xfb,index,buffer" },
+    { "glTransformFeedbackBufferRange", "v-uXu-uBi-i-", "xfb,index,buffer,offset,size" },
+    { "glTransformFeedbackVaryings", "v-uPi-S-u-", "program,count,varyings,bufferMode" },
+    { "glUniform1d", "v-iLd-", "location,x" },
+    { "glUniform1dv", "v-iLi-8-", "location,count,value" },
+    { "glUniform1f", "v-iLf-", "location,v0" },
+    { "glUniform1fv", "v-iLi-4-", "location,count,value" },
+    { "glUniform1i", "v-iLi-", "location,v0" },
+    { "glUniform1iv", "v-iLi-4-", "location,count,value" },
+    { "glUniform1ui", "v-iLu-", "location,v0" },
+    { "glUniform1uiv", "v-iLi-4-", "location,count,value" },
+    { "glUniform2d", "v-iLd-d-", "location,x,y" },
+    { "glUniform2dv", "v-iLi-8-", "location,count,value" },
+    { "glUniform2f", "v-iLf-f-", "location,v0,v1" },
+    { "glUniform2fv", "v-iLi-4-", "location,count,value" },
+    { "glUniform2i", "v-iLi-i-", "location,v0,v1" },
+    { "glUniform2iv", "v-iLi-4-", "location,count,value" },
+    { "glUniform2ui", "v-iLu-u-", "location,v0,v1" },
+    { "glUniform2uiv", "v-iLi-4-", "location,count,value" },
+    { "glUniform3d", "v-iLd-d-d-", "location,x,y,z" },
+    { "glUniform3dv", "v-iLi-8-", "location,count,value" },
+    { "glUniform3f", "v-iLf-f-f-", "location,v0,v1,v2" },
+    { "glUniform3fv", "v-iLi-4-", "location,count,value" },
+    { "glUniform3i", "v-iLi-i-i-", "location,v0,v1,v2" },
+    { "glUniform3iv", "v-iLi-4-", "location,count,value" },
+    { "glUniform3ui", "v-iLu-u-u-", "location,v0,v1,v2" },
+    { "glUniform3uiv", "v-iLi-4-", "location,count,value" },
+    { "glUniform4d", "v-iLd-d-d-d-", "location,x,y,z,w" },
+    { "glUniform4dv", "v-iLi-8-", "location,count,value" },
+    { "glUniform4f", "v-iLf-f-f-f-", "location,v0,v1,v2,v3" },
+    { "glUniform4fv", "v-iLi-4-", "location,count,value" },
+    { "glUniform4i", "v-iLi-i-i-i-", "location,v0,v1,v2,v3" },
+    { "glUniform4iv", "v-iLi-4-", "location,count,value" },
+    { "glUniform4ui", "v-iLu-u-u-u-", "location,v0,v1,v2,v3" },
+    { "glUniform4uiv", "v-iLi-4-", "location,count,value" },
+    { "glUniformBlockBinding", "v-uPu-u-", "program,uniformBlockIndex,uniformBlockBinding" },
+    { "glUniformMatrix2dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix2fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix2x3dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix2x3fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix2x4dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix2x4fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix3dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix3fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix3x2dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix3x2fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix3x4dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix3x4fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix4dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix4fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix4x2dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix4x2fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformMatrix4x3dv", "v-iLi-u-8-", "location,count,transpose,value" },
+    { "glUniformMatrix4x3fv", "v-iLi-u-4-", "location,count,transpose,value" },
+    { "glUniformSubroutinesuiv", "v-u-i-4-", "shadertype,count,indices" },
+    { "glUnmapBuffer", "u-u-", "target" },
+    { "glUnmapNamedBuffer", "u-uB", "buffer" },
+    { "glUseProgram", "v-uP", "program" },
+    { "glUseProgramStages", "v-uGu-uP", "pipeline,stages,program" },
+    { "glValidateProgram", "v-uP", "program" },
+    { "glValidateProgramPipeline", "v-uG", "pipeline" },
+    { "glVertexArrayAttribBinding", "v-uVu-u-", "vaobj,attribindex,bindingindex" },
+    { "glVertexArrayAttribFormat", "v-uVu-i-u-u-u-", "vaobj,attribindex,size,type,normalized,relativeoffset" },
+    { "glVertexArrayAttribIFormat", "v-uVu-i-u-u-", "vaobj,attribindex,size,type,relativeoffset" },
+    { "glVertexArrayAttribLFormat", "v-uVu-i-u-u-", "vaobj,attribindex,size,type,relativeoffset" },
+    { "glVertexArrayBindingDivisor", "v-uVu-u-", "vaobj,bindingindex,divisor" },
+    { "glVertexArrayElementBuffer", "v-uVuB", "vaobj,buffer" },
+    { "glVertexArrayVertexBuffer", "v-uVu-uBi-i-", "vaobj,bindingindex,buffer,offset,stride" },
+    { "glVertexArrayVertexBuffers", "v-uVu-i-4b8-4-", "vaobj,first,count,buffers,offsets,strides" },
+    { "glVertexAttrib1d", "v-u-d-", "index,x" },
+    { "glVertexAttrib1dv", "v-u-8-", "index,v" },
+    { "glVertexAttrib1f", "v-u-f-", "index,x" },
+    { "glVertexAttrib1fv", "v-u-4-", "index,v" },
+    { "glVertexAttrib1s", "v-u-i-", "index,x" },
+    { "glVertexAttrib1sv", "v-u-2-", "index,v" },
+    { "glVertexAttrib2d", "v-u-d-d-", "index,x,y" },
+    { "glVertexAttrib2dv", "v-u-8-", "index,v" },
+    { "glVertexAttrib2f", "v-u-f-f-", "index,x,y" },
+    { "glVertexAttrib2fv", "v-u-4-", "index,v" },
+    { "glVertexAttrib2s", "v-u-i-i-", "index,x,y" },
+    { "glVertexAttrib2sv", "v-u-2-", "index,v" },
+    { "glVertexAttrib3d", "v-u-d-d-d-", "index,x,y,z" },
+    { "glVertexAttrib3dv", "v-u-8-", "index,v" },
+    { "glVertexAttrib3f", "v-u-f-f-f-", "index,x,y,z" },
+    { "glVertexAttrib3fv", "v-u-4-", "index,v" },
+    { "glVertexAttrib3s", "v-u-i-i-i-", "index,x,y,z" },
+    { "glVertexAttrib3sv", "v-u-2-", "index,v" },
+    { "glVertexAttrib4Nbv", "v-u-1-", "index,v" },
+    { "glVertexAttrib4Niv", "v-u-4-", "index,v" },
+    { "glVertexAttrib4Nsv", "v-u-2-", "index,v" },
+    { "glVertexAttrib4Nub", "v-u-u-u-u-u-", "index,x,y,z,w" },
+    { "glVertexAttrib4Nubv", "v-u-1-", "index,v" },
+    { "glVertexAttrib4Nuiv", "v-u-4-", "index,v" },
+    { "glVertexAttrib4Nusv", "v-u-2-", "index,v" },
+    { "glVertexAttrib4bv", "v-u-1-", "index,v" },
+    { "glVertexAttrib4d", "v-u-d-d-d-d-", "index,x,y,z,w" },
+    { "glVertexAttrib4dv", "v-u-8-", "index,v" },
+    { "glVertexAttrib4f", "v-u-f-f-f-f-", "index,x,y,z,w" },
+    { "glVertexAttrib4fv", "v-u-4-", "index,v" },
+    { "glVertexAttrib4iv", "v-u-4-", "index,v" },
+    { "glVertexAttrib4s", "v-u-i-i-i-i-", "index,x,y,z,w" },
+    { "glVertexAttrib4sv", "v-u-2-", "index,v" },
+    { "glVertexAttrib4ubv", "v-u-1-", "index,v" },
+    { "glVertexAttrib4uiv", "v-u-4-", "index,v" },
+    { "glVertexAttrib4usv", "v-u-2-", "index,v" },
+    { "glVertexAttribBinding", "v-u-u-", "attribindex,bindingindex" },
+    { "glVertexAttribDivisor", "v-u-u-", "index,divisor" },
+    { "glVertexAttribFormat", "v-u-i-u-u-u-", "attribindex,size,type,normalized,relativeoffset" },
+    { "glVertexAttribI1i", "v-u-i-", "index,x" },
+    { "glVertexAttribI1iv", "v-u-4-", "index,v" },
+    { "glVertexAttribI1ui", "v-u-u-", "index,x" },
+    { "glVertexAttribI1uiv", "v-u-4-", "index,v" },
+    { "glVertexAttribI2i", "v-u-i-i-", "index,x,y" },
+    { "glVertexAttribI2iv", "v-u-4-", "index,v" },
+    { "glVertexAttribI2ui", "v-u-u-u-", "index,x,y" },
+    { "glVertexAttribI2uiv", "v-u-4-", "index,v" },
+    { "glVertexAttribI3i", "v-u-i-i-i-", "index,x,y,z" },
+    { "glVertexAttribI3iv", "v-u-4-", "index,v" },
+    { "glVertexAttribI3ui", "v-u-u-u-u-", "index,x,y,z" },
+    { "glVertexAttribI3uiv", "v-u-4-", "index,v" },
+    { "glVertexAttribI4bv", "v-u-1-", "index,v" },
+    { "glVertexAttribI4i", "v-u-i-i-i-i-", "index,x,y,z,w" },
+    { "glVertexAttribI4iv", "v-u-4-", "index,v" },
+    { "glVertexAttribI4sv", "v-u-2-", "index,v" },
+    { "glVertexAttribI4ubv", "v-u-1-", "index,v" },
+    { "glVertexAttribI4ui", "v-u-u-u-u-u-", "index,x,y,z,w" },
+    { "glVertexAttribI4uiv", "v-u-4-", "index,v" },
+    { "glVertexAttribI4usv", "v-u-2-", "index,v" },
+    { "glVertexAttribIFormat", "v-u-i-u-u-", "attribindex,size,type,relativeoffset" },
+    { "glVertexAttribIPointer", "v-u-i-u-i-pO", "index,size,type,stride,pointer" },
+    { "glVertexAttribL1d", "v-u-d-", "index,x" },
+    { "glVertexAttribL1dv", "v-u-8-", "index,v" },
+    { "glVertexAttribL2d", "v-u-d-d-", "index,x,y" },
+    { "glVertexAttribL2dv", "v-u-8-", "index,v" },
+    { "glVertexAttribL3d", "v-u-d-d-d-", "index,x,y,z" },
+    { "glVertexAttribL3dv", "v-u-8-", "index,v" },
+    { "glVertexAttribL4d", "v-u-d-d-d-d-", "index,x,y,z,w" },
+    { "glVertexAttribL4dv", "v-u-8-", "index,v" },
+    { "glVertexAttribLFormat", "v-u-i-u-u-", "attribindex,size,type,relativeoffset" },
+    { "glVertexAttribLPointer", "v-u-i-u-i-pO", "index,size,type,stride,pointer" },
+    { "glVertexAttribP1ui", "v-u-u-u-u-", "index,type,normalized,value" },
+    { "glVertexAttribP1uiv", "v-u-u-u-4-", "index,type,normalized,value" },
+    { "glVertexAttribP2ui", "v-u-u-u-u-", "index,type,normalized,value" },
+    { "glVertexAttribP2uiv", "v-u-u-u-4-", "index,type,normalized,value" },
+    { "glVertexAttribP3ui", "v-u-u-u-u-", "index,type,normalized,value" },
+    { "glVertexAttribP3uiv", "v-u-u-u-4-", "index,type,normalized,value" },
+    { "glVertexAttribP4ui", "v-u-u-u-u-", "index,type,normalized,value" },
+    { "glVertexAttribP4uiv", "v-u-u-u-4-", "index,type,normalized,value" },
+    { "glVertexAttribPointer", "v-u-i-u-u-i-pO", "index,size,type,normalized,stride,pointer" },
+    { "glVertexBindingDivisor", "v-u-u-", "bindingindex,divisor" },
+    { "glViewport", "v-i-i-i-i-", "x,y,width,height" },
+    { "glViewportArrayv", "v-u-i-4-", "first,count,v" },
+    { "glViewportIndexedf", "v-u-f-f-f-f-", "index,x,y,w,h" },
+    { "glViewportIndexedfv", "v-u-4-", "index,v" },
+    { "glWaitSync", "v-pYu-u-", "sync,flags,timeout" }
+};
+
+/* Debug layer (gladInstallGLDebug): each installed glad_gl* pointer is swapped for a wrapper
+ * that packs the arguments, reports them to the pre callback, calls the real entry point kept
+ * in glad_debug_gl* and reports again, with the result, to the post callback. */
+static GLADglcallback glad_gl_pre_callback = NULL;
+static GLADglcallback glad_gl_post_callback = NULL;
+
+static PFNGLACTIVESHADERPROGRAMPROC glad_debug_glActiveShaderProgram = NULL;
+static PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture = NULL;
+static PFNGLATTACHSHADERPROC glad_debug_glAttachShader = NULL;
+static PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender = NULL;
+static PFNGLBEGINQUERYPROC glad_debug_glBeginQuery = NULL;
+static PFNGLBEGINQUERYINDEXEDPROC glad_debug_glBeginQueryIndexed = NULL;
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback = NULL;
+static PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation = NULL;
+static PFNGLBINDBUFFERPROC glad_debug_glBindBuffer = NULL;
+static PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase = NULL;
+static PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange = NULL;
+static PFNGLBINDBUFFERSBASEPROC glad_debug_glBindBuffersBase = NULL;
+static PFNGLBINDBUFFERSRANGEPROC glad_debug_glBindBuffersRange = NULL;
+static PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation = NULL;
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed = NULL;
+static PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer = NULL;
+static PFNGLBINDIMAGETEXTUREPROC glad_debug_glBindImageTexture = NULL;
+static PFNGLBINDIMAGETEXTURESPROC glad_debug_glBindImageTextures = NULL;
+static PFNGLBINDPROGRAMPIPELINEPROC glad_debug_glBindProgramPipeline = NULL;
+static PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer = NULL;
+static PFNGLBINDSAMPLERPROC glad_debug_glBindSampler = NULL;
+static PFNGLBINDSAMPLERSPROC glad_debug_glBindSamplers = NULL;
+static PFNGLBINDTEXTUREPROC glad_debug_glBindTexture = NULL;
+static PFNGLBINDTEXTUREUNITPROC glad_debug_glBindTextureUnit = NULL;
+static PFNGLBINDTEXTURESPROC glad_debug_glBindTextures = NULL;
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_debug_glBindTransformFeedback = NULL;
+static PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray = NULL;
+static PFNGLBINDVERTEXBUFFERPROC glad_debug_glBindVertexBuffer = NULL;
+static PFNGLBINDVERTEXBUFFERSPROC glad_debug_glBindVertexBuffers = NULL;
+static PFNGLBLENDCOLORPROC glad_debug_glBlendColor = NULL;
+static PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation = NULL;
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate = NULL;
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_debug_glBlendEquationSeparatei = NULL;
+static PFNGLBLENDEQUATIONIPROC glad_debug_glBlendEquationi = NULL;
+static PFNGLBLENDFUNCPROC glad_debug_glBlendFunc = NULL;
+static PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate = NULL;
+static PFNGLBLENDFUNCSEPARATEIPROC glad_debug_glBlendFuncSeparatei = NULL;
+static PFNGLBLENDFUNCIPROC glad_debug_glBlendFunci = NULL;
+static PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer = NULL;
+static PFNGLBLITNAMEDFRAMEBUFFERPROC glad_debug_glBlitNamedFramebuffer = NULL;
+static PFNGLBUFFERDATAPROC glad_debug_glBufferData = NULL;
+static PFNGLBUFFERSTORAGEPROC glad_debug_glBufferStorage = NULL;
+static PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData = NULL;
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus = NULL;
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_debug_glCheckNamedFramebufferStatus = NULL;
+static PFNGLCLAMPCOLORPROC glad_debug_glClampColor = NULL;
+static PFNGLCLEARPROC glad_debug_glClear = NULL;
+static PFNGLCLEARBUFFERDATAPROC glad_debug_glClearBufferData = NULL;
+static PFNGLCLEARBUFFERSUBDATAPROC glad_debug_glClearBufferSubData = NULL;
+static PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi = NULL;
+static PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv = NULL;
+static PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv = NULL;
+static PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv = NULL;
+static PFNGLCLEARCOLORPROC glad_debug_glClearColor = NULL;
+static PFNGLCLEARDEPTHPROC glad_debug_glClearDepth = NULL;
+static PFNGLCLEARDEPTHFPROC glad_debug_glClearDepthf = NULL;
+static PFNGLCLEARNAMEDBUFFERDATAPROC glad_debug_glClearNamedBufferData = NULL;
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_debug_glClearNamedBufferSubData = NULL;
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_debug_glClearNamedFramebufferfi = NULL;
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_debug_glClearNamedFramebufferfv = NULL;
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_debug_glClearNamedFramebufferiv = NULL;
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_debug_glClearNamedFramebufferuiv = NULL;
+static PFNGLCLEARSTENCILPROC glad_debug_glClearStencil = NULL;
+static PFNGLCLEARTEXIMAGEPROC glad_debug_glClearTexImage = NULL;
+static PFNGLCLEARTEXSUBIMAGEPROC glad_debug_glClearTexSubImage = NULL;
+static PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync = NULL;
+static PFNGLCLIPCONTROLPROC glad_debug_glClipControl = NULL;
+static PFNGLCOLORMASKPROC glad_debug_glColorMask = NULL;
+static PFNGLCOLORMASKIPROC glad_debug_glColorMaski = NULL;
+static PFNGLCOMPILESHADERPROC glad_debug_glCompileShader = NULL;
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D = NULL;
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D = NULL;
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D = NULL;
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D = NULL;
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D = NULL;
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D = NULL;
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_debug_glCompressedTextureSubImage1D = NULL;
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_debug_glCompressedTextureSubImage2D = NULL;
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_debug_glCompressedTextureSubImage3D = NULL;
+static PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData = NULL;
+static PFNGLCOPYIMAGESUBDATAPROC glad_debug_glCopyImageSubData = NULL;
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_debug_glCopyNamedBufferSubData = NULL;
+static PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D = NULL;
+static PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D = NULL;
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D = NULL;
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D = NULL;
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D = NULL;
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_debug_glCopyTextureSubImage1D = NULL;
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_debug_glCopyTextureSubImage2D = NULL;
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_debug_glCopyTextureSubImage3D = NULL;
+static PFNGLCREATEBUFFERSPROC glad_debug_glCreateBuffers = NULL;
+static PFNGLCREATEFRAMEBUFFERSPROC glad_debug_glCreateFramebuffers = NULL;
+static PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram = NULL;
+static PFNGLCREATEPROGRAMPIPELINESPROC glad_debug_glCreateProgramPipelines = NULL;
+static PFNGLCREATEQUERIESPROC glad_debug_glCreateQueries = NULL;
+static PFNGLCREATERENDERBUFFERSPROC glad_debug_glCreateRenderbuffers = NULL;
+static PFNGLCREATESAMPLERSPROC glad_debug_glCreateSamplers = NULL;
+static PFNGLCREATESHADERPROC glad_debug_glCreateShader = NULL;
+static PFNGLCREATESHADERPROGRAMVPROC glad_debug_glCreateShaderProgramv = NULL;
+static PFNGLCREATETEXTURESPROC glad_debug_glCreateTextures = NULL;
+static PFNGLCREATETRANSFORMFEEDBACKSPROC glad_debug_glCreateTransformFeedbacks = NULL;
+static PFNGLCREATEVERTEXARRAYSPROC glad_debug_glCreateVertexArrays = NULL;
+static PFNGLCULLFACEPROC glad_debug_glCullFace = NULL;
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_debug_glDebugMessageCallback = NULL;
+static PFNGLDEBUGMESSAGECONTROLPROC glad_debug_glDebugMessageControl = NULL;
+static PFNGLDEBUGMESSAGEINSERTPROC glad_debug_glDebugMessageInsert = NULL;
+static PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers = NULL;
+static PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers = NULL;
+static PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram = NULL;
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_debug_glDeleteProgramPipelines = NULL;
+static PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries = NULL;
+static PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers = NULL;
+static PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers = NULL;
+static PFNGLDELETESHADERPROC glad_debug_glDeleteShader = NULL;
+static PFNGLDELETESYNCPROC glad_debug_glDeleteSync = NULL;
+static PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures = NULL;
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_debug_glDeleteTransformFeedbacks = NULL;
+static PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays = NULL;
+static PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc = NULL;
+static PFNGLDEPTHMASKPROC glad_debug_glDepthMask = NULL;
+static PFNGLDEPTHRANGEPROC glad_debug_glDepthRange = NULL;
+static PFNGLDEPTHRANGEARRAYVPROC glad_debug_glDepthRangeArrayv = NULL;
+static PFNGLDEPTHRANGEINDEXEDPROC glad_debug_glDepthRangeIndexed = NULL;
+static PFNGLDEPTHRANGEFPROC glad_debug_glDepthRangef = NULL;
+static PFNGLDETACHSHADERPROC glad_debug_glDetachShader = NULL;
+static PFNGLDISABLEPROC glad_debug_glDisable = NULL;
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_debug_glDisableVertexArrayAttrib = NULL;
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray = NULL;
+static PFNGLDISABLEIPROC glad_debug_glDisablei = NULL;
+static PFNGLDISPATCHCOMPUTEPROC glad_debug_glDispatchCompute = NULL;
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_debug_glDispatchComputeIndirect = NULL;
+static PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays = NULL;
+static PFNGLDRAWARRAYSINDIRECTPROC glad_debug_glDrawArraysIndirect = NULL;
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced = NULL;
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_debug_glDrawArraysInstancedBaseInstance = NULL;
+static PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer = NULL;
+static PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers = NULL;
+static PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements = NULL;
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex = NULL;
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_debug_glDrawElementsIndirect = NULL;
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced = NULL;
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_debug_glDrawElementsInstancedBaseInstance = NULL;
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex = NULL;
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_debug_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+static PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements = NULL;
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex = NULL;
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_debug_glDrawTransformFeedback = NULL;
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_debug_glDrawTransformFeedbackInstanced = NULL;
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_debug_glDrawTransformFeedbackStream = NULL;
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_debug_glDrawTransformFeedbackStreamInstanced = NULL;
+static PFNGLENABLEPROC glad_debug_glEnable = NULL;
+static PFNGLENABLEVERTEXARRAYATTRIBPROC glad_debug_glEnableVertexArrayAttrib = NULL;
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray = NULL;
+static PFNGLENABLEIPROC glad_debug_glEnablei = NULL;
+static PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender = NULL;
+static PFNGLENDQUERYPROC glad_debug_glEndQuery = NULL;
+static PFNGLENDQUERYINDEXEDPROC glad_debug_glEndQueryIndexed = NULL;
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback = NULL;
+static PFNGLFENCESYNCPROC glad_debug_glFenceSync = NULL;
+static PFNGLFINISHPROC glad_debug_glFinish = NULL;
+static PFNGLFLUSHPROC glad_debug_glFlush = NULL;
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange = NULL;
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_debug_glFlushMappedNamedBufferRange = NULL;
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_debug_glFramebufferParameteri = NULL;
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer = NULL;
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture = NULL;
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D = NULL;
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D = NULL;
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D = NULL;
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer = NULL;
+static PFNGLFRONTFACEPROC glad_debug_glFrontFace = NULL;
+static PFNGLGENBUFFERSPROC glad_debug_glGenBuffers = NULL;
+static PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers = NULL;
+static PFNGLGENPROGRAMPIPELINESPROC glad_debug_glGenProgramPipelines = NULL;
+static PFNGLGENQUERIESPROC glad_debug_glGenQueries = NULL;
+static PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers = NULL;
+static PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers = NULL;
+static PFNGLGENTEXTURESPROC glad_debug_glGenTextures = NULL;
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_debug_glGenTransformFeedbacks = NULL;
+static PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays = NULL;
+static PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap = NULL;
+static PFNGLGENERATETEXTUREMIPMAPPROC glad_debug_glGenerateTextureMipmap = NULL;
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_debug_glGetActiveAtomicCounterBufferiv = NULL;
+static PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib = NULL;
+static PFNGLGETACTIVESUBROUTINENAMEPROC glad_debug_glGetActiveSubroutineName = NULL;
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_debug_glGetActiveSubroutineUniformName = NULL;
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_debug_glGetActiveSubroutineUniformiv = NULL;
+static PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform = NULL;
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName = NULL;
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv = NULL;
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName = NULL;
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv = NULL;
+static PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders = NULL;
+static PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation = NULL;
+static PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v = NULL;
+static PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv = NULL;
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v = NULL;
+static PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv = NULL;
+static PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv = NULL;
+static PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData = NULL;
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage = NULL;
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_debug_glGetCompressedTextureImage = NULL;
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_debug_glGetCompressedTextureSubImage = NULL;
+static PFNGLGETDEBUGMESSAGELOGPROC glad_debug_glGetDebugMessageLog = NULL;
+static PFNGLGETDOUBLEI_VPROC glad_debug_glGetDoublei_v = NULL;
+static PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev = NULL;
+static PFNGLGETERRORPROC glad_debug_glGetError = NULL;
+static PFNGLGETFLOATI_VPROC glad_debug_glGetFloati_v = NULL;
+static PFNGLGETFLOATVPROC glad_debug_glGetFloatv = NULL;
+static PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex = NULL;
+static PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation = NULL;
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv = NULL;
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_debug_glGetFramebufferParameteriv = NULL;
+static PFNGLGETGRAPHICSRESETSTATUSPROC glad_debug_glGetGraphicsResetStatus = NULL;
+static PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v = NULL;
+static PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v = NULL;
+static PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v = NULL;
+static PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv = NULL;
+static PFNGLGETINTERNALFORMATI64VPROC glad_debug_glGetInternalformati64v = NULL;
+static PFNGLGETINTERNALFORMATIVPROC glad_debug_glGetInternalformativ = NULL;
+static PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv = NULL;
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_debug_glGetNamedBufferParameteri64v = NULL;
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_debug_glGetNamedBufferParameteriv = NULL;
+static PFNGLGETNAMEDBUFFERPOINTERVPROC glad_debug_glGetNamedBufferPointerv = NULL;
+static PFNGLGETNAMEDBUFFERSUBDATAPROC glad_debug_glGetNamedBufferSubData = NULL;
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetNamedFramebufferAttachmentParameteriv = NULL;
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_debug_glGetNamedFramebufferParameteriv = NULL;
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_debug_glGetNamedRenderbufferParameteriv = NULL;
+static PFNGLGETOBJECTLABELPROC glad_debug_glGetObjectLabel = NULL;
+static PFNGLGETOBJECTPTRLABELPROC glad_debug_glGetObjectPtrLabel = NULL;
+static PFNGLGETPOINTERVPROC glad_debug_glGetPointerv = NULL;
+static PFNGLGETPROGRAMBINARYPROC glad_debug_glGetProgramBinary = NULL;
+static PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog = NULL;
+static PFNGLGETPROGRAMINTERFACEIVPROC glad_debug_glGetProgramInterfaceiv = NULL;
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_debug_glGetProgramPipelineInfoLog = NULL;
+static PFNGLGETPROGRAMPIPELINEIVPROC glad_debug_glGetProgramPipelineiv = NULL;
+static PFNGLGETPROGRAMRESOURCEINDEXPROC glad_debug_glGetProgramResourceIndex = NULL;
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_debug_glGetProgramResourceLocation = NULL;
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_debug_glGetProgramResourceLocationIndex = NULL;
+static PFNGLGETPROGRAMRESOURCENAMEPROC glad_debug_glGetProgramResourceName = NULL;
+static PFNGLGETPROGRAMRESOURCEIVPROC glad_debug_glGetProgramResourceiv = NULL;
+static PFNGLGETPROGRAMSTAGEIVPROC glad_debug_glGetProgramStageiv = NULL;
+static PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv = NULL;
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_debug_glGetQueryBufferObjecti64v = NULL;
+static PFNGLGETQUERYBUFFEROBJECTIVPROC glad_debug_glGetQueryBufferObjectiv = NULL;
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_debug_glGetQueryBufferObjectui64v = NULL;
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_debug_glGetQueryBufferObjectuiv = NULL;
+static PFNGLGETQUERYINDEXEDIVPROC glad_debug_glGetQueryIndexediv = NULL;
+static PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v = NULL;
+static PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv = NULL;
+static PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v = NULL;
+static PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv = NULL;
+static PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv = NULL;
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv = NULL;
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv = NULL;
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv = NULL;
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv = NULL;
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv = NULL;
+static PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog = NULL;
+static PFNGLGETSHADERPRECISIONFORMATPROC glad_debug_glGetShaderPrecisionFormat = NULL;
+static PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource = NULL;
+static PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv = NULL;
+static PFNGLGETSTRINGPROC glad_debug_glGetString = NULL;
+static PFNGLGETSTRINGIPROC glad_debug_glGetStringi = NULL;
+static PFNGLGETSUBROUTINEINDEXPROC glad_debug_glGetSubroutineIndex = NULL;
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_debug_glGetSubroutineUniformLocation = NULL;
+static PFNGLGETSYNCIVPROC glad_debug_glGetSynciv = NULL;
+static PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage = NULL;
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv = NULL;
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv = NULL;
+static PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv = NULL;
+static PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv = NULL;
+static PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv = NULL;
+static PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv = NULL;
+static PFNGLGETTEXTUREIMAGEPROC glad_debug_glGetTextureImage = NULL;
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_debug_glGetTextureLevelParameterfv = NULL;
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_debug_glGetTextureLevelParameteriv = NULL;
+static PFNGLGETTEXTUREPARAMETERIIVPROC glad_debug_glGetTextureParameterIiv = NULL;
+static PFNGLGETTEXTUREPARAMETERIUIVPROC glad_debug_glGetTextureParameterIuiv = NULL;
+static PFNGLGETTEXTUREPARAMETERFVPROC glad_debug_glGetTextureParameterfv = NULL;
+static PFNGLGETTEXTUREPARAMETERIVPROC glad_debug_glGetTextureParameteriv = NULL;
+static PFNGLGETTEXTURESUBIMAGEPROC glad_debug_glGetTextureSubImage = NULL;
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying = NULL;
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_debug_glGetTransformFeedbacki64_v = NULL;
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_debug_glGetTransformFeedbacki_v = NULL;
+static PFNGLGETTRANSFORMFEEDBACKIVPROC glad_debug_glGetTransformFeedbackiv = NULL;
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex = NULL;
+static PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices = NULL;
+static PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation = NULL;
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_debug_glGetUniformSubroutineuiv = NULL;
+static PFNGLGETUNIFORMDVPROC glad_debug_glGetUniformdv = NULL;
+static PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv = NULL;
+static PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv = NULL;
+static PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv = NULL;
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_debug_glGetVertexArrayIndexed64iv = NULL;
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_debug_glGetVertexArrayIndexediv = NULL;
+static PFNGLGETVERTEXARRAYIVPROC glad_debug_glGetVertexArrayiv = NULL;
+static PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv = NULL;
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv = NULL;
+static PFNGLGETVERTEXATTRIBLDVPROC glad_debug_glGetVertexAttribLdv = NULL;
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv = NULL;
+static PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv = NULL;
+static PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv = NULL;
+static PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv = NULL;
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_debug_glGetnCompressedTexImage = NULL;
+static PFNGLGETNTEXIMAGEPROC glad_debug_glGetnTexImage = NULL;
+static PFNGLGETNUNIFORMDVPROC glad_debug_glGetnUniformdv = NULL;
+static PFNGLGETNUNIFORMFVPROC glad_debug_glGetnUniformfv = NULL;
+static PFNGLGETNUNIFORMIVPROC glad_debug_glGetnUniformiv = NULL;
+static PFNGLGETNUNIFORMUIVPROC glad_debug_glGetnUniformuiv = NULL;
+static PFNGLHINTPROC glad_debug_glHint = NULL;
+static PFNGLINVALIDATEBUFFERDATAPROC glad_debug_glInvalidateBufferData = NULL;
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_debug_glInvalidateBufferSubData = NULL;
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_debug_glInvalidateFramebuffer = NULL;
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_debug_glInvalidateNamedFramebufferData = NULL;
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_debug_glInvalidateNamedFramebufferSubData = NULL;
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_debug_glInvalidateSubFramebuffer = NULL;
+static PFNGLINVALIDATETEXIMAGEPROC glad_debug_glInvalidateTexImage = NULL;
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_debug_glInvalidateTexSubImage = NULL;
+static PFNGLISBUFFERPROC glad_debug_glIsBuffer = NULL;
+static PFNGLISENABLEDPROC glad_debug_glIsEnabled = NULL;
+static PFNGLISENABLEDIPROC glad_debug_glIsEnabledi = NULL;
+static PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer = NULL;
+static PFNGLISPROGRAMPROC glad_debug_glIsProgram = NULL;
+static PFNGLISPROGRAMPIPELINEPROC glad_debug_glIsProgramPipeline = NULL;
+static PFNGLISQUERYPROC glad_debug_glIsQuery = NULL;
+static PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer = NULL;
+static PFNGLISSAMPLERPROC glad_debug_glIsSampler = NULL;
+static PFNGLISSHADERPROC glad_debug_glIsShader = NULL;
+static PFNGLISSYNCPROC glad_debug_glIsSync = NULL;
+static PFNGLISTEXTUREPROC glad_debug_glIsTexture = NULL;
+static PFNGLISTRANSFORMFEEDBACKPROC glad_debug_glIsTransformFeedback = NULL;
+static PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray = NULL;
+static PFNGLLINEWIDTHPROC glad_debug_glLineWidth = NULL;
+static PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram = NULL;
+static PFNGLLOGICOPPROC glad_debug_glLogicOp = NULL;
+static PFNGLMAPBUFFERPROC glad_debug_glMapBuffer = NULL;
+static PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange = NULL;
+static PFNGLMAPNAMEDBUFFERPROC glad_debug_glMapNamedBuffer = NULL;
+static PFNGLMAPNAMEDBUFFERRANGEPROC glad_debug_glMapNamedBufferRange = NULL;
+static PFNGLMEMORYBARRIERPROC glad_debug_glMemoryBarrier = NULL;
+static PFNGLMEMORYBARRIERBYREGIONPROC glad_debug_glMemoryBarrierByRegion = NULL;
+static PFNGLMINSAMPLESHADINGPROC glad_debug_glMinSampleShading = NULL;
+static PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays = NULL;
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_debug_glMultiDrawArraysIndirect = NULL;
+static PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_debug_glMultiDrawArraysIndirectCount = NULL;
+static PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements = NULL;
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex = NULL;
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_debug_glMultiDrawElementsIndirect = NULL;
+static PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_debug_glMultiDrawElementsIndirectCount = NULL;
+static PFNGLNAMEDBUFFERDATAPROC glad_debug_glNamedBufferData = NULL;
+static PFNGLNAMEDBUFFERSTORAGEPROC glad_debug_glNamedBufferStorage = NULL;
+static PFNGLNAMEDBUFFERSUBDATAPROC glad_debug_glNamedBufferSubData = NULL;
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_debug_glNamedFramebufferDrawBuffer = NULL;
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_debug_glNamedFramebufferDrawBuffers = NULL;
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_debug_glNamedFramebufferParameteri = NULL;
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_debug_glNamedFramebufferReadBuffer = NULL;
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_debug_glNamedFramebufferRenderbuffer = NULL;
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_debug_glNamedFramebufferTexture = NULL;
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_debug_glNamedFramebufferTextureLayer = NULL;
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_debug_glNamedRenderbufferStorage = NULL;
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glNamedRenderbufferStorageMultisample = NULL;
+static PFNGLOBJECTLABELPROC glad_debug_glObjectLabel = NULL;
+static PFNGLOBJECTPTRLABELPROC glad_debug_glObjectPtrLabel = NULL;
+static PFNGLPATCHPARAMETERFVPROC glad_debug_glPatchParameterfv = NULL;
+static PFNGLPATCHPARAMETERIPROC glad_debug_glPatchParameteri = NULL;
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_debug_glPauseTransformFeedback = NULL;
+static PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref = NULL;
+static PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei = NULL;
+static PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf = NULL;
+static PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv = NULL;
+static PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri = NULL;
+static PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv = NULL;
+static PFNGLPOINTSIZEPROC glad_debug_glPointSize = NULL;
+static PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode = NULL;
+static PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset = NULL;
+static PFNGLPOLYGONOFFSETCLAMPPROC glad_debug_glPolygonOffsetClamp = NULL;
+static PFNGLPOPDEBUGGROUPPROC glad_debug_glPopDebugGroup = NULL;
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex = NULL;
+static PFNGLPROGRAMBINARYPROC glad_debug_glProgramBinary = NULL;
+static PFNGLPROGRAMPARAMETERIPROC glad_debug_glProgramParameteri = NULL;
+static PFNGLPROGRAMUNIFORM1DPROC glad_debug_glProgramUniform1d = NULL;
+static PFNGLPROGRAMUNIFORM1DVPROC glad_debug_glProgramUniform1dv = NULL;
+static PFNGLPROGRAMUNIFORM1FPROC glad_debug_glProgramUniform1f = NULL;
+static PFNGLPROGRAMUNIFORM1FVPROC glad_debug_glProgramUniform1fv = NULL;
+static PFNGLPROGRAMUNIFORM1IPROC glad_debug_glProgramUniform1i = NULL;
+static PFNGLPROGRAMUNIFORM1IVPROC glad_debug_glProgramUniform1iv = NULL;
+static PFNGLPROGRAMUNIFORM1UIPROC glad_debug_glProgramUniform1ui = NULL;
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_debug_glProgramUniform1uiv = NULL;
+static PFNGLPROGRAMUNIFORM2DPROC glad_debug_glProgramUniform2d = NULL;
+static PFNGLPROGRAMUNIFORM2DVPROC glad_debug_glProgramUniform2dv = NULL;
+static PFNGLPROGRAMUNIFORM2FPROC glad_debug_glProgramUniform2f = NULL;
+static PFNGLPROGRAMUNIFORM2FVPROC glad_debug_glProgramUniform2fv = NULL;
+static PFNGLPROGRAMUNIFORM2IPROC glad_debug_glProgramUniform2i = NULL;
+static PFNGLPROGRAMUNIFORM2IVPROC glad_debug_glProgramUniform2iv = NULL;
+static PFNGLPROGRAMUNIFORM2UIPROC glad_debug_glProgramUniform2ui = NULL;
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_debug_glProgramUniform2uiv = NULL;
+static PFNGLPROGRAMUNIFORM3DPROC glad_debug_glProgramUniform3d = NULL;
+static PFNGLPROGRAMUNIFORM3DVPROC glad_debug_glProgramUniform3dv = NULL;
+static PFNGLPROGRAMUNIFORM3FPROC glad_debug_glProgramUniform3f = NULL;
+static PFNGLPROGRAMUNIFORM3FVPROC glad_debug_glProgramUniform3fv = NULL;
+static PFNGLPROGRAMUNIFORM3IPROC glad_debug_glProgramUniform3i = NULL;
+static PFNGLPROGRAMUNIFORM3IVPROC glad_debug_glProgramUniform3iv = NULL;
+static PFNGLPROGRAMUNIFORM3UIPROC glad_debug_glProgramUniform3ui = NULL;
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_debug_glProgramUniform3uiv = NULL;
+static PFNGLPROGRAMUNIFORM4DPROC glad_debug_glProgramUniform4d = NULL;
+static PFNGLPROGRAMUNIFORM4DVPROC glad_debug_glProgramUniform4dv = NULL;
+static PFNGLPROGRAMUNIFORM4FPROC glad_debug_glProgramUniform4f = NULL;
+static PFNGLPROGRAMUNIFORM4FVPROC glad_debug_glProgramUniform4fv = NULL;
+static PFNGLPROGRAMUNIFORM4IPROC glad_debug_glProgramUniform4i = NULL;
+static PFNGLPROGRAMUNIFORM4IVPROC glad_debug_glProgramUniform4iv = NULL;
+static PFNGLPROGRAMUNIFORM4UIPROC glad_debug_glProgramUniform4ui = NULL;
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_debug_glProgramUniform4uiv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_debug_glProgramUniformMatrix2dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_debug_glProgramUniformMatrix2fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_debug_glProgramUniformMatrix2x3dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_debug_glProgramUniformMatrix2x3fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_debug_glProgramUniformMatrix2x4dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_debug_glProgramUniformMatrix2x4fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_debug_glProgramUniformMatrix3dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_debug_glProgramUniformMatrix3fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_debug_glProgramUniformMatrix3x2dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_debug_glProgramUniformMatrix3x2fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_debug_glProgramUniformMatrix3x4dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_debug_glProgramUniformMatrix3x4fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_debug_glProgramUniformMatrix4dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_debug_glProgramUniformMatrix4fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_debug_glProgramUniformMatrix4x2dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_debug_glProgramUniformMatrix4x2fv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_debug_glProgramUniformMatrix4x3dv = NULL;
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_debug_glProgramUniformMatrix4x3fv = NULL;
+static PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex = NULL;
+static PFNGLPUSHDEBUGGROUPPROC glad_debug_glPushDebugGroup = NULL;
+static PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter = NULL;
+static PFNGLREADBUFFERPROC glad_debug_glReadBuffer = NULL;
+static PFNGLREADPIXELSPROC glad_debug_glReadPixels = NULL;
+static PFNGLREADNPIXELSPROC glad_debug_glReadnPixels = NULL;
+static PFNGLRELEASESHADERCOMPILERPROC glad_debug_glReleaseShaderCompiler = NULL;
+static PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage = NULL;
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample = NULL;
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_debug_glResumeTransformFeedback = NULL;
+static PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage = NULL;
+static PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski = NULL;
+static PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv = NULL;
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv = NULL;
+static PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf = NULL;
+static PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv = NULL;
+static PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri = NULL;
+static PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv = NULL;
+static PFNGLSCISSORPROC glad_debug_glScissor = NULL;
+static PFNGLSCISSORARRAYVPROC glad_debug_glScissorArrayv = NULL;
+static PFNGLSCISSORINDEXEDPROC glad_debug_glScissorIndexed = NULL;
+static PFNGLSCISSORINDEXEDVPROC glad_debug_glScissorIndexedv = NULL;
+static PFNGLSHADERBINARYPROC glad_debug_glShaderBinary = NULL;
+static PFNGLSHADERSOURCEPROC glad_debug_glShaderSource = NULL;
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_debug_glShaderStorageBlockBinding = NULL;
+static PFNGLSPECIALIZESHADERPROC glad_debug_glSpecializeShader = NULL;
+static PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc = NULL;
+static PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate = NULL;
+static PFNGLSTENCILMASKPROC glad_debug_glStencilMask = NULL;
+static PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate = NULL;
+static PFNGLSTENCILOPPROC glad_debug_glStencilOp = NULL;
+static PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate = NULL;
+static PFNGLTEXBUFFERPROC glad_debug_glTexBuffer = NULL;
+static PFNGLTEXBUFFERRANGEPROC glad_debug_glTexBufferRange = NULL;
+static PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D = NULL;
+static PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D = NULL;
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample = NULL;
+static PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D = NULL;
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample = NULL;
+static PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv = NULL;
+static PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv = NULL;
+static PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf = NULL;
+static PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv = NULL;
+static PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri = NULL;
+static PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv = NULL;
+static PFNGLTEXSTORAGE1DPROC glad_debug_glTexStorage1D = NULL;
+static PFNGLTEXSTORAGE2DPROC glad_debug_glTexStorage2D = NULL;
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_debug_glTexStorage2DMultisample = NULL;
+static PFNGLTEXSTORAGE3DPROC glad_debug_glTexStorage3D = NULL;
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_debug_glTexStorage3DMultisample = NULL;
+static PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D = NULL;
+static PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D = NULL;
+static PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D = NULL;
+static PFNGLTEXTUREBARRIERPROC glad_debug_glTextureBarrier = NULL;
+static PFNGLTEXTUREBUFFERPROC glad_debug_glTextureBuffer = NULL;
+static PFNGLTEXTUREBUFFERRANGEPROC glad_debug_glTextureBufferRange = NULL;
+static PFNGLTEXTUREPARAMETERIIVPROC glad_debug_glTextureParameterIiv = NULL;
+static PFNGLTEXTUREPARAMETERIUIVPROC glad_debug_glTextureParameterIuiv = NULL;
+static PFNGLTEXTUREPARAMETERFPROC glad_debug_glTextureParameterf = NULL;
+static PFNGLTEXTUREPARAMETERFVPROC glad_debug_glTextureParameterfv = NULL;
+static PFNGLTEXTUREPARAMETERIPROC glad_debug_glTextureParameteri = NULL;
+static PFNGLTEXTUREPARAMETERIVPROC glad_debug_glTextureParameteriv = NULL;
+static PFNGLTEXTURESTORAGE1DPROC glad_debug_glTextureStorage1D = NULL;
+static PFNGLTEXTURESTORAGE2DPROC glad_debug_glTextureStorage2D = NULL;
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_debug_glTextureStorage2DMultisample = NULL;
+static PFNGLTEXTURESTORAGE3DPROC glad_debug_glTextureStorage3D = NULL;
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_debug_glTextureStorage3DMultisample = NULL;
+static PFNGLTEXTURESUBIMAGE1DPROC glad_debug_glTextureSubImage1D = NULL;
+static PFNGLTEXTURESUBIMAGE2DPROC glad_debug_glTextureSubImage2D = NULL;
+static PFNGLTEXTURESUBIMAGE3DPROC glad_debug_glTextureSubImage3D = NULL;
+static PFNGLTEXTUREVIEWPROC glad_debug_glTextureView = NULL;
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_debug_glTransformFeedbackBufferBase = NULL;
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_debug_glTransformFeedbackBufferRange = NULL;
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings = NULL;
+static PFNGLUNIFORM1DPROC glad_debug_glUniform1d = NULL;
+static PFNGLUNIFORM1DVPROC glad_debug_glUniform1dv = NULL;
+static PFNGLUNIFORM1FPROC glad_debug_glUniform1f = NULL;
+static PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv = NULL;
+static PFNGLUNIFORM1IPROC glad_debug_glUniform1i = NULL;
+static PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv = NULL;
+static PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui = NULL;
+static PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv = NULL;
+static PFNGLUNIFORM2DPROC glad_debug_glUniform2d = NULL;
+static PFNGLUNIFORM2DVPROC glad_debug_glUniform2dv = NULL;
+static PFNGLUNIFORM2FPROC glad_debug_glUniform2f = NULL;
+static PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv = NULL;
+static PFNGLUNIFORM2IPROC glad_debug_glUniform2i = NULL;
+static PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv = NULL;
+static PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui = NULL;
+static PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv = NULL;
+static PFNGLUNIFORM3DPROC glad_debug_glUniform3d = NULL;
+static PFNGLUNIFORM3DVPROC glad_debug_glUniform3dv = NULL;
+static PFNGLUNIFORM3FPROC glad_debug_glUniform3f = NULL;
+static PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv = NULL;
+static PFNGLUNIFORM3IPROC glad_debug_glUniform3i = NULL;
+static PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv = NULL;
+static PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui = NULL;
+static PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv = NULL;
+static PFNGLUNIFORM4DPROC glad_debug_glUniform4d = NULL;
+static PFNGLUNIFORM4DVPROC glad_debug_glUniform4dv = NULL;
+static PFNGLUNIFORM4FPROC glad_debug_glUniform4f = NULL;
+static PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv = NULL;
+static PFNGLUNIFORM4IPROC glad_debug_glUniform4i = NULL;
+static PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv = NULL;
+static PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui = NULL;
+static PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv = NULL;
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding = NULL;
+static PFNGLUNIFORMMATRIX2DVPROC glad_debug_glUniformMatrix2dv = NULL;
+static PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv = NULL;
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_debug_glUniformMatrix2x3dv = NULL;
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv = NULL;
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_debug_glUniformMatrix2x4dv = NULL;
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv = NULL;
+static PFNGLUNIFORMMATRIX3DVPROC glad_debug_glUniformMatrix3dv = NULL;
+static PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv = NULL;
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_debug_glUniformMatrix3x2dv = NULL;
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv = NULL;
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_debug_glUniformMatrix3x4dv = NULL;
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv = NULL;
+static PFNGLUNIFORMMATRIX4DVPROC glad_debug_glUniformMatrix4dv = NULL;
+static PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv = NULL;
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_debug_glUniformMatrix4x2dv = NULL;
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv = NULL;
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_debug_glUniformMatrix4x3dv = NULL;
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv = NULL;
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_debug_glUniformSubroutinesuiv = NULL;
+static PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer = NULL;
+static PFNGLUNMAPNAMEDBUFFERPROC glad_debug_glUnmapNamedBuffer = NULL;
+static PFNGLUSEPROGRAMPROC glad_debug_glUseProgram = NULL;
+static PFNGLUSEPROGRAMSTAGESPROC glad_debug_glUseProgramStages = NULL;
+static PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram = NULL;
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_debug_glValidateProgramPipeline = NULL;
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_debug_glVertexArrayAttribBinding = NULL;
+static PFNGLVERTEXARRAYATTRIBFORMATPROC glad_debug_glVertexArrayAttribFormat = NULL;
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_debug_glVertexArrayAttribIFormat = NULL;
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_debug_glVertexArrayAttribLFormat = NULL;
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_debug_glVertexArrayBindingDivisor = NULL;
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_debug_glVertexArrayElementBuffer = NULL;
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_debug_glVertexArrayVertexBuffer = NULL;
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_debug_glVertexArrayVertexBuffers = NULL;
+static PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d = NULL;
+static PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv = NULL;
+static PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f = NULL;
+static PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv = NULL;
+static PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s = NULL;
+static PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv = NULL;
+static PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d = NULL;
+static PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv = NULL;
+static PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f = NULL;
+static PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv = NULL;
+static PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s = NULL;
+static PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv = NULL;
+static PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d = NULL;
+static PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv = NULL;
+static PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f = NULL;
+static PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv = NULL;
+static PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s = NULL;
+static PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv = NULL;
+static PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv = NULL;
+static PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv = NULL;
+static PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv = NULL;
+static PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub = NULL;
+static PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv = NULL;
+static PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv = NULL;
+static PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv = NULL;
+static PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv = NULL;
+static PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d = NULL;
+static PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv = NULL;
+static PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f = NULL;
+static PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv = NULL;
+static PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv = NULL;
+static PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s = NULL;
+static PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv = NULL;
+static PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv = NULL;
+static PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv = NULL;
+static PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv = NULL;
+static PFNGLVERTEXATTRIBBINDINGPROC glad_debug_glVertexAttribBinding = NULL;
+static PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor = NULL;
+static PFNGLVERTEXATTRIBFORMATPROC glad_debug_glVertexAttribFormat = NULL;
+static PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i = NULL;
+static PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv = NULL;
+static PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui = NULL;
+static PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv = NULL;
+static PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i = NULL;
+static PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv = NULL;
+static PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui = NULL;
+static PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv = NULL;
+static PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i = NULL;
+static PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv = NULL;
+static PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui = NULL;
+static PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv = NULL;
+static PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv = NULL;
+static PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i = NULL;
+static PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv = NULL;
+static PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv = NULL;
+static PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv = NULL;
+static PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui = NULL;
+static PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv = NULL;
+static PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv = NULL;
+static PFNGLVERTEXATTRIBIFORMATPROC glad_debug_glVertexAttribIFormat = NULL;
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer = NULL;
+static PFNGLVERTEXATTRIBL1DPROC glad_debug_glVertexAttribL1d = NULL;
+static PFNGLVERTEXATTRIBL1DVPROC glad_debug_glVertexAttribL1dv = NULL;
+static PFNGLVERTEXATTRIBL2DPROC glad_debug_glVertexAttribL2d = NULL;
+static PFNGLVERTEXATTRIBL2DVPROC glad_debug_glVertexAttribL2dv = NULL;
+static PFNGLVERTEXATTRIBL3DPROC glad_debug_glVertexAttribL3d = NULL;
+static PFNGLVERTEXATTRIBL3DVPROC glad_debug_glVertexAttribL3dv = NULL;
+static PFNGLVERTEXATTRIBL4DPROC glad_debug_glVertexAttribL4d = NULL;
+static PFNGLVERTEXATTRIBL4DVPROC glad_debug_glVertexAttribL4dv = NULL;
+static PFNGLVERTEXATTRIBLFORMATPROC glad_debug_glVertexAttribLFormat = NULL;
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_debug_glVertexAttribLPointer = NULL;
+static PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui = NULL;
+static PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv = NULL;
+static PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui = NULL;
+static PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv = NULL;
+static PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui = NULL;
+static PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv = NULL;
+static PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui = NULL;
+static PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv = NULL;
+static PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer = NULL;
+static PFNGLVERTEXBINDINGDIVISORPROC glad_debug_glVertexBindingDivisor = NULL;
+static PFNGLVIEWPORTPROC glad_debug_glViewport = NULL;
+static PFNGLVIEWPORTARRAYVPROC glad_debug_glViewportArrayv = NULL;
+static PFNGLVIEWPORTINDEXEDFPROC glad_debug_glViewportIndexedf = NULL;
+static PFNGLVIEWPORTINDEXEDFVPROC glad_debug_glViewportIndexedfv = NULL;
+static PFNGLWAITSYNCPROC glad_debug_glWaitSync = NULL;
+
+static void GLAD_API_PTR glad_debug_impl_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pipeline;
+    glad_args[1].u = program;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(0, glad_args, NULL);
+    glad_debug_glActiveShaderProgram(pipeline, program);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(0, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glActiveTexture(GLenum texture) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = texture;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(1, glad_args, NULL);
+    glad_debug_glActiveTexture(texture);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(1, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glAttachShader(GLuint program, GLuint shader) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = program;
+    glad_args[1].u = shader;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(2, glad_args, NULL);
+    glad_debug_glAttachShader(program, shader);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(2, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBeginConditionalRender(GLuint id, GLenum mode) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = id;
+    glad_args[1].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(3, glad_args, NULL);
+    glad_debug_glBeginConditionalRender(id, mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(3, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBeginQuery(GLenum target, GLuint id) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = id;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(4, glad_args, NULL);
+    glad_debug_glBeginQuery(target, id);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(4, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].u = id;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(5, glad_args, NULL);
+    glad_debug_glBeginQueryIndexed(target, index, id);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(5, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBeginTransformFeedback(GLenum primitiveMode) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = primitiveMode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(6, glad_args, NULL);
+    glad_debug_glBeginTransformFeedback(primitiveMode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(6, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindAttribLocation(GLuint program, GLuint index, const GLchar * name) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].u = index;
+    glad_args[2].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(7, glad_args, NULL);
+    glad_debug_glBindAttribLocation(program, index, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(7, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindBuffer(GLenum target, GLuint buffer) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(8, glad_args, NULL);
+    glad_debug_glBindBuffer(target, buffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(8, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(9, glad_args, NULL);
+    glad_debug_glBindBufferBase(target, index, buffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(9, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].u = buffer;
+    glad_args[3].i = offset;
+    glad_args[4].i = size;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(10, glad_args, NULL);
+    glad_debug_glBindBufferRange(target, index, buffer, offset, size);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(10, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint * buffers) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].u = first;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) buffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(11, glad_args, NULL);
+    glad_debug_glBindBuffersBase(target, first, count, buffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(11, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = target;
+    glad_args[1].u = first;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) buffers;
+    glad_args[4].p = (const void *) offsets;
+    glad_args[5].p = (const void *) sizes;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(12, glad_args, NULL);
+    glad_debug_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(12, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindFragDataLocation(GLuint program, GLuint color, const GLchar * name) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].u = color;
+    glad_args[2].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(13, glad_args, NULL);
+    glad_debug_glBindFragDataLocation(program, color, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(13, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].u = colorNumber;
+    glad_args[2].u = index;
+    glad_args[3].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(14, glad_args, NULL);
+    glad_debug_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(14, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = framebuffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(15, glad_args, NULL);
+    glad_debug_glBindFramebuffer(target, framebuffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(15, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = unit;
+    glad_args[1].u = texture;
+    glad_args[2].i = level;
+    glad_args[3].u = layered;
+    glad_args[4].i = layer;
+    glad_args[5].u = access;
+    glad_args[6].u = format;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(16, glad_args, NULL);
+    glad_debug_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(16, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindImageTextures(GLuint first, GLsizei count, const GLuint * textures) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = first;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) textures;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(17, glad_args, NULL);
+    glad_debug_glBindImageTextures(first, count, textures);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(17, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindProgramPipeline(GLuint pipeline) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = pipeline;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(18, glad_args, NULL);
+    glad_debug_glBindProgramPipeline(pipeline);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(18, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = renderbuffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(19, glad_args, NULL);
+    glad_debug_glBindRenderbuffer(target, renderbuffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(19, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindSampler(GLuint unit, GLuint sampler) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = unit;
+    glad_args[1].u = sampler;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(20, glad_args, NULL);
+    glad_debug_glBindSampler(unit, sampler);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(20, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindSamplers(GLuint first, GLsizei count, const GLuint * samplers) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = first;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) samplers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(21, glad_args, NULL);
+    glad_debug_glBindSamplers(first, count, samplers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(21, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindTexture(GLenum target, GLuint texture) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = texture;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(22, glad_args, NULL);
+    glad_debug_glBindTexture(target, texture);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(22, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindTextureUnit(GLuint unit, GLuint texture) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = unit;
+    glad_args[1].u = texture;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(23, glad_args, NULL);
+    glad_debug_glBindTextureUnit(unit, texture);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(23, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindTextures(GLuint first, GLsizei count, const GLuint * textures) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = first;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) textures;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(24, glad_args, NULL);
+    glad_debug_glBindTextures(first, count, textures);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(24, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindTransformFeedback(GLenum target, GLuint id) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = id;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(25, glad_args, NULL);
+    glad_debug_glBindTransformFeedback(target, id);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(25, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindVertexArray(GLuint array) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = array;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(26, glad_args, NULL);
+    glad_debug_glBindVertexArray(array);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(26, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = bindingindex;
+    glad_args[1].u = buffer;
+    glad_args[2].i = offset;
+    glad_args[3].i = stride;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(27, glad_args, NULL);
+    glad_debug_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(27, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = first;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) buffers;
+    glad_args[3].p = (const void *) offsets;
+    glad_args[4].p = (const void *) strides;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(28, glad_args, NULL);
+    glad_debug_glBindVertexBuffers(first, count, buffers, offsets, strides);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(28, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GladGLArgument glad_args[4];
+    glad_args[0].f = red;
+    glad_args[1].f = green;
+    glad_args[2].f = blue;
+    glad_args[3].f = alpha;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(29, glad_args, NULL);
+    glad_debug_glBlendColor(red, green, blue, alpha);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(29, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendEquation(GLenum mode) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(30, glad_args, NULL);
+    glad_debug_glBlendEquation(mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(30, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = modeRGB;
+    glad_args[1].u = modeAlpha;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(31, glad_args, NULL);
+    glad_debug_glBlendEquationSeparate(modeRGB, modeAlpha);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(31, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buf;
+    glad_args[1].u = modeRGB;
+    glad_args[2].u = modeAlpha;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(32, glad_args, NULL);
+    glad_debug_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(32, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendEquationi(GLuint buf, GLenum mode) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = buf;
+    glad_args[1].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(33, glad_args, NULL);
+    glad_debug_glBlendEquationi(buf, mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(33, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = sfactor;
+    glad_args[1].u = dfactor;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(34, glad_args, NULL);
+    glad_debug_glBlendFunc(sfactor, dfactor);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(34, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = sfactorRGB;
+    glad_args[1].u = dfactorRGB;
+    glad_args[2].u = sfactorAlpha;
+    glad_args[3].u = dfactorAlpha;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(35, glad_args, NULL);
+    glad_debug_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(35, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = buf;
+    glad_args[1].u = srcRGB;
+    glad_args[2].u = dstRGB;
+    glad_args[3].u = srcAlpha;
+    glad_args[4].u = dstAlpha;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(36, glad_args, NULL);
+    glad_debug_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(36, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buf;
+    glad_args[1].u = src;
+    glad_args[2].u = dst;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(37, glad_args, NULL);
+    glad_debug_glBlendFunci(buf, src, dst);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(37, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    GladGLArgument glad_args[10];
+    glad_args[0].i = srcX0;
+    glad_args[1].i = srcY0;
+    glad_args[2].i = srcX1;
+    glad_args[3].i = srcY1;
+    glad_args[4].i = dstX0;
+    glad_args[5].i = dstY0;
+    glad_args[6].i = dstX1;
+    glad_args[7].i = dstY1;
+    glad_args[8].u = mask;
+    glad_args[9].u = filter;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(38, glad_args, NULL);
+    glad_debug_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(38, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    GladGLArgument glad_args[12];
+    glad_args[0].u = readFramebuffer;
+    glad_args[1].u = drawFramebuffer;
+    glad_args[2].i = srcX0;
+    glad_args[3].i = srcY0;
+    glad_args[4].i = srcX1;
+    glad_args[5].i = srcY1;
+    glad_args[6].i = dstX0;
+    glad_args[7].i = dstY0;
+    glad_args[8].i = dstX1;
+    glad_args[9].i = dstY1;
+    glad_args[10].u = mask;
+    glad_args[11].u = filter;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(39, glad_args, NULL);
+    glad_debug_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(39, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = size;
+    glad_args[2].p = (const void *) data;
+    glad_args[3].u = usage;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(40, glad_args, NULL);
+    glad_debug_glBufferData(target, size, data, usage);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(40, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBufferStorage(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = size;
+    glad_args[2].p = (const void *) data;
+    glad_args[3].u = flags;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(41, glad_args, NULL);
+    glad_debug_glBufferStorage(target, size, data, flags);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(41, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = offset;
+    glad_args[2].i = size;
+    glad_args[3].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(42, glad_args, NULL);
+    glad_debug_glBufferSubData(target, offset, size, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(42, glad_args, NULL);
+}
+static GLenum GLAD_API_PTR glad_debug_impl_glCheckFramebufferStatus(GLenum target) {
+    GladGLArgument glad_args[1];
+    GLenum glad_ret;
+    glad_args[0].u = target;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(43, glad_args, NULL);
+    glad_ret = glad_debug_glCheckFramebufferStatus(target);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(43, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLenum GLAD_API_PTR glad_debug_impl_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+    GladGLArgument glad_args[2];
+    GLenum glad_ret;
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = target;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(44, glad_args, NULL);
+    glad_ret = glad_debug_glCheckNamedFramebufferStatus(framebuffer, target);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(44, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glClampColor(GLenum target, GLenum clamp) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = clamp;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(45, glad_args, NULL);
+    glad_debug_glClampColor(target, clamp);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(45, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClear(GLbitfield mask) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = mask;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(46, glad_args, NULL);
+    glad_debug_glClear(mask);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(46, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void * data) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = format;
+    glad_args[3].u = type;
+    glad_args[4].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(47, glad_args, NULL);
+    glad_debug_glClearBufferData(target, internalformat, format, type, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(47, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].u = internalformat;
+    glad_args[2].i = offset;
+    glad_args[3].i = size;
+    glad_args[4].u = format;
+    glad_args[5].u = type;
+    glad_args[6].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(48, glad_args, NULL);
+    glad_debug_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(48, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = buffer;
+    glad_args[1].i = drawbuffer;
+    glad_args[2].f = depth;
+    glad_args[3].i = stencil;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(49, glad_args, NULL);
+    glad_debug_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(49, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].i = drawbuffer;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(50, glad_args, NULL);
+    glad_debug_glClearBufferfv(buffer, drawbuffer, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(50, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].i = drawbuffer;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(51, glad_args, NULL);
+    glad_debug_glClearBufferiv(buffer, drawbuffer, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(51, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].i = drawbuffer;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(52, glad_args, NULL);
+    glad_debug_glClearBufferuiv(buffer, drawbuffer, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(52, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GladGLArgument glad_args[4];
+    glad_args[0].f = red;
+    glad_args[1].f = green;
+    glad_args[2].f = blue;
+    glad_args[3].f = alpha;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(53, glad_args, NULL);
+    glad_debug_glClearColor(red, green, blue, alpha);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(53, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearDepth(GLdouble depth) {
+    GladGLArgument glad_args[1];
+    glad_args[0].d = depth;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(54, glad_args, NULL);
+    glad_debug_glClearDepth(depth);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(54, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearDepthf(GLfloat d) {
+    GladGLArgument glad_args[1];
+    glad_args[0].f = d;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(55, glad_args, NULL);
+    glad_debug_glClearDepthf(d);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(55, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void * data) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = buffer;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = format;
+    glad_args[3].u = type;
+    glad_args[4].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(56, glad_args, NULL);
+    glad_debug_glClearNamedBufferData(buffer, internalformat, format, type, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(56, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void * data) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = buffer;
+    glad_args[1].u = internalformat;
+    glad_args[2].i = offset;
+    glad_args[3].i = size;
+    glad_args[4].u = format;
+    glad_args[5].u = type;
+    glad_args[6].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(57, glad_args, NULL);
+    glad_debug_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(57, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = buffer;
+    glad_args[2].i = drawbuffer;
+    glad_args[3].f = depth;
+    glad_args[4].i = stencil;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(58, glad_args, NULL);
+    glad_debug_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(58, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = buffer;
+    glad_args[2].i = drawbuffer;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(59, glad_args, NULL);
+    glad_debug_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(59, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = buffer;
+    glad_args[2].i = drawbuffer;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(60, glad_args, NULL);
+    glad_debug_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(60, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = buffer;
+    glad_args[2].i = drawbuffer;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(61, glad_args, NULL);
+    glad_debug_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(61, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearStencil(GLint s) {
+    GladGLArgument glad_args[1];
+    glad_args[0].i = s;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(62, glad_args, NULL);
+    glad_debug_glClearStencil(s);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(62, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void * data) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].u = format;
+    glad_args[3].u = type;
+    glad_args[4].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(63, glad_args, NULL);
+    glad_debug_glClearTexImage(texture, level, format, type, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(63, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data) {
+    GladGLArgument glad_args[11];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    glad_args[8].u = format;
+    glad_args[9].u = type;
+    glad_args[10].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(64, glad_args, NULL);
+    glad_debug_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(64, glad_args, NULL);
+}
+static GLenum GLAD_API_PTR glad_debug_impl_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GladGLArgument glad_args[3];
+    GLenum glad_ret;
+    glad_args[0].p = (const void *) sync;
+    glad_args[1].u = flags;
+    glad_args[2].u = timeout;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(65, glad_args, NULL);
+    glad_ret = glad_debug_glClientWaitSync(sync, flags, timeout);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(65, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glClipControl(GLenum origin, GLenum depth) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = origin;
+    glad_args[1].u = depth;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(66, glad_args, NULL);
+    glad_debug_glClipControl(origin, depth);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(66, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = red;
+    glad_args[1].u = green;
+    glad_args[2].u = blue;
+    glad_args[3].u = alpha;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(67, glad_args, NULL);
+    glad_debug_glColorMask(red, green, blue, alpha);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(67, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].u = r;
+    glad_args[2].u = g;
+    glad_args[3].u = b;
+    glad_args[4].u = a;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(68, glad_args, NULL);
+    glad_debug_glColorMaski(index, r, g, b, a);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(68, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompileShader(GLuint shader) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = shader;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(69, glad_args, NULL);
+    glad_debug_glCompileShader(shader);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(69, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = border;
+    glad_args[5].i = imageSize;
+    glad_args[6].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(70, glad_args, NULL);
+    glad_debug_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(70, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = border;
+    glad_args[6].i = imageSize;
+    glad_args[7].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(71, glad_args, NULL);
+    glad_debug_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(71, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = depth;
+    glad_args[6].i = border;
+    glad_args[7].i = imageSize;
+    glad_args[8].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(72, glad_args, NULL);
+    glad_debug_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(72, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = width;
+    glad_args[4].u = format;
+    glad_args[5].i = imageSize;
+    glad_args[6].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(73, glad_args, NULL);
+    glad_debug_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(73, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = width;
+    glad_args[5].i = height;
+    glad_args[6].u = format;
+    glad_args[7].i = imageSize;
+    glad_args[8].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(74, glad_args, NULL);
+    glad_debug_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(74, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[11];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    glad_args[8].u = format;
+    glad_args[9].i = imageSize;
+    glad_args[10].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(75, glad_args, NULL);
+    glad_debug_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(75, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = width;
+    glad_args[4].u = format;
+    glad_args[5].i = imageSize;
+    glad_args[6].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(76, glad_args, NULL);
+    glad_debug_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(76, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = width;
+    glad_args[5].i = height;
+    glad_args[6].u = format;
+    glad_args[7].i = imageSize;
+    glad_args[8].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(77, glad_args, NULL);
+    glad_debug_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(77, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    GladGLArgument glad_args[11];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    glad_args[8].u = format;
+    glad_args[9].i = imageSize;
+    glad_args[10].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(78, glad_args, NULL);
+    glad_debug_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(78, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = readTarget;
+    glad_args[1].u = writeTarget;
+    glad_args[2].i = readOffset;
+    glad_args[3].i = writeOffset;
+    glad_args[4].i = size;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(79, glad_args, NULL);
+    glad_debug_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(79, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+    GladGLArgument glad_args[15];
+    glad_args[0].u = srcName;
+    glad_args[1].u = srcTarget;
+    glad_args[2].i = srcLevel;
+    glad_args[3].i = srcX;
+    glad_args[4].i = srcY;
+    glad_args[5].i = srcZ;
+    glad_args[6].u = dstName;
+    glad_args[7].u = dstTarget;
+    glad_args[8].i = dstLevel;
+    glad_args[9].i = dstX;
+    glad_args[10].i = dstY;
+    glad_args[11].i = dstZ;
+    glad_args[12].i = srcWidth;
+    glad_args[13].i = srcHeight;
+    glad_args[14].i = srcDepth;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(80, glad_args, NULL);
+    glad_debug_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(80, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = readBuffer;
+    glad_args[1].u = writeBuffer;
+    glad_args[2].i = readOffset;
+    glad_args[3].i = writeOffset;
+    glad_args[4].i = size;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(81, glad_args, NULL);
+    glad_debug_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(81, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = x;
+    glad_args[4].i = y;
+    glad_args[5].i = width;
+    glad_args[6].i = border;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(82, glad_args, NULL);
+    glad_debug_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(82, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = x;
+    glad_args[4].i = y;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = border;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(83, glad_args, NULL);
+    glad_debug_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(83, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = x;
+    glad_args[4].i = y;
+    glad_args[5].i = width;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(84, glad_args, NULL);
+    glad_debug_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(84, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = x;
+    glad_args[5].i = y;
+    glad_args[6].i = width;
+    glad_args[7].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(85, glad_args, NULL);
+    glad_debug_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(85, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = x;
+    glad_args[6].i = y;
+    glad_args[7].i = width;
+    glad_args[8].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(86, glad_args, NULL);
+    glad_debug_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(86, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = x;
+    glad_args[4].i = y;
+    glad_args[5].i = width;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(87, glad_args, NULL);
+    glad_debug_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(87, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = x;
+    glad_args[5].i = y;
+    glad_args[6].i = width;
+    glad_args[7].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(88, glad_args, NULL);
+    glad_debug_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(88, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = x;
+    glad_args[6].i = y;
+    glad_args[7].i = width;
+    glad_args[8].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(89, glad_args, NULL);
+    glad_debug_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(89, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateBuffers(GLsizei n, GLuint * buffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) buffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(90, glad_args, NULL);
+    glad_debug_glCreateBuffers(n, buffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(90, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateFramebuffers(GLsizei n, GLuint * framebuffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) framebuffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(91, glad_args, NULL);
+    glad_debug_glCreateFramebuffers(n, framebuffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(91, glad_args, NULL);
+}
+static GLuint GLAD_API_PTR glad_debug_impl_glCreateProgram(void) {
+    GLuint glad_ret;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(92, NULL, NULL);
+    glad_ret = glad_debug_glCreateProgram();
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(92, NULL, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateProgramPipelines(GLsizei n, GLuint * pipelines) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) pipelines;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(93, glad_args, NULL);
+    glad_debug_glCreateProgramPipelines(n, pipelines);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(93, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateQueries(GLenum target, GLsizei n, GLuint * ids) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].i = n;
+    glad_args[2].p = (const void *) ids;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(94, glad_args, NULL);
+    glad_debug_glCreateQueries(target, n, ids);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(94, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) renderbuffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(95, glad_args, NULL);
+    glad_debug_glCreateRenderbuffers(n, renderbuffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(95, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateSamplers(GLsizei n, GLuint * samplers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) samplers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(96, glad_args, NULL);
+    glad_debug_glCreateSamplers(n, samplers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(96, glad_args, NULL);
+}
+static GLuint GLAD_API_PTR glad_debug_impl_glCreateShader(GLenum type) {
+    GladGLArgument glad_args[1];
+    GLuint glad_ret;
+    glad_args[0].u = type;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(97, glad_args, NULL);
+    glad_ret = glad_debug_glCreateShader(type);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(97, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLuint GLAD_API_PTR glad_debug_impl_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const* strings) {
+    GladGLArgument glad_args[3];
+    GLuint glad_ret;
+    glad_args[0].u = type;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) strings;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(98, glad_args, NULL);
+    glad_ret = glad_debug_glCreateShaderProgramv(type, count, strings);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(98, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateTextures(GLenum target, GLsizei n, GLuint * textures) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].i = n;
+    glad_args[2].p = (const void *) textures;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(99, glad_args, NULL);
+    glad_debug_glCreateTextures(target, n, textures);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(99, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateTransformFeedbacks(GLsizei n, GLuint * ids) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) ids;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(100, glad_args, NULL);
+    glad_debug_glCreateTransformFeedbacks(n, ids);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(100, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCreateVertexArrays(GLsizei n, GLuint * arrays) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) arrays;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(101, glad_args, NULL);
+    glad_debug_glCreateVertexArrays(n, arrays);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(101, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glCullFace(GLenum mode) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(102, glad_args, NULL);
+    glad_debug_glCullFace(mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(102, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDebugMessageCallback(GLDEBUGPROC callback, const void * userParam) {
+    GladGLArgument glad_args[2];
+    glad_args[0].p = (const void *) callback;
+    glad_args[1].p = (const void *) userParam;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(103, glad_args, NULL);
+    glad_debug_glDebugMessageCallback(callback, userParam);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(103, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint * ids, GLboolean enabled) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = source;
+    glad_args[1].u = type;
+    glad_args[2].u = severity;
+    glad_args[3].i = count;
+    glad_args[4].p = (const void *) ids;
+    glad_args[5].u = enabled;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(104, glad_args, NULL);
+    glad_debug_glDebugMessageControl(source, type, severity, count, ids, enabled);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(104, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar * buf) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = source;
+    glad_args[1].u = type;
+    glad_args[2].u = id;
+    glad_args[3].u = severity;
+    glad_args[4].i = length;
+    glad_args[5].p = (const void *) buf;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(105, glad_args, NULL);
+    glad_debug_glDebugMessageInsert(source, type, id, severity, length, buf);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(105, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteBuffers(GLsizei n, const GLuint * buffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) buffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(106, glad_args, NULL);
+    glad_debug_glDeleteBuffers(n, buffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(106, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteFramebuffers(GLsizei n, const GLuint * framebuffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) framebuffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(107, glad_args, NULL);
+    glad_debug_glDeleteFramebuffers(n, framebuffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(107, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteProgram(GLuint program) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = program;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(108, glad_args, NULL);
+    glad_debug_glDeleteProgram(program);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(108, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteProgramPipelines(GLsizei n, const GLuint * pipelines) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) pipelines;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(109, glad_args, NULL);
+    glad_debug_glDeleteProgramPipelines(n, pipelines);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(109, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteQueries(GLsizei n, const GLuint * ids) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) ids;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(110, glad_args, NULL);
+    glad_debug_glDeleteQueries(n, ids);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(110, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) renderbuffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(111, glad_args, NULL);
+    glad_debug_glDeleteRenderbuffers(n, renderbuffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(111, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteSamplers(GLsizei count, const GLuint * samplers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = count;
+    glad_args[1].p = (const void *) samplers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(112, glad_args, NULL);
+    glad_debug_glDeleteSamplers(count, samplers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(112, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteShader(GLuint shader) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = shader;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(113, glad_args, NULL);
+    glad_debug_glDeleteShader(shader);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(113, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteSync(GLsync sync) {
+    GladGLArgument glad_args[1];
+    glad_args[0].p = (const void *) sync;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(114, glad_args, NULL);
+    glad_debug_glDeleteSync(sync);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(114, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteTextures(GLsizei n, const GLuint * textures) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) textures;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(115, glad_args, NULL);
+    glad_debug_glDeleteTextures(n, textures);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(115, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteTransformFeedbacks(GLsizei n, const GLuint * ids) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) ids;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(116, glad_args, NULL);
+    glad_debug_glDeleteTransformFeedbacks(n, ids);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(116, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDeleteVertexArrays(GLsizei n, const GLuint * arrays) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) arrays;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(117, glad_args, NULL);
+    glad_debug_glDeleteVertexArrays(n, arrays);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(117, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDepthFunc(GLenum func) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = func;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(118, glad_args, NULL);
+    glad_debug_glDepthFunc(func);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(118, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDepthMask(GLboolean flag) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = flag;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(119, glad_args, NULL);
+    glad_debug_glDepthMask(flag);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(119, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDepthRange(GLdouble n, GLdouble f) {
+    GladGLArgument glad_args[2];
+    glad_args[0].d = n;
+    glad_args[1].d = f;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(120, glad_args, NULL);
+    glad_debug_glDepthRange(n, f);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(120, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble * v) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = first;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(121, glad_args, NULL);
+    glad_debug_glDepthRangeArrayv(first, count, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(121, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].d = n;
+    glad_args[2].d = f;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(122, glad_args, NULL);
+    glad_debug_glDepthRangeIndexed(index, n, f);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(122, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDepthRangef(GLfloat n, GLfloat f) {
+    GladGLArgument glad_args[2];
+    glad_args[0].f = n;
+    glad_args[1].f = f;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(123, glad_args, NULL);
+    glad_debug_glDepthRangef(n, f);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(123, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDetachShader(GLuint program, GLuint shader) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = program;
+    glad_args[1].u = shader;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(124, glad_args, NULL);
+    glad_debug_glDetachShader(program, shader);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(124, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDisable(GLenum cap) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = cap;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(125, glad_args, NULL);
+    glad_debug_glDisable(cap);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(125, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(126, glad_args, NULL);
+    glad_debug_glDisableVertexArrayAttrib(vaobj, index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(126, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDisableVertexAttribArray(GLuint index) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(127, glad_args, NULL);
+    glad_debug_glDisableVertexAttribArray(index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(127, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDisablei(GLenum target, GLuint index) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(128, glad_args, NULL);
+    glad_debug_glDisablei(target, index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(128, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = num_groups_x;
+    glad_args[1].u = num_groups_y;
+    glad_args[2].u = num_groups_z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(129, glad_args, NULL);
+    glad_debug_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(129, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDispatchComputeIndirect(GLintptr indirect) {
+    GladGLArgument glad_args[1];
+    glad_args[0].i = indirect;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(130, glad_args, NULL);
+    glad_debug_glDispatchComputeIndirect(indirect);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(130, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = mode;
+    glad_args[1].i = first;
+    glad_args[2].i = count;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(131, glad_args, NULL);
+    glad_debug_glDrawArrays(mode, first, count);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(131, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawArraysIndirect(GLenum mode, const void * indirect) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = mode;
+    glad_args[1].p = (const void *) indirect;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(132, glad_args, NULL);
+    glad_debug_glDrawArraysIndirect(mode, indirect);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(132, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = mode;
+    glad_args[1].i = first;
+    glad_args[2].i = count;
+    glad_args[3].i = instancecount;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(133, glad_args, NULL);
+    glad_debug_glDrawArraysInstanced(mode, first, count, instancecount);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(133, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = mode;
+    glad_args[1].i = first;
+    glad_args[2].i = count;
+    glad_args[3].i = instancecount;
+    glad_args[4].u = baseinstance;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(134, glad_args, NULL);
+    glad_debug_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(134, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawBuffer(GLenum buf) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = buf;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(135, glad_args, NULL);
+    glad_debug_glDrawBuffer(buf);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(135, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawBuffers(GLsizei n, const GLenum * bufs) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) bufs;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(136, glad_args, NULL);
+    glad_debug_glDrawBuffers(n, bufs);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(136, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = mode;
+    glad_args[1].i = count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(137, glad_args, NULL);
+    glad_debug_glDrawElements(mode, count, type, indices);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(137, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = mode;
+    glad_args[1].i = count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    glad_args[4].i = basevertex;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(138, glad_args, NULL);
+    glad_debug_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(138, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = mode;
+    glad_args[1].u = type;
+    glad_args[2].p = (const void *) indirect;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(139, glad_args, NULL);
+    glad_debug_glDrawElementsIndirect(mode, type, indirect);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(139, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = mode;
+    glad_args[1].i = count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    glad_args[4].i = instancecount;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(140, glad_args, NULL);
+    glad_debug_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(140, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLuint baseinstance) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = mode;
+    glad_args[1].i = count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    glad_args[4].i = instancecount;
+    glad_args[5].u = baseinstance;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(141, glad_args, NULL);
+    glad_debug_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(141, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = mode;
+    glad_args[1].i = count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    glad_args[4].i = instancecount;
+    glad_args[5].i = basevertex;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(142, glad_args, NULL);
+    glad_debug_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(142, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = mode;
+    glad_args[1].i = count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    glad_args[4].i = instancecount;
+    glad_args[5].i = basevertex;
+    glad_args[6].u = baseinstance;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(143, glad_args, NULL);
+    glad_debug_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(143, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = mode;
+    glad_args[1].u = start;
+    glad_args[2].u = end;
+    glad_args[3].i = count;
+    glad_args[4].u = type;
+    glad_args[5].p = (const void *) indices;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(144, glad_args, NULL);
+    glad_debug_glDrawRangeElements(mode, start, end, count, type, indices);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(144, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = mode;
+    glad_args[1].u = start;
+    glad_args[2].u = end;
+    glad_args[3].i = count;
+    glad_args[4].u = type;
+    glad_args[5].p = (const void *) indices;
+    glad_args[6].i = basevertex;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(145, glad_args, NULL);
+    glad_debug_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(145, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawTransformFeedback(GLenum mode, GLuint id) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = mode;
+    glad_args[1].u = id;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(146, glad_args, NULL);
+    glad_debug_glDrawTransformFeedback(mode, id);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(146, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = mode;
+    glad_args[1].u = id;
+    glad_args[2].i = instancecount;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(147, glad_args, NULL);
+    glad_debug_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(147, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = mode;
+    glad_args[1].u = id;
+    glad_args[2].u = stream;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(148, glad_args, NULL);
+    glad_debug_glDrawTransformFeedbackStream(mode, id, stream);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(148, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = mode;
+    glad_args[1].u = id;
+    glad_args[2].u = stream;
+    glad_args[3].i = instancecount;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(149, glad_args, NULL);
+    glad_debug_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(149, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEnable(GLenum cap) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = cap;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(150, glad_args, NULL);
+    glad_debug_glEnable(cap);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(150, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(151, glad_args, NULL);
+    glad_debug_glEnableVertexArrayAttrib(vaobj, index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(151, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEnableVertexAttribArray(GLuint index) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(152, glad_args, NULL);
+    glad_debug_glEnableVertexAttribArray(index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(152, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEnablei(GLenum target, GLuint index) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(153, glad_args, NULL);
+    glad_debug_glEnablei(target, index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(153, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEndConditionalRender(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(154, NULL, NULL);
+    glad_debug_glEndConditionalRender();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(154, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEndQuery(GLenum target) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = target;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(155, glad_args, NULL);
+    glad_debug_glEndQuery(target);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(155, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEndQueryIndexed(GLenum target, GLuint index) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(156, glad_args, NULL);
+    glad_debug_glEndQueryIndexed(target, index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(156, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glEndTransformFeedback(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(157, NULL, NULL);
+    glad_debug_glEndTransformFeedback();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(157, NULL, NULL);
+}
+static GLsync GLAD_API_PTR glad_debug_impl_glFenceSync(GLenum condition, GLbitfield flags) {
+    GladGLArgument glad_args[2];
+    GLsync glad_ret;
+    glad_args[0].u = condition;
+    glad_args[1].u = flags;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(158, glad_args, NULL);
+    glad_ret = glad_debug_glFenceSync(condition, flags);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.p = (const void *) glad_ret;
+        glad_gl_post_callback(158, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glFinish(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(159, NULL, NULL);
+    glad_debug_glFinish();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(159, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFlush(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(160, NULL, NULL);
+    glad_debug_glFlush();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(160, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].i = offset;
+    glad_args[2].i = length;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(161, glad_args, NULL);
+    glad_debug_glFlushMappedBufferRange(target, offset, length);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(161, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].i = offset;
+    glad_args[2].i = length;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(162, glad_args, NULL);
+    glad_debug_glFlushMappedNamedBufferRange(buffer, offset, length);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(162, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].i = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(163, glad_args, NULL);
+    glad_debug_glFramebufferParameteri(target, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(163, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].u = attachment;
+    glad_args[2].u = renderbuffertarget;
+    glad_args[3].u = renderbuffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(164, glad_args, NULL);
+    glad_debug_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(164, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].u = attachment;
+    glad_args[2].u = texture;
+    glad_args[3].i = level;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(165, glad_args, NULL);
+    glad_debug_glFramebufferTexture(target, attachment, texture, level);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(165, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = attachment;
+    glad_args[2].u = textarget;
+    glad_args[3].u = texture;
+    glad_args[4].i = level;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(166, glad_args, NULL);
+    glad_debug_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(166, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = attachment;
+    glad_args[2].u = textarget;
+    glad_args[3].u = texture;
+    glad_args[4].i = level;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(167, glad_args, NULL);
+    glad_debug_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(167, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = target;
+    glad_args[1].u = attachment;
+    glad_args[2].u = textarget;
+    glad_args[3].u = texture;
+    glad_args[4].i = level;
+    glad_args[5].i = zoffset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(168, glad_args, NULL);
+    glad_debug_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(168, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = attachment;
+    glad_args[2].u = texture;
+    glad_args[3].i = level;
+    glad_args[4].i = layer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(169, glad_args, NULL);
+    glad_debug_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(169, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glFrontFace(GLenum mode) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(170, glad_args, NULL);
+    glad_debug_glFrontFace(mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(170, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenBuffers(GLsizei n, GLuint * buffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) buffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(171, glad_args, NULL);
+    glad_debug_glGenBuffers(n, buffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(171, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenFramebuffers(GLsizei n, GLuint * framebuffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) framebuffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(172, glad_args, NULL);
+    glad_debug_glGenFramebuffers(n, framebuffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(172, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenProgramPipelines(GLsizei n, GLuint * pipelines) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) pipelines;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(173, glad_args, NULL);
+    glad_debug_glGenProgramPipelines(n, pipelines);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(173, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenQueries(GLsizei n, GLuint * ids) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) ids;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(174, glad_args, NULL);
+    glad_debug_glGenQueries(n, ids);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(174, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) renderbuffers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(175, glad_args, NULL);
+    glad_debug_glGenRenderbuffers(n, renderbuffers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(175, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenSamplers(GLsizei count, GLuint * samplers) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = count;
+    glad_args[1].p = (const void *) samplers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(176, glad_args, NULL);
+    glad_debug_glGenSamplers(count, samplers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(176, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenTextures(GLsizei n, GLuint * textures) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) textures;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(177, glad_args, NULL);
+    glad_debug_glGenTextures(n, textures);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(177, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenTransformFeedbacks(GLsizei n, GLuint * ids) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) ids;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(178, glad_args, NULL);
+    glad_debug_glGenTransformFeedbacks(n, ids);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(178, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenVertexArrays(GLsizei n, GLuint * arrays) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = n;
+    glad_args[1].p = (const void *) arrays;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(179, glad_args, NULL);
+    glad_debug_glGenVertexArrays(n, arrays);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(179, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenerateMipmap(GLenum target) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = target;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(180, glad_args, NULL);
+    glad_debug_glGenerateMipmap(target);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(180, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGenerateTextureMipmap(GLuint texture) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = texture;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(181, glad_args, NULL);
+    glad_debug_glGenerateTextureMipmap(texture);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(181, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].u = bufferIndex;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(182, glad_args, NULL);
+    glad_debug_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(182, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = program;
+    glad_args[1].u = index;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) length;
+    glad_args[4].p = (const void *) size;
+    glad_args[5].p = (const void *) type;
+    glad_args[6].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(183, glad_args, NULL);
+    glad_debug_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(183, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = program;
+    glad_args[1].u = shadertype;
+    glad_args[2].u = index;
+    glad_args[3].i = bufSize;
+    glad_args[4].p = (const void *) length;
+    glad_args[5].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(184, glad_args, NULL);
+    glad_debug_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(184, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = program;
+    glad_args[1].u = shadertype;
+    glad_args[2].u = index;
+    glad_args[3].i = bufSize;
+    glad_args[4].p = (const void *) length;
+    glad_args[5].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(185, glad_args, NULL);
+    glad_debug_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(185, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].u = shadertype;
+    glad_args[2].u = index;
+    glad_args[3].u = pname;
+    glad_args[4].p = (const void *) values;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(186, glad_args, NULL);
+    glad_debug_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(186, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = program;
+    glad_args[1].u = index;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) length;
+    glad_args[4].p = (const void *) size;
+    glad_args[5].p = (const void *) type;
+    glad_args[6].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(187, glad_args, NULL);
+    glad_debug_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(187, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].u = uniformBlockIndex;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) length;
+    glad_args[4].p = (const void *) uniformBlockName;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(188, glad_args, NULL);
+    glad_debug_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(188, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].u = uniformBlockIndex;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(189, glad_args, NULL);
+    glad_debug_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(189, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].u = uniformIndex;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) length;
+    glad_args[4].p = (const void *) uniformName;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(190, glad_args, NULL);
+    glad_debug_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(190, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = uniformCount;
+    glad_args[2].p = (const void *) uniformIndices;
+    glad_args[3].u = pname;
+    glad_args[4].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(191, glad_args, NULL);
+    glad_debug_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(191, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = maxCount;
+    glad_args[2].p = (const void *) count;
+    glad_args[3].p = (const void *) shaders;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(192, glad_args, NULL);
+    glad_debug_glGetAttachedShaders(program, maxCount, count, shaders);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(192, glad_args, NULL);
+}
+static GLint GLAD_API_PTR glad_debug_impl_glGetAttribLocation(GLuint program, const GLchar * name) {
+    GladGLArgument glad_args[2];
+    GLint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(193, glad_args, NULL);
+    glad_ret = glad_debug_glGetAttribLocation(program, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.i = glad_ret;
+        glad_gl_post_callback(193, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetBooleani_v(GLenum target, GLuint index, GLboolean * data) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(194, glad_args, NULL);
+    glad_debug_glGetBooleani_v(target, index, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(194, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetBooleanv(GLenum pname, GLboolean * data) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(195, glad_args, NULL);
+    glad_debug_glGetBooleanv(pname, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(195, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(196, glad_args, NULL);
+    glad_debug_glGetBufferParameteri64v(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(196, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetBufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(197, glad_args, NULL);
+    glad_debug_glGetBufferParameteriv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(197, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetBufferPointerv(GLenum target, GLenum pname, void ** params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(198, glad_args, NULL);
+    glad_debug_glGetBufferPointerv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(198, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = offset;
+    glad_args[2].i = size;
+    glad_args[3].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(199, glad_args, NULL);
+    glad_debug_glGetBufferSubData(target, offset, size, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(199, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetCompressedTexImage(GLenum target, GLint level, void * img) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].p = (const void *) img;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(200, glad_args, NULL);
+    glad_debug_glGetCompressedTexImage(target, level, img);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(200, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void * pixels) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(201, glad_args, NULL);
+    glad_debug_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(201, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void * pixels) {
+    GladGLArgument glad_args[10];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    glad_args[8].i = bufSize;
+    glad_args[9].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(202, glad_args, NULL);
+    glad_debug_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(202, glad_args, NULL);
+}
+static GLuint GLAD_API_PTR glad_debug_impl_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum * sources, GLenum * types, GLuint * ids, GLenum * severities, GLsizei * lengths, GLchar * messageLog) {
+    GladGLArgument glad_args[8];
+    GLuint glad_ret;
+    glad_args[0].u = count;
+    glad_args[1].i = bufSize;
+    glad_args[2].p = (const void *) sources;
+    glad_args[3].p = (const void *) types;
+    glad_args[4].p = (const void *) ids;
+    glad_args[5].p = (const void *) severities;
+    glad_args[6].p = (const void *) lengths;
+    glad_args[7].p = (const void *) messageLog;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(203, glad_args, NULL);
+    glad_ret = glad_debug_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(203, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetDoublei_v(GLenum target, GLuint index, GLdouble * data) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(204, glad_args, NULL);
+    glad_debug_glGetDoublei_v(target, index, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(204, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetDoublev(GLenum pname, GLdouble * data) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(205, glad_args, NULL);
+    glad_debug_glGetDoublev(pname, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(205, glad_args, NULL);
+}
+static GLenum GLAD_API_PTR glad_debug_impl_glGetError(void) {
+    GLenum glad_ret;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(206, NULL, NULL);
+    glad_ret = glad_debug_glGetError();
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(206, NULL, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetFloati_v(GLenum target, GLuint index, GLfloat * data) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(207, glad_args, NULL);
+    glad_debug_glGetFloati_v(target, index, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(207, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetFloatv(GLenum pname, GLfloat * data) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(208, glad_args, NULL);
+    glad_debug_glGetFloatv(pname, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(208, glad_args, NULL);
+}
+static GLint GLAD_API_PTR glad_debug_impl_glGetFragDataIndex(GLuint program, const GLchar * name) {
+    GladGLArgument glad_args[2];
+    GLint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(209, glad_args, NULL);
+    glad_ret = glad_debug_glGetFragDataIndex(program, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.i = glad_ret;
+        glad_gl_post_callback(209, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLint GLAD_API_PTR glad_debug_impl_glGetFragDataLocation(GLuint program, const GLchar * name) {
+    GladGLArgument glad_args[2];
+    GLint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(210, glad_args, NULL);
+    glad_ret = glad_debug_glGetFragDataLocation(program, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.i = glad_ret;
+        glad_gl_post_callback(210, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].u = attachment;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(211, glad_args, NULL);
+    glad_debug_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(211, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(212, glad_args, NULL);
+    glad_debug_glGetFramebufferParameteriv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(212, glad_args, NULL);
+}
+static GLenum GLAD_API_PTR glad_debug_impl_glGetGraphicsResetStatus(void) {
+    GLenum glad_ret;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(213, NULL, NULL);
+    glad_ret = glad_debug_glGetGraphicsResetStatus();
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(213, NULL, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetInteger64i_v(GLenum target, GLuint index, GLint64 * data) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(214, glad_args, NULL);
+    glad_debug_glGetInteger64i_v(target, index, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(214, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetInteger64v(GLenum pname, GLint64 * data) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(215, glad_args, NULL);
+    glad_debug_glGetInteger64v(pname, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(215, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetIntegeri_v(GLenum target, GLuint index, GLint * data) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(216, glad_args, NULL);
+    glad_debug_glGetIntegeri_v(target, index, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(216, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetIntegerv(GLenum pname, GLint * data) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(217, glad_args, NULL);
+    glad_debug_glGetIntegerv(pname, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(217, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 * params) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = pname;
+    glad_args[3].i = count;
+    glad_args[4].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(218, glad_args, NULL);
+    glad_debug_glGetInternalformati64v(target, internalformat, pname, count, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(218, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint * params) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = pname;
+    glad_args[3].i = count;
+    glad_args[4].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(219, glad_args, NULL);
+    glad_debug_glGetInternalformativ(target, internalformat, pname, count, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(219, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat * val) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = pname;
+    glad_args[1].u = index;
+    glad_args[2].p = (const void *) val;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(220, glad_args, NULL);
+    glad_debug_glGetMultisamplefv(pname, index, val);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(220, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(221, glad_args, NULL);
+    glad_debug_glGetNamedBufferParameteri64v(buffer, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(221, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(222, glad_args, NULL);
+    glad_debug_glGetNamedBufferParameteriv(buffer, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(222, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void ** params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(223, glad_args, NULL);
+    glad_debug_glGetNamedBufferPointerv(buffer, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(223, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void * data) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = buffer;
+    glad_args[1].i = offset;
+    glad_args[2].i = size;
+    glad_args[3].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(224, glad_args, NULL);
+    glad_debug_glGetNamedBufferSubData(buffer, offset, size, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(224, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = attachment;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(225, glad_args, NULL);
+    glad_debug_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(225, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(226, glad_args, NULL);
+    glad_debug_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(226, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = renderbuffer;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(227, glad_args, NULL);
+    glad_debug_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(227, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = identifier;
+    glad_args[1].u = name;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) length;
+    glad_args[4].p = (const void *) label;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(228, glad_args, NULL);
+    glad_debug_glGetObjectLabel(identifier, name, bufSize, length, label);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(228, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetObjectPtrLabel(const void * ptr, GLsizei bufSize, GLsizei * length, GLchar * label) {
+    GladGLArgument glad_args[4];
+    glad_args[0].p = (const void *) ptr;
+    glad_args[1].i = bufSize;
+    glad_args[2].p = (const void *) length;
+    glad_args[3].p = (const void *) label;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(229, glad_args, NULL);
+    glad_debug_glGetObjectPtrLabel(ptr, bufSize, length, label);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(229, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetPointerv(GLenum pname, void ** params) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(230, glad_args, NULL);
+    glad_debug_glGetPointerv(pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(230, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei * length, GLenum * binaryFormat, void * binary) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = bufSize;
+    glad_args[2].p = (const void *) length;
+    glad_args[3].p = (const void *) binaryFormat;
+    glad_args[4].p = (const void *) binary;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(231, glad_args, NULL);
+    glad_debug_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(231, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = bufSize;
+    glad_args[2].p = (const void *) length;
+    glad_args[3].p = (const void *) infoLog;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(232, glad_args, NULL);
+    glad_debug_glGetProgramInfoLog(program, bufSize, length, infoLog);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(232, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].u = programInterface;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(233, glad_args, NULL);
+    glad_debug_glGetProgramInterfaceiv(program, programInterface, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(233, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = pipeline;
+    glad_args[1].i = bufSize;
+    glad_args[2].p = (const void *) length;
+    glad_args[3].p = (const void *) infoLog;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(234, glad_args, NULL);
+    glad_debug_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(234, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = pipeline;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(235, glad_args, NULL);
+    glad_debug_glGetProgramPipelineiv(pipeline, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(235, glad_args, NULL);
+}
+static GLuint GLAD_API_PTR glad_debug_impl_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    GladGLArgument glad_args[3];
+    GLuint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].u = programInterface;
+    glad_args[2].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(236, glad_args, NULL);
+    glad_ret = glad_debug_glGetProgramResourceIndex(program, programInterface, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(236, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLint GLAD_API_PTR glad_debug_impl_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar * name) {
+    GladGLArgument glad_args[3];
+    GLint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].u = programInterface;
+    glad_args[2].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(237, glad_args, NULL);
+    glad_ret = glad_debug_glGetProgramResourceLocation(program, programInterface, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.i = glad_ret;
+        glad_gl_post_callback(237, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLint GLAD_API_PTR glad_debug_impl_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar * name) {
+    GladGLArgument glad_args[3];
+    GLint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].u = programInterface;
+    glad_args[2].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(238, glad_args, NULL);
+    glad_ret = glad_debug_glGetProgramResourceLocationIndex(program, programInterface, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.i = glad_ret;
+        glad_gl_post_callback(238, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = program;
+    glad_args[1].u = programInterface;
+    glad_args[2].u = index;
+    glad_args[3].i = bufSize;
+    glad_args[4].p = (const void *) length;
+    glad_args[5].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(239, glad_args, NULL);
+    glad_debug_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(239, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum * props, GLsizei count, GLsizei * length, GLint * params) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = program;
+    glad_args[1].u = programInterface;
+    glad_args[2].u = index;
+    glad_args[3].i = propCount;
+    glad_args[4].p = (const void *) props;
+    glad_args[5].i = count;
+    glad_args[6].p = (const void *) length;
+    glad_args[7].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(240, glad_args, NULL);
+    glad_debug_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(240, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].u = shadertype;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) values;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(241, glad_args, NULL);
+    glad_debug_glGetProgramStageiv(program, shadertype, pname, values);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(241, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetProgramiv(GLuint program, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(242, glad_args, NULL);
+    glad_debug_glGetProgramiv(program, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(242, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = id;
+    glad_args[1].u = buffer;
+    glad_args[2].u = pname;
+    glad_args[3].i = offset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(243, glad_args, NULL);
+    glad_debug_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(243, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = id;
+    glad_args[1].u = buffer;
+    glad_args[2].u = pname;
+    glad_args[3].i = offset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(244, glad_args, NULL);
+    glad_debug_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(244, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = id;
+    glad_args[1].u = buffer;
+    glad_args[2].u = pname;
+    glad_args[3].i = offset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(245, glad_args, NULL);
+    glad_debug_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(245, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = id;
+    glad_args[1].u = buffer;
+    glad_args[2].u = pname;
+    glad_args[3].i = offset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(246, glad_args, NULL);
+    glad_debug_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(246, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(247, glad_args, NULL);
+    glad_debug_glGetQueryIndexediv(target, index, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(247, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = id;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(248, glad_args, NULL);
+    glad_debug_glGetQueryObjecti64v(id, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(248, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryObjectiv(GLuint id, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = id;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(249, glad_args, NULL);
+    glad_debug_glGetQueryObjectiv(id, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(249, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = id;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(250, glad_args, NULL);
+    glad_debug_glGetQueryObjectui64v(id, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(250, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = id;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(251, glad_args, NULL);
+    glad_debug_glGetQueryObjectuiv(id, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(251, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetQueryiv(GLenum target, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(252, glad_args, NULL);
+    glad_debug_glGetQueryiv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(252, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(253, glad_args, NULL);
+    glad_debug_glGetRenderbufferParameteriv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(253, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(254, glad_args, NULL);
+    glad_debug_glGetSamplerParameterIiv(sampler, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(254, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(255, glad_args, NULL);
+    glad_debug_glGetSamplerParameterIuiv(sampler, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(255, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(256, glad_args, NULL);
+    glad_debug_glGetSamplerParameterfv(sampler, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(256, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(257, glad_args, NULL);
+    glad_debug_glGetSamplerParameteriv(sampler, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(257, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = shader;
+    glad_args[1].i = bufSize;
+    glad_args[2].p = (const void *) length;
+    glad_args[3].p = (const void *) infoLog;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(258, glad_args, NULL);
+    glad_debug_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(258, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint * range, GLint * precision) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = shadertype;
+    glad_args[1].u = precisiontype;
+    glad_args[2].p = (const void *) range;
+    glad_args[3].p = (const void *) precision;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(259, glad_args, NULL);
+    glad_debug_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(259, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = shader;
+    glad_args[1].i = bufSize;
+    glad_args[2].p = (const void *) length;
+    glad_args[3].p = (const void *) source;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(260, glad_args, NULL);
+    glad_debug_glGetShaderSource(shader, bufSize, length, source);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(260, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetShaderiv(GLuint shader, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = shader;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(261, glad_args, NULL);
+    glad_debug_glGetShaderiv(shader, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(261, glad_args, NULL);
+}
+static const GLubyte * GLAD_API_PTR glad_debug_impl_glGetString(GLenum name) {
+    GladGLArgument glad_args[1];
+    const GLubyte * glad_ret;
+    glad_args[0].u = name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(262, glad_args, NULL);
+    glad_ret = glad_debug_glGetString(name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.p = (const void *) glad_ret;
+        glad_gl_post_callback(262, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static const GLubyte * GLAD_API_PTR glad_debug_impl_glGetStringi(GLenum name, GLuint index) {
+    GladGLArgument glad_args[2];
+    const GLubyte * glad_ret;
+    glad_args[0].u = name;
+    glad_args[1].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(263, glad_args, NULL);
+    glad_ret = glad_debug_glGetStringi(name, index);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.p = (const void *) glad_ret;
+        glad_gl_post_callback(263, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLuint GLAD_API_PTR glad_debug_impl_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name) {
+    GladGLArgument glad_args[3];
+    GLuint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].u = shadertype;
+    glad_args[2].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(264, glad_args, NULL);
+    glad_ret = glad_debug_glGetSubroutineIndex(program, shadertype, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(264, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLint GLAD_API_PTR glad_debug_impl_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name) {
+    GladGLArgument glad_args[3];
+    GLint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].u = shadertype;
+    glad_args[2].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(265, glad_args, NULL);
+    glad_ret = glad_debug_glGetSubroutineUniformLocation(program, shadertype, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.i = glad_ret;
+        glad_gl_post_callback(265, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei * length, GLint * values) {
+    GladGLArgument glad_args[5];
+    glad_args[0].p = (const void *) sync;
+    glad_args[1].u = pname;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) length;
+    glad_args[4].p = (const void *) values;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(266, glad_args, NULL);
+    glad_debug_glGetSynciv(sync, pname, count, length, values);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(266, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = format;
+    glad_args[3].u = type;
+    glad_args[4].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(267, glad_args, NULL);
+    glad_debug_glGetTexImage(target, level, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(267, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(268, glad_args, NULL);
+    glad_debug_glGetTexLevelParameterfv(target, level, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(268, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(269, glad_args, NULL);
+    glad_debug_glGetTexLevelParameteriv(target, level, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(269, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTexParameterIiv(GLenum target, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(270, glad_args, NULL);
+    glad_debug_glGetTexParameterIiv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(270, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(271, glad_args, NULL);
+    glad_debug_glGetTexParameterIuiv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(271, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(272, glad_args, NULL);
+    glad_debug_glGetTexParameterfv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(272, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTexParameteriv(GLenum target, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(273, glad_args, NULL);
+    glad_debug_glGetTexParameteriv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(273, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].u = format;
+    glad_args[3].u = type;
+    glad_args[4].i = bufSize;
+    glad_args[5].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(274, glad_args, NULL);
+    glad_debug_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(274, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(275, glad_args, NULL);
+    glad_debug_glGetTextureLevelParameterfv(texture, level, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(275, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(276, glad_args, NULL);
+    glad_debug_glGetTextureLevelParameteriv(texture, level, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(276, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(277, glad_args, NULL);
+    glad_debug_glGetTextureParameterIiv(texture, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(277, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(278, glad_args, NULL);
+    glad_debug_glGetTextureParameterIuiv(texture, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(278, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(279, glad_args, NULL);
+    glad_debug_glGetTextureParameterfv(texture, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(279, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(280, glad_args, NULL);
+    glad_debug_glGetTextureParameteriv(texture, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(280, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    GladGLArgument glad_args[12];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    glad_args[8].u = format;
+    glad_args[9].u = type;
+    glad_args[10].i = bufSize;
+    glad_args[11].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(281, glad_args, NULL);
+    glad_debug_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(281, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = program;
+    glad_args[1].u = index;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) length;
+    glad_args[4].p = (const void *) size;
+    glad_args[5].p = (const void *) type;
+    glad_args[6].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(282, glad_args, NULL);
+    glad_debug_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(282, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 * param) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = xfb;
+    glad_args[1].u = pname;
+    glad_args[2].u = index;
+    glad_args[3].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(283, glad_args, NULL);
+    glad_debug_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(283, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint * param) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = xfb;
+    glad_args[1].u = pname;
+    glad_args[2].u = index;
+    glad_args[3].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(284, glad_args, NULL);
+    glad_debug_glGetTransformFeedbacki_v(xfb, pname, index, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(284, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = xfb;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(285, glad_args, NULL);
+    glad_debug_glGetTransformFeedbackiv(xfb, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(285, glad_args, NULL);
+}
+static GLuint GLAD_API_PTR glad_debug_impl_glGetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName) {
+    GladGLArgument glad_args[2];
+    GLuint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].p = (const void *) uniformBlockName;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(286, glad_args, NULL);
+    glad_ret = glad_debug_glGetUniformBlockIndex(program, uniformBlockName);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(286, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = uniformCount;
+    glad_args[2].p = (const void *) uniformNames;
+    glad_args[3].p = (const void *) uniformIndices;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(287, glad_args, NULL);
+    glad_debug_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(287, glad_args, NULL);
+}
+static GLint GLAD_API_PTR glad_debug_impl_glGetUniformLocation(GLuint program, const GLchar * name) {
+    GladGLArgument glad_args[2];
+    GLint glad_ret;
+    glad_args[0].u = program;
+    glad_args[1].p = (const void *) name;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(288, glad_args, NULL);
+    glad_ret = glad_debug_glGetUniformLocation(program, name);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.i = glad_ret;
+        glad_gl_post_callback(288, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = shadertype;
+    glad_args[1].i = location;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(289, glad_args, NULL);
+    glad_debug_glGetUniformSubroutineuiv(shadertype, location, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(289, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetUniformdv(GLuint program, GLint location, GLdouble * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(290, glad_args, NULL);
+    glad_debug_glGetUniformdv(program, location, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(290, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetUniformfv(GLuint program, GLint location, GLfloat * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(291, glad_args, NULL);
+    glad_debug_glGetUniformfv(program, location, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(291, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetUniformiv(GLuint program, GLint location, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(292, glad_args, NULL);
+    glad_debug_glGetUniformiv(program, location, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(292, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetUniformuiv(GLuint program, GLint location, GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(293, glad_args, NULL);
+    glad_debug_glGetUniformuiv(program, location, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(293, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 * param) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = index;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(294, glad_args, NULL);
+    glad_debug_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(294, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint * param) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = index;
+    glad_args[2].u = pname;
+    glad_args[3].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(295, glad_args, NULL);
+    glad_debug_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(295, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(296, glad_args, NULL);
+    glad_debug_glGetVertexArrayiv(vaobj, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(296, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(297, glad_args, NULL);
+    glad_debug_glGetVertexAttribIiv(index, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(297, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(298, glad_args, NULL);
+    glad_debug_glGetVertexAttribIuiv(index, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(298, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(299, glad_args, NULL);
+    glad_debug_glGetVertexAttribLdv(index, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(299, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) pointer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(300, glad_args, NULL);
+    glad_debug_glGetVertexAttribPointerv(index, pname, pointer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(300, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(301, glad_args, NULL);
+    glad_debug_glGetVertexAttribdv(index, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(301, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(302, glad_args, NULL);
+    glad_debug_glGetVertexAttribfv(index, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(302, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetVertexAttribiv(GLuint index, GLenum pname, GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(303, glad_args, NULL);
+    glad_debug_glGetVertexAttribiv(index, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(303, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void * pixels) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = lod;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(304, glad_args, NULL);
+    glad_debug_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(304, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void * pixels) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].u = format;
+    glad_args[3].u = type;
+    glad_args[4].i = bufSize;
+    glad_args[5].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(305, glad_args, NULL);
+    glad_debug_glGetnTexImage(target, level, format, type, bufSize, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(305, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(306, glad_args, NULL);
+    glad_debug_glGetnUniformdv(program, location, bufSize, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(306, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(307, glad_args, NULL);
+    glad_debug_glGetnUniformfv(program, location, bufSize, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(307, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(308, glad_args, NULL);
+    glad_debug_glGetnUniformiv(program, location, bufSize, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(308, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint * params) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = bufSize;
+    glad_args[3].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(309, glad_args, NULL);
+    glad_debug_glGetnUniformuiv(program, location, bufSize, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(309, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glHint(GLenum target, GLenum mode) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = target;
+    glad_args[1].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(310, glad_args, NULL);
+    glad_debug_glHint(target, mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(310, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateBufferData(GLuint buffer) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(311, glad_args, NULL);
+    glad_debug_glInvalidateBufferData(buffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(311, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = buffer;
+    glad_args[1].i = offset;
+    glad_args[2].i = length;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(312, glad_args, NULL);
+    glad_debug_glInvalidateBufferSubData(buffer, offset, length);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(312, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].i = numAttachments;
+    glad_args[2].p = (const void *) attachments;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(313, glad_args, NULL);
+    glad_debug_glInvalidateFramebuffer(target, numAttachments, attachments);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(313, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = framebuffer;
+    glad_args[1].i = numAttachments;
+    glad_args[2].p = (const void *) attachments;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(314, glad_args, NULL);
+    glad_debug_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(314, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = framebuffer;
+    glad_args[1].i = numAttachments;
+    glad_args[2].p = (const void *) attachments;
+    glad_args[3].i = x;
+    glad_args[4].i = y;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(315, glad_args, NULL);
+    glad_debug_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(315, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum * attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].i = numAttachments;
+    glad_args[2].p = (const void *) attachments;
+    glad_args[3].i = x;
+    glad_args[4].i = y;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(316, glad_args, NULL);
+    glad_debug_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(316, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateTexImage(GLuint texture, GLint level) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(317, glad_args, NULL);
+    glad_debug_glInvalidateTexImage(texture, level);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(317, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(318, glad_args, NULL);
+    glad_debug_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(318, glad_args, NULL);
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsBuffer(GLuint buffer) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(319, glad_args, NULL);
+    glad_ret = glad_debug_glIsBuffer(buffer);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(319, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsEnabled(GLenum cap) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = cap;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(320, glad_args, NULL);
+    glad_ret = glad_debug_glIsEnabled(cap);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(320, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsEnabledi(GLenum target, GLuint index) {
+    GladGLArgument glad_args[2];
+    GLboolean glad_ret;
+    glad_args[0].u = target;
+    glad_args[1].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(321, glad_args, NULL);
+    glad_ret = glad_debug_glIsEnabledi(target, index);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(321, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsFramebuffer(GLuint framebuffer) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = framebuffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(322, glad_args, NULL);
+    glad_ret = glad_debug_glIsFramebuffer(framebuffer);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(322, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsProgram(GLuint program) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = program;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(323, glad_args, NULL);
+    glad_ret = glad_debug_glIsProgram(program);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(323, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsProgramPipeline(GLuint pipeline) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = pipeline;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(324, glad_args, NULL);
+    glad_ret = glad_debug_glIsProgramPipeline(pipeline);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(324, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsQuery(GLuint id) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = id;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(325, glad_args, NULL);
+    glad_ret = glad_debug_glIsQuery(id);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(325, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsRenderbuffer(GLuint renderbuffer) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = renderbuffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(326, glad_args, NULL);
+    glad_ret = glad_debug_glIsRenderbuffer(renderbuffer);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(326, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsSampler(GLuint sampler) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = sampler;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(327, glad_args, NULL);
+    glad_ret = glad_debug_glIsSampler(sampler);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(327, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsShader(GLuint shader) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = shader;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(328, glad_args, NULL);
+    glad_ret = glad_debug_glIsShader(shader);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(328, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsSync(GLsync sync) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].p = (const void *) sync;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(329, glad_args, NULL);
+    glad_ret = glad_debug_glIsSync(sync);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(329, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsTexture(GLuint texture) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = texture;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(330, glad_args, NULL);
+    glad_ret = glad_debug_glIsTexture(texture);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(330, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsTransformFeedback(GLuint id) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = id;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(331, glad_args, NULL);
+    glad_ret = glad_debug_glIsTransformFeedback(id);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(331, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glIsVertexArray(GLuint array) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = array;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(332, glad_args, NULL);
+    glad_ret = glad_debug_glIsVertexArray(array);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(332, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glLineWidth(GLfloat width) {
+    GladGLArgument glad_args[1];
+    glad_args[0].f = width;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(333, glad_args, NULL);
+    glad_debug_glLineWidth(width);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(333, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glLinkProgram(GLuint program) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = program;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(334, glad_args, NULL);
+    glad_debug_glLinkProgram(program);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(334, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glLogicOp(GLenum opcode) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = opcode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(335, glad_args, NULL);
+    glad_debug_glLogicOp(opcode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(335, glad_args, NULL);
+}
+static void * GLAD_API_PTR glad_debug_impl_glMapBuffer(GLenum target, GLenum access) {
+    GladGLArgument glad_args[2];
+    void * glad_ret;
+    glad_args[0].u = target;
+    glad_args[1].u = access;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(336, glad_args, NULL);
+    glad_ret = glad_debug_glMapBuffer(target, access);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.p = (const void *) glad_ret;
+        glad_gl_post_callback(336, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void * GLAD_API_PTR glad_debug_impl_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    GladGLArgument glad_args[4];
+    void * glad_ret;
+    glad_args[0].u = target;
+    glad_args[1].i = offset;
+    glad_args[2].i = length;
+    glad_args[3].u = access;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(337, glad_args, NULL);
+    glad_ret = glad_debug_glMapBufferRange(target, offset, length, access);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.p = (const void *) glad_ret;
+        glad_gl_post_callback(337, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void * GLAD_API_PTR glad_debug_impl_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    GladGLArgument glad_args[2];
+    void * glad_ret;
+    glad_args[0].u = buffer;
+    glad_args[1].u = access;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(338, glad_args, NULL);
+    glad_ret = glad_debug_glMapNamedBuffer(buffer, access);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.p = (const void *) glad_ret;
+        glad_gl_post_callback(338, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void * GLAD_API_PTR glad_debug_impl_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    GladGLArgument glad_args[4];
+    void * glad_ret;
+    glad_args[0].u = buffer;
+    glad_args[1].i = offset;
+    glad_args[2].i = length;
+    glad_args[3].u = access;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(339, glad_args, NULL);
+    glad_ret = glad_debug_glMapNamedBufferRange(buffer, offset, length, access);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.p = (const void *) glad_ret;
+        glad_gl_post_callback(339, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glMemoryBarrier(GLbitfield barriers) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = barriers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(340, glad_args, NULL);
+    glad_debug_glMemoryBarrier(barriers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(340, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMemoryBarrierByRegion(GLbitfield barriers) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = barriers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(341, glad_args, NULL);
+    glad_debug_glMemoryBarrierByRegion(barriers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(341, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMinSampleShading(GLfloat value) {
+    GladGLArgument glad_args[1];
+    glad_args[0].f = value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(342, glad_args, NULL);
+    glad_debug_glMinSampleShading(value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(342, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = mode;
+    glad_args[1].p = (const void *) first;
+    glad_args[2].p = (const void *) count;
+    glad_args[3].i = drawcount;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(343, glad_args, NULL);
+    glad_debug_glMultiDrawArrays(mode, first, count, drawcount);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(343, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMultiDrawArraysIndirect(GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = mode;
+    glad_args[1].p = (const void *) indirect;
+    glad_args[2].i = drawcount;
+    glad_args[3].i = stride;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(344, glad_args, NULL);
+    glad_debug_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(344, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMultiDrawArraysIndirectCount(GLenum mode, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = mode;
+    glad_args[1].p = (const void *) indirect;
+    glad_args[2].i = drawcount;
+    glad_args[3].i = maxdrawcount;
+    glad_args[4].i = stride;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(345, glad_args, NULL);
+    glad_debug_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(345, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = mode;
+    glad_args[1].p = (const void *) count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    glad_args[4].i = drawcount;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(346, glad_args, NULL);
+    glad_debug_glMultiDrawElements(mode, count, type, indices, drawcount);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(346, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = mode;
+    glad_args[1].p = (const void *) count;
+    glad_args[2].u = type;
+    glad_args[3].p = (const void *) indices;
+    glad_args[4].i = drawcount;
+    glad_args[5].p = (const void *) basevertex;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(347, glad_args, NULL);
+    glad_debug_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(347, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = mode;
+    glad_args[1].u = type;
+    glad_args[2].p = (const void *) indirect;
+    glad_args[3].i = drawcount;
+    glad_args[4].i = stride;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(348, glad_args, NULL);
+    glad_debug_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(348, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = mode;
+    glad_args[1].u = type;
+    glad_args[2].p = (const void *) indirect;
+    glad_args[3].i = drawcount;
+    glad_args[4].i = maxdrawcount;
+    glad_args[5].i = stride;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(349, glad_args, NULL);
+    glad_debug_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(349, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void * data, GLenum usage) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = buffer;
+    glad_args[1].i = size;
+    glad_args[2].p = (const void *) data;
+    glad_args[3].u = usage;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(350, glad_args, NULL);
+    glad_debug_glNamedBufferData(buffer, size, data, usage);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(350, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void * data, GLbitfield flags) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = buffer;
+    glad_args[1].i = size;
+    glad_args[2].p = (const void *) data;
+    glad_args[3].u = flags;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(351, glad_args, NULL);
+    glad_debug_glNamedBufferStorage(buffer, size, data, flags);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(351, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void * data) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = buffer;
+    glad_args[1].i = offset;
+    glad_args[2].i = size;
+    glad_args[3].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(352, glad_args, NULL);
+    glad_debug_glNamedBufferSubData(buffer, offset, size, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(352, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = buf;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(353, glad_args, NULL);
+    glad_debug_glNamedFramebufferDrawBuffer(framebuffer, buf);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(353, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum * bufs) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = framebuffer;
+    glad_args[1].i = n;
+    glad_args[2].p = (const void *) bufs;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(354, glad_args, NULL);
+    glad_debug_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(354, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = pname;
+    glad_args[2].i = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(355, glad_args, NULL);
+    glad_debug_glNamedFramebufferParameteri(framebuffer, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(355, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = src;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(356, glad_args, NULL);
+    glad_debug_glNamedFramebufferReadBuffer(framebuffer, src);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(356, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = attachment;
+    glad_args[2].u = renderbuffertarget;
+    glad_args[3].u = renderbuffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(357, glad_args, NULL);
+    glad_debug_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(357, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = attachment;
+    glad_args[2].u = texture;
+    glad_args[3].i = level;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(358, glad_args, NULL);
+    glad_debug_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(358, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = framebuffer;
+    glad_args[1].u = attachment;
+    glad_args[2].u = texture;
+    glad_args[3].i = level;
+    glad_args[4].i = layer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(359, glad_args, NULL);
+    glad_debug_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(359, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = renderbuffer;
+    glad_args[1].u = internalformat;
+    glad_args[2].i = width;
+    glad_args[3].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(360, glad_args, NULL);
+    glad_debug_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(360, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = renderbuffer;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(361, glad_args, NULL);
+    glad_debug_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(361, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar * label) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = identifier;
+    glad_args[1].u = name;
+    glad_args[2].i = length;
+    glad_args[3].p = (const void *) label;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(362, glad_args, NULL);
+    glad_debug_glObjectLabel(identifier, name, length, label);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(362, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glObjectPtrLabel(const void * ptr, GLsizei length, const GLchar * label) {
+    GladGLArgument glad_args[3];
+    glad_args[0].p = (const void *) ptr;
+    glad_args[1].i = length;
+    glad_args[2].p = (const void *) label;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(363, glad_args, NULL);
+    glad_debug_glObjectPtrLabel(ptr, length, label);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(363, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPatchParameterfv(GLenum pname, const GLfloat * values) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) values;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(364, glad_args, NULL);
+    glad_debug_glPatchParameterfv(pname, values);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(364, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPatchParameteri(GLenum pname, GLint value) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].i = value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(365, glad_args, NULL);
+    glad_debug_glPatchParameteri(pname, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(365, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPauseTransformFeedback(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(366, NULL, NULL);
+    glad_debug_glPauseTransformFeedback();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(366, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPixelStoref(GLenum pname, GLfloat param) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].f = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(367, glad_args, NULL);
+    glad_debug_glPixelStoref(pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(367, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPixelStorei(GLenum pname, GLint param) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].i = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(368, glad_args, NULL);
+    glad_debug_glPixelStorei(pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(368, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPointParameterf(GLenum pname, GLfloat param) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].f = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(369, glad_args, NULL);
+    glad_debug_glPointParameterf(pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(369, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPointParameterfv(GLenum pname, const GLfloat * params) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(370, glad_args, NULL);
+    glad_debug_glPointParameterfv(pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(370, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPointParameteri(GLenum pname, GLint param) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].i = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(371, glad_args, NULL);
+    glad_debug_glPointParameteri(pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(371, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPointParameteriv(GLenum pname, const GLint * params) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = pname;
+    glad_args[1].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(372, glad_args, NULL);
+    glad_debug_glPointParameteriv(pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(372, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPointSize(GLfloat size) {
+    GladGLArgument glad_args[1];
+    glad_args[0].f = size;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(373, glad_args, NULL);
+    glad_debug_glPointSize(size);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(373, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPolygonMode(GLenum face, GLenum mode) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = face;
+    glad_args[1].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(374, glad_args, NULL);
+    glad_debug_glPolygonMode(face, mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(374, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPolygonOffset(GLfloat factor, GLfloat units) {
+    GladGLArgument glad_args[2];
+    glad_args[0].f = factor;
+    glad_args[1].f = units;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(375, glad_args, NULL);
+    glad_debug_glPolygonOffset(factor, units);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(375, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+    GladGLArgument glad_args[3];
+    glad_args[0].f = factor;
+    glad_args[1].f = units;
+    glad_args[2].f = clamp;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(376, glad_args, NULL);
+    glad_debug_glPolygonOffsetClamp(factor, units, clamp);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(376, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPopDebugGroup(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(377, NULL, NULL);
+    glad_debug_glPopDebugGroup();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(377, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPrimitiveRestartIndex(GLuint index) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = index;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(378, glad_args, NULL);
+    glad_debug_glPrimitiveRestartIndex(index);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(378, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramBinary(GLuint program, GLenum binaryFormat, const void * binary, GLsizei length) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].u = binaryFormat;
+    glad_args[2].p = (const void *) binary;
+    glad_args[3].i = length;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(379, glad_args, NULL);
+    glad_debug_glProgramBinary(program, binaryFormat, binary, length);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(379, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].u = pname;
+    glad_args[2].i = value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(380, glad_args, NULL);
+    glad_debug_glProgramParameteri(program, pname, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(380, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].d = v0;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(381, glad_args, NULL);
+    glad_debug_glProgramUniform1d(program, location, v0);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(381, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(382, glad_args, NULL);
+    glad_debug_glProgramUniform1dv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(382, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].f = v0;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(383, glad_args, NULL);
+    glad_debug_glProgramUniform1f(program, location, v0);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(383, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(384, glad_args, NULL);
+    glad_debug_glProgramUniform1fv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(384, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = v0;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(385, glad_args, NULL);
+    glad_debug_glProgramUniform1i(program, location, v0);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(385, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(386, glad_args, NULL);
+    glad_debug_glProgramUniform1iv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(386, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].u = v0;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(387, glad_args, NULL);
+    glad_debug_glProgramUniform1ui(program, location, v0);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(387, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(388, glad_args, NULL);
+    glad_debug_glProgramUniform1uiv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(388, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].d = v0;
+    glad_args[3].d = v1;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(389, glad_args, NULL);
+    glad_debug_glProgramUniform2d(program, location, v0, v1);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(389, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(390, glad_args, NULL);
+    glad_debug_glProgramUniform2dv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(390, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].f = v0;
+    glad_args[3].f = v1;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(391, glad_args, NULL);
+    glad_debug_glProgramUniform2f(program, location, v0, v1);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(391, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(392, glad_args, NULL);
+    glad_debug_glProgramUniform2fv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(392, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = v0;
+    glad_args[3].i = v1;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(393, glad_args, NULL);
+    glad_debug_glProgramUniform2i(program, location, v0, v1);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(393, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(394, glad_args, NULL);
+    glad_debug_glProgramUniform2iv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(394, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].u = v0;
+    glad_args[3].u = v1;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(395, glad_args, NULL);
+    glad_debug_glProgramUniform2ui(program, location, v0, v1);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(395, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(396, glad_args, NULL);
+    glad_debug_glProgramUniform2uiv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(396, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].d = v0;
+    glad_args[3].d = v1;
+    glad_args[4].d = v2;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(397, glad_args, NULL);
+    glad_debug_glProgramUniform3d(program, location, v0, v1, v2);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(397, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(398, glad_args, NULL);
+    glad_debug_glProgramUniform3dv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(398, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].f = v0;
+    glad_args[3].f = v1;
+    glad_args[4].f = v2;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(399, glad_args, NULL);
+    glad_debug_glProgramUniform3f(program, location, v0, v1, v2);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(399, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(400, glad_args, NULL);
+    glad_debug_glProgramUniform3fv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(400, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = v0;
+    glad_args[3].i = v1;
+    glad_args[4].i = v2;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(401, glad_args, NULL);
+    glad_debug_glProgramUniform3i(program, location, v0, v1, v2);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(401, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(402, glad_args, NULL);
+    glad_debug_glProgramUniform3iv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(402, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].u = v0;
+    glad_args[3].u = v1;
+    glad_args[4].u = v2;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(403, glad_args, NULL);
+    glad_debug_glProgramUniform3ui(program, location, v0, v1, v2);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(403, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(404, glad_args, NULL);
+    glad_debug_glProgramUniform3uiv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(404, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].d = v0;
+    glad_args[3].d = v1;
+    glad_args[4].d = v2;
+    glad_args[5].d = v3;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(405, glad_args, NULL);
+    glad_debug_glProgramUniform4d(program, location, v0, v1, v2, v3);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(405, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(406, glad_args, NULL);
+    glad_debug_glProgramUniform4dv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(406, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].f = v0;
+    glad_args[3].f = v1;
+    glad_args[4].f = v2;
+    glad_args[5].f = v3;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(407, glad_args, NULL);
+    glad_debug_glProgramUniform4f(program, location, v0, v1, v2, v3);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(407, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(408, glad_args, NULL);
+    glad_debug_glProgramUniform4fv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(408, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = v0;
+    glad_args[3].i = v1;
+    glad_args[4].i = v2;
+    glad_args[5].i = v3;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(409, glad_args, NULL);
+    glad_debug_glProgramUniform4i(program, location, v0, v1, v2, v3);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(409, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(410, glad_args, NULL);
+    glad_debug_glProgramUniform4iv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(410, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].u = v0;
+    glad_args[3].u = v1;
+    glad_args[4].u = v2;
+    glad_args[5].u = v3;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(411, glad_args, NULL);
+    glad_debug_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(411, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(412, glad_args, NULL);
+    glad_debug_glProgramUniform4uiv(program, location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(412, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(413, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(413, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(414, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(414, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(415, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(415, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(416, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(416, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(417, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(417, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(418, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(418, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(419, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(419, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(420, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(420, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(421, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(421, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(422, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(422, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(423, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(423, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(424, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(424, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(425, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(425, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(426, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(426, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(427, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(427, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(428, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(428, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(429, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(429, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = program;
+    glad_args[1].i = location;
+    glad_args[2].i = count;
+    glad_args[3].u = transpose;
+    glad_args[4].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(430, glad_args, NULL);
+    glad_debug_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(430, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glProvokingVertex(GLenum mode) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = mode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(431, glad_args, NULL);
+    glad_debug_glProvokingVertex(mode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(431, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar * message) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = source;
+    glad_args[1].u = id;
+    glad_args[2].i = length;
+    glad_args[3].p = (const void *) message;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(432, glad_args, NULL);
+    glad_debug_glPushDebugGroup(source, id, length, message);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(432, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glQueryCounter(GLuint id, GLenum target) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = id;
+    glad_args[1].u = target;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(433, glad_args, NULL);
+    glad_debug_glQueryCounter(id, target);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(433, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glReadBuffer(GLenum src) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = src;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(434, glad_args, NULL);
+    glad_debug_glReadBuffer(src);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(434, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels) {
+    GladGLArgument glad_args[7];
+    glad_args[0].i = x;
+    glad_args[1].i = y;
+    glad_args[2].i = width;
+    glad_args[3].i = height;
+    glad_args[4].u = format;
+    glad_args[5].u = type;
+    glad_args[6].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(435, glad_args, NULL);
+    glad_debug_glReadPixels(x, y, width, height, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(435, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void * data) {
+    GladGLArgument glad_args[8];
+    glad_args[0].i = x;
+    glad_args[1].i = y;
+    glad_args[2].i = width;
+    glad_args[3].i = height;
+    glad_args[4].u = format;
+    glad_args[5].u = type;
+    glad_args[6].i = bufSize;
+    glad_args[7].p = (const void *) data;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(436, glad_args, NULL);
+    glad_debug_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(436, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glReleaseShaderCompiler(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(437, NULL, NULL);
+    glad_debug_glReleaseShaderCompiler();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(437, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].u = internalformat;
+    glad_args[2].i = width;
+    glad_args[3].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(438, glad_args, NULL);
+    glad_debug_glRenderbufferStorage(target, internalformat, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(438, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(439, glad_args, NULL);
+    glad_debug_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(439, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glResumeTransformFeedback(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(440, NULL, NULL);
+    glad_debug_glResumeTransformFeedback();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(440, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSampleCoverage(GLfloat value, GLboolean invert) {
+    GladGLArgument glad_args[2];
+    glad_args[0].f = value;
+    glad_args[1].u = invert;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(441, glad_args, NULL);
+    glad_debug_glSampleCoverage(value, invert);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(441, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = maskNumber;
+    glad_args[1].u = mask;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(442, glad_args, NULL);
+    glad_debug_glSampleMaski(maskNumber, mask);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(442, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(443, glad_args, NULL);
+    glad_debug_glSamplerParameterIiv(sampler, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(443, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(444, glad_args, NULL);
+    glad_debug_glSamplerParameterIuiv(sampler, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(444, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].f = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(445, glad_args, NULL);
+    glad_debug_glSamplerParameterf(sampler, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(445, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(446, glad_args, NULL);
+    glad_debug_glSamplerParameterfv(sampler, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(446, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].i = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(447, glad_args, NULL);
+    glad_debug_glSamplerParameteri(sampler, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(447, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = sampler;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(448, glad_args, NULL);
+    glad_debug_glSamplerParameteriv(sampler, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(448, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = x;
+    glad_args[1].i = y;
+    glad_args[2].i = width;
+    glad_args[3].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(449, glad_args, NULL);
+    glad_debug_glScissor(x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(449, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glScissorArrayv(GLuint first, GLsizei count, const GLint * v) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = first;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(450, glad_args, NULL);
+    glad_debug_glScissorArrayv(first, count, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(450, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].i = left;
+    glad_args[2].i = bottom;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(451, glad_args, NULL);
+    glad_debug_glScissorIndexed(index, left, bottom, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(451, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glScissorIndexedv(GLuint index, const GLint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(452, glad_args, NULL);
+    glad_debug_glScissorIndexedv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(452, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glShaderBinary(GLsizei count, const GLuint * shaders, GLenum binaryFormat, const void * binary, GLsizei length) {
+    GladGLArgument glad_args[5];
+    glad_args[0].i = count;
+    glad_args[1].p = (const void *) shaders;
+    glad_args[2].u = binaryFormat;
+    glad_args[3].p = (const void *) binary;
+    glad_args[4].i = length;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(453, glad_args, NULL);
+    glad_debug_glShaderBinary(count, shaders, binaryFormat, binary, length);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(453, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = shader;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) string;
+    glad_args[3].p = (const void *) length;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(454, glad_args, NULL);
+    glad_debug_glShaderSource(shader, count, string, length);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(454, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].u = storageBlockIndex;
+    glad_args[2].u = storageBlockBinding;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(455, glad_args, NULL);
+    glad_debug_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(455, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glSpecializeShader(GLuint shader, const GLchar * pEntryPoint, GLuint numSpecializationConstants, const GLuint * pConstantIndex, const GLuint * pConstantValue) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = shader;
+    glad_args[1].p = (const void *) pEntryPoint;
+    glad_args[2].u = numSpecializationConstants;
+    glad_args[3].p = (const void *) pConstantIndex;
+    glad_args[4].p = (const void *) pConstantValue;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(456, glad_args, NULL);
+    glad_debug_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(456, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = func;
+    glad_args[1].i = ref;
+    glad_args[2].u = mask;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(457, glad_args, NULL);
+    glad_debug_glStencilFunc(func, ref, mask);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(457, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = face;
+    glad_args[1].u = func;
+    glad_args[2].i = ref;
+    glad_args[3].u = mask;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(458, glad_args, NULL);
+    glad_debug_glStencilFuncSeparate(face, func, ref, mask);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(458, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glStencilMask(GLuint mask) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = mask;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(459, glad_args, NULL);
+    glad_debug_glStencilMask(mask);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(459, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = face;
+    glad_args[1].u = mask;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(460, glad_args, NULL);
+    glad_debug_glStencilMaskSeparate(face, mask);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(460, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = fail;
+    glad_args[1].u = zfail;
+    glad_args[2].u = zpass;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(461, glad_args, NULL);
+    glad_debug_glStencilOp(fail, zfail, zpass);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(461, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = face;
+    glad_args[1].u = sfail;
+    glad_args[2].u = dpfail;
+    glad_args[3].u = dppass;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(462, glad_args, NULL);
+    glad_debug_glStencilOpSeparate(face, sfail, dpfail, dppass);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(462, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(463, glad_args, NULL);
+    glad_debug_glTexBuffer(target, internalformat, buffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(463, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = buffer;
+    glad_args[3].i = offset;
+    glad_args[4].i = size;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(464, glad_args, NULL);
+    glad_debug_glTexBufferRange(target, internalformat, buffer, offset, size);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(464, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = border;
+    glad_args[5].u = format;
+    glad_args[6].u = type;
+    glad_args[7].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(465, glad_args, NULL);
+    glad_debug_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(465, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = border;
+    glad_args[6].u = format;
+    glad_args[7].u = type;
+    glad_args[8].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(466, glad_args, NULL);
+    glad_debug_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(466, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = target;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].u = fixedsamplelocations;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(467, glad_args, NULL);
+    glad_debug_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(467, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[10];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = depth;
+    glad_args[6].i = border;
+    glad_args[7].u = format;
+    glad_args[8].u = type;
+    glad_args[9].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(468, glad_args, NULL);
+    glad_debug_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(468, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = depth;
+    glad_args[6].u = fixedsamplelocations;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(469, glad_args, NULL);
+    glad_debug_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(469, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexParameterIiv(GLenum target, GLenum pname, const GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(470, glad_args, NULL);
+    glad_debug_glTexParameterIiv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(470, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(471, glad_args, NULL);
+    glad_debug_glTexParameterIuiv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(471, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].f = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(472, glad_args, NULL);
+    glad_debug_glTexParameterf(target, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(472, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexParameterfv(GLenum target, GLenum pname, const GLfloat * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(473, glad_args, NULL);
+    glad_debug_glTexParameterfv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(473, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].i = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(474, glad_args, NULL);
+    glad_debug_glTexParameteri(target, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(474, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexParameteriv(GLenum target, GLenum pname, const GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = target;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(475, glad_args, NULL);
+    glad_debug_glTexParameteriv(target, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(475, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = target;
+    glad_args[1].i = levels;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(476, glad_args, NULL);
+    glad_debug_glTexStorage1D(target, levels, internalformat, width);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(476, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = target;
+    glad_args[1].i = levels;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(477, glad_args, NULL);
+    glad_debug_glTexStorage2D(target, levels, internalformat, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(477, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = target;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].u = fixedsamplelocations;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(478, glad_args, NULL);
+    glad_debug_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(478, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = target;
+    glad_args[1].i = levels;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = depth;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(479, glad_args, NULL);
+    glad_debug_glTexStorage3D(target, levels, internalformat, width, height, depth);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(479, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = depth;
+    glad_args[6].u = fixedsamplelocations;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(480, glad_args, NULL);
+    glad_debug_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(480, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = width;
+    glad_args[4].u = format;
+    glad_args[5].u = type;
+    glad_args[6].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(481, glad_args, NULL);
+    glad_debug_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(481, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = width;
+    glad_args[5].i = height;
+    glad_args[6].u = format;
+    glad_args[7].u = type;
+    glad_args[8].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(482, glad_args, NULL);
+    glad_debug_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(482, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[11];
+    glad_args[0].u = target;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    glad_args[8].u = format;
+    glad_args[9].u = type;
+    glad_args[10].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(483, glad_args, NULL);
+    glad_debug_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(483, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureBarrier(void) {
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(484, NULL, NULL);
+    glad_debug_glTextureBarrier();
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(484, NULL, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(485, glad_args, NULL);
+    glad_debug_glTextureBuffer(texture, internalformat, buffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(485, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = texture;
+    glad_args[1].u = internalformat;
+    glad_args[2].u = buffer;
+    glad_args[3].i = offset;
+    glad_args[4].i = size;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(486, glad_args, NULL);
+    glad_debug_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(486, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(487, glad_args, NULL);
+    glad_debug_glTextureParameterIiv(texture, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(487, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint * params) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) params;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(488, glad_args, NULL);
+    glad_debug_glTextureParameterIuiv(texture, pname, params);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(488, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].f = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(489, glad_args, NULL);
+    glad_debug_glTextureParameterf(texture, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(489, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(490, glad_args, NULL);
+    glad_debug_glTextureParameterfv(texture, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(490, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].i = param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(491, glad_args, NULL);
+    glad_debug_glTextureParameteri(texture, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(491, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureParameteriv(GLuint texture, GLenum pname, const GLint * param) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = texture;
+    glad_args[1].u = pname;
+    glad_args[2].p = (const void *) param;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(492, glad_args, NULL);
+    glad_debug_glTextureParameteriv(texture, pname, param);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(492, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = texture;
+    glad_args[1].i = levels;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(493, glad_args, NULL);
+    glad_debug_glTextureStorage1D(texture, levels, internalformat, width);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(493, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = texture;
+    glad_args[1].i = levels;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(494, glad_args, NULL);
+    glad_debug_glTextureStorage2D(texture, levels, internalformat, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(494, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = texture;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].u = fixedsamplelocations;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(495, glad_args, NULL);
+    glad_debug_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(495, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = texture;
+    glad_args[1].i = levels;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = depth;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(496, glad_args, NULL);
+    glad_debug_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(496, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = texture;
+    glad_args[1].i = samples;
+    glad_args[2].u = internalformat;
+    glad_args[3].i = width;
+    glad_args[4].i = height;
+    glad_args[5].i = depth;
+    glad_args[6].u = fixedsamplelocations;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(497, glad_args, NULL);
+    glad_debug_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(497, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[7];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = width;
+    glad_args[4].u = format;
+    glad_args[5].u = type;
+    glad_args[6].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(498, glad_args, NULL);
+    glad_debug_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(498, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[9];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = width;
+    glad_args[5].i = height;
+    glad_args[6].u = format;
+    glad_args[7].u = type;
+    glad_args[8].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(499, glad_args, NULL);
+    glad_debug_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(499, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    GladGLArgument glad_args[11];
+    glad_args[0].u = texture;
+    glad_args[1].i = level;
+    glad_args[2].i = xoffset;
+    glad_args[3].i = yoffset;
+    glad_args[4].i = zoffset;
+    glad_args[5].i = width;
+    glad_args[6].i = height;
+    glad_args[7].i = depth;
+    glad_args[8].u = format;
+    glad_args[9].u = type;
+    glad_args[10].p = (const void *) pixels;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(500, glad_args, NULL);
+    glad_debug_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(500, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+    GladGLArgument glad_args[8];
+    glad_args[0].u = texture;
+    glad_args[1].u = target;
+    glad_args[2].u = origtexture;
+    glad_args[3].u = internalformat;
+    glad_args[4].u = minlevel;
+    glad_args[5].u = numlevels;
+    glad_args[6].u = minlayer;
+    glad_args[7].u = numlayers;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(501, glad_args, NULL);
+    glad_debug_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(501, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = xfb;
+    glad_args[1].u = index;
+    glad_args[2].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(502, glad_args, NULL);
+    glad_debug_glTransformFeedbackBufferBase(xfb, index, buffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(502, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = xfb;
+    glad_args[1].u = index;
+    glad_args[2].u = buffer;
+    glad_args[3].i = offset;
+    glad_args[4].i = size;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(503, glad_args, NULL);
+    glad_debug_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(503, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = program;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) varyings;
+    glad_args[3].u = bufferMode;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(504, glad_args, NULL);
+    glad_debug_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(504, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1d(GLint location, GLdouble x) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = location;
+    glad_args[1].d = x;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(505, glad_args, NULL);
+    glad_debug_glUniform1d(location, x);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(505, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1dv(GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(506, glad_args, NULL);
+    glad_debug_glUniform1dv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(506, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1f(GLint location, GLfloat v0) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = location;
+    glad_args[1].f = v0;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(507, glad_args, NULL);
+    glad_debug_glUniform1f(location, v0);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(507, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1fv(GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(508, glad_args, NULL);
+    glad_debug_glUniform1fv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(508, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1i(GLint location, GLint v0) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = location;
+    glad_args[1].i = v0;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(509, glad_args, NULL);
+    glad_debug_glUniform1i(location, v0);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(509, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1iv(GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(510, glad_args, NULL);
+    glad_debug_glUniform1iv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(510, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1ui(GLint location, GLuint v0) {
+    GladGLArgument glad_args[2];
+    glad_args[0].i = location;
+    glad_args[1].u = v0;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(511, glad_args, NULL);
+    glad_debug_glUniform1ui(location, v0);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(511, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform1uiv(GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(512, glad_args, NULL);
+    glad_debug_glUniform1uiv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(512, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(513, glad_args, NULL);
+    glad_debug_glUniform2d(location, x, y);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(513, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2dv(GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(514, glad_args, NULL);
+    glad_debug_glUniform2dv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(514, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].f = v0;
+    glad_args[2].f = v1;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(515, glad_args, NULL);
+    glad_debug_glUniform2f(location, v0, v1);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(515, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2fv(GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(516, glad_args, NULL);
+    glad_debug_glUniform2fv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(516, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2i(GLint location, GLint v0, GLint v1) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = v0;
+    glad_args[2].i = v1;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(517, glad_args, NULL);
+    glad_debug_glUniform2i(location, v0, v1);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(517, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2iv(GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(518, glad_args, NULL);
+    glad_debug_glUniform2iv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(518, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].u = v0;
+    glad_args[2].u = v1;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(519, glad_args, NULL);
+    glad_debug_glUniform2ui(location, v0, v1);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(519, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform2uiv(GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(520, glad_args, NULL);
+    glad_debug_glUniform2uiv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(520, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    glad_args[3].d = z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(521, glad_args, NULL);
+    glad_debug_glUniform3d(location, x, y, z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(521, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3dv(GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(522, glad_args, NULL);
+    glad_debug_glUniform3dv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(522, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].f = v0;
+    glad_args[2].f = v1;
+    glad_args[3].f = v2;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(523, glad_args, NULL);
+    glad_debug_glUniform3f(location, v0, v1, v2);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(523, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3fv(GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(524, glad_args, NULL);
+    glad_debug_glUniform3fv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(524, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = v0;
+    glad_args[2].i = v1;
+    glad_args[3].i = v2;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(525, glad_args, NULL);
+    glad_debug_glUniform3i(location, v0, v1, v2);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(525, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3iv(GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(526, glad_args, NULL);
+    glad_debug_glUniform3iv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(526, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].u = v0;
+    glad_args[2].u = v1;
+    glad_args[3].u = v2;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(527, glad_args, NULL);
+    glad_debug_glUniform3ui(location, v0, v1, v2);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(527, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform3uiv(GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(528, glad_args, NULL);
+    glad_debug_glUniform3uiv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(528, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].i = location;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    glad_args[3].d = z;
+    glad_args[4].d = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(529, glad_args, NULL);
+    glad_debug_glUniform4d(location, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(529, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4dv(GLint location, GLsizei count, const GLdouble * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(530, glad_args, NULL);
+    glad_debug_glUniform4dv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(530, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    GladGLArgument glad_args[5];
+    glad_args[0].i = location;
+    glad_args[1].f = v0;
+    glad_args[2].f = v1;
+    glad_args[3].f = v2;
+    glad_args[4].f = v3;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(531, glad_args, NULL);
+    glad_debug_glUniform4f(location, v0, v1, v2, v3);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(531, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4fv(GLint location, GLsizei count, const GLfloat * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(532, glad_args, NULL);
+    glad_debug_glUniform4fv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(532, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    GladGLArgument glad_args[5];
+    glad_args[0].i = location;
+    glad_args[1].i = v0;
+    glad_args[2].i = v1;
+    glad_args[3].i = v2;
+    glad_args[4].i = v3;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(533, glad_args, NULL);
+    glad_debug_glUniform4i(location, v0, v1, v2, v3);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(533, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4iv(GLint location, GLsizei count, const GLint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(534, glad_args, NULL);
+    glad_debug_glUniform4iv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(534, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    GladGLArgument glad_args[5];
+    glad_args[0].i = location;
+    glad_args[1].u = v0;
+    glad_args[2].u = v1;
+    glad_args[3].u = v2;
+    glad_args[4].u = v3;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(535, glad_args, NULL);
+    glad_debug_glUniform4ui(location, v0, v1, v2, v3);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(535, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniform4uiv(GLint location, GLsizei count, const GLuint * value) {
+    GladGLArgument glad_args[3];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(536, glad_args, NULL);
+    glad_debug_glUniform4uiv(location, count, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(536, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = program;
+    glad_args[1].u = uniformBlockIndex;
+    glad_args[2].u = uniformBlockBinding;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(537, glad_args, NULL);
+    glad_debug_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(537, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(538, glad_args, NULL);
+    glad_debug_glUniformMatrix2dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(538, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(539, glad_args, NULL);
+    glad_debug_glUniformMatrix2fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(539, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(540, glad_args, NULL);
+    glad_debug_glUniformMatrix2x3dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(540, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(541, glad_args, NULL);
+    glad_debug_glUniformMatrix2x3fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(541, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(542, glad_args, NULL);
+    glad_debug_glUniformMatrix2x4dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(542, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(543, glad_args, NULL);
+    glad_debug_glUniformMatrix2x4fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(543, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(544, glad_args, NULL);
+    glad_debug_glUniformMatrix3dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(544, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(545, glad_args, NULL);
+    glad_debug_glUniformMatrix3fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(545, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(546, glad_args, NULL);
+    glad_debug_glUniformMatrix3x2dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(546, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(547, glad_args, NULL);
+    glad_debug_glUniformMatrix3x2fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(547, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(548, glad_args, NULL);
+    glad_debug_glUniformMatrix3x4dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(548, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(549, glad_args, NULL);
+    glad_debug_glUniformMatrix3x4fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(549, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(550, glad_args, NULL);
+    glad_debug_glUniformMatrix4dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(550, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(551, glad_args, NULL);
+    glad_debug_glUniformMatrix4fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(551, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(552, glad_args, NULL);
+    glad_debug_glUniformMatrix4x2dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(552, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(553, glad_args, NULL);
+    glad_debug_glUniformMatrix4x2fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(553, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(554, glad_args, NULL);
+    glad_debug_glUniformMatrix4x3dv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(554, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = location;
+    glad_args[1].i = count;
+    glad_args[2].u = transpose;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(555, glad_args, NULL);
+    glad_debug_glUniformMatrix4x3fv(location, count, transpose, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(555, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = shadertype;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) indices;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(556, glad_args, NULL);
+    glad_debug_glUniformSubroutinesuiv(shadertype, count, indices);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(556, glad_args, NULL);
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glUnmapBuffer(GLenum target) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = target;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(557, glad_args, NULL);
+    glad_ret = glad_debug_glUnmapBuffer(target);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(557, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static GLboolean GLAD_API_PTR glad_debug_impl_glUnmapNamedBuffer(GLuint buffer) {
+    GladGLArgument glad_args[1];
+    GLboolean glad_ret;
+    glad_args[0].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(558, glad_args, NULL);
+    glad_ret = glad_debug_glUnmapNamedBuffer(buffer);
+    if(glad_gl_post_callback != NULL) {
+        GladGLArgument glad_result;
+        glad_result.u = glad_ret;
+        glad_gl_post_callback(558, glad_args, &glad_result);
+    }
+    return glad_ret;
+}
+static void GLAD_API_PTR glad_debug_impl_glUseProgram(GLuint program) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = program;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(559, glad_args, NULL);
+    glad_debug_glUseProgram(program);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(559, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = pipeline;
+    glad_args[1].u = stages;
+    glad_args[2].u = program;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(560, glad_args, NULL);
+    glad_debug_glUseProgramStages(pipeline, stages, program);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(560, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glValidateProgram(GLuint program) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = program;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(561, glad_args, NULL);
+    glad_debug_glValidateProgram(program);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(561, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glValidateProgramPipeline(GLuint pipeline) {
+    GladGLArgument glad_args[1];
+    glad_args[0].u = pipeline;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(562, glad_args, NULL);
+    glad_debug_glValidateProgramPipeline(pipeline);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(562, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = attribindex;
+    glad_args[2].u = bindingindex;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(563, glad_args, NULL);
+    glad_debug_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(563, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = attribindex;
+    glad_args[2].i = size;
+    glad_args[3].u = type;
+    glad_args[4].u = normalized;
+    glad_args[5].u = relativeoffset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(564, glad_args, NULL);
+    glad_debug_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(564, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = attribindex;
+    glad_args[2].i = size;
+    glad_args[3].u = type;
+    glad_args[4].u = relativeoffset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(565, glad_args, NULL);
+    glad_debug_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(565, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = attribindex;
+    glad_args[2].i = size;
+    glad_args[3].u = type;
+    glad_args[4].u = relativeoffset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(566, glad_args, NULL);
+    glad_debug_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(566, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = bindingindex;
+    glad_args[2].u = divisor;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(567, glad_args, NULL);
+    glad_debug_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(567, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = buffer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(568, glad_args, NULL);
+    glad_debug_glVertexArrayElementBuffer(vaobj, buffer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(568, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = bindingindex;
+    glad_args[2].u = buffer;
+    glad_args[3].i = offset;
+    glad_args[4].i = stride;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(569, glad_args, NULL);
+    glad_debug_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(569, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizei * strides) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = vaobj;
+    glad_args[1].u = first;
+    glad_args[2].i = count;
+    glad_args[3].p = (const void *) buffers;
+    glad_args[4].p = (const void *) offsets;
+    glad_args[5].p = (const void *) strides;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(570, glad_args, NULL);
+    glad_debug_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(570, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib1d(GLuint index, GLdouble x) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(571, glad_args, NULL);
+    glad_debug_glVertexAttrib1d(index, x);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(571, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib1dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(572, glad_args, NULL);
+    glad_debug_glVertexAttrib1dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(572, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib1f(GLuint index, GLfloat x) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].f = x;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(573, glad_args, NULL);
+    glad_debug_glVertexAttrib1f(index, x);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(573, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib1fv(GLuint index, const GLfloat * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(574, glad_args, NULL);
+    glad_debug_glVertexAttrib1fv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(574, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib1s(GLuint index, GLshort x) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(575, glad_args, NULL);
+    glad_debug_glVertexAttrib1s(index, x);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(575, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib1sv(GLuint index, const GLshort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(576, glad_args, NULL);
+    glad_debug_glVertexAttrib1sv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(576, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(577, glad_args, NULL);
+    glad_debug_glVertexAttrib2d(index, x, y);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(577, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib2dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(578, glad_args, NULL);
+    glad_debug_glVertexAttrib2dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(578, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].f = x;
+    glad_args[2].f = y;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(579, glad_args, NULL);
+    glad_debug_glVertexAttrib2f(index, x, y);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(579, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib2fv(GLuint index, const GLfloat * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(580, glad_args, NULL);
+    glad_debug_glVertexAttrib2fv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(580, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    glad_args[2].i = y;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(581, glad_args, NULL);
+    glad_debug_glVertexAttrib2s(index, x, y);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(581, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib2sv(GLuint index, const GLshort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(582, glad_args, NULL);
+    glad_debug_glVertexAttrib2sv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(582, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    glad_args[3].d = z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(583, glad_args, NULL);
+    glad_debug_glVertexAttrib3d(index, x, y, z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(583, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib3dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(584, glad_args, NULL);
+    glad_debug_glVertexAttrib3dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(584, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].f = x;
+    glad_args[2].f = y;
+    glad_args[3].f = z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(585, glad_args, NULL);
+    glad_debug_glVertexAttrib3f(index, x, y, z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(585, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib3fv(GLuint index, const GLfloat * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(586, glad_args, NULL);
+    glad_debug_glVertexAttrib3fv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(586, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    glad_args[2].i = y;
+    glad_args[3].i = z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(587, glad_args, NULL);
+    glad_debug_glVertexAttrib3s(index, x, y, z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(587, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib3sv(GLuint index, const GLshort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(588, glad_args, NULL);
+    glad_debug_glVertexAttrib3sv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(588, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4Nbv(GLuint index, const GLbyte * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(589, glad_args, NULL);
+    glad_debug_glVertexAttrib4Nbv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(589, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4Niv(GLuint index, const GLint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(590, glad_args, NULL);
+    glad_debug_glVertexAttrib4Niv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(590, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4Nsv(GLuint index, const GLshort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(591, glad_args, NULL);
+    glad_debug_glVertexAttrib4Nsv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(591, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].u = x;
+    glad_args[2].u = y;
+    glad_args[3].u = z;
+    glad_args[4].u = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(592, glad_args, NULL);
+    glad_debug_glVertexAttrib4Nub(index, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(592, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4Nubv(GLuint index, const GLubyte * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(593, glad_args, NULL);
+    glad_debug_glVertexAttrib4Nubv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(593, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4Nuiv(GLuint index, const GLuint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(594, glad_args, NULL);
+    glad_debug_glVertexAttrib4Nuiv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(594, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4Nusv(GLuint index, const GLushort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(595, glad_args, NULL);
+    glad_debug_glVertexAttrib4Nusv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(595, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4bv(GLuint index, const GLbyte * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(596, glad_args, NULL);
+    glad_debug_glVertexAttrib4bv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(596, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    glad_args[3].d = z;
+    glad_args[4].d = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(597, glad_args, NULL);
+    glad_debug_glVertexAttrib4d(index, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(597, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(598, glad_args, NULL);
+    glad_debug_glVertexAttrib4dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(598, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].f = x;
+    glad_args[2].f = y;
+    glad_args[3].f = z;
+    glad_args[4].f = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(599, glad_args, NULL);
+    glad_debug_glVertexAttrib4f(index, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(599, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4fv(GLuint index, const GLfloat * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(600, glad_args, NULL);
+    glad_debug_glVertexAttrib4fv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(600, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4iv(GLuint index, const GLint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(601, glad_args, NULL);
+    glad_debug_glVertexAttrib4iv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(601, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    glad_args[2].i = y;
+    glad_args[3].i = z;
+    glad_args[4].i = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(602, glad_args, NULL);
+    glad_debug_glVertexAttrib4s(index, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(602, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4sv(GLuint index, const GLshort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(603, glad_args, NULL);
+    glad_debug_glVertexAttrib4sv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(603, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4ubv(GLuint index, const GLubyte * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(604, glad_args, NULL);
+    glad_debug_glVertexAttrib4ubv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(604, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4uiv(GLuint index, const GLuint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(605, glad_args, NULL);
+    glad_debug_glVertexAttrib4uiv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(605, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttrib4usv(GLuint index, const GLushort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(606, glad_args, NULL);
+    glad_debug_glVertexAttrib4usv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(606, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = attribindex;
+    glad_args[1].u = bindingindex;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(607, glad_args, NULL);
+    glad_debug_glVertexAttribBinding(attribindex, bindingindex);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(607, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].u = divisor;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(608, glad_args, NULL);
+    glad_debug_glVertexAttribDivisor(index, divisor);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(608, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = attribindex;
+    glad_args[1].i = size;
+    glad_args[2].u = type;
+    glad_args[3].u = normalized;
+    glad_args[4].u = relativeoffset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(609, glad_args, NULL);
+    glad_debug_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(609, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI1i(GLuint index, GLint x) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(610, glad_args, NULL);
+    glad_debug_glVertexAttribI1i(index, x);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(610, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI1iv(GLuint index, const GLint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(611, glad_args, NULL);
+    glad_debug_glVertexAttribI1iv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(611, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI1ui(GLuint index, GLuint x) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].u = x;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(612, glad_args, NULL);
+    glad_debug_glVertexAttribI1ui(index, x);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(612, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI1uiv(GLuint index, const GLuint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(613, glad_args, NULL);
+    glad_debug_glVertexAttribI1uiv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(613, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    glad_args[2].i = y;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(614, glad_args, NULL);
+    glad_debug_glVertexAttribI2i(index, x, y);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(614, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI2iv(GLuint index, const GLint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(615, glad_args, NULL);
+    glad_debug_glVertexAttribI2iv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(615, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].u = x;
+    glad_args[2].u = y;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(616, glad_args, NULL);
+    glad_debug_glVertexAttribI2ui(index, x, y);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(616, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI2uiv(GLuint index, const GLuint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(617, glad_args, NULL);
+    glad_debug_glVertexAttribI2uiv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(617, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    glad_args[2].i = y;
+    glad_args[3].i = z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(618, glad_args, NULL);
+    glad_debug_glVertexAttribI3i(index, x, y, z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(618, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI3iv(GLuint index, const GLint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(619, glad_args, NULL);
+    glad_debug_glVertexAttribI3iv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(619, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = x;
+    glad_args[2].u = y;
+    glad_args[3].u = z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(620, glad_args, NULL);
+    glad_debug_glVertexAttribI3ui(index, x, y, z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(620, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI3uiv(GLuint index, const GLuint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(621, glad_args, NULL);
+    glad_debug_glVertexAttribI3uiv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(621, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4bv(GLuint index, const GLbyte * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(622, glad_args, NULL);
+    glad_debug_glVertexAttribI4bv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(622, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].i = x;
+    glad_args[2].i = y;
+    glad_args[3].i = z;
+    glad_args[4].i = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(623, glad_args, NULL);
+    glad_debug_glVertexAttribI4i(index, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(623, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4iv(GLuint index, const GLint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(624, glad_args, NULL);
+    glad_debug_glVertexAttribI4iv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(624, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4sv(GLuint index, const GLshort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(625, glad_args, NULL);
+    glad_debug_glVertexAttribI4sv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(625, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4ubv(GLuint index, const GLubyte * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(626, glad_args, NULL);
+    glad_debug_glVertexAttribI4ubv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(626, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].u = x;
+    glad_args[2].u = y;
+    glad_args[3].u = z;
+    glad_args[4].u = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(627, glad_args, NULL);
+    glad_debug_glVertexAttribI4ui(index, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(627, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4uiv(GLuint index, const GLuint * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(628, glad_args, NULL);
+    glad_debug_glVertexAttribI4uiv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(628, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribI4usv(GLuint index, const GLushort * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(629, glad_args, NULL);
+    glad_debug_glVertexAttribI4usv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(629, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = attribindex;
+    glad_args[1].i = size;
+    glad_args[2].u = type;
+    glad_args[3].u = relativeoffset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(630, glad_args, NULL);
+    glad_debug_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(630, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].i = size;
+    glad_args[2].u = type;
+    glad_args[3].i = stride;
+    glad_args[4].p = (const void *) pointer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(631, glad_args, NULL);
+    glad_debug_glVertexAttribIPointer(index, size, type, stride, pointer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(631, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL1d(GLuint index, GLdouble x) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(632, glad_args, NULL);
+    glad_debug_glVertexAttribL1d(index, x);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(632, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL1dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(633, glad_args, NULL);
+    glad_debug_glVertexAttribL1dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(633, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(634, glad_args, NULL);
+    glad_debug_glVertexAttribL2d(index, x, y);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(634, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL2dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(635, glad_args, NULL);
+    glad_debug_glVertexAttribL2dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(635, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    glad_args[3].d = z;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(636, glad_args, NULL);
+    glad_debug_glVertexAttribL3d(index, x, y, z);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(636, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL3dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(637, glad_args, NULL);
+    glad_debug_glVertexAttribL3dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(637, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].d = x;
+    glad_args[2].d = y;
+    glad_args[3].d = z;
+    glad_args[4].d = w;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(638, glad_args, NULL);
+    glad_debug_glVertexAttribL4d(index, x, y, z, w);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(638, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribL4dv(GLuint index, const GLdouble * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(639, glad_args, NULL);
+    glad_debug_glVertexAttribL4dv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(639, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = attribindex;
+    glad_args[1].i = size;
+    glad_args[2].u = type;
+    glad_args[3].u = relativeoffset;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(640, glad_args, NULL);
+    glad_debug_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(640, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].i = size;
+    glad_args[2].u = type;
+    glad_args[3].i = stride;
+    glad_args[4].p = (const void *) pointer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(641, glad_args, NULL);
+    glad_debug_glVertexAttribLPointer(index, size, type, stride, pointer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(641, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].u = value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(642, glad_args, NULL);
+    glad_debug_glVertexAttribP1ui(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(642, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(643, glad_args, NULL);
+    glad_debug_glVertexAttribP1uiv(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(643, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].u = value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(644, glad_args, NULL);
+    glad_debug_glVertexAttribP2ui(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(644, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(645, glad_args, NULL);
+    glad_debug_glVertexAttribP2uiv(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(645, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].u = value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(646, glad_args, NULL);
+    glad_debug_glVertexAttribP3ui(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(646, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(647, glad_args, NULL);
+    glad_debug_glVertexAttribP3uiv(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(647, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].u = value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(648, glad_args, NULL);
+    glad_debug_glVertexAttribP4ui(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(648, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GladGLArgument glad_args[4];
+    glad_args[0].u = index;
+    glad_args[1].u = type;
+    glad_args[2].u = normalized;
+    glad_args[3].p = (const void *) value;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(649, glad_args, NULL);
+    glad_debug_glVertexAttribP4uiv(index, type, normalized, value);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(649, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer) {
+    GladGLArgument glad_args[6];
+    glad_args[0].u = index;
+    glad_args[1].i = size;
+    glad_args[2].u = type;
+    glad_args[3].u = normalized;
+    glad_args[4].i = stride;
+    glad_args[5].p = (const void *) pointer;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(650, glad_args, NULL);
+    glad_debug_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(650, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = bindingindex;
+    glad_args[1].u = divisor;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(651, glad_args, NULL);
+    glad_debug_glVertexBindingDivisor(bindingindex, divisor);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(651, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    GladGLArgument glad_args[4];
+    glad_args[0].i = x;
+    glad_args[1].i = y;
+    glad_args[2].i = width;
+    glad_args[3].i = height;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(652, glad_args, NULL);
+    glad_debug_glViewport(x, y, width, height);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(652, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glViewportArrayv(GLuint first, GLsizei count, const GLfloat * v) {
+    GladGLArgument glad_args[3];
+    glad_args[0].u = first;
+    glad_args[1].i = count;
+    glad_args[2].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(653, glad_args, NULL);
+    glad_debug_glViewportArrayv(first, count, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(653, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+    GladGLArgument glad_args[5];
+    glad_args[0].u = index;
+    glad_args[1].f = x;
+    glad_args[2].f = y;
+    glad_args[3].f = w;
+    glad_args[4].f = h;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(654, glad_args, NULL);
+    glad_debug_glViewportIndexedf(index, x, y, w, h);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(654, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glViewportIndexedfv(GLuint index, const GLfloat * v) {
+    GladGLArgument glad_args[2];
+    glad_args[0].u = index;
+    glad_args[1].p = (const void *) v;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(655, glad_args, NULL);
+    glad_debug_glViewportIndexedfv(index, v);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(655, glad_args, NULL);
+}
+static void GLAD_API_PTR glad_debug_impl_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GladGLArgument glad_args[3];
+    glad_args[0].p = (const void *) sync;
+    glad_args[1].u = flags;
+    glad_args[2].u = timeout;
+    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(656, glad_args, NULL);
+    glad_debug_glWaitSync(sync, flags, timeout);
+    if(glad_gl_post_callback != NULL) glad_gl_post_callback(656, glad_args, NULL);
+}
+
+typedef struct GladGLDebugEntry {
+    GLADapiproc *pointer;
+    GLADapiproc *real;
+    GLADapiproc wrapper;
+} GladGLDebugEntry;
+
+static const GladGLDebugEntry glad_gl_debug_entries[GLAD_GL_FUNCTION_COUNT] = {
+    { (GLADapiproc *) &glad_glActiveShaderProgram, (GLADapiproc *) &glad_debug_glActiveShaderProgram, (GLADapiproc) glad_debug_impl_glActiveShaderProgram },
+    { (GLADapiproc *) &glad_glActiveTexture, (GLADapiproc *) &glad_debug_glActiveTexture, (GLADapiproc) glad_debug_impl_glActiveTexture },
+    { (GLADapiproc *) &glad_glAttachShader, (GLADapiproc *) &glad_debug_glAttachShader, (GLADapiproc) glad_debug_impl_glAttachShader },
+    { (GLADapiproc *) &glad_glBeginConditionalRender, (GLADapiproc *) &glad_debug_glBeginConditionalRender, (GLADapiproc) glad_debug_impl_glBeginConditionalRender },
+    { (GLADapiproc *) &glad_glBeginQuery, (GLADapiproc *) &glad_debug_glBeginQuery, (GLADapiproc) glad_debug_impl_glBeginQuery },
+    { (GLADapiproc *) &glad_glBeginQueryIndexed, (GLADapiproc *) &glad_debug_glBeginQueryIndexed, (GLADapiproc) glad_debug_impl_glBeginQueryIndexed },
+    { (GLADapiproc *) &glad_glBeginTransformFeedback, (GLADapiproc *) &glad_debug_glBeginTransformFeedback, (GLADapiproc) glad_debug_impl_glBeginTransformFeedback },
+    { (GLADapiproc *) &glad_glBindAttribLocation, (GLADapiproc *) &glad_debug_glBindAttribLocation, (GLADapiproc) glad_debug_impl_glBindAttribLocation },
+    { (GLADapiproc *) &glad_glBindBuffer, (GLADapiproc *) &glad_debug_glBindBuffer, (GLADapiproc) glad_debug_impl_glBindBuffer },
+    { (GLADapiproc *) &glad_glBindBufferBase, (GLADapiproc *) &glad_debug_glBindBufferBase, (GLADapiproc) glad_debug_impl_glBindBufferBase },
+    { (GLADapiproc *) &glad_glBindBufferRange, (GLADapiproc *) &glad_debug_glBindBufferRange, (GLADapiproc) glad_debug_impl_glBindBufferRange },
+    { (GLADapiproc *) &glad_glBindBuffersBase, (GLADapiproc *) &glad_debug_glBindBuffersBase, (GLADapiproc) glad_debug_impl_glBindBuffersBase },
+    { (GLADapiproc *) &glad_glBindBuffersRange, (GLADapiproc *) &glad_debug_glBindBuffersRange, (GLADapiproc) glad_debug_impl_glBindBuffersRange },
+    { (GLADapiproc *) &glad_glBindFragDataLocation, (GLADapiproc *) &glad_debug_glBindFragDataLocation, (GLADapiproc) glad_debug_impl_glBindFragDataLocation },
+    { (GLADapiproc *) &glad_glBindFragDataLocationIndexed, (GLADapiproc *) &glad_debug_glBindFragDataLocationIndexed, (GLADapiproc) glad_debug_impl_glBindFragDataLocationIndexed },
+    { (GLADapiproc *) &glad_glBindFramebuffer, (GLADapiproc *) &glad_debug_glBindFramebuffer, (GLADapiproc) glad_debug_impl_glBindFramebuffer },
+    { (GLADapiproc *) &glad_glBindImageTexture, (GLADapiproc *) &glad_debug_glBindImageTexture, (GLADapiproc) glad_debug_impl_glBindImageTexture },
+    { (GLADapiproc *) &glad_glBindImageTextures, (GLADapiproc *) &glad_debug_glBindImageTextures, (GLADapiproc) glad_debug_impl_glBindImageTextures },
+    { (GLADapiproc *) &glad_glBindProgramPipeline, (GLADapiproc *) &glad_debug_glBindProgramPipeline, (GLADapiproc) glad_debug_impl_glBindProgramPipeline },
+    { (GLADapiproc *) &glad_glBindRenderbuffer, (GLADapiproc *) &glad_debug_glBindRenderbuffer, (GLADapiproc) glad_debug_impl_glBindRenderbuffer },
+    { (GLADapiproc *) &glad_glBindSampler, (GLADapiproc *) &glad_debug_glBindSampler, (GLADapiproc) glad_debug_impl_glBindSampler },
+    { (GLADapiproc *) &glad_glBindSamplers, (GLADapiproc *) &glad_debug_glBindSamplers, (GLADapiproc) glad_debug_impl_glBindSamplers },
+    { (GLADapiproc *) &glad_glBindTexture, (GLADapiproc *) &glad_debug_glBindTexture, (GLADapiproc) glad_debug_impl_glBindTexture },
+    { (GLADapiproc *) &glad_glBindTextureUnit, (GLADapiproc *) &glad_debug_glBindTextureUnit, (GLADapiproc) glad_debug_impl_glBindTextureUnit },
+    { (GLADapiproc *) &glad_glBindTextures, (GLADapiproc *) &glad_debug_glBindTextures, (GLADapiproc) glad_debug_impl_glBindTextures },
+    { (GLADapiproc *) &glad_glBindTransformFeedback, (GLADapiproc *) &glad_debug_glBindTransformFeedback, (GLADapiproc) glad_debug_impl_glBindTransformFeedback },
+    { (GLADapiproc *) &glad_glBindVertexArray, (GLADapiproc *) &glad_debug_glBindVertexArray, (GLADapiproc) glad_debug_impl_glBindVertexArray },
+    { (GLADapiproc *) &glad_glBindVertexBuffer, (GLADapiproc *) &glad_debug_glBindVertexBuffer, (GLADapiproc) glad_debug_impl_glBindVertexBuffer },
+    { (GLADapiproc *) &glad_glBindVertexBuffers, (GLADapiproc *) &glad_debug_glBindVertexBuffers, (GLADapiproc) glad_debug_impl_glBindVertexBuffers },
+    { (GLADapiproc *) &glad_glBlendColor, (GLADapiproc *) &glad_debug_glBlendColor, (GLADapiproc) glad_debug_impl_glBlendColor },
+    { (GLADapiproc *) &glad_glBlendEquation, (GLADapiproc *) &glad_debug_glBlendEquation, (GLADapiproc) glad_debug_impl_glBlendEquation },
+    { (GLADapiproc *) &glad_glBlendEquationSeparate, (GLADapiproc *) &glad_debug_glBlendEquationSeparate, (GLADapiproc) glad_debug_impl_glBlendEquationSeparate },
+    { (GLADapiproc *) &glad_glBlendEquationSeparatei, (GLADapiproc *) &glad_debug_glBlendEquationSeparatei, (GLADapiproc) glad_debug_impl_glBlendEquationSeparatei },
+    { (GLADapiproc *) &glad_glBlendEquationi, (GLADapiproc *) &glad_debug_glBlendEquationi, (GLADapiproc) glad_debug_impl_glBlendEquationi },
+    { (GLADapiproc *) &glad_glBlendFunc, (GLADapiproc *) &glad_debug_glBlendFunc, (GLADapiproc) glad_debug_impl_glBlendFunc },
+    { (GLADapiproc *) &glad_glBlendFuncSeparate, (GLADapiproc *) &glad_debug_glBlendFuncSeparate, (GLADapiproc) glad_debug_impl_glBlendFuncSeparate },
+    { (GLADapiproc *) &glad_glBlendFuncSeparatei, (GLADapiproc *) &glad_debug_glBlendFuncSeparatei, (GLADapiproc) glad_debug_impl_glBlendFuncSeparatei },
+    { (GLADapiproc *) &glad_glBlendFunci, (GLADapiproc *) &glad_debug_glBlendFunci, (GLADapiproc) glad_debug_impl_glBlendFunci },
+    { (GLADapiproc *) &glad_glBlitFramebuffer, (GLADapiproc *) &glad_debug_glBlitFramebuffer, (GLADapiproc) glad_debug_impl_glBlitFramebuffer },
+    { (GLADapiproc *) &glad_glBlitNamedFramebuffer, (GLADapiproc *) &glad_debug_glBlitNamedFramebuffer, (GLADapiproc) glad_debug_impl_glBlitNamedFramebuffer },
+    { (GLADapiproc *) &glad_glBufferData, (GLADapiproc *) &glad_debug_glBufferData, (GLADapiproc) glad_debug_impl_glBufferData },
+    { (GLADapiproc *) &glad_glBufferStorage, (GLADapiproc *) &glad_debug_glBufferStorage, (GLADapiproc) glad_debug_impl_glBufferStorage },
+    { (GLADapiproc *) &glad_glBufferSubData, (GLADapiproc *) &glad_debug_glBufferSubData, (GLADapiproc) glad_debug_impl_glBufferSubData },
+    { (GLADapiproc *) &glad_glCheckFramebufferStatus, (GLADapiproc *) &glad_debug_glCheckFramebufferStatus, (GLADapiproc) glad_debug_impl_glCheckFramebufferStatus },
+    { (GLADapiproc *) &glad_glCheckNamedFramebufferStatus, (GLADapiproc *) &glad_debug_glCheckNamedFramebufferStatus, (GLADapiproc) glad_debug_impl_glCheckNamedFramebufferStatus },
+    { (GLADapiproc *) &glad_glClampColor, (GLADapiproc *) &glad_debug_glClampColor, (GLADapiproc) glad_debug_impl_glClampColor },
+    { (GLADapiproc *) &glad_glClear, (GLADapiproc *) &glad_debug_glClear, (GLADapiproc) glad_debug_impl_glClear },
+    { (GLADapiproc *) &glad_glClearBufferData, (GLADapiproc *) &glad_debug_glClearBufferData, (GLADapiproc) glad_debug_impl_glClearBufferData },
+    { (GLADapiproc *) &glad_glClearBufferSubData, (GLADapiproc *) &glad_debug_glClearBufferSubData, (GLADapiproc) glad_debug_impl_glClearBufferSubData },
+    { (GLADapiproc *) &glad_glClearBufferfi, (GLADapiproc *) &glad_debug_glClearBufferfi, (GLADapiproc) glad_debug_impl_glClearBufferfi },
+    { (GLADapiproc *) &glad_glClearBufferfv, (GLADapiproc *) &glad_debug_glClearBufferfv, (GLADapiproc) glad_debug_impl_glClearBufferfv },
+    { (GLADapiproc *) &glad_glClearBufferiv, (GLADapiproc *) &glad_debug_glClearBufferiv, (GLADapiproc) glad_debug_impl_glClearBufferiv },
+    { (GLADapiproc *) &glad_glClearBufferuiv, (GLADapiproc *) &glad_debug_glClearBufferuiv, (GLADapiproc) glad_debug_impl_glClearBufferuiv },
+    { (GLADapiproc *) &glad_glClearColor, (GLADapiproc *) &glad_debug_glClearColor, (GLADapiproc) glad_debug_impl_glClearColor },
+    { (GLADapiproc *) &glad_glClearDepth, (GLADapiproc *) &glad_debug_glClearDepth, (GLADapiproc) glad_debug_impl_glClearDepth },
+    { (GLADapiproc *) &glad_glClearDepthf, (GLADapiproc *) &glad_debug_glClearDepthf, (GLADapiproc) glad_debug_impl_glClearDepthf },
+    { (GLADapiproc *) &glad_glClearNamedBufferData, (GLADapiproc *) &glad_debug_glClearNamedBufferData, (GLADapiproc) glad_debug_impl_glClearNamedBufferData },
+    { (GLADapiproc *) &glad_glClearNamedBufferSubData, (GLADapiproc *) &glad_debug_glClearNamedBufferSubData, (GLADapiproc) glad_debug_impl_glClearNamedBufferSubData },
+    { (GLADapiproc *) &glad_glClearNamedFramebufferfi, (GLADapiproc *) &glad_debug_glClearNamedFramebufferfi, (GLADapiproc) glad_debug_impl_glClearNamedFramebufferfi },
+    { (GLADapiproc *) &glad_glClearNamedFramebufferfv, (GLADapiproc *) &glad_debug_glClearNamedFramebufferfv, (GLADapiproc) glad_debug_impl_glClearNamedFramebufferfv },
+    { (GLADapiproc *) &glad_glClearNamedFramebufferiv, (GLADapiproc *) &glad_debug_glClearNamedFramebufferiv, (GLADapiproc) glad_debug_impl_glClearNamedFramebufferiv },
+    { (GLADapiproc *) &glad_glClearNamedFramebufferuiv, (GLADapiproc *) &glad_debug_glClearNamedFramebufferuiv, (GLADapiproc) glad_debug_impl_glClearNamedFramebufferuiv },
+    { (GLADapiproc *) &glad_glClearStencil, (GLADapiproc *) &glad_debug_glClearStencil, (GLADapiproc) glad_debug_impl_glClearStencil },
+    { (GLADapiproc *) &glad_glClearTexImage, (GLADapiproc *) &glad_debug_glClearTexImage, (GLADapiproc) glad_debug_impl_glClearTexImage },
+    { (GLADapiproc *) &glad_glClearTexSubImage, (GLADapiproc *) &glad_debug_glClearTexSubImage, (GLADapiproc) glad_debug_impl_glClearTexSubImage },
+    { (GLADapiproc *) &glad_glClientWaitSync, (GLADapiproc *) &glad_debug_glClientWaitSync, (GLADapiproc) glad_debug_impl_glClientWaitSync },
+    { (GLADapiproc *) &glad_glClipControl, (GLADapiproc *) &glad_debug_glClipControl, (GLADapiproc) glad_debug_impl_glClipControl },
+    { (GLADapiproc *) &glad_glColorMask, (GLADapiproc *) &glad_debug_glColorMask, (GLADapiproc) glad_debug_impl_glColorMask },
+    { (GLADapiproc *) &glad_glColorMaski, (GLADapiproc *) &glad_debug_glColorMaski, (GLADapiproc) glad_debug_impl_glColorMaski },
+    { (GLADapiproc *) &glad_glCompileShader, (GLADapiproc *) &glad_debug_glCompileShader, (GLADapiproc) glad_debug_impl_glCompileShader },
+    { (GLADapiproc *) &glad_glCompressedTexImage1D, (GLADapiproc *) &glad_debug_glCompressedTexImage1D, (GLADapiproc) glad_debug_impl_glCompressedTexImage1D },
+    { (GLADapiproc *) &glad_glCompressedTexImage2D, (GLADapiproc *) &glad_debug_glCompressedTexImage2D, (GLADapiproc) glad_debug_impl_glCompressedTexImage2D },
+    { (GLADapiproc *) &glad_glCompressedTexImage3D, (GLADapiproc *) &glad_debug_glCompressedTexImage3D, (GLADapiproc) glad_debug_impl_glCompressedTexImage3D },
+    { (GLADapiproc *) &glad_glCompressedTexSubImage1D, (GLADapiproc *) &glad_debug_glCompressedTexSubImage1D, (GLADapiproc) glad_debug_impl_glCompressedTexSubImage1D },
+    { (GLADapiproc *) &glad_glCompressedTexSubImage2D, (GLADapiproc *) &glad_debug_glCompressedTexSubImage2D, (GLADapiproc) glad_debug_impl_glCompressedTexSubImage2D },
+    { (GLADapiproc *) &glad_glCompressedTexSubImage3D, (GLADapiproc *) &glad_debug_glCompressedTexSubImage3D, (GLADapiproc) glad_debug_impl_glCompressedTexSubImage3D },
+    { (GLADapiproc *) &glad_glCompressedTextureSubImage1D, (GLADapiproc *) &glad_debug_glCompressedTextureSubImage1D, (GLADapiproc) glad_debug_impl_glCompressedTextureSubImage1D },
+    { (GLADapiproc *) &glad_glCompressedTextureSubImage2D, (GLADapiproc *) &glad_debug_glCompressedTextureSubImage2D, (GLADapiproc) glad_debug_impl_glCompressedTextureSubImage2D },
+    { (GLADapiproc *) &glad_glCompressedTextureSubImage3D, (GLADapiproc *) &glad_debug_glCompressedTextureSubImage3D, (GLADapiproc) glad_debug_impl_glCompressedTextureSubImage3D },
+    { (GLADapiproc *) &glad_glCopyBufferSubData, (GLADapiproc *) &glad_debug_glCopyBufferSubData, (GLADapiproc) glad_debug_impl_glCopyBufferSubData },
+    { (GLADapiproc *) &glad_glCopyImageSubData, (GLADapiproc *) &glad_debug_glCopyImageSubData, (GLADapiproc) glad_debug_impl_glCopyImageSubData },
+    { (GLADapiproc *) &glad_glCopyNamedBufferSubData, (GLADapiproc *) &glad_debug_glCopyNamedBufferSubData, (GLADapiproc) glad_debug_impl_glCopyNamedBufferSubData },
+    { (GLADapiproc *) &glad_glCopyTexImage1D, (GLADapiproc *) &glad_debug_glCopyTexImage1D, (GLADapiproc) glad_debug_impl_glCopyTexImage1D },
+    { (GLADapiproc *) &glad_glCopyTexImage2D, (GLADapiproc *) &glad_debug_glCopyTexImage2D, (GLADapiproc) glad_debug_impl_glCopyTexImage2D },
+    { (GLADapiproc *) &glad_glCopyTexSubImage1D, (GLADapiproc *) &glad_debug_glCopyTexSubImage1D, (GLADapiproc) glad_debug_impl_glCopyTexSubImage1D },
+    { (GLADapiproc *) &glad_glCopyTexSubImage2D, (GLADapiproc *) &glad_debug_glCopyTexSubImage2D, (GLADapiproc) glad_debug_impl_glCopyTexSubImage2D },
+    { (GLADapiproc *) &glad_glCopyTexSubImage3D, (GLADapiproc *) &glad_debug_glCopyTexSubImage3D, (GLADapiproc) glad_debug_impl_glCopyTexSubImage3D },
+    { (GLADapiproc *) &glad_glCopyTextureSubImage1D, (GLADapiproc *) &glad_debug_glCopyTextureSubImage1D, (GLADapiproc) glad_debug_impl_glCopyTextureSubImage1D },
+    { (GLADapiproc *) &glad_glCopyTextureSubImage2D, (GLADapiproc *) &glad_debug_glCopyTextureSubImage2D, (GLADapiproc) glad_debug_impl_glCopyTextureSubImage2D },
+    { (GLADapiproc *) &glad_glCopyTextureSubImage3D, (GLADapiproc *) &glad_debug_glCopyTextureSubImage3D, (GLADapiproc) glad_debug_impl_glCopyTextureSubImage3D },
+    { (GLADapiproc *) &glad_glCreateBuffers, (GLADapiproc *) &glad_debug_glCreateBuffers, (GLADapiproc) glad_debug_impl_glCreateBuffers },
+    { (GLADapiproc *) &glad_glCreateFramebuffers, (GLADapiproc *) &glad_debug_glCreateFramebuffers, (GLADapiproc) glad_debug_impl_glCreateFramebuffers },
+    { (GLADapiproc *) &glad_glCreateProgram, (GLADapiproc *) &glad_debug_glCreateProgram, (GLADapiproc) glad_debug_impl_glCreateProgram },
+    { (GLADapiproc *) &glad_glCreateProgramPipelines, (GLADapiproc *) &glad_debug_glCreateProgramPipelines, (GLADapiproc) glad_debug_impl_glCreateProgramPipelines },
+    { (GLADapiproc *) &glad_glCreateQueries, (GLADapiproc *) &glad_debug_glCreateQueries, (GLADapiproc) glad_debug_impl_glCreateQueries },
+    { (GLADapiproc *) &glad_glCreateRenderbuffers, (GLADapiproc *) &glad_debug_glCreateRenderbuffers, (GLADapiproc) glad_debug_impl_glCreateRenderbuffers },
+    { (GLADapiproc *) &glad_glCreateSamplers, (GLADapiproc *) &glad_debug_glCreateSamplers, (GLADapiproc) glad_debug_impl_glCreateSamplers },
+    { (GLADapiproc *) &glad_glCreateShader, (GLADapiproc *) &glad_debug_glCreateShader, (GLADapiproc) glad_debug_impl_glCreateShader },
+    { (GLADapiproc *) &glad_glCreateShaderProgramv, (GLADapiproc *) &glad_debug_glCreateShaderProgramv, (GLADapiproc) glad_debug_impl_glCreateShaderProgramv },
+    { (GLADapiproc *) &glad_glCreateTextures, (GLADapiproc *) &glad_debug_glCreateTextures, (GLADapiproc) glad_debug_impl_glCreateTextures },
+    { (GLADapiproc *) &glad_glCreateTransformFeedbacks, (GLADapiproc *) &glad_debug_glCreateTransformFeedbacks, (GLADapiproc) glad_debug_impl_glCreateTransformFeedbacks },
+    { (GLADapiproc *) &glad_glCreateVertexArrays, (GLADapiproc *) &glad_debug_glCreateVertexArrays, (GLADapiproc) glad_debug_impl_glCreateVertexArrays },
+    { (GLADapiproc *) &glad_glCullFace, (GLADapiproc *) &glad_debug_glCullFace, (GLADapiproc) glad_debug_impl_glCullFace },
+    { (GLADapiproc *) &glad_glDebugMessageCallback, (GLADapiproc *) &glad_debug_glDebugMessageCallback, (GLADapiproc) glad_debug_impl_glDebugMessageCallback },
+    { (GLADapiproc *) &glad_glDebugMessageControl, (GLADapiproc *) &glad_debug_glDebugMessageControl, (GLADapiproc) glad_debug_impl_glDebugMessageControl },
+    { (GLADapiproc *) &glad_glDebugMessageInsert, (GLADapiproc *) &glad_debug_glDebugMessageInsert, (GLADapiproc) glad_debug_impl_glDebugMessageInsert },
+    { (GLADapiproc *) &glad_glDeleteBuffers, (GLADapiproc *) &glad_debug_glDeleteBuffers, (GLADapiproc) glad_debug_impl_glDeleteBuffers },
+    { (GLADapiproc *) &glad_glDeleteFramebuffers, (GLADapiproc *) &glad_debug_glDeleteFramebuffers, (GLADapiproc) glad_debug_impl_glDeleteFramebuffers },
+    { (GLADapiproc *) &glad_glDeleteProgram, (GLADapiproc *) &glad_debug_glDeleteProgram, (GLADapiproc) glad_debug_impl_glDeleteProgram },
+    { (GLADapiproc *) &glad_glDeleteProgramPipelines, (GLADapiproc *) &glad_debug_glDeleteProgramPipelines, (GLADapiproc) glad_debug_impl_glDeleteProgramPipelines },
+    { (GLADapiproc *) &glad_glDeleteQueries, (GLADapiproc *) &glad_debug_glDeleteQueries, (GLADapiproc) glad_debug_impl_glDeleteQueries },
+    { (GLADapiproc *) &glad_glDeleteRenderbuffers, (GLADapiproc *) &glad_debug_glDeleteRenderbuffers, (GLADapiproc) glad_debug_impl_glDeleteRenderbuffers },
+    { (GLADapiproc *) &glad_glDeleteSamplers, (GLADapiproc *) &glad_debug_glDeleteSamplers, (GLADapiproc) glad_debug_impl_glDeleteSamplers },
+    { (GLADapiproc *) &glad_glDeleteShader, (GLADapiproc *) &glad_debug_glDeleteShader, (GLADapiproc) glad_debug_impl_glDeleteShader },
+    { (GLADapiproc *) &glad_glDeleteSync, (GLADapiproc *) &glad_debug_glDeleteSync, (GLADapiproc) glad_debug_impl_glDeleteSync },
+    { (GLADapiproc *) &glad_glDeleteTextures, (GLADapiproc *) &glad_debug_glDeleteTextures, (GLADapiproc) glad_debug_impl_glDeleteTextures },
+    { (GLADapiproc *) &glad_glDeleteTransformFeedbacks, (GLADapiproc *) &glad_debug_glDeleteTransformFeedbacks, (GLADapiproc) glad_debug_impl_glDeleteTransformFeedbacks },
+    { (GLADapiproc *) &glad_glDeleteVertexArrays, (GLADapiproc *) &glad_debug_glDeleteVertexArrays, (GLADapiproc) glad_debug_impl_glDeleteVertexArrays },
+    { (GLADapiproc *) &glad_glDepthFunc, (GLADapiproc *) &glad_debug_glDepthFunc, (GLADapiproc) glad_debug_impl_glDepthFunc },
+    { (GLADapiproc *) &glad_glDepthMask, (GLADapiproc *) &glad_debug_glDepthMask, (GLADapiproc) glad_debug_impl_glDepthMask },
+    { (GLADapiproc *) &glad_glDepthRange, (GLADapiproc *) &glad_debug_glDepthRange, (GLADapiproc) glad_debug_impl_glDepthRange },
+    { (GLADapiproc *) &glad_glDepthRangeArrayv, (GLADapiproc *) &glad_debug_glDepthRangeArrayv, (GLADapiproc) glad_debug_impl_glDepthRangeArrayv },
+    { (GLADapiproc *) &glad_glDepthRangeIndexed, (GLADapiproc *) &glad_debug_glDepthRangeIndexed, (GLADapiproc) glad_debug_impl_glDepthRangeIndexed },
+    { (GLADapiproc *) &glad_glDepthRangef, (GLADapiproc *) &glad_debug_glDepthRangef, (GLADapiproc) glad_debug_impl_glDepthRangef },
+    { (GLADapiproc *) &glad_glDetachShader, (GLADapiproc *) &glad_debug_glDetachShader, (GLADapiproc) glad_debug_impl_glDetachShader },
+    { (GLADapiproc *) &glad_glDisable, (GLADapiproc *) &glad_debug_glDisable, (GLADapiproc) glad_debug_impl_glDisable },
+    { (GLADapiproc *) &glad_glDisableVertexArrayAttrib, (GLADapiproc *) &glad_debug_glDisableVertexArrayAttrib, (GLADapiproc) glad_debug_impl_glDisableVertexArrayAttrib },
+    { (GLADapiproc *) &glad_glDisableVertexAttribArray, (GLADapiproc *) &glad_debug_glDisableVertexAttribArray, (GLADapiproc) glad_debug_impl_glDisableVertexAttribArray },
+    { (GLADapiproc *) &glad_glDisablei, (GLADapiproc *) &glad_debug_glDisablei, (GLADapiproc) glad_debug_impl_glDisablei },
+    { (GLADapiproc *) &glad_glDispatchCompute, (GLADapiproc *) &glad_debug_glDispatchCompute, (GLADapiproc) glad_debug_impl_glDispatchCompute },
+    { (GLADapiproc *) &glad_glDispatchComputeIndirect, (GLADapiproc *) &glad_debug_glDispatchComputeIndirect, (GLADapiproc) glad_debug_impl_glDispatchComputeIndirect },
+    { (GLADapiproc *) &glad_glDrawArrays, (GLADapiproc *) &glad_debug_glDrawArrays, (GLADapiproc) glad_debug_impl_glDrawArrays },
+    { (GLADapiproc *) &glad_glDrawArraysIndirect, (GLADapiproc *) &glad_debug_glDrawArraysIndirect, (GLADapiproc) glad_debug_impl_glDrawArraysIndirect },
+    { (GLADapiproc *) &glad_glDrawArraysInstanced, (GLADapiproc *) &glad_debug_glDrawArraysInstanced, (GLADapiproc) glad_debug_impl_glDrawArraysInstanced },
+    { (GLADapiproc *) &glad_glDrawArraysInstancedBaseInstance, (GLADapiproc *) &glad_debug_glDrawArraysInstancedBaseInstance, (GLADapiproc) glad_debug_impl_glDrawArraysInstancedBaseInstance },
+    { (GLADapiproc *) &glad_glDrawBuffer, (GLADapiproc *) &glad_debug_glDrawBuffer, (GLADapiproc) glad_debug_impl_glDrawBuffer },
+    { (GLADapiproc *) &glad_glDrawBuffers, (GLADapiproc *) &glad_debug_glDrawBuffers, (GLADapiproc) glad_debug_impl_glDrawBuffers },
+    { (GLADapiproc *) &glad_glDrawElements, (GLADapiproc *) &glad_debug_glDrawElements, (GLADapiproc) glad_debug_impl_glDrawElements },
+    { (GLADapiproc *) &glad_glDrawElementsBaseVertex, (GLADapiproc *) &glad_debug_glDrawElementsBaseVertex, (GLADapiproc) glad_debug_impl_glDrawElementsBaseVertex },
+    { (GLADapiproc *) &glad_glDrawElementsIndirect, (GLADapiproc *) &glad_debug_glDrawElementsIndirect, (GLADapiproc) glad_debug_impl_glDrawElementsIndirect },
+    { (GLADapiproc *) &glad_glDrawElementsInstanced, (GLADapiproc *) &glad_debug_glDrawElementsInstanced, (GLADapiproc) glad_debug_impl_glDrawElementsInstanced },
+    { (GLADapiproc *) &glad_glDrawElementsInstancedBaseInstance, (GLADapiproc *) &glad_debug_glDrawElementsInstancedBaseInstance, (GLADapiproc) glad_debug_impl_glDrawElementsInstancedBaseInstance },
+    { (GLADapiproc *) &glad_glDrawElementsInstancedBaseVertex, (GLADapiproc *) &glad_debug_glDrawElementsInstancedBaseVertex, (GLADapiproc) glad_debug_impl_glDrawElementsInstancedBaseVertex },
+    { (GLADapiproc *) &glad_glDrawElementsInstancedBaseVertexBaseInstance, (GLADapiproc *) &glad_debug_glDrawElementsInstancedBaseVertexBaseInstance, (GLADapiproc) glad_debug_impl_glDrawElementsInstancedBaseVertexBaseInstance },
+    { (GLADapiproc *) &glad_glDrawRangeElements, (GLADapiproc *) &glad_debug_glDrawRangeElements, (GLADapiproc) glad_debug_impl_glDrawRangeElements },
+    { (GLADapiproc *) &glad_glDrawRangeElementsBaseVertex, (GLADapiproc *) &glad_debug_glDrawRangeElementsBaseVertex, (GLADapiproc) glad_debug_impl_glDrawRangeElementsBaseVertex },
+    { (GLADapiproc *) &glad_glDrawTransformFeedback, (GLADapiproc *) &glad_debug_glDrawTransformFeedback, (GLADapiproc) glad_debug_impl_glDrawTransformFeedback },
+    { (GLADapiproc *) &glad_glDrawTransformFeedbackInstanced, (GLADapiproc *) &glad_debug_glDrawTransformFeedbackInstanced, (GLADapiproc) glad_debug_impl_glDrawTransformFeedbackInstanced },
+    { (GLADapiproc *) &glad_glDrawTransformFeedbackStream, (GLADapiproc *) &glad_debug_glDrawTransformFeedbackStream, (GLADapiproc) glad_debug_impl_glDrawTransformFeedbackStream },
+    { (GLADapiproc *) &glad_glDrawTransformFeedbackStreamInstanced, (GLADapiproc *) &glad_debug_glDrawTransformFeedbackStreamInstanced, (GLADapiproc) glad_debug_impl_glDrawTransformFeedbackStreamInstanced },
+    { (GLADapiproc *) &glad_glEnable, (GLADapiproc *) &glad_debug_glEnable, (GLADapiproc) glad_debug_impl_glEnable },
+    { (GLADapiproc *) &glad_glEnableVertexArrayAttrib, (GLADapiproc *) &glad_debug_glEnableVertexArrayAttrib, (GLADapiproc) glad_debug_impl_glEnableVertexArrayAttrib },
+    { (GLADapiproc *) &glad_glEnableVertexAttribArray, (GLADapiproc *) &glad_debug_glEnableVertexAttribArray, (GLADapiproc) glad_debug_impl_glEnableVertexAttribArray },
+    { (GLADapiproc *) &glad_glEnablei, (GLADapiproc *) &glad_debug_glEnablei, (GLADapiproc) glad_debug_impl_glEnablei },
+    { (GLADapiproc *) &glad_glEndConditionalRender, (GLADapiproc *) &glad_debug_glEndConditionalRender, (GLADapiproc) glad_debug_impl_glEndConditionalRender },
+    { (GLADapiproc *) &glad_glEndQuery, (GLADapiproc *) &glad_debug_glEndQuery, (GLADapiproc) glad_debug_impl_glEndQuery },
+    { (GLADapiproc *) &glad_glEndQueryIndexed, (GLADapiproc *) &glad_debug_glEndQueryIndexed, (GLADapiproc) glad_debug_impl_glEndQueryIndexed },
+    { (GLADapiproc *) &glad_glEndTransformFeedback, (GLADapiproc *) &glad_debug_glEndTransformFeedback, (GLADapiproc) glad_debug_impl_glEndTransformFeedback },
+    { (GLADapiproc *) &glad_glFenceSync, (GLADapiproc *) &glad_debug_glFenceSync, (GLADapiproc) glad_debug_impl_glFenceSync },
+    { (GLADapiproc *) &glad_glFinish, (GLADapiproc *) &glad_debug_glFinish, (GLADapiproc) glad_debug_impl_glFinish },
+    { (GLADapiproc *) &glad_glFlush, (GLADapiproc *) &glad_debug_glFlush, (GLADapiproc) glad_debug_impl_glFlush },
+    { (GLADapiproc *) &glad_glFlushMappedBufferRange, (GLADapiproc *) &glad_debug_glFlushMappedBufferRange, (GLADapiproc) glad_debug_impl_glFlushMappedBufferRange },
+    { (GLADapiproc *) &glad_glFlushMappedNamedBufferRange, (GLADapiproc *) &glad_debug_glFlushMappedNamedBufferRange, (GLADapiproc) glad_debug_impl_glFlushMappedNamedBufferRange },
+    { (GLADapiproc *) &glad_glFramebufferParameteri, (GLADapiproc *) &glad_debug_glFramebufferParameteri, (GLADapiproc) glad_debug_impl_glFramebufferParameteri },
+    { (GLADapiproc *) &glad_glFramebufferRenderbuffer, (GLADapiproc *) &glad_debug_glFramebufferRenderbuffer, (GLADapiproc) glad_debug_impl_glFramebufferRenderbuffer },
+    { (GLADapiproc *) &glad_glFramebufferTexture, (GLADapiproc *) &glad_debug_glFramebufferTexture, (GLADapiproc) glad_debug_impl_glFramebufferTexture },
+    { (GLADapiproc *) &glad_glFramebufferTexture1D, (GLADapiproc *) &glad_debug_glFramebufferTexture1D, (GLADapiproc) glad_debug_impl_glFramebufferTexture1D },
+    { (GLADapiproc *) &glad_glFramebufferTexture2D, (GLADapiproc *) &glad_debug_glFramebufferTexture2D, (GLADapiproc) glad_debug_impl_glFramebufferTexture2D },
+    { (GLADapiproc *) &glad_glFramebufferTexture3D, (GLADapiproc *) &glad_debug_glFramebufferTexture3D, (GLADapiproc) glad_debug_impl_glFramebufferTexture3D },
+    { (GLADapiproc *) &glad_glFramebufferTextureLayer, (GLADapiproc *) &glad_debug_glFramebufferTextureLayer, (GLADapiproc) glad_debug_impl_glFramebufferTextureLayer },
+    { (GLADapiproc *) &glad_glFrontFace, (GLADapiproc *) &glad_debug_glFrontFace, (GLADapiproc) glad_debug_impl_glFrontFace },
+    { (GLADapiproc *) &glad_glGenBuffers, (GLADapiproc *) &glad_debug_glGenBuffers, (GLADapiproc) glad_debug_impl_glGenBuffers },
+    { (GLADapiproc *) &glad_glGenFramebuffers, (GLADapiproc *) &glad_debug_glGenFramebuffers, (GLADapiproc) glad_debug_impl_glGenFramebuffers },
+    { (GLADapiproc *) &glad_glGenProgramPipelines, (GLADapiproc *) &glad_debug_glGenProgramPipelines, (GLADapiproc) glad_debug_impl_glGenProgramPipelines },
+    { (GLADapiproc *) &glad_glGenQueries, (GLADapiproc *) &glad_debug_glGenQueries, (GLADapiproc) glad_debug_impl_glGenQueries },
+    { (GLADapiproc *) &glad_glGenRenderbuffers, (GLADapiproc *) &glad_debug_glGenRenderbuffers, (GLADapiproc) glad_debug_impl_glGenRenderbuffers },
+    { (GLADapiproc *) &glad_glGenSamplers, (GLADapiproc *) &glad_debug_glGenSamplers, (GLADapiproc) glad_debug_impl_glGenSamplers },
+    { (GLADapiproc *) &glad_glGenTextures, (GLADapiproc *) &glad_debug_glGenTextures, (GLADapiproc) glad_debug_impl_glGenTextures },
+    { (GLADapiproc *) &glad_glGenTransformFeedbacks, (GLADapiproc *) &glad_debug_glGenTransformFeedbacks, (GLADapiproc) glad_debug_impl_glGenTransformFeedbacks },
+    { (GLADapiproc *) &glad_glGenVertexArrays, (GLADapiproc *) &glad_debug_glGenVertexArrays, (GLADapiproc) glad_debug_impl_glGenVertexArrays },
+    { (GLADapiproc *) &glad_glGenerateMipmap, (GLADapiproc *) &glad_debug_glGenerateMipmap, (GLADapiproc) glad_debug_impl_glGenerateMipmap },
+    { (GLADapiproc *) &glad_glGenerateTextureMipmap, (GLADapiproc *) &glad_debug_glGenerateTextureMipmap, (GLADapiproc) glad_debug_impl_glGenerateTextureMipmap },
+    { (GLADapiproc *) &glad_glGetActiveAtomicCounterBufferiv, (GLADapiproc *) &glad_debug_glGetActiveAtomicCounterBufferiv, (GLADapiproc) glad_debug_impl_glGetActiveAtomicCounterBufferiv },
+    { (GLADapiproc *) &glad_glGetActiveAttrib, (GLADapiproc *) &glad_debug_glGetActiveAttrib, (GLADapiproc) glad_debug_impl_glGetActiveAttrib },
+    { (GLADapiproc *) &glad_glGetActiveSubroutineName, (GLADapiproc *) &glad_debug_glGetActiveSubroutineName, (GLADapiproc) glad_debug_impl_glGetActiveSubroutineName },
+    { (GLADapiproc *) &glad_glGetActiveSubroutineUniformName, (GLADapiproc *) &glad_debug_glGetActiveSubroutineUniformName, (GLADapiproc) glad_debug_impl_glGetActiveSubroutineUniformName },
+    { (GLADapiproc *) &glad_glGetActiveSubroutineUniformiv, (GLADapiproc *) &glad_debug_glGetActiveSubroutineUniformiv, (GLADapiproc) glad_debug_impl_glGetActiveSubroutineUniformiv },
+    { (GLADapiproc *) &glad_glGetActiveUniform, (GLADapiproc *) &glad_debug_glGetActiveUniform, (GLADapiproc) glad_debug_impl_glGetActiveUniform },
+    { (GLADapiproc *) &glad_glGetActiveUniformBlockName, (GLADapiproc *) &glad_debug_glGetActiveUniformBlockName, (GLADapiproc) glad_debug_impl_glGetActiveUniformBlockName },
+    { (GLADapiproc *) &glad_glGetActiveUniformBlockiv, (GLADapiproc *) &glad_debug_glGetActiveUniformBlockiv, (GLADapiproc) glad_debug_impl_glGetActiveUniformBlockiv },
+    { (GLADapiproc *) &glad_glGetActiveUniformName, (GLADapiproc *) &glad_debug_glGetActiveUniformName, (GLADapiproc) glad_debug_impl_glGetActiveUniformName },
+    { (GLADapiproc *) &glad_glGetActiveUniformsiv, (GLADapiproc *) &glad_debug_glGetActiveUniformsiv, (GLADapiproc) glad_debug_impl_glGetActiveUniformsiv },
+    { (GLADapiproc *) &glad_glGetAttachedShaders, (GLADapiproc *) &glad_debug_glGetAttachedShaders, (GLADapiproc) glad_debug_impl_glGetAttachedShaders },
+    { (GLADapiproc *) &glad_glGetAttribLocation, (GLADapiproc *) &glad_debug_glGetAttribLocation, (GLADapiproc) glad_debug_impl_glGetAttribLocation },
+    { (GLADapiproc *) &glad_glGetBooleani_v, (GLADapiproc *) &glad_debug_glGetBooleani_v, (GLADapiproc) glad_debug_impl_glGetBooleani_v },
+    { (GLADapiproc *) &glad_glGetBooleanv, (GLADapiproc *) &glad_debug_glGetBooleanv, (GLADapiproc) glad_debug_impl_glGetBooleanv },
+    { (GLADapiproc *) &glad_glGetBufferParameteri64v, (GLADapiproc *) &glad_debug_glGetBufferParameteri64v, (GLADapiproc) glad_debug_impl_glGetBufferParameteri64v },
+    { (GLADapiproc *) &glad_glGetBufferParameteriv, (GLADapiproc *) &glad_debug_glGetBufferParameteriv, (GLADapiproc) glad_debug_impl_glGetBufferParameteriv },
+    { (GLADapiproc *) &glad_glGetBufferPointerv, (GLADapiproc *) &glad_debug_glGetBufferPointerv, (GLADapiproc) glad_debug_impl_glGetBufferPointerv },
+    { (GLADapiproc *) &glad_glGetBufferSubData, (GLADapiproc *) &glad_debug_glGetBufferSubData, (GLADapiproc) glad_debug_impl_glGetBufferSubData },
+    { (GLADapiproc *) &glad_glGetCompressedTexImage, (GLADapiproc *) &glad_debug_glGetCompressedTexImage, (GLADapiproc) glad_debug_impl_glGetCompressedTexImage },
+    { (GLADapiproc *) &glad_glGetCompressedTextureImage, (GLADapiproc *) &glad_debug_glGetCompressedTextureImage, (GLADapiproc) glad_debug_impl_glGetCompressedTextureImage },
+    { (GLADapiproc *) &glad_glGetCompressedTextureSubImage, (GLADapiproc *) &glad_debug_glGetCompressedTextureSubImage, (GLADapiproc) glad_debug_impl_glGetCompressedTextureSubImage },
+    { (GLADapiproc *) &glad_glGetDebugMessageLog, (GLADapiproc *) &glad_debug_glGetDebugMessageLog, (GLADapiproc) glad_debug_impl_glGetDebugMessageLog },
+    { (GLADapiproc *) &glad_glGetDoublei_v, (GLADapiproc *) &glad_debug_glGetDoublei_v, (GLADapiproc) glad_debug_impl_glGetDoublei_v },
+    { (GLADapiproc *) &glad_glGetDoublev, (GLADapiproc *) &glad_debug_glGetDoublev, (GLADapiproc) glad_debug_impl_glGetDoublev },
+    { (GLADapiproc *) &glad_glGetError, (GLADapiproc *) &glad_debug_glGetError, (GLADapiproc) glad_debug_impl_glGetError },
+    { (GLADapiproc *) &glad_glGetFloati_v, (GLADapiproc *) &glad_debug_glGetFloati_v, (GLADapiproc) glad_debug_impl_glGetFloati_v },
+    { (GLADapiproc *) &glad_glGetFloatv, (GLADapiproc *) &glad_debug_glGetFloatv, (GLADapiproc) glad_debug_impl_glGetFloatv },
+    { (GLADapiproc *) &glad_glGetFragDataIndex, (GLADapiproc *) &glad_debug_glGetFragDataIndex, (GLADapiproc) glad_debug_impl_glGetFragDataIndex },
+    { (GLADapiproc *) &glad_glGetFragDataLocation, (GLADapiproc *) &glad_debug_glGetFragDataLocation, (GLADapiproc) glad_debug_impl_glGetFragDataLocation },
+    { (GLADapiproc *) &glad_glGetFramebufferAttachmentParameteriv, (GLADapiproc *) &glad_debug_glGetFramebufferAttachmentParameteriv, (GLADapiproc) glad_debug_impl_glGetFramebufferAttachmentParameteriv },
+    { (GLADapiproc *) &glad_glGetFramebufferParameteriv, (GLADapiproc *) &glad_debug_glGetFramebufferParameteriv, (GLADapiproc) glad_debug_impl_glGetFramebufferParameteriv },
+    { (GLADapiproc *) &glad_glGetGraphicsResetStatus, (GLADapiproc *) &glad_debug_glGetGraphicsResetStatus, (GLADapiproc) glad_debug_impl_glGetGraphicsResetStatus },
+    { (GLADapiproc *) &glad_glGetInteger64i_v, (GLADapiproc *) &glad_debug_glGetInteger64i_v, (GLADapiproc) glad_debug_impl_glGetInteger64i_v },
+    { (GLADapiproc *) &glad_glGetInteger64v, (GLADapiproc *) &glad_debug_glGetInteger64v, (GLADapiproc) glad_debug_impl_glGetInteger64v },
+    { (GLADapiproc *) &glad_glGetIntegeri_v, (GLADapiproc *) &glad_debug_glGetIntegeri_v, (GLADapiproc) glad_debug_impl_glGetIntegeri_v },
+    { (GLADapiproc *) &glad_glGetIntegerv, (GLADapiproc *) &glad_debug_glGetIntegerv, (GLADapiproc) glad_debug_impl_glGetIntegerv },
+    { (GLADapiproc *) &glad_glGetInternalformati64v, (GLADapiproc *) &glad_debug_glGetInternalformati64v, (GLADapiproc) glad_debug_impl_glGetInternalformati64v },
+    { (GLADapiproc *) &glad_glGetInternalformativ, (GLADapiproc *) &glad_debug_glGetInternalformativ, (GLADapiproc) glad_debug_impl_glGetInternalformativ },
+    { (GLADapiproc *) &glad_glGetMultisamplefv, (GLADapiproc *) &glad_debug_glGetMultisamplefv, (GLADapiproc) glad_debug_impl_glGetMultisamplefv },
+    { (GLADapiproc *) &glad_glGetNamedBufferParameteri64v, (GLADapiproc *) &glad_debug_glGetNamedBufferParameteri64v, (GLADapiproc) glad_debug_impl_glGetNamedBufferParameteri64v },
+    { (GLADapiproc *) &glad_glGetNamedBufferParameteriv, (GLADapiproc *) &glad_debug_glGetNamedBufferParameteriv, (GLADapiproc) glad_debug_impl_glGetNamedBufferParameteriv },
+    { (GLADapiproc *) &glad_glGetNamedBufferPointerv, (GLADapiproc *) &glad_debug_glGetNamedBufferPointerv, (GLADapiproc) glad_debug_impl_glGetNamedBufferPointerv },
+    { (GLADapiproc *) &glad_glGetNamedBufferSubData, (GLADapiproc *) &glad_debug_glGetNamedBufferSubData, (GLADapiproc) glad_debug_impl_glGetNamedBufferSubData },
+    { (GLADapiproc *) &glad_glGetNamedFramebufferAttachmentParameteriv, (GLADapiproc *) &glad_debug_glGetNamedFramebufferAttachmentParameteriv, (GLADapiproc) glad_debug_impl_glGetNamedFramebufferAttachmentParameteriv },
+    { (GLADapiproc *) &glad_glGetNamedFramebufferParameteriv, (GLADapiproc *) &glad_debug_glGetNamedFramebufferParameteriv, (GLADapiproc) glad_debug_impl_glGetNamedFramebufferParameteriv },
+    { (GLADapiproc *) &glad_glGetNamedRenderbufferParameteriv, (GLADapiproc *) &glad_debug_glGetNamedRenderbufferParameteriv, (GLADapiproc) glad_debug_impl_glGetNamedRenderbufferParameteriv },
+    { (GLADapiproc *) &glad_glGetObjectLabel, (GLADapiproc *) &glad_debug_glGetObjectLabel, (GLADapiproc) glad_debug_impl_glGetObjectLabel },
+    { (GLADapiproc *) &glad_glGetObjectPtrLabel, (GLADapiproc *) &glad_debug_glGetObjectPtrLabel, (GLADapiproc) glad_debug_impl_glGetObjectPtrLabel },
+    { (GLADapiproc *) &glad_glGetPointerv, (GLADapiproc *) &glad_debug_glGetPointerv, (GLADapiproc) glad_debug_impl_glGetPointerv },
+    { (GLADapiproc *) &glad_glGetProgramBinary, (GLADapiproc *) &glad_debug_glGetProgramBinary, (GLADapiproc) glad_debug_impl_glGetProgramBinary },
+    { (GLADapiproc *) &glad_glGetProgramInfoLog, (GLADapiproc *) &glad_debug_glGetProgramInfoLog, (GLADapiproc) glad_debug_impl_glGetProgramInfoLog },
+    { (GLADapiproc *) &glad_glGetProgramInterfaceiv, (GLADapiproc *) &glad_debug_glGetProgramInterfaceiv, (GLADapiproc) glad_debug_impl_glGetProgramInterfaceiv },
+    { (GLADapiproc *) &glad_glGetProgramPipelineInfoLog, (GLADapiproc *) &glad_debug_glGetProgramPipelineInfoLog, (GLADapiproc) glad_debug_impl_glGetProgramPipelineInfoLog },
+    { (GLADapiproc *) &glad_glGetProgramPipelineiv, (GLADapiproc *) &glad_debug_glGetProgramPipelineiv, (GLADapiproc) glad_debug_impl_glGetProgramPipelineiv },
+    { (GLADapiproc *) &glad_glGetProgramResourceIndex, (GLADapiproc *) &glad_debug_glGetProgramResourceIndex, (GLADapiproc) glad_debug_impl_glGetProgramResourceIndex },
+    { (GLADapiproc *) &glad_glGetProgramResourceLocation, (GLADapiproc *) &glad_debug_glGetProgramResourceLocation, (GLADapiproc) glad_debug_impl_glGetProgramResourceLocation },
+    { (GLADapiproc *) &glad_glGetProgramResourceLocationIndex, (GLADapiproc *) &glad_debug_glGetProgramResourceLocationIndex, (GLADapiproc) glad_debug_impl_glGetProgramResourceLocationIndex },
+    { (GLADapiproc *) &glad_glGetProgramResourceName, (GLADapiproc *) &glad_debug_glGetProgramResourceName, (GLADapiproc) glad_debug_impl_glGetProgramResourceName },
+    { (GLADapiproc *) &glad_glGetProgramResourceiv, (GLADapiproc *) &glad_debug_glGetProgramResourceiv, (GLADapiproc) glad_debug_impl_glGetProgramResourceiv },
+    { (GLADapiproc *) &glad_glGetProgramStageiv, (GLADapiproc *) &glad_debug_glGetProgramStageiv, (GLADapiproc) glad_debug_impl_glGetProgramStageiv },
+    { (GLADapiproc *) &glad_glGetProgramiv, (GLADapiproc *) &glad_debug_glGetProgramiv, (GLADapiproc) glad_debug_impl_glGetProgramiv },
+    { (GLADapiproc *) &glad_glGetQueryBufferObjecti64v, (GLADapiproc *) &glad_debug_glGetQueryBufferObjecti64v, (GLADapiproc) glad_debug_impl_glGetQueryBufferObjecti64v },
+    { (GLADapiproc *) &glad_glGetQueryBufferObjectiv, (GLADapiproc *) &glad_debug_glGetQueryBufferObjectiv, (GLADapiproc) glad_debug_impl_glGetQueryBufferObjectiv },
+    { (GLADapiproc *) &glad_glGetQueryBufferObjectui64v, (GLADapiproc *) &glad_debug_glGetQueryBufferObjectui64v, (GLADapiproc) glad_debug_impl_glGetQueryBufferObjectui64v },
+    { (GLADapiproc *) &glad_glGetQueryBufferObjectuiv, (GLADapiproc *) &glad_debug_glGetQueryBufferObjectuiv, (GLADapiproc) glad_debug_impl_glGetQueryBufferObjectuiv },
+    { (GLADapiproc *) &glad_glGetQueryIndexediv, (GLADapiproc *) &glad_debug_glGetQueryIndexediv, (GLADapiproc) glad_debug_impl_glGetQueryIndexediv },
+    { (GLADapiproc *) &glad_glGetQueryObjecti64v, (GLADapiproc *) &glad_debug_glGetQueryObjecti64v, (GLADapiproc) glad_debug_impl_glGetQueryObjecti64v },
+    { (GLADapiproc *) &glad_glGetQueryObjectiv, (GLADapiproc *) &glad_debug_glGetQueryObjectiv, (GLADapiproc) glad_debug_impl_glGetQueryObjectiv },
+    { (GLADapiproc *) &glad_glGetQueryObjectui64v, (GLADapiproc *) &glad_debug_glGetQueryObjectui64v, (GLADapiproc) glad_debug_impl_glGetQueryObjectui64v },
+    { (GLADapiproc *) &glad_glGetQueryObjectuiv, (GLADapiproc *) &glad_debug_glGetQueryObjectuiv, (GLADapiproc) glad_debug_impl_glGetQueryObjectuiv },
+    { (GLADapiproc *) &glad_glGetQueryiv, (GLADapiproc *) &glad_debug_glGetQueryiv, (GLADapiproc) glad_debug_impl_glGetQueryiv },
+    { (GLADapiproc *) &glad_glGetRenderbufferParameteriv, (GLADapiproc *) &glad_debug_glGetRenderbufferParameteriv, (GLADapiproc) glad_debug_impl_glGetRenderbufferParameteriv },
+    { (GLADapiproc *) &glad_glGetSamplerParameterIiv, (GLADapiproc *) &glad_debug_glGetSamplerParameterIiv, (GLADapiproc) glad_debug_impl_glGetSamplerParameterIiv },
+    { (GLADapiproc *) &glad_glGetSamplerParameterIuiv, (GLADapiproc *) &glad_debug_glGetSamplerParameterIuiv, (GLADapiproc) glad_debug_impl_glGetSamplerParameterIuiv },
+    { (GLADapiproc *) &glad_glGetSamplerParameterfv, (GLADapiproc *) &glad_debug_glGetSamplerParameterfv, (GLADapiproc) glad_debug_impl_glGetSamplerParameterfv },
+    { (GLADapiproc *) &glad_glGetSamplerParameteriv, (GLADapiproc *) &glad_debug_glGetSamplerParameteriv, (GLADapiproc) glad_debug_impl_glGetSamplerParameteriv },
+    { (GLADapiproc *) &glad_glGetShaderInfoLog, (GLADapiproc *) &glad_debug_glGetShaderInfoLog, (GLADapiproc) glad_debug_impl_glGetShaderInfoLog },
+    { (GLADapiproc *) &glad_glGetShaderPrecisionFormat, (GLADapiproc *) &glad_debug_glGetShaderPrecisionFormat, (GLADapiproc) glad_debug_impl_glGetShaderPrecisionFormat },
+    { (GLADapiproc *) &glad_glGetShaderSource, (GLADapiproc *) &glad_debug_glGetShaderSource, (GLADapiproc) glad_debug_impl_glGetShaderSource },
+    { (GLADapiproc *) &glad_glGetShaderiv, (GLADapiproc *) &glad_debug_glGetShaderiv, (GLADapiproc) glad_debug_impl_glGetShaderiv },
+    { (GLADapiproc *) &glad_glGetString, (GLADapiproc *) &glad_debug_glGetString, (GLADapiproc) glad_debug_impl_glGetString },
+    { (GLADapiproc *) &glad_glGetStringi, (GLADapiproc *) &glad_debug_glGetStringi, (GLADapiproc) glad_debug_impl_glGetStringi },
+    { (GLADapiproc *) &glad_glGetSubroutineIndex, (GLADapiproc *) &glad_debug_glGetSubroutineIndex, (GLADapiproc) glad_debug_impl_glGetSubroutineIndex },
+    { (GLADapiproc *) &glad_glGetSubroutineUniformLocation, (GLADapiproc *) &glad_debug_glGetSubroutineUniformLocation, (GLADapiproc) glad_debug_impl_glGetSubroutineUniformLocation },
+    { (GLADapiproc *) &glad_glGetSynciv, (GLADapiproc *) &glad_debug_glGetSynciv, (GLADapiproc) glad_debug_impl_glGetSynciv },
+    { (GLADapiproc *) &glad_glGetTexImage, (GLADapiproc *) &glad_debug_glGetTexImage, (GLADapiproc) glad_debug_impl_glGetTexImage },
+    { (GLADapiproc *) &glad_glGetTexLevelParameterfv, (GLADapiproc *) &glad_debug_glGetTexLevelParameterfv, (GLADapiproc) glad_debug_impl_glGetTexLevelParameterfv },
+    { (GLADapiproc *) &glad_glGetTexLevelParameteriv, (GLADapiproc *) &glad_debug_glGetTexLevelParameteriv, (GLADapiproc) glad_debug_impl_glGetTexLevelParameteriv },
+    { (GLADapiproc *) &glad_glGetTexParameterIiv, (GLADapiproc *) &glad_debug_glGetTexParameterIiv, (GLADapiproc) glad_debug_impl_glGetTexParameterIiv },
+    { (GLADapiproc *) &glad_glGetTexParameterIuiv, (GLADapiproc *) &glad_debug_glGetTexParameterIuiv, (GLADapiproc) glad_debug_impl_glGetTexParameterIuiv },
+    { (GLADapiproc *) &glad_glGetTexParameterfv, (GLADapiproc *) &glad_debug_glGetTexParameterfv, (GLADapiproc) glad_debug_impl_glGetTexParameterfv },
+    { (GLADapiproc *) &glad_glGetTexParameteriv, (GLADapiproc *) &glad_debug_glGetTexParameteriv, (GLADapiproc) glad_debug_impl_glGetTexParameteriv },
+    { (GLADapiproc *) &glad_glGetTextureImage, (GLADapiproc *) &glad_debug_glGetTextureImage, (GLADapiproc) glad_debug_impl_glGetTextureImage },
+    { (GLADapiproc *) &glad_glGetTextureLevelParameterfv, (GLADapiproc *) &glad_debug_glGetTextureLevelParameterfv, (GLADapiproc) glad_debug_impl_glGetTextureLevelParameterfv },
+    { (GLADapiproc *) &glad_glGetTextureLevelParameteriv, (GLADapiproc *) &glad_debug_glGetTextureLevelParameteriv, (GLADapiproc) glad_debug_impl_glGetTextureLevelParameteriv },
+    { (GLADapiproc *) &glad_glGetTextureParameterIiv, (GLADapiproc *) &glad_debug_glGetTextureParameterIiv, (GLADapiproc) glad_debug_impl_glGetTextureParameterIiv },
+    { (GLADapiproc *) &glad_glGetTextureParameterIuiv, (GLADapiproc *) &glad_debug_glGetTextureParameterIuiv, (GLADapiproc) glad_debug_impl_glGetTextureParameterIuiv },
+    { (GLADapiproc *) &glad_glGetTextureParameterfv, (GLADapiproc *) &glad_debug_glGetTextureParameterfv, (GLADapiproc) glad_debug_impl_glGetTextureParameterfv },
+    { (GLADapiproc *) &glad_glGetTextureParameteriv, (GLADapiproc *) &glad_debug_glGetTextureParameteriv, (GLADapiproc) glad_debug_impl_glGetTextureParameteriv },
+    { (GLADapiproc *) &glad_glGetTextureSubImage, (GLADapiproc *) &glad_debug_glGetTextureSubImage, (GLADapiproc) glad_debug_impl_glGetTextureSubImage },
+    { (GLADapiproc *) &glad_glGetTransformFeedbackVarying, (GLADapiproc *) &glad_debug_glGetTransformFeedbackVarying, (GLADapiproc) glad_debug_impl_glGetTransformFeedbackVarying },
+    { (GLADapiproc *) &glad_glGetTransformFeedbacki64_v, (GLADapiproc *) &glad_debug_glGetTransformFeedbacki64_v, (GLADapiproc) glad_debug_impl_glGetTransformFeedbacki64_v },
+    { (GLADapiproc *) &glad_glGetTransformFeedbacki_v, (GLADapiproc *) &glad_debug_glGetTransformFeedbacki_v, (GLADapiproc) glad_debug_impl_glGetTransformFeedbacki_v },
+    { (GLADapiproc *) &glad_glGetTransformFeedbackiv, (GLADapiproc *) &glad_debug_glGetTransformFeedbackiv, (GLADapiproc) glad_debug_impl_glGetTransformFeedbackiv },
+    { (GLADapiproc *) &glad_glGetUniformBlockIndex, (GLADapiproc *) &glad_debug_glGetUniformBlockIndex, (GLADapiproc) glad_debug_impl_glGetUniformBlockIndex },
+    { (GLADapiproc *) &glad_glGetUniformIndices, (GLADapiproc *) &glad_debug_glGetUniformIndices, (GLADapiproc) glad_debug_impl_glGetUniformIndices },
+    { (GLADapiproc *) &glad_glGetUniformLocation, (GLADapiproc *) &glad_debug_glGetUniformLocation, (GLADapiproc) glad_debug_impl_glGetUniformLocation },
+    { (GLADapiproc *) &glad_glGetUniformSubroutineuiv, (GLADapiproc *) &glad_debug_glGetUniformSubroutineuiv, (GLADapiproc) glad_debug_impl_glGetUniformSubroutineuiv },
+    { (GLADapiproc *) &glad_glGetUniformdv, (GLADapiproc *) &glad_debug_glGetUniformdv, (GLADapiproc) glad_debug_impl_glGetUniformdv },
+    { (GLADapiproc *) &glad_glGetUniformfv, (GLADapiproc *) &glad_debug_glGetUniformfv, (GLADapiproc) glad_debug_impl_glGetUniformfv },
+    { (GLADapiproc *) &glad_glGetUniformiv, (GLADapiproc *) &glad_debug_glGetUniformiv, (GLADapiproc) glad_debug_impl_glGetUniformiv },
+    { (GLADapiproc *) &glad_glGetUniformuiv, (GLADapiproc *) &glad_debug_glGetUniformuiv, (GLADapiproc) glad_debug_impl_glGetUniformuiv },
+    { (GLADapiproc *) &glad_glGetVertexArrayIndexed64iv, (GLADapiproc *) &glad_debug_glGetVertexArrayIndexed64iv, (GLADapiproc) glad_debug_impl_glGetVertexArrayIndexed64iv },
+    { (GLADapiproc *) &glad_glGetVertexArrayIndexediv, (GLADapiproc *) &glad_debug_glGetVertexArrayIndexediv, (GLADapiproc) glad_debug_impl_glGetVertexArrayIndexediv },
+    { (GLADapiproc *) &glad_glGetVertexArrayiv, (GLADapiproc *) &glad_debug_glGetVertexArrayiv, (GLADapiproc) glad_debug_impl_glGetVertexArrayiv },
+    { (GLADapiproc *) &glad_glGetVertexAttribIiv, (GLADapiproc *) &glad_debug_glGetVertexAttribIiv, (GLADapiproc) glad_debug_impl_glGetVertexAttribIiv },
+    { (GLADapiproc *) &glad_glGetVertexAttribIuiv, (GLADapiproc *) &glad_debug_glGetVertexAttribIuiv, (GLADapiproc) glad_debug_impl_glGetVertexAttribIuiv },
+    { (GLADapiproc *) &glad_glGetVertexAttribLdv, (GLADapiproc *) &glad_debug_glGetVertexAttribLdv, (GLADapiproc) glad_debug_impl_glGetVertexAttribLdv },
+    { (GLADapiproc *) &glad_glGetVertexAttribPointerv, (GLADapiproc *) &glad_debug_glGetVertexAttribPointerv, (GLADapiproc) glad_debug_impl_glGetVertexAttribPointerv },
+    { (GLADapiproc *) &glad_glGetVertexAttribdv, (GLADapiproc *) &glad_debug_glGetVertexAttribdv, (GLADapiproc) glad_debug_impl_glGetVertexAttribdv },
+    { (GLADapiproc *) &glad_glGetVertexAttribfv, (GLADapiproc *) &glad_debug_glGetVertexAttribfv, (GLADapiproc) glad_debug_impl_glGetVertexAttribfv },
+    { (GLADapiproc *) &glad_glGetVertexAttribiv, (GLADapiproc *) &glad_debug_glGetVertexAttribiv, (GLADapiproc) glad_debug_impl_glGetVertexAttribiv },
+    { (GLADapiproc *) &glad_glGetnCompressedTexImage, (GLADapiproc *) &glad_debug_glGetnCompressedTexImage, (GLADapiproc) glad_debug_impl_glGetnCompressedTexImage },
+    { (GLADapiproc *) &glad_glGetnTexImage, (GLADapiproc *) &glad_debug_glGetnTexImage, (GLADapiproc) glad_debug_impl_glGetnTexImage },
+    { (GLADapiproc *) &glad_glGetnUniformdv, (GLADapiproc *) &glad_debug_glGetnUniformdv, (GLADapiproc) glad_debug_impl_glGetnUniformdv },
+    { (GLADapiproc *) &glad_glGetnUniformfv, (GLADapiproc *) &glad_debug_glGetnUniformfv, (GLADapiproc) glad_debug_impl_glGetnUniformfv },
+    { (GLADapiproc *) &glad_glGetnUniformiv, (GLADapiproc *) &glad_debug_glGetnUniformiv, (GLADapiproc) glad_debug_impl_glGetnUniformiv },
+    { (GLADapiproc *) &glad_glGetnUniformuiv, (GLADapiproc *) &glad_debug_glGetnUniformuiv, (GLADapiproc) glad_debug_impl_glGetnUniformuiv },
+    { (GLADapiproc *) &glad_glHint, (GLADapiproc *) &glad_debug_glHint, (GLADapiproc) glad_debug_impl_glHint },
+    { (GLADapiproc *) &glad_glInvalidateBufferData, (GLADapiproc *) &glad_debug_glInvalidateBufferData, (GLADapiproc) glad_debug_impl_glInvalidateBufferData },
+    { (GLADapiproc *) &glad_glInvalidateBufferSubData, (GLADapiproc *) &glad_debug_glInvalidateBufferSubData, (GLADapiproc) glad_debug_impl_glInvalidateBufferSubData },
+    { (GLADapiproc *) &glad_glInvalidateFramebuffer, (GLADapiproc *) &glad_debug_glInvalidateFramebuffer, (GLADapiproc) glad_debug_impl_glInvalidateFramebuffer },
+    { (GLADapiproc *) &glad_glInvalidateNamedFramebufferData, (GLADapiproc *) &glad_debug_glInvalidateNamedFramebufferData, (GLADapiproc) glad_debug_impl_glInvalidateNamedFramebufferData },
+    { (GLADapiproc *) &glad_glInvalidateNamedFramebufferSubData, (GLADapiproc *) &glad_debug_glInvalidateNamedFramebufferSubData, (GLADapiproc) glad_debug_impl_glInvalidateNamedFramebufferSubData },
+    { (GLADapiproc *) &glad_glInvalidateSubFramebuffer, (GLADapiproc *) &glad_debug_glInvalidateSubFramebuffer, (GLADapiproc) glad_debug_impl_glInvalidateSubFramebuffer },
+    { (GLADapiproc *) &glad_glInvalidateTexImage, (GLADapiproc *) &glad_debug_glInvalidateTexImage, (GLADapiproc) glad_debug_impl_glInvalidateTexImage },
+    { (GLADapiproc *) &glad_glInvalidateTexSubImage, (GLADapiproc *) &glad_debug_glInvalidateTexSubImage, (GLADapiproc) glad_debug_impl_glInvalidateTexSubImage },
+    { (GLADapiproc *) &glad_glIsBuffer, (GLADapiproc *) &glad_debug_glIsBuffer, (GLADapiproc) glad_debug_impl_glIsBuffer },
+    { (GLADapiproc *) &glad_glIsEnabled, (GLADapiproc *) &glad_debug_glIsEnabled, (GLADapiproc) glad_debug_impl_glIsEnabled },
+    { (GLADapiproc *) &glad_glIsEnabledi, (GLADapiproc *) &glad_debug_glIsEnabledi, (GLADapiproc) glad_debug_impl_glIsEnabledi },
+    { (GLADapiproc *) &glad_glIsFramebuffer, (GLADapiproc *) &glad_debug_glIsFramebuffer, (GLADapiproc) glad_debug_impl_glIsFramebuffer },
+    { (GLADapiproc *) &glad_glIsProgram, (GLADapiproc *) &glad_debug_glIsProgram, (GLADapiproc) glad_debug_impl_glIsProgram },
+    { (GLADapiproc *) &glad_glIsProgramPipeline, (GLADapiproc *) &glad_debug_glIsProgramPipeline, (GLADapiproc) glad_debug_impl_glIsProgramPipeline },
+    { (GLADapiproc *) &glad_glIsQuery, (GLADapiproc *) &glad_debug_glIsQuery, (GLADapiproc) glad_debug_impl_glIsQuery },
+    { (GLADapiproc *) &glad_glIsRenderbuffer, (GLADapiproc *) &glad_debug_glIsRenderbuffer, (GLADapiproc) glad_debug_impl_glIsRenderbuffer },
+    { (GLADapiproc *) &glad_glIsSampler, (GLADapiproc *) &glad_debug_glIsSampler, (GLADapiproc) glad_debug_impl_glIsSampler },
+    { (GLADapiproc *) &glad_glIsShader, (GLADapiproc *) &glad_debug_glIsShader, (GLADapiproc) glad_debug_impl_glIsShader },
+    { (GLADapiproc *) &glad_glIsSync, (GLADapiproc *) &glad_debug_glIsSync, (GLADapiproc) glad_debug_impl_glIsSync },
+    { (GLADapiproc *) &glad_glIsTexture, (GLADapiproc *) &glad_debug_glIsTexture, (GLADapiproc) glad_debug_impl_glIsTexture },
+    { (GLADapiproc *) &glad_glIsTransformFeedback, (GLADapiproc *) &glad_debug_glIsTransformFeedback, (GLADapiproc) glad_debug_impl_glIsTransformFeedback },
+    { (GLADapiproc *) &glad_glIsVertexArray, (GLADapiproc *) &glad_debug_glIsVertexArray, (GLADapiproc) glad_debug_impl_glIsVertexArray },
+    { (GLADapiproc *) &glad_glLineWidth, (GLADapiproc *) &glad_debug_glLineWidth, (GLADapiproc) glad_debug_impl_glLineWidth },
+    { (GLADapiproc *) &glad_glLinkProgram, (GLADapiproc *) &glad_debug_glLinkProgram, (GLADapiproc) glad_debug_impl_glLinkProgram },
+    { (GLADapiproc *) &glad_glLogicOp, (GLADapiproc *) &glad_debug_glLogicOp, (GLADapiproc) glad_debug_impl_glLogicOp },
+    { (GLADapiproc *) &glad_glMapBuffer, (GLADapiproc *) &glad_debug_glMapBuffer, (GLADapiproc) glad_debug_impl_glMapBuffer },
+    { (GLADapiproc *) &glad_glMapBufferRange, (GLADapiproc *) &glad_debug_glMapBufferRange, (GLADapiproc) glad_debug_impl_glMapBufferRange },
+    { (GLADapiproc *) &glad_glMapNamedBuffer, (GLADapiproc *) &glad_debug_glMapNamedBuffer, (GLADapiproc) glad_debug_impl_glMapNamedBuffer },
+    { (GLADapiproc *) &glad_glMapNamedBufferRange, (GLADapiproc *) &glad_debug_glMapNamedBufferRange, (GLADapiproc) glad_debug_impl_glMapNamedBufferRange },
+    { (GLADapiproc *) &glad_glMemoryBarrier, (GLADapiproc *) &glad_debug_glMemoryBarrier, (GLADapiproc) glad_debug_impl_glMemoryBarrier },
+    { (GLADapiproc *) &glad_glMemoryBarrierByRegion, (GLADapiproc *) &glad_debug_glMemoryBarrierByRegion, (GLADapiproc) glad_debug_impl_glMemoryBarrierByRegion },
+    { (GLADapiproc *) &glad_glMinSampleShading, (GLADapiproc *) &glad_debug_glMinSampleShading, (GLADapiproc) glad_debug_impl_glMinSampleShading },
+    { (GLADapiproc *) &glad_glMultiDrawArrays, (GLADapiproc *) &glad_debug_glMultiDrawArrays, (GLADapiproc) glad_debug_impl_glMultiDrawArrays },
+    { (GLADapiproc *) &glad_glMultiDrawArraysIndirect, (GLADapiproc *) &glad_debug_glMultiDrawArraysIndirect, (GLADapiproc) glad_debug_impl_glMultiDrawArraysIndirect },
+    { (GLADapiproc *) &glad_glMultiDrawArraysIndirectCount, (GLADapiproc *) &glad_debug_glMultiDrawArraysIndirectCount, (GLADapiproc) glad_debug_impl_glMultiDrawArraysIndirectCount },
+    { (GLADapiproc *) &glad_glMultiDrawElements, (GLADapiproc *) &glad_debug_glMultiDrawElements, (GLADapiproc) glad_debug_impl_glMultiDrawElements },
+    { (GLADapiproc *) &glad_glMultiDrawElementsBaseVertex, (GLADapiproc *) &glad_debug_glMultiDrawElementsBaseVertex, (GLADapiproc) glad_debug_impl_glMultiDrawElementsBaseVertex },
+    { (GLADapiproc *) &glad_glMultiDrawElementsIndirect, (GLADapiproc *) &glad_debug_glMultiDrawElementsIndirect, (GLADapiproc) glad_debug_impl_glMultiDrawElementsIndirect },
+    { (GLADapiproc *) &glad_glMultiDrawElementsIndirectCount, (GLADapiproc *) &glad_debug_glMultiDrawElementsIndirectCount, (GLADapiproc) glad_debug_impl_glMultiDrawElementsIndirectCount },
+    { (GLADapiproc *) &glad_glNamedBufferData, (GLADapiproc *) &glad_debug_glNamedBufferData, (GLADapiproc) glad_debug_impl_glNamedBufferData },
+    { (GLADapiproc *) &glad_glNamedBufferStorage, (GLADapiproc *) &glad_debug_glNamedBufferStorage, (GLADapiproc) glad_debug_impl_glNamedBufferStorage },
+    { (GLADapiproc *) &glad_glNamedBufferSubData, (GLADapiproc *) &glad_debug_glNamedBufferSubData, (GLADapiproc) glad_debug_impl_glNamedBufferSubData },
+    { (GLADapiproc *) &glad_glNamedFramebufferDrawBuffer, (GLADapiproc *) &glad_debug_glNamedFramebufferDrawBuffer, (GLADapiproc) glad_debug_impl_glNamedFramebufferDrawBuffer },
+    { (GLADapiproc *) &glad_glNamedFramebufferDrawBuffers, (GLADapiproc *) &glad_debug_glNamedFramebufferDrawBuffers, (GLADapiproc) glad_debug_impl_glNamedFramebufferDrawBuffers },
+    { (GLADapiproc *) &glad_glNamedFramebufferParameteri, (GLADapiproc *) &glad_debug_glNamedFramebufferParameteri, (GLADapiproc) glad_debug_impl_glNamedFramebufferParameteri },
+    { (GLADapiproc *) &glad_glNamedFramebufferReadBuffer, (GLADapiproc *) &glad_debug_glNamedFramebufferReadBuffer, (GLADapiproc) glad_debug_impl_glNamedFramebufferReadBuffer },
+    { (GLADapiproc *) &glad_glNamedFramebufferRenderbuffer, (GLADapiproc *) &glad_debug_glNamedFramebufferRenderbuffer, (GLADapiproc) glad_debug_impl_glNamedFramebufferRenderbuffer },
+    { (GLADapiproc *) &glad_glNamedFramebufferTexture, (GLADapiproc *) &glad_debug_glNamedFramebufferTexture, (GLADapiproc) glad_debug_impl_glNamedFramebufferTexture },
+    { (GLADapiproc *) &glad_glNamedFramebufferTextureLayer, (GLADapiproc *) &glad_debug_glNamedFramebufferTextureLayer, (GLADapiproc) glad_debug_impl_glNamedFramebufferTextureLayer },
+    { (GLADapiproc *) &glad_glNamedRenderbufferStorage, (GLADapiproc *) &glad_debug_glNamedRenderbufferStorage, (GLADapiproc) glad_debug_impl_glNamedRenderbufferStorage },
+    { (GLADapiproc *) &glad_glNamedRenderbufferStorageMultisample, (GLADapiproc *) &glad_debug_glNamedRenderbufferStorageMultisample, (GLADapiproc) glad_debug_impl_glNamedRenderbufferStorageMultisample },
+    { (GLADapiproc *) &glad_glObjectLabel, (GLADapiproc *) &glad_debug_glObjectLabel, (GLADapiproc) glad_debug_impl_glObjectLabel },
+    { (GLADapiproc *) &glad_glObjectPtrLabel, (GLADapiproc *) &glad_debug_glObjectPtrLabel, (GLADapiproc) glad_debug_impl_glObjectPtrLabel },
+    { (GLADapiproc *) &glad_glPatchParameterfv, (GLADapiproc *) &glad_debug_glPatchParameterfv, (GLADapiproc) glad_debug_impl_glPatchParameterfv },
+    { (GLADapiproc *) &glad_glPatchParameteri, (GLADapiproc *) &glad_debug_glPatchParameteri, (GLADapiproc) glad_debug_impl_glPatchParameteri },
+    { (GLADapiproc *) &glad_glPauseTransformFeedback, (GLADapiproc *) &glad_debug_glPauseTransformFeedback, (GLADapiproc) glad_debug_impl_glPauseTransformFeedback },
+    { (GLADapiproc *) &glad_glPixelStoref, (GLADapiproc *) &glad_debug_glPixelStoref, (GLADapiproc) glad_debug_impl_glPixelStoref },
+    { (GLADapiproc *) &glad_glPixelStorei, (GLADapiproc *) &glad_debug_glPixelStorei, (GLADapiproc) glad_debug_impl_glPixelStorei },
+    { (GLADapiproc *) &glad_glPointParameterf, (GLADapiproc *) &glad_debug_glPointParameterf, (GLADapiproc) glad_debug_impl_glPointParameterf },
+    { (GLADapiproc *) &glad_glPointParameterfv, (GLADapiproc *) &glad_debug_glPointParameterfv, (GLADapiproc) glad_debug_impl_glPointParameterfv },
+    { (GLADapiproc *) &glad_glPointParameteri, (GLADapiproc *) &glad_debug_glPointParameteri, (GLADapiproc) glad_debug_impl_glPointParameteri },
+    { (GLADapiproc *) &glad_glPointParameteriv, (GLADapiproc *) &glad_debug_glPointParameteriv, (GLADapiproc) glad_debug_impl_glPointParameteriv },
+    { (GLADapiproc *) &glad_glPointSize, (GLADapiproc *) &glad_debug_glPointSize, (GLADapiproc) glad_debug_impl_glPointSize },
+    { (GLADapiproc *) &glad_glPolygonMode, (GLADapiproc *) &glad_debug_glPolygonMode, (GLADapiproc) glad_debug_impl_glPolygonMode },
+    { (GLADapiproc *) &glad_glPolygonOffset, (GLADapiproc *) &glad_debug_glPolygonOffset, (GLADapiproc) glad_debug_impl_glPolygonOffset },
+    { (GLADapiproc *) &glad_glPolygonOffsetClamp, (GLADapiproc *) &glad_debug_glPolygonOffsetClamp, (GLADapiproc) glad_debug_impl_glPolygonOffsetClamp },
+    { (GLADapiproc *) &glad_glPopDebugGroup, (GLADapiproc *) &glad_debug_glPopDebugGroup, (GLADapiproc) glad_debug_impl_glPopDebugGroup },
+    { (GLADapiproc *) &glad_glPrimitiveRestartIndex, (GLADapiproc *) &glad_debug_glPrimitiveRestartIndex, (GLADapiproc) glad_debug_impl_glPrimitiveRestartIndex },
+    { (GLADapiproc *) &glad_glProgramBinary, (GLADapiproc *) &glad_debug_glProgramBinary, (GLADapiproc) glad_debug_impl_glProgramBinary },
+    { (GLADapiproc *) &glad_glProgramParameteri, (GLADapiproc *) &glad_debug_glProgramParameteri, (GLADapiproc) glad_debug_impl_glProgramParameteri },
+    { (GLADapiproc *) &glad_glProgramUniform1d, (GLADapiproc *) &glad_debug_glProgramUniform1d, (GLADapiproc) glad_debug_impl_glProgramUniform1d },
+    { (GLADapiproc *) &glad_glProgramUniform1dv, (GLADapiproc *) &glad_debug_glProgramUniform1dv, (GLADapiproc) glad_debug_impl_glProgramUniform1dv },
+    { (GLADapiproc *) &glad_glProgramUniform1f, (GLADapiproc *) &glad_debug_glProgramUniform1f, (GLADapiproc) glad_debug_impl_glProgramUniform1f },
+    { (GLADapiproc *) &glad_glProgramUniform1fv, (GLADapiproc *) &glad_debug_glProgramUniform1fv, (GLADapiproc) glad_debug_impl_glProgramUniform1fv },
+    { (GLADapiproc *) &glad_glProgramUniform1i, (GLADapiproc *) &glad_debug_glProgramUniform1i, (GLADapiproc) glad_debug_impl_glProgramUniform1i },
+    { (GLADapiproc *) &glad_glProgramUniform1iv, (GLADapiproc *) &glad_debug_glProgramUniform1iv, (GLADapiproc) glad_debug_impl_glProgramUniform1iv },
+    { (GLADapiproc *) &glad_glProgramUniform1ui, (GLADapiproc *) &glad_debug_glProgramUniform1ui, (GLADapiproc) glad_debug_impl_glProgramUniform1ui },
+    { (GLADapiproc *) &glad_glProgramUniform1uiv, (GLADapiproc *) &glad_debug_glProgramUniform1uiv, (GLADapiproc) glad_debug_impl_glProgramUniform1uiv },
+    { (GLADapiproc *) &glad_glProgramUniform2d, (GLADapiproc *) &glad_debug_glProgramUniform2d, (GLADapiproc) glad_debug_impl_glProgramUniform2d },
+    { (GLADapiproc *) &glad_glProgramUniform2dv, (GLADapiproc *) &glad_debug_glProgramUniform2dv, (GLADapiproc) glad_debug_impl_glProgramUniform2dv },
+    { (GLADapiproc *) &glad_glProgramUniform2f, (GLADapiproc *) &glad_debug_glProgramUniform2f, (GLADapiproc) glad_debug_impl_glProgramUniform2f },
+    { (GLADapiproc *) &glad_glProgramUniform2fv, (GLADapiproc *) &glad_debug_glProgramUniform2fv, (GLADapiproc) glad_debug_impl_glProgramUniform2fv },
+    { (GLADapiproc *) &glad_glProgramUniform2i, (GLADapiproc *) &glad_debug_glProgramUniform2i, (GLADapiproc) glad_debug_impl_glProgramUniform2i },
+    { (GLADapiproc *) &glad_glProgramUniform2iv, (GLADapiproc *) &glad_debug_glProgramUniform2iv, (GLADapiproc) glad_debug_impl_glProgramUniform2iv },
+    { (GLADapiproc *) &glad_glProgramUniform2ui, (GLADapiproc *) &glad_debug_glProgramUniform2ui, (GLADapiproc) glad_debug_impl_glProgramUniform2ui },
+    { (GLADapiproc *) &glad_glProgramUniform2uiv, (GLADapiproc *) &glad_debug_glProgramUniform2uiv, (GLADapiproc) glad_debug_impl_glProgramUniform2uiv },
+    { (GLADapiproc *) &glad_glProgramUniform3d, (GLADapiproc *) &glad_debug_glProgramUniform3d, (GLADapiproc) glad_debug_impl_glProgramUniform3d },
+    { (GLADapiproc *) &glad_glProgramUniform3dv, (GLADapiproc *) &glad_debug_glProgramUniform3dv, (GLADapiproc) glad_debug_impl_glProgramUniform3dv },
+    { (GLADapiproc *) &glad_glProgramUniform3f, (GLADapiproc *) &glad_debug_glProgramUniform3f, (GLADapiproc) glad_debug_impl_glProgramUniform3f },
+    { (GLADapiproc *) &glad_glProgramUniform3fv, (GLADapiproc *) &glad_debug_glProgramUniform3fv, (GLADapiproc) glad_debug_impl_glProgramUniform3fv },
+    { (GLADapiproc *) &glad_glProgramUniform3i, (GLADapiproc *) &glad_debug_glProgramUniform3i, (GLADapiproc) glad_debug_impl_glProgramUniform3i },
+    { (GLADapiproc *) &glad_glProgramUniform3iv, (GLADapiproc *) &glad_debug_glProgramUniform3iv, (GLADapiproc) glad_debug_impl_glProgramUniform3iv },
+    { (GLADapiproc *) &glad_glProgramUniform3ui, (GLADapiproc *) &glad_debug_glProgramUniform3ui, (GLADapiproc) glad_debug_impl_glProgramUniform3ui },
+    { (GLADapiproc *) &glad_glProgramUniform3uiv, (GLADapiproc *) &glad_debug_glProgramUniform3uiv, (GLADapiproc) glad_debug_impl_glProgramUniform3uiv },
+    { (GLADapiproc *) &glad_glProgramUniform4d, (GLADapiproc *) &glad_debug_glProgramUniform4d, (GLADapiproc) glad_debug_impl_glProgramUniform4d },
+    { (GLADapiproc *) &glad_glProgramUniform4dv, (GLADapiproc *) &glad_debug_glProgramUniform4dv, (GLADapiproc) glad_debug_impl_glProgramUniform4dv },
+    { (GLADapiproc *) &glad_glProgramUniform4f, (GLADapiproc *) &glad_debug_glProgramUniform4f, (GLADapiproc) glad_debug_impl_glProgramUniform4f },
+    { (GLADapiproc *) &glad_glProgramUniform4fv, (GLADapiproc *) &glad_debug_glProgramUniform4fv, (GLADapiproc) glad_debug_impl_glProgramUniform4fv },
+    { (GLADapiproc *) &glad_glProgramUniform4i, (GLADapiproc *) &glad_debug_glProgramUniform4i, (GLADapiproc) glad_debug_impl_glProgramUniform4i },
+    { (GLADapiproc *) &glad_glProgramUniform4iv, (GLADapiproc *) &glad_debug_glProgramUniform4iv, (GLADapiproc) glad_debug_impl_glProgramUniform4iv },
+    { (GLADapiproc *) &glad_glProgramUniform4ui, (GLADapiproc *) &glad_debug_glProgramUniform4ui, (GLADapiproc) glad_debug_impl_glProgramUniform4ui },
+    { (GLADapiproc *) &glad_glProgramUniform4uiv, (GLADapiproc *) &glad_debug_glProgramUniform4uiv, (GLADapiproc) glad_debug_impl_glProgramUniform4uiv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix2dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix2dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix2dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix2fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix2fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix2fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix2x3dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix2x3dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix2x3dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix2x3fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix2x3fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix2x3fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix2x4dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix2x4dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix2x4dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix2x4fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix2x4fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix2x4fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix3dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix3dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix3dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix3fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix3fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix3fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix3x2dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix3x2dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix3x2dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix3x2fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix3x2fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix3x2fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix3x4dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix3x4dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix3x4dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix3x4fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix3x4fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix3x4fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix4dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix4dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix4dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix4fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix4fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix4fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix4x2dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix4x2dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix4x2dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix4x2fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix4x2fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix4x2fv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix4x3dv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix4x3dv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix4x3dv },
+    { (GLADapiproc *) &glad_glProgramUniformMatrix4x3fv, (GLADapiproc *) &glad_debug_glProgramUniformMatrix4x3fv, (GLADapiproc) glad_debug_impl_glProgramUniformMatrix4x3fv },
+    { (GLADapiproc *) &glad_glProvokingVertex, (GLADapiproc *) &glad_debug_glProvokingVertex, (GLADapiproc) glad_debug_impl_glProvokingVertex },
+    { (GLADapiproc *) &glad_glPushDebugGroup, (GLADapiproc *) &glad_debug_glPushDebugGroup, (GLADapiproc) glad_debug_impl_glPushDebugGroup },
+    { (GLADapiproc *) &glad_glQueryCounter, (GLADapiproc *) &glad_debug_glQueryCounter, (GLADapiproc) glad_debug_impl_glQueryCounter },
+    { (GLADapiproc *) &glad_glReadBuffer, (GLADapiproc *) &glad_debug_glReadBuffer, (GLADapiproc) glad_debug_impl_glReadBuffer },
+    { (GLADapiproc *) &glad_glReadPixels, (GLADapiproc *) &glad_debug_glReadPixels, (GLADapiproc) glad_debug_impl_glReadPixels },
+    { (GLADapiproc *) &glad_glReadnPixels, (GLADapiproc *) &glad_debug_glReadnPixels, (GLADapiproc) glad_debug_impl_glReadnPixels },
+    { (GLADapiproc *) &glad_glReleaseShaderCompiler, (GLADapiproc *) &glad_debug_glReleaseShaderCompiler, (GLADapiproc) glad_debug_impl_glReleaseShaderCompiler },
+    { (GLADapiproc *) &glad_glRenderbufferStorage, (GLADapiproc *) &glad_debug_glRenderbufferStorage, (GLADapiproc) glad_debug_impl_glRenderbufferStorage },
+    { (GLADapiproc *) &glad_glRenderbufferStorageMultisample, (GLADapiproc *) &glad_debug_glRenderbufferStorageMultisample, (GLADapiproc) glad_debug_impl_glRenderbufferStorageMultisample },
+    { (GLADapiproc *) &glad_glResumeTransformFeedback, (GLADapiproc *) &glad_debug_glResumeTransformFeedback, (GLADapiproc) glad_debug_impl_glResumeTransformFeedback },
+    { (GLADapiproc *) &glad_glSampleCoverage, (GLADapiproc *) &glad_debug_glSampleCoverage, (GLADapiproc) glad_debug_impl_glSampleCoverage },
+    { (GLADapiproc *) &glad_glSampleMaski, (GLADapiproc *) &glad_debug_glSampleMaski, (GLADapiproc) glad_debug_impl_glSampleMaski },
+    { (GLADapiproc *) &glad_glSamplerParameterIiv, (GLADapiproc *) &glad_debug_glSamplerParameterIiv, (GLADapiproc) glad_debug_impl_glSamplerParameterIiv },
+    { (GLADapiproc *) &glad_glSamplerParameterIuiv, (GLADapiproc *) &glad_debug_glSamplerParameterIuiv, (GLADapiproc) glad_debug_impl_glSamplerParameterIuiv },
+    { (GLADapiproc *) &glad_glSamplerParameterf, (GLADapiproc *) &glad_debug_glSamplerParameterf, (GLADapiproc) glad_debug_impl_glSamplerParameterf },
+    { (GLADapiproc *) &glad_glSamplerParameterfv, (GLADapiproc *) &glad_debug_glSamplerParameterfv, (GLADapiproc) glad_debug_impl_glSamplerParameterfv },
+    { (GLADapiproc *) &glad_glSamplerParameteri, (GLADapiproc *) &glad_debug_glSamplerParameteri, (GLADapiproc) glad_debug_impl_glSamplerParameteri },
+    { (GLADapiproc *) &glad_glSamplerParameteriv, (GLADapiproc *) &glad_debug_glSamplerParameteriv, (GLADapiproc) glad_debug_impl_glSamplerParameteriv },
+    { (GLADapiproc *) &glad_glScissor, (GLADapiproc *) &glad_debug_glScissor, (GLADapiproc) glad_debug_impl_glScissor },
+    { (GLADapiproc *) &glad_glScissorArrayv, (GLADapiproc *) &glad_debug_glScissorArrayv, (GLADapiproc) glad_debug_impl_glScissorArrayv },
+    { (GLADapiproc *) &glad_glScissorIndexed, (GLADapiproc *) &glad_debug_glScissorIndexed, (GLADapiproc) glad_debug_impl_glScissorIndexed },
+    { (GLADapiproc *) &glad_glScissorIndexedv, (GLADapiproc *) &glad_debug_glScissorIndexedv, (GLADapiproc) glad_debug_impl_glScissorIndexedv },
+    { (GLADapiproc *) &glad_glShaderBinary, (GLADapiproc *) &glad_debug_glShaderBinary, (GLADapiproc) glad_debug_impl_glShaderBinary },
+    { (GLADapiproc *) &glad_glShaderSource, (GLADapiproc *) &glad_debug_glShaderSource, (GLADapiproc) glad_debug_impl_glShaderSource },
+    { (GLADapiproc *) &glad_glShaderStorageBlockBinding, (GLADapiproc *) &glad_debug_glShaderStorageBlockBinding, (GLADapiproc) glad_debug_impl_glShaderStorageBlockBinding },
+    { (GLADapiproc *) &glad_glSpecializeShader, (GLADapiproc *) &glad_debug_glSpecializeShader, (GLADapiproc) glad_debug_impl_glSpecializeShader },
+    { (GLADapiproc *) &glad_glStencilFunc, (GLADapiproc *) &glad_debug_glStencilFunc, (GLADapiproc) glad_debug_impl_glStencilFunc },
+    { (GLADapiproc *) &glad_glStencilFuncSeparate, (GLADapiproc *) &glad_debug_glStencilFuncSeparate, (GLADapiproc) glad_debug_impl_glStencilFuncSeparate },
+    { (GLADapiproc *) &glad_glStencilMask, (GLADapiproc *) &glad_debug_glStencilMask, (GLADapiproc) glad_debug_impl_glStencilMask },
+    { (GLADapiproc *) &glad_glStencilMaskSeparate, (GLADapiproc *) &glad_debug_glStencilMaskSeparate, (GLADapiproc) glad_debug_impl_glStencilMaskSeparate },
+    { (GLADapiproc *) &glad_glStencilOp, (GLADapiproc *) &glad_debug_glStencilOp, (GLADapiproc) glad_debug_impl_glStencilOp },
+    { (GLADapiproc *) &glad_glStencilOpSeparate, (GLADapiproc *) &glad_debug_glStencilOpSeparate, (GLADapiproc) glad_debug_impl_glStencilOpSeparate },
+    { (GLADapiproc *) &glad_glTexBuffer, (GLADapiproc *) &glad_debug_glTexBuffer, (GLADapiproc) glad_debug_impl_glTexBuffer },
+    { (GLADapiproc *) &glad_glTexBufferRange, (GLADapiproc *) &glad_debug_glTexBufferRange, (GLADapiproc) glad_debug_impl_glTexBufferRange },
+    { (GLADapiproc *) &glad_glTexImage1D, (GLADapiproc *) &glad_debug_glTexImage1D, (GLADapiproc) glad_debug_impl_glTexImage1D },
+    { (GLADapiproc *) &glad_glTexImage2D, (GLADapiproc *) &glad_debug_glTexImage2D, (GLADapiproc) glad_debug_impl_glTexImage2D },
+    { (GLADapiproc *) &glad_glTexImage2DMultisample, (GLADapiproc *) &glad_debug_glTexImage2DMultisample, (GLADapiproc) glad_debug_impl_glTexImage2DMultisample },
+    { (GLADapiproc *) &glad_glTexImage3D, (GLADapiproc *) &glad_debug_glTexImage3D, (GLADapiproc) glad_debug_impl_glTexImage3D },
+    { (GLADapiproc *) &glad_glTexImage3DMultisample, (GLADapiproc *) &glad_debug_glTexImage3DMultisample, (GLADapiproc) glad_debug_impl_glTexImage3DMultisample },
+    { (GLADapiproc *) &glad_glTexParameterIiv, (GLADapiproc *) &glad_debug_glTexParameterIiv, (GLADapiproc) glad_debug_impl_glTexParameterIiv },
+    { (GLADapiproc *) &glad_glTexParameterIuiv, (GLADapiproc *) &glad_debug_glTexParameterIuiv, (GLADapiproc) glad_debug_impl_glTexParameterIuiv },
+    { (GLADapiproc *) &glad_glTexParameterf, (GLADapiproc *) &glad_debug_glTexParameterf, (GLADapiproc) glad_debug_impl_glTexParameterf },
+    { (GLADapiproc *) &glad_glTexParameterfv, (GLADapiproc *) &glad_debug_glTexParameterfv, (GLADapiproc) glad_debug_impl_glTexParameterfv },
+    { (GLADapiproc *) &glad_glTexParameteri, (GLADapiproc *) &glad_debug_glTexParameteri, (GLADapiproc) glad_debug_impl_glTexParameteri },
+    { (GLADapiproc *) &glad_glTexParameteriv, (GLADapiproc *) &glad_debug_glTexParameteriv, (GLADapiproc) glad_debug_impl_glTexParameteriv },
+    { (GLADapiproc *) &glad_glTexStorage1D, (GLADapiproc *) &glad_debug_glTexStorage1D, (GLADapiproc) glad_debug_impl_glTexStorage1D },
+    { (GLADapiproc *) &glad_glTexStorage2D, (GLADapiproc *) &glad_debug_glTexStorage2D, (GLADapiproc) glad_debug_impl_glTexStorage2D },
+    { (GLADapiproc *) &glad_glTexStorage2DMultisample, (GLADapiproc *) &glad_debug_glTexStorage2DMultisample, (GLADapiproc) glad_debug_impl_glTexStorage2DMultisample },
+    { (GLADapiproc *) &glad_glTexStorage3D, (GLADapiproc *) &glad_debug_glTexStorage3D, (GLADapiproc) glad_debug_impl_glTexStorage3D },
+    { (GLADapiproc *) &glad_glTexStorage3DMultisample, (GLADapiproc *) &glad_debug_glTexStorage3DMultisample, (GLADapiproc) glad_debug_impl_glTexStorage3DMultisample },
+    { (GLADapiproc *) &glad_glTexSubImage1D, (GLADapiproc *) &glad_debug_glTexSubImage1D, (GLADapiproc) glad_debug_impl_glTexSubImage1D },
+    { (GLADapiproc *) &glad_glTexSubImage2D, (GLADapiproc *) &glad_debug_glTexSubImage2D, (GLADapiproc) glad_debug_impl_glTexSubImage2D },
+    { (GLADapiproc *) &glad_glTexSubImage3D, (GLADapiproc *) &glad_debug_glTexSubImage3D, (GLADapiproc) glad_debug_impl_glTexSubImage3D },
+    { (GLADapiproc *) &glad_glTextureBarrier, (GLADapiproc *) &glad_debug_glTextureBarrier, (GLADapiproc) glad_debug_impl_glTextureBarrier },
+    { (GLADapiproc *) &glad_glTextureBuffer, (GLADapiproc *) &glad_debug_glTextureBuffer, (GLADapiproc) glad_debug_impl_glTextureBuffer },
+    { (GLADapiproc *) &glad_glTextureBufferRange, (GLADapiproc *) &glad_debug_glTextureBufferRange, (GLADapiproc) glad_debug_impl_glTextureBufferRange },
+    { (GLADapiproc *) &glad_glTextureParameterIiv, (GLADapiproc *) &glad_debug_glTextureParameterIiv, (GLADapiproc) glad_debug_impl_glTextureParameterIiv },
+    { (GLADapiproc *) &glad_glTextureParameterIuiv, (GLADapiproc *) &glad_debug_glTextureParameterIuiv, (GLADapiproc) glad_debug_impl_glTextureParameterIuiv },
+    { (GLADapiproc *) &glad_glTextureParameterf, (GLADapiproc *) &glad_debug_glTextureParameterf, (GLADapiproc) glad_debug_impl_glTextureParameterf },
+    { (GLADapiproc *) &glad_glTextureParameterfv, (GLADapiproc *) &glad_debug_glTextureParameterfv, (GLADapiproc) glad_debug_impl_glTextureParameterfv },
+    { (GLADapiproc *) &glad_glTextureParameteri, (GLADapiproc *) &glad_debug_glTextureParameteri, (GLADapiproc) glad_debug_impl_glTextureParameteri },
+    { (GLADapiproc *) &glad_glTextureParameteriv, (GLADapiproc *) &glad_debug_glTextureParameteriv, (GLADapiproc) glad_debug_impl_glTextureParameteriv },
+    { (GLADapiproc *) &glad_glTextureStorage1D, (GLADapiproc *) &glad_debug_glTextureStorage1D, (GLADapiproc) glad_debug_impl_glTextureStorage1D },
+    { (GLADapiproc *) &glad_glTextureStorage2D, (GLADapiproc *) &glad_debug_glTextureStorage2D, (GLADapiproc) glad_debug_impl_glTextureStorage2D },
+    { (GLADapiproc *) &glad_glTextureStorage2DMultisample, (GLADapiproc *) &glad_debug_glTextureStorage2DMultisample, (GLADapiproc) glad_debug_impl_glTextureStorage2DMultisample },
+    { (GLADapiproc *) &glad_glTextureStorage3D, (GLADapiproc *) &glad_debug_glTextureStorage3D, (GLADapiproc) glad_debug_impl_glTextureStorage3D },
+    { (GLADapiproc *) &glad_glTextureStorage3DMultisample, (GLADapiproc *) &glad_debug_glTextureStorage3DMultisample, (GLADapiproc) glad_debug_impl_glTextureStorage3DMultisample },
+    { (GLADapiproc *) &glad_glTextureSubImage1D, (GLADapiproc *) &glad_debug_glTextureSubImage1D, (GLADapiproc) glad_debug_impl_glTextureSubImage1D },
+    { (GLADapiproc *) &glad_glTextureSubImage2D, (GLADapiproc *) &glad_debug_glTextureSubImage2D, (GLADapiproc) glad_debug_impl_glTextureSubImage2D },
+    { (GLADapiproc *) &glad_glTextureSubImage3D, (GLADapiproc *) &glad_debug_glTextureSubImage3D, (GLADapiproc) glad_debug_impl_glTextureSubImage3D },
+    { (GLADapiproc *) &glad_glTextureView, (GLADapiproc *) &glad_debug_glTextureView, (GLADapiproc) glad_debug_impl_glTextureView },
+    { (GLADapiproc *) &glad_glTransformFeedbackBufferBase, (GLADapiproc *) &glad_debug_glTransformFeedbackBufferBase, (GLADapiproc) glad_debug_impl_glTransformFeedbackBufferBase },
+    { (GLADapiproc *) &glad_glTransformFeedbackBufferRange, (GLADapiproc *) &glad_debug_glTransformFeedbackBufferRange, (GLADapiproc) glad_debug_impl_glTransformFeedbackBufferRange },
+    { (GLADapiproc *) &glad_glTransformFeedbackVaryings, (GLADapiproc *) &glad_debug_glTransformFeedbackVaryings, (GLADapiproc) glad_debug_impl_glTransformFeedbackVaryings },
+    { (GLADapiproc *) &glad_glUniform1d, (GLADapiproc *) &glad_debug_glUniform1d, (GLADapiproc) glad_debug_impl_glUniform1d },
+    { (GLADapiproc *) &glad_glUniform1dv, (GLADapiproc *) &glad_debug_glUniform1dv, (GLADapiproc) glad_debug_impl_glUniform1dv },
+    { (GLADapiproc *) &glad_glUniform1f, (GLADapiproc *) &glad_debug_glUniform1f, (GLADapiproc) glad_debug_impl_glUniform1f },
+    { (GLADapiproc *) &glad_glUniform1fv, (GLADapiproc *) &glad_debug_glUniform1fv, (GLADapiproc) glad_debug_impl_glUniform1fv },
+    { (GLADapiproc *) &glad_glUniform1i, (GLADapiproc *) &glad_debug_glUniform1i, (GLADapiproc) glad_debug_impl_glUniform1i },
+    { (GLADapiproc *) &glad_glUniform1iv, (GLADapiproc *) &glad_debug_glUniform1iv, (GLADapiproc) glad_debug_impl_glUniform1iv },
+    { (GLADapiproc *) &glad_glUniform1ui, (GLADapiproc *) &glad_debug_glUniform1ui, (GLADapiproc) glad_debug_impl_glUniform1ui },
+    { (GLADapiproc *) &glad_glUniform1uiv, (GLADapiproc *) &glad_debug_glUniform1uiv, (GLADapiproc) glad_debug_impl_glUniform1uiv },
+    { (GLADapiproc *) &glad_glUniform2d, (GLADapiproc *) &glad_debug_glUniform2d, (GLADapiproc) glad_debug_impl_glUniform2d },
+    { (GLADapiproc *) &glad_glUniform2dv, (GLADapiproc *) &glad_debug_glUniform2dv, (GLADapiproc) glad_debug_impl_glUniform2dv },
+    { (GLADapiproc *) &glad_glUniform2f, (GLADapiproc *) &glad_debug_glUniform2f, (GLADapiproc) glad_debug_impl_glUniform2f },
+    { (GLADapiproc *) &glad_glUniform2fv, (GLADapiproc *) &glad_debug_glUniform2fv, (GLADapiproc) glad_debug_impl_glUniform2fv },
+    { (GLADapiproc *) &glad_glUniform2i, (GLADapiproc *) &glad_debug_glUniform2i, (GLADapiproc) glad_debug_impl_glUniform2i },
+    { (GLADapiproc *) &glad_glUniform2iv, (GLADapiproc *) &glad_debug_glUniform2iv, (GLADapiproc) glad_debug_impl_glUniform2iv },
+    { (GLADapiproc *) &glad_glUniform2ui, (GLADapiproc *) &glad_debug_glUniform2ui, (GLADapiproc) glad_debug_impl_glUniform2ui },
+    { (GLADapiproc *) &glad_glUniform2uiv, (GLADapiproc *) &glad_debug_glUniform2uiv, (GLADapiproc) glad_debug_impl_glUniform2uiv },
+    { (GLADapiproc *) &glad_glUniform3d, (GLADapiproc *) &glad_debug_glUniform3d, (GLADapiproc) glad_debug_impl_glUniform3d },
+    { (GLADapiproc *) &glad_glUniform3dv, (GLADapiproc *) &glad_debug_glUniform3dv, (GLADapiproc) glad_debug_impl_glUniform3dv },
+    { (GLADapiproc *) &glad_glUniform3f, (GLADapiproc *) &glad_debug_glUniform3f, (GLADapiproc) glad_debug_impl_glUniform3f },
+    { (GLADapiproc *) &glad_glUniform3fv, (GLADapiproc *) &glad_debug_glUniform3fv, (GLADapiproc) glad_debug_impl_glUniform3fv },
+    { (GLADapiproc *) &glad_glUniform3i, (GLADapiproc *) &glad_debug_glUniform3i, (GLADapiproc) glad_debug_impl_glUniform3i },
+    { (GLADapiproc *) &glad_glUniform3iv, (GLADapiproc *) &glad_debug_glUniform3iv, (GLADapiproc) glad_debug_impl_glUniform3iv },
+    { (GLADapiproc *) &glad_glUniform3ui, (GLADapiproc *) &glad_debug_glUniform3ui, (GLADapiproc) glad_debug_impl_glUniform3ui },
+    { (GLADapiproc *) &glad_glUniform3uiv, (GLADapiproc *) &glad_debug_glUniform3uiv, (GLADapiproc) glad_debug_impl_glUniform3uiv },
+    { (GLADapiproc *) &glad_glUniform4d, (GLADapiproc *) &glad_debug_glUniform4d, (GLADapiproc) glad_debug_impl_glUniform4d },
+    { (GLADapiproc *) &glad_glUniform4dv, (GLADapiproc *) &glad_debug_glUniform4dv, (GLADapiproc) glad_debug_impl_glUniform4dv },
+    { (GLADapiproc *) &glad_glUniform4f, (GLADapiproc *) &glad_debug_glUniform4f, (GLADapiproc) glad_debug_impl_glUniform4f },
+    { (GLADapiproc *) &glad_glUniform4fv, (GLADapiproc *) &glad_debug_glUniform4fv, (GLADapiproc) glad_debug_impl_glUniform4fv },
+    { (GLADapiproc *) &glad_glUniform4i, (GLADapiproc *) &glad_debug_glUniform4i, (GLADapiproc) glad_debug_impl_glUniform4i },
+    { (GLADapiproc *) &glad_glUniform4iv, (GLADapiproc *) &glad_debug_glUniform4iv, (GLADapiproc) glad_debug_impl_glUniform4iv },
+    { (GLADapiproc *) &glad_glUniform4ui, (GLADapiproc *) &glad_debug_glUniform4ui, (GLADapiproc) glad_debug_impl_glUniform4ui },
+    { (GLADapiproc *) &glad_glUniform4uiv, (GLADapiproc *) &glad_debug_glUniform4uiv, (GLADapiproc) glad_debug_impl_glUniform4uiv },
+    { (GLADapiproc *) &glad_glUniformBlockBinding, (GLADapiproc *) &glad_debug_glUniformBlockBinding, (GLADapiproc) glad_debug_impl_glUniformBlockBinding },
+    { (GLADapiproc *) &glad_glUniformMatrix2dv, (GLADapiproc *) &glad_debug_glUniformMatrix2dv, (GLADapiproc) glad_debug_impl_glUniformMatrix2dv },
+    { (GLADapiproc *) &glad_glUniformMatrix2fv, (GLADapiproc *) &glad_debug_glUniformMatrix2fv, (GLADapiproc) glad_debug_impl_glUniformMatrix2fv },
+    { (GLADapiproc *) &glad_glUniformMatrix2x3dv, (GLADapiproc *) &glad_debug_glUniformMatrix2x3dv, (GLADapiproc) glad_debug_impl_glUniformMatrix2x3dv },
+    { (GLADapiproc *) &glad_glUniformMatrix2x3fv, (GLADapiproc *) &glad_debug_glUniformMatrix2x3fv, (GLADapiproc) glad_debug_impl_glUniformMatrix2x3fv },
+    { (GLADapiproc *) &glad_glUniformMatrix2x4dv, (GLADapiproc *) &glad_debug_glUniformMatrix2x4dv, (GLADapiproc) glad_debug_impl_glUniformMatrix2x4dv },
+    { (GLADapiproc *) &glad_glUniformMatrix2x4fv, (GLADapiproc *) &glad_debug_glUniformMatrix2x4fv, (GLADapiproc) glad_debug_impl_glUniformMatrix2x4fv },
+    { (GLADapiproc *) &glad_glUniformMatrix3dv, (GLADapiproc *) &glad_debug_glUniformMatrix3dv, (GLADapiproc) glad_debug_impl_glUniformMatrix3dv },
+    { (GLADapiproc *) &glad_glUniformMatrix3fv, (GLADapiproc *) &glad_debug_glUniformMatrix3fv, (GLADapiproc) glad_debug_impl_glUniformMatrix3fv },
+    { (GLADapiproc *) &glad_glUniformMatrix3x2dv, (GLADapiproc *) &glad_debug_glUniformMatrix3x2dv, (GLADapiproc) glad_debug_impl_glUniformMatrix3x2dv },
+    { (GLADapiproc *) &glad_glUniformMatrix3x2fv, (GLADapiproc *) &glad_debug_glUniformMatrix3x2fv, (GLADapiproc) glad_debug_impl_glUniformMatrix3x2fv },
+    { (GLADapiproc *) &glad_glUniformMatrix3x4dv, (GLADapiproc *) &glad_debug_glUniformMatrix3x4dv, (GLADapiproc) glad_debug_impl_glUniformMatrix3x4dv },
+    { (GLADapiproc *) &glad_glUniformMatrix3x4fv, (GLADapiproc *) &glad_debug_glUniformMatrix3x4fv, (GLADapiproc) glad_debug_impl_glUniformMatrix3x4fv },
+    { (GLADapiproc *) &glad_glUniformMatrix4dv, (GLADapiproc *) &glad_debug_glUniformMatrix4dv, (GLADapiproc) glad_debug_impl_glUniformMatrix4dv },
+    { (GLADapiproc *) &glad_glUniformMatrix4fv, (GLADapiproc *) &glad_debug_glUniformMatrix4fv, (GLADapiproc) glad_debug_impl_glUniformMatrix4fv },
+    { (GLADapiproc *) &glad_glUniformMatrix4x2dv, (GLADapiproc *) &glad_debug_glUniformMatrix4x2dv, (GLADapiproc) glad_debug_impl_glUniformMatrix4x2dv },
+    { (GLADapiproc *) &glad_glUniformMatrix4x2fv, (GLADapiproc *) &glad_debug_glUniformMatrix4x2fv, (GLADapiproc) glad_debug_impl_glUniformMatrix4x2fv },
+    { (GLADapiproc *) &glad_glUniformMatrix4x3dv, (GLADapiproc *) &glad_debug_glUniformMatrix4x3dv, (GLADapiproc) glad_debug_impl_glUniformMatrix4x3dv },
+    { (GLADapiproc *) &glad_glUniformMatrix4x3fv, (GLADapiproc *) &glad_debug_glUniformMatrix4x3fv, (GLADapiproc) glad_debug_impl_glUniformMatrix4x3fv },
+    { (GLADapiproc *) &glad_glUniformSubroutinesuiv, (GLADapiproc *) &glad_debug_glUniformSubroutinesuiv, (GLADapiproc) glad_debug_impl_glUniformSubroutinesuiv },
+    { (GLADapiproc *) &glad_glUnmapBuffer, (GLADapiproc *) &glad_debug_glUnmapBuffer, (GLADapiproc) glad_debug_impl_glUnmapBuffer },
+    { (GLADapiproc *) &glad_glUnmapNamedBuffer, (GLADapiproc *) &glad_debug_glUnmapNamedBuffer, (GLADapiproc) glad_debug_impl_glUnmapNamedBuffer },
+    { (GLADapiproc *) &glad_glUseProgram, (GLADapiproc *) &glad_debug_glUseProgram, (GLADapiproc) glad_debug_impl_glUseProgram },
+    { (GLADapiproc *) &glad_glUseProgramStages, (GLADapiproc *) &glad_debug_glUseProgramStages, (GLADapiproc) glad_debug_impl_glUseProgramStages },
+    { (GLADapiproc *) &glad_glValidateProgram, (GLADapiproc *) &glad_debug_glValidateProgram, (GLADapiproc) glad_debug_impl_glValidateProgram },
+    { (GLADapiproc *) &glad_glValidateProgramPipeline, (GLADapiproc *) &glad_debug_glValidateProgramPipeline, (GLADapiproc) glad_debug_impl_glValidateProgramPipeline },
+    { (GLADapiproc *) &glad_glVertexArrayAttribBinding, (GLADapiproc *) &glad_debug_glVertexArrayAttribBinding, (GLADapiproc) glad_debug_impl_glVertexArrayAttribBinding },
+    { (GLADapiproc *) &glad_glVertexArrayAttribFormat, (GLADapiproc *) &glad_debug_glVertexArrayAttribFormat, (GLADapiproc) glad_debug_impl_glVertexArrayAttribFormat },
+    { (GLADapiproc *) &glad_glVertexArrayAttribIFormat, (GLADapiproc *) &glad_debug_glVertexArrayAttribIFormat, (GLADapiproc) glad_debug_impl_glVertexArrayAttribIFormat },
+    { (GLADapiproc *) &glad_glVertexArrayAttribLFormat, (GLADapiproc *) &glad_debug_glVertexArrayAttribLFormat, (GLADapiproc) glad_debug_impl_glVertexArrayAttribLFormat },
+    { (GLADapiproc *) &glad_glVertexArrayBindingDivisor, (GLADapiproc *) &glad_debug_glVertexArrayBindingDivisor, (GLADapiproc) glad_debug_impl_glVertexArrayBindingDivisor },
+    { (GLADapiproc *) &glad_glVertexArrayElementBuffer, (GLADapiproc *) &glad_debug_glVertexArrayElementBuffer, (GLADapiproc) glad_debug_impl_glVertexArrayElementBuffer },
+    { (GLADapiproc *) &glad_glVertexArrayVertexBuffer, (GLADapiproc *) &glad_debug_glVertexArrayVertexBuffer, (GLADapiproc) glad_debug_impl_glVertexArrayVertexBuffer },
+    { (GLADapiproc *) &glad_glVertexArrayVertexBuffers, (GLADapiproc *) &glad_debug_glVertexArrayVertexBuffers, (GLADapiproc) glad_debug_impl_glVertexArrayVertexBuffers },
+    { (GLADapiproc *) &glad_glVertexAttrib1d, (GLADapiproc *) &glad_debug_glVertexAttrib1d, (GLADapiproc) glad_debug_impl_glVertexAttrib1d },
+    { (GLADapiproc *) &glad_glVertexAttrib1dv, (GLADapiproc *) &glad_debug_glVertexAttrib1dv, (GLADapiproc) glad_debug_impl_glVertexAttrib1dv },
+    { (GLADapiproc *) &glad_glVertexAttrib1f, (GLADapiproc *) &glad_debug_glVertexAttrib1f, (GLADapiproc) glad_debug_impl_glVertexAttrib1f },
+    { (GLADapiproc *) &glad_glVertexAttrib1fv, (GLADapiproc *) &glad_debug_glVertexAttrib1fv, (GLADapiproc) glad_debug_impl_glVertexAttrib1fv },
+    { (GLADapiproc *) &glad_glVertexAttrib1s, (GLADapiproc *) &glad_debug_glVertexAttrib1s, (GLADapiproc) glad_debug_impl_glVertexAttrib1s },
+    { (GLADapiproc *) &glad_glVertexAttrib1sv, (GLADapiproc *) &glad_debug_glVertexAttrib1sv, (GLADapiproc) glad_debug_impl_glVertexAttrib1sv },
+    { (GLADapiproc *) &glad_glVertexAttrib2d, (GLADapiproc *) &glad_debug_glVertexAttrib2d, (GLADapiproc) glad_debug_impl_glVertexAttrib2d },
+    { (GLADapiproc *) &glad_glVertexAttrib2dv, (GLADapiproc *) &glad_debug_glVertexAttrib2dv, (GLADapiproc) glad_debug_impl_glVertexAttrib2dv },
+    { (GLADapiproc *) &glad_glVertexAttrib2f, (GLADapiproc *) &glad_debug_glVertexAttrib2f, (GLADapiproc) glad_debug_impl_glVertexAttrib2f },
+    { (GLADapiproc *) &glad_glVertexAttrib2fv, (GLADapiproc *) &glad_debug_glVertexAttrib2fv, (GLADapiproc) glad_debug_impl_glVertexAttrib2fv },
+    { (GLADapiproc *) &glad_glVertexAttrib2s, (GLADapiproc *) &glad_debug_glVertexAttrib2s, (GLADapiproc) glad_debug_impl_glVertexAttrib2s },
+    { (GLADapiproc *) &glad_glVertexAttrib2sv, (GLADapiproc *) &glad_debug_glVertexAttrib2sv, (GLADapiproc) glad_debug_impl_glVertexAttrib2sv },
+    { (GLADapiproc *) &glad_glVertexAttrib3d, (GLADapiproc *) &glad_debug_glVertexAttrib3d, (GLADapiproc) glad_debug_impl_glVertexAttrib3d },
+    { (GLADapiproc *) &glad_glVertexAttrib3dv, (GLADapiproc *) &glad_debug_glVertexAttrib3dv, (GLADapiproc) glad_debug_impl_glVertexAttrib3dv },
+    { (GLADapiproc *) &glad_glVertexAttrib3f, (GLADapiproc *) &glad_debug_glVertexAttrib3f, (GLADapiproc) glad_debug_impl_glVertexAttrib3f },
+    { (GLADapiproc *) &glad_glVertexAttrib3fv, (GLADapiproc *) &glad_debug_glVertexAttrib3fv, (GLADapiproc) glad_debug_impl_glVertexAttrib3fv },
+    { (GLADapiproc *) &glad_glVertexAttrib3s, (GLADapiproc *) &glad_debug_glVertexAttrib3s, (GLADapiproc) glad_debug_impl_glVertexAttrib3s },
+    { (GLADapiproc *) &glad_glVertexAttrib3sv, (GLADapiproc *) &glad_debug_glVertexAttrib3sv, (GLADapiproc) glad_debug_impl_glVertexAttrib3sv },
+    { (GLADapiproc *) &glad_glVertexAttrib4Nbv, (GLADapiproc *) &glad_debug_glVertexAttrib4Nbv, (GLADapiproc) glad_debug_impl_glVertexAttrib4Nbv },
+    { (GLADapiproc *) &glad_glVertexAttrib4Niv, (GLADapiproc *) &glad_debug_glVertexAttrib4Niv, (GLADapiproc) glad_debug_impl_glVertexAttrib4Niv },
+    { (GLADapiproc *) &glad_glVertexAttrib4Nsv, (GLADapiproc *) &glad_debug_glVertexAttrib4Nsv, (GLADapiproc) glad_debug_impl_glVertexAttrib4Nsv },
+    { (GLADapiproc *) &glad_glVertexAttrib4Nub, (GLADapiproc *) &glad_debug_glVertexAttrib4Nub, (GLADapiproc) glad_debug_impl_glVertexAttrib4Nub },
+    { (GLADapiproc *) &glad_glVertexAttrib4Nubv, (GLADapiproc *) &glad_debug_glVertexAttrib4Nubv, (GLADapiproc) glad_debug_impl_glVertexAttrib4Nubv },
+    { (GLADapiproc *) &glad_glVertexAttrib4Nuiv, (GLADapiproc *) &glad_debug_glVertexAttrib4Nuiv, (GLADapiproc) glad_debug_impl_glVertexAttrib4Nuiv },
+    { (GLADapiproc *) &glad_glVertexAttrib4Nusv, (GLADapiproc *) &glad_debug_glVertexAttrib4Nusv, (GLADapiproc) glad_debug_impl_glVertexAttrib4Nusv },
+    { (GLADapiproc *) &glad_glVertexAttrib4bv, (GLADapiproc *) &glad_debug_glVertexAttrib4bv, (GLADapiproc) glad_debug_impl_glVertexAttrib4bv },
+    { (GLADapiproc *) &glad_glVertexAttrib4d, (GLADapiproc *) &glad_debug_glVertexAttrib4d, (GLADapiproc) glad_debug_impl_glVertexAttrib4d },
+    { (GLADapiproc *) &glad_glVertexAttrib4dv, (GLADapiproc *) &glad_debug_glVertexAttrib4dv, (GLADapiproc) glad_debug_impl_glVertexAttrib4dv },
+    { (GLADapiproc *) &glad_glVertexAttrib4f, (GLADapiproc *) &glad_debug_glVertexAttrib4f, (GLADapiproc) glad_debug_impl_glVertexAttrib4f },
+    { (GLADapiproc *) &glad_glVertexAttrib4fv, (GLADapiproc *) &glad_debug_glVertexAttrib4fv, (GLADapiproc) glad_debug_impl_glVertexAttrib4fv },
+    { (GLADapiproc *) &glad_glVertexAttrib4iv, (GLADapiproc *) &glad_debug_glVertexAttrib4iv, (GLADapiproc) glad_debug_impl_glVertexAttrib4iv },
+    { (GLADapiproc *) &glad_glVertexAttrib4s, (GLADapiproc *) &glad_debug_glVertexAttrib4s, (GLADapiproc) glad_debug_impl_glVertexAttrib4s },
+    { (GLADapiproc *) &glad_glVertexAttrib4sv, (GLADapiproc *) &glad_debug_glVertexAttrib4sv, (GLADapiproc) glad_debug_impl_glVertexAttrib4sv },
+    { (GLADapiproc *) &glad_glVertexAttrib4ubv, (GLADapiproc *) &glad_debug_glVertexAttrib4ubv, (GLADapiproc) glad_debug_impl_glVertexAttrib4ubv },
+    { (GLADapiproc *) &glad_glVertexAttrib4uiv, (GLADapiproc *) &glad_debug_glVertexAttrib4uiv, (GLADapiproc) glad_debug_impl_glVertexAttrib4uiv },
+    { (GLADapiproc *) &glad_glVertexAttrib4usv, (GLADapiproc *) &glad_debug_glVertexAttrib4usv, (GLADapiproc) glad_debug_impl_glVertexAttrib4usv },
+    { (GLADapiproc *) &glad_glVertexAttribBinding, (GLADapiproc *) &glad_debug_glVertexAttribBinding, (GLADapiproc) glad_debug_impl_glVertexAttribBinding },
+    { (GLADapiproc *) &glad_glVertexAttribDivisor, (GLADapiproc *) &glad_debug_glVertexAttribDivisor, (GLADapiproc) glad_debug_impl_glVertexAttribDivisor },
+    { (GLADapiproc *) &glad_glVertexAttribFormat, (GLADapiproc *) &glad_debug_glVertexAttribFormat, (GLADapiproc) glad_debug_impl_glVertexAttribFormat },
+    { (GLADapiproc *) &glad_glVertexAttribI1i, (GLADapiproc *) &glad_debug_glVertexAttribI1i, (GLADapiproc) glad_debug_impl_glVertexAttribI1i },
+    { (GLADapiproc *) &glad_glVertexAttribI1iv, (GLADapiproc *) &glad_debug_glVertexAttribI1iv, (GLADapiproc) glad_debug_impl_glVertexAttribI1iv },
+    { (GLADapiproc *) &glad_glVertexAttribI1ui, (GLADapiproc *) &glad_debug_glVertexAttribI1ui, (GLADapiproc) glad_debug_impl_glVertexAttribI1ui },
+    { (GLADapiproc *) &glad_glVertexAttribI1uiv, (GLADapiproc *) &glad_debug_glVertexAttribI1uiv, (GLADapiproc) glad_debug_impl_glVertexAttribI1uiv },
+    { (GLADapiproc *) &glad_glVertexAttribI2i, (GLADapiproc *) &glad_debug_glVertexAttribI2i, (GLADapiproc) glad_debug_impl_glVertexAttribI2i },
+    { (GLADapiproc *) &glad_glVertexAttribI2iv, (GLADapiproc *) &glad_debug_glVertexAttribI2iv, (GLADapiproc) glad_debug_impl_glVertexAttribI2iv },
+    { (GLADapiproc *) &glad_glVertexAttribI2ui, (GLADapiproc *) &glad_debug_glVertexAttribI2ui, (GLADapiproc) glad_debug_impl_glVertexAttribI2ui },
+    { (GLADapiproc *) &glad_glVertexAttribI2uiv, (GLADapiproc *) &glad_debug_glVertexAttribI2uiv, (GLADapiproc) glad_debug_impl_glVertexAttribI2uiv },
+    { (GLADapiproc *) &glad_glVertexAttribI3i, (GLADapiproc *) &glad_debug_glVertexAttribI3i, (GLADapiproc) glad_debug_impl_glVertexAttribI3i },
+    { (GLADapiproc *) &glad_glVertexAttribI3iv, (GLADapiproc *) &glad_debug_glVertexAttribI3iv, (GLADapiproc) glad_debug_impl_glVertexAttribI3iv },
+    { (GLADapiproc *) &glad_glVertexAttribI3ui, (GLADapiproc *) &glad_debug_glVertexAttribI3ui, (GLADapiproc) glad_debug_impl_glVertexAttribI3ui },
+    { (GLADapiproc *) &glad_glVertexAttribI3uiv, (GLADapiproc *) &glad_debug_glVertexAttribI3uiv, (GLADapiproc) glad_debug_impl_glVertexAttribI3uiv },
+    { (GLADapiproc *) &glad_glVertexAttribI4bv, (GLADapiproc *) &glad_debug_glVertexAttribI4bv, (GLADapiproc) glad_debug_impl_glVertexAttribI4bv },
+    { (GLADapiproc *) &glad_glVertexAttribI4i, (GLADapiproc *) &glad_debug_glVertexAttribI4i, (GLADapiproc) glad_debug_impl_glVertexAttribI4i },
+    { (GLADapiproc *) &glad_glVertexAttribI4iv, (GLADapiproc *) &glad_debug_glVertexAttribI4iv, (GLADapiproc) glad_debug_impl_glVertexAttribI4iv },
+    { (GLADapiproc *) &glad_glVertexAttribI4sv, (GLADapiproc *) &glad_debug_glVertexAttribI4sv, (GLADapiproc) glad_debug_impl_glVertexAttribI4sv },
+    { (GLADapiproc *) &glad_glVertexAttribI4ubv, (GLADapiproc *) &glad_debug_glVertexAttribI4ubv, (GLADapiproc) glad_debug_impl_glVertexAttribI4ubv },
+    { (GLADapiproc *) &glad_glVertexAttribI4ui, (GLADapiproc *) &glad_debug_glVertexAttribI4ui, (GLADapiproc) glad_debug_impl_glVertexAttribI4ui },
+    { (GLADapiproc *) &glad_glVertexAttribI4uiv, (GLADapiproc *) &glad_debug_glVertexAttribI4uiv, (GLADapiproc) glad_debug_impl_glVertexAttribI4uiv },
+    { (GLADapiproc *) &glad_glVertexAttribI4usv, (GLADapiproc *) &glad_debug_glVertexAttribI4usv, (GLADapiproc) glad_debug_impl_glVertexAttribI4usv },
+    { (GLADapiproc *) &glad_glVertexAttribIFormat, (GLADapiproc *) &glad_debug_glVertexAttribIFormat, (GLADapiproc) glad_debug_impl_glVertexAttribIFormat },
+    { (GLADapiproc *) &glad_glVertexAttribIPointer, (GLADapiproc *) &glad_debug_glVertexAttribIPointer, (GLADapiproc) glad_debug_impl_glVertexAttribIPointer },
+    { (GLADapiproc *) &glad_glVertexAttribL1d, (GLADapiproc *) &glad_debug_glVertexAttribL1d, (GLADapiproc) glad_debug_impl_glVertexAttribL1d },
+    { (GLADapiproc *) &glad_glVertexAttribL1dv, (GLADapiproc *) &glad_debug_glVertexAttribL1dv, (GLADapiproc) glad_debug_impl_glVertexAttribL1dv },
+    { (GLADapiproc *) &glad_glVertexAttribL2d, (GLADapiproc *) &glad_debug_glVertexAttribL2d, (GLADapiproc) glad_debug_impl_glVertexAttribL2d },
+    { (GLADapiproc *) &glad_glVertexAttribL2dv, (GLADapiproc *) &glad_debug_glVertexAttribL2dv, (GLADapiproc) glad_debug_impl_glVertexAttribL2dv },
+    { (GLADapiproc *) &glad_glVertexAttribL3d, (GLADapiproc *) &glad_debug_glVertexAttribL3d, (GLADapiproc) glad_debug_impl_glVertexAttribL3d },
+    { (GLADapiproc *) &glad_glVertexAttribL3dv, (GLADapiproc *) &glad_debug_glVertexAttribL3dv, (GLADapiproc) glad_debug_impl_glVertexAttribL3dv },
+    { (GLADapiproc *) &glad_glVertexAttribL4d, (GLADapiproc *) &glad_debug_glVertexAttribL4d, (GLADapiproc) glad_debug_impl_glVertexAttribL4d },
+    { (GLADapiproc *) &glad_glVertexAttribL4dv, (GLADapiproc *) &glad_debug_glVertexAttribL4dv, (GLADapiproc) glad_debug_impl_glVertexAttribL4dv },
+    { (GLADapiproc *) &glad_glVertexAttribLFormat, (GLADapiproc *) &glad_debug_glVertexAttribLFormat, (GLADapiproc) glad_debug_impl_glVertexAttribLFormat },
+    { (GLADapiproc *) &glad_glVertexAttribLPointer, (GLADapiproc *) &glad_debug_glVertexAttribLPointer, (GLADapiproc) glad_debug_impl_glVertexAttribLPointer },
+    { (GLADapiproc *) &glad_glVertexAttribP1ui, (GLADapiproc *) &glad_debug_glVertexAttribP1ui, (GLADapiproc) glad_debug_impl_glVertexAttribP1ui },
+    { (GLADapiproc *) &glad_glVertexAttribP1uiv, (GLADapiproc *) &glad_debug_glVertexAttribP1uiv, (GLADapiproc) glad_debug_impl_glVertexAttribP1uiv },
+    { (GLADapiproc *) &glad_glVertexAttribP2ui, (GLADapiproc *) &glad_debug_glVertexAttribP2ui, (GLADapiproc) glad_debug_impl_glVertexAttribP2ui },
+    { (GLADapiproc *) &glad_glVertexAttribP2uiv, (GLADapiproc *) &glad_debug_glVertexAttribP2uiv, (GLADapiproc) glad_debug_impl_glVertexAttribP2uiv },
+    { (GLADapiproc *) &glad_glVertexAttribP3ui, (GLADapiproc *) &glad_debug_glVertexAttribP3ui, (GLADapiproc) glad_debug_impl_glVertexAttribP3ui },
+    { (GLADapiproc *) &glad_glVertexAttribP3uiv, (GLADapiproc *) &glad_debug_glVertexAttribP3uiv, (GLADapiproc) glad_debug_impl_glVertexAttribP3uiv },
+    { (GLADapiproc *) &glad_glVertexAttribP4ui, (GLADapiproc *) &glad_debug_glVertexAttribP4ui, (GLADapiproc) glad_debug_impl_glVertexAttribP4ui },
+    { (GLADapiproc *) &glad_glVertexAttribP4uiv, (GLADapiproc *) &glad_debug_glVertexAttribP4uiv, (GLADapiproc) glad_debug_impl_glVertexAttribP4uiv },
+    { (GLADapiproc *) &glad_glVertexAttribPointer, (GLADapiproc *) &glad_debug_glVertexAttribPointer, (GLADapiproc) glad_debug_impl_glVertexAttribPointer },
+    { (GLADapiproc *) &glad_glVertexBindingDivisor, (GLADapiproc *) &glad_debug_glVertexBindingDivisor, (GLADapiproc) glad_debug_impl_glVertexBindingDivisor },
+    { (GLADapiproc *) &glad_glViewport, (GLADapiproc *) &glad_debug_glViewport, (GLADapiproc) glad_debug_impl_glViewport },
+    { (GLADapiproc *) &glad_glViewportArrayv, (GLADapiproc *) &glad_debug_glViewportArrayv, (GLADapiproc) glad_debug_impl_glViewportArrayv },
+    { (GLADapiproc *) &glad_glViewportIndexedf, (GLADapiproc *) &glad_debug_glViewportIndexedf, (GLADapiproc) glad_debug_impl_glViewportIndexedf },
+    { (GLADapiproc *) &glad_glViewportIndexedfv, (GLADapiproc *) &glad_debug_glViewportIndexedfv, (GLADapiproc) glad_debug_impl_glViewportIndexedfv },
+    { (GLADapiproc *) &glad_glWaitSync, (GLADapiproc *) &glad_debug_glWaitSync, (GLADapiproc) glad_debug_impl_glWaitSync }
+};
+
+void gladSetGLCallbacks(GLADglcallback pre, GLADglcallback post) {
+    glad_gl_pre_callback = pre;
+    glad_gl_post_callback = post;
+}
+
+void gladInstallGLDebug(void) {
+    unsigned int i;
+    for(i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) {
+        const GladGLDebugEntry *entry = &glad_gl_debug_entries[i];
+        GLADapiproc loaded;
+        if(*entry->pointer == NULL || *entry->pointer == entry->wrapper) continue;
+        /* an on-demand trampoline would store the real pointer over the wrapper: load it now */
+        loaded = gladGLOnDemandLoad(glad_gl_functions[i].name);
+        *entry->real = loaded != NULL ? loaded : *entry->pointer;
+        *entry->pointer = entry->wrapper;
+    }
+}
+
+void gladUninstallGLDebug(void) {
+    unsigned int i;
+    for(i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) {
+        const GladGLDebugEntry *entry = &glad_gl_debug_entries[i];
+        if(*entry->pointer == entry->wrapper) *entry->pointer = *entry->real;
+    }
+}
+
+int gladGLCall(unsigned int function, const GladGLArgument *args, GladGLArgument *result) {
+    switch(function) {
+        case 0: if(glad_glActiveShaderProgram == NULL) return 0; glad_glActiveShaderProgram((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 1: if(glad_glActiveTexture == NULL) return 0; glad_glActiveTexture((GLenum) args[0].u); break;
+        case 2: if(glad_glAttachShader == NULL) return 0; glad_glAttachShader((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 3: if(glad_glBeginConditionalRender == NULL) return 0; glad_glBeginConditionalRender((GLuint) args[0].u, (GLenum) args[1].u); break;
+        case 4: if(glad_glBeginQuery == NULL) return 0; glad_glBeginQuery((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 5: if(glad_glBeginQueryIndexed == NULL) return 0; glad_glBeginQueryIndexed((GLenum) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 6: if(glad_glBeginTransformFeedback == NULL) return 0; glad_glBeginTransformFeedback((GLenum) args[0].u); break;
+        case 7: if(glad_glBindAttribLocation == NULL) return 0; glad_glBindAttribLocation((GLuint) args[0].u, (GLuint) args[1].u, (const GLchar *) args[2].p); break;
+        case 8: if(glad_glBindBuffer == NULL) return 0; glad_glBindBuffer((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 9: if(glad_glBindBufferBase == NULL) return 0; glad_glBindBufferBase((GLenum) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 10: if(glad_glBindBufferRange == NULL) return 0; glad_glBindBufferRange((GLenum) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLintptr) args[3].i, (GLsizeiptr) args[4].i); break;
+        case 11: if(glad_glBindBuffersBase == NULL) return 0; glad_glBindBuffersBase((GLenum) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (const GLuint *) args[3].p); break;
+        case 12: if(glad_glBindBuffersRange == NULL) return 0; glad_glBindBuffersRange((GLenum) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (const GLuint *) args[3].p, (const GLintptr *) args[4].p, (const GLsizeiptr *) args[5].p); break;
+        case 13: if(glad_glBindFragDataLocation == NULL) return 0; glad_glBindFragDataLocation((GLuint) args[0].u, (GLuint) args[1].u, (const GLchar *) args[2].p); break;
+        case 14: if(glad_glBindFragDataLocationIndexed == NULL) return 0; glad_glBindFragDataLocationIndexed((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (const GLchar *) args[3].p); break;
+        case 15: if(glad_glBindFramebuffer == NULL) return 0; glad_glBindFramebuffer((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 16: if(glad_glBindImageTexture == NULL) return 0; glad_glBindImageTexture((GLuint) args[0].u, (GLuint) args[1].u, (GLint) args[2].i, (GLboolean) args[3].u, (GLint) args[4].i, (GLenum) args[5].u, (GLenum) args[6].u); break;
+        case 17: if(glad_glBindImageTextures == NULL) return 0; glad_glBindImageTextures((GLuint) args[0].u, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 18: if(glad_glBindProgramPipeline == NULL) return 0; glad_glBindProgramPipeline((GLuint) args[0].u); break;
+        case 19: if(glad_glBindRenderbuffer == NULL) return 0; glad_glBindRenderbuffer((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 20: if(glad_glBindSampler == NULL) return 0; glad_glBindSampler((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 21: if(glad_glBindSamplers == NULL) return 0; glad_glBindSamplers((GLuint) args[0].u, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 22: if(glad_glBindTexture == NULL) return 0; glad_glBindTexture((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 23: if(glad_glBindTextureUnit == NULL) return 0; glad_glBindTextureUnit((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 24: if(glad_glBindTextures == NULL) return 0; glad_glBindTextures((GLuint) args[0].u, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 25: if(glad_glBindTransformFeedback == NULL) return 0; glad_glBindTransformFeedback((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 26: if(glad_glBindVertexArray == NULL) return 0; glad_glBindVertexArray((GLuint) args[0].u); break;
+        case 27: if(glad_glBindVertexBuffer == NULL) return 0; glad_glBindVertexBuffer((GLuint) args[0].u, (GLuint) args[1].u, (GLintptr) args[2].i, (GLsizei) args[3].i); break;
+        case 28: if(glad_glBindVertexBuffers == NULL) return 0; glad_glBindVertexBuffers((GLuint) args[0].u, (GLsizei) args[1].i, (const GLuint *) args[2].p, (const GLintptr *) args[3].p, (const GLsizei *) args[4].p); break;
+        case 29: if(glad_glBlendColor == NULL) return 0; glad_glBlendColor((GLfloat) args[0].f, (GLfloat) args[1].f, (GLfloat) args[2].f, (GLfloat) args[3].f); break;
+        case 30: if(glad_glBlendEquation == NULL) return 0; glad_glBlendEquation((GLenum) args[0].u); break;
+        case 31: if(glad_glBlendEquationSeparate == NULL) return 0; glad_glBlendEquationSeparate((GLenum) args[0].u, (GLenum) args[1].u); break;
+        case 32: if(glad_glBlendEquationSeparatei == NULL) return 0; glad_glBlendEquationSeparatei((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u); break;
+        case 33: if(glad_glBlendEquationi == NULL) return 0; glad_glBlendEquationi((GLuint) args[0].u, (GLenum) args[1].u); break;
+        case 34: if(glad_glBlendFunc == NULL) return 0; glad_glBlendFunc((GLenum) args[0].u, (GLenum) args[1].u); break;
+        case 35: if(glad_glBlendFuncSeparate == NULL) return 0; glad_glBlendFuncSeparate((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLenum) args[3].u); break;
+        case 36: if(glad_glBlendFuncSeparatei == NULL) return 0; glad_glBlendFuncSeparatei((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLenum) args[3].u, (GLenum) args[4].u); break;
+        case 37: if(glad_glBlendFunci == NULL) return 0; glad_glBlendFunci((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u); break;
+        case 38: if(glad_glBlitFramebuffer == NULL) return 0; glad_glBlitFramebuffer((GLint) args[0].i, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i, (GLint) args[6].i, (GLint) args[7].i, (GLbitfield) args[8].u, (GLenum) args[9].u); break;
+        case 39: if(glad_glBlitNamedFramebuffer == NULL) return 0; glad_glBlitNamedFramebuffer((GLuint) args[0].u, (GLuint) args[1].u, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i, (GLint) args[6].i, (GLint) args[7].i, (GLint) args[8].i, (GLint) args[9].i, (GLbitfield) args[10].u, (GLenum) args[11].u); break;
+        case 40: if(glad_glBufferData == NULL) return 0; glad_glBufferData((GLenum) args[0].u, (GLsizeiptr) args[1].i, (const void *) args[2].p, (GLenum) args[3].u); break;
+        case 41: if(glad_glBufferStorage == NULL) return 0; glad_glBufferStorage((GLenum) args[0].u, (GLsizeiptr) args[1].i, (const void *) args[2].p, (GLbitfield) args[3].u); break;
+        case 42: if(glad_glBufferSubData == NULL) return 0; glad_glBufferSubData((GLenum) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i, (const void *) args[3].p); break;
+        case 43: if(glad_glCheckFramebufferStatus == NULL) return 0; { GLenum glad_ret = glad_glCheckFramebufferStatus((GLenum) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 44: if(glad_glCheckNamedFramebufferStatus == NULL) return 0; { GLenum glad_ret = glad_glCheckNamedFramebufferStatus((GLuint) args[0].u, (GLenum) args[1].u); if(result != NULL) result->u = glad_ret; } break;
+        case 45: if(glad_glClampColor == NULL) return 0; glad_glClampColor((GLenum) args[0].u, (GLenum) args[1].u); break;
+        case 46: if(glad_glClear == NULL) return 0; glad_glClear((GLbitfield) args[0].u); break;
+        case 47: if(glad_glClearBufferData == NULL) return 0; glad_glClearBufferData((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLenum) args[3].u, (const void *) args[4].p); break;
+        case 48: if(glad_glClearBufferSubData == NULL) return 0; glad_glClearBufferSubData((GLenum) args[0].u, (GLenum) args[1].u, (GLintptr) args[2].i, (GLsizeiptr) args[3].i, (GLenum) args[4].u, (GLenum) args[5].u, (const void *) args[6].p); break;
+        case 49: if(glad_glClearBufferfi == NULL) return 0; glad_glClearBufferfi((GLenum) args[0].u, (GLint) args[1].i, (GLfloat) args[2].f, (GLint) args[3].i); break;
+        case 50: if(glad_glClearBufferfv == NULL) return 0; glad_glClearBufferfv((GLenum) args[0].u, (GLint) args[1].i, (const GLfloat *) args[2].p); break;
+        case 51: if(glad_glClearBufferiv == NULL) return 0; glad_glClearBufferiv((GLenum) args[0].u, (GLint) args[1].i, (const GLint *) args[2].p); break;
+        case 52: if(glad_glClearBufferuiv == NULL) return 0; glad_glClearBufferuiv((GLenum) args[0].u, (GLint) args[1].i, (const GLuint *) args[2].p); break;
+        case 53: if(glad_glClearColor == NULL) return 0; glad_glClearColor((GLfloat) args[0].f, (GLfloat) args[1].f, (GLfloat) args[2].f, (GLfloat) args[3].f); break;
+        case 54: if(glad_glClearDepth == NULL) return 0; glad_glClearDepth((GLdouble) args[0].d); break;
+        case 55: if(glad_glClearDepthf == NULL) return 0; glad_glClearDepthf((GLfloat) args[0].f); break;
+        case 56: if(glad_glClearNamedBufferData == NULL) return 0; glad_glClearNamedBufferData((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLenum) args[3].u, (const void *) args[4].p); break;
+        case 57: if(glad_glClearNamedBufferSubData == NULL) return 0; glad_glClearNamedBufferSubData((GLuint) args[0].u, (GLenum) args[1].u, (GLintptr) args[2].i, (GLsizeiptr) args[3].i, (GLenum) args[4].u, (GLenum) args[5].u, (const void *) args[6].p); break;
+        case 58: if(glad_glClearNamedFramebufferfi == NULL) return 0; glad_glClearNamedFramebufferfi((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i, (GLfloat) args[3].f, (GLint) args[4].i); break;
+        case 59: if(glad_glClearNamedFramebufferfv == NULL) return 0; glad_glClearNamedFramebufferfv((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i, (const GLfloat *) args[3].p); break;
+        case 60: if(glad_glClearNamedFramebufferiv == NULL) return 0; glad_glClearNamedFramebufferiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i, (const GLint *) args[3].p); break;
+        case 61: if(glad_glClearNamedFramebufferuiv == NULL) return 0; glad_glClearNamedFramebufferuiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i, (const GLuint *) args[3].p); break;
+        case 62: if(glad_glClearStencil == NULL) return 0; glad_glClearStencil((GLint) args[0].i); break;
+        case 63: if(glad_glClearTexImage == NULL) return 0; glad_glClearTexImage((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLenum) args[3].u, (const void *) args[4].p); break;
+        case 64: if(glad_glClearTexSubImage == NULL) return 0; glad_glClearTexSubImage((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i, (GLenum) args[8].u, (GLenum) args[9].u, (const void *) args[10].p); break;
+        case 65: if(glad_glClientWaitSync == NULL) return 0; { GLenum glad_ret = glad_glClientWaitSync((GLsync) args[0].p, (GLbitfield) args[1].u, (GLuint64) args[2].u); if(result != NULL) result->u = glad_ret; } break;
+        case 66: if(glad_glClipControl == NULL) return 0; glad_glClipControl((GLenum) args[0].u, (GLenum) args[1].u); break;
+        case 67: if(glad_glColorMask == NULL) return 0; glad_glColorMask((GLboolean) args[0].u, (GLboolean) args[1].u, (GLboolean) args[2].u, (GLboolean) args[3].u); break;
+        case 68: if(glad_glColorMaski == NULL) return 0; glad_glColorMaski((GLuint) args[0].u, (GLboolean) args[1].u, (GLboolean) args[2].u, (GLboolean) args[3].u, (GLboolean) args[4].u); break;
+        case 69: if(glad_glCompileShader == NULL) return 0; glad_glCompileShader((GLuint) args[0].u); break;
+        case 70: if(glad_glCompressedTexImage1D == NULL) return 0; glad_glCompressedTexImage1D((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (const void *) args[6].p); break;
+        case 71: if(glad_glCompressedTexImage2D == NULL) return 0; glad_glCompressedTexImage2D((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLint) args[5].i, (GLsizei) args[6].i, (const void *) args[7].p); break;
+        case 72: if(glad_glCompressedTexImage3D == NULL) return 0; glad_glCompressedTexImage3D((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLint) args[6].i, (GLsizei) args[7].i, (const void *) args[8].p); break;
+        case 73: if(glad_glCompressedTexSubImage1D == NULL) return 0; glad_glCompressedTexSubImage1D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLenum) args[4].u, (GLsizei) args[5].i, (const void *) args[6].p); break;
+        case 74: if(glad_glCompressedTexSubImage2D == NULL) return 0; glad_glCompressedTexSubImage2D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLenum) args[6].u, (GLsizei) args[7].i, (const void *) args[8].p); break;
+        case 75: if(glad_glCompressedTexSubImage3D == NULL) return 0; glad_glCompressedTexSubImage3D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i, (GLenum) args[8].u, (GLsizei) args[9].i, (const void *) args[10].p); break;
+        case 76: if(glad_glCompressedTextureSubImage1D == NULL) return 0; glad_glCompressedTextureSubImage1D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLenum) args[4].u, (GLsizei) args[5].i, (const void *) args[6].p); break;
+        case 77: if(glad_glCompressedTextureSubImage2D == NULL) return 0; glad_glCompressedTextureSubImage2D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLenum) args[6].u, (GLsizei) args[7].i, (const void *) args[8].p); break;
+        case 78: if(glad_glCompressedTextureSubImage3D == NULL) return 0; glad_glCompressedTextureSubImage3D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i, (GLenum) args[8].u, (GLsizei) args[9].i, (const void *) args[10].p); break;
+        case 79: if(glad_glCopyBufferSubData == NULL) return 0; glad_glCopyBufferSubData((GLenum) args[0].u, (GLenum) args[1].u, (GLintptr) args[2].i, (GLintptr) args[3].i, (GLsizeiptr) args[4].i); break;
+        case 80: if(glad_glCopyImageSubData == NULL) return 0; glad_glCopyImageSubData((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i, (GLuint) args[6].u, (GLenum) args[7].u, (GLint) args[8].i, (GLint) args[9].i, (GLint) args[10].i, (GLint) args[11].i, (GLsizei) args[12].i, (GLsizei) args[13].i, (GLsizei) args[14].i); break;
+        case 81: if(glad_glCopyNamedBufferSubData == NULL) return 0; glad_glCopyNamedBufferSubData((GLuint) args[0].u, (GLuint) args[1].u, (GLintptr) args[2].i, (GLintptr) args[3].i, (GLsizeiptr) args[4].i); break;
+        case 82: if(glad_glCopyTexImage1D == NULL) return 0; glad_glCopyTexImage1D((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLint) args[6].i); break;
+        case 83: if(glad_glCopyTexImage2D == NULL) return 0; glad_glCopyTexImage2D((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLint) args[7].i); break;
+        case 84: if(glad_glCopyTexSubImage1D == NULL) return 0; glad_glCopyTexSubImage1D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i); break;
+        case 85: if(glad_glCopyTexSubImage2D == NULL) return 0; glad_glCopyTexSubImage2D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i); break;
+        case 86: if(glad_glCopyTexSubImage3D == NULL) return 0; glad_glCopyTexSubImage3D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i, (GLint) args[6].i, (GLsizei) args[7].i, (GLsizei) args[8].i); break;
+        case 87: if(glad_glCopyTextureSubImage1D == NULL) return 0; glad_glCopyTextureSubImage1D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i); break;
+        case 88: if(glad_glCopyTextureSubImage2D == NULL) return 0; glad_glCopyTextureSubImage2D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i); break;
+        case 89: if(glad_glCopyTextureSubImage3D == NULL) return 0; glad_glCopyTextureSubImage3D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i, (GLint) args[6].i, (GLsizei) args[7].i, (GLsizei) args[8].i); break;
+        case 90: if(glad_glCreateBuffers == NULL) return 0; glad_glCreateBuffers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 91: if(glad_glCreateFramebuffers == NULL) return 0; glad_glCreateFramebuffers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 92: if(glad_glCreateProgram == NULL) return 0; { GLuint glad_ret = glad_glCreateProgram(); if(result != NULL) result->u = glad_ret; } break;
+        case 93: if(glad_glCreateProgramPipelines == NULL) return 0; glad_glCreateProgramPipelines((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 94: if(glad_glCreateQueries == NULL) return 0; glad_glCreateQueries((GLenum) args[0].u, (GLsizei) args[1].i, (GLuint *) args[2].p); break;
+        case 95: if(glad_glCreateRenderbuffers == NULL) return 0; glad_glCreateRenderbuffers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 96: if(glad_glCreateSamplers == NULL) return 0; glad_glCreateSamplers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 97: if(glad_glCreateShader == NULL) return 0; { GLuint glad_ret = glad_glCreateShader((GLenum) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 98: if(glad_glCreateShaderProgramv == NULL) return 0; { GLuint glad_ret = glad_glCreateShaderProgramv((GLenum) args[0].u, (GLsizei) args[1].i, (const GLchar *const*) args[2].p); if(result != NULL) result->u = glad_ret; } break;
+        case 99: if(glad_glCreateTextures == NULL) return 0; glad_glCreateTextures((GLenum) args[0].u, (GLsizei) args[1].i, (GLuint *) args[2].p); break;
+        case 100: if(glad_glCreateTransformFeedbacks == NULL) return 0; glad_glCreateTransformFeedbacks((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 101: if(glad_glCreateVertexArrays == NULL) return 0; glad_glCreateVertexArrays((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 102: if(glad_glCullFace == NULL) return 0; glad_glCullFace((GLenum) args[0].u); break;
+        case 103: if(glad_glDebugMessageCallback == NULL) return 0; glad_glDebugMessageCallback((GLDEBUGPROC) args[0].p, (const void *) args[1].p); break;
+        case 104: if(glad_glDebugMessageControl == NULL) return 0; glad_glDebugMessageControl((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLsizei) args[3].i, (const GLuint *) args[4].p, (GLboolean) args[5].u); break;
+        case 105: if(glad_glDebugMessageInsert == NULL) return 0; glad_glDebugMessageInsert((GLenum) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLenum) args[3].u, (GLsizei) args[4].i, (const GLchar *) args[5].p); break;
+        case 106: if(glad_glDeleteBuffers == NULL) return 0; glad_glDeleteBuffers((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 107: if(glad_glDeleteFramebuffers == NULL) return 0; glad_glDeleteFramebuffers((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 108: if(glad_glDeleteProgram == NULL) return 0; glad_glDeleteProgram((GLuint) args[0].u); break;
+        case 109: if(glad_glDeleteProgramPipelines == NULL) return 0; glad_glDeleteProgramPipelines((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 110: if(glad_glDeleteQueries == NULL) return 0; glad_glDeleteQueries((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 111: if(glad_glDeleteRenderbuffers == NULL) return 0; glad_glDeleteRenderbuffers((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 112: if(glad_glDeleteSamplers == NULL) return 0; glad_glDeleteSamplers((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 113: if(glad_glDeleteShader == NULL) return 0; glad_glDeleteShader((GLuint) args[0].u); break;
+        case 114: if(glad_glDeleteSync == NULL) return 0; glad_glDeleteSync((GLsync) args[0].p); break;
+        case 115: if(glad_glDeleteTextures == NULL) return 0; glad_glDeleteTextures((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 116: if(glad_glDeleteTransformFeedbacks == NULL) return 0; glad_glDeleteTransformFeedbacks((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 117: if(glad_glDeleteVertexArrays == NULL) return 0; glad_glDeleteVertexArrays((GLsizei) args[0].i, (const GLuint *) args[1].p); break;
+        case 118: if(glad_glDepthFunc == NULL) return 0; glad_glDepthFunc((GLenum) args[0].u); break;
+        case 119: if(glad_glDepthMask == NULL) return 0; glad_glDepthMask((GLboolean) args[0].u); break;
+        case 120: if(glad_glDepthRange == NULL) return 0; glad_glDepthRange((GLdouble) args[0].d, (GLdouble) args[1].d); break;
+        case 121: if(glad_glDepthRangeArrayv == NULL) return 0; glad_glDepthRangeArrayv((GLuint) args[0].u, (GLsizei) args[1].i, (const GLdouble *) args[2].p); break;
+        case 122: if(glad_glDepthRangeIndexed == NULL) return 0; glad_glDepthRangeIndexed((GLuint) args[0].u, (GLdouble) args[1].d, (GLdouble) args[2].d); break;
+        case 123: if(glad_glDepthRangef == NULL) return 0; glad_glDepthRangef((GLfloat) args[0].f, (GLfloat) args[1].f); break;
+        case 124: if(glad_glDetachShader == NULL) return 0; glad_glDetachShader((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 125: if(glad_glDisable == NULL) return 0; glad_glDisable((GLenum) args[0].u); break;
+        case 126: if(glad_glDisableVertexArrayAttrib == NULL) return 0; glad_glDisableVertexArrayAttrib((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 127: if(glad_glDisableVertexAttribArray == NULL) return 0; glad_glDisableVertexAttribArray((GLuint) args[0].u); break;
+        case 128: if(glad_glDisablei == NULL) return 0; glad_glDisablei((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 129: if(glad_glDispatchCompute == NULL) return 0; glad_glDispatchCompute((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 130: if(glad_glDispatchComputeIndirect == NULL) return 0; glad_glDispatchComputeIndirect((GLintptr) args[0].i); break;
+        case 131: if(glad_glDrawArrays == NULL) return 0; glad_glDrawArrays((GLenum) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i); break;
+        case 132: if(glad_glDrawArraysIndirect == NULL) return 0; glad_glDrawArraysIndirect((GLenum) args[0].u, (const void *) args[1].p); break;
+        case 133: if(glad_glDrawArraysInstanced == NULL) return 0; glad_glDrawArraysInstanced((GLenum) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLsizei) args[3].i); break;
+        case 134: if(glad_glDrawArraysInstancedBaseInstance == NULL) return 0; glad_glDrawArraysInstancedBaseInstance((GLenum) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLsizei) args[3].i, (GLuint) args[4].u); break;
+        case 135: if(glad_glDrawBuffer == NULL) return 0; glad_glDrawBuffer((GLenum) args[0].u); break;
+        case 136: if(glad_glDrawBuffers == NULL) return 0; glad_glDrawBuffers((GLsizei) args[0].i, (const GLenum *) args[1].p); break;
+        case 137: if(glad_glDrawElements == NULL) return 0; glad_glDrawElements((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (const void *) args[3].p); break;
+        case 138: if(glad_glDrawElementsBaseVertex == NULL) return 0; glad_glDrawElementsBaseVertex((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (const void *) args[3].p, (GLint) args[4].i); break;
+        case 139: if(glad_glDrawElementsIndirect == NULL) return 0; glad_glDrawElementsIndirect((GLenum) args[0].u, (GLenum) args[1].u, (const void *) args[2].p); break;
+        case 140: if(glad_glDrawElementsInstanced == NULL) return 0; glad_glDrawElementsInstanced((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (const void *) args[3].p, (GLsizei) args[4].i); break;
+        case 141: if(glad_glDrawElementsInstancedBaseInstance == NULL) return 0; glad_glDrawElementsInstancedBaseInstance((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (const void *) args[3].p, (GLsizei) args[4].i, (GLuint) args[5].u); break;
+        case 142: if(glad_glDrawElementsInstancedBaseVertex == NULL) return 0; glad_glDrawElementsInstancedBaseVertex((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (const void *) args[3].p, (GLsizei) args[4].i, (GLint) args[5].i); break;
+        case 143: if(glad_glDrawElementsInstancedBaseVertexBaseInstance == NULL) return 0; glad_glDrawElementsInstancedBaseVertexBaseInstance((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (const void *) args[3].p, (GLsizei) args[4].i, (GLint) args[5].i, (GLuint) args[6].u); break;
+        case 144: if(glad_glDrawRangeElements == NULL) return 0; glad_glDrawRangeElements((GLenum) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLsizei) args[3].i, (GLenum) args[4].u, (const void *) args[5].p); break;
+        case 145: if(glad_glDrawRangeElementsBaseVertex == NULL) return 0; glad_glDrawRangeElementsBaseVertex((GLenum) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLsizei) args[3].i, (GLenum) args[4].u, (const void *) args[5].p, (GLint) args[6].i); break;
+        case 146: if(glad_glDrawTransformFeedback == NULL) return 0; glad_glDrawTransformFeedback((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 147: if(glad_glDrawTransformFeedbackInstanced == NULL) return 0; glad_glDrawTransformFeedbackInstanced((GLenum) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i); break;
+        case 148: if(glad_glDrawTransformFeedbackStream == NULL) return 0; glad_glDrawTransformFeedbackStream((GLenum) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 149: if(glad_glDrawTransformFeedbackStreamInstanced == NULL) return 0; glad_glDrawTransformFeedbackStreamInstanced((GLenum) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLsizei) args[3].i); break;
+        case 150: if(glad_glEnable == NULL) return 0; glad_glEnable((GLenum) args[0].u); break;
+        case 151: if(glad_glEnableVertexArrayAttrib == NULL) return 0; glad_glEnableVertexArrayAttrib((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 152: if(glad_glEnableVertexAttribArray == NULL) return 0; glad_glEnableVertexAttribArray((GLuint) args[0].u); break;
+        case 153: if(glad_glEnablei == NULL) return 0; glad_glEnablei((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 154: if(glad_glEndConditionalRender == NULL) return 0; glad_glEndConditionalRender(); break;
+        case 155: if(glad_glEndQuery == NULL) return 0; glad_glEndQuery((GLenum) args[0].u); break;
+        case 156: if(glad_glEndQueryIndexed == NULL) return 0; glad_glEndQueryIndexed((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 157: if(glad_glEndTransformFeedback == NULL) return 0; glad_glEndTransformFeedback(); break;
+        case 158: if(glad_glFenceSync == NULL) return 0; { GLsync glad_ret = glad_glFenceSync((GLenum) args[0].u, (GLbitfield) args[1].u); if(result != NULL) result->p = (const void *) glad_ret; } break;
+        case 159: if(glad_glFinish == NULL) return 0; glad_glFinish(); break;
+        case 160: if(glad_glFlush == NULL) return 0; glad_glFlush(); break;
+        case 161: if(glad_glFlushMappedBufferRange == NULL) return 0; glad_glFlushMappedBufferRange((GLenum) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i); break;
+        case 162: if(glad_glFlushMappedNamedBufferRange == NULL) return 0; glad_glFlushMappedNamedBufferRange((GLuint) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i); break;
+        case 163: if(glad_glFramebufferParameteri == NULL) return 0; glad_glFramebufferParameteri((GLenum) args[0].u, (GLenum) args[1].u, (GLint) args[2].i); break;
+        case 164: if(glad_glFramebufferRenderbuffer == NULL) return 0; glad_glFramebufferRenderbuffer((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLuint) args[3].u); break;
+        case 165: if(glad_glFramebufferTexture == NULL) return 0; glad_glFramebufferTexture((GLenum) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLint) args[3].i); break;
+        case 166: if(glad_glFramebufferTexture1D == NULL) return 0; glad_glFramebufferTexture1D((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLuint) args[3].u, (GLint) args[4].i); break;
+        case 167: if(glad_glFramebufferTexture2D == NULL) return 0; glad_glFramebufferTexture2D((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLuint) args[3].u, (GLint) args[4].i); break;
+        case 168: if(glad_glFramebufferTexture3D == NULL) return 0; glad_glFramebufferTexture3D((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLuint) args[3].u, (GLint) args[4].i, (GLint) args[5].i); break;
+        case 169: if(glad_glFramebufferTextureLayer == NULL) return 0; glad_glFramebufferTextureLayer((GLenum) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLint) args[3].i, (GLint) args[4].i); break;
+        case 170: if(glad_glFrontFace == NULL) return 0; glad_glFrontFace((GLenum) args[0].u); break;
+        case 171: if(glad_glGenBuffers == NULL) return 0; glad_glGenBuffers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 172: if(glad_glGenFramebuffers == NULL) return 0; glad_glGenFramebuffers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 173: if(glad_glGenProgramPipelines == NULL) return 0; glad_glGenProgramPipelines((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 174: if(glad_glGenQueries == NULL) return 0; glad_glGenQueries((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 175: if(glad_glGenRenderbuffers == NULL) return 0; glad_glGenRenderbuffers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 176: if(glad_glGenSamplers == NULL) return 0; glad_glGenSamplers((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 177: if(glad_glGenTextures == NULL) return 0; glad_glGenTextures((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 178: if(glad_glGenTransformFeedbacks == NULL) return 0; glad_glGenTransformFeedbacks((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 179: if(glad_glGenVertexArrays == NULL) return 0; glad_glGenVertexArrays((GLsizei) args[0].i, (GLuint *) args[1].p); break;
+        case 180: if(glad_glGenerateMipmap == NULL) return 0; glad_glGenerateMipmap((GLenum) args[0].u); break;
+        case 181: if(glad_glGenerateTextureMipmap == NULL) return 0; glad_glGenerateTextureMipmap((GLuint) args[0].u); break;
+        case 182: if(glad_glGetActiveAtomicCounterBufferiv == NULL) return 0; glad_glGetActiveAtomicCounterBufferiv((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 183: if(glad_glGetActiveAttrib == NULL) return 0; glad_glGetActiveAttrib((GLuint) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (GLsizei *) args[3].p, (GLint *) args[4].p, (GLenum *) args[5].p, (GLchar *) args[6].p); break;
+        case 184: if(glad_glGetActiveSubroutineName == NULL) return 0; glad_glGetActiveSubroutineName((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLsizei) args[3].i, (GLsizei *) args[4].p, (GLchar *) args[5].p); break;
+        case 185: if(glad_glGetActiveSubroutineUniformName == NULL) return 0; glad_glGetActiveSubroutineUniformName((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLsizei) args[3].i, (GLsizei *) args[4].p, (GLchar *) args[5].p); break;
+        case 186: if(glad_glGetActiveSubroutineUniformiv == NULL) return 0; glad_glGetActiveSubroutineUniformiv((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLenum) args[3].u, (GLint *) args[4].p); break;
+        case 187: if(glad_glGetActiveUniform == NULL) return 0; glad_glGetActiveUniform((GLuint) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (GLsizei *) args[3].p, (GLint *) args[4].p, (GLenum *) args[5].p, (GLchar *) args[6].p); break;
+        case 188: if(glad_glGetActiveUniformBlockName == NULL) return 0; glad_glGetActiveUniformBlockName((GLuint) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (GLsizei *) args[3].p, (GLchar *) args[4].p); break;
+        case 189: if(glad_glGetActiveUniformBlockiv == NULL) return 0; glad_glGetActiveUniformBlockiv((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 190: if(glad_glGetActiveUniformName == NULL) return 0; glad_glGetActiveUniformName((GLuint) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (GLsizei *) args[3].p, (GLchar *) args[4].p); break;
+        case 191: if(glad_glGetActiveUniformsiv == NULL) return 0; glad_glGetActiveUniformsiv((GLuint) args[0].u, (GLsizei) args[1].i, (const GLuint *) args[2].p, (GLenum) args[3].u, (GLint *) args[4].p); break;
+        case 192: if(glad_glGetAttachedShaders == NULL) return 0; glad_glGetAttachedShaders((GLuint) args[0].u, (GLsizei) args[1].i, (GLsizei *) args[2].p, (GLuint *) args[3].p); break;
+        case 193: if(glad_glGetAttribLocation == NULL) return 0; { GLint glad_ret = glad_glGetAttribLocation((GLuint) args[0].u, (const GLchar *) args[1].p); if(result != NULL) result->i = glad_ret; } break;
+        case 194: if(glad_glGetBooleani_v == NULL) return 0; glad_glGetBooleani_v((GLenum) args[0].u, (GLuint) args[1].u, (GLboolean *) args[2].p); break;
+        case 195: if(glad_glGetBooleanv == NULL) return 0; glad_glGetBooleanv((GLenum) args[0].u, (GLboolean *) args[1].p); break;
+        case 196: if(glad_glGetBufferParameteri64v == NULL) return 0; glad_glGetBufferParameteri64v((GLenum) args[0].u, (GLenum) args[1].u, (GLint64 *) args[2].p); break;
+        case 197: if(glad_glGetBufferParameteriv == NULL) return 0; glad_glGetBufferParameteriv((GLenum) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 198: if(glad_glGetBufferPointerv == NULL) return 0; glad_glGetBufferPointerv((GLenum) args[0].u, (GLenum) args[1].u, (void **) args[2].p); break;
+        case 199: if(glad_glGetBufferSubData == NULL) return 0; glad_glGetBufferSubData((GLenum) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i, (void *) args[3].p); break;
+        case 200: if(glad_glGetCompressedTexImage == NULL) return 0; glad_glGetCompressedTexImage((GLenum) args[0].u, (GLint) args[1].i, (void *) args[2].p); break;
+        case 201: if(glad_glGetCompressedTextureImage == NULL) return 0; glad_glGetCompressedTextureImage((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (void *) args[3].p); break;
+        case 202: if(glad_glGetCompressedTextureSubImage == NULL) return 0; glad_glGetCompressedTextureSubImage((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i, (GLsizei) args[8].i, (void *) args[9].p); break;
+        case 203: if(glad_glGetDebugMessageLog == NULL) return 0; { GLuint glad_ret = glad_glGetDebugMessageLog((GLuint) args[0].u, (GLsizei) args[1].i, (GLenum *) args[2].p, (GLenum *) args[3].p, (GLuint *) args[4].p, (GLenum *) args[5].p, (GLsizei *) args[6].p, (GLchar *) args[7].p); if(result != NULL) result->u = glad_ret; } break;
+        case 204: if(glad_glGetDoublei_v == NULL) return 0; glad_glGetDoublei_v((GLenum) args[0].u, (GLuint) args[1].u, (GLdouble *) args[2].p); break;
+        case 205: if(glad_glGetDoublev == NULL) return 0; glad_glGetDoublev((GLenum) args[0].u, (GLdouble *) args[1].p); break;
+        case 206: if(glad_glGetError == NULL) return 0; { GLenum glad_ret = glad_glGetError(); if(result != NULL) result->u = glad_ret; } break;
+        case 207: if(glad_glGetFloati_v == NULL) return 0; glad_glGetFloati_v((GLenum) args[0].u, (GLuint) args[1].u, (GLfloat *) args[2].p); break;
+        case 208: if(glad_glGetFloatv == NULL) return 0; glad_glGetFloatv((GLenum) args[0].u, (GLfloat *) args[1].p); break;
+        case 209: if(glad_glGetFragDataIndex == NULL) return 0; { GLint glad_ret = glad_glGetFragDataIndex((GLuint) args[0].u, (const GLchar *) args[1].p); if(result != NULL) result->i = glad_ret; } break;
+        case 210: if(glad_glGetFragDataLocation == NULL) return 0; { GLint glad_ret = glad_glGetFragDataLocation((GLuint) args[0].u, (const GLchar *) args[1].p); if(result != NULL) result->i = glad_ret; } break;
+        case 211: if(glad_glGetFramebufferAttachmentParameteriv == NULL) return 0; glad_glGetFramebufferAttachmentParameteriv((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 212: if(glad_glGetFramebufferParameteriv == NULL) return 0; glad_glGetFramebufferParameteriv((GLenum) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 213: if(glad_glGetGraphicsResetStatus == NULL) return 0; { GLenum glad_ret = glad_glGetGraphicsResetStatus(); if(result != NULL) result->u = glad_ret; } break;
+        case 214: if(glad_glGetInteger64i_v == NULL) return 0; glad_glGetInteger64i_v((GLenum) args[0].u, (GLuint) args[1].u, (GLint64 *) args[2].p); break;
+        case 215: if(glad_glGetInteger64v == NULL) return 0; glad_glGetInteger64v((GLenum) args[0].u, (GLint64 *) args[1].p); break;
+        case 216: if(glad_glGetIntegeri_v == NULL) return 0; glad_glGetIntegeri_v((GLenum) args[0].u, (GLuint) args[1].u, (GLint *) args[2].p); break;
+        case 217: if(glad_glGetIntegerv == NULL) return 0; glad_glGetIntegerv((GLenum) args[0].u, (GLint *) args[1].p); break;
+        case 218: if(glad_glGetInternalformati64v == NULL) return 0; glad_glGetInternalformati64v((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLsizei) args[3].i, (GLint64 *) args[4].p); break;
+        case 219: if(glad_glGetInternalformativ == NULL) return 0; glad_glGetInternalformativ((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLsizei) args[3].i, (GLint *) args[4].p); break;
+        case 220: if(glad_glGetMultisamplefv == NULL) return 0; glad_glGetMultisamplefv((GLenum) args[0].u, (GLuint) args[1].u, (GLfloat *) args[2].p); break;
+        case 221: if(glad_glGetNamedBufferParameteri64v == NULL) return 0; glad_glGetNamedBufferParameteri64v((GLuint) args[0].u, (GLenum) args[1].u, (GLint64 *) args[2].p); break;
+        case 222: if(glad_glGetNamedBufferParameteriv == NULL) return 0; glad_glGetNamedBufferParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 223: if(glad_glGetNamedBufferPointerv == NULL) return 0; glad_glGetNamedBufferPointerv((GLuint) args[0].u, (GLenum) args[1].u, (void **) args[2].p); break;
+        case 224: if(glad_glGetNamedBufferSubData == NULL) return 0; glad_glGetNamedBufferSubData((GLuint) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i, (void *) args[3].p); break;
+        case 225: if(glad_glGetNamedFramebufferAttachmentParameteriv == NULL) return 0; glad_glGetNamedFramebufferAttachmentParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 226: if(glad_glGetNamedFramebufferParameteriv == NULL) return 0; glad_glGetNamedFramebufferParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 227: if(glad_glGetNamedRenderbufferParameteriv == NULL) return 0; glad_glGetNamedRenderbufferParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 228: if(glad_glGetObjectLabel == NULL) return 0; glad_glGetObjectLabel((GLenum) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (GLsizei *) args[3].p, (GLchar *) args[4].p); break;
+        case 229: if(glad_glGetObjectPtrLabel == NULL) return 0; glad_glGetObjectPtrLabel((const void *) args[0].p, (GLsizei) args[1].i, (GLsizei *) args[2].p, (GLchar *) args[3].p); break;
+        case 230: if(glad_glGetPointerv == NULL) return 0; glad_glGetPointerv((GLenum) args[0].u, (void **) args[1].p); break;
+        case 231: if(glad_glGetProgramBinary == NULL) return 0; glad_glGetProgramBinary((GLuint) args[0].u, (GLsizei) args[1].i, (GLsizei *) args[2].p, (GLenum *) args[3].p, (void *) args[4].p); break;
+        case 232: if(glad_glGetProgramInfoLog == NULL) return 0; glad_glGetProgramInfoLog((GLuint) args[0].u, (GLsizei) args[1].i, (GLsizei *) args[2].p, (GLchar *) args[3].p); break;
+        case 233: if(glad_glGetProgramInterfaceiv == NULL) return 0; glad_glGetProgramInterfaceiv((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 234: if(glad_glGetProgramPipelineInfoLog == NULL) return 0; glad_glGetProgramPipelineInfoLog((GLuint) args[0].u, (GLsizei) args[1].i, (GLsizei *) args[2].p, (GLchar *) args[3].p); break;
+        case 235: if(glad_glGetProgramPipelineiv == NULL) return 0; glad_glGetProgramPipelineiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 236: if(glad_glGetProgramResourceIndex == NULL) return 0; { GLuint glad_ret = glad_glGetProgramResourceIndex((GLuint) args[0].u, (GLenum) args[1].u, (const GLchar *) args[2].p); if(result != NULL) result->u = glad_ret; } break;
+        case 237: if(glad_glGetProgramResourceLocation == NULL) return 0; { GLint glad_ret = glad_glGetProgramResourceLocation((GLuint) args[0].u, (GLenum) args[1].u, (const GLchar *) args[2].p); if(result != NULL) result->i = glad_ret; } break;
+        case 238: if(glad_glGetProgramResourceLocationIndex == NULL) return 0; { GLint glad_ret = glad_glGetProgramResourceLocationIndex((GLuint) args[0].u, (GLenum) args[1].u, (const GLchar *) args[2].p); if(result != NULL) result->i = glad_ret; } break;
+        case 239: if(glad_glGetProgramResourceName == NULL) return 0; glad_glGetProgramResourceName((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLsizei) args[3].i, (GLsizei *) args[4].p, (GLchar *) args[5].p); break;
+        case 240: if(glad_glGetProgramResourceiv == NULL) return 0; glad_glGetProgramResourceiv((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLsizei) args[3].i, (const GLenum *) args[4].p, (GLsizei) args[5].i, (GLsizei *) args[6].p, (GLint *) args[7].p); break;
+        case 241: if(glad_glGetProgramStageiv == NULL) return 0; glad_glGetProgramStageiv((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 242: if(glad_glGetProgramiv == NULL) return 0; glad_glGetProgramiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 243: if(glad_glGetQueryBufferObjecti64v == NULL) return 0; glad_glGetQueryBufferObjecti64v((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLintptr) args[3].i); break;
+        case 244: if(glad_glGetQueryBufferObjectiv == NULL) return 0; glad_glGetQueryBufferObjectiv((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLintptr) args[3].i); break;
+        case 245: if(glad_glGetQueryBufferObjectui64v == NULL) return 0; glad_glGetQueryBufferObjectui64v((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLintptr) args[3].i); break;
+        case 246: if(glad_glGetQueryBufferObjectuiv == NULL) return 0; glad_glGetQueryBufferObjectuiv((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLintptr) args[3].i); break;
+        case 247: if(glad_glGetQueryIndexediv == NULL) return 0; glad_glGetQueryIndexediv((GLenum) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 248: if(glad_glGetQueryObjecti64v == NULL) return 0; glad_glGetQueryObjecti64v((GLuint) args[0].u, (GLenum) args[1].u, (GLint64 *) args[2].p); break;
+        case 249: if(glad_glGetQueryObjectiv == NULL) return 0; glad_glGetQueryObjectiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 250: if(glad_glGetQueryObjectui64v == NULL) return 0; glad_glGetQueryObjectui64v((GLuint) args[0].u, (GLenum) args[1].u, (GLuint64 *) args[2].p); break;
+        case 251: if(glad_glGetQueryObjectuiv == NULL) return 0; glad_glGetQueryObjectuiv((GLuint) args[0].u, (GLenum) args[1].u, (GLuint *) args[2].p); break;
+        case 252: if(glad_glGetQueryiv == NULL) return 0; glad_glGetQueryiv((GLenum) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 253: if(glad_glGetRenderbufferParameteriv == NULL) return 0; glad_glGetRenderbufferParameteriv((GLenum) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 254: if(glad_glGetSamplerParameterIiv == NULL) return 0; glad_glGetSamplerParameterIiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 255: if(glad_glGetSamplerParameterIuiv == NULL) return 0; glad_glGetSamplerParameterIuiv((GLuint) args[0].u, (GLenum) args[1].u, (GLuint *) args[2].p); break;
+        case 256: if(glad_glGetSamplerParameterfv == NULL) return 0; glad_glGetSamplerParameterfv((GLuint) args[0].u, (GLenum) args[1].u, (GLfloat *) args[2].p); break;
+        case 257: if(glad_glGetSamplerParameteriv == NULL) return 0; glad_glGetSamplerParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 258: if(glad_glGetShaderInfoLog == NULL) return 0; glad_glGetShaderInfoLog((GLuint) args[0].u, (GLsizei) args[1].i, (GLsizei *) args[2].p, (GLchar *) args[3].p); break;
+        case 259: if(glad_glGetShaderPrecisionFormat == NULL) return 0; glad_glGetShaderPrecisionFormat((GLenum) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p, (GLint *) args[3].p); break;
+        case 260: if(glad_glGetShaderSource == NULL) return 0; glad_glGetShaderSource((GLuint) args[0].u, (GLsizei) args[1].i, (GLsizei *) args[2].p, (GLchar *) args[3].p); break;
+        case 261: if(glad_glGetShaderiv == NULL) return 0; glad_glGetShaderiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 262: if(glad_glGetString == NULL) return 0; { const GLubyte * glad_ret = glad_glGetString((GLenum) args[0].u); if(result != NULL) result->p = (const void *) glad_ret; } break;
+        case 263: if(glad_glGetStringi == NULL) return 0; { const GLubyte * glad_ret = glad_glGetStringi((GLenum) args[0].u, (GLuint) args[1].u); if(result != NULL) result->p = (const void *) glad_ret; } break;
+        case 264: if(glad_glGetSubroutineIndex == NULL) return 0; { GLuint glad_ret = glad_glGetSubroutineIndex((GLuint) args[0].u, (GLenum) args[1].u, (const GLchar *) args[2].p); if(result != NULL) result->u = glad_ret; } break;
+        case 265: if(glad_glGetSubroutineUniformLocation == NULL) return 0; { GLint glad_ret = glad_glGetSubroutineUniformLocation((GLuint) args[0].u, (GLenum) args[1].u, (const GLchar *) args[2].p); if(result != NULL) result->i = glad_ret; } break;
+        case 266: if(glad_glGetSynciv == NULL) return 0; glad_glGetSynciv((GLsync) args[0].p, (GLenum) args[1].u, (GLsizei) args[2].i, (GLsizei *) args[3].p, (GLint *) args[4].p); break;
+        case 267: if(glad_glGetTexImage == NULL) return 0; glad_glGetTexImage((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLenum) args[3].u, (void *) args[4].p); break;
+        case 268: if(glad_glGetTexLevelParameterfv == NULL) return 0; glad_glGetTexLevelParameterfv((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLfloat *) args[3].p); break;
+        case 269: if(glad_glGetTexLevelParameteriv == NULL) return 0; glad_glGetTexLevelParameteriv((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 270: if(glad_glGetTexParameterIiv == NULL) return 0; glad_glGetTexParameterIiv((GLenum) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 271: if(glad_glGetTexParameterIuiv == NULL) return 0; glad_glGetTexParameterIuiv((GLenum) args[0].u, (GLenum) args[1].u, (GLuint *) args[2].p); break;
+        case 272: if(glad_glGetTexParameterfv == NULL) return 0; glad_glGetTexParameterfv((GLenum) args[0].u, (GLenum) args[1].u, (GLfloat *) args[2].p); break;
+        case 273: if(glad_glGetTexParameteriv == NULL) return 0; glad_glGetTexParameteriv((GLenum) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 274: if(glad_glGetTextureImage == NULL) return 0; glad_glGetTextureImage((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLenum) args[3].u, (GLsizei) args[4].i, (void *) args[5].p); break;
+        case 275: if(glad_glGetTextureLevelParameterfv == NULL) return 0; glad_glGetTextureLevelParameterfv((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLfloat *) args[3].p); break;
+        case 276: if(glad_glGetTextureLevelParameteriv == NULL) return 0; glad_glGetTextureLevelParameteriv((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 277: if(glad_glGetTextureParameterIiv == NULL) return 0; glad_glGetTextureParameterIiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 278: if(glad_glGetTextureParameterIuiv == NULL) return 0; glad_glGetTextureParameterIuiv((GLuint) args[0].u, (GLenum) args[1].u, (GLuint *) args[2].p); break;
+        case 279: if(glad_glGetTextureParameterfv == NULL) return 0; glad_glGetTextureParameterfv((GLuint) args[0].u, (GLenum) args[1].u, (GLfloat *) args[2].p); break;
+        case 280: if(glad_glGetTextureParameteriv == NULL) return 0; glad_glGetTextureParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 281: if(glad_glGetTextureSubImage == NULL) return 0; glad_glGetTextureSubImage((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i, (GLenum) args[8].u, (GLenum) args[9].u, (GLsizei) args[10].i, (void *) args[11].p); break;
+        case 282: if(glad_glGetTransformFeedbackVarying == NULL) return 0; glad_glGetTransformFeedbackVarying((GLuint) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (GLsizei *) args[3].p, (GLsizei *) args[4].p, (GLenum *) args[5].p, (GLchar *) args[6].p); break;
+        case 283: if(glad_glGetTransformFeedbacki64_v == NULL) return 0; glad_glGetTransformFeedbacki64_v((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLint64 *) args[3].p); break;
+        case 284: if(glad_glGetTransformFeedbacki_v == NULL) return 0; glad_glGetTransformFeedbacki_v((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLint *) args[3].p); break;
+        case 285: if(glad_glGetTransformFeedbackiv == NULL) return 0; glad_glGetTransformFeedbackiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 286: if(glad_glGetUniformBlockIndex == NULL) return 0; { GLuint glad_ret = glad_glGetUniformBlockIndex((GLuint) args[0].u, (const GLchar *) args[1].p); if(result != NULL) result->u = glad_ret; } break;
+        case 287: if(glad_glGetUniformIndices == NULL) return 0; glad_glGetUniformIndices((GLuint) args[0].u, (GLsizei) args[1].i, (const GLchar *const*) args[2].p, (GLuint *) args[3].p); break;
+        case 288: if(glad_glGetUniformLocation == NULL) return 0; { GLint glad_ret = glad_glGetUniformLocation((GLuint) args[0].u, (const GLchar *) args[1].p); if(result != NULL) result->i = glad_ret; } break;
+        case 289: if(glad_glGetUniformSubroutineuiv == NULL) return 0; glad_glGetUniformSubroutineuiv((GLenum) args[0].u, (GLint) args[1].i, (GLuint *) args[2].p); break;
+        case 290: if(glad_glGetUniformdv == NULL) return 0; glad_glGetUniformdv((GLuint) args[0].u, (GLint) args[1].i, (GLdouble *) args[2].p); break;
+        case 291: if(glad_glGetUniformfv == NULL) return 0; glad_glGetUniformfv((GLuint) args[0].u, (GLint) args[1].i, (GLfloat *) args[2].p); break;
+        case 292: if(glad_glGetUniformiv == NULL) return 0; glad_glGetUniformiv((GLuint) args[0].u, (GLint) args[1].i, (GLint *) args[2].p); break;
+        case 293: if(glad_glGetUniformuiv == NULL) return 0; glad_glGetUniformuiv((GLuint) args[0].u, (GLint) args[1].i, (GLuint *) args[2].p); break;
+        case 294: if(glad_glGetVertexArrayIndexed64iv == NULL) return 0; glad_glGetVertexArrayIndexed64iv((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLint64 *) args[3].p); break;
+        case 295: if(glad_glGetVertexArrayIndexediv == NULL) return 0; glad_glGetVertexArrayIndexediv((GLuint) args[0].u, (GLuint) args[1].u, (GLenum) args[2].u, (GLint *) args[3].p); break;
+        case 296: if(glad_glGetVertexArrayiv == NULL) return 0; glad_glGetVertexArrayiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 297: if(glad_glGetVertexAttribIiv == NULL) return 0; glad_glGetVertexAttribIiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 298: if(glad_glGetVertexAttribIuiv == NULL) return 0; glad_glGetVertexAttribIuiv((GLuint) args[0].u, (GLenum) args[1].u, (GLuint *) args[2].p); break;
+        case 299: if(glad_glGetVertexAttribLdv == NULL) return 0; glad_glGetVertexAttribLdv((GLuint) args[0].u, (GLenum) args[1].u, (GLdouble *) args[2].p); break;
+        case 300: if(glad_glGetVertexAttribPointerv == NULL) return 0; glad_glGetVertexAttribPointerv((GLuint) args[0].u, (GLenum) args[1].u, (void **) args[2].p); break;
+        case 301: if(glad_glGetVertexAttribdv == NULL) return 0; glad_glGetVertexAttribdv((GLuint) args[0].u, (GLenum) args[1].u, (GLdouble *) args[2].p); break;
+        case 302: if(glad_glGetVertexAttribfv == NULL) return 0; glad_glGetVertexAttribfv((GLuint) args[0].u, (GLenum) args[1].u, (GLfloat *) args[2].p); break;
+        case 303: if(glad_glGetVertexAttribiv == NULL) return 0; glad_glGetVertexAttribiv((GLuint) args[0].u, (GLenum) args[1].u, (GLint *) args[2].p); break;
+        case 304: if(glad_glGetnCompressedTexImage == NULL) return 0; glad_glGetnCompressedTexImage((GLenum) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (void *) args[3].p); break;
+        case 305: if(glad_glGetnTexImage == NULL) return 0; glad_glGetnTexImage((GLenum) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLenum) args[3].u, (GLsizei) args[4].i, (void *) args[5].p); break;
+        case 306: if(glad_glGetnUniformdv == NULL) return 0; glad_glGetnUniformdv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLdouble *) args[3].p); break;
+        case 307: if(glad_glGetnUniformfv == NULL) return 0; glad_glGetnUniformfv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLfloat *) args[3].p); break;
+        case 308: if(glad_glGetnUniformiv == NULL) return 0; glad_glGetnUniformiv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLint *) args[3].p); break;
+        case 309: if(glad_glGetnUniformuiv == NULL) return 0; glad_glGetnUniformuiv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLuint *) args[3].p); break;
+        case 310: if(glad_glHint == NULL) return 0; glad_glHint((GLenum) args[0].u, (GLenum) args[1].u); break;
+        case 311: if(glad_glInvalidateBufferData == NULL) return 0; glad_glInvalidateBufferData((GLuint) args[0].u); break;
+        case 312: if(glad_glInvalidateBufferSubData == NULL) return 0; glad_glInvalidateBufferSubData((GLuint) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i); break;
+        case 313: if(glad_glInvalidateFramebuffer == NULL) return 0; glad_glInvalidateFramebuffer((GLenum) args[0].u, (GLsizei) args[1].i, (const GLenum *) args[2].p); break;
+        case 314: if(glad_glInvalidateNamedFramebufferData == NULL) return 0; glad_glInvalidateNamedFramebufferData((GLuint) args[0].u, (GLsizei) args[1].i, (const GLenum *) args[2].p); break;
+        case 315: if(glad_glInvalidateNamedFramebufferSubData == NULL) return 0; glad_glInvalidateNamedFramebufferSubData((GLuint) args[0].u, (GLsizei) args[1].i, (const GLenum *) args[2].p, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i); break;
+        case 316: if(glad_glInvalidateSubFramebuffer == NULL) return 0; glad_glInvalidateSubFramebuffer((GLenum) args[0].u, (GLsizei) args[1].i, (const GLenum *) args[2].p, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i); break;
+        case 317: if(glad_glInvalidateTexImage == NULL) return 0; glad_glInvalidateTexImage((GLuint) args[0].u, (GLint) args[1].i); break;
+        case 318: if(glad_glInvalidateTexSubImage == NULL) return 0; glad_glInvalidateTexSubImage((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i); break;
+        case 319: if(glad_glIsBuffer == NULL) return 0; { GLboolean glad_ret = glad_glIsBuffer((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 320: if(glad_glIsEnabled == NULL) return 0; { GLboolean glad_ret = glad_glIsEnabled((GLenum) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 321: if(glad_glIsEnabledi == NULL) return 0; { GLboolean glad_ret = glad_glIsEnabledi((GLenum) args[0].u, (GLuint) args[1].u); if(result != NULL) result->u = glad_ret; } break;
+        case 322: if(glad_glIsFramebuffer == NULL) return 0; { GLboolean glad_ret = glad_glIsFramebuffer((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 323: if(glad_glIsProgram == NULL) return 0; { GLboolean glad_ret = glad_glIsProgram((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 324: if(glad_glIsProgramPipeline == NULL) return 0; { GLboolean glad_ret = glad_glIsProgramPipeline((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 325: if(glad_glIsQuery == NULL) return 0; { GLboolean glad_ret = glad_glIsQuery((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 326: if(glad_glIsRenderbuffer == NULL) return 0; { GLboolean glad_ret = glad_glIsRenderbuffer((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 327: if(glad_glIsSampler == NULL) return 0; { GLboolean glad_ret = glad_glIsSampler((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 328: if(glad_glIsShader == NULL) return 0; { GLboolean glad_ret = glad_glIsShader((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 329: if(glad_glIsSync == NULL) return 0; { GLboolean glad_ret = glad_glIsSync((GLsync) args[0].p); if(result != NULL) result->u = glad_ret; } break;
+        case 330: if(glad_glIsTexture == NULL) return 0; { GLboolean glad_ret = glad_glIsTexture((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 331: if(glad_glIsTransformFeedback == NULL) return 0; { GLboolean glad_ret = glad_glIsTransformFeedback((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 332: if(glad_glIsVertexArray == NULL) return 0; { GLboolean glad_ret = glad_glIsVertexArray((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 333: if(glad_glLineWidth == NULL) return 0; glad_glLineWidth((GLfloat) args[0].f); break;
+        case 334: if(glad_glLinkProgram == NULL) return 0; glad_glLinkProgram((GLuint) args[0].u); break;
+        case 335: if(glad_glLogicOp == NULL) return 0; glad_glLogicOp((GLenum) args[0].u); break;
+        case 336: if(glad_glMapBuffer == NULL) return 0; { void * glad_ret = glad_glMapBuffer((GLenum) args[0].u, (GLenum) args[1].u); if(result != NULL) result->p = (const void *) glad_ret; } break;
+        case 337: if(glad_glMapBufferRange == NULL) return 0; { void * glad_ret = glad_glMapBufferRange((GLenum) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i, (GLbitfield) args[3].u); if(result != NULL) result->p = (const void *) glad_ret; } break;
+        case 338: if(glad_glMapNamedBuffer == NULL) return 0; { void * glad_ret = glad_glMapNamedBuffer((GLuint) args[0].u, (GLenum) args[1].u); if(result != NULL) result->p = (const void *) glad_ret; } break;
+        case 339: if(glad_glMapNamedBufferRange == NULL) return 0; { void * glad_ret = glad_glMapNamedBufferRange((GLuint) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i, (GLbitfield) args[3].u); if(result != NULL) result->p = (const void *) glad_ret; } break;
+        case 340: if(glad_glMemoryBarrier == NULL) return 0; glad_glMemoryBarrier((GLbitfield) args[0].u); break;
+        case 341: if(glad_glMemoryBarrierByRegion == NULL) return 0; glad_glMemoryBarrierByRegion((GLbitfield) args[0].u); break;
+        case 342: if(glad_glMinSampleShading == NULL) return 0; glad_glMinSampleShading((GLfloat) args[0].f); break;
+        case 343: if(glad_glMultiDrawArrays == NULL) return 0; glad_glMultiDrawArrays((GLenum) args[0].u, (const GLint *) args[1].p, (const GLsizei *) args[2].p, (GLsizei) args[3].i); break;
+        case 344: if(glad_glMultiDrawArraysIndirect == NULL) return 0; glad_glMultiDrawArraysIndirect((GLenum) args[0].u, (const void *) args[1].p, (GLsizei) args[2].i, (GLsizei) args[3].i); break;
+        case 345: if(glad_glMultiDrawArraysIndirectCount == NULL) return 0; glad_glMultiDrawArraysIndirectCount((GLenum) args[0].u, (const void *) args[1].p, (GLintptr) args[2].i, (GLsizei) args[3].i, (GLsizei) args[4].i); break;
+        case 346: if(glad_glMultiDrawElements == NULL) return 0; glad_glMultiDrawElements((GLenum) args[0].u, (const GLsizei *) args[1].p, (GLenum) args[2].u, (const void *const*) args[3].p, (GLsizei) args[4].i); break;
+        case 347: if(glad_glMultiDrawElementsBaseVertex == NULL) return 0; glad_glMultiDrawElementsBaseVertex((GLenum) args[0].u, (const GLsizei *) args[1].p, (GLenum) args[2].u, (const void *const*) args[3].p, (GLsizei) args[4].i, (const GLint *) args[5].p); break;
+        case 348: if(glad_glMultiDrawElementsIndirect == NULL) return 0; glad_glMultiDrawElementsIndirect((GLenum) args[0].u, (GLenum) args[1].u, (const void *) args[2].p, (GLsizei) args[3].i, (GLsizei) args[4].i); break;
+        case 349: if(glad_glMultiDrawElementsIndirectCount == NULL) return 0; glad_glMultiDrawElementsIndirectCount((GLenum) args[0].u, (GLenum) args[1].u, (const void *) args[2].p, (GLintptr) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i); break;
+        case 350: if(glad_glNamedBufferData == NULL) return 0; glad_glNamedBufferData((GLuint) args[0].u, (GLsizeiptr) args[1].i, (const void *) args[2].p, (GLenum) args[3].u); break;
+        case 351: if(glad_glNamedBufferStorage == NULL) return 0; glad_glNamedBufferStorage((GLuint) args[0].u, (GLsizeiptr) args[1].i, (const void *) args[2].p, (GLbitfield) args[3].u); break;
+        case 352: if(glad_glNamedBufferSubData == NULL) return 0; glad_glNamedBufferSubData((GLuint) args[0].u, (GLintptr) args[1].i, (GLsizeiptr) args[2].i, (const void *) args[3].p); break;
+        case 353: if(glad_glNamedFramebufferDrawBuffer == NULL) return 0; glad_glNamedFramebufferDrawBuffer((GLuint) args[0].u, (GLenum) args[1].u); break;
+        case 354: if(glad_glNamedFramebufferDrawBuffers == NULL) return 0; glad_glNamedFramebufferDrawBuffers((GLuint) args[0].u, (GLsizei) args[1].i, (const GLenum *) args[2].p); break;
+        case 355: if(glad_glNamedFramebufferParameteri == NULL) return 0; glad_glNamedFramebufferParameteri((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i); break;
+        case 356: if(glad_glNamedFramebufferReadBuffer == NULL) return 0; glad_glNamedFramebufferReadBuffer((GLuint) args[0].u, (GLenum) args[1].u); break;
+        case 357: if(glad_glNamedFramebufferRenderbuffer == NULL) return 0; glad_glNamedFramebufferRenderbuffer((GLuint) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLuint) args[3].u); break;
+        case 358: if(glad_glNamedFramebufferTexture == NULL) return 0; glad_glNamedFramebufferTexture((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLint) args[3].i); break;
+        case 359: if(glad_glNamedFramebufferTextureLayer == NULL) return 0; glad_glNamedFramebufferTextureLayer((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLint) args[3].i, (GLint) args[4].i); break;
+        case 360: if(glad_glNamedRenderbufferStorage == NULL) return 0; glad_glNamedRenderbufferStorage((GLuint) args[0].u, (GLenum) args[1].u, (GLsizei) args[2].i, (GLsizei) args[3].i); break;
+        case 361: if(glad_glNamedRenderbufferStorageMultisample == NULL) return 0; glad_glNamedRenderbufferStorageMultisample((GLuint) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i); break;
+        case 362: if(glad_glObjectLabel == NULL) return 0; glad_glObjectLabel((GLenum) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (const GLchar *) args[3].p); break;
+        case 363: if(glad_glObjectPtrLabel == NULL) return 0; glad_glObjectPtrLabel((const void *) args[0].p, (GLsizei) args[1].i, (const GLchar *) args[2].p); break;
+        case 364: if(glad_glPatchParameterfv == NULL) return 0; glad_glPatchParameterfv((GLenum) args[0].u, (const GLfloat *) args[1].p); break;
+        case 365: if(glad_glPatchParameteri == NULL) return 0; glad_glPatchParameteri((GLenum) args[0].u, (GLint) args[1].i); break;
+        case 366: if(glad_glPauseTransformFeedback == NULL) return 0; glad_glPauseTransformFeedback(); break;
+        case 367: if(glad_glPixelStoref == NULL) return 0; glad_glPixelStoref((GLenum) args[0].u, (GLfloat) args[1].f); break;
+        case 368: if(glad_glPixelStorei == NULL) return 0; glad_glPixelStorei((GLenum) args[0].u, (GLint) args[1].i); break;
+        case 369: if(glad_glPointParameterf == NULL) return 0; glad_glPointParameterf((GLenum) args[0].u, (GLfloat) args[1].f); break;
+        case 370: if(glad_glPointParameterfv == NULL) return 0; glad_glPointParameterfv((GLenum) args[0].u, (const GLfloat *) args[1].p); break;
+        case 371: if(glad_glPointParameteri == NULL) return 0; glad_glPointParameteri((GLenum) args[0].u, (GLint) args[1].i); break;
+        case 372: if(glad_glPointParameteriv == NULL) return 0; glad_glPointParameteriv((GLenum) args[0].u, (const GLint *) args[1].p); break;
+        case 373: if(glad_glPointSize == NULL) return 0; glad_glPointSize((GLfloat) args[0].f); break;
+        case 374: if(glad_glPolygonMode == NULL) return 0; glad_glPolygonMode((GLenum) args[0].u, (GLenum) args[1].u); break;
+        case 375: if(glad_glPolygonOffset == NULL) return 0; glad_glPolygonOffset((GLfloat) args[0].f, (GLfloat) args[1].f); break;
+        case 376: if(glad_glPolygonOffsetClamp == NULL) return 0; glad_glPolygonOffsetClamp((GLfloat) args[0].f, (GLfloat) args[1].f, (GLfloat) args[2].f); break;
+        case 377: if(glad_glPopDebugGroup == NULL) return 0; glad_glPopDebugGroup(); break;
+        case 378: if(glad_glPrimitiveRestartIndex == NULL) return 0; glad_glPrimitiveRestartIndex((GLuint) args[0].u); break;
+        case 379: if(glad_glProgramBinary == NULL) return 0; glad_glProgramBinary((GLuint) args[0].u, (GLenum) args[1].u, (const void *) args[2].p, (GLsizei) args[3].i); break;
+        case 380: if(glad_glProgramParameteri == NULL) return 0; glad_glProgramParameteri((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i); break;
+        case 381: if(glad_glProgramUniform1d == NULL) return 0; glad_glProgramUniform1d((GLuint) args[0].u, (GLint) args[1].i, (GLdouble) args[2].d); break;
+        case 382: if(glad_glProgramUniform1dv == NULL) return 0; glad_glProgramUniform1dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLdouble *) args[3].p); break;
+        case 383: if(glad_glProgramUniform1f == NULL) return 0; glad_glProgramUniform1f((GLuint) args[0].u, (GLint) args[1].i, (GLfloat) args[2].f); break;
+        case 384: if(glad_glProgramUniform1fv == NULL) return 0; glad_glProgramUniform1fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLfloat *) args[3].p); break;
+        case 385: if(glad_glProgramUniform1i == NULL) return 0; glad_glProgramUniform1i((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i); break;
+        case 386: if(glad_glProgramUniform1iv == NULL) return 0; glad_glProgramUniform1iv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLint *) args[3].p); break;
+        case 387: if(glad_glProgramUniform1ui == NULL) return 0; glad_glProgramUniform1ui((GLuint) args[0].u, (GLint) args[1].i, (GLuint) args[2].u); break;
+        case 388: if(glad_glProgramUniform1uiv == NULL) return 0; glad_glProgramUniform1uiv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLuint *) args[3].p); break;
+        case 389: if(glad_glProgramUniform2d == NULL) return 0; glad_glProgramUniform2d((GLuint) args[0].u, (GLint) args[1].i, (GLdouble) args[2].d, (GLdouble) args[3].d); break;
+        case 390: if(glad_glProgramUniform2dv == NULL) return 0; glad_glProgramUniform2dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLdouble *) args[3].p); break;
+        case 391: if(glad_glProgramUniform2f == NULL) return 0; glad_glProgramUniform2f((GLuint) args[0].u, (GLint) args[1].i, (GLfloat) args[2].f, (GLfloat) args[3].f); break;
+        case 392: if(glad_glProgramUniform2fv == NULL) return 0; glad_glProgramUniform2fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLfloat *) args[3].p); break;
+        case 393: if(glad_glProgramUniform2i == NULL) return 0; glad_glProgramUniform2i((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i); break;
+        case 394: if(glad_glProgramUniform2iv == NULL) return 0; glad_glProgramUniform2iv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLint *) args[3].p); break;
+        case 395: if(glad_glProgramUniform2ui == NULL) return 0; glad_glProgramUniform2ui((GLuint) args[0].u, (GLint) args[1].i, (GLuint) args[2].u, (GLuint) args[3].u); break;
+        case 396: if(glad_glProgramUniform2uiv == NULL) return 0; glad_glProgramUniform2uiv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLuint *) args[3].p); break;
+        case 397: if(glad_glProgramUniform3d == NULL) return 0; glad_glProgramUniform3d((GLuint) args[0].u, (GLint) args[1].i, (GLdouble) args[2].d, (GLdouble) args[3].d, (GLdouble) args[4].d); break;
+        case 398: if(glad_glProgramUniform3dv == NULL) return 0; glad_glProgramUniform3dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLdouble *) args[3].p); break;
+        case 399: if(glad_glProgramUniform3f == NULL) return 0; glad_glProgramUniform3f((GLuint) args[0].u, (GLint) args[1].i, (GLfloat) args[2].f, (GLfloat) args[3].f, (GLfloat) args[4].f); break;
+        case 400: if(glad_glProgramUniform3fv == NULL) return 0; glad_glProgramUniform3fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLfloat *) args[3].p); break;
+        case 401: if(glad_glProgramUniform3i == NULL) return 0; glad_glProgramUniform3i((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i); break;
+        case 402: if(glad_glProgramUniform3iv == NULL) return 0; glad_glProgramUniform3iv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLint *) args[3].p); break;
+        case 403: if(glad_glProgramUniform3ui == NULL) return 0; glad_glProgramUniform3ui((GLuint) args[0].u, (GLint) args[1].i, (GLuint) args[2].u, (GLuint) args[3].u, (GLuint) args[4].u); break;
+        case 404: if(glad_glProgramUniform3uiv == NULL) return 0; glad_glProgramUniform3uiv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLuint *) args[3].p); break;
+        case 405: if(glad_glProgramUniform4d == NULL) return 0; glad_glProgramUniform4d((GLuint) args[0].u, (GLint) args[1].i, (GLdouble) args[2].d, (GLdouble) args[3].d, (GLdouble) args[4].d, (GLdouble) args[5].d); break;
+        case 406: if(glad_glProgramUniform4dv == NULL) return 0; glad_glProgramUniform4dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLdouble *) args[3].p); break;
+        case 407: if(glad_glProgramUniform4f == NULL) return 0; glad_glProgramUniform4f((GLuint) args[0].u, (GLint) args[1].i, (GLfloat) args[2].f, (GLfloat) args[3].f, (GLfloat) args[4].f, (GLfloat) args[5].f); break;
+        case 408: if(glad_glProgramUniform4fv == NULL) return 0; glad_glProgramUniform4fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLfloat *) args[3].p); break;
+        case 409: if(glad_glProgramUniform4i == NULL) return 0; glad_glProgramUniform4i((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLint) args[5].i); break;
+        case 410: if(glad_glProgramUniform4iv == NULL) return 0; glad_glProgramUniform4iv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLint *) args[3].p); break;
+        case 411: if(glad_glProgramUniform4ui == NULL) return 0; glad_glProgramUniform4ui((GLuint) args[0].u, (GLint) args[1].i, (GLuint) args[2].u, (GLuint) args[3].u, (GLuint) args[4].u, (GLuint) args[5].u); break;
+        case 412: if(glad_glProgramUniform4uiv == NULL) return 0; glad_glProgramUniform4uiv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (const GLuint *) args[3].p); break;
+        case 413: if(glad_glProgramUniformMatrix2dv == NULL) return 0; glad_glProgramUniformMatrix2dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 414: if(glad_glProgramUniformMatrix2fv == NULL) return 0; glad_glProgramUniformMatrix2fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 415: if(glad_glProgramUniformMatrix2x3dv == NULL) return 0; glad_glProgramUniformMatrix2x3dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 416: if(glad_glProgramUniformMatrix2x3fv == NULL) return 0; glad_glProgramUniformMatrix2x3fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 417: if(glad_glProgramUniformMatrix2x4dv == NULL) return 0; glad_glProgramUniformMatrix2x4dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 418: if(glad_glProgramUniformMatrix2x4fv == NULL) return 0; glad_glProgramUniformMatrix2x4fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 419: if(glad_glProgramUniformMatrix3dv == NULL) return 0; glad_glProgramUniformMatrix3dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 420: if(glad_glProgramUniformMatrix3fv == NULL) return 0; glad_glProgramUniformMatrix3fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 421: if(glad_glProgramUniformMatrix3x2dv == NULL) return 0; glad_glProgramUniformMatrix3x2dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 422: if(glad_glProgramUniformMatrix3x2fv == NULL) return 0; glad_glProgramUniformMatrix3x2fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 423: if(glad_glProgramUniformMatrix3x4dv == NULL) return 0; glad_glProgramUniformMatrix3x4dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 424: if(glad_glProgramUniformMatrix3x4fv == NULL) return 0; glad_glProgramUniformMatrix3x4fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 425: if(glad_glProgramUniformMatrix4dv == NULL) return 0; glad_glProgramUniformMatrix4dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 426: if(glad_glProgramUniformMatrix4fv == NULL) return 0; glad_glProgramUniformMatrix4fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 427: if(glad_glProgramUniformMatrix4x2dv == NULL) return 0; glad_glProgramUniformMatrix4x2dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 428: if(glad_glProgramUniformMatrix4x2fv == NULL) return 0; glad_glProgramUniformMatrix4x2fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 429: if(glad_glProgramUniformMatrix4x3dv == NULL) return 0; glad_glProgramUniformMatrix4x3dv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLdouble *) args[4].p); break;
+        case 430: if(glad_glProgramUniformMatrix4x3fv == NULL) return 0; glad_glProgramUniformMatrix4x3fv((GLuint) args[0].u, (GLint) args[1].i, (GLsizei) args[2].i, (GLboolean) args[3].u, (const GLfloat *) args[4].p); break;
+        case 431: if(glad_glProvokingVertex == NULL) return 0; glad_glProvokingVertex((GLenum) args[0].u); break;
+        case 432: if(glad_glPushDebugGroup == NULL) return 0; glad_glPushDebugGroup((GLenum) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (const GLchar *) args[3].p); break;
+        case 433: if(glad_glQueryCounter == NULL) return 0; glad_glQueryCounter((GLuint) args[0].u, (GLenum) args[1].u); break;
+        case 434: if(glad_glReadBuffer == NULL) return 0; glad_glReadBuffer((GLenum) args[0].u); break;
+        case 435: if(glad_glReadPixels == NULL) return 0; glad_glReadPixels((GLint) args[0].i, (GLint) args[1].i, (GLsizei) args[2].i, (GLsizei) args[3].i, (GLenum) args[4].u, (GLenum) args[5].u, (void *) args[6].p); break;
+        case 436: if(glad_glReadnPixels == NULL) return 0; glad_glReadnPixels((GLint) args[0].i, (GLint) args[1].i, (GLsizei) args[2].i, (GLsizei) args[3].i, (GLenum) args[4].u, (GLenum) args[5].u, (GLsizei) args[6].i, (void *) args[7].p); break;
+        case 437: if(glad_glReleaseShaderCompiler == NULL) return 0; glad_glReleaseShaderCompiler(); break;
+        case 438: if(glad_glRenderbufferStorage == NULL) return 0; glad_glRenderbufferStorage((GLenum) args[0].u, (GLenum) args[1].u, (GLsizei) args[2].i, (GLsizei) args[3].i); break;
+        case 439: if(glad_glRenderbufferStorageMultisample == NULL) return 0; glad_glRenderbufferStorageMultisample((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i); break;
+        case 440: if(glad_glResumeTransformFeedback == NULL) return 0; glad_glResumeTransformFeedback(); break;
+        case 441: if(glad_glSampleCoverage == NULL) return 0; glad_glSampleCoverage((GLfloat) args[0].f, (GLboolean) args[1].u); break;
+        case 442: if(glad_glSampleMaski == NULL) return 0; glad_glSampleMaski((GLuint) args[0].u, (GLbitfield) args[1].u); break;
+        case 443: if(glad_glSamplerParameterIiv == NULL) return 0; glad_glSamplerParameterIiv((GLuint) args[0].u, (GLenum) args[1].u, (const GLint *) args[2].p); break;
+        case 444: if(glad_glSamplerParameterIuiv == NULL) return 0; glad_glSamplerParameterIuiv((GLuint) args[0].u, (GLenum) args[1].u, (const GLuint *) args[2].p); break;
+        case 445: if(glad_glSamplerParameterf == NULL) return 0; glad_glSamplerParameterf((GLuint) args[0].u, (GLenum) args[1].u, (GLfloat) args[2].f); break;
+        case 446: if(glad_glSamplerParameterfv == NULL) return 0; glad_glSamplerParameterfv((GLuint) args[0].u, (GLenum) args[1].u, (const GLfloat *) args[2].p); break;
+        case 447: if(glad_glSamplerParameteri == NULL) return 0; glad_glSamplerParameteri((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i); break;
+        case 448: if(glad_glSamplerParameteriv == NULL) return 0; glad_glSamplerParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (const GLint *) args[2].p); break;
+        case 449: if(glad_glScissor == NULL) return 0; glad_glScissor((GLint) args[0].i, (GLint) args[1].i, (GLsizei) args[2].i, (GLsizei) args[3].i); break;
+        case 450: if(glad_glScissorArrayv == NULL) return 0; glad_glScissorArrayv((GLuint) args[0].u, (GLsizei) args[1].i, (const GLint *) args[2].p); break;
+        case 451: if(glad_glScissorIndexed == NULL) return 0; glad_glScissorIndexed((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLsizei) args[4].i); break;
+        case 452: if(glad_glScissorIndexedv == NULL) return 0; glad_glScissorIndexedv((GLuint) args[0].u, (const GLint *) args[1].p); break;
+        case 453: if(glad_glShaderBinary == NULL) return 0; glad_glShaderBinary((GLsizei) args[0].i, (const GLuint *) args[1].p, (GLenum) args[2].u, (const void *) args[3].p, (GLsizei) args[4].i); break;
+        case 454: if(glad_glShaderSource == NULL) return 0; glad_glShaderSource((GLuint) args[0].u, (GLsizei) args[1].i, (const GLchar *const*) args[2].p, (const GLint *) args[3].p); break;
+        case 455: if(glad_glShaderStorageBlockBinding == NULL) return 0; glad_glShaderStorageBlockBinding((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 456: if(glad_glSpecializeShader == NULL) return 0; glad_glSpecializeShader((GLuint) args[0].u, (const GLchar *) args[1].p, (GLuint) args[2].u, (const GLuint *) args[3].p, (const GLuint *) args[4].p); break;
+        case 457: if(glad_glStencilFunc == NULL) return 0; glad_glStencilFunc((GLenum) args[0].u, (GLint) args[1].i, (GLuint) args[2].u); break;
+        case 458: if(glad_glStencilFuncSeparate == NULL) return 0; glad_glStencilFuncSeparate((GLenum) args[0].u, (GLenum) args[1].u, (GLint) args[2].i, (GLuint) args[3].u); break;
+        case 459: if(glad_glStencilMask == NULL) return 0; glad_glStencilMask((GLuint) args[0].u); break;
+        case 460: if(glad_glStencilMaskSeparate == NULL) return 0; glad_glStencilMaskSeparate((GLenum) args[0].u, (GLuint) args[1].u); break;
+        case 461: if(glad_glStencilOp == NULL) return 0; glad_glStencilOp((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u); break;
+        case 462: if(glad_glStencilOpSeparate == NULL) return 0; glad_glStencilOpSeparate((GLenum) args[0].u, (GLenum) args[1].u, (GLenum) args[2].u, (GLenum) args[3].u); break;
+        case 463: if(glad_glTexBuffer == NULL) return 0; glad_glTexBuffer((GLenum) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u); break;
+        case 464: if(glad_glTexBufferRange == NULL) return 0; glad_glTexBufferRange((GLenum) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLintptr) args[3].i, (GLsizeiptr) args[4].i); break;
+        case 465: if(glad_glTexImage1D == NULL) return 0; glad_glTexImage1D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLint) args[4].i, (GLenum) args[5].u, (GLenum) args[6].u, (const void *) args[7].p); break;
+        case 466: if(glad_glTexImage2D == NULL) return 0; glad_glTexImage2D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLint) args[5].i, (GLenum) args[6].u, (GLenum) args[7].u, (const void *) args[8].p); break;
+        case 467: if(glad_glTexImage2DMultisample == NULL) return 0; glad_glTexImage2DMultisample((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLboolean) args[5].u); break;
+        case 468: if(glad_glTexImage3D == NULL) return 0; glad_glTexImage3D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLint) args[6].i, (GLenum) args[7].u, (GLenum) args[8].u, (const void *) args[9].p); break;
+        case 469: if(glad_glTexImage3DMultisample == NULL) return 0; glad_glTexImage3DMultisample((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLboolean) args[6].u); break;
+        case 470: if(glad_glTexParameterIiv == NULL) return 0; glad_glTexParameterIiv((GLenum) args[0].u, (GLenum) args[1].u, (const GLint *) args[2].p); break;
+        case 471: if(glad_glTexParameterIuiv == NULL) return 0; glad_glTexParameterIuiv((GLenum) args[0].u, (GLenum) args[1].u, (const GLuint *) args[2].p); break;
+        case 472: if(glad_glTexParameterf == NULL) return 0; glad_glTexParameterf((GLenum) args[0].u, (GLenum) args[1].u, (GLfloat) args[2].f); break;
+        case 473: if(glad_glTexParameterfv == NULL) return 0; glad_glTexParameterfv((GLenum) args[0].u, (GLenum) args[1].u, (const GLfloat *) args[2].p); break;
+        case 474: if(glad_glTexParameteri == NULL) return 0; glad_glTexParameteri((GLenum) args[0].u, (GLenum) args[1].u, (GLint) args[2].i); break;
+        case 475: if(glad_glTexParameteriv == NULL) return 0; glad_glTexParameteriv((GLenum) args[0].u, (GLenum) args[1].u, (const GLint *) args[2].p); break;
+        case 476: if(glad_glTexStorage1D == NULL) return 0; glad_glTexStorage1D((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i); break;
+        case 477: if(glad_glTexStorage2D == NULL) return 0; glad_glTexStorage2D((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i); break;
+        case 478: if(glad_glTexStorage2DMultisample == NULL) return 0; glad_glTexStorage2DMultisample((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLboolean) args[5].u); break;
+        case 479: if(glad_glTexStorage3D == NULL) return 0; glad_glTexStorage3D((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i); break;
+        case 480: if(glad_glTexStorage3DMultisample == NULL) return 0; glad_glTexStorage3DMultisample((GLenum) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLboolean) args[6].u); break;
+        case 481: if(glad_glTexSubImage1D == NULL) return 0; glad_glTexSubImage1D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLenum) args[4].u, (GLenum) args[5].u, (const void *) args[6].p); break;
+        case 482: if(glad_glTexSubImage2D == NULL) return 0; glad_glTexSubImage2D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLenum) args[6].u, (GLenum) args[7].u, (const void *) args[8].p); break;
+        case 483: if(glad_glTexSubImage3D == NULL) return 0; glad_glTexSubImage3D((GLenum) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i, (GLenum) args[8].u, (GLenum) args[9].u, (const void *) args[10].p); break;
+        case 484: if(glad_glTextureBarrier == NULL) return 0; glad_glTextureBarrier(); break;
+        case 485: if(glad_glTextureBuffer == NULL) return 0; glad_glTextureBuffer((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u); break;
+        case 486: if(glad_glTextureBufferRange == NULL) return 0; glad_glTextureBufferRange((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLintptr) args[3].i, (GLsizeiptr) args[4].i); break;
+        case 487: if(glad_glTextureParameterIiv == NULL) return 0; glad_glTextureParameterIiv((GLuint) args[0].u, (GLenum) args[1].u, (const GLint *) args[2].p); break;
+        case 488: if(glad_glTextureParameterIuiv == NULL) return 0; glad_glTextureParameterIuiv((GLuint) args[0].u, (GLenum) args[1].u, (const GLuint *) args[2].p); break;
+        case 489: if(glad_glTextureParameterf == NULL) return 0; glad_glTextureParameterf((GLuint) args[0].u, (GLenum) args[1].u, (GLfloat) args[2].f); break;
+        case 490: if(glad_glTextureParameterfv == NULL) return 0; glad_glTextureParameterfv((GLuint) args[0].u, (GLenum) args[1].u, (const GLfloat *) args[2].p); break;
+        case 491: if(glad_glTextureParameteri == NULL) return 0; glad_glTextureParameteri((GLuint) args[0].u, (GLenum) args[1].u, (GLint) args[2].i); break;
+        case 492: if(glad_glTextureParameteriv == NULL) return 0; glad_glTextureParameteriv((GLuint) args[0].u, (GLenum) args[1].u, (const GLint *) args[2].p); break;
+        case 493: if(glad_glTextureStorage1D == NULL) return 0; glad_glTextureStorage1D((GLuint) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i); break;
+        case 494: if(glad_glTextureStorage2D == NULL) return 0; glad_glTextureStorage2D((GLuint) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i); break;
+        case 495: if(glad_glTextureStorage2DMultisample == NULL) return 0; glad_glTextureStorage2DMultisample((GLuint) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLboolean) args[5].u); break;
+        case 496: if(glad_glTextureStorage3D == NULL) return 0; glad_glTextureStorage3D((GLuint) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i); break;
+        case 497: if(glad_glTextureStorage3DMultisample == NULL) return 0; glad_glTextureStorage3DMultisample((GLuint) args[0].u, (GLsizei) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLboolean) args[6].u); break;
+        case 498: if(glad_glTextureSubImage1D == NULL) return 0; glad_glTextureSubImage1D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLsizei) args[3].i, (GLenum) args[4].u, (GLenum) args[5].u, (const void *) args[6].p); break;
+        case 499: if(glad_glTextureSubImage2D == NULL) return 0; glad_glTextureSubImage2D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLsizei) args[4].i, (GLsizei) args[5].i, (GLenum) args[6].u, (GLenum) args[7].u, (const void *) args[8].p); break;
+        case 500: if(glad_glTextureSubImage3D == NULL) return 0; glad_glTextureSubImage3D((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i, (GLsizei) args[5].i, (GLsizei) args[6].i, (GLsizei) args[7].i, (GLenum) args[8].u, (GLenum) args[9].u, (const void *) args[10].p); break;
+        case 501: if(glad_glTextureView == NULL) return 0; glad_glTextureView((GLuint) args[0].u, (GLenum) args[1].u, (GLuint) args[2].u, (GLenum) args[3].u, (GLuint) args[4].u, (GLuint) args[5].u, (GLuint) args[6].u, (GLuint) args[7].u); break;
+        case 502: if(glad_glTransformFeedbackBufferBase == NULL) return 0; glad_glTransformFeedbackBufferBase((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 503: if(glad_glTransformFeedbackBufferRange == NULL) return 0; glad_glTransformFeedbackBufferRange((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLintptr) args[3].i, (GLsizeiptr) args[4].i); break;
+        case 504: if(glad_glTransformFeedbackVaryings == NULL) return 0; glad_glTransformFeedbackVaryings((GLuint) args[0].u, (GLsizei) args[1].i, (const GLchar *const*) args[2].p, (GLenum) args[3].u); break;
+        case 505: if(glad_glUniform1d == NULL) return 0; glad_glUniform1d((GLint) args[0].i, (GLdouble) args[1].d); break;
+        case 506: if(glad_glUniform1dv == NULL) return 0; glad_glUniform1dv((GLint) args[0].i, (GLsizei) args[1].i, (const GLdouble *) args[2].p); break;
+        case 507: if(glad_glUniform1f == NULL) return 0; glad_glUniform1f((GLint) args[0].i, (GLfloat) args[1].f); break;
+        case 508: if(glad_glUniform1fv == NULL) return 0; glad_glUniform1fv((GLint) args[0].i, (GLsizei) args[1].i, (const GLfloat *) args[2].p); break;
+        case 509: if(glad_glUniform1i == NULL) return 0; glad_glUniform1i((GLint) args[0].i, (GLint) args[1].i); break;
+        case 510: if(glad_glUniform1iv == NULL) return 0; glad_glUniform1iv((GLint) args[0].i, (GLsizei) args[1].i, (const GLint *) args[2].p); break;
+        case 511: if(glad_glUniform1ui == NULL) return 0; glad_glUniform1ui((GLint) args[0].i, (GLuint) args[1].u); break;
+        case 512: if(glad_glUniform1uiv == NULL) return 0; glad_glUniform1uiv((GLint) args[0].i, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 513: if(glad_glUniform2d == NULL) return 0; glad_glUniform2d((GLint) args[0].i, (GLdouble) args[1].d, (GLdouble) args[2].d); break;
+        case 514: if(glad_glUniform2dv == NULL) return 0; glad_glUniform2dv((GLint) args[0].i, (GLsizei) args[1].i, (const GLdouble *) args[2].p); break;
+        case 515: if(glad_glUniform2f == NULL) return 0; glad_glUniform2f((GLint) args[0].i, (GLfloat) args[1].f, (GLfloat) args[2].f); break;
+        case 516: if(glad_glUniform2fv == NULL) return 0; glad_glUniform2fv((GLint) args[0].i, (GLsizei) args[1].i, (const GLfloat *) args[2].p); break;
+        case 517: if(glad_glUniform2i == NULL) return 0; glad_glUniform2i((GLint) args[0].i, (GLint) args[1].i, (GLint) args[2].i); break;
+        case 518: if(glad_glUniform2iv == NULL) return 0; glad_glUniform2iv((GLint) args[0].i, (GLsizei) args[1].i, (const GLint *) args[2].p); break;
+        case 519: if(glad_glUniform2ui == NULL) return 0; glad_glUniform2ui((GLint) args[0].i, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 520: if(glad_glUniform2uiv == NULL) return 0; glad_glUniform2uiv((GLint) args[0].i, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 521: if(glad_glUniform3d == NULL) return 0; glad_glUniform3d((GLint) args[0].i, (GLdouble) args[1].d, (GLdouble) args[2].d, (GLdouble) args[3].d); break;
+        case 522: if(glad_glUniform3dv == NULL) return 0; glad_glUniform3dv((GLint) args[0].i, (GLsizei) args[1].i, (const GLdouble *) args[2].p); break;
+        case 523: if(glad_glUniform3f == NULL) return 0; glad_glUniform3f((GLint) args[0].i, (GLfloat) args[1].f, (GLfloat) args[2].f, (GLfloat) args[3].f); break;
+        case 524: if(glad_glUniform3fv == NULL) return 0; glad_glUniform3fv((GLint) args[0].i, (GLsizei) args[1].i, (const GLfloat *) args[2].p); break;
+        case 525: if(glad_glUniform3i == NULL) return 0; glad_glUniform3i((GLint) args[0].i, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i); break;
+        case 526: if(glad_glUniform3iv == NULL) return 0; glad_glUniform3iv((GLint) args[0].i, (GLsizei) args[1].i, (const GLint *) args[2].p); break;
+        case 527: if(glad_glUniform3ui == NULL) return 0; glad_glUniform3ui((GLint) args[0].i, (GLuint) args[1].u, (GLuint) args[2].u, (GLuint) args[3].u); break;
+        case 528: if(glad_glUniform3uiv == NULL) return 0; glad_glUniform3uiv((GLint) args[0].i, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 529: if(glad_glUniform4d == NULL) return 0; glad_glUniform4d((GLint) args[0].i, (GLdouble) args[1].d, (GLdouble) args[2].d, (GLdouble) args[3].d, (GLdouble) args[4].d); break;
+        case 530: if(glad_glUniform4dv == NULL) return 0; glad_glUniform4dv((GLint) args[0].i, (GLsizei) args[1].i, (const GLdouble *) args[2].p); break;
+        case 531: if(glad_glUniform4f == NULL) return 0; glad_glUniform4f((GLint) args[0].i, (GLfloat) args[1].f, (GLfloat) args[2].f, (GLfloat) args[3].f, (GLfloat) args[4].f); break;
+        case 532: if(glad_glUniform4fv == NULL) return 0; glad_glUniform4fv((GLint) args[0].i, (GLsizei) args[1].i, (const GLfloat *) args[2].p); break;
+        case 533: if(glad_glUniform4i == NULL) return 0; glad_glUniform4i((GLint) args[0].i, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i); break;
+        case 534: if(glad_glUniform4iv == NULL) return 0; glad_glUniform4iv((GLint) args[0].i, (GLsizei) args[1].i, (const GLint *) args[2].p); break;
+        case 535: if(glad_glUniform4ui == NULL) return 0; glad_glUniform4ui((GLint) args[0].i, (GLuint) args[1].u, (GLuint) args[2].u, (GLuint) args[3].u, (GLuint) args[4].u); break;
+        case 536: if(glad_glUniform4uiv == NULL) return 0; glad_glUniform4uiv((GLint) args[0].i, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 537: if(glad_glUniformBlockBinding == NULL) return 0; glad_glUniformBlockBinding((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 538: if(glad_glUniformMatrix2dv == NULL) return 0; glad_glUniformMatrix2dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 539: if(glad_glUniformMatrix2fv == NULL) return 0; glad_glUniformMatrix2fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 540: if(glad_glUniformMatrix2x3dv == NULL) return 0; glad_glUniformMatrix2x3dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 541: if(glad_glUniformMatrix2x3fv == NULL) return 0; glad_glUniformMatrix2x3fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 542: if(glad_glUniformMatrix2x4dv == NULL) return 0; glad_glUniformMatrix2x4dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 543: if(glad_glUniformMatrix2x4fv == NULL) return 0; glad_glUniformMatrix2x4fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 544: if(glad_glUniformMatrix3dv == NULL) return 0; glad_glUniformMatrix3dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 545: if(glad_glUniformMatrix3fv == NULL) return 0; glad_glUniformMatrix3fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 546: if(glad_glUniformMatrix3x2dv == NULL) return 0; glad_glUniformMatrix3x2dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 547: if(glad_glUniformMatrix3x2fv == NULL) return 0; glad_glUniformMatrix3x2fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 548: if(glad_glUniformMatrix3x4dv == NULL) return 0; glad_glUniformMatrix3x4dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 549: if(glad_glUniformMatrix3x4fv == NULL) return 0; glad_glUniformMatrix3x4fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 550: if(glad_glUniformMatrix4dv == NULL) return 0; glad_glUniformMatrix4dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 551: if(glad_glUniformMatrix4fv == NULL) return 0; glad_glUniformMatrix4fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 552: if(glad_glUniformMatrix4x2dv == NULL) return 0; glad_glUniformMatrix4x2dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 553: if(glad_glUniformMatrix4x2fv == NULL) return 0; glad_glUniformMatrix4x2fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 554: if(glad_glUniformMatrix4x3dv == NULL) return 0; glad_glUniformMatrix4x3dv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLdouble *) args[3].p); break;
+        case 555: if(glad_glUniformMatrix4x3fv == NULL) return 0; glad_glUniformMatrix4x3fv((GLint) args[0].i, (GLsizei) args[1].i, (GLboolean) args[2].u, (const GLfloat *) args[3].p); break;
+        case 556: if(glad_glUniformSubroutinesuiv == NULL) return 0; glad_glUniformSubroutinesuiv((GLenum) args[0].u, (GLsizei) args[1].i, (const GLuint *) args[2].p); break;
+        case 557: if(glad_glUnmapBuffer == NULL) return 0; { GLboolean glad_ret = glad_glUnmapBuffer((GLenum) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 558: if(glad_glUnmapNamedBuffer == NULL) return 0; { GLboolean glad_ret = glad_glUnmapNamedBuffer((GLuint) args[0].u); if(result != NULL) result->u = glad_ret; } break;
+        case 559: if(glad_glUseProgram == NULL) return 0; glad_glUseProgram((GLuint) args[0].u); break;
+        case 560: if(glad_glUseProgramStages == NULL) return 0; glad_glUseProgramStages((GLuint) args[0].u, (GLbitfield) args[1].u, (GLuint) args[2].u); break;
+        case 561: if(glad_glValidateProgram == NULL) return 0; glad_glValidateProgram((GLuint) args[0].u); break;
+        case 562: if(glad_glValidateProgramPipeline == NULL) return 0; glad_glValidateProgramPipeline((GLuint) args[0].u); break;
+        case 563: if(glad_glVertexArrayAttribBinding == NULL) return 0; glad_glVertexArrayAttribBinding((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 564: if(glad_glVertexArrayAttribFormat == NULL) return 0; glad_glVertexArrayAttribFormat((GLuint) args[0].u, (GLuint) args[1].u, (GLint) args[2].i, (GLenum) args[3].u, (GLboolean) args[4].u, (GLuint) args[5].u); break;
+        case 565: if(glad_glVertexArrayAttribIFormat == NULL) return 0; glad_glVertexArrayAttribIFormat((GLuint) args[0].u, (GLuint) args[1].u, (GLint) args[2].i, (GLenum) args[3].u, (GLuint) args[4].u); break;
+        case 566: if(glad_glVertexArrayAttribLFormat == NULL) return 0; glad_glVertexArrayAttribLFormat((GLuint) args[0].u, (GLuint) args[1].u, (GLint) args[2].i, (GLenum) args[3].u, (GLuint) args[4].u); break;
+        case 567: if(glad_glVertexArrayBindingDivisor == NULL) return 0; glad_glVertexArrayBindingDivisor((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 568: if(glad_glVertexArrayElementBuffer == NULL) return 0; glad_glVertexArrayElementBuffer((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 569: if(glad_glVertexArrayVertexBuffer == NULL) return 0; glad_glVertexArrayVertexBuffer((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLintptr) args[3].i, (GLsizei) args[4].i); break;
+        case 570: if(glad_glVertexArrayVertexBuffers == NULL) return 0; glad_glVertexArrayVertexBuffers((GLuint) args[0].u, (GLuint) args[1].u, (GLsizei) args[2].i, (const GLuint *) args[3].p, (const GLintptr *) args[4].p, (const GLsizei *) args[5].p); break;
+        case 571: if(glad_glVertexAttrib1d == NULL) return 0; glad_glVertexAttrib1d((GLuint) args[0].u, (GLdouble) args[1].d); break;
+        case 572: if(glad_glVertexAttrib1dv == NULL) return 0; glad_glVertexAttrib1dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 573: if(glad_glVertexAttrib1f == NULL) return 0; glad_glVertexAttrib1f((GLuint) args[0].u, (GLfloat) args[1].f); break;
+        case 574: if(glad_glVertexAttrib1fv == NULL) return 0; glad_glVertexAttrib1fv((GLuint) args[0].u, (const GLfloat *) args[1].p); break;
+        case 575: if(glad_glVertexAttrib1s == NULL) return 0; glad_glVertexAttrib1s((GLuint) args[0].u, (GLshort) args[1].i); break;
+        case 576: if(glad_glVertexAttrib1sv == NULL) return 0; glad_glVertexAttrib1sv((GLuint) args[0].u, (const GLshort *) args[1].p); break;
+        case 577: if(glad_glVertexAttrib2d == NULL) return 0; glad_glVertexAttrib2d((GLuint) args[0].u, (GLdouble) args[1].d, (GLdouble) args[2].d); break;
+        case 578: if(glad_glVertexAttrib2dv == NULL) return 0; glad_glVertexAttrib2dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 579: if(glad_glVertexAttrib2f == NULL) return 0; glad_glVertexAttrib2f((GLuint) args[0].u, (GLfloat) args[1].f, (GLfloat) args[2].f); break;
+        case 580: if(glad_glVertexAttrib2fv == NULL) return 0; glad_glVertexAttrib2fv((GLuint) args[0].u, (const GLfloat *) args[1].p); break;
+        case 581: if(glad_glVertexAttrib2s == NULL) return 0; glad_glVertexAttrib2s((GLuint) args[0].u, (GLshort) args[1].i, (GLshort) args[2].i); break;
+        case 582: if(glad_glVertexAttrib2sv == NULL) return 0; glad_glVertexAttrib2sv((GLuint) args[0].u, (const GLshort *) args[1].p); break;
+        case 583: if(glad_glVertexAttrib3d == NULL) return 0; glad_glVertexAttrib3d((GLuint) args[0].u, (GLdouble) args[1].d, (GLdouble) args[2].d, (GLdouble) args[3].d); break;
+        case 584: if(glad_glVertexAttrib3dv == NULL) return 0; glad_glVertexAttrib3dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 585: if(glad_glVertexAttrib3f == NULL) return 0; glad_glVertexAttrib3f((GLuint) args[0].u, (GLfloat) args[1].f, (GLfloat) args[2].f, (GLfloat) args[3].f); break;
+        case 586: if(glad_glVertexAttrib3fv == NULL) return 0; glad_glVertexAttrib3fv((GLuint) args[0].u, (const GLfloat *) args[1].p); break;
+        case 587: if(glad_glVertexAttrib3s == NULL) return 0; glad_glVertexAttrib3s((GLuint) args[0].u, (GLshort) args[1].i, (GLshort) args[2].i, (GLshort) args[3].i); break;
+        case 588: if(glad_glVertexAttrib3sv == NULL) return 0; glad_glVertexAttrib3sv((GLuint) args[0].u, (const GLshort *) args[1].p); break;
+        case 589: if(glad_glVertexAttrib4Nbv == NULL) return 0; glad_glVertexAttrib4Nbv((GLuint) args[0].u, (const GLbyte *) args[1].p); break;
+        case 590: if(glad_glVertexAttrib4Niv == NULL) return 0; glad_glVertexAttrib4Niv((GLuint) args[0].u, (const GLint *) args[1].p); break;
+        case 591: if(glad_glVertexAttrib4Nsv == NULL) return 0; glad_glVertexAttrib4Nsv((GLuint) args[0].u, (const GLshort *) args[1].p); break;
+        case 592: if(glad_glVertexAttrib4Nub == NULL) return 0; glad_glVertexAttrib4Nub((GLuint) args[0].u, (GLubyte) args[1].u, (GLubyte) args[2].u, (GLubyte) args[3].u, (GLubyte) args[4].u); break;
+        case 593: if(glad_glVertexAttrib4Nubv == NULL) return 0; glad_glVertexAttrib4Nubv((GLuint) args[0].u, (const GLubyte *) args[1].p); break;
+        case 594: if(glad_glVertexAttrib4Nuiv == NULL) return 0; glad_glVertexAttrib4Nuiv((GLuint) args[0].u, (const GLuint *) args[1].p); break;
+        case 595: if(glad_glVertexAttrib4Nusv == NULL) return 0; glad_glVertexAttrib4Nusv((GLuint) args[0].u, (const GLushort *) args[1].p); break;
+        case 596: if(glad_glVertexAttrib4bv == NULL) return 0; glad_glVertexAttrib4bv((GLuint) args[0].u, (const GLbyte *) args[1].p); break;
+        case 597: if(glad_glVertexAttrib4d == NULL) return 0; glad_glVertexAttrib4d((GLuint) args[0].u, (GLdouble) args[1].d, (GLdouble) args[2].d, (GLdouble) args[3].d, (GLdouble) args[4].d); break;
+        case 598: if(glad_glVertexAttrib4dv == NULL) return 0; glad_glVertexAttrib4dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 599: if(glad_glVertexAttrib4f == NULL) return 0; glad_glVertexAttrib4f((GLuint) args[0].u, (GLfloat) args[1].f, (GLfloat) args[2].f, (GLfloat) args[3].f, (GLfloat) args[4].f); break;
+        case 600: if(glad_glVertexAttrib4fv == NULL) return 0; glad_glVertexAttrib4fv((GLuint) args[0].u, (const GLfloat *) args[1].p); break;
+        case 601: if(glad_glVertexAttrib4iv == NULL) return 0; glad_glVertexAttrib4iv((GLuint) args[0].u, (const GLint *) args[1].p); break;
+        case 602: if(glad_glVertexAttrib4s == NULL) return 0; glad_glVertexAttrib4s((GLuint) args[0].u, (GLshort) args[1].i, (GLshort) args[2].i, (GLshort) args[3].i, (GLshort) args[4].i); break;
+        case 603: if(glad_glVertexAttrib4sv == NULL) return 0; glad_glVertexAttrib4sv((GLuint) args[0].u, (const GLshort *) args[1].p); break;
+        case 604: if(glad_glVertexAttrib4ubv == NULL) return 0; glad_glVertexAttrib4ubv((GLuint) args[0].u, (const GLubyte *) args[1].p); break;
+        case 605: if(glad_glVertexAttrib4uiv == NULL) return 0; glad_glVertexAttrib4uiv((GLuint) args[0].u, (const GLuint *) args[1].p); break;
+        case 606: if(glad_glVertexAttrib4usv == NULL) return 0; glad_glVertexAttrib4usv((GLuint) args[0].u, (const GLushort *) args[1].p); break;
+        case 607: if(glad_glVertexAttribBinding == NULL) return 0; glad_glVertexAttribBinding((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 608: if(glad_glVertexAttribDivisor == NULL) return 0; glad_glVertexAttribDivisor((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 609: if(glad_glVertexAttribFormat == NULL) return 0; glad_glVertexAttribFormat((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLboolean) args[3].u, (GLuint) args[4].u); break;
+        case 610: if(glad_glVertexAttribI1i == NULL) return 0; glad_glVertexAttribI1i((GLuint) args[0].u, (GLint) args[1].i); break;
+        case 611: if(glad_glVertexAttribI1iv == NULL) return 0; glad_glVertexAttribI1iv((GLuint) args[0].u, (const GLint *) args[1].p); break;
+        case 612: if(glad_glVertexAttribI1ui == NULL) return 0; glad_glVertexAttribI1ui((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 613: if(glad_glVertexAttribI1uiv == NULL) return 0; glad_glVertexAttribI1uiv((GLuint) args[0].u, (const GLuint *) args[1].p); break;
+        case 614: if(glad_glVertexAttribI2i == NULL) return 0; glad_glVertexAttribI2i((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i); break;
+        case 615: if(glad_glVertexAttribI2iv == NULL) return 0; glad_glVertexAttribI2iv((GLuint) args[0].u, (const GLint *) args[1].p); break;
+        case 616: if(glad_glVertexAttribI2ui == NULL) return 0; glad_glVertexAttribI2ui((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u); break;
+        case 617: if(glad_glVertexAttribI2uiv == NULL) return 0; glad_glVertexAttribI2uiv((GLuint) args[0].u, (const GLuint *) args[1].p); break;
+        case 618: if(glad_glVertexAttribI3i == NULL) return 0; glad_glVertexAttribI3i((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i); break;
+        case 619: if(glad_glVertexAttribI3iv == NULL) return 0; glad_glVertexAttribI3iv((GLuint) args[0].u, (const GLint *) args[1].p); break;
+        case 620: if(glad_glVertexAttribI3ui == NULL) return 0; glad_glVertexAttribI3ui((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLuint) args[3].u); break;
+        case 621: if(glad_glVertexAttribI3uiv == NULL) return 0; glad_glVertexAttribI3uiv((GLuint) args[0].u, (const GLuint *) args[1].p); break;
+        case 622: if(glad_glVertexAttribI4bv == NULL) return 0; glad_glVertexAttribI4bv((GLuint) args[0].u, (const GLbyte *) args[1].p); break;
+        case 623: if(glad_glVertexAttribI4i == NULL) return 0; glad_glVertexAttribI4i((GLuint) args[0].u, (GLint) args[1].i, (GLint) args[2].i, (GLint) args[3].i, (GLint) args[4].i); break;
+        case 624: if(glad_glVertexAttribI4iv == NULL) return 0; glad_glVertexAttribI4iv((GLuint) args[0].u, (const GLint *) args[1].p); break;
+        case 625: if(glad_glVertexAttribI4sv == NULL) return 0; glad_glVertexAttribI4sv((GLuint) args[0].u, (const GLshort *) args[1].p); break;
+        case 626: if(glad_glVertexAttribI4ubv == NULL) return 0; glad_glVertexAttribI4ubv((GLuint) args[0].u, (const GLubyte *) args[1].p); break;
+        case 627: if(glad_glVertexAttribI4ui == NULL) return 0; glad_glVertexAttribI4ui((GLuint) args[0].u, (GLuint) args[1].u, (GLuint) args[2].u, (GLuint) args[3].u, (GLuint) args[4].u); break;
+        case 628: if(glad_glVertexAttribI4uiv == NULL) return 0; glad_glVertexAttribI4uiv((GLuint) args[0].u, (const GLuint *) args[1].p); break;
+        case 629: if(glad_glVertexAttribI4usv == NULL) return 0; glad_glVertexAttribI4usv((GLuint) args[0].u, (const GLushort *) args[1].p); break;
+        case 630: if(glad_glVertexAttribIFormat == NULL) return 0; glad_glVertexAttribIFormat((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLuint) args[3].u); break;
+        case 631: if(glad_glVertexAttribIPointer == NULL) return 0; glad_glVertexAttribIPointer((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (const void *) args[4].p); break;
+        case 632: if(glad_glVertexAttribL1d == NULL) return 0; glad_glVertexAttribL1d((GLuint) args[0].u, (GLdouble) args[1].d); break;
+        case 633: if(glad_glVertexAttribL1dv == NULL) return 0; glad_glVertexAttribL1dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 634: if(glad_glVertexAttribL2d == NULL) return 0; glad_glVertexAttribL2d((GLuint) args[0].u, (GLdouble) args[1].d, (GLdouble) args[2].d); break;
+        case 635: if(glad_glVertexAttribL2dv == NULL) return 0; glad_glVertexAttribL2dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 636: if(glad_glVertexAttribL3d == NULL) return 0; glad_glVertexAttribL3d((GLuint) args[0].u, (GLdouble) args[1].d, (GLdouble) args[2].d, (GLdouble) args[3].d); break;
+        case 637: if(glad_glVertexAttribL3dv == NULL) return 0; glad_glVertexAttribL3dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 638: if(glad_glVertexAttribL4d == NULL) return 0; glad_glVertexAttribL4d((GLuint) args[0].u, (GLdouble) args[1].d, (GLdouble) args[2].d, (GLdouble) args[3].d, (GLdouble) args[4].d); break;
+        case 639: if(glad_glVertexAttribL4dv == NULL) return 0; glad_glVertexAttribL4dv((GLuint) args[0].u, (const GLdouble *) args[1].p); break;
+        case 640: if(glad_glVertexAttribLFormat == NULL) return 0; glad_glVertexAttribLFormat((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLuint) args[3].u); break;
+        case 641: if(glad_glVertexAttribLPointer == NULL) return 0; glad_glVertexAttribLPointer((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLsizei) args[3].i, (const void *) args[4].p); break;
+        case 642: if(glad_glVertexAttribP1ui == NULL) return 0; glad_glVertexAttribP1ui((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (GLuint) args[3].u); break;
+        case 643: if(glad_glVertexAttribP1uiv == NULL) return 0; glad_glVertexAttribP1uiv((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (const GLuint *) args[3].p); break;
+        case 644: if(glad_glVertexAttribP2ui == NULL) return 0; glad_glVertexAttribP2ui((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (GLuint) args[3].u); break;
+        case 645: if(glad_glVertexAttribP2uiv == NULL) return 0; glad_glVertexAttribP2uiv((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (const GLuint *) args[3].p); break;
+        case 646: if(glad_glVertexAttribP3ui == NULL) return 0; glad_glVertexAttribP3ui((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (GLuint) args[3].u); break;
+        case 647: if(glad_glVertexAttribP3uiv == NULL) return 0; glad_glVertexAttribP3uiv((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (const GLuint *) args[3].p); break;
+        case 648: if(glad_glVertexAttribP4ui == NULL) return 0; glad_glVertexAttribP4ui((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (GLuint) args[3].u); break;
+        case 649: if(glad_glVertexAttribP4uiv == NULL) return 0; glad_glVertexAttribP4uiv((GLuint) args[0].u, (GLenum) args[1].u, (GLboolean) args[2].u, (const GLuint *) args[3].p); break;
+        case 650: if(glad_glVertexAttribPointer == NULL) return 0; glad_glVertexAttribPointer((GLuint) args[0].u, (GLint) args[1].i, (GLenum) args[2].u, (GLboolean) args[3].u, (GLsizei) args[4].i, (const void *) args[5].p); break;
+        case 651: if(glad_glVertexBindingDivisor == NULL) return 0; glad_glVertexBindingDivisor((GLuint) args[0].u, (GLuint) args[1].u); break;
+        case 652: if(glad_glViewport == NULL) return 0; glad_glViewport((GLint) args[0].i, (GLint) args[1].i, (GLsizei) args[2].i, (GLsizei) args[3].i); break;
+        case 653: if(glad_glViewportArrayv == NULL) return 0; glad_glViewportArrayv((GLuint) args[0].u, (GLsizei) args[1].i, (const GLfloat *) args[2].p); break;
+        case 654: if(glad_glViewportIndexedf == NULL) return 0; glad_glViewportIndexedf((GLuint) args[0].u, (GLfloat) args[1].f, (GLfloat) args[2].f, (GLfloat) args[3].f, (GLfloat) args[4].f); break;
+        case 655: if(glad_glViewportIndexedfv == NULL) return 0; glad_glViewportIndexedfv((GLuint) args[0].u, (const GLfloat *) args[1].p); break;
+        case 656: if(glad_glWaitSync == NULL) return 0; glad_glWaitSync((GLsync) args[0].p, (GLbitfield) args[1].u, (GLuint64) args[2].u); break;
+        default: return 0;
+    }
+    return 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+# Generates glad's debug layer and call table from glad's function list:
+#	dependencies/include/glad/gl_debug.h  GladGLFunction, GladGLArgument and the API
+#	gl_debug.c                            glad_gl_functions, the wrappers and gladGLCall
+# Reads the PFN typedefs and the glad_gl* pointers declared in dependencies/include/glad/gl.h,
+# so rerun it whenever glad is regenerated. Same function order as gl.h (alphabetical);
+# traces refer to functions by name, so they survive a change of order.
+#
+# usage: python3 tools/gen_gl_debug.py
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+GL_H = os.path.join(ROOT, 'dependencies', 'include', 'glad', 'gl.h')
+DEBUG_H = os.path.join(ROOT, 'dependencies', 'include', 'glad', 'gl_debug.h')
+DEBUG_C = os.path.join(ROOT, 'gl_debug.c')
+
+# ---- Signature codes (see GladGLFunction in the header) -----------------------------
+
+SIGNED = {'GLint', 'GLsizei', 'GLshort', 'GLbyte', 'GLintptr', 'GLsizeiptr', 'GLint64', 'GLfixed', 'GLclampx'}
+UNSIGNED = {'GLenum', 'GLuint', 'GLbitfield', 'GLboolean', 'GLubyte', 'GLushort', 'GLuint64', 'GLhalf'}
+FLOAT = {'GLfloat', 'GLclampf'}
+DOUBLE = {'GLdouble', 'GLclampd'}
+SIZES = {'GLbyte': 1, 'GLubyte': 1, 'GLboolean': 1, 'GLshort': 2, 'GLushort': 2, 'GLint': 4, 'GLuint': 4,
+         'GLsizei': 4, 'GLenum': 4, 'GLfloat': 4, 'GLdouble': 8, 'GLintptr': 8, 'GLsizeiptr': 8,
+         'GLint64': 8, 'GLuint64': 8}
+# Parameters holding one object name, and arrays of them
+NAMES = {'buffer': 'B', 'readBuffer': 'B', 'writeBuffer': 'B', 'texture': 'T', 'origtexture': 'T',
+         'array': 'V', 'vaobj': 'V', 'framebuffer': 'F', 'readFramebuffer': 'F', 'drawFramebuffer': 'F',
+         'renderbuffer': 'R', 'program': 'P', 'shader': 'P', 'sampler': 'S', 'xfb': 'X', 'pipeline': 'G'}
+PLURAL = {'buffers': 'b', 'textures': 't', 'arrays': 'v', 'framebuffers': 'f', 'renderbuffers': 'r',
+          'programs': 'p', 'shaders': 'p', 'samplers': 's', 'pipelines': 'g'}
+RETURNS = {'glCreateShader': 'P', 'glCreateProgram': 'P', 'glCreateShaderProgramv': 'P',
+           'glGetUniformLocation': 'L', 'glFenceSync': 'Y'}
+
+
+def kind(t):
+    """(type code, GladGLArgument member) of a parameter or return type"""
+    if t in SIGNED: return 'i', 'i'
+    if t in UNSIGNED: return 'u', 'u'
+    if t in FLOAT: return 'f', 'f'
+    if t in DOUBLE: return 'd', 'd'
+    if t in ('GLsync', 'GLDEBUGPROC'): return 'p', 'p'
+    if t == 'void': return 'v', None
+    if not t.startswith('const'): return 'o', 'p'
+    if t == 'const GLchar *': return 's', 'p'
+    if t == 'const GLchar *const*': return 'S', 'p'
+    if t == 'const void *const*': return 'P', 'p'
+    if t == 'const void *': return 'p', 'p'
+    base = t[len('const '):].rstrip(' *')
+    return str(SIZES[base]), 'p'
+
+
+def role(function, t, name, params):
+    base = t.replace('const', '').strip(' *')
+    if base == 'GLuint':
+        if name in NAMES and '*' not in t: return NAMES[name]
+        if name in PLURAL and '*' in t: return PLURAL[name]
+        if name in ('id', 'ids'):
+            scope = 'Q' if 'Quer' in function else 'X' if 'TransformFeedback' in function else None
+            if scope: return scope if name == 'id' else scope.lower()
+    if t == 'GLsync' and name == 'sync': return 'Y'
+    if t == 'GLint' and name == 'location': return 'L'
+    if t in ('const void *', 'void *'):
+        if name in ('pointer', 'indices', 'indirect', 'pixels'): return 'O'
+        if name == 'data' and ('imageSize' in params or function == 'glReadnPixels'): return 'O'
+    return '-'
+
+
+def read_functions():
+    header = open(GL_H).read()
+    typedefs = {}
+    for m in re.finditer(r'typedef (.*?) \(GLAD_API_PTR \*(PFN\w+PROC)\)\((.*?)\);', header):
+        typedefs[m.group(2)] = (m.group(1).strip(), m.group(3).strip())
+    functions = []
+    for pfn, name in re.findall(r'^GLAD_API_CALL (PFN\w+PROC) glad_(gl\w+);$', header, re.M):
+        ret, params = typedefs[pfn]
+        args = []
+        if params != 'void':
+            for p in params.split(','):
+                p = p.strip()
+                n = re.findall(r'\w+', p)[-1]
+                args.append((p[:p.rindex(n)].strip(), n))
+        names = [n for _, n in args]
+        signature = kind(ret)[0] + RETURNS.get(name, '-')
+        for t, n in args:
+            signature += kind(t)[0] + role(name, t, n, names)
+        functions.append((pfn, name, ret, args, signature))
+    return functions
+
+
+# ---- Output -------------------------------------------------------------------------
+
+BANNER = '''/**
+ * Generated by tools/gen_gl_debug.py from glad/gl.h; do not edit.
+ *
+ * SPDX-License-Identifier: (WTFPL OR CC0-1.0) AND Apache-2.0
+ */
+'''
+
+HEADER = BANNER + '''#ifndef GLAD_GL_DEBUG_H_
+#define GLAD_GL_DEBUG_H_
+
+#include <glad/gl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLAD_GL_FUNCTION_COUNT %(count)d
+
+/* One entry point of the debug layer's function table. signature holds two characters for
+ * the return value, then two per parameter: a type and a role.
+ *   type  v void, i signed integer, u unsigned integer (enums, bitfields, booleans too),
+ *         f float, d double, p opaque pointer or handle (const void *, GLsync, callbacks),
+ *         o pointer the call writes through, s string, S array of strings,
+ *         1 2 4 8 array of elements of that many bytes, P array of pointers
+ *   role  - none; B T V F R P S Q X G the name of a buffer, texture, vertex array,
+ *         framebuffer, renderbuffer, program or shader, sampler, query, transform feedback
+ *         or program pipeline, and the same in lower case for an array of such names;
+ *         L uniform location; Y sync object; O offset into a bound buffer (client memory
+ *         for pixels and compressed images when no unpack or pack buffer is bound)
+ * parameters are the parameter names, separated by commas. */
+typedef struct GladGLFunction {
+    const char *name;
+    const char *signature;
+    const char *parameters;
+} GladGLFunction;
+
+GLAD_API_CALL const GladGLFunction glad_gl_functions[GLAD_GL_FUNCTION_COUNT];
+
+/* An argument or result as the debug layer passes it: i and u hold every integer type, p
+ * every pointer, f and d floats and doubles (see the signature's type code). */
+typedef union GladGLArgument {
+    GLint64 i;
+    GLuint64 u;
+    GLfloat f;
+    GLdouble d;
+    const void *p;
+} GladGLArgument;
+
+/* function indexes glad_gl_functions; result is NULL for the pre callback and for void calls. */
+typedef void (*GLADglcallback)(unsigned int function, const GladGLArgument *args, const GladGLArgument *result);
+
+/* Debug layer over the glad_gl* globals (not over GladGLContext tables). Install it after
+ * loading: it wraps the pointers loaded at that time, and loading again replaces the wrappers.
+ * The callbacks run on the calling thread, before and after every wrapped call. */
+GLAD_API_CALL void gladSetGLCallbacks( GLADglcallback pre, GLADglcallback post);
+GLAD_API_CALL void gladInstallGLDebug(void);
+GLAD_API_CALL void gladUninstallGLDebug(void);
+/* Calls function through its glad_gl* pointer (wrapped or not) with args converted back to
+ * the parameter types. Returns 0 if the function is unknown or not loaded. */
+GLAD_API_CALL int gladGLCall( unsigned int function, const GladGLArgument *args, GladGLArgument *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLAD_GL_DEBUG_H_ */
+'''
+
+SOURCE = BANNER + '''#include <stddef.h>
+#include <glad/gl_debug.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* glad_gl_functions[i] describes the entry point the debug layer reports as function i. */
+const GladGLFunction glad_gl_functions[GLAD_GL_FUNCTION_COUNT] = {
+%(table)s
+};
+
+/* Debug layer (gladInstallGLDebug): each installed glad_gl* pointer is swapped for a wrapper
+ * that packs the arguments, reports them to the pre callback, calls the real entry point kept
+ * in glad_debug_gl* and reports again, with the result, to the post callback. */
+static GLADglcallback glad_gl_pre_callback = NULL;
+static GLADglcallback glad_gl_post_callback = NULL;
+
+%(reals)s
+
+%(wrappers)s
+
+typedef struct GladGLDebugEntry {
+    GLADapiproc *pointer;
+    GLADapiproc *real;
+    GLADapiproc wrapper;
+} GladGLDebugEntry;
+
+static const GladGLDebugEntry glad_gl_debug_entries[GLAD_GL_FUNCTION_COUNT] = {
+%(entries)s
+};
+
+void gladSetGLCallbacks(GLADglcallback pre, GLADglcallback post) {
+    glad_gl_pre_callback = pre;
+    glad_gl_post_callback = post;
+}
+
+void gladInstallGLDebug(void) {
+    unsigned int i;
+    for(i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) {
+        const GladGLDebugEntry *entry = &glad_gl_debug_entries[i];
+        GLADapiproc loaded;
+        if(*entry->pointer == NULL || *entry->pointer == entry->wrapper) continue;
+        /* an on-demand trampoline would store the real pointer over the wrapper: load it now */
+        loaded = gladGLOnDemandLoad(glad_gl_functions[i].name);
+        *entry->real = loaded != NULL ? loaded : *entry->pointer;
+        *entry->pointer = entry->wrapper;
+    }
+}
+
+void gladUninstallGLDebug(void) {
+    unsigned int i;
+    for(i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) {
+        const GladGLDebugEntry *entry = &glad_gl_debug_entries[i];
+        if(*entry->pointer == entry->wrapper) *entry->pointer = *entry->real;
+    }
+}
+
+int gladGLCall(unsigned int function, const GladGLArgument *args, GladGLArgument *result) {
+    switch(function) {
+%(calls)s
+        default: return 0;
+    }
+    return 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+'''
+
+
+def value(member, expression):
+    return '(const void *) %s' % expression if member == 'p' else expression
+
+
+def main():
+    functions = read_functions()
+    table, reals, wrappers, entries, calls = [], [], [], [], []
+    for index, (pfn, f, ret, args, signature) in enumerate(functions):
+        table.append('    { "%s", "%s", "%s" }' % (f, signature, ','.join(n for _, n in args)))
+        reals.append('static %s glad_debug_%s = NULL;' % (pfn, f))
+
+        params = ', '.join('%s %s' % (t, n) for t, n in args) or 'void'
+        names = ', '.join(n for _, n in args)
+        array = 'glad_args' if args else 'NULL'
+        body = []
+        if args:
+            body.append('    GladGLArgument glad_args[%d];' % len(args))
+        if ret != 'void':
+            body.append('    %s glad_ret;' % ret)
+        for i, (t, n) in enumerate(args):
+            member = kind(t)[1]
+            body.append('    glad_args[%d].%s = %s;' % (i, member, value(member, n)))
+        body.append('    if(glad_gl_pre_callback != NULL) glad_gl_pre_callback(%d, %s, NULL);' % (index, array))
+        if ret == 'void':
+            body.append('    glad_debug_%s(%s);' % (f, names))
+            body.append('    if(glad_gl_post_callback != NULL) glad_gl_post_callback(%d, %s, NULL);' % (index, array))
+        else:
+            member = kind(ret)[1]
+            body.append('    glad_ret = glad_debug_%s(%s);' % (f, names))
+            body.append('    if(glad_gl_post_callback != NULL) {')
+            body.append('        GladGLArgument glad_result;')
+            body.append('        glad_result.%s = %s;' % (member, value(member, 'glad_ret')))
+            body.append('        glad_gl_post_callback(%d, %s, &glad_result);' % (index, array))
+            body.append('    }')
+            body.append('    return glad_ret;')
+        wrappers.append('static %s GLAD_API_PTR glad_debug_impl_%s(%s) {\n%s\n}' % (ret, f, params, '\n'.join(body)))
+
+        entries.append('    { (GLADapiproc *) &glad_%s, (GLADapiproc *) &glad_debug_%s, (GLADapiproc) glad_debug_impl_%s }' % (f, f, f))
+
+        call = 'glad_%s(%s)' % (f, ', '.join('(%s) args[%d].%s' % (t, i, kind(t)[1]) for i, (t, _) in enumerate(args)))
+        if ret == 'void':
+            calls.append('        case %d: if(glad_%s == NULL) return 0; %s; break;' % (index, f, call))
+        else:
+            member = kind(ret)[1]
+            calls.append('        case %d: if(glad_%s == NULL) return 0; { %s glad_ret = %s; if(result != NULL) result->%s = %s; } break;'
+                         % (index, f, ret, call, member, value(member, 'glad_ret')))
+
+    with open(DEBUG_H, 'w') as out:
+        out.write(HEADER % {'count': len(functions)})
+    with open(DEBUG_C, 'w') as out:
+        out.write(SOURCE % {'table': ',\n'.join(table), 'reals': '\n'.join(reals), 'wrappers': '\n'.join(wrappers),
+                            'entries': ',\n'.join(entries), 'calls': '\n'.join(calls)})
+    print('%d functions' % len(functions))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,7 +1,8 @@
 #include <glad/gl.h>
-#include <GLFW/glfw3.h>
 #include <iostream>
 
+#include "../common/gl_context.h"
+
 const char* vertexShaderSource = R"(
     #version 330 core
     layout (location = 0) in vec3 aPos; // position variable has attribute position 0
@@ -27,37 +28,11 @@ const char* fragmentShaderSource = R"(
 int main()
 {
 	//init -------------------------------------------------------
-	// initialize GLFW
-	if(!glfwInit()){
-		std::cout << "Failed to initialize GLFW" << std::endl;
-		return -1;
-	}
-
-	// set GLFW version 3
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-
-	// set GLFW to use the core profile
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
-
-	// create a GLFWwindow object 
-	GLFWwindow* window = glfwCreateWindow(800, 800, "OpenGL on MAC", NULL, NULL);
-	if (window == NULL)
-	{
-		std::cout << "Failed to create GLFW window" << std::endl;
-		glfwTerminate();
-		return -1;
-	}
-
-	// create a context
-	glfwMakeContextCurrent(window);
-	// GLAD: load all OpenGL function pointers
-	if(!gladLoadGL(glfwGetProcAddress)){
-		std::cout << "Failed to initialize GLAD" << std::endl;
+	// Create an 800x800 window with an OpenGL 3.3 core context and load all OpenGL
+	// function pointers with GLAD. Built with -DGL_CONTEXT_HEADLESS, this renders
+	// offscreen through EGL instead and needs no display.
+	GLContext context;
+	if (!context.create("OpenGL on MAC", 800, 800, 3, 3)) {
 		return -1;
 	}
 	//------------------------------------------------------------
@@ -109,7 +84,7 @@ int main()
 
 
     // Render loop
-    while (!glfwWindowShouldClose(window))
+    while (context.running())
     {
         glClear(GL_COLOR_BUFFER_BIT);
 
@@ -118,14 +93,13 @@ int main()
         glBindVertexArray(VAO);
         glDrawArrays(GL_TRIANGLES, 0, 3);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        context.swapBuffers();
     }
 
     // Cleanup
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteProgram(shaderProgram);
-    glfwTerminate();
+    context.destroy();
     return 0;
 }
@@ -1,10 +1,24 @@
 #include <glad/gl.h>
-#include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <vector>
+
+#include "../common/frame_sink.h"
+#include "../common/frustum_cull.h"
+#include "../common/gl_context.h"
+#include "../common/gl_state_cache.h"
+#include "../common/instancing.h"
+#include "../common/mesh_arena.h"
+#include "../common/mesh_builder.h"
+#include "../common/ring_buffer.h"
+#include "../common/shader_manager.h"
+#include "../common/uniform_block.h"
+#include "scene.h"
 
 const char* vertexShaderSource = R"(
 	// Vertex shader
@@ -14,6 +28,8 @@ const char* vertexShaderSource = R"(
 	layout(location = 0) in vec3 vertexPosition_localspace;
 	layout(location = 1) in vec3 vertexColor;
 	layout(location = 2) in vec3 vertexNormal;
+	// Per-instance data: advances once per cube instead of once per vertex.
+	layout(location = 3) in mat4 instanceModel;
 	
 	// Output data ; will be interpolated for each fragment.
 	out vec3 fragmentPosition_worldspace;  
@@ -21,17 +37,29 @@ const char* vertexShaderSource = R"(
 	out vec3 fragmentNormal;
 
 	// Values that stay constant for the whole mesh.
-	uniform mat4 Model, View, Projection;
+	uniform mat4 Model;
+
+	// Values shared by every object in the scene.
+	layout(std140) uniform Scene {
+		mat4 View, Projection;
+		vec3 cameraPosition;
+		vec3 lightPosition;
+		vec3 lightColor;
+		float lightPower;
+	};
 	
 	void main(){	
 	
+		// Place this instance, then the whole mesh
+		mat4 instanceToWorld = Model * instanceModel;
+
 		// Output position of the vertex, in clip space : ModelViewProjection * position
-		gl_Position =  Projection * View * Model * vec4(vertexPosition_localspace, 1.0); // Remember, matrix multiplication is the other way around
+		gl_Position =  Projection * View * instanceToWorld * vec4(vertexPosition_localspace, 1.0); // Remember, matrix multiplication is the other way around
 	
 	    // Pass vertex attributes to the fragment shader
-		fragmentPosition_worldspace = vec3(Model * vec4(vertexPosition_localspace, 1.0));
+		fragmentPosition_worldspace = vec3(instanceToWorld * vec4(vertexPosition_localspace, 1.0));
 	    fragmentBaseColor = vertexColor;
-	    fragmentNormal = vertexNormal;
+	    fragmentNormal = mat3(instanceToWorld) * vertexNormal; // rotation only, no scaling
 	}
 )";
 
@@ -44,16 +72,22 @@ const char* fragmentShaderSource = R"(
 	in vec3 fragmentBaseColor;
 	in vec3 fragmentNormal;
 
-	// Camera position
-	uniform vec3 cameraPosition;
-
-	// Light properties
-	uniform vec3 lightPosition, lightColor;
-	uniform float lightPower;
+	// Camera and light properties
+	layout(std140) uniform Scene {
+		mat4 View, Projection;
+		vec3 cameraPosition;
+		vec3 lightPosition;
+		vec3 lightColor;
+		float lightPower;
+	};
 
 	// Material properties
-	uniform vec3 materialDiffuse, materialAmbient, materialSpecular;
-	uniform float materialShininess;
+	layout(std140) uniform Material {
+		vec3 materialDiffuse;
+		vec3 materialAmbient;
+		vec3 materialSpecular;
+		float materialShininess;
+	};
 
 	// Ouput data
 	out vec4 fragmentColor;
@@ -88,142 +122,34 @@ const char* fragmentShaderSource = R"(
 	}
 )";
 
-// Our vertices. Three consecutive floats give a 3D vertex; Three consecutive vertices give a triangle.
-// A cube has 6 faces with 2 triangles each, so this makes 6*2=12 triangles, and 12*3 vertices
-static const GLfloat g_vertex_buffer_data[] = {
-    -1.0f,-1.0f,-1.0f, // triangle 1 : begin
-    -1.0f,-1.0f, 1.0f,
-    -1.0f, 1.0f, 1.0f, // triangle 1 : end
-    1.0f, 1.0f,-1.0f, // triangle 2 : begin
-    -1.0f,-1.0f,-1.0f,
-    -1.0f, 1.0f,-1.0f, // triangle 2 : end
-    1.0f,-1.0f, 1.0f,
-    -1.0f,-1.0f,-1.0f,
-    1.0f,-1.0f,-1.0f,
-    1.0f, 1.0f,-1.0f,
-    1.0f,-1.0f,-1.0f,
-    -1.0f,-1.0f,-1.0f,
-    -1.0f,-1.0f,-1.0f,
-    -1.0f, 1.0f, 1.0f,
-    -1.0f, 1.0f,-1.0f,
-    1.0f,-1.0f, 1.0f,
-    -1.0f,-1.0f, 1.0f,
-    -1.0f,-1.0f,-1.0f,
-    -1.0f, 1.0f, 1.0f,
-    -1.0f,-1.0f, 1.0f,
-    1.0f,-1.0f, 1.0f,
-    1.0f, 1.0f, 1.0f,
-    1.0f,-1.0f,-1.0f,
-    1.0f, 1.0f,-1.0f,
-    1.0f,-1.0f,-1.0f,
-    1.0f, 1.0f, 1.0f,
-    1.0f,-1.0f, 1.0f,
-    1.0f, 1.0f, 1.0f,
-    1.0f, 1.0f,-1.0f,
-    -1.0f, 1.0f,-1.0f,
-    1.0f, 1.0f, 1.0f,
-    -1.0f, 1.0f,-1.0f,
-    -1.0f, 1.0f, 1.0f,
-    1.0f, 1.0f, 1.0f,
-    -1.0f, 1.0f, 1.0f,
-    1.0f,-1.0f, 1.0f
-};
-
-// One color for each vertex. They were generated randomly.
-static const GLfloat g_color_buffer_data[] = {
-    0.583f,  0.771f,  0.014f,
-    0.609f,  0.115f,  0.436f,
-    0.327f,  0.483f,  0.844f,
-    0.822f,  0.569f,  0.201f,
-    0.435f,  0.602f,  0.223f,
-    0.310f,  0.747f,  0.185f,
-    0.597f,  0.770f,  0.761f,
-    0.559f,  0.436f,  0.730f,
-    0.359f,  0.583f,  0.152f,
-    0.483f,  0.596f,  0.789f,
-    0.559f,  0.861f,  0.639f,
-    0.195f,  0.548f,  0.859f,
-    0.014f,  0.184f,  0.576f,
-    0.771f,  0.328f,  0.970f,
-    0.406f,  0.615f,  0.116f,
-    0.676f,  0.977f,  0.133f,
-    0.971f,  0.572f,  0.833f,
-    0.140f,  0.616f,  0.489f,
-    0.997f,  0.513f,  0.064f,
-    0.945f,  0.719f,  0.592f,
-    0.543f,  0.021f,  0.978f,
-    0.279f,  0.317f,  0.505f,
-    0.167f,  0.620f,  0.077f,
-    0.347f,  0.857f,  0.137f,
-    0.055f,  0.953f,  0.042f,
-    0.714f,  0.505f,  0.345f,
-    0.783f,  0.290f,  0.734f,
-    0.722f,  0.645f,  0.174f,
-    0.302f,  0.455f,  0.848f,
-    0.225f,  0.587f,  0.040f,
-    0.517f,  0.713f,  0.338f,
-    0.053f,  0.959f,  0.120f,
-    0.393f,  0.621f,  0.362f,
-    0.673f,  0.211f,  0.457f,
-    0.820f,  0.883f,  0.371f,
-    0.982f,  0.099f,  0.879f
-};
-
-// Calculate normal data for each vertex
-std::vector<glm::vec3> calculateVertexNormals(const GLfloat* vertices, size_t numVertices) {
-    std::vector<glm::vec3> vertexNormals(numVertices / 3, glm::vec3(0.0f));
-
-    for (size_t i = 0; i < numVertices; i += 9) {
-        glm::vec3 v0(vertices[i], vertices[i + 1], vertices[i + 2]);
-        glm::vec3 v1(vertices[i + 3], vertices[i + 4], vertices[i + 5]);
-        glm::vec3 v2(vertices[i + 6], vertices[i + 7], vertices[i + 8]);
-
-        glm::vec3 normal = glm::normalize(glm::cross(v1 - v0, v2 - v0));
-
-        // Accumulate normals for each vertex of the triangle
-        vertexNormals[i / 3] += normal;
-        vertexNormals[i / 3 + 1] += normal;
-        vertexNormals[i / 3 + 2] += normal;
-    }
-
-    // Normalize the accumulated normals
-    for (glm::vec3& normal : vertexNormals) {
-        normal = glm::normalize(normal);
-    }
+// Unlit fallback, drawn while the lit program is still being compiled
+const char* flatFragmentShaderSource = R"(
+	// Fragment shader
+	#version 330 core
 
-    return vertexNormals;
-}
+	in vec3 fragmentBaseColor;
+	out vec4 fragmentColor;
 
-void checkShaderCompilationLinking(bool debug, GLuint vertexShader, GLuint fragmentShader, GLuint shaderProgramID) {
-	if (debug) {
-		GLint success;
-		GLchar infoLog[512];
-
-		// Check vertex shader compilation
-		glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-		if (!success)
-		{
-		    glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-		    std::cout << "Vertex shader compilation failed:\n" << infoLog << std::endl;
-		}
+	void main(){
+		fragmentColor = vec4(fragmentBaseColor, 1.0);
+	}
+)";
 
-		// Check fragment shader compilation
-		glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-		if (!success)
-		{
-		    glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-		    std::cout << "Fragment shader compilation failed:\n" << infoLog << std::endl;
-		}
+// CPU side of the uniform blocks, laid out with the std140 rules
+struct SceneUniforms {
+	glm::mat4 View, Projection;
+	alignas(16) glm::vec3 cameraPosition;
+	alignas(16) glm::vec3 lightPosition;
+	alignas(16) glm::vec3 lightColor;
+	float lightPower;
+};
 
-		// Check program linking
-		glGetProgramiv(shaderProgramID, GL_LINK_STATUS, &success);
-		if (!success)
-		{
-		    glGetProgramInfoLog(shaderProgramID, 512, NULL, infoLog);
-		    std::cout << "Shader program linking failed:\n" << infoLog << std::endl;
-		}
-	}
-}
+struct MaterialUniforms {
+	alignas(16) glm::vec3 materialDiffuse;
+	alignas(16) glm::vec3 materialAmbient;
+	alignas(16) glm::vec3 materialSpecular;
+	float materialShininess;
+};
 
 void checkGLError(std::string pointName, bool debug) {
 	if (debug) {
@@ -236,273 +162,292 @@ void checkGLError(std::string pointName, bool debug) {
 }
 
 const bool DEBUG = true;
+// Cubes per grid edge. All INSTANCE_GRID^3 cubes are drawn with a single instanced draw call.
+const int INSTANCE_GRID = 1;
+const float INSTANCE_SPACING = 3.0f;
+// Cubes outside the view frustum are left out of the instance buffer.
+const bool FRUSTUM_CULLING = true;
+// Turntable capture: the cube makes one full turn over CAPTURE_FRAMES frames and every frame
+// is read back and written to CAPTURE_PATH by worker threads; the program exits after the turn.
+// The capture/ directory must exist.
+const bool CAPTURE = false;
+const int CAPTURE_FRAMES = 360;
+const SinkFormat CAPTURE_FORMAT = SINK_PNG;
+const char* CAPTURE_PATH = "capture/turntable_%04d.png"; // SINK_Y4M: "capture/turntable.y4m"
 
 int main()
 {
 	//init -------------------------------------------------------
-	// initialize GLFW
-	if(!glfwInit()){
-		std::cout << "Failed to initialize GLFW" << std::endl;
+	// Create an 800x800 window with an OpenGL 3.3 core context and load all OpenGL
+	// function pointers with GLAD. Built with -DGL_CONTEXT_HEADLESS, this renders
+	// offscreen through EGL instead and needs no display.
+	GLContext context;
+	if (!context.create("OpenGL on MAC", 800, 800, 3, 3)) {
 		return -1;
 	}
 
-	// set GLFW version 3
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-
-	// set GLFW to use the core profile
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
-
-	// create a GLFWwindow object 
-	GLFWwindow* window = glfwCreateWindow(800, 800, "OpenGL on MAC", NULL, NULL);
-	if (window == NULL)
-	{
-		std::cout << "Failed to create GLFW window" << std::endl;
-		glfwTerminate();
-		return -1;
-	}
-
-	// create a context
-	glfwMakeContextCurrent(window);
-	// GLAD: load all OpenGL function pointers
-	if(!gladLoadGL(glfwGetProcAddress)){
-		std::cout << "Failed to initialize GLAD" << std::endl;
-		return -1;
-	}
+	// All binds and attribute setups go through the state cache, which drops redundant calls
+	GLStateCache glState;
 
 	// Enable depth test
-	glEnable(GL_DEPTH_TEST);
+	glState.enable(GL_DEPTH_TEST);
 	// Accept fragment if it closer to the camera than the former one
 	glDepthFunc(GL_LESS); 
 
 	checkGLError("initializing", DEBUG);
 	//------------------------------------------------------------
 
-    // Create normal buffer data
-    std::vector<glm::vec3> vertexNormals = calculateVertexNormals(g_vertex_buffer_data, sizeof(g_vertex_buffer_data) / sizeof(GLfloat));
-	GLfloat g_normal_buffer_data[3 * vertexNormals.size()];
-	for (int i = 0; i < vertexNormals.size(); i++) {
-		g_normal_buffer_data[3 * i + 0] = (vertexNormals.at(i)).x;
-		g_normal_buffer_data[3 * i + 1] = (vertexNormals.at(i)).y;
-		g_normal_buffer_data[3 * i + 2] = (vertexNormals.at(i)).z;
+	// Submit every program up front. The driver compiles them while we carry on;
+	// programs from a previous run come straight out of the program binary cache.
+	ShaderCache shaderCache;
+	ShaderManager shaders(&shaderCache);
+	int flatProgram = shaders.submit("flat", vertexShaderSource, flatFragmentShaderSource);
+	int phongProgram = shaders.submit("phong", vertexShaderSource, fragmentShaderSource, flatProgram);
+	// The fallback is tiny; it's the only program we wait for.
+	shaders.wait(flatProgram);
+	if (DEBUG) {
+		std::cout << "shader cache: " << shaderCache.hits << " hits, " << shaderCache.misses << " misses, "
+			<< shaderCache.rejected << " rejected" << std::endl;
+		std::cout << "shader compile: " << (shaders.parallelCompile() ? "parallel (GL_KHR_parallel_shader_compile)" : "deferred status queries") << std::endl;
 	}
 
-    // Create vertex shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr);
-    glCompileShader(vertexShader);
-
-    // Create fragment shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, nullptr);
-    glCompileShader(fragmentShader);
-
-    // Create shader program
-    GLuint shaderProgramID = glCreateProgram();
-    glAttachShader(shaderProgramID, vertexShader);
-    glAttachShader(shaderProgramID, fragmentShader);
-    glLinkProgram(shaderProgramID);
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-	checkShaderCompilationLinking(true, vertexShader, fragmentShader, shaderProgramID);
-
-	// Create VAO
-	GLuint VertexArrayID;
-	glGenVertexArrays(1, &VertexArrayID);
-	glBindVertexArray(VertexArrayID);
-
-	GLuint vertexbuffer; // VBO
-	glGenBuffers(1, &vertexbuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, vertexbuffer);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(g_vertex_buffer_data), g_vertex_buffer_data, GL_STATIC_DRAW);
-
-	GLuint colorbuffer; // VBO
-	glGenBuffers(1, &colorbuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, colorbuffer);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(g_color_buffer_data), g_color_buffer_data, GL_STATIC_DRAW);
-
-	GLuint normalbuffer; // VBO
-	glGenBuffers(1, &normalbuffer);
-	glBindBuffer(GL_ARRAY_BUFFER, normalbuffer);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(g_normal_buffer_data), g_normal_buffer_data, GL_STATIC_DRAW);
-
-	// 1rst attribute buffer : vertices
-	glEnableVertexAttribArray(0);
-	glBindBuffer(GL_ARRAY_BUFFER, vertexbuffer);
-	glVertexAttribPointer(
-		0,                  // attribute. No particular reason for 0, but must match the layout in the shader.
-		3,                  // size
-		GL_FLOAT,           // type
-		GL_FALSE,           // normalized?
-		0,                  // stride
-		(void*)0            // array buffer offset
-	);
-
-	// 2nd attribute buffer : colors
-	glEnableVertexAttribArray(1);
-	glBindBuffer(GL_ARRAY_BUFFER, colorbuffer);
-	glVertexAttribPointer(
-	    1,                                // attribute. No particular reason for 1, but must match the layout in the shader.
-	    3,                                // size
-	    GL_FLOAT,                         // type
-	    GL_FALSE,                         // normalized?
-	    0,                                // stride
-	    (void*)0                          // array buffer offset
-	);
-
-	// 3rd attribute buffer : normals
-	glEnableVertexAttribArray(2);
-	glBindBuffer(GL_ARRAY_BUFFER, normalbuffer);
-	glVertexAttribPointer(
-	    2,                                // attribute. No particular reason for 2, but must match the layout in the shader.
-	    3,                                // size
-	    GL_FLOAT,                         // type
-	    GL_FALSE,                         // normalized?
-	    0,                                // stride
-	    (void*)0                          // array buffer offset
-	);
-
-	checkGLError("VAO and VBOs", DEBUG);
+	// Weld the triangle soup into an indexed mesh with one interleaved VBO (see scene.h).
+	MeshBuilder cubeBuilder;
+	buildCubeMesh(cubeBuilder);
+	// Vertices are stored quantized (half-float position, 8-bit colour, 10-bit normal):
+	// 16 bytes per vertex instead of 36.
+	// Every mesh lives in one arena (a shared VAO, vertex and index buffer); the cube is its only one.
+	MeshArena<MeshLayoutPacked> meshArena;
+	MeshRange cubeRange = meshArena.add(cubeBuilder);
+	meshArena.upload(glState);
+	if (DEBUG) {
+		std::cout << "mesh: " << cubeBuilder.cornerCount() << " corners -> " << cubeBuilder.getVertices().size() << " vertices, "
+			<< (meshArena.indexType == GL_UNSIGNED_SHORT ? 16 : 32) << "-bit indices, "
+			<< MeshLayoutPacked::stride << " bytes per vertex (" << meshArena.vertexBytes << " bytes)" << std::endl;
+	}
 
-	// Get uniform locations for lighting properties and material properties
-    GLuint LightPositionID = glGetUniformLocation(shaderProgramID, "lightPosition");
-    GLuint LightColorID = glGetUniformLocation(shaderProgramID, "lightColor");
-	GLuint LightPowerID = glGetUniformLocation(shaderProgramID, "lightPower");
-    GLuint CameraPositionID = glGetUniformLocation(shaderProgramID, "cameraPosition");
+	// One model matrix per cube, laid out on a grid centred on the origin
+	std::vector<glm::mat4> instanceMatrices;
+	instanceMatrices.reserve(INSTANCE_GRID * INSTANCE_GRID * INSTANCE_GRID);
+	for (int x = 0; x < INSTANCE_GRID; x++) {
+		for (int y = 0; y < INSTANCE_GRID; y++) {
+			for (int z = 0; z < INSTANCE_GRID; z++) {
+				glm::vec3 offset = (glm::vec3(x, y, z) - (INSTANCE_GRID - 1) * 0.5f) * INSTANCE_SPACING;
+				instanceMatrices.push_back(glm::translate(glm::mat4(1.0f), offset));
+			}
+		}
+	}
+	InstanceBuffer cubeInstances;
+	cubeInstances.create();
+	cubeInstances.attach(glState, meshArena.vertexArray);
+	cubeInstances.update(glState, instanceMatrices.data(), instanceMatrices.size());
+
+	// Bounding box of each cube in model space: the mesh's box moved by its instance matrix
+	glm::vec3 meshMin(INFINITY), meshMax(-INFINITY);
+	for (const MeshVertex& vertex : cubeBuilder.getVertices()) {
+		meshMin = glm::min(meshMin, vertex.position);
+		meshMax = glm::max(meshMax, vertex.position);
+	}
+	BoundingBoxArray instanceBounds;
+	instanceBounds.resize(instanceMatrices.size());
+	for (size_t i = 0; i < instanceMatrices.size(); i++) {
+		glm::vec3 offset(instanceMatrices[i][3]);
+		instanceBounds.set(i, meshMin + offset, meshMax + offset);
+	}
+	FrustumCuller culler;
+	culler.create();
+	// The instances in the buffer right now; re-uploaded only when the visible set changes
+	std::vector<uint32_t> drawnInstances(instanceMatrices.size());
+	for (size_t i = 0; i < drawnInstances.size(); i++) drawnInstances[i] = (uint32_t)i;
+	std::vector<glm::mat4> visibleMatrices;
+
+	// Visible meshes are gathered into one command list each frame and drawn with a single
+	// glMultiDrawElementsIndirect (GL 4.3), or one draw per command on older contexts.
+	IndirectBatch drawBatch;
+	drawBatch.create();
+	if (DEBUG) {
+		std::cout << "draw submission: " << (drawBatch.multiDrawIndirect() ? "glMultiDrawElementsIndirect" : "one draw per command") << std::endl;
+	}
 
-    GLuint MaterialDiffuseID = glGetUniformLocation(shaderProgramID, "materialDiffuse");
-	GLuint MaterialAmbientID = glGetUniformLocation(shaderProgramID, "materialAmbient");
-	GLuint MaterialSpecularID = glGetUniformLocation(shaderProgramID, "materialSpecular");
-	GLuint MaterialShininessID = glGetUniformLocation(shaderProgramID, "materialShininess");
+	checkGLError("VAO and VBOs", DEBUG);
 
 	// Set world properties(lighting, camera) and material properties(Diffuse, Specular, Ambient).
-	glm::vec3 lightPosition, lightColor, cameraPosition, cameraTarget;
-	lightPosition = glm::vec3(5.0f, 3.0f, 0.0f);
-	lightColor = glm::vec3(1.0f, 1.0f, 1.0f);
-	GLfloat lightPower = 50.0f;
-	cameraPosition = glm::vec3(4.0f, 3.0f, -3.0f);
-	cameraTarget = glm::vec3(0.0f, 0.0f, 0.0f); // Camera looks at the origin
-
-	glm::vec3 materialAmbient, materialDiffuse, materialSpecular;
-	materialDiffuse = glm::vec3(0.5f, 0.5f, 0.5f);
-	materialAmbient = glm::vec3(0.1f, 0.1f, 0.1f);
-	materialSpecular = glm::vec3(0.5f, 0.5f, 0.5f);
-	GLfloat materialShininess = 32.0f;
-
-
-
-	// Get a handle for our "Model View Projection" uniform
-	GLuint ModelID = glGetUniformLocation(shaderProgramID, "Model");
-	GLuint ViewID = glGetUniformLocation(shaderProgramID, "View");
-	GLuint ProjectionID = glGetUniformLocation(shaderProgramID, "Projection");
-
-	// Projection matrix : 45° Field of View, 4:3 ratio, display range : 0.1 unit <-> 100 units
-	glm::mat4 Projection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f);
-	// Camera matrix
-	glm::mat4 View       = glm::lookAt(
-								cameraPosition,   // Camera is at (4,3,-3), in World Space
-								cameraTarget,     // and looks at the origin
-								glm::vec3(0,1,0)  // Head is up (set to 0,-1,0 to look upside-down)
-						   );
+	// The values live in scene.h, shared with the software renderer.
+	CubeScene scene;
+	glm::vec3 lightPosition = scene.lightPosition(0);
+
+	// Get a handle for our "Model" uniform. View and Projection live in the Scene block.
+	// This is redone whenever the program we draw with changes.
+	GLuint shaderProgramID = 0;
+	UniformShadow programUniforms;
+	GLint ModelID = -1;
+
+	glm::mat4 Projection = scene.projection();
+	glm::mat4 View       = scene.view();
 	// Model matrix : an identity matrix (model will be at the origin)
 	glm::mat4 Model      = glm::mat4(1.0f);
 
+	// Uniform blocks: binding point 0 holds the scene, 1 the material.
+	// Each keeps a CPU copy and only uploads the bytes that changed.
+	UniformBlock<SceneUniforms> sceneBlock;
+	sceneBlock.create(0);
+	UniformBlock<MaterialUniforms> materialBlock;
+	materialBlock.create(1);
+	auto attachUniformBlocks = [&](GLuint program) {
+		// The flat program has no Material block.
+		materialBlock.attach(program, "Material");
+		if (!sceneBlock.attach(program, "Scene")) {
+			std::cout << "Uniform block layout does not match the shader" << std::endl;
+		}
+	};
+	attachUniformBlocks(shaders.program(flatProgram));
+	if (shaders.ready(phongProgram)) attachUniformBlocks(shaders.program(phongProgram));
+
+	sceneBlock.set(&SceneUniforms::View, View);
+	sceneBlock.set(&SceneUniforms::Projection, Projection);
+	sceneBlock.set(&SceneUniforms::cameraPosition, scene.cameraPosition);
+	sceneBlock.set(&SceneUniforms::lightColor, scene.lightColor);
+	sceneBlock.set(&SceneUniforms::lightPower, scene.lightPower);
+	materialBlock.set(&MaterialUniforms::materialDiffuse, scene.materialDiffuse);
+	materialBlock.set(&MaterialUniforms::materialAmbient, scene.materialAmbient);
+	materialBlock.set(&MaterialUniforms::materialSpecular, scene.materialSpecular);
+	materialBlock.set(&MaterialUniforms::materialShininess, scene.materialShininess);
+
+	// Per-frame data is streamed through a ring of three regions, one per frame in flight.
+	// A region is only rewritten once the GPU has finished the frame that used it.
+	RingBuffer frameRing;
+	frameRing.create(64 * 1024);
+	if (DEBUG) {
+		std::cout << "frame ring: " << (frameRing.persistentMapping() ? "persistent mapping" : "glBufferSubData") << std::endl;
+	}
+
+	// Frames are copied into pixel pack buffers on the GPU and handed to the sink's workers,
+	// which flip, convert and encode them. If the disk can't keep up, the render loop waits
+	// instead of dropping frames.
+	FrameReadback frameReadback;
+	FrameSink frameSink;
+	if (CAPTURE) {
+		SinkOptions sinkOptions;
+		sinkOptions.format = CAPTURE_FORMAT;
+		sinkOptions.path = CAPTURE_PATH;
+		sinkOptions.backpressure = SINK_BLOCK;
+		frameSink.open(sinkOptions);
+		// The default viewport is the framebuffer size, which may differ from the window size.
+		GLint viewport[4];
+		glGetIntegerv(GL_VIEWPORT, viewport);
+		frameReadback.create(viewport[2], viewport[3], [&](const CapturedFrame& frame) { frameSink.submit(frame); });
+	}
+
 	checkGLError("Model View Projection", DEBUG);
 
 	int time = 0.0f;
 
     // Render loop
 	do {
+		// Wait (only if the GPU is behind) until this frame's ring region is free again
+		frameRing.beginFrame();
 
 		// Clear the screen
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+		// Pick up programs that finished compiling. Until then the fallback is used.
+		for (int handle : shaders.poll()) {
+			attachUniformBlocks(shaders.program(handle));
+			if (DEBUG) std::cout << "frame " << time << ": program " << handle << " ready" << std::endl;
+		}
+		GLuint program = shaders.program(phongProgram);
+		if (program != shaderProgramID) {
+			shaderProgramID = program;
+			programUniforms = UniformShadow(shaderProgramID);
+			ModelID = programUniforms.location("Model");
+		}
+
 		// Use our shader
-		glUseProgram(shaderProgramID);
+		glState.useProgram(shaderProgramID);
 
 		// Animate Light Position
-		lightPosition = glm::vec3(5 * glm::cos(time/100.0f), 3.0f, 5 * glm::sin(time/100.0f));
-
-		// Send our transformation to the currently bound shader, 
-		// in the "MVP" uniform
-		glUniformMatrix4fv(ModelID, 1, GL_FALSE, &Model[0][0]);
-		glUniformMatrix4fv(ViewID, 1, GL_FALSE, &View[0][0]);
-		glUniformMatrix4fv(ProjectionID, 1, GL_FALSE, &Projection[0][0]);
-
-		// 1rst attribute buffer : vertices
-		glEnableVertexAttribArray(0);
-		glBindBuffer(GL_ARRAY_BUFFER, vertexbuffer);
-		glVertexAttribPointer(
-			0,                  // attribute. No particular reason for 0, but must match the layout in the shader.
-			3,                  // size
-			GL_FLOAT,           // type
-			GL_FALSE,           // normalized?
-			0,                  // stride
-			(void*)0            // array buffer offset
-		);
-
-		// 2nd attribute buffer : colors
-		glEnableVertexAttribArray(1);
-		glBindBuffer(GL_ARRAY_BUFFER, colorbuffer);
-		glVertexAttribPointer(
-			1,                                // attribute. No particular reason for 1, but must match the layout in the shader.
-			3,                                // size
-			GL_FLOAT,                         // type
-			GL_FALSE,                         // normalized?
-			0,                                // stride
-			(void*)0                          // array buffer offset
-		);
-
-		// 3rd attribute buffer : normals
-		glEnableVertexAttribArray(2);
-		glBindBuffer(GL_ARRAY_BUFFER, normalbuffer);
-		glVertexAttribPointer(
-			2,                                // attribute. No particular reason for 2, but must match the layout in the shader.
-			3,                                // size
-			GL_FLOAT,                         // type
-			GL_FALSE,                         // normalized?
-			0,                                // stride
-			(void*)0                          // array buffer offset
-		);
-
-		// Set light properties and material properties
-        glUniform3f(LightPositionID, lightPosition.x, lightPosition.y, lightPosition.z);
-        glUniform3f(LightColorID, lightColor.x, lightColor.y, lightColor.z);
-		glUniform1f(LightPowerID, lightPower);
-        glUniform3f(CameraPositionID, cameraPosition.x, cameraPosition.y, cameraPosition.z);
-		glUniform3f(MaterialDiffuseID, materialDiffuse.x, materialDiffuse.y, materialDiffuse.z);
-		glUniform3f(MaterialAmbientID, materialAmbient.x, materialAmbient.y, materialAmbient.z);
-		glUniform3f(MaterialSpecularID, materialSpecular.x, materialSpecular.y, materialSpecular.z);
-		glUniform1f(MaterialShininessID, materialShininess);
-
-
-		// Draw the triangle !
-		glDrawArrays(GL_TRIANGLES, 0, 12*3); // 12*3 indices starting at 0 -> 12 triangles
-
-		glDisableVertexAttribArray(0);
-		glDisableVertexAttribArray(1);
-		glDisableVertexAttribArray(2);
+		lightPosition = scene.lightPosition(time);
+
+		// Turn the cube once over the captured sequence
+		if (CAPTURE) Model = glm::rotate(glm::mat4(1.0f), time * glm::two_pi<float>() / CAPTURE_FRAMES, glm::vec3(0, 1, 0));
+
+		// Send our transformation to the currently bound shader.
+		// Unchanged values are not sent again.
+		programUniforms.setMat4(ModelID, Model);
+
+		// Set light properties and material properties.
+		// The scene block changes every frame, so it is written to the ring as a whole
+		// (or to its own buffer if this frame's region is full);
+		// the material never changes after the first upload.
+		sceneBlock.set(&SceneUniforms::lightPosition, lightPosition);
+		sceneBlock.stream(frameRing);
+		materialBlock.upload();
+
+
+		// Draw the triangles of every instance !
+		// Cull in model space: the planes of Projection * View * Model against the instance boxes.
+		if (FRUSTUM_CULLING) {
+			size_t visible = culler.cull(frustumFromMatrix(Projection * View * Model), instanceBounds);
+			const uint32_t* visibleInstances = culler.visible();
+			if (visible != drawnInstances.size() || !std::equal(drawnInstances.begin(), drawnInstances.end(), visibleInstances)) {
+				drawnInstances.assign(visibleInstances, visibleInstances + visible);
+				visibleMatrices.resize(visible);
+				for (size_t k = 0; k < visible; k++) visibleMatrices[k] = instanceMatrices[visibleInstances[k]];
+				cubeInstances.update(glState, visibleMatrices.data(), visible);
+			}
+		}
+
+		drawBatch.clear();
+		if (cubeInstances.count() > 0) drawBatch.add(cubeRange, (GLuint)cubeInstances.count());
+		drawBatch.submit(glState, meshArena, &cubeInstances);
+
+		// Report how many state calls the cache saved
+		GLStateStats frameStats = glState.endFrame();
+		RingBufferStats ringStats = frameRing.endFrame();
+		UniformUploadStats uniformStats = programUniforms.endFrame();
+		uniformStats.add(sceneBlock.endFrame());
+		uniformStats.add(materialBlock.endFrame());
+		CullStats cullStats = culler.endFrame();
+		if (DEBUG && time % 100 == 0) {
+			std::string label = "frame " + std::to_string(time);
+			frameStats.print(label.c_str());
+			uniformStats.print(label.c_str());
+			ringStats.print(label.c_str());
+			if (FRUSTUM_CULLING) cullStats.print(label.c_str());
+			if (CAPTURE) frameReadback.endFrame().print(label.c_str());
+#ifdef GL_CONTEXT_TOOLS
+			// GL_CONTEXT_PROFILE=1: where the CPU time of the frames since the last report went
+			if (context.profiling()) context.profileStats().print(label.c_str());
+#endif
+		}
+
+		// Queue this frame for the sink before the back buffer goes away
+		if (CAPTURE) frameReadback.capture(context.framebuffer());
 
 		time+=1.0f;
 		// Swap buffers
-		glfwSwapBuffers(window);
-		glfwPollEvents();
+		context.swapBuffers();
 	} // Check if the ESC key was pressed or the window was closed
-	while( glfwGetKey(window, GLFW_KEY_ESCAPE ) != GLFW_PRESS &&
-		   glfwWindowShouldClose(window) == 0 );
+	while( context.running() && !(CAPTURE && time >= CAPTURE_FRAMES) );
+
+	// Write out the frames still in flight
+	if (CAPTURE) {
+		frameReadback.destroy();
+		frameSink.close();
+		frameSink.statistics().print("capture");
+	}
 
 	// Cleanup VBO and shader
-	glDeleteBuffers(1, &vertexbuffer);
-	glDeleteBuffers(1, &colorbuffer);
-	glDeleteProgram(shaderProgramID);
-	glDeleteVertexArrays(1, &VertexArrayID);
+	cubeInstances.destroy(glState);
+	drawBatch.destroy(glState);
+	meshArena.destroy(glState);
+	shaders.destroy();
+	sceneBlock.destroy();
+	materialBlock.destroy();
+	frameRing.destroy();
 
 	// Close OpenGL window and terminate GLFW
-	glfwTerminate();
+	context.destroy();
 
 	return 0;
 }
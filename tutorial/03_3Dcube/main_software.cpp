@@ -0,0 +1,184 @@
+// Software renderer for the 03 scene
+// Draws the same lit cube as main.cpp (scene.h) on the CPU, for machines without a GPU:
+// no window, no GL context, the vertex and fragment shaders below are main.cpp's GLSL
+// translated to C++. Frames are rendered by a tile-based rasterizer on a work-stealing
+// thread pool; the last one is written to cube_software.ppm (or, with CAPTURE, every one of
+// them, as in main.cpp).
+// With SIMD_SHADING the fragment shader runs as the SoA Phong kernels of phong_kernels.h,
+// 4 or 8 pixels at a time on SSE4.1/AVX2 CPUs; SIMD_LEVEL=scalar|sse41 caps the level.
+//
+// build: c++ -std=c++17 -O2 -I../../dependencies/include main_software.cpp -lpthread
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../common/frame_sink.h"
+#include "../common/mesh_builder.h"
+#include "../common/phong_kernels.h"
+#include "../common/software_raster.h"
+#include "../common/task_pool.h"
+#include "scene.h"
+
+const bool DEBUG = true;
+const int WIDTH = 800;
+const int HEIGHT = 800;
+// Frames to render; SOFTWARE_FRAMES in the environment overrides it.
+const int FRAMES = 300;
+// Turntable capture, as in main.cpp
+const bool CAPTURE = false;
+const int CAPTURE_FRAMES = 360;
+const SinkFormat CAPTURE_FORMAT = SINK_PNG;
+const char* CAPTURE_PATH = "capture/turntable_%04d.png";
+
+// Shade with the SIMD Phong kernels instead of the per-fragment C++ shader below
+const bool SIMD_SHADING = true;
+// Reject occluded tiles and blocks before shading (see software_raster.h)
+const bool HIERARCHICAL_Z = true;
+
+// Varyings: fragmentPosition_worldspace, fragmentBaseColor, fragmentNormal
+const int VARYINGS = 9;
+
+int main()
+{
+	//init -------------------------------------------------------
+	// One worker per hardware thread, the main thread included
+	TaskPool taskPool;
+	taskPool.create();
+	SoftwareRasterizer<VARYINGS> rasterizer;
+	rasterizer.create(WIDTH, HEIGHT, &taskPool);
+	rasterizer.setHierarchicalDepth(HIERARCHICAL_Z);
+	if (DEBUG) {
+		std::cout << "software rasterizer: " << WIDTH << "x" << HEIGHT << ", " << taskPool.threadCount() << " threads, "
+			<< rasterizer.TILE_SIZE << "px tiles" << std::endl;
+		std::cout << "fragment shading: " << (SIMD_SHADING ? simdLevelName(phongKernels().level) : "per fragment") << std::endl;
+	}
+	//------------------------------------------------------------
+
+	// The same indexed cube main.cpp uploads, kept at full precision.
+	MeshBuilder cubeBuilder;
+	buildCubeMesh(cubeBuilder);
+	const std::vector<MeshVertex>& cubeVertices = cubeBuilder.getVertices();
+
+	// Attribute streams, laid out like the GL vertex array: 0 position, 1 colour, 2 normal
+	SoftwareVertexArray vertexArray;
+	vertexArray.attribPointer(0, 3, sizeof(MeshVertex), &cubeVertices[0].position);
+	vertexArray.attribPointer(1, 3, sizeof(MeshVertex), &cubeVertices[0].color);
+	vertexArray.attribPointer(2, 3, sizeof(MeshVertex), &cubeVertices[0].normal);
+	vertexArray.elementBuffer(cubeBuilder.getIndices().data(), cubeBuilder.getIndices().size());
+
+	CubeScene scene;
+	PhongUniforms phongUniforms;
+	phongUniforms.lightColor = scene.lightColor;
+	phongUniforms.lightPower = scene.lightPower;
+	phongUniforms.cameraPosition = scene.cameraPosition;
+	phongUniforms.materialDiffuse = scene.materialDiffuse;
+	phongUniforms.materialAmbient = scene.materialAmbient;
+	phongUniforms.materialSpecular = scene.materialSpecular;
+	phongUniforms.materialShininess = scene.materialShininess;
+	glm::mat4 Projection = scene.projection();
+	glm::mat4 View = scene.view();
+	glm::mat4 Model = glm::mat4(1.0f);
+
+	FrameSink frameSink;
+	SinkOptions sinkOptions;
+	sinkOptions.format = CAPTURE ? CAPTURE_FORMAT : SINK_PPM;
+	sinkOptions.path = CAPTURE ? CAPTURE_PATH : "cube_software.ppm";
+	frameSink.open(sinkOptions);
+
+	int frames = CAPTURE ? CAPTURE_FRAMES : FRAMES;
+	if (const char* value = std::getenv("SOFTWARE_FRAMES")) frames = std::atoi(value);
+	double totalMilliseconds = 0.0, minMilliseconds = 1e30, maxMilliseconds = 0.0;
+
+	for (int time = 0; time < frames; time++) {
+		auto start = std::chrono::steady_clock::now();
+
+		if (CAPTURE) Model = glm::rotate(glm::mat4(1.0f), time * glm::two_pi<float>() / CAPTURE_FRAMES, glm::vec3(0, 1, 0));
+		glm::mat4 MVP = Projection * View * Model;
+		glm::mat3 normalMatrix = glm::mat3(Model); // rotation only, no scaling
+		glm::vec3 lightPosition = scene.lightPosition(time);
+
+		// Vertex shader
+		auto vertexShader = [&](const SoftwareVertexArray& vao, uint32_t vertex, glm::vec4& position, float* out) {
+			glm::vec4 vertexPosition_localspace = glm::vec4(glm::vec3(vao.fetch(0, vertex)), 1.0f);
+			position = MVP * vertexPosition_localspace;
+			glm::vec3 fragmentPosition_worldspace = glm::vec3(Model * vertexPosition_localspace);
+			glm::vec3 fragmentBaseColor = glm::vec3(vao.fetch(1, vertex));
+			glm::vec3 fragmentNormal = normalMatrix * glm::vec3(vao.fetch(2, vertex));
+			for (int k = 0; k < 3; k++) {
+				out[k] = fragmentPosition_worldspace[k];
+				out[3 + k] = fragmentBaseColor[k];
+				out[6 + k] = fragmentNormal[k];
+			}
+		};
+
+		// Fragment shader: Phong, exactly as fragmentShaderSource computes it
+		auto fragmentShader = [&](const float* in) {
+			glm::vec3 fragmentPosition_worldspace(in[0], in[1], in[2]);
+			glm::vec3 fragmentBaseColor(in[3], in[4], in[5]);
+			glm::vec3 normal = glm::normalize(glm::vec3(in[6], in[7], in[8]));
+
+			// Ambient component.
+			glm::vec3 ambient = scene.materialAmbient * scene.lightColor * scene.materialDiffuse;
+
+			// Diffuse component.
+			glm::vec3 vectorFtoL = lightPosition - fragmentPosition_worldspace;
+			float lightDistance = glm::length(vectorFtoL);
+			glm::vec3 lightDirection = vectorFtoL / lightDistance;
+			float attenuation = scene.lightPower / (lightDistance * lightDistance);
+			float diffuseStrength = glm::max(glm::dot(normal, lightDirection), 0.0f);
+			glm::vec3 diffuse = diffuseStrength * scene.lightColor * scene.materialDiffuse * attenuation;
+
+			// Specular component.
+			glm::vec3 viewDirection = glm::normalize(scene.cameraPosition - fragmentPosition_worldspace);
+			glm::vec3 reflectDirection = glm::reflect(-lightDirection, normal);
+			float specularStrength = std::pow(glm::max(glm::dot(viewDirection, reflectDirection), 0.0f), scene.materialShininess);
+			glm::vec3 specular = specularStrength * scene.lightColor * scene.materialSpecular * attenuation;
+
+			return glm::vec4((ambient + diffuse + specular) * fragmentBaseColor, 1.0f);
+		};
+
+		// Clear the screen, then draw the triangles !
+		rasterizer.clear();
+		if (SIMD_SHADING) {
+			phongUniforms.lightPosition = lightPosition;
+			rasterizer.drawElements(vertexArray, vertexShader, phongSpanKernel(phongUniforms));
+		} else {
+			rasterizer.drawElements(vertexArray, vertexShader, fragmentShader);
+		}
+
+		if (CAPTURE || time == frames - 1) {
+			CapturedFrame frame = {(const unsigned char*)rasterizer.colorBuffer(), WIDTH, HEIGHT, (size_t)WIDTH * 4, (uint64_t)time};
+			frameSink.submit(frame);
+		}
+
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		totalMilliseconds += milliseconds;
+		minMilliseconds = std::min(minMilliseconds, milliseconds);
+		maxMilliseconds = std::max(maxMilliseconds, milliseconds);
+
+		RasterStats rasterStats = rasterizer.endFrame();
+		TaskPoolStats poolStats = taskPool.endFrame();
+		if (DEBUG && time % 100 == 0) {
+			std::string label = "frame " + std::to_string(time);
+			rasterStats.print(label.c_str());
+			poolStats.print(label.c_str());
+		}
+	}
+
+	frameSink.close();
+	if (DEBUG) frameSink.statistics().print("output");
+	if (frames > 0) {
+		std::printf("software: %d frames, %.3f ms/frame (min %.3f, max %.3f)\n",
+			frames, totalMilliseconds / frames, minMilliseconds, maxMilliseconds);
+	}
+
+	// Cleanup
+	rasterizer.destroy();
+	taskPool.destroy();
+	return 0;
+}
@@ -0,0 +1,147 @@
+#pragma once
+// The 03 scene: a lit cube, its light, camera and material.
+// Shared by the OpenGL renderer (main.cpp) and the software renderer (main_software.cpp),
+// so both draw exactly the same thing.
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+#include "../common/mesh_builder.h"
+#include "../common/vertex_normals.h"
+
+// Our vertices. Three consecutive floats give a 3D vertex; Three consecutive vertices give a triangle.
+// A cube has 6 faces with 2 triangles each, so this makes 6*2=12 triangles, and 12*3 vertices
+static const GLfloat g_vertex_buffer_data[] = {
+    -1.0f,-1.0f,-1.0f, // triangle 1 : begin
+    -1.0f,-1.0f, 1.0f,
+    -1.0f, 1.0f, 1.0f, // triangle 1 : end
+    1.0f, 1.0f,-1.0f, // triangle 2 : begin
+    -1.0f,-1.0f,-1.0f,
+    -1.0f, 1.0f,-1.0f, // triangle 2 : end
+    1.0f,-1.0f, 1.0f,
+    -1.0f,-1.0f,-1.0f,
+    1.0f,-1.0f,-1.0f,
+    1.0f, 1.0f,-1.0f,
+    1.0f,-1.0f,-1.0f,
+    -1.0f,-1.0f,-1.0f,
+    -1.0f,-1.0f,-1.0f,
+    -1.0f, 1.0f, 1.0f,
+    -1.0f, 1.0f,-1.0f,
+    1.0f,-1.0f, 1.0f,
+    -1.0f,-1.0f, 1.0f,
+    -1.0f,-1.0f,-1.0f,
+    -1.0f, 1.0f, 1.0f,
+    -1.0f,-1.0f, 1.0f,
+    1.0f,-1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f,
+    1.0f,-1.0f,-1.0f,
+    1.0f, 1.0f,-1.0f,
+    1.0f,-1.0f,-1.0f,
+    1.0f, 1.0f, 1.0f,
+    1.0f,-1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f,-1.0f,
+    -1.0f, 1.0f,-1.0f,
+    1.0f, 1.0f, 1.0f,
+    -1.0f, 1.0f,-1.0f,
+    -1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f,
+    -1.0f, 1.0f, 1.0f,
+    1.0f,-1.0f, 1.0f
+};
+
+// One color for each vertex. They were generated randomly.
+static const GLfloat g_color_buffer_data[] = {
+    0.583f,  0.771f,  0.014f,
+    0.609f,  0.115f,  0.436f,
+    0.327f,  0.483f,  0.844f,
+    0.822f,  0.569f,  0.201f,
+    0.435f,  0.602f,  0.223f,
+    0.310f,  0.747f,  0.185f,
+    0.597f,  0.770f,  0.761f,
+    0.559f,  0.436f,  0.730f,
+    0.359f,  0.583f,  0.152f,
+    0.483f,  0.596f,  0.789f,
+    0.559f,  0.861f,  0.639f,
+    0.195f,  0.548f,  0.859f,
+    0.014f,  0.184f,  0.576f,
+    0.771f,  0.328f,  0.970f,
+    0.406f,  0.615f,  0.116f,
+    0.676f,  0.977f,  0.133f,
+    0.971f,  0.572f,  0.833f,
+    0.140f,  0.616f,  0.489f,
+    0.997f,  0.513f,  0.064f,
+    0.945f,  0.719f,  0.592f,
+    0.543f,  0.021f,  0.978f,
+    0.279f,  0.317f,  0.505f,
+    0.167f,  0.620f,  0.077f,
+    0.347f,  0.857f,  0.137f,
+    0.055f,  0.953f,  0.042f,
+    0.714f,  0.505f,  0.345f,
+    0.783f,  0.290f,  0.734f,
+    0.722f,  0.645f,  0.174f,
+    0.302f,  0.455f,  0.848f,
+    0.225f,  0.587f,  0.040f,
+    0.517f,  0.713f,  0.338f,
+    0.053f,  0.959f,  0.120f,
+    0.393f,  0.621f,  0.362f,
+    0.673f,  0.211f,  0.457f,
+    0.820f,  0.883f,  0.371f,
+    0.982f,  0.099f,  0.879f
+};
+
+struct CubeScene {
+	// Light
+	glm::vec3 lightColor = glm::vec3(1.0f, 1.0f, 1.0f);
+	float lightPower = 50.0f;
+	// Camera at (4,3,-3), looking at the origin
+	glm::vec3 cameraPosition = glm::vec3(4.0f, 3.0f, -3.0f);
+	glm::vec3 cameraTarget = glm::vec3(0.0f, 0.0f, 0.0f);
+	// Material (Diffuse, Specular, Ambient)
+	glm::vec3 materialDiffuse = glm::vec3(0.5f, 0.5f, 0.5f);
+	glm::vec3 materialAmbient = glm::vec3(0.1f, 0.1f, 0.1f);
+	glm::vec3 materialSpecular = glm::vec3(0.5f, 0.5f, 0.5f);
+	float materialShininess = 32.0f;
+
+	// The light circles the cube, one turn every 200*pi frames.
+	glm::vec3 lightPosition(int frame) const {
+		return glm::vec3(5 * glm::cos(frame / 100.0f), 3.0f, 5 * glm::sin(frame / 100.0f));
+	}
+
+	// Projection matrix : 45° Field of View, 4:3 ratio, display range : 0.1 unit <-> 100 units
+	glm::mat4 projection() const {
+		return glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+	}
+
+	// Camera matrix
+	glm::mat4 view() const {
+		return glm::lookAt(
+			cameraPosition,   // Camera is at (4,3,-3), in World Space
+			cameraTarget,     // and looks at the origin
+			glm::vec3(0,1,0)  // Head is up (set to 0,-1,0 to look upside-down)
+		);
+	}
+};
+
+// Welds the cube's triangle soup into an indexed mesh with normals.
+// Positions are welded first, only to find which triangles share a corner (a cube has 8);
+// normals are smoothed across shared corners except where faces meet at more than 30 degrees.
+// Corners are then only shared if position, colour and normal all match.
+inline void buildCubeMesh(MeshBuilder& cubeBuilder) {
+	const size_t cornerCount = sizeof(g_vertex_buffer_data) / (3 * sizeof(GLfloat));
+	MeshBuilder cubeTopology(1e-5f, MeshBuilder::WELD_POSITION_ONLY);
+	cubeTopology.addTriangleSoup(g_vertex_buffer_data, nullptr, nullptr, cornerCount);
+	std::vector<glm::vec3> cubePositions;
+	for (const MeshVertex& vertex : cubeTopology.getVertices()) cubePositions.push_back(vertex.position);
+
+	NormalGenerator normalGenerator;
+	normalGenerator.create();
+	normalGenerator.setTopology(cubeTopology.getIndices().data(), cubeTopology.getIndices().size(), cubePositions.size());
+	NormalOptions normalOptions;
+	normalOptions.weighting = NORMAL_WEIGHT_ANGLE;
+	normalOptions.creaseAngle = glm::radians(30.0f);
+	std::vector<glm::vec3> vertexNormals(cornerCount);
+	normalGenerator.computeCornerNormals(cubePositions.data(), vertexNormals.data(), normalOptions);
+
+	cubeBuilder.addTriangleSoup(g_vertex_buffer_data, g_color_buffer_data, &vertexNormals[0].x, vertexNormals.size());
+}
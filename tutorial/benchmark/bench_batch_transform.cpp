@@ -0,0 +1,114 @@
+// Batch transform benchmark
+// Transforms 1M, 10M and 100M points by a model-view-projection matrix:
+//	glm loop:       out[i] = MVP * in[i] over glm::vec4 arrays
+//	transformVec4s: the same through glm_mat4_mul_vec4 (with -DGLM_FORCE_INTRINSICS)
+//	SoA <level>:    transformPoints at every SIMD level the CPU supports, out of place
+//	                (x, y, z in; x, y, z, w out) and in place (x, y, z, by the model matrix)
+// Reports the best of a few passes in ms, points per second and GB/s of streams touched,
+// and the largest difference of the SoA results from the glm loop (first million points).
+// No GL context needed. Only one layout is allocated at a time: 100M points take ~3.2 GB.
+//
+// build: c++ -std=c++17 -O2 -I../../dependencies/include bench_batch_transform.cpp
+// usage: bench_batch_transform [max points] [passes]
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../common/batch_transform.h"
+
+const size_t CHECKED_POINTS = 1000000;
+
+// A point cloud in [-10, 10]^3, the same for every layout
+glm::vec3 point(size_t i) {
+	uint32_t h = (uint32_t)i * 2654435761u;
+	return glm::vec3((h & 1023) / 51.15f - 10.0f, ((h >> 10) & 1023) / 51.15f - 10.0f, ((h >> 20) & 1023) / 51.15f - 10.0f);
+}
+
+template <typename Body>
+double bestMilliseconds(int passes, Body body) {
+	double best = 1e30;
+	for (int pass = 0; pass < passes; pass++) {
+		auto start = std::chrono::steady_clock::now();
+		body();
+		best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+	return best;
+}
+
+void report(const char* name, size_t count, double milliseconds, size_t bytesPerPoint, float maxError) {
+	std::printf("  %-22s %10.3f ms %9.1f Mpoints/s %7.2f GB/s", name, milliseconds, count / milliseconds / 1e3,
+		(double)count * bytesPerPoint / milliseconds / 1e6);
+	if (maxError >= 0.0f) std::printf("   max error %.3g", maxError);
+	std::printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+	const size_t maxPoints = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+	const int passes = argc > 2 ? std::atoi(argv[2]) : 3;
+
+	glm::mat4 Projection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+	glm::mat4 View = glm::lookAt(glm::vec3(4, 3, -3), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+	glm::mat4 Model = glm::rotate(glm::mat4(1.0f), 0.5f, glm::vec3(0, 1, 0));
+	const glm::mat4 MVP = Projection * View * Model;
+
+	std::printf("SIMD level: %s\n", simdLevelName(simdLevel()));
+	for (size_t count = 1000000; count <= maxPoints; count *= 10) {
+		std::printf("%zu points\n", count);
+		const size_t checked = std::min(count, CHECKED_POINTS);
+		std::vector<glm::vec4> reference(checked);
+
+		{
+			std::vector<glm::vec4> in(count), out(count);
+			for (size_t i = 0; i < count; i++) in[i] = glm::vec4(point(i), 1.0f);
+			double milliseconds = bestMilliseconds(passes, [&]() {
+				for (size_t i = 0; i < count; i++) out[i] = MVP * in[i];
+			});
+			std::copy(out.begin(), out.begin() + checked, reference.begin());
+			report("glm loop", count, milliseconds, 32, -1.0f);
+			milliseconds = bestMilliseconds(passes, [&]() { transformVec4s(MVP, in.data(), out.data(), count); });
+			float maxError = 0.0f;
+			for (size_t i = 0; i < checked; i++) maxError = std::max(maxError, glm::length(out[i] - reference[i]));
+			report("transformVec4s", count, milliseconds, 32, maxError);
+		}
+
+		SoAPointArray in, out;
+		in.resize(count, false);
+		out.resize(count, true);
+		for (size_t i = 0; i < count; i++) {
+			glm::vec3 p = point(i);
+			in.x[i] = p.x;
+			in.y[i] = p.y;
+			in.z[i] = p.z;
+		}
+		for (int level = SIMD_SCALAR; level <= detectSimdLevel(); level++) {
+			BatchTransformKernel kernel = batchTransformKernel((SimdLevel)level);
+			if (kernel.level != level) continue; // not compiled in
+			const float* matrix = glm::value_ptr(MVP);
+
+			double milliseconds = bestMilliseconds(passes, [&]() { kernel.transform(matrix, in.points(), out.points(), count); });
+			float maxError = 0.0f;
+			for (size_t i = 0; i < checked; i++) {
+				maxError = std::max(maxError, glm::length(glm::vec4(out.x[i], out.y[i], out.z[i], out.w[i]) - reference[i]));
+			}
+			char name[64];
+			std::snprintf(name, sizeof(name), "SoA %s", simdLevelName(kernel.level));
+			report(name, count, milliseconds, 28, maxError);
+		}
+		// In place, x, y, z only, by the model rotation so repeated passes stay in range
+		for (int level = SIMD_SCALAR; level <= detectSimdLevel(); level++) {
+			BatchTransformKernel kernel = batchTransformKernel((SimdLevel)level);
+			if (kernel.level != level) continue;
+			double milliseconds = bestMilliseconds(passes, [&]() { kernel.transform(glm::value_ptr(Model), in.points(), in.points(), count); });
+			char name[64];
+			std::snprintf(name, sizeof(name), "SoA %s in place", simdLevelName(kernel.level));
+			report(name, count, milliseconds, 24, -1.0f);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,258 @@
+// BVH benchmark
+// Builds BVH4 and BVH8 trees over a height-field terrain of 2 * grid^2 triangles and over
+// random spheres, on the calling thread and on a TaskPool, then traces:
+//	camera:  one ray per pixel of a 1024x768 view of the scene, in 4x4 pixel tiles so that a
+//	         packet holds neighbouring pixels (closest hit)
+//	shadow:  from each camera hit towards a light (any hit)
+//	random:  random origins and directions (closest hit)
+// one ray at a time (glm primitives) and in packets at every SIMD level the CPU supports.
+// Reports build times and rays per second.
+// Checks: single rays against a brute-force loop over every primitive for a sample of camera
+// rays (exact), and packets against single rays. Hits within 1e-4 of each other agree. Where
+// one side found a closer hit the other missed, the ray must graze that primitive (an edge
+// of the triangle, the rim of the sphere, within 1e-5 relative in double precision), since
+// the float tests round differently there; anything else counts as mismatched. Exits with 1
+// if more than 1 in 10^4 rays mismatch.
+// No GL context needed.
+//
+// build: c++ -std=c++17 -O2 -I../../dependencies/include bench_bvh.cpp -lpthread
+// usage: bench_bvh [grid] [spheres]
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../common/bvh.h"
+
+const int VIEW_WIDTH = 1024, VIEW_HEIGHT = 768;
+const int BRUTE_FORCE_RAYS = 64;
+const double ALLOWED_MISMATCH = 1e-4;
+const double GRAZING_TOLERANCE = 1e-5;
+
+double milliseconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Camera rays in 4x4 tiles
+std::vector<BvhRay> cameraRays(const glm::vec3& eye, const glm::vec3& target) {
+	glm::mat4 inverseView = glm::inverse(glm::lookAt(eye, target, glm::vec3(0, 1, 0)));
+	float aspect = (float)VIEW_WIDTH / VIEW_HEIGHT, tanHalf = std::tan(glm::radians(30.0f));
+	std::vector<BvhRay> rays;
+	rays.reserve(VIEW_WIDTH * VIEW_HEIGHT);
+	for (int tileY = 0; tileY < VIEW_HEIGHT; tileY += 4) {
+		for (int tileX = 0; tileX < VIEW_WIDTH; tileX += 4) {
+			for (int y = tileY; y < tileY + 4; y++) {
+				for (int x = tileX; x < tileX + 4; x++) {
+					glm::vec3 direction((2.0f * (x + 0.5f) / VIEW_WIDTH - 1.0f) * aspect * tanHalf, (1.0f - 2.0f * (y + 0.5f) / VIEW_HEIGHT) * tanHalf, -1.0f);
+					BvhRay ray;
+					ray.origin = eye;
+					ray.direction = glm::normalize(glm::mat3(inverseView) * direction);
+					rays.push_back(ray);
+				}
+			}
+		}
+	}
+	return rays;
+}
+
+std::vector<BvhRay> randomRays(size_t count, float extent, std::mt19937& random) {
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::vector<BvhRay> rays(count);
+	for (BvhRay& ray : rays) {
+		ray.origin = glm::vec3(unit(random) * extent, 20.0f + 10.0f * unit(random), unit(random) * extent);
+		ray.direction = glm::normalize(glm::vec3(unit(random), unit(random) - 0.5f, unit(random)));
+	}
+	return rays;
+}
+
+// Rays from the camera hits towards the light, starting just off the surface
+std::vector<BvhRay> shadowRays(const std::vector<BvhRay>& camera, const std::vector<BvhHit>& hits, const glm::vec3& light) {
+	std::vector<BvhRay> rays;
+	rays.reserve(camera.size());
+	for (size_t i = 0; i < camera.size(); i++) {
+		if (hits[i].primitive == BVH_MISS) continue;
+		glm::vec3 point = camera[i].origin + camera[i].direction * hits[i].distance;
+		glm::vec3 toLight = light - point;
+		BvhRay ray;
+		ray.direction = glm::normalize(toLight);
+		ray.origin = point + ray.direction * 1e-3f;
+		ray.tMax = glm::length(toLight) - 1e-3f;
+		rays.push_back(ray);
+	}
+	return rays;
+}
+
+bool failed = false;
+
+void report(const char* name, size_t rays, double ms, size_t boundary, size_t mismatches) {
+	std::printf("    %-22s %9.2f ms %8.2f Mrays/s", name, ms, rays / ms / 1e3);
+	if (mismatches != (size_t)-1) {
+		bool pass = mismatches <= ALLOWED_MISMATCH * rays;
+		failed |= !pass;
+		std::printf("   %zu boundary, %zu mismatched %s", boundary, mismatches, pass ? "" : "FAILED");
+	}
+	std::printf("\n");
+}
+
+bool sameHit(const BvhHit& a, const BvhHit& b) {
+	if (a.primitive == BVH_MISS || b.primitive == BVH_MISS) return a.primitive == b.primitive;
+	return std::fabs(a.distance - b.distance) <= 1e-4f * std::max(1.0f, a.distance);
+}
+
+// Whether the ray passes within rounding of the triangle's edges (Moller-Trumbore in double)
+bool grazes(const BvhTriangle& triangle, const BvhRay& ray) {
+	glm::dvec3 v0(triangle.v0), edge1 = glm::dvec3(triangle.v1) - v0, edge2 = glm::dvec3(triangle.v2) - v0;
+	glm::dvec3 direction(ray.direction), p = glm::cross(direction, edge2);
+	double det = glm::dot(edge1, p);
+	if (std::fabs(det) <= GRAZING_TOLERANCE * glm::length(edge1) * glm::length(edge2)) return true;
+	glm::dvec3 s = glm::dvec3(ray.origin) - v0, q = glm::cross(s, edge1);
+	double u = glm::dot(s, p) / det, v = glm::dot(direction, q) / det;
+	return std::min({std::fabs(u), std::fabs(v), std::fabs(1.0 - u - v)}) <= GRAZING_TOLERANCE;
+}
+
+// Whether the ray's distance from the centre is within rounding of the radius
+bool grazes(const BvhSphere& sphere, const BvhRay& ray) {
+	glm::dvec3 diff = glm::dvec3(sphere.center) - glm::dvec3(ray.origin);
+	double t0 = glm::dot(diff, glm::dvec3(ray.direction)), lengthSquared = glm::dot(diff, diff);
+	double radiusSquared = (double)sphere.radius * sphere.radius;
+	return std::fabs(lengthSquared - t0 * t0 - radiusSquared) <= GRAZING_TOLERANCE * lengthSquared;
+}
+
+template <int N, typename Primitive>
+void benchmark(const char* name, const std::vector<Primitive>& primitives, const std::vector<std::pair<const char*, std::vector<BvhRay>>>& closest,
+	const char* shadowName, const glm::vec3& light, TaskPool& pool) {
+	Bvh<N, Primitive> bvh;
+	auto start = std::chrono::steady_clock::now();
+	bvh.build(primitives, nullptr);
+	double serial = milliseconds(start);
+	start = std::chrono::steady_clock::now();
+	bvh.build(primitives, &pool);
+	double pooled = milliseconds(start);
+	std::printf("%s: build %.1f ms, %.1f ms on %u threads, %.1f MB of nodes\n", name, serial, pooled, pool.threadCount(), bvh.nodeBytes() / 1048576.0);
+	bvh.buildStats().print("  tree");
+
+	std::vector<BvhHit> cameraHits;
+	for (const auto& set : closest) {
+		const std::vector<BvhRay>& rays = set.second;
+		std::printf("  %s rays, %zu\n", set.first, rays.size());
+		std::vector<BvhHit> single(rays.size()), packet(rays.size());
+		start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < rays.size(); i++) single[i] = bvh.intersect(rays[i]);
+		report("single ray", rays.size(), milliseconds(start), 0, (size_t)-1);
+		if (cameraHits.empty()) cameraHits = single;
+		for (int level = SIMD_SCALAR; level <= detectSimdLevel(); level++) {
+			bvh.setLevel((SimdLevel)level);
+			if (bvh.level() != level) continue;
+			start = std::chrono::steady_clock::now();
+			bvh.intersect(rays.data(), packet.data(), rays.size());
+			double ms = milliseconds(start);
+			// The closer of two different hits is the one the other side missed (ids are indices here)
+			size_t boundary = 0, mismatches = 0;
+			for (size_t i = 0; i < rays.size(); i++) {
+				if (sameHit(single[i], packet[i])) continue;
+				const BvhHit& closer = single[i].distance < packet[i].distance ? single[i] : packet[i];
+				if (grazes(primitives[closer.primitive], rays[i])) boundary++;
+				else mismatches++;
+			}
+			char label[64];
+			std::snprintf(label, sizeof(label), "%s, %d rays", simdLevelName(bvh.level()), bvh.width());
+			report(label, rays.size(), ms, boundary, mismatches);
+		}
+	}
+
+	std::vector<BvhRay> rays = shadowRays(closest[0].second, cameraHits, light);
+	std::printf("  %s rays, %zu\n", shadowName, rays.size());
+	std::vector<uint8_t> single(rays.size()), packet(rays.size());
+	start = std::chrono::steady_clock::now();
+	size_t occluded = 0;
+	for (size_t i = 0; i < rays.size(); i++) occluded += single[i] = bvh.occluded(rays[i]);
+	report("single ray", rays.size(), milliseconds(start), 0, (size_t)-1);
+	std::printf("    %zu occluded\n", occluded);
+	for (int level = SIMD_SCALAR; level <= detectSimdLevel(); level++) {
+		bvh.setLevel((SimdLevel)level);
+		if (bvh.level() != level) continue;
+		start = std::chrono::steady_clock::now();
+		bvh.occluded(rays.data(), packet.data(), rays.size());
+		double ms = milliseconds(start);
+		// No hit to look at: every difference counts
+		size_t mismatches = 0;
+		for (size_t i = 0; i < rays.size(); i++) mismatches += single[i] != packet[i];
+		char label[64];
+		std::snprintf(label, sizeof(label), "%s, %d rays", simdLevelName(bvh.level()), bvh.width());
+		report(label, rays.size(), ms, 0, mismatches);
+	}
+}
+
+// Every primitive for every ray, through the same glm tests
+template <typename Primitive>
+void checkBruteForce(const char* name, const std::vector<Primitive>& primitives, const std::vector<BvhRay>& rays) {
+	Bvh<8, Primitive> bvh;
+	bvh.build(primitives);
+	size_t wrong = 0, hits = 0;
+	for (int r = 0; r < BRUTE_FORCE_RAYS; r++) {
+		const BvhRay& ray = rays[(size_t)r * rays.size() / BRUTE_FORCE_RAYS];
+		BvhHit expected;
+		expected.distance = ray.tMax;
+		for (const Primitive& primitive : primitives) primitive.intersect(ray, expected);
+		BvhHit got = bvh.intersect(ray);
+		hits += got.primitive != BVH_MISS;
+		wrong += expected.primitive != got.primitive && !(expected.primitive != BVH_MISS && got.distance == expected.distance);
+	}
+	std::printf("%s: %d rays against every primitive, %zu hit, %zu wrong %s\n", name, BRUTE_FORCE_RAYS, hits, wrong, wrong ? "FAILED" : "");
+	failed |= wrong > 0;
+}
+
+int main(int argc, char** argv)
+{
+	const int grid = argc > 1 ? std::atoi(argv[1]) : 1024;
+	const size_t sphereCount = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+	std::mt19937 random(1);
+
+	// Terrain over [-100, 100]^2: rolling hills plus noise
+	std::uniform_real_distribution<float> noise(-0.1f, 0.1f);
+	std::vector<glm::vec3> positions;
+	positions.reserve((size_t)(grid + 1) * (grid + 1));
+	for (int z = 0; z <= grid; z++) {
+		for (int x = 0; x <= grid; x++) {
+			float px = 200.0f * x / grid - 100.0f, pz = 200.0f * z / grid - 100.0f;
+			float height = 5.0f * std::sin(px * 0.05f) * std::cos(pz * 0.07f) + 2.0f * std::sin(px * 0.21f + pz * 0.13f) + noise(random);
+			positions.push_back(glm::vec3(px, height, pz));
+		}
+	}
+	std::vector<uint32_t> indices;
+	indices.reserve((size_t)grid * grid * 6);
+	for (int z = 0; z < grid; z++) {
+		for (int x = 0; x < grid; x++) {
+			uint32_t corner = (uint32_t)(z * (grid + 1) + x);
+			uint32_t quad[6] = {corner, corner + grid + 1, corner + 1, corner + 1, corner + grid + 1, corner + grid + 2};
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+	std::vector<BvhTriangle> triangles = bvhTriangles(positions, indices);
+
+	// Spheres scattered over the same area
+	std::uniform_real_distribution<float> spread(-100.0f, 100.0f), height(0.0f, 20.0f), radius(0.05f, 0.3f);
+	std::vector<BvhSphere> spheres(sphereCount);
+	for (size_t i = 0; i < sphereCount; i++) spheres[i] = {glm::vec3(spread(random), height(random), spread(random)), radius(random), (uint32_t)i};
+
+	TaskPool pool;
+	pool.create();
+	std::printf("SIMD level: %s, %u threads\n", simdLevelName(simdLevel()), pool.threadCount());
+
+	std::vector<BvhRay> camera = cameraRays(glm::vec3(-60.0f, 40.0f, 80.0f), glm::vec3(0.0f, 0.0f, 0.0f));
+	std::vector<BvhRay> randomSet = randomRays(camera.size(), 100.0f, random);
+	glm::vec3 light(50.0f, 80.0f, -30.0f);
+	checkBruteForce("terrain", triangles, camera);
+	checkBruteForce("spheres", spheres, camera);
+
+	benchmark<4>("terrain BVH4", triangles, {{"camera", camera}, {"random", randomSet}}, "shadow", light, pool);
+	benchmark<8>("terrain BVH8", triangles, {{"camera", camera}, {"random", randomSet}}, "shadow", light, pool);
+	benchmark<4>("spheres BVH4", spheres, {{"camera", camera}, {"random", randomSet}}, "shadow", light, pool);
+	benchmark<8>("spheres BVH8", spheres, {{"camera", camera}, {"random", randomSet}}, "shadow", light, pool);
+	return failed ? 1 : 0;
+}
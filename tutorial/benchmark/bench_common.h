@@ -0,0 +1,66 @@
+#pragma once
+// Shared pieces of the benchmarks: a hidden GL context, a minimal program builder,
+// test meshes and a millisecond clock.
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+#include <chrono>
+#include <cstdio>
+
+#include "../common/gl_context.h"
+#include "../common/mesh_builder.h"
+
+// Creates a hidden window (or, with -DGL_CONTEXT_HEADLESS, an EGL context without any
+// display) with a current GL context and prints the renderer.
+inline bool createBenchmarkContext(GLContext& context, const char* title, int width, int height, int major = 3, int minor = 3) {
+	if (!context.create(title, width, height, major, minor, false)) return false;
+	std::printf("%s / %s%s\n", (const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION),
+		GLContext::headless() ? " (headless)" : "");
+	return true;
+}
+
+inline GLuint buildProgram(const char* vertexSource, const char* fragmentSource) {
+	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(vertexShader, 1, &vertexSource, NULL);
+	glCompileShader(vertexShader);
+	GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(fragment, 1, &fragmentSource, NULL);
+	glCompileShader(fragment);
+	GLuint program = glCreateProgram();
+	glAttachShader(program, vertexShader);
+	glAttachShader(program, fragment);
+	glLinkProgram(program);
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragment);
+	GLint linked = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &linked);
+	if (!linked) std::printf("program failed to link\n");
+	return program;
+}
+
+// A cube of edge `size` around the origin, each face split into subdivisions^2 quads,
+// with one colour per face.
+inline void buildBox(MeshBuilder& builder, int subdivisions = 1, float size = 1.0f) {
+	const glm::vec3 axes[3] = {glm::vec3(1, 0, 0), glm::vec3(0, 1, 0), glm::vec3(0, 0, 1)};
+	for (int face = 0; face < 6; face++) {
+		glm::vec3 n = axes[face % 3] * (face < 3 ? 1.0f : -1.0f);
+		glm::vec3 u = axes[(face + 1) % 3], v = glm::cross(n, u);
+		auto corner = [&](int i, int j) {
+			MeshVertex vertex;
+			float s = 2.0f * i / subdivisions - 1.0f, t = 2.0f * j / subdivisions - 1.0f;
+			vertex.position = (n + u * s + v * t) * (0.5f * size);
+			vertex.color = glm::abs(n) * 0.5f + 0.25f;
+			vertex.normal = n;
+			return vertex;
+		};
+		for (int i = 0; i < subdivisions; i++) {
+			for (int j = 0; j < subdivisions; j++) {
+				builder.addTriangle(corner(i, j), corner(i + 1, j), corner(i + 1, j + 1));
+				builder.addTriangle(corner(i, j), corner(i + 1, j + 1), corner(i, j + 1));
+			}
+		}
+	}
+}
+
+inline double millisecondsSince(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,173 @@
+// Frustum culling benchmark
+// Culls N boxes and N spheres scattered through a 400^3 world against a glm::perspective /
+// glm::lookAt camera, turning it a little every pass:
+//	scalar loop:  Frustum::intersects per object, pushing visible indices into a vector
+//	<level>:      FrustumCuller at every SIMD level the CPU supports, on the calling thread
+//	              and on a TaskPool with one thread per core
+// Reports the best pass in ms and objects per second. Every list is checked against the
+// scalar loop; an object may only come out differently if it touches a plane (its distance
+// within 1e-4 of the boundary), where FMA rounding decides. Exits with 1 on a mismatch.
+// No GL context needed.
+//
+// build: c++ -std=c++17 -O2 -I../../dependencies/include bench_frustum_cull.cpp -lpthread
+// usage: bench_frustum_cull [objects] [passes]
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../common/frustum_cull.h"
+
+const float BOUNDARY_TOLERANCE = 1e-4f;
+
+struct Timing {
+	double best = 1e30;
+
+	template <typename Body>
+	void measure(Body body) {
+		auto start = std::chrono::steady_clock::now();
+		body();
+		best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+};
+
+// The camera for one pass: a slow turn about the world's centre
+glm::mat4 passProjectionView(int pass) {
+	glm::mat4 Projection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+	float angle = 0.1f * pass;
+	glm::mat4 View = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(std::cos(angle), 0.2f, std::sin(angle)), glm::vec3(0, 1, 0));
+	return Projection * View;
+}
+
+Frustum passFrustum(int pass) {
+	return frustumFromMatrix(passProjectionView(pass));
+}
+
+// Scalar test, and the smallest margin over the planes for telling boundary cases apart
+bool intersects(const Frustum& frustum, const BoundingBoxArray& boxes, size_t i) {
+	return frustum.intersects(boxes.center(i), boxes.extent(i));
+}
+
+bool intersects(const Frustum& frustum, const BoundingSphereArray& spheres, size_t i) {
+	return frustum.intersects(spheres.center(i), spheres.radius[i]);
+}
+
+float margin(const Frustum& frustum, const BoundingBoxArray& boxes, size_t i) {
+	float nearest = INFINITY;
+	for (int p = 0; p < 6; p++) {
+		glm::vec3 n = glm::abs(glm::vec3(frustum.planes[p]));
+		nearest = std::min(nearest, frustum.distance(p, boxes.center(i)) + glm::dot(n, boxes.extent(i)));
+	}
+	return nearest;
+}
+
+float margin(const Frustum& frustum, const BoundingSphereArray& spheres, size_t i) {
+	float nearest = INFINITY;
+	for (int p = 0; p < 6; p++) nearest = std::min(nearest, frustum.distance(p, spheres.center(i)) + spheres.radius[i]);
+	return nearest;
+}
+
+bool failed = false;
+
+template <typename Bounds>
+void run(const char* kind, const Bounds& bounds, int passes, TaskPool& pool) {
+	size_t count = bounds.size();
+	std::printf("%zu %s\n", count, kind);
+
+	// Reference lists, one per pass
+	std::vector<std::vector<uint32_t>> reference(passes);
+	Timing scalar;
+	for (int pass = 0; pass < passes; pass++) {
+		Frustum frustum = passFrustum(pass);
+		std::vector<uint32_t>& visible = reference[pass];
+		visible.reserve(count);
+		scalar.measure([&]() {
+			for (size_t i = 0; i < count; i++) {
+				if (intersects(frustum, bounds, i)) visible.push_back((uint32_t)i);
+			}
+		});
+	}
+	std::printf("  %-24s %9.3f ms %8.1f Mobjects/s   %zu visible (pass 0)\n", "scalar loop", scalar.best, count / scalar.best / 1e3, reference[0].size());
+
+	// The planes themselves: every object whose centre is in clip space must be kept
+	size_t lost = 0;
+	glm::mat4 projectionView = passProjectionView(0);
+	std::vector<bool> kept(count, false);
+	for (uint32_t i : reference[0]) kept[i] = true;
+	for (size_t i = 0; i < count; i++) {
+		glm::vec4 clip = projectionView * glm::vec4(bounds.center(i), 1.0f);
+		bool inside = std::fabs(clip.x) < clip.w && std::fabs(clip.y) < clip.w && std::fabs(clip.z) < clip.w;
+		lost += inside && !kept[i];
+	}
+	if (lost) {
+		std::printf("  %zu objects with their centre in clip space culled FAILED\n", lost);
+		failed = true;
+	}
+
+	for (int level = SIMD_SCALAR; level <= detectSimdLevel(); level++) {
+		for (TaskPool* taskPool : {(TaskPool*)nullptr, &pool}) {
+			FrustumCuller culler;
+			culler.create(taskPool, (SimdLevel)level);
+			if (culler.level() != level) continue; // not compiled in
+			Timing timing;
+			size_t mismatches = 0, boundary = 0;
+			for (int pass = 0; pass < passes; pass++) {
+				Frustum frustum = passFrustum(pass);
+				size_t visible = 0;
+				timing.measure([&]() { visible = culler.cull(frustum, bounds); });
+				// Walk both sorted lists; a difference must be a boundary case
+				const std::vector<uint32_t>& expected = reference[pass];
+				const uint32_t* got = culler.visible();
+				size_t a = 0, b = 0;
+				while (a < expected.size() || b < visible) {
+					uint32_t index;
+					if (b == visible || (a < expected.size() && expected[a] < got[b])) index = expected[a++];
+					else if (a == expected.size() || got[b] < expected[a]) index = got[b++];
+					else {
+						a++;
+						b++;
+						continue;
+					}
+					if (std::fabs(margin(frustum, bounds, index)) <= BOUNDARY_TOLERANCE) boundary++;
+					else mismatches++;
+				}
+			}
+			failed |= mismatches > 0;
+			char name[64];
+			std::snprintf(name, sizeof(name), "%s%s", simdLevelName(culler.level()), taskPool ? ", pool" : "");
+			std::printf("  %-24s %9.3f ms %8.1f Mobjects/s %6.2fx scalar   %zu boundary, %zu mismatched %s\n", name, timing.best,
+				count / timing.best / 1e3, scalar.best / timing.best, boundary, mismatches, mismatches ? "FAILED" : "");
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+	const int passes = argc > 2 ? std::atoi(argv[2]) : 10;
+
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> position(-200.0f, 200.0f), size(0.1f, 2.0f);
+	BoundingBoxArray boxes;
+	BoundingSphereArray spheres;
+	boxes.resize(count);
+	spheres.resize(count);
+	for (size_t i = 0; i < count; i++) {
+		glm::vec3 center(position(random), position(random), position(random));
+		glm::vec3 extent(size(random), size(random), size(random));
+		boxes.set(i, center - extent, center + extent);
+		spheres.set(i, center, glm::length(extent));
+	}
+
+	TaskPool pool;
+	pool.create();
+	std::printf("SIMD level: %s, %u threads\n", simdLevelName(simdLevel()), pool.threadCount());
+	run("boxes", boxes, passes, pool);
+	run("spheres", spheres, passes, pool);
+	return failed ? 1 : 0;
+}
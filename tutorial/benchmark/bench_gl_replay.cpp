@@ -0,0 +1,75 @@
+// GL trace replay benchmark
+// Plays back a trace recorded with GL_CONTEXT_TRACE (see gl_trace.h), e.g. from the 03 demo
+// built with -DGL_CONTEXT_TOOLS:
+//	GL_CONTEXT_TRACE=cube.gltr GL_CONTEXT_TRACE_FRAMES=60 ./03_3Dcube
+// The setup (everything up to the end of the first frame) is replayed once, then the other
+// frames R times in a row. Each frame is timed twice: submitting its calls, which is the
+// driver's CPU cost in isolation from the application that made them, and with glFinish on
+// top, the GPU (or llvmpipe's rasterizer) included. Both are compared with the frame times
+// the recording saw. Headless recordings have the swap's glFinish at the end of every frame,
+// so there the two agree.
+// Exits with 1 if the trace can't be read, calls could not be replayed or glGetError
+// returned something else than during the recording.
+//
+// usage: bench_gl_replay trace [repeats]
+#include <glad/gl.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "bench_common.h"
+#include "../common/gl_trace.h"
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		std::printf("usage: bench_gl_replay trace [repeats]\n");
+		return 1;
+	}
+	const int repeats = argc > 2 ? std::atoi(argv[2]) : 20;
+
+	// Read the size from the trace before there is a context to play it on
+	GLTracePlayer sizes;
+	if (!sizes.load(argv[1])) return 1;
+	GLContext context;
+	if (!createBenchmarkContext(context, "bench_gl_replay", sizes.getWidth(), sizes.getHeight())) return 1;
+	GLTracePlayer player;
+	if (!player.load(argv[1], context.framebuffer())) return 1;
+	glBindFramebuffer(GL_FRAMEBUFFER, context.framebuffer());
+
+	auto start = std::chrono::steady_clock::now();
+	player.replaySetup();
+	glFinish();
+	double setup = millisecondsSince(start);
+	size_t frames = player.frameCount();
+	size_t calls = 0;
+	double recorded = 0.0;
+	for (size_t frame = 0; frame < frames; frame++) {
+		calls += player.frameCalls(frame);
+		recorded += player.recordedMilliseconds(frame);
+	}
+	std::printf("%s: %dx%d, %zu frames after setup, %.1f calls per frame\n", argv[1], sizes.getWidth(), sizes.getHeight(), frames,
+		frames ? (double)calls / frames : 0.0);
+	std::printf("  setup replayed in %.3f ms\n", setup);
+	if (frames == 0) {
+		std::printf("  no frames to time: record at least two\n");
+	} else {
+		double submit = 0.0, finished = 0.0;
+		for (int repeat = 0; repeat < repeats; repeat++) {
+			for (size_t frame = 0; frame < frames; frame++) {
+				auto frameStart = std::chrono::steady_clock::now();
+				player.replayFrame(frame);
+				submit += millisecondsSince(frameStart);
+				glFinish();
+				finished += millisecondsSince(frameStart);
+			}
+		}
+		double count = (double)frames * repeats;
+		std::printf("  recorded            %8.3f ms/frame\n", recorded / frames);
+		std::printf("  replay, submit      %8.3f ms/frame  %8.2f us/call\n", submit / count, submit / count / (calls / (double)frames) * 1e3);
+		std::printf("  replay, + glFinish  %8.3f ms/frame\n", finished / count);
+	}
+	player.statistics().print("  replay");
+	const GLTraceReplayStats& stats = player.statistics();
+	return stats.skipped || stats.errorMismatches ? 1 : 0;
+}
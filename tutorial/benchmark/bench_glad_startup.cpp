@@ -0,0 +1,127 @@
+// GL loader startup benchmark
+// Launches itself N times per mode, alternating, as a short-lived GL process would start:
+// create a hidden context, load GL, compile a program and draw one frame, exit.
+//	eager:      gladLoadGL, every entry point of the context's version looked up at once
+//	on demand:  gladLoadGLOnDemand (GL_CONTEXT_ON_DEMAND=1), each one on its first call
+// Reports the median and mean over the launches of: glad loading, the first frame (where the
+// on-demand entry points get resolved), the child's main() up to exit, and the whole process
+// as seen by the parent (exec, dynamic linking and context creation included).
+//
+// Needs popen and a POSIX shell (Linux, macOS).
+//
+// usage: bench_glad_startup [launches]
+#include <glad/gl.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "bench_common.h"
+
+const char* vertexShader = R"(
+	#version 330 core
+	void main(){
+		vec2 position = vec2((gl_VertexID & 1) * 4.0 - 1.0, (gl_VertexID >> 1) * 4.0 - 1.0);
+		gl_Position = vec4(position, 0.0, 1.0);
+	}
+)";
+
+const char* fragmentShader = R"(
+	#version 330 core
+	out vec4 color;
+	void main(){
+		color = vec4(1.0, 0.5, 0.25, 1.0);
+	}
+)";
+
+// One launch: prints "load firstFrame main" in ms and the renderer
+int child(std::chrono::steady_clock::time_point start) {
+	GLContext context;
+	if (!context.create("bench_glad_startup", 64, 64, 3, 3, false)) return 1;
+	auto frameStart = std::chrono::steady_clock::now();
+	GLuint program = buildProgram(vertexShader, fragmentShader);
+	GLuint vao;
+	glGenVertexArrays(1, &vao);
+	glBindFramebuffer(GL_FRAMEBUFFER, context.framebuffer());
+	glViewport(0, 0, context.getWidth(), context.getHeight());
+	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glUseProgram(program);
+	glBindVertexArray(vao);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	unsigned char pixel[4];
+	glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+	double firstFrame = millisecondsSince(frameStart);
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(program);
+	std::printf("%f %f %f\n%s / %s\n", context.loadMilliseconds(), firstFrame, millisecondsSince(start),
+		(const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION));
+	return pixel[0] == 255 ? 0 : 1;
+}
+
+struct Samples {
+	std::vector<double> values;
+
+	double median() {
+		std::sort(values.begin(), values.end());
+		return values.empty() ? 0.0 : values[values.size() / 2];
+	}
+	double mean() const {
+		double sum = 0.0;
+		for (double value : values) sum += value;
+		return values.empty() ? 0.0 : sum / values.size();
+	}
+};
+
+struct Mode {
+	const char* name;
+	const char* environment;
+	Samples load, firstFrame, main, process;
+	unsigned int failures = 0;
+
+	void print(Samples& baseline) {
+		std::printf("  %-10s", name);
+		for (Samples* samples : {&load, &firstFrame, &main, &process}) std::printf(" %8.3f %8.3f  ", samples->median(), samples->mean());
+		std::printf(" %5.2fx load%s\n", baseline.median() / load.median(), failures ? "  FAILED" : "");
+	}
+};
+
+int main(int argc, char** argv)
+{
+	auto start = std::chrono::steady_clock::now();
+	if (argc > 1 && std::string(argv[1]) == "--child") return child(start);
+	const int launches = argc > 1 ? std::atoi(argv[1]) : 100;
+
+	Mode modes[2] = {{"eager", "GL_CONTEXT_ON_DEMAND=0", {}, {}, {}, {}, 0}, {"on demand", "GL_CONTEXT_ON_DEMAND=1", {}, {}, {}, {}, 0}};
+	std::string renderer;
+	for (int launch = 0; launch < launches; launch++) {
+		for (Mode& mode : modes) {
+			std::string command = std::string(mode.environment) + " \"" + argv[0] + "\" --child";
+			auto processStart = std::chrono::steady_clock::now();
+			FILE* output = popen(command.c_str(), "r");
+			char line[256] = "", name[256] = "";
+			double load = 0.0, firstFrame = 0.0, childMain = 0.0;
+			bool parsed = output && std::fgets(line, sizeof(line), output) && std::sscanf(line, "%lf %lf %lf", &load, &firstFrame, &childMain) == 3;
+			if (parsed && std::fgets(name, sizeof(name), output) && renderer.empty()) renderer = name;
+			int status = output ? pclose(output) : -1;
+			if (!parsed || status != 0) {
+				mode.failures++;
+				continue;
+			}
+			mode.process.values.push_back(millisecondsSince(processStart));
+			mode.load.values.push_back(load);
+			mode.firstFrame.values.push_back(firstFrame);
+			mode.main.values.push_back(childMain);
+		}
+	}
+
+	std::printf("%s%d launches per mode, ms as median and mean\n", renderer.c_str(), launches);
+	std::printf("  %-10s", "");
+	for (const char* column : {"glad load", "first frame", "main()", "process"}) std::printf(" %17s  ", column);
+	std::printf("\n");
+	Samples baseline = modes[0].load;
+	for (Mode& mode : modes) mode.print(baseline);
+	return modes[0].failures + modes[1].failures ? 1 : 0;
+}
@@ -0,0 +1,170 @@
+// Multi-draw indirect benchmark
+// Draws N distinct meshes (boxes of different sizes and tessellations) three ways:
+//	per-mesh:      own VAO per mesh; glUseProgram, glBindVertexArray, glUniformMatrix4fv
+//	               and glDrawElements for every mesh
+//	command loop:  one arena, one glDrawElementsInstancedBaseVertexBaseInstance per mesh
+//	multi-draw:    one arena, one glMultiDrawElementsIndirect for all meshes
+// The model matrices of the arena paths come from an instance buffer indexed by baseInstance.
+// Each frame is timed from the first GL call to glFinish.
+//
+// usage: bench_indirect [meshes] [frames]
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../common/gl_state_cache.h"
+#include "../common/instancing.h"
+#include "../common/mesh_arena.h"
+#include "../common/mesh_builder.h"
+#include "bench_common.h"
+
+const char* perMeshVertexShader = R"(
+	#version 330 core
+	layout(location = 0) in vec3 vertexPosition_localspace;
+	layout(location = 1) in vec3 vertexColor;
+	out vec3 fragmentBaseColor;
+	uniform mat4 ViewProjection;
+	uniform mat4 Model;
+	void main(){
+		gl_Position = ViewProjection * Model * vec4(vertexPosition_localspace, 1.0);
+		fragmentBaseColor = vertexColor;
+	}
+)";
+
+const char* arenaVertexShader = R"(
+	#version 330 core
+	layout(location = 0) in vec3 vertexPosition_localspace;
+	layout(location = 1) in vec3 vertexColor;
+	layout(location = 3) in mat4 instanceModel;
+	out vec3 fragmentBaseColor;
+	uniform mat4 ViewProjection;
+	void main(){
+		gl_Position = ViewProjection * instanceModel * vec4(vertexPosition_localspace, 1.0);
+		fragmentBaseColor = vertexColor;
+	}
+)";
+
+const char* fragmentShader = R"(
+	#version 330 core
+	in vec3 fragmentBaseColor;
+	out vec4 fragmentColor;
+	void main(){
+		fragmentColor = vec4(fragmentBaseColor, 1.0);
+	}
+)";
+
+int main(int argc, char** argv)
+{
+	const size_t meshCount = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 10000;
+	const int frames = argc > 2 ? std::atoi(argv[2]) : 10;
+
+	GLContext context;
+	if (!createBenchmarkContext(context, "bench_indirect", 256, 256, 4, 3)) return -1;
+
+	GLStateCache glState;
+	glState.enable(GL_DEPTH_TEST);
+
+	// The same meshes go into separate VAOs and into the arena.
+	std::vector<Mesh> meshes(meshCount);
+	std::vector<MeshRange> ranges(meshCount);
+	MeshArena<MeshLayoutPacked> arena;
+	for (size_t i = 0; i < meshCount; i++) {
+		MeshBuilder builder;
+		buildBox(builder, 1 + (int)(i % 2), 0.6f + 0.1f * (float)(i % 5));
+		meshes[i].upload<MeshLayoutPacked>(glState, builder);
+		ranges[i] = arena.add(builder);
+	}
+	arena.upload(glState);
+
+	const int side = (int)std::ceil(std::sqrt((double)meshCount));
+	std::vector<glm::mat4> matrices(meshCount);
+	for (size_t i = 0; i < meshCount; i++) {
+		glm::vec3 position((float)(i % side) - side * 0.5f, (float)(i / side) - side * 0.5f, 0.0f);
+		matrices[i] = glm::translate(glm::mat4(1.0f), position * 1.5f);
+	}
+	InstanceBuffer instances;
+	instances.create();
+	instances.attach(glState, arena.vertexArray);
+	instances.update(glState, matrices.data(), matrices.size());
+
+	GLuint perMeshProgram = buildProgram(perMeshVertexShader, fragmentShader);
+	GLuint arenaProgram = buildProgram(arenaVertexShader, fragmentShader);
+	GLint perMeshModel = glGetUniformLocation(perMeshProgram, "Model");
+	glm::mat4 viewProjection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 10000.0f)
+		* glm::lookAt(glm::vec3(0.0f, 0.0f, side * 2.0f), glm::vec3(0.0f), glm::vec3(0, 1, 0));
+	for (GLuint program : {perMeshProgram, arenaProgram}) {
+		glState.useProgram(program);
+		glUniformMatrix4fv(glGetUniformLocation(program, "ViewProjection"), 1, GL_FALSE, glm::value_ptr(viewProjection));
+	}
+
+	IndirectBatch loopBatch, multiDrawBatch;
+	loopBatch.create(false);
+	multiDrawBatch.create();
+	if (!multiDrawBatch.multiDrawIndirect()) std::printf("glMultiDrawElementsIndirect not available, both arena paths loop\n");
+
+	auto perMeshFrame = [&]() {
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		for (size_t i = 0; i < meshCount; i++) {
+			// What a renderer without a state cache does for each object
+			glUseProgram(perMeshProgram);
+			glBindVertexArray(meshes[i].vertexArray);
+			glUniformMatrix4fv(perMeshModel, 1, GL_FALSE, glm::value_ptr(matrices[i]));
+			glDrawElements(GL_TRIANGLES, meshes[i].indexCount, meshes[i].indexType, (void*)0);
+		}
+		glFinish();
+		glState.invalidate();
+	};
+	auto batchFrame = [&](IndirectBatch& batch) {
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glState.useProgram(arenaProgram);
+		// Gathering the commands is part of the frame.
+		batch.clear();
+		for (size_t i = 0; i < meshCount; i++) batch.add(ranges[i], 1, (GLuint)i);
+		batch.submit(glState, arena, &instances);
+		glFinish();
+	};
+
+	std::printf("%zu meshes, %zu vertices, %zu index bytes, %d frames\n", meshCount,
+		arena.vertexBytes / MeshLayoutPacked::stride, arena.indexBytes, frames);
+	const char* names[3] = {"per-mesh", "command loop", "multi-draw"};
+	double perMeshRate = 0.0;
+	for (int path = 0; path < 3; path++) {
+		auto frame = [&]() {
+			if (path == 0) perMeshFrame();
+			else batchFrame(path == 1 ? loopBatch : multiDrawBatch);
+		};
+		frame(); // warm-up
+		double best = 1e30, total = 0.0;
+		for (int f = 0; f < frames; f++) {
+			auto start = std::chrono::steady_clock::now();
+			frame();
+			double ms = millisecondsSince(start);
+			total += ms;
+			if (ms < best) best = ms;
+		}
+		double rate = meshCount / best;
+		std::printf("  %-12s  best %9.3f ms  mean %9.3f ms  %10.1f meshes/ms", names[path], best, total / frames, rate);
+		if (path == 0) perMeshRate = rate;
+		else std::printf("  (%.1fx)", rate / perMeshRate);
+		std::printf("\n");
+	}
+
+	GLenum err = glGetError();
+	if (err != GL_NO_ERROR) std::printf("OpenGL error: %u\n", err);
+
+	loopBatch.destroy(glState);
+	multiDrawBatch.destroy(glState);
+	instances.destroy(glState);
+	arena.destroy(glState);
+	for (Mesh& mesh : meshes) mesh.destroy(glState);
+	glDeleteProgram(perMeshProgram);
+	glDeleteProgram(arenaProgram);
+	context.destroy();
+	return 0;
+}
@@ -0,0 +1,166 @@
+// Instancing benchmark
+// Draws N cubes two ways and reports instances per millisecond:
+//	per-object: one glUniformMatrix4fv + glDrawElements per cube (what 03_3Dcube did)
+//	instanced:  upload N matrices (orphaned buffer), then one glDrawElementsInstanced
+//	ring:       write N matrices into a persistent mapped RingBuffer, then one draw
+// The window is small and hidden to keep fill rate out of the picture.
+//
+// usage: bench_instancing [instances] [frames]
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../common/gl_state_cache.h"
+#include "../common/instancing.h"
+#include "../common/mesh_builder.h"
+#include "../common/ring_buffer.h"
+#include "bench_common.h"
+
+const char* perObjectVertexShader = R"(
+	#version 330 core
+	layout(location = 0) in vec3 vertexPosition_localspace;
+	layout(location = 1) in vec3 vertexColor;
+	out vec3 fragmentBaseColor;
+	uniform mat4 ViewProjection;
+	uniform mat4 Model;
+	void main(){
+		gl_Position = ViewProjection * Model * vec4(vertexPosition_localspace, 1.0);
+		fragmentBaseColor = vertexColor;
+	}
+)";
+
+const char* instancedVertexShader = R"(
+	#version 330 core
+	layout(location = 0) in vec3 vertexPosition_localspace;
+	layout(location = 1) in vec3 vertexColor;
+	layout(location = 3) in mat4 instanceModel;
+	out vec3 fragmentBaseColor;
+	uniform mat4 ViewProjection;
+	void main(){
+		gl_Position = ViewProjection * instanceModel * vec4(vertexPosition_localspace, 1.0);
+		fragmentBaseColor = vertexColor;
+	}
+)";
+
+const char* fragmentShader = R"(
+	#version 330 core
+	in vec3 fragmentBaseColor;
+	out vec4 fragmentColor;
+	void main(){
+		fragmentColor = vec4(fragmentBaseColor, 1.0);
+	}
+)";
+
+int main(int argc, char** argv)
+{
+	const size_t instanceCount = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 100000;
+	const int frames = argc > 2 ? std::atoi(argv[2]) : 10;
+
+	GLContext context;
+	if (!createBenchmarkContext(context, "bench_instancing", 256, 256)) return -1;
+
+	GLStateCache glState;
+	glState.enable(GL_DEPTH_TEST);
+
+	MeshBuilder cubeBuilder;
+	buildBox(cubeBuilder);
+	// Two copies of the mesh: only the instanced one gets the per-instance attribute.
+	Mesh perObjectMesh, instancedMesh;
+	perObjectMesh.upload<MeshLayoutPacked>(glState, cubeBuilder);
+	instancedMesh.upload<MeshLayoutPacked>(glState, cubeBuilder);
+	InstanceBuffer instances;
+	instances.create();
+	instances.attach(glState, instancedMesh);
+
+	GLuint perObjectProgram = buildProgram(perObjectVertexShader, fragmentShader);
+	GLuint instancedProgram = buildProgram(instancedVertexShader, fragmentShader);
+	GLint perObjectModel = glGetUniformLocation(perObjectProgram, "Model");
+
+	// Cubes on a square grid in front of the camera
+	const int side = (int)std::ceil(std::sqrt((double)instanceCount));
+	std::vector<glm::mat4> matrices(instanceCount);
+	for (size_t i = 0; i < instanceCount; i++) {
+		glm::vec3 position((float)(i % side) - side * 0.5f, (float)(i / side) - side * 0.5f, 0.0f);
+		matrices[i] = glm::translate(glm::mat4(1.0f), position * 1.5f);
+	}
+	glm::mat4 viewProjection = glm::perspective(glm::radians(45.0f), 1.0f, 0.1f, 10000.0f)
+		* glm::lookAt(glm::vec3(0.0f, 0.0f, side * 2.0f), glm::vec3(0.0f), glm::vec3(0, 1, 0));
+	for (GLuint program : {perObjectProgram, instancedProgram}) {
+		glState.useProgram(program);
+		glUniformMatrix4fv(glGetUniformLocation(program, "ViewProjection"), 1, GL_FALSE, glm::value_ptr(viewProjection));
+	}
+
+	RingBuffer ring;
+	ring.create(instanceCount * sizeof(glm::mat4) + 256);
+	RingBufferStats ringStats;
+
+	auto perObjectFrame = [&]() {
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glState.useProgram(perObjectProgram);
+		for (size_t i = 0; i < instanceCount; i++) {
+			glUniformMatrix4fv(perObjectModel, 1, GL_FALSE, glm::value_ptr(matrices[i]));
+			perObjectMesh.draw(glState);
+		}
+	};
+	auto instancedFrame = [&]() {
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glState.useProgram(instancedProgram);
+		// Matrices are streamed every frame, as they would be for moving objects.
+		instances.update(glState, matrices.data(), matrices.size());
+		instances.draw(glState, instancedMesh);
+	};
+	auto ringFrame = [&]() {
+		ring.beginFrame();
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glState.useProgram(instancedProgram);
+		instances.update(glState, ring, matrices.data(), matrices.size());
+		instances.draw(glState, instancedMesh);
+		RingBufferStats frame = ring.endFrame();
+		ringStats.stalls += frame.stalls;
+		ringStats.stallMilliseconds += frame.stallMilliseconds;
+	};
+
+	// Frames are submitted back to back with a single glFinish at the end, so the CPU
+	// can run ahead of the GPU exactly as far as each path allows.
+	std::printf("%zu instances, %d frames\n", instanceCount, frames);
+	const char* names[3] = {"per-object", "instanced", "ring"};
+	double perObjectRate = 0.0;
+	for (int path = 0; path < 3; path++) {
+		auto frame = [&]() {
+			if (path == 0) perObjectFrame();
+			else if (path == 1) instancedFrame();
+			else ringFrame();
+		};
+		frame(); // warm-up
+		glFinish();
+		ringStats = RingBufferStats();
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) frame();
+		glFinish();
+		double ms = millisecondsSince(start) / frames;
+		double rate = instanceCount / ms;
+		std::printf("  %-10s  %9.3f ms/frame  %10.1f instances/ms", names[path], ms, rate);
+		if (path == 0) perObjectRate = rate;
+		else std::printf("  (%.1fx)", rate / perObjectRate);
+		if (path == 2) std::printf("  %u stalls, %.3f ms waiting", ringStats.stalls, ringStats.stallMilliseconds);
+		std::printf("\n");
+	}
+
+	GLenum err = glGetError();
+	if (err != GL_NO_ERROR) std::printf("OpenGL error: %u\n", err);
+
+	instances.destroy(glState);
+	ring.destroy();
+	perObjectMesh.destroy(glState);
+	instancedMesh.destroy(glState);
+	glDeleteProgram(perObjectProgram);
+	glDeleteProgram(instancedProgram);
+	context.destroy();
+	return 0;
+}
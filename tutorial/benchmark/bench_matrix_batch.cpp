@@ -0,0 +1,201 @@
+// Batched matrix benchmark
+// Multiplies and inverts N matrices with glm one at a time and with matrix_batch.h at every
+// SIMD level the CPU supports:
+//	multiply:          out[i] = a[i] * b[i], general 4x4
+//	multiply affine:   the same on 4x3 affine matrices
+//	inverse:           general 4x4
+//	inverse affine:    4x3, plus the normal matrices read from it
+//	hierarchy:         world = world[parent] * local over a random tree, level by level
+// and validates every result against scalar glm. Both are measured against a double
+// precision reference, in ULPs of the reference's largest element (so a tiny element of a
+// large matrix isn't held to its own ULP). A kernel fails, and the program exits with 1, if
+// a matrix's error exceeds twice glm's float error on it plus a tolerance: FMA and the
+// evaluation order round differently, by about as much as the matrix's conditioning
+// already costs glm.
+// No GL context needed.
+//
+// build: c++ -std=c++17 -O2 -I../../dependencies/include bench_matrix_batch.cpp
+// usage: bench_matrix_batch [matrices] [passes]
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../common/matrix_batch.h"
+
+// Tolerances in ULPs over twice glm's own error (see above)
+const double MULTIPLY_ULPS = 8.0;
+const double INVERSE_ULPS = 16.0;
+const double HIERARCHY_ULPS = 32.0;
+
+template <typename Body>
+double bestMilliseconds(int passes, Body body) {
+	double best = 1e30;
+	for (int pass = 0; pass < passes; pass++) {
+		auto start = std::chrono::steady_clock::now();
+		body();
+		best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+	return best;
+}
+
+// Error of a float matrix in float ULPs of the reference's largest element
+template <int C, int R>
+double ulpError(const glm::mat<C, R, float>& value, const glm::mat<C, R, double>& reference) {
+	double largest = 0.0, error = 0.0;
+	for (int c = 0; c < C; c++) {
+		for (int r = 0; r < R; r++) {
+			largest = std::max(largest, std::fabs(reference[c][r]));
+			error = std::max(error, std::fabs(value[c][r] - reference[c][r]));
+		}
+	}
+	float ulp = std::nextafter((float)largest, INFINITY) - (float)largest;
+	return error / ulp;
+}
+
+// Largest errors of one kernel and of glm on the same matrices
+struct Check {
+	double tolerance;
+	double kernelUlps = 0.0, glmUlps = 0.0;
+	bool pass = true;
+
+	template <int C, int R>
+	void add(const glm::mat<C, R, float>& kernel, const glm::mat<C, R, float>& glmResult, const glm::mat<C, R, double>& reference) {
+		double kernelError = ulpError(kernel, reference), glmError = ulpError(glmResult, reference);
+		kernelUlps = std::max(kernelUlps, kernelError);
+		glmUlps = std::max(glmUlps, glmError);
+		pass = pass && kernelError <= 2.0 * glmError + tolerance;
+	}
+};
+
+bool failed = false;
+
+void report(const char* name, size_t count, double milliseconds, double glmMilliseconds, const Check& check) {
+	failed |= !check.pass;
+	if (milliseconds > 0.0) {
+		std::printf("  %-20s %9.3f ms %8.1f Mmatrices/s %6.2fx glm", name, milliseconds, count / milliseconds / 1e3, glmMilliseconds / milliseconds);
+	} else {
+		std::printf("  %-20s %50s", name, "");
+	}
+	std::printf("   max %5.1f ulp (glm %5.1f) %s\n", check.kernelUlps, check.glmUlps, check.pass ? "" : "FAILED");
+}
+
+int main(int argc, char** argv)
+{
+	const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+	const int passes = argc > 2 ? std::atoi(argv[2]) : 5;
+
+	// Rotation * scale * translation, and the same with a small projective last row
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	auto randomAffine = [&]() {
+		glm::vec3 axis = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(0.0f, 0.0f, 1e-3f));
+		glm::mat4 m = glm::translate(glm::mat4(1.0f), 10.0f * glm::vec3(unit(random), unit(random), unit(random)));
+		m = glm::rotate(m, 3.14159f * unit(random), axis);
+		return glm::scale(m, glm::vec3(1.25f + 0.75f * unit(random), 1.25f + 0.75f * unit(random), 1.25f + 0.75f * unit(random)));
+	};
+	std::vector<glm::mat4> a(count), b(count), general(count), affine(count), out(count);
+	for (size_t i = 0; i < count; i++) {
+		a[i] = randomAffine();
+		b[i] = randomAffine();
+		general[i] = a[i];
+		for (int c = 0; c < 3; c++) general[i][c][3] = 0.01f * unit(random);
+		affine[i] = b[i];
+	}
+
+	// A random tree, breadth first: each node's parent is on the previous level
+	std::vector<uint32_t> parent(count);
+	std::vector<size_t> levelBegin = {0, std::min<size_t>(count, 16)};
+	while (levelBegin.back() < count) {
+		size_t previous = levelBegin[levelBegin.size() - 2], begin = levelBegin.back();
+		size_t end = std::min(count, begin + (begin - previous) * 4);
+		for (size_t i = begin; i < end; i++) parent[i] = (uint32_t)(previous + random() % (begin - previous));
+		levelBegin.push_back(end);
+	}
+
+	// Double precision references
+	std::vector<glm::dmat4> exactProduct(count), exactProductAffine(count), exactInverse(count), exactInverseAffine(count), exactWorld(count);
+	std::vector<glm::dmat3> exactNormal(count);
+	for (size_t i = 0; i < count; i++) {
+		exactProduct[i] = glm::dmat4(general[i]) * glm::dmat4(b[i]);
+		exactProductAffine[i] = glm::dmat4(a[i]) * glm::dmat4(b[i]);
+		exactInverse[i] = glm::inverse(glm::dmat4(general[i]));
+		exactInverseAffine[i] = glm::inverse(glm::dmat4(affine[i]));
+		exactNormal[i] = glm::transpose(glm::inverse(glm::dmat3(glm::dmat4(affine[i]))));
+		exactWorld[i] = i < levelBegin[1] ? glm::dmat4(a[i]) : exactWorld[parent[i]] * glm::dmat4(a[i]);
+	}
+
+	// glm, one matrix at a time
+	std::vector<glm::mat4> product(count), productAffine(count), inverse(count), inverseAffine(count), world(count);
+	double glmMultiply = bestMilliseconds(passes, [&]() { for (size_t i = 0; i < count; i++) product[i] = general[i] * b[i]; });
+	double glmMultiplyAffine = bestMilliseconds(passes, [&]() { for (size_t i = 0; i < count; i++) productAffine[i] = a[i] * b[i]; });
+	double glmInverse = bestMilliseconds(passes, [&]() { for (size_t i = 0; i < count; i++) inverse[i] = glm::inverse(general[i]); });
+	double glmInverseAffine = bestMilliseconds(passes, [&]() { for (size_t i = 0; i < count; i++) inverseAffine[i] = glm::inverse(affine[i]); });
+	double glmHierarchy = bestMilliseconds(passes, [&]() {
+		for (size_t i = 0; i < levelBegin[1]; i++) world[i] = a[i];
+		for (size_t i = levelBegin[1]; i < count; i++) world[i] = world[parent[i]] * a[i];
+	});
+	std::vector<glm::mat3> normal(count);
+	for (size_t i = 0; i < count; i++) normal[i] = glm::transpose(glm::inverse(glm::mat3(affine[i])));
+	std::printf("%zu matrices, %zu hierarchy levels\n", count, levelBegin.size() - 1);
+	std::printf("  %-24s %9.3f ms\n  %-24s %9.3f ms\n  %-24s %9.3f ms\n  %-24s %9.3f ms\n  %-24s %9.3f ms\n",
+		"glm multiply", glmMultiply, "glm multiply affine", glmMultiplyAffine, "glm inverse", glmInverse,
+		"glm inverse affine", glmInverseAffine, "glm hierarchy", glmHierarchy);
+
+	Mat4Array generalArray, bArray, outArray;
+	Affine4x3Array aAffine, bAffine, outAffine;
+	for (Mat4Array* array : {&generalArray, &bArray, &outArray}) array->resize(count);
+	for (Affine4x3Array* array : {&aAffine, &bAffine, &outAffine}) array->resize(count);
+	for (size_t i = 0; i < count; i++) {
+		generalArray.set(i, general[i]);
+		bArray.set(i, b[i]);
+		aAffine.set(i, a[i]);
+		bAffine.set(i, b[i]);
+	}
+
+	for (int level = SIMD_SCALAR; level <= detectSimdLevel(); level++) {
+		MatrixBatchKernels kernels = matrixBatchKernels((SimdLevel)level);
+		if (kernels.level != level) continue; // not compiled in
+		std::printf("%s, %d matrices per step\n", simdLevelName(kernels.level), kernels.width);
+
+		double milliseconds = bestMilliseconds(passes, [&]() {
+			kernels.multiply(generalArray.data.data(), nullptr, bArray.data.data(), outArray.data.data(), 0, count);
+		});
+		Check check{MULTIPLY_ULPS};
+		for (size_t i = 0; i < count; i++) check.add(outArray.get(i), product[i], exactProduct[i]);
+		report("multiply", count, milliseconds, glmMultiply, check);
+
+		milliseconds = bestMilliseconds(passes, [&]() {
+			kernels.multiplyAffine(aAffine.data.data(), nullptr, bAffine.data.data(), outAffine.data.data(), 0, count);
+		});
+		check = Check{MULTIPLY_ULPS};
+		for (size_t i = 0; i < count; i++) check.add(outAffine.get(i), productAffine[i], exactProductAffine[i]);
+		report("multiply affine", count, milliseconds, glmMultiplyAffine, check);
+
+		milliseconds = bestMilliseconds(passes, [&]() { kernels.inverse(generalArray.data.data(), outArray.data.data(), 0, count); });
+		check = Check{INVERSE_ULPS};
+		for (size_t i = 0; i < count; i++) check.add(outArray.get(i), inverse[i], exactInverse[i]);
+		report("inverse", count, milliseconds, glmInverse, check);
+
+		milliseconds = bestMilliseconds(passes, [&]() { kernels.inverseAffine(bAffine.data.data(), outAffine.data.data(), 0, count); });
+		check = Check{INVERSE_ULPS};
+		Check normalCheck{INVERSE_ULPS};
+		for (size_t i = 0; i < count; i++) {
+			check.add(outAffine.get(i), inverseAffine[i], exactInverseAffine[i]);
+			normalCheck.add(outAffine.normalMatrix(i), normal[i], exactNormal[i]);
+		}
+		report("inverse affine", count, milliseconds, glmInverseAffine, check);
+		report("  normal matrices", count, 0.0, 0.0, normalCheck);
+
+		milliseconds = bestMilliseconds(passes, [&]() { updateWorldMatrices(aAffine, parent.data(), levelBegin, outAffine, kernels.level); });
+		check = Check{HIERARCHY_ULPS};
+		for (size_t i = 0; i < count; i++) check.add(outAffine.get(i), world[i], exactWorld[i]);
+		report("hierarchy", count, milliseconds, glmHierarchy, check);
+	}
+	return failed ? 1 : 0;
+}
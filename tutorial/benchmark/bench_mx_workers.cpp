@@ -0,0 +1,263 @@
+// Multi-context render workers benchmark
+// Runs 1, 2, 4 ... W offscreen render workers in one process, each on its own thread with
+// its own EGL context and its own GladGLContext dispatch table (gladLoadGLContext), so that
+// no worker reads or writes the glad_gl* globals. Every worker draws F frames of layered
+// full screen triangles into its own framebuffer in a colour of its own, then reads a pixel
+// back and checks the colour.
+// Reports the time to create and load a context, and frames per second summed over the
+// workers. Exits with 1 if a worker fails or the glad_gl* globals were touched.
+//
+// EGL only (no GLFW window needed): link with -lEGL, like the headless build.
+// build: c++ -std=c++17 -O2 -I../../dependencies/include bench_mx_workers.cpp ../../gl.c -lEGL -lpthread
+// usage: bench_mx_workers [workers] [frames]
+#include <glad/gl.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+const int WIDTH = 256, HEIGHT = 256;
+const int LAYERS = 16;
+
+const char* vertexShader = R"(
+	#version 330 core
+	uniform float depth;
+	void main(){
+		vec2 position = vec2((gl_VertexID & 1) * 4.0 - 1.0, (gl_VertexID >> 1) * 4.0 - 1.0);
+		gl_Position = vec4(position, depth, 1.0);
+	}
+)";
+
+const char* fragmentShader = R"(
+	#version 330 core
+	uniform vec3 tint;
+	out vec4 color;
+	void main(){
+		color = vec4(tint, 1.0);
+	}
+)";
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+GLADapiproc loadEGLProc(const char* name) {
+	return (GLADapiproc)eglGetProcAddress(name);
+}
+
+bool hasExtension(const char* extensions, const char* name) {
+	if (!extensions) return false;
+	size_t length = std::strlen(name);
+	for (const char* p = std::strstr(extensions, name); p; p = std::strstr(p + length, name)) {
+		if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) return true;
+	}
+	return false;
+}
+
+// The display and config are shared by all workers; contexts and surfaces are per worker.
+struct Display {
+	EGLDisplay display = EGL_NO_DISPLAY;
+	EGLConfig config = nullptr;
+	bool surfaceless = false;
+
+	bool create() {
+		const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+			(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay && hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+			display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		}
+		if (display == EGL_NO_DISPLAY) display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		EGLint major = 0, minor = 0;
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+			std::printf("Failed to initialize EGL\n");
+			return false;
+		}
+		surfaceless = hasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+		const EGLint configAttributes[] = {
+			EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_NONE
+		};
+		EGLint configCount = 0;
+		if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0) {
+			std::printf("No suitable EGL config\n");
+			return false;
+		}
+		return true;
+	}
+
+	void destroy() {
+		if (display != EGL_NO_DISPLAY) eglTerminate(display);
+		display = EGL_NO_DISPLAY;
+	}
+};
+
+// One worker's context, dispatch table and render target, all used from its thread only.
+struct Worker {
+	EGLContext context = EGL_NO_CONTEXT;
+	EGLSurface surface = EGL_NO_SURFACE;
+	GladGLContext gl = {};
+	GLuint fbo = 0, renderbuffer = 0, program = 0, vao = 0;
+	GLint depthLocation = -1;
+	double setupMilliseconds = 0.0;
+	bool ok = false;
+
+	bool create(const Display& display) {
+		auto start = std::chrono::steady_clock::now();
+		// The bound API is per thread
+		if (!eglBindAPI(EGL_OPENGL_API)) return false;
+		const EGLint contextAttributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 3,
+			EGL_CONTEXT_MINOR_VERSION, 3,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		context = eglCreateContext(display.display, display.config, EGL_NO_CONTEXT, contextAttributes);
+		if (context == EGL_NO_CONTEXT) return false;
+		if (!display.surfaceless) {
+			const EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+			surface = eglCreatePbufferSurface(display.display, display.config, pbufferAttributes);
+			if (surface == EGL_NO_SURFACE) return false;
+		}
+		if (!eglMakeCurrent(display.display, surface, surface, context)) return false;
+		if (!gladLoadGLContext(&gl, loadEGLProc) || !gl.VERSION_3_3) return false;
+		setupMilliseconds = millisecondsSince(start);
+
+		gl.GenRenderbuffers(1, &renderbuffer);
+		gl.BindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+		gl.RenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, WIDTH, HEIGHT);
+		gl.GenFramebuffers(1, &fbo);
+		gl.BindFramebuffer(GL_FRAMEBUFFER, fbo);
+		gl.FramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+		if (gl.CheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) return false;
+		gl.Viewport(0, 0, WIDTH, HEIGHT);
+
+		program = buildProgram();
+		if (!program) return false;
+		depthLocation = gl.GetUniformLocation(program, "depth");
+		gl.GenVertexArrays(1, &vao);
+		return true;
+	}
+
+	GLuint buildProgram() {
+		GLuint shaders[2] = {gl.CreateShader(GL_VERTEX_SHADER), gl.CreateShader(GL_FRAGMENT_SHADER)};
+		const char* sources[2] = {vertexShader, fragmentShader};
+		GLuint linked = gl.CreateProgram();
+		for (int i = 0; i < 2; i++) {
+			gl.ShaderSource(shaders[i], 1, &sources[i], NULL);
+			gl.CompileShader(shaders[i]);
+			gl.AttachShader(linked, shaders[i]);
+		}
+		gl.LinkProgram(linked);
+		gl.DeleteShader(shaders[0]);
+		gl.DeleteShader(shaders[1]);
+		GLint status = GL_FALSE;
+		gl.GetProgramiv(linked, GL_LINK_STATUS, &status);
+		return status ? linked : 0;
+	}
+
+	// Draws the frames in the worker's colour and checks the result
+	void render(int frames, const float* tint) {
+		gl.UseProgram(program);
+		gl.Uniform3f(gl.GetUniformLocation(program, "tint"), tint[0], tint[1], tint[2]);
+		gl.BindVertexArray(vao);
+		for (int frame = 0; frame < frames; frame++) {
+			gl.ClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+			gl.Clear(GL_COLOR_BUFFER_BIT);
+			for (int layer = 0; layer < LAYERS; layer++) {
+				gl.Uniform1f(depthLocation, 1.0f - 2.0f * layer / LAYERS);
+				gl.DrawArrays(GL_TRIANGLES, 0, 3);
+			}
+			gl.Finish();
+		}
+		unsigned char pixel[4];
+		gl.ReadPixels(WIDTH / 2, HEIGHT / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+		ok = gl.GetError() == GL_NO_ERROR;
+		for (int c = 0; c < 3; c++) ok &= std::abs(pixel[c] - (int)(tint[c] * 255.0f + 0.5f)) <= 1;
+	}
+
+	void destroy(const Display& display) {
+		if (context == EGL_NO_CONTEXT) return;
+		if (program) {
+			gl.DeleteVertexArrays(1, &vao);
+			gl.DeleteProgram(program);
+			gl.DeleteFramebuffers(1, &fbo);
+			gl.DeleteRenderbuffers(1, &renderbuffer);
+		}
+		gladUnloadGLContext(&gl);
+		eglMakeCurrent(display.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		eglDestroyContext(display.display, context);
+		if (surface != EGL_NO_SURFACE) eglDestroySurface(display.display, surface);
+		context = EGL_NO_CONTEXT;
+		eglReleaseThread();
+	}
+};
+
+// Creates count workers on their threads, starts them together once all are loaded and
+// returns the time until the last one finished rendering.
+double run(const Display& display, int count, int frames, double& setupMilliseconds, int& failures) {
+	std::vector<Worker> workers(count);
+	std::vector<std::thread> threads;
+	std::atomic<int> ready(0);
+	std::atomic<bool> go(false);
+	for (int w = 0; w < count; w++) {
+		threads.emplace_back([&, w]() {
+			Worker& worker = workers[w];
+			bool created = worker.create(display);
+			ready++;
+			while (!go) std::this_thread::yield();
+			if (created) {
+				float tint[3] = {(float)((w + 1) & 1), (float)(((w + 1) >> 1) & 1), (float)(w % 5) / 4.0f};
+				worker.render(frames, tint);
+			}
+			worker.destroy(display);
+		});
+	}
+	while (ready < count) std::this_thread::yield();
+	auto start = std::chrono::steady_clock::now();
+	go = true;
+	for (std::thread& thread : threads) thread.join();
+	double ms = millisecondsSince(start);
+	setupMilliseconds = 0.0;
+	for (const Worker& worker : workers) {
+		setupMilliseconds += worker.setupMilliseconds / count;
+		failures += !worker.ok;
+	}
+	return ms;
+}
+
+int main(int argc, char** argv)
+{
+	const int maxWorkers = argc > 1 ? std::atoi(argv[1]) : (int)std::max(2u, std::thread::hardware_concurrency());
+	const int frames = argc > 2 ? std::atoi(argv[2]) : 200;
+
+	Display display;
+	if (!display.create()) return 1;
+	std::printf("%d frames of %dx%d, %d layers, per worker\n", frames, WIDTH, HEIGHT, LAYERS);
+	int failures = 0;
+	double single = 0.0;
+	for (int count = 1;; count = std::min(count * 2, maxWorkers)) {
+		double setup = 0.0;
+		int failed = 0;
+		double ms = run(display, count, frames, setup, failed);
+		double framesPerSecond = count * frames / ms * 1e3;
+		if (count == 1) single = framesPerSecond;
+		std::printf("  %2d workers: context + load %6.2f ms, %8.1f frames/s (%.2fx one worker)%s\n", count, setup, framesPerSecond,
+			framesPerSecond / single, failed ? "  FAILED" : "");
+		failures += failed;
+		if (count >= maxWorkers) break;
+	}
+	display.destroy();
+
+	// Everything went through the workers' tables
+	bool globalsUntouched = glad_glClear == NULL && !GLAD_GL_VERSION_1_0;
+	std::printf("glad_gl* globals %s\n", globalsUntouched ? "untouched" : "were loaded FAILED");
+	return failures || !globalsUntouched ? 1 : 0;
+}
@@ -0,0 +1,133 @@
+// Framebuffer readback benchmark
+// Renders frames into an offscreen RGBA8 framebuffer and reads every one of them back:
+//	glReadPixels: straight into client memory, then processed on the render thread
+//	PBO ring:     FrameReadback (3 pixel pack buffers + fences), processed on a consumer thread
+// "Processing" sums every 32-bit word of the frame, so each byte is actually read.
+// Reports frames per second at 1080p and 4K.
+//
+// usage: bench_readback [frames]
+#include <glad/gl.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../common/frame_readback.h"
+#include "bench_common.h"
+
+const char* vertexShader = R"(
+	#version 330 core
+	uniform float time;
+	out vec3 color;
+	void main(){
+		// One full screen triangle whose colour changes every frame
+		vec2 position = vec2((gl_VertexID & 1) * 4.0 - 1.0, (gl_VertexID >> 1) * 4.0 - 1.0);
+		gl_Position = vec4(position, 0.0, 1.0);
+		color = vec3(0.5 + 0.5 * sin(time + position.x), 0.5 + 0.5 * cos(time + position.y), 0.5);
+	}
+)";
+
+const char* fragmentShader = R"(
+	#version 330 core
+	in vec3 color;
+	out vec4 fragmentColor;
+	void main(){
+		fragmentColor = vec4(color, 1.0);
+	}
+)";
+
+uint32_t checksum(const unsigned char* pixels, size_t bytes) {
+	const uint32_t* words = (const uint32_t*)pixels;
+	uint32_t sum = 0;
+	for (size_t i = 0; i < bytes / 4; i++) sum += words[i];
+	return sum;
+}
+
+int main(int argc, char** argv)
+{
+	const int frames = argc > 1 ? std::atoi(argv[1]) : 60;
+
+	GLContext context;
+	if (!createBenchmarkContext(context, "bench_readback", 64, 64)) return -1;
+
+	GLuint program = buildProgram(vertexShader, fragmentShader);
+	GLint timeLocation = glGetUniformLocation(program, "time");
+	GLuint vertexArray;
+	glGenVertexArrays(1, &vertexArray);
+	glBindVertexArray(vertexArray);
+	glUseProgram(program);
+
+	const int sizes[2][2] = {{1920, 1080}, {3840, 2160}};
+	for (const auto& size : sizes) {
+		const int width = size[0], height = size[1];
+		const size_t bytes = (size_t)width * height * 4;
+
+		GLuint renderbuffer, framebuffer;
+		glGenRenderbuffers(1, &renderbuffer);
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glGenFramebuffers(1, &framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+		glViewport(0, 0, width, height);
+
+		int frame = 0;
+		auto render = [&]() {
+			glUniform1f(timeLocation, frame++ * 0.1f);
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+		};
+
+		std::printf("%dx%d, %d frames\n", width, height, frames);
+
+		// Synchronous: every glReadPixels waits for the frame to finish rendering.
+		std::vector<unsigned char> pixels(bytes);
+		uint32_t syncSum = 0;
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+		render();
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+		frame = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) {
+			render();
+			glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+			syncSum += checksum(pixels.data(), bytes);
+		}
+		double syncMs = millisecondsSince(start);
+		std::printf("  glReadPixels  %8.2f frames/s  %8.1f MB/s\n", frames * 1000.0 / syncMs, frames * bytes / (syncMs * 1000.0));
+
+		// Asynchronous: frames reach the consumer thread two frames later, straight from the PBO.
+		uint32_t asyncSum = 0;
+		FrameReadback readback;
+		readback.create(width, height, [&](const CapturedFrame& captured) {
+			asyncSum += checksum(captured.pixels, captured.stride * captured.height);
+		});
+		frame = 0;
+		start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++) {
+			render();
+			readback.capture(framebuffer);
+		}
+		readback.finish();
+		double asyncMs = millisecondsSince(start);
+		ReadbackStats stats = readback.endFrame();
+		readback.destroy();
+		std::printf("  PBO ring      %8.2f frames/s  %8.1f MB/s  (%.1fx, %s)\n", frames * 1000.0 / asyncMs,
+			frames * bytes / (asyncMs * 1000.0), syncMs / asyncMs, GLAD_GL_VERSION_4_4 ? "persistent" : "map per frame");
+		stats.print("  PBO ring");
+		if (stats.delivered != (unsigned int)frames) std::printf("  %u of %d frames delivered!\n", stats.delivered, frames);
+		if (syncSum != asyncSum) std::printf("  checksums differ: %08x %08x\n", syncSum, asyncSum);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, context.framebuffer());
+		glDeleteFramebuffers(1, &framebuffer);
+		glDeleteRenderbuffers(1, &renderbuffer);
+	}
+
+	GLenum err = glGetError();
+	if (err != GL_NO_ERROR) std::printf("OpenGL error: %u\n", err);
+
+	glDeleteVertexArrays(1, &vertexArray);
+	glDeleteProgram(program);
+	context.destroy();
+	return 0;
+}
@@ -0,0 +1,126 @@
+// Vertex normal format benchmark
+// Packs N random unit normals with the normal formats of vertex_layout.h:
+//	Snorm3x10_1x2:   10 bits per component
+//	Octahedral2x16:  octahedral encoding, 16 bits per component
+// decodes them the way the vertex fetch and the shader do (snorm expansion, then normalize,
+// or OCTAHEDRAL_DECODE_GLSL) and reports ns per normal packed and the mean and largest
+// angle between a normal and its decoded value.
+// Checks the octahedral edge cases: the axes and the fold diagonals must come back within
+// the format's error, and zero, NaN and infinite normals (degenerate triangles give zero)
+// must decode to +Z rather than NaN. Exits with 1 if one doesn't. No GL context needed.
+//
+// build: c++ -std=c++17 -O2 -I../../dependencies/include bench_vertex_formats.cpp
+// usage: bench_vertex_formats [normals]
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../common/vertex_layout.h"
+
+// Largest angle (degrees) a decoded normal may be off by
+const double SNORM10_TOLERANCE = 0.2;
+const double OCTAHEDRAL_TOLERANCE = 0.01;
+
+template <typename Format>
+glm::vec3 decode(typename Format::Stored stored);
+
+template <>
+glm::vec3 decode<Snorm3x10_1x2>(glm::uint32 stored) {
+	return glm::normalize(glm::vec3(glm::unpackSnorm3x10_1x2(stored)));
+}
+
+// OCTAHEDRAL_DECODE_GLSL
+template <>
+glm::vec3 decode<Octahedral2x16>(glm::uint32 stored) {
+	glm::vec2 e = glm::unpackSnorm2x16(stored);
+	glm::vec3 n(e, 1.0f - std::fabs(e.x) - std::fabs(e.y));
+	if (n.z < 0.0f) {
+		glm::vec2 folded = (1.0f - glm::abs(glm::vec2(n.y, n.x))) * glm::vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.y >= 0.0f ? 1.0f : -1.0f);
+		n.x = folded.x;
+		n.y = folded.y;
+	}
+	return glm::normalize(n);
+}
+
+double angleDegrees(const glm::vec3& a, const glm::vec3& b) {
+	double cosine = glm::dot(glm::dvec3(a), glm::dvec3(b)) / (glm::length(glm::dvec3(a)) * glm::length(glm::dvec3(b)));
+	return std::acos(std::min(1.0, std::max(-1.0, cosine))) * 180.0 / 3.14159265358979323846;
+}
+
+bool failed = false;
+
+template <typename Format>
+void run(const char* name, const std::vector<glm::vec3>& normals, double tolerance) {
+	std::vector<typename Format::Stored> stored(normals.size());
+	double best = 1e30;
+	for (int pass = 0; pass < 5; pass++) {
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < normals.size(); i++) stored[i] = Format::pack(normals[i]);
+		best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+	}
+	double sum = 0.0, largest = 0.0;
+	for (size_t i = 0; i < normals.size(); i++) {
+		double angle = angleDegrees(normals[i], decode<Format>(stored[i]));
+		if (!(angle <= largest)) largest = angle;  // NaN sticks
+		sum += angle;
+	}
+	bool ok = largest <= tolerance;
+	std::printf("  %-16s %6.2f ns/normal  mean %.5f deg  max %.5f deg%s\n", name, best / normals.size(), sum / normals.size(), largest,
+		ok ? "" : "  FAILED");
+	if (!ok) failed = true;
+}
+
+void check(const char* name, const glm::vec3& normal, const glm::vec3& expected) {
+	glm::vec3 decoded = decode<Octahedral2x16>(Octahedral2x16::pack(normal));
+	double angle = angleDegrees(decoded, expected);
+	if (std::isfinite(decoded.x) && std::isfinite(decoded.y) && std::isfinite(decoded.z) && angle <= OCTAHEDRAL_TOLERANCE) return;
+	std::printf("  octahedral %s: (%g, %g, %g) decoded to (%g, %g, %g)  FAILED\n", name, normal.x, normal.y, normal.z, decoded.x,
+		decoded.y, decoded.z);
+	failed = true;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+	std::mt19937 random(1);
+	std::normal_distribution<float> gaussian;
+	std::vector<glm::vec3> normals(count);
+	for (glm::vec3& normal : normals) {
+		do {
+			normal = glm::vec3(gaussian(random), gaussian(random), gaussian(random));
+		} while (glm::dot(normal, normal) < 1e-6f);
+		normal = glm::normalize(normal);
+	}
+
+	std::printf("%zu random unit normals\n", count);
+	run<Snorm3x10_1x2>("Snorm3x10_1x2", normals, SNORM10_TOLERANCE);
+	run<Octahedral2x16>("Octahedral2x16", normals, OCTAHEDRAL_TOLERANCE);
+
+	const glm::vec3 up(0.0f, 0.0f, 1.0f);
+	for (int axis = 0; axis < 3; axis++) {
+		for (float sign : {1.0f, -1.0f}) {
+			glm::vec3 direction(0.0f);
+			direction[axis] = sign;
+			check("axis", direction, direction);
+		}
+	}
+	for (float x : {1.0f, -1.0f}) {
+		for (float y : {1.0f, -1.0f}) {
+			check("diagonal", glm::vec3(x, y, 0.0f), glm::vec3(x, y, 0.0f));
+			check("diagonal", glm::vec3(x, y, -1.0f), glm::vec3(x, y, -1.0f));
+		}
+	}
+	check("zero", glm::vec3(0.0f), up);
+	check("negative zero", glm::vec3(-0.0f), up);
+	check("NaN", glm::vec3(NAN, 0.0f, 1.0f), up);
+	check("infinity", glm::vec3(INFINITY, 0.0f, 0.0f), up);
+	std::printf("  octahedral edge cases %s\n", failed ? "FAILED" : "ok");
+	return failed ? 1 : 0;
+}
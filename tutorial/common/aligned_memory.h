@@ -0,0 +1,57 @@
+#pragma once
+// Aligned allocation for SIMD streams
+// Arrays handed to the SIMD kernels start on a cache line, so a vector load never straddles
+// two lines (a 64-byte AVX-512 load would straddle on every other element otherwise).
+// AlignedVector<T> is a std::vector that allocates that way.
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+const size_t SIMD_ALIGNMENT = 64;
+
+// nullptr on failure, like malloc. Free with alignedFree.
+inline void* alignedAllocate(size_t bytes, size_t alignment = SIMD_ALIGNMENT) {
+#if defined(_MSC_VER)
+	return _aligned_malloc(bytes ? bytes : 1, alignment);
+#else
+	void* pointer = nullptr;
+	if (posix_memalign(&pointer, alignment, bytes ? bytes : 1) != 0) return nullptr;
+	return pointer;
+#endif
+}
+
+inline void alignedFree(void* pointer) {
+#if defined(_MSC_VER)
+	_aligned_free(pointer);
+#else
+	std::free(pointer);
+#endif
+}
+
+template <typename T>
+struct AlignedAllocator {
+	typedef T value_type;
+
+	AlignedAllocator() = default;
+	template <typename U>
+	AlignedAllocator(const AlignedAllocator<U>&) {}
+
+	T* allocate(size_t count) {
+		void* pointer = alignedAllocate(count * sizeof(T));
+		if (!pointer) throw std::bad_alloc();
+		return (T*)pointer;
+	}
+	void deallocate(T* pointer, size_t) { alignedFree(pointer); }
+
+	template <typename U>
+	bool operator==(const AlignedAllocator<U>&) const { return true; }
+	template <typename U>
+	bool operator!=(const AlignedAllocator<U>&) const { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
@@ -0,0 +1,139 @@
+#pragma once
+// Batch point transforms over SoA streams
+// glm::mat4 * glm::vec4 transforms one point per call and fills one SSE register at best.
+// Here the points are stored as separate x, y, z (and optionally w) arrays, so a register
+// holds the same component of 4, 8 or 16 points and the matrix is applied to all of them
+// with one broadcast column per element: 12 (or 16) multiply-adds per WIDTH points.
+// The kernels are compiled per instruction set (SSE, AVX2 + FMA, AVX-512) and dispatched at
+// run time like the Phong kernels (see simd_dispatch.h). transformVec4s is the AoS baseline:
+// glm_mat4_mul_vec4 from glm/simd/matrix.h when GLM is built with intrinsics
+// (GLM_FORCE_INTRINSICS), glm::mat4 * glm::vec4 otherwise.
+//
+// Streams should come from AlignedVector (aligned_memory.h); any alignment works.
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#include "aligned_memory.h"
+#include "simd_dispatch.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#include <glm/simd/matrix.h>
+#endif
+
+// A stream of points. Without a w array, inputs are points (x, y, z, 1) and an output's w
+// is not stored.
+struct SoAConstPoints {
+	const float* x = nullptr;
+	const float* y = nullptr;
+	const float* z = nullptr;
+	const float* w = nullptr;
+};
+
+struct SoAPoints {
+	float* x = nullptr;
+	float* y = nullptr;
+	float* z = nullptr;
+	float* w = nullptr;
+
+	operator SoAConstPoints() const {
+		SoAConstPoints points;
+		points.x = x;
+		points.y = y;
+		points.z = z;
+		points.w = w;
+		return points;
+	}
+};
+
+// Owns aligned streams; points() views them.
+struct SoAPointArray {
+	AlignedVector<float> x, y, z, w;
+
+	void resize(size_t count, bool withW) {
+		x.resize(count);
+		y.resize(count);
+		z.resize(count);
+		w.resize(withW ? count : 0);
+	}
+	size_t size() const { return x.size(); }
+
+	SoAPoints points() {
+		SoAPoints points;
+		points.x = x.data();
+		points.y = y.data();
+		points.z = z.data();
+		points.w = w.empty() ? nullptr : w.data();
+		return points;
+	}
+};
+
+namespace batch_transform_scalar {
+#include "batch_transform.inl"
+}
+
+#if SIMD_DISPATCH_X86
+SIMD_TARGET_SSE41
+namespace batch_transform_sse41 {
+#define SIMD_LANES_SSE41
+#include "batch_transform.inl"
+#undef SIMD_LANES_SSE41
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX2
+namespace batch_transform_avx2 {
+#define SIMD_LANES_AVX2
+#include "batch_transform.inl"
+#undef SIMD_LANES_AVX2
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX512
+namespace batch_transform_avx512 {
+#define SIMD_LANES_AVX512
+#include "batch_transform.inl"
+#undef SIMD_LANES_AVX512
+}
+SIMD_TARGET_END
+#endif
+
+// The kernel for one level (clamped to what was compiled in).
+struct BatchTransformKernel {
+	SimdLevel level;
+	int width; // points per step
+	void (*transform)(const float* matrix, const SoAConstPoints& in, const SoAPoints& out, size_t count);
+};
+
+inline BatchTransformKernel batchTransformKernel(SimdLevel level = simdLevel()) {
+#if SIMD_DISPATCH_X86
+	if (level >= SIMD_AVX512) return {SIMD_AVX512, batch_transform_avx512::WIDTH, batch_transform_avx512::transform};
+	if (level >= SIMD_AVX2) return {SIMD_AVX2, batch_transform_avx2::WIDTH, batch_transform_avx2::transform};
+	if (level >= SIMD_SSE41) return {SIMD_SSE41, batch_transform_sse41::WIDTH, batch_transform_sse41::transform};
+#endif
+	return {SIMD_SCALAR, batch_transform_scalar::WIDTH, batch_transform_scalar::transform};
+}
+
+// out = matrix * in for count points. out may be in; its streams must not otherwise overlap.
+inline void transformPoints(const glm::mat4& matrix, const SoAConstPoints& in, const SoAPoints& out, size_t count) {
+	static const BatchTransformKernel kernel = batchTransformKernel();
+	kernel.transform(glm::value_ptr(matrix), in, out, count);
+}
+
+inline void transformPointsInPlace(const glm::mat4& matrix, const SoAPoints& points, size_t count) {
+	transformPoints(matrix, points, points, count);
+}
+
+// AoS: out[i] = matrix * in[i], one point per call.
+inline void transformVec4s(const glm::mat4& matrix, const glm::vec4* in, glm::vec4* out, size_t count) {
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	glm_vec4 columns[4];
+	for (int c = 0; c < 4; c++) columns[c] = _mm_loadu_ps(glm::value_ptr(matrix[c]));
+	for (size_t i = 0; i < count; i++) {
+		_mm_storeu_ps(glm::value_ptr(out[i]), glm_mat4_mul_vec4(columns, _mm_loadu_ps(glm::value_ptr(in[i]))));
+	}
+#else
+	for (size_t i = 0; i < count; i++) out[i] = matrix * in[i];
+#endif
+}
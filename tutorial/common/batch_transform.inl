@@ -0,0 +1,42 @@
+// Batch transform kernels, compiled once per instruction set (see simd_lanes.inl).
+// No include guard on purpose.
+#include "simd_lanes.inl"
+
+// m is column-major, as glm::value_ptr gives it: column c is m[4c .. 4c+3].
+template <bool IN_W, bool OUT_W>
+inline void transformRange(const float* m, const SoAConstPoints& in, const SoAPoints& out, size_t count) {
+	Lanes column[16];
+	for (int i = 0; i < 16; i++) column[i] = broadcast(m[i]);
+	const Lanes one = broadcast(1.0f);
+
+	// Every input of a step is loaded before anything is stored, so in == out is fine.
+	size_t i = 0;
+	for (; i + WIDTH <= count; i += WIDTH) {
+		Lanes x = load(in.x + i), y = load(in.y + i), z = load(in.z + i);
+		Lanes w = IN_W ? load(in.w + i) : one;
+		Lanes outX = madd(column[12], w, madd(column[8], z, madd(column[4], y, mul(column[0], x))));
+		Lanes outY = madd(column[13], w, madd(column[9], z, madd(column[5], y, mul(column[1], x))));
+		Lanes outZ = madd(column[14], w, madd(column[10], z, madd(column[6], y, mul(column[2], x))));
+		store(out.x + i, outX);
+		store(out.y + i, outY);
+		store(out.z + i, outZ);
+		if (OUT_W) store(out.w + i, madd(column[15], w, madd(column[11], z, madd(column[7], y, mul(column[3], x)))));
+	}
+	for (; i < count; i++) {
+		float x = in.x[i], y = in.y[i], z = in.z[i], w = IN_W ? in.w[i] : 1.0f;
+		out.x[i] = m[12] * w + (m[8] * z + (m[4] * y + m[0] * x));
+		out.y[i] = m[13] * w + (m[9] * z + (m[5] * y + m[1] * x));
+		out.z[i] = m[14] * w + (m[10] * z + (m[6] * y + m[2] * x));
+		if (OUT_W) out.w[i] = m[15] * w + (m[11] * z + (m[7] * y + m[3] * x));
+	}
+}
+
+inline void transform(const float* m, const SoAConstPoints& in, const SoAPoints& out, size_t count) {
+	if (in.w) {
+		if (out.w) transformRange<true, true>(m, in, out, count);
+		else transformRange<true, false>(m, in, out, count);
+	} else {
+		if (out.w) transformRange<false, true>(m, in, out, count);
+		else transformRange<false, false>(m, in, out, count);
+	}
+}
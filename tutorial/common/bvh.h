@@ -0,0 +1,654 @@
+#pragma once
+// Bounding volume hierarchy for ray queries
+// glm::intersectRayTriangle and glm::intersectRaySphere test a single primitive. Bvh<N, Primitive>
+// sorts millions of them into a tree, so that a ray only meets a few dozen boxes and a handful
+// of primitives:
+//	build:      binned SAH (BVH_BINS buckets per axis) into a binary tree. The top levels are
+//	            binned in parallel on a TaskPool and the subtrees below them are built as
+//	            separate tasks. The tree is then collapsed into N-wide nodes (N = 4 or 8) that
+//	            store their children's boxes SoA, 128 or 256 bytes per node.
+//	intersect:  closest hit; occluded: any hit before tMax (shadow and visibility rays).
+//	            One ray at a time through the glm primitives (picking), or packets of 4, 8 or
+//	            16 rays, one per SIMD lane, with the kernels compiled and dispatched per
+//	            instruction set like batch_transform.h.
+// Packets pay off for coherent rays (camera rays through neighbouring pixels); rays that go
+// different ways are better traced one at a time.
+// As for glm::intersectRaySphere, sphere queries need normalized directions. Distances are in
+// units of the direction's length.
+#include <glm/glm.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "aligned_memory.h"
+#include "simd_dispatch.h"
+#include "task_pool.h"
+
+const int BVH_BINS = 16;
+const uint32_t BVH_MAX_LEAF = 8;              // primitives per leaf
+// SAH cost of visiting a binary node, in primitive tests. Collapsing into N-wide nodes tests
+// N boxes per visit, and packets test a leaf's primitives against WIDTH rays at once, so a
+// node costs a few primitive tests; with 1 the builder splits down to single primitives.
+const float BVH_TRAVERSAL_COST = 4.0f;
+const int BVH_MAX_DEPTH = 48;                 // deeper ranges are split at the median
+const size_t BVH_PARALLEL_RANGE = 65536;      // ranges at least this large are binned on the pool
+const size_t BVH_QUERY_CHUNK = 4096;          // rays per task for pooled queries
+const int BVH_STACK = 1024;                   // traversal stack entries
+
+const uint32_t BVH_LEAF = 0x80000000u;        // child reference: first primitive of a leaf
+const uint32_t BVH_EMPTY = 0xffffffffu;       // unused child slot, always after the used ones
+const uint32_t BVH_MISS = 0xffffffffu;
+
+struct BvhRay {
+	glm::vec3 origin;
+	glm::vec3 direction;
+	float tMax = INFINITY;
+};
+
+// 1 / direction for the slab tests, kept finite: with a zero component the inverse is
+// infinite and a box plane through the origin gives 0 * inf = NaN, which drops the box.
+// Components below 1e-18 are replaced by +-1e-18, so a parallel ray gets huge slab distances
+// of the right sign instead.
+inline glm::vec3 bvhInverseDirection(const glm::vec3& direction) {
+	const float smallest = 1e-18f;
+	glm::vec3 inverse;
+	for (int axis = 0; axis < 3; axis++) {
+		float d = direction[axis];
+		if (std::fabs(d) < smallest) d = std::copysign(smallest, d);
+		inverse[axis] = 1.0f / d;
+	}
+	return inverse;
+}
+
+struct BvhHit {
+	float distance = INFINITY;
+	uint32_t primitive = BVH_MISS;              // the primitive's id
+	glm::vec2 barycentric = glm::vec2(0.0f);    // triangles: the weights of v1 and v2
+};
+
+struct BvhTriangle {
+	glm::vec3 v0, v1, v2;
+	uint32_t id;
+
+	glm::vec3 lower() const { return glm::min(v0, glm::min(v1, v2)); }
+	glm::vec3 upper() const { return glm::max(v0, glm::max(v1, v2)); }
+
+	// glm::intersectRayTriangle, keeping hits in (0, hit.distance)
+	bool intersect(const BvhRay& ray, BvhHit& hit) const {
+		glm::vec2 barycentric;
+		float distance;
+		if (!glm::intersectRayTriangle(ray.origin, ray.direction, v0, v1, v2, barycentric, distance)) return false;
+		if (!(distance > 0.0f && distance < hit.distance)) return false;
+		hit.distance = distance;
+		hit.primitive = id;
+		hit.barycentric = barycentric;
+		return true;
+	}
+};
+
+struct BvhSphere {
+	glm::vec3 center;
+	float radius;
+	uint32_t id;
+
+	glm::vec3 lower() const { return center - radius; }
+	glm::vec3 upper() const { return center + radius; }
+
+	bool intersect(const BvhRay& ray, BvhHit& hit) const {
+		float distance;
+		if (!glm::intersectRaySphere(ray.origin, ray.direction, center, radius * radius, distance)) return false;
+		if (!(distance < hit.distance)) return false;
+		hit.distance = distance;
+		hit.primitive = id;
+		return true;
+	}
+};
+
+// Triangles of an indexed mesh; a triangle's id is its index.
+inline std::vector<BvhTriangle> bvhTriangles(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices) {
+	std::vector<BvhTriangle> triangles(indices.size() / 3);
+	for (size_t t = 0; t < triangles.size(); t++) {
+		triangles[t] = {positions[indices[3 * t]], positions[indices[3 * t + 1]], positions[indices[3 * t + 2]], (uint32_t)t};
+	}
+	return triangles;
+}
+
+// N children per node, their boxes stored SoA so that one ray can test all of them at once
+// and a packet can broadcast one child's box.
+template <int N>
+struct alignas(64) BvhNode {
+	float minX[N], minY[N], minZ[N], maxX[N], maxY[N], maxZ[N];
+	uint32_t child[N];  // node index, BVH_LEAF | first primitive, or BVH_EMPTY
+	uint8_t count[N];   // primitives in a leaf child
+};
+
+struct BvhBuildStats {
+	size_t primitives = 0;
+	size_t binaryNodes = 0;
+	size_t subtrees = 0;       // built as separate tasks
+	size_t nodes = 0;          // N-wide
+	size_t leaves = 0;
+	int depth = 0;             // N-wide levels
+	double binaryMilliseconds = 0.0;
+	double collapseMilliseconds = 0.0;
+
+	void print(const char* label) const {
+		std::printf("%s: %zu primitives, %zu binary nodes (%zu subtree tasks) -> %zu nodes, %zu leaves, depth %d; "
+			"%.1f ms SAH build, %.1f ms collapse\n", label, primitives, binaryNodes, subtrees, nodes, leaves, depth,
+			binaryMilliseconds, collapseMilliseconds);
+	}
+};
+
+struct BvhBounds {
+	glm::vec3 lower = glm::vec3(INFINITY);
+	glm::vec3 upper = glm::vec3(-INFINITY);
+
+	void grow(const glm::vec3& p) {
+		lower = glm::min(lower, p);
+		upper = glm::max(upper, p);
+	}
+	void grow(const BvhBounds& other) {
+		lower = glm::min(lower, other.lower);
+		upper = glm::max(upper, other.upper);
+	}
+	float area() const {
+		if (!(lower.x <= upper.x)) return 0.0f;
+		glm::vec3 e = upper - lower;
+		return e.x * e.y + e.y * e.z + e.z * e.x;
+	}
+};
+
+// Runs body(chunk, begin, end) over [begin, end) in chunks on the pool, or as one chunk
+// without one. Returns the number of chunks.
+template <typename Body>
+size_t bvhChunks(size_t begin, size_t end, TaskPool* pool, size_t chunkSize, const Body& body) {
+	size_t chunks = pool && pool->threadCount() > 1 ? (end - begin + chunkSize - 1) / chunkSize : 1;
+	if (chunks <= 1) {
+		body((size_t)0, begin, end);
+		return 1;
+	}
+	pool->run(chunks, [&](size_t chunk, unsigned int) {
+		size_t chunkBegin = begin + chunk * chunkSize;
+		body(chunk, chunkBegin, std::min(end, chunkBegin + chunkSize));
+	});
+	return chunks;
+}
+
+// The binary SAH tree the N-wide nodes are collapsed from.
+class BvhBuilder {
+public:
+	struct Node {
+		BvhBounds bounds;
+		uint32_t first = 0, count = 0;  // count > 0: a leaf over order[first .. first + count)
+		uint32_t left = 0, right = 0;
+	};
+	std::vector<Node> nodes;            // nodes[0] is the root
+	std::vector<uint32_t> order;        // primitives in leaf order
+
+	void build(const glm::vec3* lower, const glm::vec3* upper, size_t count, TaskPool* pool, BvhBuildStats& stats) {
+		this->lower = lower;
+		this->upper = upper;
+		nodes.clear();
+		order.resize(count);
+		center.resize(count);
+		bvhChunks(0, count, pool, BVH_PARALLEL_RANGE, [&](size_t, size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				order[i] = (uint32_t)i;
+				center[i] = (lower[i] + upper[i]) * 0.5f;
+			}
+		});
+		if (count == 0) return;
+
+		// Large ranges are split here, binned on the pool; the ones below the threshold become
+		// subtree tasks, enough of them to balance across the workers.
+		bool parallel = pool && pool->threadCount() > 1;
+		size_t threshold = parallel ? std::max<size_t>(count / (4 * pool->threadCount()), 4096) : count + 1;
+		nodes.emplace_back();
+		std::vector<Range> work = {{0, 0, (uint32_t)count, 0}};
+		std::vector<Range> deferred;
+		while (!work.empty()) {
+			Range range = work.back();
+			work.pop_back();
+			if (parallel && range.end - range.begin < threshold) deferred.push_back(range);
+			else split(range, nodes, work, parallel ? pool : nullptr);
+		}
+
+		if (!deferred.empty()) {
+			std::vector<std::vector<Node>> subtrees(deferred.size());
+			pool->run(deferred.size(), [&](size_t task, unsigned int) {
+				std::vector<Node>& local = subtrees[task];
+				local.emplace_back();
+				std::vector<Range> localWork = {{0, deferred[task].begin, deferred[task].end, deferred[task].depth}};
+				while (!localWork.empty()) {
+					Range range = localWork.back();
+					localWork.pop_back();
+					split(range, local, localWork, nullptr);
+				}
+			});
+			// Append each subtree and hang its root in place of the placeholder.
+			for (size_t task = 0; task < deferred.size(); task++) {
+				uint32_t base = (uint32_t)nodes.size() - 1;
+				const std::vector<Node>& local = subtrees[task];
+				Node root = local[0];
+				if (!root.count) {
+					root.left += base;
+					root.right += base;
+				}
+				nodes[deferred[task].node] = root;
+				for (size_t i = 1; i < local.size(); i++) {
+					Node node = local[i];
+					if (!node.count) {
+						node.left += base;
+						node.right += base;
+					}
+					nodes.push_back(node);
+				}
+			}
+		}
+		stats.subtrees = deferred.size();
+		stats.binaryNodes = nodes.size();
+	}
+
+private:
+	struct Range {
+		uint32_t node, begin, end;
+		int depth;
+	};
+	struct Bin {
+		BvhBounds bounds;
+		uint32_t count = 0;
+	};
+	struct Binning {
+		Bin bins[3][BVH_BINS];
+	};
+
+	int binIndex(uint32_t primitive, int axis, const glm::vec3& origin, const glm::vec3& scale) const {
+		int bin = (int)((center[primitive][axis] - origin[axis]) * scale[axis]);
+		return std::min(std::max(bin, 0), BVH_BINS - 1);
+	}
+
+	// Fills in the range's node: a leaf, or a split whose two halves are pushed onto work.
+	void split(const Range& range, std::vector<Node>& out, std::vector<Range>& work, TaskPool* pool) {
+		uint32_t count = range.end - range.begin;
+		size_t chunkSize = count >= BVH_PARALLEL_RANGE ? BVH_PARALLEL_RANGE / 4 : count;
+		TaskPool* rangePool = count >= BVH_PARALLEL_RANGE ? pool : nullptr;
+
+		// Bounds of the primitives and of their centres
+		std::vector<BvhBounds> partBounds(rangePool ? (count + chunkSize - 1) / chunkSize : 1), partCenters(partBounds.size());
+		size_t parts = bvhChunks(range.begin, range.end, rangePool, chunkSize, [&](size_t part, size_t begin, size_t end) {
+			BvhBounds bounds, centers;
+			for (size_t i = begin; i < end; i++) {
+				uint32_t p = order[i];
+				bounds.lower = glm::min(bounds.lower, lower[p]);
+				bounds.upper = glm::max(bounds.upper, upper[p]);
+				centers.grow(center[p]);
+			}
+			partBounds[part] = bounds;
+			partCenters[part] = centers;
+		});
+		BvhBounds bounds, centers;
+		for (size_t part = 0; part < parts; part++) {
+			bounds.grow(partBounds[part]);
+			centers.grow(partCenters[part]);
+		}
+		out[range.node].bounds = bounds;
+
+		if (count == 1) {
+			makeLeaf(range, out);
+			return;
+		}
+
+		glm::vec3 extent = centers.upper - centers.lower;
+		int largestAxis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+		int bestAxis = -1, bestSplit = 0;
+		float bestCost = INFINITY;
+		if (range.depth < BVH_MAX_DEPTH && extent[largestAxis] > 0.0f) {
+			glm::vec3 scale;
+			for (int axis = 0; axis < 3; axis++) scale[axis] = extent[axis] > 0.0f ? BVH_BINS * 0.9999f / extent[axis] : 0.0f;
+
+			std::vector<Binning> partBins(parts);
+			bvhChunks(range.begin, range.end, rangePool, chunkSize, [&](size_t part, size_t begin, size_t end) {
+				Binning& binning = partBins[part];
+				for (size_t i = begin; i < end; i++) {
+					uint32_t p = order[i];
+					for (int axis = 0; axis < 3; axis++) {
+						Bin& bin = binning.bins[axis][binIndex(p, axis, centers.lower, scale)];
+						bin.bounds.lower = glm::min(bin.bounds.lower, lower[p]);
+						bin.bounds.upper = glm::max(bin.bounds.upper, upper[p]);
+						bin.count++;
+					}
+				}
+			});
+			Binning binning = partBins[0];
+			for (size_t part = 1; part < parts; part++) {
+				for (int axis = 0; axis < 3; axis++) {
+					for (int b = 0; b < BVH_BINS; b++) {
+						binning.bins[axis][b].bounds.grow(partBins[part].bins[axis][b].bounds);
+						binning.bins[axis][b].count += partBins[part].bins[axis][b].count;
+					}
+				}
+			}
+
+			// Cost of splitting before bin s: a traversal + the halves' primitives weighted by
+			// the chance of a ray through this node hitting them, relative to 1 per primitive.
+			float parentArea = bounds.area();
+			for (int axis = 0; axis < 3; axis++) {
+				if (scale[axis] == 0.0f) continue;
+				const Bin* bins = binning.bins[axis];
+				float rightArea[BVH_BINS];
+				uint32_t rightCount[BVH_BINS];
+				BvhBounds right;
+				uint32_t rightTotal = 0;
+				for (int b = BVH_BINS - 1; b > 0; b--) {
+					right.grow(bins[b].bounds);
+					rightTotal += bins[b].count;
+					rightArea[b] = right.area();
+					rightCount[b] = rightTotal;
+				}
+				BvhBounds left;
+				uint32_t leftTotal = 0;
+				for (int s = 1; s < BVH_BINS; s++) {
+					left.grow(bins[s - 1].bounds);
+					leftTotal += bins[s - 1].count;
+					if (leftTotal == 0 || rightCount[s] == 0) continue;
+					float cost = BVH_TRAVERSAL_COST + (left.area() * leftTotal + rightArea[s] * rightCount[s]) / parentArea;
+					if (cost < bestCost) {
+						bestCost = cost;
+						bestAxis = axis;
+						bestSplit = s;
+					}
+				}
+			}
+			// A leaf costs one test per primitive
+			if (bestAxis >= 0 && bestCost >= (float)count && count <= BVH_MAX_LEAF) {
+				makeLeaf(range, out);
+				return;
+			}
+			if (bestAxis >= 0) {
+				uint32_t* middle = std::partition(order.data() + range.begin, order.data() + range.end,
+					[&](uint32_t p) { return binIndex(p, bestAxis, centers.lower, scale) < bestSplit; });
+				pushHalves(range, (uint32_t)(middle - order.data()), out, work);
+				return;
+			}
+		}
+
+		// Too deep, all centres in one spot, or no split separates them: halve the range.
+		if (count <= BVH_MAX_LEAF) {
+			makeLeaf(range, out);
+			return;
+		}
+		uint32_t middle = range.begin + count / 2;
+		std::nth_element(order.data() + range.begin, order.data() + middle, order.data() + range.end,
+			[&](uint32_t a, uint32_t b) { return center[a][largestAxis] < center[b][largestAxis]; });
+		pushHalves(range, middle, out, work);
+	}
+
+	void makeLeaf(const Range& range, std::vector<Node>& out) {
+		out[range.node].first = range.begin;
+		out[range.node].count = range.end - range.begin;
+	}
+
+	void pushHalves(const Range& range, uint32_t middle, std::vector<Node>& out, std::vector<Range>& work) {
+		uint32_t left = (uint32_t)out.size();
+		out.emplace_back();
+		out.emplace_back();
+		out[range.node].left = left;
+		out[range.node].right = left + 1;
+		work.push_back({left + 1, middle, range.end, range.depth + 1});
+		work.push_back({left, range.begin, middle, range.depth + 1});
+	}
+
+	const glm::vec3* lower = nullptr;
+	const glm::vec3* upper = nullptr;
+	std::vector<glm::vec3> center;
+};
+
+namespace bvh_scalar {
+#include "bvh.inl"
+}
+
+#if SIMD_DISPATCH_X86
+SIMD_TARGET_SSE41
+namespace bvh_sse41 {
+#define SIMD_LANES_SSE41
+#include "bvh.inl"
+#undef SIMD_LANES_SSE41
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX2
+namespace bvh_avx2 {
+#define SIMD_LANES_AVX2
+#include "bvh.inl"
+#undef SIMD_LANES_AVX2
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX512
+namespace bvh_avx512 {
+#define SIMD_LANES_AVX512
+#include "bvh.inl"
+#undef SIMD_LANES_AVX512
+}
+SIMD_TARGET_END
+#endif
+
+// The packet kernels for one level (clamped to what was compiled in). They trace rays
+// [0, count) in packets of width, the last one padded.
+template <int N, typename Primitive>
+struct BvhKernels {
+	SimdLevel level;
+	int width; // rays per packet
+	void (*intersect)(const BvhNode<N>* nodes, const Primitive* primitives, const BvhRay* rays, BvhHit* hits, size_t count);
+	void (*occluded)(const BvhNode<N>* nodes, const Primitive* primitives, const BvhRay* rays, uint8_t* occluded, size_t count);
+};
+
+#define BVH_KERNELS(level, ns) {level, ns::WIDTH, ns::intersectPackets<N, Primitive>, ns::occludedPackets<N, Primitive>}
+
+template <int N, typename Primitive>
+inline BvhKernels<N, Primitive> bvhKernels(SimdLevel level = simdLevel()) {
+#if SIMD_DISPATCH_X86
+	if (level >= SIMD_AVX512) return BVH_KERNELS(SIMD_AVX512, bvh_avx512);
+	if (level >= SIMD_AVX2) return BVH_KERNELS(SIMD_AVX2, bvh_avx2);
+	if (level >= SIMD_SSE41) return BVH_KERNELS(SIMD_SSE41, bvh_sse41);
+#endif
+	return BVH_KERNELS(SIMD_SCALAR, bvh_scalar);
+}
+
+#undef BVH_KERNELS
+
+template <int N, typename Primitive>
+class Bvh {
+public:
+	// Builds over a copy of the primitives, reordered to match the leaves.
+	void build(const std::vector<Primitive>& input, TaskPool* pool = nullptr, SimdLevel level = simdLevel()) {
+		stats = BvhBuildStats();
+		stats.primitives = input.size();
+		kernels = bvhKernels<N, Primitive>(level);
+
+		auto start = std::chrono::steady_clock::now();
+		std::vector<glm::vec3> lower(input.size()), upper(input.size());
+		bvhChunks(0, input.size(), pool, BVH_PARALLEL_RANGE, [&](size_t, size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) {
+				lower[i] = input[i].lower();
+				upper[i] = input[i].upper();
+			}
+		});
+		BvhBuilder builder;
+		builder.build(lower.data(), upper.data(), input.size(), pool, stats);
+		auto built = std::chrono::steady_clock::now();
+
+		nodes.clear();
+		nodes.reserve(builder.nodes.size() / 2 + 1);
+		collapse(builder, 0, 1);
+		primitives.resize(input.size());
+		bvhChunks(0, input.size(), pool, BVH_PARALLEL_RANGE, [&](size_t, size_t begin, size_t end) {
+			for (size_t i = begin; i < end; i++) primitives[i] = input[builder.order[i]];
+		});
+		stats.nodes = nodes.size();
+		stats.binaryMilliseconds = std::chrono::duration<double, std::milli>(built - start).count();
+		stats.collapseMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - built).count();
+	}
+
+	// One ray, through the primitives' glm tests. primitive is BVH_MISS if nothing was hit.
+	BvhHit intersect(const BvhRay& ray) const {
+		BvhHit hit;
+		if (!trace<false>(ray, hit)) hit = BvhHit();
+		return hit;
+	}
+	bool occluded(const BvhRay& ray) const {
+		BvhHit hit;
+		return trace<true>(ray, hit);
+	}
+
+	// Packets of width() rays, neighbours in one packet; with a pool, chunks of
+	// BVH_QUERY_CHUNK rays run as tasks.
+	void intersect(const BvhRay* rays, BvhHit* hits, size_t count, TaskPool* pool = nullptr) const {
+		bvhChunks(0, count, pool, BVH_QUERY_CHUNK, [&](size_t, size_t begin, size_t end) {
+			kernels.intersect(nodes.data(), primitives.data(), rays + begin, hits + begin, end - begin);
+		});
+	}
+	void occluded(const BvhRay* rays, uint8_t* occluded, size_t count, TaskPool* pool = nullptr) const {
+		bvhChunks(0, count, pool, BVH_QUERY_CHUNK, [&](size_t, size_t begin, size_t end) {
+			kernels.occluded(nodes.data(), primitives.data(), rays + begin, occluded + begin, end - begin);
+		});
+	}
+
+	// Packet kernels to use (clamped to what was compiled in); build() picks them too.
+	void setLevel(SimdLevel level) { kernels = bvhKernels<N, Primitive>(level); }
+	SimdLevel level() const { return kernels.level; }
+	int width() const { return kernels.width; }
+	const BvhBuildStats& buildStats() const { return stats; }
+	size_t nodeBytes() const { return nodes.size() * sizeof(BvhNode<N>); }
+
+private:
+	// Gathers up to N descendants of a binary node, opening the largest interior one first,
+	// and emits them as one node. Returns its index.
+	uint32_t collapse(const BvhBuilder& builder, uint32_t binary, int depth) {
+		stats.depth = std::max(stats.depth, depth);
+		uint32_t index = (uint32_t)nodes.size();
+		nodes.emplace_back();
+		uint32_t children[N];
+		int count = 0;
+		if (builder.nodes.empty()) {
+			// no primitives: a root without children
+		} else if (builder.nodes[binary].count) {
+			children[count++] = binary;
+		} else {
+			children[count++] = builder.nodes[binary].left;
+			children[count++] = builder.nodes[binary].right;
+			while (count < N) {
+				int largest = -1;
+				float largestArea = -1.0f;
+				for (int c = 0; c < count; c++) {
+					const BvhBuilder::Node& node = builder.nodes[children[c]];
+					if (!node.count && node.bounds.area() > largestArea) {
+						largest = c;
+						largestArea = node.bounds.area();
+					}
+				}
+				if (largest < 0) break;
+				uint32_t opened = children[largest];
+				children[largest] = builder.nodes[opened].left;
+				children[count++] = builder.nodes[opened].right;
+			}
+		}
+
+		uint32_t references[N];
+		uint8_t counts[N];
+		for (int c = 0; c < count; c++) {
+			const BvhBuilder::Node& node = builder.nodes[children[c]];
+			if (node.count) {
+				references[c] = BVH_LEAF | node.first;
+				counts[c] = (uint8_t)node.count;
+				stats.leaves++;
+			} else {
+				references[c] = collapse(builder, children[c], depth + 1);
+				counts[c] = 0;
+			}
+		}
+		BvhNode<N>& node = nodes[index];
+		for (int c = 0; c < N; c++) {
+			const BvhBounds bounds = c < count ? builder.nodes[children[c]].bounds : BvhBounds();
+			bool used = c < count;
+			node.minX[c] = used ? bounds.lower.x : 0.0f;
+			node.minY[c] = used ? bounds.lower.y : 0.0f;
+			node.minZ[c] = used ? bounds.lower.z : 0.0f;
+			node.maxX[c] = used ? bounds.upper.x : 0.0f;
+			node.maxY[c] = used ? bounds.upper.y : 0.0f;
+			node.maxZ[c] = used ? bounds.upper.z : 0.0f;
+			node.child[c] = used ? references[c] : BVH_EMPTY;
+			node.count[c] = used ? counts[c] : 0;
+		}
+		return index;
+	}
+
+	// Nearest child first; entries the ray has since passed a closer hit for are skipped.
+	template <bool ANY>
+	bool trace(const BvhRay& ray, BvhHit& hit) const {
+		struct Entry {
+			uint32_t reference, count;
+			float near;
+		};
+		Entry stack[BVH_STACK];
+		int size = 0;
+		stack[size++] = {0, 0, 0.0f};
+		const glm::vec3 inverse = bvhInverseDirection(ray.direction);
+		hit.distance = ray.tMax;
+		bool found = false;
+		while (size > 0) {
+			Entry entry = stack[--size];
+			if (entry.near > hit.distance) continue;
+			if (entry.reference & BVH_LEAF) {
+				uint32_t first = entry.reference & ~BVH_LEAF;
+				for (uint32_t p = first; p < first + entry.count; p++) {
+					if (primitives[p].intersect(ray, hit)) {
+						if (ANY) return true;
+						found = true;
+					}
+				}
+				continue;
+			}
+
+			const BvhNode<N>& node = nodes[entry.reference];
+			Entry hits[N];
+			int hitCount = 0;
+			for (int c = 0; c < N && node.child[c] != BVH_EMPTY; c++) {
+				float x0 = (node.minX[c] - ray.origin.x) * inverse.x, x1 = (node.maxX[c] - ray.origin.x) * inverse.x;
+				float y0 = (node.minY[c] - ray.origin.y) * inverse.y, y1 = (node.maxY[c] - ray.origin.y) * inverse.y;
+				float z0 = (node.minZ[c] - ray.origin.z) * inverse.z, z1 = (node.maxZ[c] - ray.origin.z) * inverse.z;
+				// std::min/max return their first argument when either is NaN, so the interval
+				// starts from [0, hit.distance] and a NaN slab (a NaN ray) can't widen it.
+				float near = std::max(std::max(std::max(0.0f, std::min(x0, x1)), std::min(y0, y1)), std::min(z0, z1));
+				float far = std::min(std::min(std::min(hit.distance, std::max(x0, x1)), std::max(y0, y1)), std::max(z0, z1));
+				if (!(near <= far)) continue;
+				// Insertion sort, farthest first, so the nearest ends up on top of the stack
+				int k = hitCount++;
+				while (k > 0 && hits[k - 1].near < near) {
+					hits[k] = hits[k - 1];
+					k--;
+				}
+				hits[k] = {node.child[c], node.count[c], near};
+			}
+			for (int k = 0; k < hitCount; k++) stack[size++] = hits[k];
+		}
+		return found;
+	}
+
+	AlignedVector<BvhNode<N>> nodes;
+	std::vector<Primitive> primitives;
+	BvhKernels<N, Primitive> kernels = bvhKernels<N, Primitive>(SIMD_SCALAR);
+	BvhBuildStats stats;
+};
+
+typedef Bvh<4, BvhTriangle> TriangleBvh4;
+typedef Bvh<8, BvhTriangle> TriangleBvh8;
+typedef Bvh<4, BvhSphere> SphereBvh4;
+typedef Bvh<8, BvhSphere> SphereBvh8;
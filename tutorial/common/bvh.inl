@@ -0,0 +1,215 @@
+// BVH packet kernels, compiled once per instruction set (see simd_lanes.inl): WIDTH rays
+// per packet, one per lane, traced through the tree together. A child is entered if any
+// ray of the packet hits its box; leaves test each primitive against every ray at once.
+// No include guard on purpose.
+#include "simd_lanes.inl"
+
+struct Packet {
+	Lanes originX, originY, originZ, directionX, directionY, directionZ;
+	Lanes inverseX, inverseY, inverseZ;
+	Lanes offsetX, offsetY, offsetZ;  // -origin * inverse: a slab is box * inverse + offset
+	Lanes tMax;                       // = distance, reloaded whenever a ray's hit moves closer
+	unsigned active;                  // rays still traced; padding lanes never are
+	glm::vec3 direction;              // of the first ray, for ordering children
+	float distance[WIDTH];
+	uint32_t primitive[WIDTH];
+	float u[WIDTH], v[WIDTH];
+};
+
+// Lanes whose ray hit primitive p at t; a closer hit replaces the ray's previous one, and
+// with ANY the ray is done. Returns whether tMax changed.
+template <bool ANY>
+inline bool recordHits(Packet& packet, unsigned mask, const float* t, const float* u, const float* v, uint32_t id) {
+	bool closer = false;
+	for (int k = 0; k < WIDTH; k++) {
+		if (!((mask >> k) & 1) || !(t[k] < packet.distance[k])) continue;
+		packet.distance[k] = t[k];
+		packet.primitive[k] = id;
+		packet.u[k] = u ? u[k] : 0.0f;
+		packet.v[k] = v ? v[k] : 0.0f;
+		if (ANY) packet.active &= ~(1u << k);
+		closer = true;
+	}
+	if (closer) packet.tMax = load(packet.distance);
+	return closer;
+}
+
+// glm::intersectRayTriangle across the packet, without its branches: |det| > epsilon, then
+// the barycentrics and distance scaled by 1 / det.
+template <bool ANY>
+inline void intersectLeaf(const BvhTriangle* triangles, uint32_t first, uint32_t count, Packet& packet) {
+	const Lanes zero = broadcast(0.0f), one = broadcast(1.0f), epsilon = broadcast(std::numeric_limits<float>::epsilon());
+	for (uint32_t p = first; p < first + count && packet.active; p++) {
+		const BvhTriangle& triangle = triangles[p];
+		glm::vec3 edge1 = triangle.v1 - triangle.v0, edge2 = triangle.v2 - triangle.v0;
+		Lanes e1x = broadcast(edge1.x), e1y = broadcast(edge1.y), e1z = broadcast(edge1.z);
+		Lanes e2x = broadcast(edge2.x), e2y = broadcast(edge2.y), e2z = broadcast(edge2.z);
+		// p = cross(direction, edge2), det = dot(edge1, p)
+		Lanes px = sub(mul(packet.directionY, e2z), mul(packet.directionZ, e2y));
+		Lanes py = sub(mul(packet.directionZ, e2x), mul(packet.directionX, e2z));
+		Lanes pz = sub(mul(packet.directionX, e2y), mul(packet.directionY, e2x));
+		Lanes det = madd(e1z, pz, madd(e1y, py, mul(e1x, px)));
+		unsigned mask = (greaterEqualMask(det, epsilon) | greaterEqualMask(sub(zero, det), epsilon)) & packet.active;
+		if (!mask) continue;
+		// s = origin - v0, u = dot(s, p), q = cross(s, edge1), v = dot(direction, q), t = dot(edge2, q)
+		Lanes sx = sub(packet.originX, broadcast(triangle.v0.x));
+		Lanes sy = sub(packet.originY, broadcast(triangle.v0.y));
+		Lanes sz = sub(packet.originZ, broadcast(triangle.v0.z));
+		Lanes inverseDet = div(one, det);
+		Lanes u = mul(madd(sz, pz, madd(sy, py, mul(sx, px))), inverseDet);
+		Lanes qx = sub(mul(sy, e1z), mul(sz, e1y));
+		Lanes qy = sub(mul(sz, e1x), mul(sx, e1z));
+		Lanes qz = sub(mul(sx, e1y), mul(sy, e1x));
+		Lanes v = mul(madd(packet.directionZ, qz, madd(packet.directionY, qy, mul(packet.directionX, qx))), inverseDet);
+		Lanes t = mul(madd(e2z, qz, madd(e2y, qy, mul(e2x, qx))), inverseDet);
+		mask &= greaterEqualMask(u, zero) & greaterEqualMask(v, zero) & greaterEqualMask(one, add(u, v));
+		mask &= ~greaterEqualMask(zero, t) & greaterEqualMask(packet.tMax, t);
+		if (!mask) continue;
+		float tValues[WIDTH], uValues[WIDTH], vValues[WIDTH];
+		store(tValues, t);
+		store(uValues, u);
+		store(vValues, v);
+		recordHits<ANY>(packet, mask, tValues, uValues, vValues, triangle.id);
+	}
+}
+
+// glm::intersectRaySphere: the nearer root if it is past epsilon, else the farther one.
+template <bool ANY>
+inline void intersectLeaf(const BvhSphere* spheres, uint32_t first, uint32_t count, Packet& packet) {
+	const float epsilon = std::numeric_limits<float>::epsilon();
+	for (uint32_t p = first; p < first + count && packet.active; p++) {
+		const BvhSphere& sphere = spheres[p];
+		Lanes dx = sub(broadcast(sphere.center.x), packet.originX);
+		Lanes dy = sub(broadcast(sphere.center.y), packet.originY);
+		Lanes dz = sub(broadcast(sphere.center.z), packet.originZ);
+		Lanes t0 = madd(dz, packet.directionZ, madd(dy, packet.directionY, mul(dx, packet.directionX)));
+		Lanes distanceSquared = sub(madd(dz, dz, madd(dy, dy, mul(dx, dx))), mul(t0, t0));
+		Lanes radiusSquared = broadcast(sphere.radius * sphere.radius);
+		unsigned mask = greaterEqualMask(radiusSquared, distanceSquared) & packet.active;
+		if (!mask) continue;
+		Lanes t1 = sqrt(sub(radiusSquared, distanceSquared));
+		mask &= greaterEqualMask(packet.tMax, sub(t0, t1));
+		if (!mask) continue;
+		float t0Values[WIDTH], t1Values[WIDTH], tValues[WIDTH];
+		store(t0Values, t0);
+		store(t1Values, t1);
+		for (int k = 0; k < WIDTH; k++) {
+			tValues[k] = t0Values[k] > t1Values[k] + epsilon ? t0Values[k] - t1Values[k] : t0Values[k] + t1Values[k];
+			if (!(tValues[k] > epsilon)) mask &= ~(1u << k);
+		}
+		recordHits<ANY>(packet, mask, tValues, nullptr, nullptr, sphere.id);
+	}
+}
+
+template <int N, typename Primitive, bool ANY>
+inline void tracePacket(const BvhNode<N>* nodes, const Primitive* primitives, Packet& packet) {
+	struct Entry {
+		uint32_t reference, count;
+	};
+	Entry stack[BVH_STACK];
+	int size = 0;
+	stack[size++] = {0, 0};
+	const Lanes zero = broadcast(0.0f);
+	while (size > 0 && packet.active) {
+		Entry entry = stack[--size];
+		if (entry.reference & BVH_LEAF) {
+			intersectLeaf<ANY>(primitives, entry.reference & ~BVH_LEAF, entry.count, packet);
+			continue;
+		}
+
+		const BvhNode<N>& node = nodes[entry.reference];
+		Entry hits[N];
+		float keys[N];
+		int hitCount = 0;
+		for (int c = 0; c < N && node.child[c] != BVH_EMPTY; c++) {
+			Lanes x0 = madd(broadcast(node.minX[c]), packet.inverseX, packet.offsetX);
+			Lanes x1 = madd(broadcast(node.maxX[c]), packet.inverseX, packet.offsetX);
+			Lanes y0 = madd(broadcast(node.minY[c]), packet.inverseY, packet.offsetY);
+			Lanes y1 = madd(broadcast(node.maxY[c]), packet.inverseY, packet.offsetY);
+			Lanes z0 = madd(broadcast(node.minZ[c]), packet.inverseZ, packet.offsetZ);
+			Lanes z1 = madd(broadcast(node.maxZ[c]), packet.inverseZ, packet.offsetZ);
+			Lanes near = max(max(min(x0, x1), min(y0, y1)), max(min(z0, z1), zero));
+			Lanes far = min(min(max(x0, x1), max(y0, y1)), min(max(z0, z1), packet.tMax));
+			if (!(greaterEqualMask(far, near) & packet.active)) continue;
+			// Front to back along the first ray: sort by the box centre's projection, farthest first
+			float key = (node.minX[c] + node.maxX[c]) * packet.direction.x + (node.minY[c] + node.maxY[c]) * packet.direction.y +
+				(node.minZ[c] + node.maxZ[c]) * packet.direction.z;
+			int k = hitCount++;
+			while (k > 0 && keys[k - 1] < key) {
+				hits[k] = hits[k - 1];
+				keys[k] = keys[k - 1];
+				k--;
+			}
+			hits[k] = {node.child[c], node.count[c]};
+			keys[k] = key;
+		}
+		for (int k = 0; k < hitCount; k++) stack[size++] = hits[k];
+	}
+}
+
+// Loads rays [0, count) (count <= WIDTH) into a packet; the other lanes are inactive.
+inline void loadPacket(const BvhRay* rays, size_t count, Packet& packet) {
+	float values[12][WIDTH];
+	for (int k = 0; k < WIDTH; k++) {
+		const BvhRay& ray = rays[(size_t)k < count ? k : 0];
+		glm::vec3 inverse = bvhInverseDirection(ray.direction);
+		values[0][k] = ray.origin.x;
+		values[1][k] = ray.origin.y;
+		values[2][k] = ray.origin.z;
+		values[3][k] = ray.direction.x;
+		values[4][k] = ray.direction.y;
+		values[5][k] = ray.direction.z;
+		values[6][k] = inverse.x;
+		values[7][k] = inverse.y;
+		values[8][k] = inverse.z;
+		values[9][k] = -ray.origin.x * inverse.x;
+		values[10][k] = -ray.origin.y * inverse.y;
+		values[11][k] = -ray.origin.z * inverse.z;
+		packet.distance[k] = (size_t)k < count ? ray.tMax : -INFINITY;
+		packet.primitive[k] = BVH_MISS;
+	}
+	packet.originX = load(values[0]);
+	packet.originY = load(values[1]);
+	packet.originZ = load(values[2]);
+	packet.directionX = load(values[3]);
+	packet.directionY = load(values[4]);
+	packet.directionZ = load(values[5]);
+	packet.inverseX = load(values[6]);
+	packet.inverseY = load(values[7]);
+	packet.inverseZ = load(values[8]);
+	packet.offsetX = load(values[9]);
+	packet.offsetY = load(values[10]);
+	packet.offsetZ = load(values[11]);
+	packet.tMax = load(packet.distance);
+	packet.active = (1u << count) - 1;
+	packet.direction = rays[0].direction;
+}
+
+template <int N, typename Primitive>
+inline void intersectPackets(const BvhNode<N>* nodes, const Primitive* primitives, const BvhRay* rays, BvhHit* hits, size_t count) {
+	Packet packet;
+	for (size_t first = 0; first < count; first += WIDTH) {
+		size_t rayCount = std::min<size_t>(WIDTH, count - first);
+		loadPacket(rays + first, rayCount, packet);
+		tracePacket<N, Primitive, false>(nodes, primitives, packet);
+		for (size_t k = 0; k < rayCount; k++) {
+			BvhHit& hit = hits[first + k];
+			hit = BvhHit();
+			if (packet.primitive[k] == BVH_MISS) continue;
+			hit.distance = packet.distance[k];
+			hit.primitive = packet.primitive[k];
+			hit.barycentric = glm::vec2(packet.u[k], packet.v[k]);
+		}
+	}
+}
+
+template <int N, typename Primitive>
+inline void occludedPackets(const BvhNode<N>* nodes, const Primitive* primitives, const BvhRay* rays, uint8_t* occluded, size_t count) {
+	Packet packet;
+	for (size_t first = 0; first < count; first += WIDTH) {
+		size_t rayCount = std::min<size_t>(WIDTH, count - first);
+		loadPacket(rays + first, rayCount, packet);
+		tracePacket<N, Primitive, true>(nodes, primitives, packet);
+		for (size_t k = 0; k < rayCount; k++) occluded[first + k] = packet.primitive[k] != BVH_MISS;
+	}
+}
@@ -0,0 +1,293 @@
+#pragma once
+// Asynchronous framebuffer readback
+// capture() copies the current frame into one of SLOTS pixel pack buffers (PBOs) and fences
+// it; the copy runs on the GPU while the next frames are rendered. Once a fence has passed,
+// the PBO's mapped memory is handed to a consumer thread as is (no copy); the slot is reused
+// after the consumer returns. With three slots, frame N-2 is usually ready by the time
+// frame N is captured, so the render thread does not wait at all.
+//
+// GL 4.4: the PBOs are mapped once (persistent, coherent, client storage).
+// Older contexts: a PBO is mapped when its fence passes and unmapped once it's released.
+// All GL calls stay on the thread that owns the context; the consumer only reads memory.
+#include <glad/gl.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+struct CapturedFrame {
+	const unsigned char* pixels; // RGBA8, bottom row first (as GL returns it)
+	int width;
+	int height;
+	size_t stride;               // bytes per row
+	uint64_t frameIndex;         // counts capture() calls
+};
+
+struct ReadbackStats {
+	unsigned int captured = 0;
+	unsigned int delivered = 0;
+	unsigned int dropped = 0;        // the fence wait or the mapping failed; never delivered
+	unsigned int gpuWaits = 0;       // capture() needed a slot whose copy hadn't finished
+	double gpuWaitMilliseconds = 0.0;
+	unsigned int consumerWaits = 0;  // capture() needed a slot the consumer still had
+	double consumerWaitMilliseconds = 0.0;
+
+	void print(const char* label) const {
+		std::printf("%s: %u captured, %u delivered, %u dropped, %u GPU waits (%.3f ms), %u consumer waits (%.3f ms)\n",
+			label, captured, delivered, dropped, gpuWaits, gpuWaitMilliseconds, consumerWaits, consumerWaitMilliseconds);
+	}
+};
+
+class FrameReadback {
+public:
+	static constexpr int SLOTS = 3;
+	typedef std::function<void(const CapturedFrame&)> Consumer;
+
+	FrameReadback() = default;
+	FrameReadback(const FrameReadback&) = delete;
+	FrameReadback& operator=(const FrameReadback&) = delete;
+	~FrameReadback() { destroy(); }
+
+	// Creates the PBOs and starts the consumer thread, which calls consumer for every frame.
+	void create(int width, int height, Consumer consumer) {
+		this->width = width;
+		this->height = height;
+		this->consumer = consumer;
+		stride = (size_t)width * 4;
+		persistent = GLAD_GL_VERSION_4_4 != 0;
+
+		size_t bytes = stride * height;
+		glGenBuffers(SLOTS, buffers);
+		for (int i = 0; i < SLOTS; i++) {
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[i]);
+			if (persistent) {
+				const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+				glBufferStorage(GL_PIXEL_PACK_BUFFER, bytes, nullptr, flags | GL_CLIENT_STORAGE_BIT);
+				slots[i].pixels = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, flags);
+			} else {
+				glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+			}
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		stopping = false;
+		worker = std::thread([this]() { consumerLoop(); });
+	}
+
+	// Delivers every frame still in flight, then stops the consumer thread and frees the PBOs.
+	void destroy() {
+		if (!buffers[0]) return;
+		finish();
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wake.notify_all();
+		worker.join();
+
+		for (int i = 0; i < SLOTS; i++) {
+			// Persistent slots stay mapped; others are only mapped while RELEASED (none after finish).
+			if (slots[i].pixels) {
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[i]);
+				glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			}
+			slots[i] = Slot();
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		glDeleteBuffers(SLOTS, buffers);
+		buffers[0] = 0;
+	}
+
+	// Starts copying the framebuffer's first colour attachment (0: the window) into the next slot.
+	void capture(GLuint framebuffer) {
+		collect(false);
+
+		int index = (int)(frameCounter % SLOTS);
+		Slot& slot = slots[index];
+		if (stateOf(slot) == PENDING) {
+			// The GPU hasn't finished a copy from SLOTS frames ago.
+			auto start = std::chrono::steady_clock::now();
+			collect(true);
+			stats.gpuWaits++;
+			stats.gpuWaitMilliseconds += millisecondsSince(start);
+		}
+		if (stateOf(slot) != FREE) {
+			// The consumer is still working on that frame.
+			auto start = std::chrono::steady_clock::now();
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				released.wait(lock, [&]() { return slot.state == RELEASED; });
+			}
+			stats.consumerWaits++;
+			stats.consumerWaitMilliseconds += millisecondsSince(start);
+			collect(false);
+		}
+
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+		glReadBuffer(framebuffer == 0 ? GL_BACK : GL_COLOR_ATTACHMENT0);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[index]);
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		slot.frameIndex = frameCounter++;
+		slot.state = PENDING;
+		stats.captured++;
+	}
+
+	// Waits until every captured frame has been through the consumer.
+	void finish() {
+		collect(true);
+		std::unique_lock<std::mutex> lock(mutex);
+		released.wait(lock, [&]() {
+			for (const Slot& slot : slots) {
+				if (slot.state == DELIVERED) return false;
+			}
+			return true;
+		});
+		lock.unlock();
+		collect(false);
+	}
+
+	bool persistentMapping() const { return persistent; }
+
+	ReadbackStats endFrame() {
+		ReadbackStats finished = stats;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			finished.delivered = delivered;
+			delivered = 0;
+		}
+		stats = ReadbackStats();
+		return finished;
+	}
+
+private:
+	enum SlotState {
+		FREE,      // may be captured into
+		PENDING,   // copy queued on the GPU, fence not yet seen
+		DELIVERED, // with the consumer
+		RELEASED,  // consumer done, still to be unmapped / reused
+	};
+
+	struct Slot {
+		SlotState state = FREE;
+		GLsync fence = 0;
+		const unsigned char* pixels = nullptr;
+		uint64_t frameIndex = 0;
+	};
+
+	// The consumer thread moves slots from DELIVERED to RELEASED, so reads take the lock.
+	SlotState stateOf(const Slot& slot) {
+		std::lock_guard<std::mutex> lock(mutex);
+		return slot.state;
+	}
+
+	static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Recycles released slots and hands finished copies to the consumer, oldest first.
+	// wait: block on the fences instead of only taking the copies that are already done.
+	void collect(bool wait) {
+		for (int k = 0; k < SLOTS; k++) {
+			int index = (int)((frameCounter + k) % SLOTS);
+			Slot& slot = slots[index];
+			SlotState state = stateOf(slot);
+
+			if (state == RELEASED) {
+				if (!persistent) {
+					glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[index]);
+					glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+					glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+					slot.pixels = nullptr;
+				}
+				std::lock_guard<std::mutex> lock(mutex);
+				slot.state = FREE;
+				continue;
+			}
+			if (state != PENDING) continue;
+
+			GLenum status = glClientWaitSync(slot.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? ~0ull : 0);
+			if (status == GL_TIMEOUT_EXPIRED) {
+				// Later slots were captured after this one; they can't be done either.
+				if (!wait) break;
+				continue;
+			}
+			glDeleteSync(slot.fence);
+			slot.fence = 0;
+			if (status == GL_WAIT_FAILED) {
+				// The frame is lost. The slot must not stay PENDING: capture() would wait
+				// for a consumer that never gets it.
+				drop(slot);
+				continue;
+			}
+			if (!persistent) {
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, buffers[index]);
+				slot.pixels = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, stride * height, GL_MAP_READ_BIT);
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			}
+			if (!slot.pixels) {
+				// Mapping failed (or the persistent mapping in create() did): nothing to read.
+				drop(slot);
+				continue;
+			}
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				slot.state = DELIVERED;
+				queue.push_back(index);
+			}
+			wake.notify_one();
+		}
+	}
+
+	void drop(Slot& slot) {
+		stats.dropped++;
+		std::lock_guard<std::mutex> lock(mutex);
+		slot.state = FREE;
+	}
+
+	void consumerLoop() {
+		for (;;) {
+			int index;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				wake.wait(lock, [&]() { return stopping || !queue.empty(); });
+				if (queue.empty()) return;
+				index = queue.front();
+				queue.pop_front();
+			}
+			const Slot& slot = slots[index];
+			CapturedFrame frame = {slot.pixels, width, height, stride, slot.frameIndex};
+			consumer(frame);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				slots[index].state = RELEASED;
+				delivered++;
+			}
+			released.notify_all();
+		}
+	}
+
+	GLuint buffers[SLOTS] = {};
+	Slot slots[SLOTS];
+	int width = 0;
+	int height = 0;
+	size_t stride = 0;
+	bool persistent = false;
+	uint64_t frameCounter = 0;
+	Consumer consumer;
+	ReadbackStats stats;
+
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable wake;     // consumer: a frame was queued or we're stopping
+	std::condition_variable released; // render thread: the consumer released a slot
+	std::deque<int> queue;
+	unsigned int delivered = 0;
+	bool stopping = false;
+};
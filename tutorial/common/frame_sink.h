@@ -0,0 +1,446 @@
+#pragma once
+// Frame sink
+// Takes captured RGBA frames (e.g. from FrameReadback's consumer) and writes them to disk on
+// a pool of worker threads, so the render thread only pays for one copy into a recycled
+// buffer. The workers flip rows (GL returns the bottom row first), optionally apply the sRGB
+// transfer curve, convert and encode:
+//	SINK_PPM: one binary PPM (P6) per frame
+//	SINK_PNG: one PNG per frame; zlib stored blocks (no compression), so it costs no more
+//	          than a PPM to produce and any image tool can read it
+//	SINK_Y4M: a single YUV4MPEG2 stream (BT.601, 4:2:0); frames are encoded in parallel and
+//	          written in order
+// The queue in front of the workers is bounded. When it's full, submit() either waits
+// (SINK_BLOCK, nothing is ever lost) or drops the frame (SINK_DROP); both are counted.
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_readback.h"
+
+enum SinkFormat {
+	SINK_PPM,
+	SINK_PNG,
+	SINK_Y4M,
+};
+
+enum SinkBackpressure {
+	SINK_BLOCK,
+	SINK_DROP,
+};
+
+struct SinkOptions {
+	SinkFormat format = SINK_PNG;
+	// printf pattern with the frame number for PPM/PNG ("capture/frame_%05d.png"),
+	// the output file for Y4M ("capture/turntable.y4m"). Directories must exist.
+	std::string path = "frame_%05d.png";
+	bool flipRows = true;        // GL frames start with the bottom row
+	bool linearToSrgb = false;   // the renderer wrote linear values to a non-sRGB target
+	int framesPerSecond = 30;    // Y4M header only
+	unsigned int threads = 0;    // 0: one per hardware thread
+	size_t queueCapacity = 4;    // frames waiting for a worker
+	SinkBackpressure backpressure = SINK_BLOCK;
+};
+
+struct SinkStats {
+	unsigned int submitted = 0;
+	unsigned int written = 0;
+	unsigned int dropped = 0;
+	unsigned int blocked = 0;        // submit() calls that had to wait for room in the queue
+	double blockedMilliseconds = 0.0;
+	size_t maxQueued = 0;            // queue high-water mark
+	size_t bytesWritten = 0;
+	double encodeMilliseconds = 0.0; // summed over workers
+	unsigned int errors = 0;
+
+	void print(const char* label) const {
+		std::printf("%s: %u submitted, %u written (%.1f MB), %u dropped, %u errors\n",
+			label, submitted, written, bytesWritten / 1e6, dropped, errors);
+		std::printf("%s: queue max %zu, %u blocked submits (%.3f ms), %.3f ms encoding per frame\n",
+			label, maxQueued, blocked, blockedMilliseconds, written ? encodeMilliseconds / written : 0.0);
+	}
+};
+
+class FrameSink {
+public:
+	FrameSink() = default;
+	FrameSink(const FrameSink&) = delete;
+	FrameSink& operator=(const FrameSink&) = delete;
+	~FrameSink() { close(); }
+
+	void open(const SinkOptions& sinkOptions) {
+		options = sinkOptions;
+		if (options.queueCapacity == 0) options.queueCapacity = 1;
+		unsigned int threads = options.threads ? options.threads : std::thread::hardware_concurrency();
+		if (threads == 0) threads = 1;
+
+		for (int i = 0; i < 256; i++) {
+			float c = i / 255.0f;
+			float s = c <= 0.0031308f ? 12.92f * c : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+			srgb[i] = (unsigned char)(s * 255.0f + 0.5f);
+		}
+		if (options.format == SINK_Y4M) {
+			stream = std::fopen(options.path.c_str(), "wb");
+			if (!stream) {
+				std::printf("FrameSink: can't open %s\n", options.path.c_str());
+				stats.errors++;
+			}
+		}
+
+		stopping = false;
+		nextToWrite = 0;
+		for (unsigned int i = 0; i < threads; i++) workers.emplace_back([this]() { workerLoop(); });
+	}
+
+	// Queues a copy of the frame. Safe to call from any one thread (e.g. the readback consumer).
+	// Returns false if the frame was dropped.
+	bool submit(const CapturedFrame& frame) {
+		std::unique_lock<std::mutex> lock(mutex);
+		stats.submitted++;
+		if (queue.size() >= options.queueCapacity) {
+			if (options.backpressure == SINK_DROP) {
+				stats.dropped++;
+				// Y4M frames are written in order; a dropped frame must not hold up the rest.
+				skipped.push_back(frame.frameIndex);
+				return false;
+			}
+			auto start = std::chrono::steady_clock::now();
+			space.wait(lock, [&]() { return queue.size() < options.queueCapacity; });
+			stats.blocked++;
+			stats.blockedMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		Job job;
+		job.width = frame.width;
+		job.height = frame.height;
+		job.frameIndex = frame.frameIndex;
+		job.pixels = takeBuffer();
+		lock.unlock();
+
+		// The copy runs outside the lock so workers aren't held up by it.
+		size_t rowBytes = (size_t)frame.width * 4;
+		job.pixels.resize(rowBytes * frame.height);
+		for (int y = 0; y < frame.height; y++) {
+			std::memcpy(&job.pixels[y * rowBytes], frame.pixels + y * frame.stride, rowBytes);
+		}
+
+		lock.lock();
+		queue.push_back(std::move(job));
+		if (queue.size() > stats.maxQueued) stats.maxQueued = queue.size();
+		lock.unlock();
+		work.notify_one();
+		return true;
+	}
+
+	// Waits for every queued frame to be written, then stops the workers.
+	void close() {
+		if (workers.empty()) return;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		work.notify_all();
+		for (std::thread& worker : workers) worker.join();
+		workers.clear();
+		if (stream) std::fclose(stream);
+		stream = nullptr;
+	}
+
+	SinkStats statistics() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return stats;
+	}
+
+private:
+	struct Job {
+		std::vector<unsigned char> pixels; // RGBA, tightly packed, as captured
+		int width = 0;
+		int height = 0;
+		uint64_t frameIndex = 0;
+	};
+
+	std::vector<unsigned char> takeBuffer() {
+		if (freeBuffers.empty()) return std::vector<unsigned char>();
+		std::vector<unsigned char> buffer = std::move(freeBuffers.back());
+		freeBuffers.pop_back();
+		return buffer;
+	}
+
+	void workerLoop() {
+		std::vector<unsigned char> rgb, encoded;
+		for (;;) {
+			Job job;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				work.wait(lock, [&]() { return stopping || !queue.empty(); });
+				if (queue.empty()) return;
+				job = std::move(queue.front());
+				queue.pop_front();
+			}
+			space.notify_one();
+
+			auto start = std::chrono::steady_clock::now();
+			convert(job, rgb);
+			encoded.clear();
+			if (options.format == SINK_PPM) encodePPM(rgb, job.width, job.height, encoded);
+			else if (options.format == SINK_PNG) encodePNG(rgb, job.width, job.height, encoded);
+			else encodeY4MFrame(rgb, job.width, job.height, encoded);
+			double encodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			size_t bytes = encoded.size();
+			bool ok = options.format == SINK_Y4M ? writeInOrder(job, encoded) : writeFile(job.frameIndex, encoded);
+
+			std::lock_guard<std::mutex> lock(mutex);
+			stats.encodeMilliseconds += encodeMs;
+			if (ok) {
+				stats.written++;
+				stats.bytesWritten += bytes;
+			} else {
+				stats.errors++;
+			}
+			freeBuffers.push_back(std::move(job.pixels));
+		}
+	}
+
+	// RGBA -> RGB, top row first, sRGB curve if asked for.
+	void convert(const Job& job, std::vector<unsigned char>& rgb) const {
+		rgb.resize((size_t)job.width * job.height * 3);
+		for (int y = 0; y < job.height; y++) {
+			int sourceRow = options.flipRows ? job.height - 1 - y : y;
+			const unsigned char* in = &job.pixels[(size_t)sourceRow * job.width * 4];
+			unsigned char* out = &rgb[(size_t)y * job.width * 3];
+			if (options.linearToSrgb) {
+				for (int x = 0; x < job.width; x++, in += 4, out += 3) {
+					out[0] = srgb[in[0]];
+					out[1] = srgb[in[1]];
+					out[2] = srgb[in[2]];
+				}
+			} else {
+				for (int x = 0; x < job.width; x++, in += 4, out += 3) {
+					out[0] = in[0];
+					out[1] = in[1];
+					out[2] = in[2];
+				}
+			}
+		}
+	}
+
+	static void append(std::vector<unsigned char>& out, const void* data, size_t size) {
+		const unsigned char* bytes = (const unsigned char*)data;
+		out.insert(out.end(), bytes, bytes + size);
+	}
+	static void appendText(std::vector<unsigned char>& out, const std::string& text) {
+		append(out, text.data(), text.size());
+	}
+
+	static void encodePPM(const std::vector<unsigned char>& rgb, int width, int height, std::vector<unsigned char>& out) {
+		appendText(out, "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n");
+		append(out, rgb.data(), rgb.size());
+	}
+
+	// ---- PNG ----------------------------------------------------------------------------
+
+	static uint32_t crc32(const unsigned char* data, size_t size, uint32_t crc = 0) {
+		static uint32_t table[256];
+		static std::once_flag once;
+		std::call_once(once, []() {
+			for (uint32_t n = 0; n < 256; n++) {
+				uint32_t c = n;
+				for (int k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+				table[n] = c;
+			}
+		});
+		crc = ~crc;
+		for (size_t i = 0; i < size; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+		return ~crc;
+	}
+
+	static void appendBigEndian(std::vector<unsigned char>& out, uint32_t value) {
+		unsigned char bytes[4] = {(unsigned char)(value >> 24), (unsigned char)(value >> 16), (unsigned char)(value >> 8), (unsigned char)value};
+		append(out, bytes, 4);
+	}
+
+	// Length, type, data, CRC over type and data.
+	static void appendChunk(std::vector<unsigned char>& out, const char* type, const unsigned char* data, size_t size) {
+		appendBigEndian(out, (uint32_t)size);
+		size_t typeStart = out.size();
+		append(out, type, 4);
+		append(out, data, size);
+		appendBigEndian(out, crc32(&out[typeStart], size + 4));
+	}
+
+	static void encodePNG(const std::vector<unsigned char>& rgb, int width, int height, std::vector<unsigned char>& out) {
+		static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+		append(out, signature, 8);
+
+		unsigned char header[13] = {};
+		for (int i = 0; i < 4; i++) {
+			header[i] = (unsigned char)(width >> (24 - 8 * i));
+			header[4 + i] = (unsigned char)(height >> (24 - 8 * i));
+		}
+		header[8] = 8;  // bits per channel
+		header[9] = 2;  // RGB
+		appendChunk(out, "IHDR", header, sizeof(header));
+
+		// Scanlines (filter byte 0 + row) wrapped in a zlib stream of stored deflate blocks.
+		const size_t rowBytes = (size_t)width * 3;
+		const size_t rawSize = (rowBytes + 1) * height;
+		const size_t BLOCK = 65535;
+		std::vector<unsigned char> zlib;
+		zlib.reserve(2 + rawSize + (rawSize / BLOCK + 1) * 5 + 4);
+		zlib.push_back(0x78);
+		zlib.push_back(0x01);
+		uint32_t adlerA = 1, adlerB = 0;
+		size_t remaining = rawSize, row = 0, column = 0;
+		while (remaining > 0) {
+			size_t blockSize = remaining < BLOCK ? remaining : BLOCK;
+			remaining -= blockSize;
+			zlib.push_back(remaining == 0 ? 1 : 0);
+			zlib.push_back((unsigned char)blockSize);
+			zlib.push_back((unsigned char)(blockSize >> 8));
+			zlib.push_back((unsigned char)~blockSize);
+			zlib.push_back((unsigned char)(~blockSize >> 8));
+			// Copy the block out of the scanlines, a row segment at a time.
+			size_t left = blockSize;
+			while (left > 0) {
+				if (column == 0) {
+					zlib.push_back(0); // filter: none
+					adlerB = (adlerB + adlerA) % 65521;
+					column = 1;
+					left--;
+					continue;
+				}
+				size_t take = rowBytes - (column - 1);
+				if (take > left) take = left;
+				const unsigned char* data = &rgb[row * rowBytes + (column - 1)];
+				zlib.insert(zlib.end(), data, data + take);
+				// 5552 bytes is the longest run whose sums can't overflow 32 bits before the modulo.
+				for (size_t i = 0; i < take;) {
+					size_t end = i + 5552 < take ? i + 5552 : take;
+					for (; i < end; i++) {
+						adlerA += data[i];
+						adlerB += adlerA;
+					}
+					adlerA %= 65521;
+					adlerB %= 65521;
+				}
+				column += take;
+				left -= take;
+				if (column == rowBytes + 1) {
+					column = 0;
+					row++;
+				}
+			}
+		}
+		appendBigEndian(zlib, (adlerB << 16) | adlerA);
+		appendChunk(out, "IDAT", zlib.data(), zlib.size());
+		appendChunk(out, "IEND", nullptr, 0);
+	}
+
+	// ---- Y4M ----------------------------------------------------------------------------
+
+	// BT.601 limited range, chroma averaged over 2x2 pixels.
+	static void encodeY4MFrame(const std::vector<unsigned char>& rgb, int width, int height, std::vector<unsigned char>& out) {
+		appendText(out, "FRAME\n");
+		const int chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+		size_t base = out.size();
+		out.resize(base + (size_t)width * height + 2 * (size_t)chromaWidth * chromaHeight);
+		unsigned char* yPlane = &out[base];
+		unsigned char* uPlane = yPlane + (size_t)width * height;
+		unsigned char* vPlane = uPlane + (size_t)chromaWidth * chromaHeight;
+
+		for (int y = 0; y < height; y++) {
+			const unsigned char* p = &rgb[(size_t)y * width * 3];
+			for (int x = 0; x < width; x++, p += 3) {
+				yPlane[(size_t)y * width + x] = (unsigned char)((66 * p[0] + 129 * p[1] + 25 * p[2] + 128 + (16 << 8)) >> 8);
+			}
+		}
+		for (int cy = 0; cy < chromaHeight; cy++) {
+			for (int cx = 0; cx < chromaWidth; cx++) {
+				int r = 0, g = 0, b = 0, n = 0;
+				for (int dy = 0; dy < 2; dy++) {
+					for (int dx = 0; dx < 2; dx++) {
+						int x = 2 * cx + dx, y = 2 * cy + dy;
+						if (x >= width || y >= height) continue;
+						const unsigned char* p = &rgb[((size_t)y * width + x) * 3];
+						r += p[0];
+						g += p[1];
+						b += p[2];
+						n++;
+					}
+				}
+				r /= n;
+				g /= n;
+				b /= n;
+				uPlane[(size_t)cy * chromaWidth + cx] = (unsigned char)((-38 * r - 74 * g + 112 * b + 128 + (128 << 8)) >> 8);
+				vPlane[(size_t)cy * chromaWidth + cx] = (unsigned char)((112 * r - 94 * g - 18 * b + 128 + (128 << 8)) >> 8);
+			}
+		}
+	}
+
+	// Y4M is one stream: whoever finishes the next frame in line writes it and any
+	// finished frames that were waiting behind it.
+	bool writeInOrder(const Job& job, std::vector<unsigned char>& encoded) {
+		std::lock_guard<std::mutex> lock(streamMutex);
+		if (!stream) return false;
+		if (!headerWritten) {
+			std::string header = "YUV4MPEG2 W" + std::to_string(job.width) + " H" + std::to_string(job.height) +
+				" F" + std::to_string(options.framesPerSecond) + ":1 Ip A1:1 C420jpeg\n";
+			std::fwrite(header.data(), 1, header.size(), stream);
+			headerWritten = true;
+		}
+		pending[job.frameIndex].swap(encoded);
+		bool ok = true;
+		for (;;) {
+			{
+				std::lock_guard<std::mutex> queueLock(mutex);
+				while (!skipped.empty() && skipped.front() == nextToWrite) {
+					skipped.pop_front();
+					nextToWrite++;
+				}
+			}
+			auto it = pending.find(nextToWrite);
+			if (it == pending.end()) break;
+			ok &= std::fwrite(it->second.data(), 1, it->second.size(), stream) == it->second.size();
+			pending.erase(it);
+			nextToWrite++;
+		}
+		return ok;
+	}
+
+	bool writeFile(uint64_t frameIndex, const std::vector<unsigned char>& encoded) {
+		char name[1024];
+		std::snprintf(name, sizeof(name), options.path.c_str(), (int)frameIndex);
+		FILE* file = std::fopen(name, "wb");
+		if (!file) return false;
+		bool ok = std::fwrite(encoded.data(), 1, encoded.size(), file) == encoded.size();
+		return std::fclose(file) == 0 && ok;
+	}
+
+	SinkOptions options;
+	unsigned char srgb[256];
+	std::vector<std::thread> workers;
+
+	std::mutex mutex;                 // queue, buffers, stats
+	std::condition_variable work;     // workers: a job was queued or we're stopping
+	std::condition_variable space;    // submit(): a job left the queue
+	std::deque<Job> queue;
+	std::vector<std::vector<unsigned char>> freeBuffers;
+	std::deque<uint64_t> skipped;     // dropped frame numbers, for the Y4M writer
+	SinkStats stats;
+	bool stopping = false;
+
+	std::mutex streamMutex;           // Y4M stream and reordering
+	FILE* stream = nullptr;
+	bool headerWritten = false;
+	uint64_t nextToWrite = 0;
+	std::map<uint64_t, std::vector<unsigned char>> pending;
+};
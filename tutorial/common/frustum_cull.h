@@ -0,0 +1,236 @@
+#pragma once
+// View-frustum culling
+// frustumFromMatrix() takes the six clip planes out of Projection * View (glm::perspective,
+// glm::lookAt or anything else that maps to GL clip space). Bounding volumes are stored as
+// SoA streams, BoundingBoxArray as centre and half extent, BoundingSphereArray as centre and
+// radius, and the kernels test 4, 8 or 16 of them per step against all six planes, compiled
+// and dispatched per instruction set like batch_transform.h. The visible ones come out as a
+// compact, ascending index list.
+// FrustumCuller runs the kernels over chunks of CULL_CHUNK objects, on a TaskPool if it has
+// one, and joins the chunks' lists. The test is conservative: a volume that straddles two
+// planes outside a frustum corner is kept.
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "aligned_memory.h"
+#include "simd_dispatch.h"
+#include "task_pool.h"
+
+// Planes (n, d) with n.p + d >= 0 inside, normalized so that n.p + d is a distance:
+// left, right, bottom, top, near, far.
+struct Frustum {
+	glm::vec4 planes[6];
+
+	float distance(int plane, const glm::vec3& p) const {
+		return planes[plane].z * p.z + (planes[plane].y * p.y + (planes[plane].x * p.x + planes[plane].w));
+	}
+
+	// Box given as centre and half extent
+	bool intersects(const glm::vec3& center, const glm::vec3& extent) const {
+		for (int p = 0; p < 6; p++) {
+			glm::vec3 n = glm::abs(glm::vec3(planes[p]));
+			if (distance(p, center) + (n.x * extent.x + n.y * extent.y + n.z * extent.z) < 0.0f) return false;
+		}
+		return true;
+	}
+
+	bool intersects(const glm::vec3& center, float radius) const {
+		for (int p = 0; p < 6; p++) {
+			if (distance(p, center) + radius < 0.0f) return false;
+		}
+		return true;
+	}
+};
+
+// Gribb and Hartmann: with rows r0..r3 of projectionView, a clip-space point is inside while
+// -w <= x <= w and so on, i.e. (r3 + r0).p >= 0, (r3 - r0).p >= 0, ... Near is r2 alone
+// when GLM maps depth to [0, 1].
+inline Frustum frustumFromMatrix(const glm::mat4& projectionView) {
+	glm::mat4 rows = glm::transpose(projectionView);
+	Frustum frustum;
+	frustum.planes[0] = rows[3] + rows[0];
+	frustum.planes[1] = rows[3] - rows[0];
+	frustum.planes[2] = rows[3] + rows[1];
+	frustum.planes[3] = rows[3] - rows[1];
+#if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
+	frustum.planes[4] = rows[2];
+#else
+	frustum.planes[4] = rows[3] + rows[2];
+#endif
+	frustum.planes[5] = rows[3] - rows[2];
+	for (glm::vec4& plane : frustum.planes) plane /= glm::length(glm::vec3(plane));
+	return frustum;
+}
+
+struct BoundingBoxArray {
+	AlignedVector<float> centerX, centerY, centerZ, extentX, extentY, extentZ;
+
+	void resize(size_t count) {
+		for (AlignedVector<float>* stream : {&centerX, &centerY, &centerZ, &extentX, &extentY, &extentZ}) stream->resize(count);
+	}
+	size_t size() const { return centerX.size(); }
+
+	void set(size_t i, const glm::vec3& min, const glm::vec3& max) {
+		glm::vec3 c = (min + max) * 0.5f, e = (max - min) * 0.5f;
+		centerX[i] = c.x;
+		centerY[i] = c.y;
+		centerZ[i] = c.z;
+		extentX[i] = e.x;
+		extentY[i] = e.y;
+		extentZ[i] = e.z;
+	}
+	glm::vec3 center(size_t i) const { return glm::vec3(centerX[i], centerY[i], centerZ[i]); }
+	glm::vec3 extent(size_t i) const { return glm::vec3(extentX[i], extentY[i], extentZ[i]); }
+};
+
+struct BoundingSphereArray {
+	AlignedVector<float> centerX, centerY, centerZ, radius;
+
+	void resize(size_t count) {
+		for (AlignedVector<float>* stream : {&centerX, &centerY, &centerZ, &radius}) stream->resize(count);
+	}
+	size_t size() const { return centerX.size(); }
+
+	void set(size_t i, const glm::vec3& center, float r) {
+		centerX[i] = center.x;
+		centerY[i] = center.y;
+		centerZ[i] = center.z;
+		radius[i] = r;
+	}
+	glm::vec3 center(size_t i) const { return glm::vec3(centerX[i], centerY[i], centerZ[i]); }
+};
+
+namespace frustum_cull_scalar {
+#include "frustum_cull.inl"
+}
+
+#if SIMD_DISPATCH_X86
+SIMD_TARGET_SSE41
+namespace frustum_cull_sse41 {
+#define SIMD_LANES_SSE41
+#include "frustum_cull.inl"
+#undef SIMD_LANES_SSE41
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX2
+namespace frustum_cull_avx2 {
+#define SIMD_LANES_AVX2
+#include "frustum_cull.inl"
+#undef SIMD_LANES_AVX2
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX512
+namespace frustum_cull_avx512 {
+#define SIMD_LANES_AVX512
+#include "frustum_cull.inl"
+#undef SIMD_LANES_AVX512
+}
+SIMD_TARGET_END
+#endif
+
+// The kernels for one level (clamped to what was compiled in). Each culls the objects in
+// [begin, end) and writes the visible indices, ascending, to visible (room for end - begin).
+struct FrustumCullKernels {
+	SimdLevel level;
+	int width; // objects per step
+	size_t (*cullBoxes)(const Frustum& frustum, const BoundingBoxArray& boxes, size_t begin, size_t end, uint32_t* visible);
+	size_t (*cullSpheres)(const Frustum& frustum, const BoundingSphereArray& spheres, size_t begin, size_t end, uint32_t* visible);
+};
+
+inline FrustumCullKernels frustumCullKernels(SimdLevel level = simdLevel()) {
+#if SIMD_DISPATCH_X86
+	if (level >= SIMD_AVX512) return {SIMD_AVX512, frustum_cull_avx512::WIDTH, frustum_cull_avx512::cullBoxes, frustum_cull_avx512::cullSpheres};
+	if (level >= SIMD_AVX2) return {SIMD_AVX2, frustum_cull_avx2::WIDTH, frustum_cull_avx2::cullBoxes, frustum_cull_avx2::cullSpheres};
+	if (level >= SIMD_SSE41) return {SIMD_SSE41, frustum_cull_sse41::WIDTH, frustum_cull_sse41::cullBoxes, frustum_cull_sse41::cullSpheres};
+#endif
+	return {SIMD_SCALAR, frustum_cull_scalar::WIDTH, frustum_cull_scalar::cullBoxes, frustum_cull_scalar::cullSpheres};
+}
+
+// Objects per task; a multiple of every WIDTH, so only the last chunk has a scalar tail.
+const size_t CULL_CHUNK = 16384;
+
+struct CullStats {
+	unsigned int runs = 0;
+	size_t objects = 0;
+	size_t visible = 0;
+	double milliseconds = 0.0;
+
+	void print(const char* label) const {
+		std::printf("%s: culled %zu of %zu objects in %u runs, %.3f ms\n", label, objects - visible, objects, runs, milliseconds);
+	}
+};
+
+class FrustumCuller {
+public:
+	// pool may be null (or have one thread): everything then runs on the calling thread.
+	void create(TaskPool* taskPool = nullptr, SimdLevel level = simdLevel()) {
+		pool = taskPool;
+		kernels = frustumCullKernels(level);
+	}
+
+	// Returns the number of visible objects; their indices are visible()[0 .. count).
+	size_t cull(const Frustum& frustum, const BoundingBoxArray& boxes) {
+		return run(boxes.size(), [&](size_t begin, size_t end, uint32_t* out) { return kernels.cullBoxes(frustum, boxes, begin, end, out); });
+	}
+	size_t cull(const Frustum& frustum, const BoundingSphereArray& spheres) {
+		return run(spheres.size(), [&](size_t begin, size_t end, uint32_t* out) { return kernels.cullSpheres(frustum, spheres, begin, end, out); });
+	}
+
+	const uint32_t* visible() const { return indices.data(); }
+	SimdLevel level() const { return kernels.level; }
+
+	CullStats endFrame() {
+		CullStats finished = stats;
+		stats = CullStats();
+		return finished;
+	}
+
+private:
+	// Each chunk writes its list into its own stretch of scratch; a second pass moves the lists
+	// together. With a single chunk the kernel writes the result directly.
+	template <typename Kernel>
+	size_t run(size_t count, const Kernel& kernel) {
+		auto start = std::chrono::steady_clock::now();
+		if (indices.size() < count) indices.resize(count);
+		size_t chunks = (count + CULL_CHUNK - 1) / CULL_CHUNK;
+		size_t visibleCount = 0;
+		if (!pool || pool->threadCount() <= 1 || chunks <= 1) {
+			visibleCount = kernel(0, count, indices.data());
+		} else {
+			if (scratch.size() < count) scratch.resize(count);
+			chunkCounts.resize(chunks);
+			pool->run(chunks, [&](size_t chunk, unsigned int) {
+				size_t begin = chunk * CULL_CHUNK;
+				chunkCounts[chunk] = kernel(begin, std::min(count, begin + CULL_CHUNK), scratch.data() + begin);
+			});
+			chunkOffsets.resize(chunks);
+			for (size_t chunk = 0; chunk < chunks; chunk++) {
+				chunkOffsets[chunk] = visibleCount;
+				visibleCount += chunkCounts[chunk];
+			}
+			pool->run(chunks, [&](size_t chunk, unsigned int) {
+				const uint32_t* list = scratch.data() + chunk * CULL_CHUNK;
+				std::copy(list, list + chunkCounts[chunk], indices.data() + chunkOffsets[chunk]);
+			});
+		}
+		stats.runs++;
+		stats.objects += count;
+		stats.visible += visibleCount;
+		stats.milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return visibleCount;
+	}
+
+	TaskPool* pool = nullptr;
+	FrustumCullKernels kernels = frustumCullKernels(SIMD_SCALAR);
+	AlignedVector<uint32_t> indices, scratch;
+	std::vector<size_t> chunkCounts, chunkOffsets;
+	CullStats stats;
+};
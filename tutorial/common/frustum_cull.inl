@@ -0,0 +1,73 @@
+// Frustum culling kernels, compiled once per instruction set (see simd_lanes.inl).
+// No include guard on purpose.
+#include "simd_lanes.inl"
+
+// One plane broadcast: its normal, the normal's absolute value and its offset
+struct PlaneLanes {
+	Lanes nx, ny, nz, ax, ay, az, d;
+};
+
+inline void loadPlanes(const Frustum& frustum, PlaneLanes* out) {
+	for (int p = 0; p < 6; p++) {
+		const glm::vec4& plane = frustum.planes[p];
+		out[p] = {broadcast(plane.x), broadcast(plane.y), broadcast(plane.z),
+			broadcast(std::fabs(plane.x)), broadcast(std::fabs(plane.y)), broadcast(std::fabs(plane.z)), broadcast(plane.w)};
+	}
+}
+
+// Writes the indices in [begin, end) of the boxes that intersect the frustum to visible, in
+// order, and returns how many. visible needs room for end - begin indices.
+inline size_t cullBoxes(const Frustum& frustum, const BoundingBoxArray& boxes, size_t begin, size_t end, uint32_t* visible) {
+	PlaneLanes plane[6];
+	loadPlanes(frustum, plane);
+	const Lanes zero = broadcast(0.0f);
+	size_t count = 0;
+	size_t i = begin;
+	for (; i < end && i % WIDTH; i++) {
+		visible[count] = (uint32_t)i;
+		count += frustum.intersects(boxes.center(i), boxes.extent(i));
+	}
+	for (; i + WIDTH <= end; i += WIDTH) {
+		Lanes cx = load(&boxes.centerX[i]), cy = load(&boxes.centerY[i]), cz = load(&boxes.centerZ[i]);
+		Lanes ex = load(&boxes.extentX[i]), ey = load(&boxes.extentY[i]), ez = load(&boxes.extentZ[i]);
+		// The smallest over the planes of n.c + d + |n|.e; negative means outside one of them
+		Lanes nearest = broadcast(INFINITY);
+		for (int p = 0; p < 6; p++) {
+			Lanes distance = madd(plane[p].nz, cz, madd(plane[p].ny, cy, madd(plane[p].nx, cx, plane[p].d)));
+			nearest = min(nearest, madd(plane[p].az, ez, madd(plane[p].ay, ey, madd(plane[p].ax, ex, distance))));
+		}
+		count += compressIndices(visible + count, (uint32_t)i, greaterEqualMask(nearest, zero));
+	}
+	for (; i < end; i++) {
+		visible[count] = (uint32_t)i;
+		count += frustum.intersects(boxes.center(i), boxes.extent(i));
+	}
+	return count;
+}
+
+// The same for spheres: outside once n.c + d < -r for some plane.
+inline size_t cullSpheres(const Frustum& frustum, const BoundingSphereArray& spheres, size_t begin, size_t end, uint32_t* visible) {
+	PlaneLanes plane[6];
+	loadPlanes(frustum, plane);
+	const Lanes zero = broadcast(0.0f);
+	size_t count = 0;
+	size_t i = begin;
+	for (; i < end && i % WIDTH; i++) {
+		visible[count] = (uint32_t)i;
+		count += frustum.intersects(spheres.center(i), spheres.radius[i]);
+	}
+	for (; i + WIDTH <= end; i += WIDTH) {
+		Lanes cx = load(&spheres.centerX[i]), cy = load(&spheres.centerY[i]), cz = load(&spheres.centerZ[i]);
+		Lanes nearest = broadcast(INFINITY);
+		for (int p = 0; p < 6; p++) {
+			nearest = min(nearest, madd(plane[p].nz, cz, madd(plane[p].ny, cy, madd(plane[p].nx, cx, plane[p].d))));
+		}
+		Lanes radius = load(&spheres.radius[i]);
+		count += compressIndices(visible + count, (uint32_t)i, greaterEqualMask(add(nearest, radius), zero));
+	}
+	for (; i < end; i++) {
+		visible[count] = (uint32_t)i;
+		count += frustum.intersects(spheres.center(i), spheres.radius[i]);
+	}
+	return count;
+}
@@ -0,0 +1,356 @@
+#pragma once
+// GL context
+// GLContext opens what the demos draw into, creates the GL context and loads GL with glad.
+//	default:                GLFW window; drawing goes to its back buffer (framebuffer 0).
+//	-DGL_CONTEXT_HEADLESS:  EGL, no display needed (Mesa llvmpipe on a render node ...).
+//	                        Surfaceless where EGL_MESA_platform_surfaceless and
+//	                        EGL_KHR_surfaceless_context exist, a 1x1 pbuffer otherwise;
+//	                        drawing goes to an FBO of the requested size. Link with -lEGL
+//	                        instead of GLFW.
+// Headless runs stop after GL_CONTEXT_FRAMES frames (environment variable, default 300) and
+// print the average frame time when destroyed. swapBuffers() waits for the GPU there, so
+// each frame is timed from one swap to the next including all of its rendering.
+// With GL_CONTEXT_ON_DEMAND=1 in the environment glad loads each entry point on its first
+// call (gladLoadGLOnDemand) instead of all of them up front, which shortens the startup of
+// short-lived processes; loadMilliseconds() tells what loading took either way.
+// Built with -DGL_CONTEXT_TOOLS (and linked with gl_debug.c), two more variables are read:
+//	GL_CONTEXT_TRACE=path:  every GL call after create() is recorded to a trace (see
+//	                        gl_trace.h), each swap ending a frame, until destroy() or for
+//	                        GL_CONTEXT_TRACE_FRAMES frames; bench_gl_replay plays it back.
+//	GL_CONTEXT_PROFILE=1:   every GL call is timed instead (see gl_profiler.h), the swap as a
+//	                        scope of its own; profileStats() returns the per-function report
+//	                        since the last call and destroy() prints what's left.
+//	                        Tracing takes precedence over profiling.
+// Without it neither is compiled in and profiling() is always false.
+#include <glad/gl.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef GL_CONTEXT_TOOLS
+#include "gl_profiler.h"
+#include "gl_trace.h"
+#endif
+
+#ifdef GL_CONTEXT_HEADLESS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#else
+#include <GLFW/glfw3.h>
+#endif
+
+struct FrameTimeStats {
+	unsigned int frames = 0;
+	double totalMilliseconds = 0.0;
+	double minMilliseconds = 0.0;
+	double maxMilliseconds = 0.0;
+
+	void add(double ms) {
+		if (frames == 0 || ms < minMilliseconds) minMilliseconds = ms;
+		if (frames == 0 || ms > maxMilliseconds) maxMilliseconds = ms;
+		totalMilliseconds += ms;
+		frames++;
+	}
+	void print(const char* label) const {
+		if (frames == 0) return;
+		std::printf("%s: %u frames, %.3f ms/frame (min %.3f, max %.3f)\n",
+			label, frames, totalMilliseconds / frames, minMilliseconds, maxMilliseconds);
+	}
+};
+
+class GLContext {
+public:
+	GLContext() = default;
+	GLContext(const GLContext&) = delete;
+	GLContext& operator=(const GLContext&) = delete;
+	~GLContext() { destroy(); }
+
+	// Creates a visible window (or a headless target) with a current core profile context.
+	// Errors are printed; returns false if anything failed.
+	bool create(const char* title, int width, int height, int major = 3, int minor = 3, bool visible = true) {
+		this->width = width;
+		this->height = height;
+#ifdef GL_CONTEXT_HEADLESS
+		(void)title;
+		(void)visible;
+		const char* frames = std::getenv("GL_CONTEXT_FRAMES");
+		if (frames) frameLimit = std::atoi(frames);
+		if (!createEGL(major, minor)) {
+			destroy();
+			return false;
+		}
+		if (!createFramebuffer()) {
+			std::printf("Failed to create the offscreen framebuffer\n");
+			destroy();
+			return false;
+		}
+#else
+		if (!glfwInit()) {
+			std::printf("Failed to initialize GLFW\n");
+			return false;
+		}
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+#ifdef __APPLE__
+		glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+		window = glfwCreateWindow(width, height, title, NULL, NULL);
+		if (window == NULL) {
+			std::printf("Failed to create GLFW window\n");
+			glfwTerminate();
+			return false;
+		}
+		glfwMakeContextCurrent(window);
+		if (!loadGL(glfwGetProcAddress)) {
+			std::printf("Failed to initialize GLAD\n");
+			destroy();
+			return false;
+		}
+#endif
+#ifdef GL_CONTEXT_TOOLS
+		startTrace();
+		startProfile();
+#endif
+		lastSwap = std::chrono::steady_clock::now();
+		return true;
+	}
+
+	void destroy() {
+#ifdef GL_CONTEXT_TOOLS
+		stopTrace();
+		if (profiler.profiling()) {
+			profiler.collect().print("GL profile");
+			profiler.stop();
+		}
+#endif
+#ifdef GL_CONTEXT_HEADLESS
+		if (context != EGL_NO_CONTEXT) {
+			frameTimes.print("headless");
+			if (fbo) {
+				glDeleteFramebuffers(1, &fbo);
+				glDeleteRenderbuffers(2, renderbuffers);
+				fbo = 0;
+			}
+			eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			eglDestroyContext(display, context);
+			context = EGL_NO_CONTEXT;
+		}
+		if (surface != EGL_NO_SURFACE) eglDestroySurface(display, surface);
+		surface = EGL_NO_SURFACE;
+		if (display != EGL_NO_DISPLAY) eglTerminate(display);
+		display = EGL_NO_DISPLAY;
+#else
+		if (window) {
+			glfwDestroyWindow(window);
+			glfwTerminate();
+		}
+		window = NULL;
+#endif
+	}
+
+	// False once the user closed the window or pressed ESC, or the headless frame limit is reached.
+	bool running() const {
+#ifdef GL_CONTEXT_HEADLESS
+		return frameLimit <= 0 || (int)frameTimes.frames < frameLimit;
+#else
+		return glfwGetKey(window, GLFW_KEY_ESCAPE) != GLFW_PRESS && glfwWindowShouldClose(window) == 0;
+#endif
+	}
+
+	// Presents the frame and handles window events.
+	void swapBuffers() {
+#ifdef GL_CONTEXT_HEADLESS
+		glFinish();
+#elif defined(GL_CONTEXT_TOOLS)
+		if (profiler.profiling()) profiler.beginScope(swapScope);
+		glfwSwapBuffers(window);
+		if (profiler.profiling()) profiler.endScope(swapScope);
+		glfwPollEvents();
+#else
+		glfwSwapBuffers(window);
+		glfwPollEvents();
+#endif
+		auto now = std::chrono::steady_clock::now();
+		frameTimes.add(std::chrono::duration<double, std::milli>(now - lastSwap).count());
+		lastSwap = now;
+#ifdef GL_CONTEXT_TOOLS
+		if (profiler.profiling()) profiler.endFrame();
+		if (trace.recording()) {
+			trace.endFrame();
+			if (traceFrameLimit > 0 && (int)trace.statistics().frames >= traceFrameLimit) stopTrace();
+		}
+#endif
+	}
+
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	// The framebuffer the demo renders to: 0 for a window, the offscreen FBO when headless.
+	GLuint framebuffer() const { return fbo; }
+	const FrameTimeStats& frameStats() const { return frameTimes; }
+	double loadMilliseconds() const { return glLoadMilliseconds; }
+#ifdef GL_CONTEXT_TOOLS
+	bool profiling() const { return profiler.profiling(); }
+	GLProfileStats profileStats() { return profiler.collect(); }
+#else
+	bool profiling() const { return false; }
+#endif
+
+	static constexpr bool headless() {
+#ifdef GL_CONTEXT_HEADLESS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+#ifndef GL_CONTEXT_HEADLESS
+	GLFWwindow* getWindow() const { return window; }
+#endif
+
+private:
+	bool loadGL(GLADloadfunc load) {
+		const char* onDemand = std::getenv("GL_CONTEXT_ON_DEMAND");
+		auto start = std::chrono::steady_clock::now();
+		int version = onDemand && std::atoi(onDemand) ? gladLoadGLOnDemand(load) : gladLoadGL(load);
+		glLoadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return version != 0;
+	}
+
+#ifdef GL_CONTEXT_TOOLS
+	void startTrace() {
+		const char* path = std::getenv("GL_CONTEXT_TRACE");
+		if (!path || !*path) return;
+		const char* frames = std::getenv("GL_CONTEXT_TRACE_FRAMES");
+		traceFrameLimit = frames ? std::atoi(frames) : 0;
+		if (trace.open(path, width, height)) std::printf("recording GL calls to %s\n", path);
+	}
+
+	void startProfile() {
+		const char* profile = std::getenv("GL_CONTEXT_PROFILE");
+		if (!profile || !std::atoi(profile) || trace.recording()) return;
+		profiler.start();
+		swapScope = profiler.scope("glfwSwapBuffers");
+	}
+
+	void stopTrace() {
+		if (!trace.recording()) return;
+		trace.close();
+		trace.statistics().print("GL trace");
+	}
+#endif
+
+#ifdef GL_CONTEXT_HEADLESS
+	static GLADapiproc loadEGLProc(const char* name) {
+		return (GLADapiproc)eglGetProcAddress(name);
+	}
+
+	static bool hasExtension(const char* extensions, const char* name) {
+		if (!extensions) return false;
+		size_t length = std::strlen(name);
+		for (const char* p = std::strstr(extensions, name); p; p = std::strstr(p + length, name)) {
+			if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) return true;
+		}
+		return false;
+	}
+
+	bool createEGL(int major, int minor) {
+		// Client extensions tell whether the surfaceless platform is there at all.
+		const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+			(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay && hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless")) {
+			display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		}
+		if (display == EGL_NO_DISPLAY) display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		EGLint eglMajor = 0, eglMinor = 0;
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, &eglMajor, &eglMinor)) {
+			std::printf("Failed to initialize EGL\n");
+			display = EGL_NO_DISPLAY;
+			return false;
+		}
+		if (!eglBindAPI(EGL_OPENGL_API)) {
+			std::printf("EGL has no desktop OpenGL\n");
+			return false;
+		}
+
+		bool surfaceless = hasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+		const EGLint configAttributes[] = {
+			EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+			EGL_NONE
+		};
+		EGLConfig config;
+		EGLint configCount = 0;
+		if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0) {
+			std::printf("No suitable EGL config\n");
+			return false;
+		}
+		if (!surfaceless) {
+			const EGLint pbufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+			surface = eglCreatePbufferSurface(display, config, pbufferAttributes);
+			if (surface == EGL_NO_SURFACE) {
+				std::printf("Failed to create an EGL pbuffer\n");
+				return false;
+			}
+		}
+
+		const EGLint contextAttributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, major,
+			EGL_CONTEXT_MINOR_VERSION, minor,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+		if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, surface, surface, context)) {
+			std::printf("Failed to create an OpenGL %d.%d EGL context\n", major, minor);
+			return false;
+		}
+		if (!loadGL(loadEGLProc)) {
+			std::printf("Failed to initialize GLAD\n");
+			return false;
+		}
+		return true;
+	}
+
+	// Colour and depth renderbuffers standing in for the window's back buffer.
+	bool createFramebuffer() {
+		glGenRenderbuffers(2, renderbuffers);
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		glGenFramebuffers(1, &fbo);
+		glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+		glViewport(0, 0, width, height);
+		return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+	}
+
+	EGLDisplay display = EGL_NO_DISPLAY;
+	EGLSurface surface = EGL_NO_SURFACE;
+	EGLContext context = EGL_NO_CONTEXT;
+	GLuint renderbuffers[2] = {0, 0};
+	int frameLimit = 300;
+#else
+	GLFWwindow* window = NULL;
+#endif
+	GLuint fbo = 0;
+	int width = 0;
+	int height = 0;
+	double glLoadMilliseconds = 0.0;
+#ifdef GL_CONTEXT_TOOLS
+	GLTraceRecorder trace;
+	int traceFrameLimit = 0;
+	GLProfiler profiler;
+	unsigned int swapScope = 0;
+#endif
+	FrameTimeStats frameTimes;
+	std::chrono::steady_clock::time_point lastSwap;
+};
@@ -0,0 +1,186 @@
+#pragma once
+// Per-call GL CPU cost profiler
+// GLProfiler installs glad's debug layer (gladInstallGLDebug) and times every GL call made
+// through the glad_gl* pointers with the TSC (steady_clock on non-x86 builds): the pre
+// callback reads the counter, the post callback adds the difference and a call to the
+// function's entry. Code that isn't a GL call, like the swap, is timed with scopes
+// (beginScope/endScope); GL calls made inside a scope are counted for those calls only, so
+// every tick is reported once.
+// collect() hands out what was gathered since the last collect() and starts over; its
+// report lists where the CPU time of a frame went, per function, most expensive first.
+// Ticks are converted to time with the rate measured against steady_clock over the same
+// period. The times are the calls' wall time on the calling thread: work the driver does
+// on its own threads is only seen when a call waits for it.
+//
+// Uses the same callbacks as GLTraceRecorder; only one of the two can run at a time.
+#include <glad/gl.h>
+#include <glad/gl_debug.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+struct GLProfileEntry {
+	const char* name = nullptr;
+	unsigned int calls = 0;
+	uint64_t ticks = 0;
+};
+
+struct GLProfileStats {
+	unsigned int frames = 0;
+	double nanosecondsPerTick = 0.0;
+	std::vector<GLProfileEntry> entries;  // called at least once, most ticks first
+
+	double milliseconds(const GLProfileEntry& entry) const { return entry.ticks * nanosecondsPerTick * 1e-6; }
+
+	// The top entries per frame, and what all of them add up to
+	void print(const char* label, size_t top = 10) const {
+		if (frames == 0 || entries.empty()) return;
+		double total = 0.0;
+		unsigned int calls = 0;
+		for (const GLProfileEntry& entry : entries) {
+			total += milliseconds(entry);
+			calls += entry.calls;
+		}
+		std::printf("%s: GL CPU time %.3f ms/frame in %.1f calls/frame over %u frames\n", label, total / frames, (double)calls / frames, frames);
+		for (size_t i = 0; i < std::min(top, entries.size()); i++) {
+			const GLProfileEntry& entry = entries[i];
+			double ms = milliseconds(entry);
+			std::printf("  %-28s %9.4f ms/frame %5.1f%%  %7.1f calls/frame  %9.1f ns/call\n", entry.name, ms / frames,
+				total > 0.0 ? ms / total * 100.0 : 0.0, (double)entry.calls / frames, ms * 1e6 / entry.calls);
+		}
+	}
+};
+
+class GLProfiler {
+public:
+	GLProfiler() = default;
+	GLProfiler(const GLProfiler&) = delete;
+	GLProfiler& operator=(const GLProfiler&) = delete;
+	~GLProfiler() { stop(); }
+
+	// Starts timing the GL calls of the loaded context. Only one profiler can run at a time.
+	// Scopes registered before stay valid.
+	bool start() {
+		if (running || active()) return false;
+		addFunctions();
+		for (GLProfileEntry& entry : entries) {
+			entry.calls = 0;
+			entry.ticks = 0;
+		}
+		frames = 0;
+		resetClock();
+		active() = this;
+		running = true;
+		gladSetGLCallbacks(preCall, postCall);
+		gladInstallGLDebug();
+		return true;
+	}
+
+	void stop() {
+		if (!running) return;
+		gladUninstallGLDebug();
+		gladSetGLCallbacks(NULL, NULL);
+		active() = nullptr;
+		running = false;
+	}
+
+	bool profiling() const { return running; }
+
+	// Registers a scope by name; the id is for beginScope/endScope, for the profiler's lifetime.
+	unsigned int scope(const char* name) {
+		addFunctions();
+		for (size_t i = 0; i < scopeNames.size(); i++) {
+			if (scopeNames[i] == name) return (unsigned int)(GLAD_GL_FUNCTION_COUNT + i);
+		}
+		scopeNames.push_back(name);
+		entries.push_back(GLProfileEntry());
+		return (unsigned int)entries.size() - 1;
+	}
+	// Scopes don't nest with each other. The GL calls inside one are left out of its time.
+	void beginScope(unsigned int id) {
+		(void)id;
+		scopeCallTicks = callTicks;
+		scopeStart = ticks();
+	}
+	void endScope(unsigned int id) {
+		uint64_t elapsed = ticks() - scopeStart, nested = callTicks - scopeCallTicks;
+		entries[id].ticks += elapsed > nested ? elapsed - nested : 0;
+		entries[id].calls++;
+	}
+
+	void endFrame() { frames++; }
+
+	// Everything since the last collect(), sorted
+	GLProfileStats collect() {
+		GLProfileStats stats;
+		stats.frames = frames;
+		uint64_t now = ticks();
+		auto clock = std::chrono::steady_clock::now();
+		double elapsed = std::chrono::duration<double, std::nano>(clock - clockStart).count();
+		stats.nanosecondsPerTick = now > tickStart ? elapsed / (now - tickStart) : 1.0;
+		for (size_t i = 0; i < entries.size(); i++) {
+			if (entries[i].calls == 0) continue;
+			GLProfileEntry entry = entries[i];
+			if (i >= GLAD_GL_FUNCTION_COUNT) entry.name = scopeNames[i - GLAD_GL_FUNCTION_COUNT].c_str();
+			stats.entries.push_back(entry);
+			entries[i].calls = 0;
+			entries[i].ticks = 0;
+		}
+		std::sort(stats.entries.begin(), stats.entries.end(), [](const GLProfileEntry& a, const GLProfileEntry& b) { return a.ticks > b.ticks; });
+		frames = 0;
+		resetClock();
+		return stats;
+	}
+
+private:
+	static GLProfiler*& active() {
+		static GLProfiler* profiler = nullptr;
+		return profiler;
+	}
+	static void preCall(unsigned int, const GladGLArgument*, const GladGLArgument*) {
+		active()->callStart = ticks();
+	}
+	static void postCall(unsigned int function, const GladGLArgument*, const GladGLArgument*) {
+		GLProfiler* profiler = active();
+		uint64_t elapsed = ticks() - profiler->callStart;
+		GLProfileEntry& entry = profiler->entries[function];
+		entry.ticks += elapsed;
+		entry.calls++;
+		profiler->callTicks += elapsed;
+	}
+
+	static uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+		return __rdtsc();
+#else
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	// The function entries come first, so a function's index is its entry
+	void addFunctions() {
+		if (!entries.empty()) return;
+		entries.resize(GLAD_GL_FUNCTION_COUNT);
+		for (unsigned int i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) entries[i].name = glad_gl_functions[i].name;
+	}
+
+	void resetClock() {
+		tickStart = ticks();
+		clockStart = std::chrono::steady_clock::now();
+	}
+
+	bool running = false;
+	std::vector<GLProfileEntry> entries;  // one per glad function, then the scopes
+	std::vector<std::string> scopeNames;
+	unsigned int frames = 0;
+	uint64_t callStart = 0, scopeStart = 0, tickStart = 0;
+	uint64_t callTicks = 0, scopeCallTicks = 0;  // all GL calls so far; callTicks at beginScope
+	std::chrono::steady_clock::time_point clockStart;
+};
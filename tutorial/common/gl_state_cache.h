@@ -0,0 +1,271 @@
+#pragma once
+// GL state cache
+// Sits on top of the glad function pointers and drops calls that would not change
+// the current GL state (same program, same buffer, same attribute pointer ...).
+// Vertex attribute state is tracked per VAO, exactly like the driver does.
+// The GL_ARRAY_BUFFER binding is applied lazily: it only reaches GL when a call that
+// reads it (a new attribute pointer, bufferData ...) actually needs it.
+#include <glad/gl.h>
+#include <cstddef>
+#include <cstdio>
+#include <unordered_map>
+
+// The kinds of calls the cache can filter.
+enum GLStateCall {
+	GL_STATE_USE_PROGRAM,
+	GL_STATE_BIND_VERTEX_ARRAY,
+	GL_STATE_BIND_BUFFER,
+	GL_STATE_ENABLE_ATTRIB,
+	GL_STATE_DISABLE_ATTRIB,
+	GL_STATE_ATTRIB_POINTER,
+	GL_STATE_ENABLE_CAP,
+	GL_STATE_DISABLE_CAP,
+	GL_STATE_CALL_COUNT
+};
+
+inline const char* glStateCallName(int call) {
+	static const char* names[GL_STATE_CALL_COUNT] = {
+		"glUseProgram",
+		"glBindVertexArray",
+		"glBindBuffer",
+		"glEnableVertexAttribArray",
+		"glDisableVertexAttribArray",
+		"glVertexAttribPointer",
+		"glEnable",
+		"glDisable",
+	};
+	return names[call];
+}
+
+// Issued / skipped call counts, per call kind.
+struct GLStateStats {
+	unsigned int issued[GL_STATE_CALL_COUNT] = {};
+	unsigned int skipped[GL_STATE_CALL_COUNT] = {};
+
+	unsigned int totalIssued() const {
+		unsigned int n = 0;
+		for (int i = 0; i < GL_STATE_CALL_COUNT; i++) n += issued[i];
+		return n;
+	}
+	unsigned int totalSkipped() const {
+		unsigned int n = 0;
+		for (int i = 0; i < GL_STATE_CALL_COUNT; i++) n += skipped[i];
+		return n;
+	}
+
+	void print(const char* label) const {
+		std::printf("%s: %u calls issued, %u redundant calls skipped\n", label, totalIssued(), totalSkipped());
+		for (int i = 0; i < GL_STATE_CALL_COUNT; i++) {
+			if (issued[i] == 0 && skipped[i] == 0) continue;
+			std::printf("  %-28s issued %6u  skipped %6u\n", glStateCallName(i), issued[i], skipped[i]);
+		}
+	}
+};
+
+class GLStateCache {
+public:
+	static const int MAX_ATTRIBS = 16;
+
+	void useProgram(GLuint program) {
+		if (count(GL_STATE_USE_PROGRAM, program == currentProgram)) return;
+		currentProgram = program;
+		glUseProgram(program);
+	}
+
+	void bindVertexArray(GLuint vao) {
+		if (count(GL_STATE_BIND_VERTEX_ARRAY, vao == currentVertexArray)) return;
+		currentVertexArray = vao;
+		glBindVertexArray(vao);
+	}
+
+	void bindBuffer(GLenum target, GLuint buffer) {
+		if (target == GL_ARRAY_BUFFER) {
+			// A pending bind that was never needed is dropped.
+			if (arrayBufferPending) frame.skipped[GL_STATE_BIND_BUFFER]++;
+			arrayBufferPending = buffer != arrayBuffer;
+			pendingArrayBuffer = buffer;
+			if (!arrayBufferPending) frame.skipped[GL_STATE_BIND_BUFFER]++;
+			return;
+		}
+		if (target == GL_ELEMENT_ARRAY_BUFFER) {
+			// The element buffer binding is part of the VAO.
+			GLuint& binding = vertexArray().elementBuffer;
+			if (count(GL_STATE_BIND_BUFFER, binding == buffer)) return;
+			binding = buffer;
+			glBindBuffer(target, buffer);
+			return;
+		}
+		// Targets we don't track are always forwarded.
+		frame.issued[GL_STATE_BIND_BUFFER]++;
+		glBindBuffer(target, buffer);
+	}
+
+	void bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+		if (target == GL_ARRAY_BUFFER) flushArrayBuffer();
+		glBufferData(target, size, data, usage);
+	}
+
+	void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+		if (target == GL_ARRAY_BUFFER) flushArrayBuffer();
+		glBufferSubData(target, offset, size, data);
+	}
+
+	// Makes the GL_ARRAY_BUFFER binding current, for code that calls GL directly.
+	void flushArrayBuffer() {
+		if (!arrayBufferPending) return;
+		arrayBufferPending = false;
+		arrayBuffer = pendingArrayBuffer;
+		frame.issued[GL_STATE_BIND_BUFFER]++;
+		glBindBuffer(GL_ARRAY_BUFFER, arrayBuffer);
+	}
+
+	// Attributes past MAX_ATTRIBS (drivers may expose more than the 16 GL guarantees) aren't
+	// tracked: their calls always go through.
+	void enableVertexAttribArray(GLuint index) {
+		if (index >= MAX_ATTRIBS) {
+			frame.issued[GL_STATE_ENABLE_ATTRIB]++;
+			glEnableVertexAttribArray(index);
+			return;
+		}
+		AttribState& attrib = vertexArray().attribs[index];
+		if (count(GL_STATE_ENABLE_ATTRIB, attrib.enabled)) return;
+		attrib.enabled = true;
+		glEnableVertexAttribArray(index);
+	}
+
+	void disableVertexAttribArray(GLuint index) {
+		if (index >= MAX_ATTRIBS) {
+			frame.issued[GL_STATE_DISABLE_ATTRIB]++;
+			glDisableVertexAttribArray(index);
+			return;
+		}
+		AttribState& attrib = vertexArray().attribs[index];
+		if (count(GL_STATE_DISABLE_ATTRIB, !attrib.enabled)) return;
+		attrib.enabled = false;
+		glDisableVertexAttribArray(index);
+	}
+
+	void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) {
+		if (index >= MAX_ATTRIBS) {
+			frame.issued[GL_STATE_ATTRIB_POINTER]++;
+			flushArrayBuffer();
+			glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+			return;
+		}
+		AttribState& attrib = vertexArray().attribs[index];
+		bool same = attrib.valid &&
+			attrib.buffer == pendingArrayBuffer &&
+			attrib.size == size &&
+			attrib.type == type &&
+			attrib.normalized == normalized &&
+			attrib.stride == stride &&
+			attrib.pointer == pointer;
+		if (count(GL_STATE_ATTRIB_POINTER, same)) return;
+		flushArrayBuffer();
+		attrib.valid = true;
+		attrib.buffer = pendingArrayBuffer;
+		attrib.size = size;
+		attrib.type = type;
+		attrib.normalized = normalized;
+		attrib.stride = stride;
+		attrib.pointer = pointer;
+		glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	}
+
+	void enable(GLenum cap) {
+		bool& enabled = capabilities[cap];
+		if (count(GL_STATE_ENABLE_CAP, enabled)) return;
+		enabled = true;
+		glEnable(cap);
+	}
+
+	void disable(GLenum cap) {
+		// Unknown capabilities are assumed to be enabled, so the first call goes through.
+		auto it = capabilities.find(cap);
+		if (count(GL_STATE_DISABLE_CAP, it != capabilities.end() && !it->second)) return;
+		capabilities[cap] = false;
+		glDisable(cap);
+	}
+
+	// Objects deleted behind our back must be forgotten, since GL may reuse their names.
+	void forgetBuffer(GLuint buffer) {
+		if (arrayBuffer == buffer) arrayBuffer = UNKNOWN;
+		if (pendingArrayBuffer == buffer) {
+			pendingArrayBuffer = 0;
+			arrayBufferPending = arrayBuffer != 0;
+		}
+		for (auto& it : vertexArrays) {
+			if (it.second.elementBuffer == buffer) it.second.elementBuffer = 0;
+			for (AttribState& attrib : it.second.attribs) {
+				if (attrib.buffer == buffer) attrib.valid = false;
+			}
+		}
+	}
+	void forgetVertexArray(GLuint vao) {
+		vertexArrays.erase(vao);
+		if (currentVertexArray == vao) currentVertexArray = 0;
+	}
+	void forgetProgram(GLuint program) {
+		if (currentProgram == program) currentProgram = 0;
+	}
+
+	// Drop everything we know. Use this after code that talks to GL directly.
+	void invalidate() {
+		vertexArrays.clear();
+		capabilities.clear();
+		// Force the next bind to go through, whatever the name.
+		currentProgram = UNKNOWN;
+		currentVertexArray = UNKNOWN;
+		arrayBuffer = UNKNOWN;
+		// Attribute pointers set before the next bindBuffer read whatever GL has bound.
+		pendingArrayBuffer = UNKNOWN;
+		arrayBufferPending = false;
+	}
+
+	// Returns the counts of the frame that just finished and starts a new one.
+	GLStateStats endFrame() {
+		GLStateStats finished = frame;
+		frame = GLStateStats();
+		return finished;
+	}
+	const GLStateStats& frameStats() const { return frame; }
+
+private:
+	static const GLuint UNKNOWN = ~0u;
+
+	struct AttribState {
+		bool enabled = false;
+		bool valid = false;
+		GLuint buffer = 0;
+		GLint size = 0;
+		GLenum type = 0;
+		GLboolean normalized = GL_FALSE;
+		GLsizei stride = 0;
+		const void* pointer = nullptr;
+	};
+	struct VertexArrayState {
+		GLuint elementBuffer = 0;
+		AttribState attribs[MAX_ATTRIBS];
+	};
+
+	// Counts the call and returns true if it can be skipped.
+	bool count(GLStateCall call, bool redundant) {
+		if (redundant) frame.skipped[call]++;
+		else frame.issued[call]++;
+		return redundant;
+	}
+
+	VertexArrayState& vertexArray() {
+		return vertexArrays[currentVertexArray];
+	}
+
+	GLuint currentProgram = UNKNOWN;
+	GLuint currentVertexArray = 0;
+	// A fresh context has nothing bound to GL_ARRAY_BUFFER.
+	GLuint arrayBuffer = 0;
+	GLuint pendingArrayBuffer = 0;
+	bool arrayBufferPending = false;
+	std::unordered_map<GLuint, VertexArrayState> vertexArrays;
+	std::unordered_map<GLenum, bool> capabilities;
+	GLStateStats frame;
+};
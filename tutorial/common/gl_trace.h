@@ -0,0 +1,1099 @@
+#pragma once
+// GL call tracing and replay
+// GLTraceRecorder writes every GL call made through the glad_gl* pointers to a binary trace,
+// using glad's debug layer (gladInstallGLDebug) and the function table in gl_debug.c.
+// Integers are varints, a function's name is written once, and the client memory a call
+// reads (buffer uploads, shader sources, uniform arrays, texture images, arrays of names)
+// goes in as a payload that is stored once per distinct content: payloads are deduplicated
+// by a 64-bit hash, so the same upload every frame costs a few bytes after the first. Writes into mapped
+// buffers are recorded too: the whole range at unmap or flush, and for persistent mappings
+// the bytes that changed since the last draw, copy, fence or frame end.
+// GLTracePlayer loads a trace and re-executes it on the current context through gladGLCall.
+// Object names, uniform locations and sync objects are remapped to the ones the replay
+// created; framebuffer 0 and framebuffers the trace never created become the player's target.
+//
+// Limits: calls from one thread; client memory the rules above don't cover (vertex arrays
+// outside buffers, debug callbacks, object pointer labels ...) replays as NULL and outputs as
+// scratch memory; GL_UNPACK_SKIP_* is ignored; program binaries only replay on the driver
+// that produced them.
+//
+// File layout, after "GLTR", a version byte and the viewport size (varints):
+//	'F' id name signature      first use of function id (strings as varint length + bytes)
+//	'C' id time args [result]  call; time in ns since the previous 'C' or 'E'
+//	'D' size bytes             payload, referred to by its index among the 'D' records
+//	'W' buffer offset payload  bytes written into a mapped buffer
+//	'E' time                   end of frame
+// Arguments follow the function's signature: integers as (zigzag) varints, floats and doubles
+// raw, pointers as a tag byte (TRACE_NULL ...) and, for values and payloads, a varint.
+#include <glad/gl.h>
+#include <glad/gl_debug.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+const int GL_TRACE_MAX_ARGUMENTS = 16;
+const unsigned char GL_TRACE_VERSION = 1;
+
+enum GLTracePointer : unsigned char {
+	TRACE_NULL,
+	TRACE_VALUE,       // an offset, handle or address, replayed as is
+	TRACE_PAYLOAD,     // the memory it points to was captured
+	TRACE_UNCAPTURED,  // client memory that was not captured
+};
+
+// How much client memory a pointer parameter reads (or, for arrays of names, writes)
+enum GLTraceSize : unsigned char {
+	TRACE_SIZE_NONE,
+	TRACE_SIZE_STRING,    // NUL terminated
+	TRACE_SIZE_STRINGS,   // arg[param] strings; lengths in arg[extra] if extra >= 0
+	TRACE_SIZE_LENGTHS,   // the lengths of the strings: folded into them, recorded as NULL
+	TRACE_SIZE_ELEMENTS,  // elements * elementSize bytes, times arg[param] if param >= 0
+	TRACE_SIZE_BYTES,     // arg[param] bytes
+	TRACE_SIZE_PIXELS,    // width x height x depth of format and type, as unpacked
+};
+
+// Calls that the recorder and player follow to track buffers, mappings and programs
+enum GLTraceSpecial : unsigned char {
+	TRACE_PLAIN,
+	TRACE_BIND_BUFFER,
+	TRACE_BIND_BUFFER_INDEXED,
+	TRACE_BUFFER_STORAGE,
+	TRACE_NAMED_BUFFER_STORAGE,
+	TRACE_MAP,
+	TRACE_MAP_RANGE,
+	TRACE_MAP_NAMED,
+	TRACE_MAP_NAMED_RANGE,
+	TRACE_FLUSH,
+	TRACE_FLUSH_NAMED,
+	TRACE_UNMAP,
+	TRACE_UNMAP_NAMED,
+	TRACE_DELETE_BUFFERS,
+	TRACE_PIXEL_STORE,
+	TRACE_USE_PROGRAM,
+	TRACE_GET_ERROR,
+};
+
+struct GLTraceParameter {
+	char type = 'v', role = '-';  // see GladGLFunction
+	GLTraceSize size = TRACE_SIZE_NONE;
+	int param = -1, extra = -1;
+	uint32_t elements = 0, elementSize = 0;
+};
+
+// A glad_gl_functions entry with its signature decoded and the capture rules applied
+struct GLTraceFunction {
+	const char* name = nullptr;
+	const char* signature = nullptr;
+	GLTraceParameter result;
+	GLTraceParameter parameters[GL_TRACE_MAX_ARGUMENTS];
+	int count = 0;
+	int width = -1, height = -1, depth = -1, format = -1, type = -1;  // pixel parameters
+	int program = -1;          // parameter naming the program a location belongs to
+	bool readsMappings = false;  // may read buffers: persistent mappings are synced first
+	GLTraceSpecial special = TRACE_PLAIN;
+};
+
+inline bool isGLTraceArray(char type) {
+	return type == '1' || type == '2' || type == '4' || type == '8' || type == 'P';
+}
+
+// Components per element of a vector or matrix entry point: glUniform3fv 3,
+// glUniformMatrix4x3fv 12, glVertexAttrib4Nubv 4; 0 if the name has none.
+inline uint32_t glVectorComponents(const std::string& name) {
+	size_t matrix = name.find("Matrix");
+	if (matrix != std::string::npos && std::isdigit((unsigned char)name[matrix + 6])) {
+		uint32_t rows = name[matrix + 6] - '0';
+		return name[matrix + 7] == 'x' ? rows * (name[matrix + 8] - '0') : rows * rows;
+	}
+	if (name.find("DepthRange") != std::string::npos) return 2;
+	if (name.find("Array") != std::string::npos && (name.find("Viewport") != std::string::npos || name.find("Scissor") != std::string::npos)) return 4;
+	if (name.empty() || name.back() != 'v') return 0;
+	size_t i = name.size() - 1;
+	while (i > 0 && std::islower((unsigned char)name[i - 1])) i--;
+	if (i > 0 && name[i - 1] == 'N') i--;
+	if (i == 0 || !std::isdigit((unsigned char)name[i - 1])) return 0;
+	// packed attributes (glVertexAttribP4uiv) are a single value
+	return i > 1 && name[i - 2] == 'P' ? 1 : name[i - 1] - '0';
+}
+
+inline GLTraceFunction describeGLFunction(unsigned int index) {
+	const GladGLFunction& entry = glad_gl_functions[index];
+	GLTraceFunction function;
+	function.name = entry.name;
+	function.signature = entry.signature;
+	function.result.type = entry.signature[0];
+	function.result.role = entry.signature[1];
+	function.count = (int)std::strlen(entry.signature) / 2 - 1;
+
+	std::vector<std::string> names;
+	for (const char* p = entry.parameters; *p;) {
+		const char* end = std::strchr(p, ',');
+		names.push_back(end ? std::string(p, end) : std::string(p));
+		p = end ? end + 1 : p + names.back().size();
+	}
+	auto find = [&](const char* parameter) {
+		for (size_t j = 0; j < names.size(); j++) {
+			if (names[j] == parameter) return (int)j;
+		}
+		return -1;
+	};
+	const std::string name = entry.name;
+	for (int j = 0; j < function.count; j++) {
+		function.parameters[j].type = entry.signature[2 + 2 * j];
+		function.parameters[j].role = entry.signature[3 + 2 * j];
+		if (function.program < 0 && function.parameters[j].role == 'P') function.program = j;
+	}
+	// The scalar that counts the elements of an array parameter
+	int counter = -1;
+	for (const char* parameter : {"n", "count", "drawcount", "numAttachments", "numSpecializationConstants"}) {
+		int j = find(parameter);
+		if (j >= 0 && (function.parameters[j].type == 'i' || function.parameters[j].type == 'u')) {
+			counter = j;
+			break;
+		}
+	}
+	function.width = find("width");
+	function.height = find("height");
+	function.depth = find("depth");
+	function.format = find("format");
+	function.type = find("type");
+
+	for (int j = 0; j < function.count; j++) {
+		GLTraceParameter& parameter = function.parameters[j];
+		const std::string& parameterName = names[j];
+		if (parameter.type == 's') {
+			parameter.size = TRACE_SIZE_STRING;
+		} else if (parameter.type == 'S') {
+			parameter.size = TRACE_SIZE_STRINGS;
+			parameter.param = counter;
+			if (j + 1 < function.count && names[j + 1] == "length" && function.parameters[j + 1].type == '4') {
+				parameter.extra = j + 1;
+				function.parameters[j + 1].size = TRACE_SIZE_LENGTHS;
+			}
+		} else if (isGLTraceArray(parameter.type) && parameter.size == TRACE_SIZE_NONE) {
+			uint32_t components = glVectorComponents(name);
+			parameter.size = TRACE_SIZE_ELEMENTS;
+			parameter.elementSize = parameter.type == 'P' ? (uint32_t)sizeof(void*) : (uint32_t)(parameter.type - '0');
+			parameter.param = counter;
+			// parameter vectors without a count (glTexParameterfv, glClearBufferfv ...) take at most 4
+			parameter.elements = components ? components : counter >= 0 ? 1 : 4;
+		} else if (parameter.type == 'o' && std::islower((unsigned char)parameter.role) && counter >= 0) {
+			// glGen*: the names written are captured after the call
+			parameter.size = TRACE_SIZE_ELEMENTS;
+			parameter.elementSize = sizeof(GLuint);
+			parameter.param = counter;
+			parameter.elements = 1;
+		} else if (parameter.type == 'p' && parameter.role != 'Y') {
+			if (name.compare(0, 7, "glClear") == 0 && parameterName == "data") {
+				parameter.size = TRACE_SIZE_PIXELS;  // one texel of format and type
+			} else if (parameterName == "data" && find("size") >= 0) {
+				parameter.size = TRACE_SIZE_BYTES;
+				parameter.param = find("size");
+			} else if (parameterName == "binary" && find("length") >= 0) {
+				parameter.size = TRACE_SIZE_BYTES;
+				parameter.param = find("length");
+			} else if (parameter.role == 'O' && find("imageSize") >= 0) {
+				parameter.size = TRACE_SIZE_BYTES;
+				parameter.param = find("imageSize");
+			} else if (parameter.role == 'O' && parameterName == "pixels") {
+				parameter.size = TRACE_SIZE_PIXELS;
+			}
+		}
+	}
+	// glClear*Data and glClearTex*Image take a single texel
+	if (name.compare(0, 7, "glClear") == 0) function.width = function.height = function.depth = -1;
+
+	function.readsMappings = name.find("Draw") != std::string::npos || name.find("Dispatch") != std::string::npos ||
+		name.find("Copy") != std::string::npos || name == "glFenceSync" || name == "glFinish" || name == "glFlush";
+	static const std::unordered_map<std::string, GLTraceSpecial> specials = {
+		{"glBindBuffer", TRACE_BIND_BUFFER},
+		{"glBindBufferBase", TRACE_BIND_BUFFER_INDEXED},
+		{"glBindBufferRange", TRACE_BIND_BUFFER_INDEXED},
+		{"glBufferData", TRACE_BUFFER_STORAGE},
+		{"glBufferStorage", TRACE_BUFFER_STORAGE},
+		{"glNamedBufferData", TRACE_NAMED_BUFFER_STORAGE},
+		{"glNamedBufferStorage", TRACE_NAMED_BUFFER_STORAGE},
+		{"glMapBuffer", TRACE_MAP},
+		{"glMapBufferRange", TRACE_MAP_RANGE},
+		{"glMapNamedBuffer", TRACE_MAP_NAMED},
+		{"glMapNamedBufferRange", TRACE_MAP_NAMED_RANGE},
+		{"glFlushMappedBufferRange", TRACE_FLUSH},
+		{"glFlushMappedNamedBufferRange", TRACE_FLUSH_NAMED},
+		{"glUnmapBuffer", TRACE_UNMAP},
+		{"glUnmapNamedBuffer", TRACE_UNMAP_NAMED},
+		{"glDeleteBuffers", TRACE_DELETE_BUFFERS},
+		{"glPixelStorei", TRACE_PIXEL_STORE},
+		{"glUseProgram", TRACE_USE_PROGRAM},
+		{"glGetError", TRACE_GET_ERROR},
+	};
+	auto special = specials.find(name);
+	if (special != specials.end()) function.special = special->second;
+	return function;
+}
+
+// Bytes per pixel of a format and type, as glTexImage2D and glReadPixels take them
+inline size_t glPixelSize(GLenum format, GLenum type) {
+	switch (type) {
+	case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+		return 1;
+	case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV: case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+		return 2;
+	case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+		return 4;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+		return 8;
+	}
+	size_t component = type == GL_UNSIGNED_BYTE || type == GL_BYTE ? 1 :
+		type == GL_UNSIGNED_SHORT || type == GL_SHORT || type == GL_HALF_FLOAT ? 2 : 4;
+	switch (format) {
+	case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+		return 2 * component;
+	case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+		return 3 * component;
+	case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+		return 4 * component;
+	}
+	return component;
+}
+
+inline uint64_t hashGLTracePayload(const void* data, size_t size) {
+	const unsigned char* bytes = (const unsigned char*)data;
+	uint64_t hash = 0x9e3779b97f4a7c15ull ^ size;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, bytes + i, 8);
+		hash = (hash ^ word) * 0xff51afd7ed558ccdull;
+		hash ^= hash >> 32;
+	}
+	uint64_t tail = 0;
+	std::memcpy(&tail, bytes + i, size - i);
+	hash = (hash ^ tail) * 0xc4ceb9fe1a85ec53ull;
+	return hash ^ (hash >> 29);
+}
+
+struct GLTraceStats {
+	unsigned int calls = 0;
+	unsigned int frames = 0;
+	unsigned int payloads = 0;
+	size_t payloadBytes = 0;     // stored in the trace
+	size_t deduplicatedBytes = 0;  // referred to again instead of being stored
+	unsigned int mappedWrites = 0;
+	unsigned int uncaptured = 0;   // pointers to client memory that was not captured
+	size_t fileBytes = 0;
+
+	void print(const char* label) const {
+		std::printf("%s: %u calls, %u frames, %u payloads (%zu bytes, %zu deduplicated), %u mapped writes, "
+			"%u uncaptured pointers, %zu bytes written\n", label, calls, frames, payloads, payloadBytes,
+			deduplicatedBytes, mappedWrites, uncaptured, fileBytes);
+	}
+};
+
+class GLTraceRecorder {
+public:
+	GLTraceRecorder() = default;
+	GLTraceRecorder(const GLTraceRecorder&) = delete;
+	GLTraceRecorder& operator=(const GLTraceRecorder&) = delete;
+	~GLTraceRecorder() { close(); }
+
+	// Starts recording the GL calls of the loaded context into path. width and height are the
+	// size the replay should render at. Only one recorder can record at a time.
+	bool open(const char* path, int width, int height) {
+		if (file || active()) return false;
+		file = std::fopen(path, "wb");
+		if (!file) {
+			std::printf("Can't write GL trace %s\n", path);
+			return false;
+		}
+		functions.resize(GLAD_GL_FUNCTION_COUNT);
+		defined.assign(GLAD_GL_FUNCTION_COUNT, false);
+		for (unsigned int i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) functions[i] = describeGLFunction(i);
+		stats = GLTraceStats();
+		output.assign({'G', 'L', 'T', 'R', GL_TRACE_VERSION});
+		writeVarint(output, (uint64_t)width);
+		writeVarint(output, (uint64_t)height);
+		lastTime = now();
+		active() = this;
+		gladSetGLCallbacks(preCall, postCall);
+		gladInstallGLDebug();
+		return true;
+	}
+
+	// Marks the end of a frame, e.g. right after the swap.
+	void endFrame() {
+		if (!file) return;
+		syncMappings();
+		uint64_t time = now();
+		output.push_back('E');
+		writeVarint(output, time - lastTime);
+		lastTime = time;
+		stats.frames++;
+		flush();
+	}
+
+	// Stops recording and writes out the rest of the trace.
+	void close() {
+		if (!file) return;
+		gladUninstallGLDebug();
+		gladSetGLCallbacks(NULL, NULL);
+		active() = nullptr;
+		flush();
+		std::fclose(file);
+		file = nullptr;
+		hashes.clear();
+		bindings.clear();
+		bufferSizes.clear();
+		mappings.clear();
+	}
+
+	bool recording() const { return file != nullptr; }
+	const GLTraceStats& statistics() const { return stats; }
+
+private:
+	struct Mapping {
+		unsigned char* pointer = nullptr;
+		size_t offset = 0, length = 0;
+		bool persistent = false, explicitFlush = false;
+		std::vector<unsigned char> shadow;  // persistent: the contents as last recorded
+	};
+
+	static GLTraceRecorder*& active() {
+		static GLTraceRecorder* recorder = nullptr;
+		return recorder;
+	}
+	static void preCall(unsigned int function, const GladGLArgument* args, const GladGLArgument*) {
+		active()->before(function, args);
+	}
+	static void postCall(unsigned int function, const GladGLArgument* args, const GladGLArgument* result) {
+		active()->after(function, args, result);
+	}
+
+	static uint64_t now() {
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+	static void writeVarint(std::vector<unsigned char>& out, uint64_t value) {
+		while (value >= 0x80) {
+			out.push_back((unsigned char)(value | 0x80));
+			value >>= 7;
+		}
+		out.push_back((unsigned char)value);
+	}
+	static void writeString(std::vector<unsigned char>& out, const char* text) {
+		size_t length = std::strlen(text);
+		writeVarint(out, length);
+		out.insert(out.end(), text, text + length);
+	}
+
+	void flush() {
+		if (output.empty()) return;
+		std::fwrite(output.data(), 1, output.size(), file);
+		stats.fileBytes += output.size();
+		output.clear();
+	}
+
+	// Stores data as a payload unless the same bytes were stored before; returns its index
+	uint32_t payload(const void* data, size_t size) {
+		uint64_t hash = hashGLTracePayload(data, size);
+		auto found = hashes.find(hash);
+		if (found != hashes.end()) {
+			stats.deduplicatedBytes += size;
+			return found->second;
+		}
+		uint32_t index = stats.payloads++;
+		hashes.emplace(hash, index);
+		output.push_back('D');
+		writeVarint(output, size);
+		output.insert(output.end(), (const unsigned char*)data, (const unsigned char*)data + size);
+		stats.payloadBytes += size;
+		return index;
+	}
+
+	GLuint boundBuffer(GLenum target) const {
+		auto found = bindings.find(target);
+		return found != bindings.end() ? found->second : 0;
+	}
+
+	void writeMapped(GLuint buffer, const Mapping& mapping, size_t from, size_t to) {
+		if (to <= from) return;
+		uint32_t index = payload(mapping.pointer + from, to - from);
+		output.push_back('W');
+		writeVarint(output, buffer);
+		writeVarint(output, mapping.offset + from);
+		writeVarint(output, index);
+		stats.mappedWrites++;
+	}
+
+	// Records the bytes of a persistent mapping that changed since it was last recorded
+	void syncMapping(GLuint buffer, Mapping& mapping) {
+		const size_t block = 256;
+		size_t runStart = 0;
+		bool inRun = false;
+		for (size_t offset = 0; offset < mapping.length; offset += block) {
+			size_t size = std::min(block, mapping.length - offset);
+			bool changed = std::memcmp(mapping.pointer + offset, mapping.shadow.data() + offset, size) != 0;
+			if (changed && !inRun) runStart = offset;
+			if (!changed && inRun) writeMapped(buffer, mapping, runStart, offset);
+			inRun = changed;
+		}
+		if (inRun) writeMapped(buffer, mapping, runStart, mapping.length);
+		std::memcpy(mapping.shadow.data(), mapping.pointer, mapping.length);
+	}
+
+	void syncMappings() {
+		for (auto& entry : mappings) {
+			if (entry.second.persistent) syncMapping(entry.first, entry.second);
+		}
+	}
+
+	void unmap(GLuint buffer) {
+		auto found = mappings.find(buffer);
+		if (found == mappings.end()) return;
+		Mapping& mapping = found->second;
+		if (mapping.persistent) syncMapping(buffer, mapping);
+		else if (!mapping.explicitFlush) writeMapped(buffer, mapping, 0, mapping.length);
+		mappings.erase(found);
+	}
+
+	void flushMapped(GLuint buffer, size_t offset, size_t length) {
+		auto found = mappings.find(buffer);
+		if (found == mappings.end()) return;
+		Mapping& mapping = found->second;
+		size_t end = std::min(mapping.length, offset + length);
+		writeMapped(buffer, mapping, offset, end);
+		if (mapping.persistent && offset < end) std::memcpy(mapping.shadow.data() + offset, mapping.pointer + offset, end - offset);
+	}
+
+	void map(GLuint buffer, const void* pointer, size_t offset, size_t length, GLbitfield access) {
+		if (!pointer || !(access & GL_MAP_WRITE_BIT)) return;
+		Mapping& mapping = mappings[buffer];
+		mapping.pointer = (unsigned char*)pointer;
+		mapping.offset = offset;
+		mapping.length = length;
+		mapping.persistent = (access & GL_MAP_PERSISTENT_BIT) != 0;
+		mapping.explicitFlush = (access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0;
+		if (mapping.persistent) mapping.shadow.assign(mapping.pointer, mapping.pointer + length);
+	}
+
+	size_t pixelBytes(const GLTraceFunction& function, const GladGLArgument* args) const {
+		if (function.format < 0 || function.type < 0) return 0;
+		auto extent = [&](int j) { return j >= 0 ? (size_t)std::max<GLint64>(args[j].i, 0) : (size_t)1; };
+		size_t width = extent(function.width), height = extent(function.height), depth = extent(function.depth);
+		if (width == 0 || height == 0 || depth == 0) return 0;
+		size_t pixel = glPixelSize((GLenum)args[function.format].u, (GLenum)args[function.type].u);
+		size_t row = (unpackRowLength ? unpackRowLength : width) * pixel;
+		row = (row + unpackAlignment - 1) / unpackAlignment * unpackAlignment;
+		size_t imageHeight = unpackImageHeight ? unpackImageHeight : height;
+		return row * imageHeight * (depth - 1) + row * (height - 1) + width * pixel;
+	}
+
+	// Size of the client memory parameter j reads or writes; SIZE_MAX if it's not captured
+	size_t captureBytes(const GLTraceFunction& function, int j, const GladGLArgument* args) const {
+		const GLTraceParameter& parameter = function.parameters[j];
+		auto count = [&](int k) { return k >= 0 ? (size_t)std::max<GLint64>(args[k].i, 0) : (size_t)1; };
+		switch (parameter.size) {
+		case TRACE_SIZE_STRING: return std::strlen((const char*)args[j].p) + 1;
+		case TRACE_SIZE_ELEMENTS: return count(parameter.param) * parameter.elements * parameter.elementSize;
+		case TRACE_SIZE_BYTES: return count(parameter.param);
+		case TRACE_SIZE_PIXELS: return pixelBytes(function, args);
+		default: return SIZE_MAX;
+		}
+	}
+
+	void writeStrings(const GLTraceFunction& function, int j, const GladGLArgument* args) {
+		const GLTraceParameter& parameter = function.parameters[j];
+		const char* const* strings = (const char* const*)args[j].p;
+		const GLint* lengths = parameter.extra >= 0 ? (const GLint*)args[parameter.extra].p : nullptr;
+		GLint64 count = parameter.param >= 0 ? args[parameter.param].i : 1;
+		joined.clear();
+		for (GLint64 k = 0; k < count; k++) {
+			size_t length = lengths && lengths[k] >= 0 ? (size_t)lengths[k] : std::strlen(strings[k]);
+			joined.insert(joined.end(), strings[k], strings[k] + length);
+			joined.push_back('\0');
+		}
+		call.push_back(TRACE_PAYLOAD);
+		writeVarint(call, payload(joined.data(), joined.size()));
+	}
+
+	void writePointer(const GLTraceFunction& function, int j, const GladGLArgument* args) {
+		const GLTraceParameter& parameter = function.parameters[j];
+		const void* pointer = args[j].p;
+		if (!pointer || parameter.size == TRACE_SIZE_LENGTHS) {
+			call.push_back(TRACE_NULL);
+			return;
+		}
+		if (parameter.type == 'S') {
+			writeStrings(function, j, args);
+			return;
+		}
+		// Pixels go through a pixel buffer when one is bound; pointer, indices and indirect always
+		// are offsets into their buffers (core profiles have no client arrays).
+		bool offset = parameter.role == 'Y';
+		if (parameter.role == 'O') {
+			GLenum target = parameter.type == 'o' ? GL_PIXEL_PACK_BUFFER : GL_PIXEL_UNPACK_BUFFER;
+			offset = parameter.size == TRACE_SIZE_NONE ? parameter.type != 'o' || boundBuffer(target) : boundBuffer(target) != 0;
+		}
+		size_t bytes = offset ? SIZE_MAX : captureBytes(function, j, args);
+		if (offset) {
+			call.push_back(TRACE_VALUE);
+			writeVarint(call, (uint64_t)(uintptr_t)pointer);
+		} else if (bytes != SIZE_MAX) {
+			call.push_back(TRACE_PAYLOAD);
+			writeVarint(call, payload(pointer, bytes));
+		} else {
+			call.push_back(TRACE_UNCAPTURED);
+			stats.uncaptured += parameter.type != 'o';
+		}
+	}
+
+	void writeArgument(const GLTraceFunction& function, const GLTraceParameter& parameter, int j, const GladGLArgument& argument,
+		const GladGLArgument* args) {
+		switch (parameter.type) {
+		case 'i':
+			writeVarint(call, ((uint64_t)argument.i << 1) ^ (uint64_t)(argument.i >> 63));
+			break;
+		case 'u':
+			writeVarint(call, argument.u);
+			break;
+		case 'f':
+			call.insert(call.end(), (const unsigned char*)&argument.f, (const unsigned char*)&argument.f + 4);
+			break;
+		case 'd':
+			call.insert(call.end(), (const unsigned char*)&argument.d, (const unsigned char*)&argument.d + 8);
+			break;
+		default:
+			if (j >= 0) {
+				writePointer(function, j, args);
+			} else {
+				call.push_back(argument.p ? TRACE_VALUE : TRACE_NULL);
+				if (argument.p) writeVarint(call, (uint64_t)(uintptr_t)argument.p);
+			}
+		}
+	}
+
+	void before(unsigned int function, const GladGLArgument* args) {
+		callStart = now();
+		const GLTraceFunction& description = functions[function];
+		if (description.readsMappings) syncMappings();
+		switch (description.special) {
+		case TRACE_FLUSH:
+			flushMapped(boundBuffer((GLenum)args[0].u), (size_t)args[1].i, (size_t)args[2].i);
+			break;
+		case TRACE_FLUSH_NAMED:
+			flushMapped((GLuint)args[0].u, (size_t)args[1].i, (size_t)args[2].i);
+			break;
+		case TRACE_UNMAP:
+			unmap(boundBuffer((GLenum)args[0].u));
+			break;
+		case TRACE_UNMAP_NAMED:
+			unmap((GLuint)args[0].u);
+			break;
+		case TRACE_DELETE_BUFFERS:
+			for (GLint64 k = 0; k < args[0].i; k++) mappings.erase(((const GLuint*)args[1].p)[k]);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void after(unsigned int function, const GladGLArgument* args, const GladGLArgument* result) {
+		const GLTraceFunction& description = functions[function];
+		if (!defined[function]) {
+			defined[function] = true;
+			output.push_back('F');
+			writeVarint(output, function);
+			writeString(output, description.name);
+			writeString(output, description.signature);
+		}
+		// Payloads go to the output as they are met, so the call is assembled on the side
+		call.clear();
+		writeVarint(call, function);
+		writeVarint(call, callStart - lastTime);
+		lastTime = callStart;
+		for (int j = 0; j < description.count; j++) writeArgument(description, description.parameters[j], j, args[j], args);
+		if (result) writeArgument(description, description.result, -1, *result, args);
+		output.push_back('C');
+		output.insert(output.end(), call.begin(), call.end());
+		stats.calls++;
+
+		switch (description.special) {
+		case TRACE_BIND_BUFFER:
+			bindings[(GLenum)args[0].u] = (GLuint)args[1].u;
+			break;
+		case TRACE_BIND_BUFFER_INDEXED:
+			bindings[(GLenum)args[0].u] = (GLuint)args[2].u;
+			break;
+		case TRACE_BUFFER_STORAGE:
+			bufferSizes[boundBuffer((GLenum)args[0].u)] = (size_t)args[1].i;
+			break;
+		case TRACE_NAMED_BUFFER_STORAGE:
+			bufferSizes[(GLuint)args[0].u] = (size_t)args[1].i;
+			break;
+		case TRACE_MAP:
+		case TRACE_MAP_NAMED: {
+			GLuint buffer = description.special == TRACE_MAP ? boundBuffer((GLenum)args[0].u) : (GLuint)args[0].u;
+			map(buffer, result->p, 0, bufferSizes[buffer], args[1].u != GL_READ_ONLY ? GL_MAP_WRITE_BIT : 0);
+			break;
+		}
+		case TRACE_MAP_RANGE:
+		case TRACE_MAP_NAMED_RANGE: {
+			GLuint buffer = description.special == TRACE_MAP_RANGE ? boundBuffer((GLenum)args[0].u) : (GLuint)args[0].u;
+			map(buffer, result->p, (size_t)args[1].i, (size_t)args[2].i, (GLbitfield)args[3].u);
+			break;
+		}
+		case TRACE_PIXEL_STORE:
+			if (args[0].u == GL_UNPACK_ALIGNMENT && args[1].i > 0) unpackAlignment = (size_t)args[1].i;
+			if (args[0].u == GL_UNPACK_ROW_LENGTH) unpackRowLength = (size_t)std::max<GLint64>(args[1].i, 0);
+			if (args[0].u == GL_UNPACK_IMAGE_HEIGHT) unpackImageHeight = (size_t)std::max<GLint64>(args[1].i, 0);
+			break;
+		default:
+			break;
+		}
+	}
+
+	FILE* file = nullptr;
+	std::vector<GLTraceFunction> functions;
+	std::vector<bool> defined;
+	std::vector<unsigned char> output, call, joined;
+	std::unordered_map<uint64_t, uint32_t> hashes;
+	std::unordered_map<GLenum, GLuint> bindings;
+	std::unordered_map<GLuint, size_t> bufferSizes;
+	std::unordered_map<GLuint, Mapping> mappings;
+	size_t unpackAlignment = 4, unpackRowLength = 0, unpackImageHeight = 0;
+	uint64_t lastTime = 0, callStart = 0;
+	GLTraceStats stats;
+};
+
+struct GLTraceReplayStats {
+	unsigned int calls = 0;
+	unsigned int skipped = 0;         // not loaded in this context
+	unsigned int errorMismatches = 0; // glGetError returned something else than when recorded
+	unsigned int missedWrites = 0;    // writes into a buffer that isn't mapped in the replay, or past its mapping
+
+	void print(const char* label) const {
+		std::printf("%s: %u calls, %u skipped, %u glGetError mismatches, %u missed mapped writes\n",
+			label, calls, skipped, errorMismatches, missedWrites);
+	}
+};
+
+class GLTracePlayer {
+public:
+	// Reads a whole trace. framebuffer stands in for the recording's default framebuffer.
+	bool load(const char* path, GLuint framebuffer = 0) {
+		FILE* file = std::fopen(path, "rb");
+		if (!file) {
+			std::printf("Can't read GL trace %s\n", path);
+			return false;
+		}
+		std::vector<unsigned char> data;
+		unsigned char chunk[1 << 16];
+		for (size_t read; (read = std::fread(chunk, 1, sizeof(chunk), file)) > 0;) data.insert(data.end(), chunk, chunk + read);
+		std::fclose(file);
+		this->framebuffer = framebuffer;
+		if (!parse(data)) {
+			std::printf("%s is not a GL trace or is truncated\n", path);
+			return false;
+		}
+		return true;
+	}
+
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	size_t frameCount() const { return frames.size(); }
+	size_t frameCalls(size_t frame) const { return frames[frame].end - frames[frame].begin; }
+	// Time from the end of the previous frame to the end of this one, as recorded
+	double recordedMilliseconds(size_t frame) const { return frames[frame].nanoseconds * 1e-6; }
+	const GLTraceReplayStats& statistics() const { return stats; }
+
+	// Everything up to the end of the first recorded frame: creating objects, uploads,
+	// compiling, and that frame's draws. frameCount() and replayFrame() cover the frames after it.
+	void replaySetup() { execute(0, setupEnd); }
+	void replayFrame(size_t frame) { execute(frames[frame].begin, frames[frame].end); }
+
+private:
+	static const uint32_t WRITE = 0xffffffffu;
+	static const uint32_t UNKNOWN = 0xfffffffeu;
+
+	struct Value {
+		unsigned char tag = TRACE_VALUE;
+		uint64_t bits = 0;
+	};
+	struct Record {
+		uint32_t function;  // index into glad_gl_functions, or WRITE
+		uint32_t firstValue;
+	};
+	struct Frame {
+		size_t begin, end;
+		uint64_t nanoseconds;
+	};
+	struct Mapping {
+		unsigned char* pointer;
+		size_t offset;
+		size_t length;
+	};
+
+	struct Reader {
+		const unsigned char* p;
+		const unsigned char* end;
+		bool ok = true;
+
+		uint64_t varint() {
+			uint64_t value = 0;
+			for (int shift = 0; shift < 64; shift += 7) {
+				if (p >= end) break;
+				unsigned char byte = *p++;
+				value |= (uint64_t)(byte & 0x7f) << shift;
+				if (!(byte & 0x80)) return value;
+			}
+			ok = false;
+			return 0;
+		}
+		uint64_t raw(size_t size) {
+			uint64_t value = 0;
+			if ((size_t)(end - p) < size) {
+				ok = false;
+				return 0;
+			}
+			std::memcpy(&value, p, size);
+			p += size;
+			return value;
+		}
+		std::string string() {
+			size_t length = (size_t)varint();
+			if (!ok || (size_t)(end - p) < length) {
+				ok = false;
+				return std::string();
+			}
+			std::string text((const char*)p, length);
+			p += length;
+			return text;
+		}
+	};
+
+	Value readValue(Reader& reader, char type) {
+		Value value;
+		switch (type) {
+		case 'i': case 'u':
+			value.bits = reader.varint();
+			if (type == 'i') value.bits = (value.bits >> 1) ^ (0 - (value.bits & 1));
+			break;
+		case 'f':
+			value.bits = reader.raw(4);
+			break;
+		case 'd':
+			value.bits = reader.raw(8);
+			break;
+		default:
+			value.tag = (unsigned char)reader.raw(1);
+			if (value.tag == TRACE_VALUE || value.tag == TRACE_PAYLOAD) value.bits = reader.varint();
+			if (value.tag == TRACE_PAYLOAD && value.bits >= payloads.size()) reader.ok = false;
+		}
+		return value;
+	}
+
+	bool parse(const std::vector<unsigned char>& data) {
+		Reader reader = {data.data(), data.data() + data.size()};
+		if (data.size() < 5 || std::memcmp(data.data(), "GLTR", 4) != 0 || data[4] != GL_TRACE_VERSION) return false;
+		reader.p += 5;
+		width = (int)reader.varint();
+		height = (int)reader.varint();
+
+		std::unordered_map<std::string, unsigned int> byName;
+		for (unsigned int i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) byName[glad_gl_functions[i].name] = i;
+		functions.resize(GLAD_GL_FUNCTION_COUNT);
+		for (unsigned int i = 0; i < GLAD_GL_FUNCTION_COUNT; i++) functions[i] = describeGLFunction(i);
+		std::unordered_map<uint64_t, std::pair<uint32_t, std::string>> traced;  // id -> function here, signature there
+
+		uint64_t time = 0, frameStart = 0;
+		size_t frameBegin = 0;
+		while (reader.ok && reader.p < reader.end) {
+			unsigned char tag = *reader.p++;
+			if (tag == 'F') {
+				uint64_t id = reader.varint();
+				std::string name = reader.string();
+				std::string signature = reader.string();
+				auto found = byName.find(name);
+				uint32_t function = found != byName.end() && signature == glad_gl_functions[found->second].signature ? found->second : UNKNOWN;
+				traced[id] = {function, signature};
+			} else if (tag == 'C') {
+				auto found = traced.find(reader.varint());
+				if (found == traced.end()) return false;
+				time += reader.varint();
+				const std::string& signature = found->second.second;
+				Record record = {found->second.first, (uint32_t)values.size()};
+				for (size_t k = 2; k + 1 < signature.size(); k += 2) {
+					values.push_back(readValue(reader, signature[k]));
+					// Replay walks string lists with strlen: the last one must end inside the payload
+					const Value& value = values.back();
+					if (signature[k] == 'S' && value.tag == TRACE_PAYLOAD && reader.ok && payloadSize(value.bits) > 0
+						&& payloadData(value.bits)[payloadSize(value.bits) - 1] != 0) return false;
+				}
+				if (signature[0] != 'v') values.push_back(readValue(reader, signature[0]));
+				// Functions this glad doesn't know (or knows differently) are dropped
+				if (record.function != UNKNOWN) {
+					records.push_back(record);
+				} else {
+					values.resize(record.firstValue);
+					stats.skipped++;
+				}
+			} else if (tag == 'D') {
+				size_t size = (size_t)reader.varint();
+				if (!reader.ok || (size_t)(reader.end - reader.p) < size) return false;
+				payloads.push_back({blob.size(), size});
+				blob.insert(blob.end(), reader.p, reader.p + size);
+				reader.p += size;
+			} else if (tag == 'W') {
+				Record record = {WRITE, (uint32_t)values.size()};
+				for (int k = 0; k < 3; k++) values.push_back({TRACE_VALUE, reader.varint()});
+				if (values.back().bits >= payloads.size()) return false;
+				records.push_back(record);
+			} else if (tag == 'E') {
+				time += reader.varint();
+				if (setupEnd == SIZE_MAX) setupEnd = records.size();
+				else frames.push_back({frameBegin, records.size(), time - frameStart});
+				frameBegin = records.size();
+				frameStart = time;
+			} else {
+				return false;
+			}
+		}
+		if (setupEnd == SIZE_MAX) setupEnd = records.size();
+		return reader.ok;
+	}
+
+	const unsigned char* payloadData(uint64_t index) const { return blob.data() + payloads[index].first; }
+	size_t payloadSize(uint64_t index) const { return payloads[index].second; }
+
+	GLuint name(char role, uint64_t recorded) const {
+		const auto& map = names[std::toupper((unsigned char)role) - 'A'];
+		auto found = map.find(recorded);
+		if (found != map.end()) return found->second;
+		return role == 'F' ? framebuffer : (GLuint)recorded;
+	}
+
+	static uint64_t locationKey(uint64_t program, uint64_t location) {
+		return (program << 32) | (uint32_t)location;
+	}
+
+	// The program a location in this call belongs to, by its recorded name
+	uint64_t locationProgram(const GLTraceFunction& function, const Value* values) const {
+		return function.program >= 0 ? values[function.program].bits : currentProgram;
+	}
+
+	GladGLArgument argument(const GLTraceFunction& function, int j, const Value* values) {
+		const GLTraceParameter& parameter = function.parameters[j];
+		const Value& value = values[j];
+		GladGLArgument argument;
+		argument.u = value.bits;
+		if (parameter.type == 'f') {
+			uint32_t bits = (uint32_t)value.bits;
+			std::memcpy(&argument.f, &bits, 4);
+			return argument;
+		}
+		if (parameter.type == 'd') {
+			std::memcpy(&argument.d, &value.bits, 8);
+			return argument;
+		}
+		if (parameter.type == 'i' || parameter.type == 'u') {
+			if (parameter.role == 'L') {
+				auto found = locations.find(locationKey(locationProgram(function, values), value.bits));
+				if (found != locations.end()) argument.i = found->second;
+			} else if (std::isupper((unsigned char)parameter.role) && parameter.role != 'O') {
+				argument.u = name(parameter.role, value.bits);
+			}
+			return argument;
+		}
+
+		switch (value.tag) {
+		case TRACE_NULL:
+			argument.p = nullptr;
+			break;
+		case TRACE_VALUE:
+			if (parameter.role == 'Y') {
+				auto found = syncs.find(value.bits);
+				argument.p = found != syncs.end() ? (const void*)found->second : nullptr;
+			} else {
+				argument.p = (const void*)(uintptr_t)value.bits;
+			}
+			break;
+		case TRACE_PAYLOAD: {
+			const unsigned char* data = payloadData(value.bits);
+			size_t size = payloadSize(value.bits);
+			std::vector<unsigned char>& scratch = temporary[j];
+			if (parameter.type == 'S') {
+				// NUL separated strings, passed without lengths
+				scratch.resize(0);
+				for (size_t k = 0; k < size; k += std::strlen((const char*)data + k) + 1) {
+					const char* string = (const char*)data + k;
+					scratch.insert(scratch.end(), (const unsigned char*)&string, (const unsigned char*)&string + sizeof(string));
+				}
+				argument.p = scratch.data();
+			} else if (parameter.type == 'o') {
+				scratch.assign(size, 0);
+				argument.p = scratch.data();
+			} else if (std::islower((unsigned char)parameter.role)) {
+				scratch.resize(size);
+				for (size_t k = 0; k + sizeof(GLuint) <= size; k += sizeof(GLuint)) {
+					GLuint recorded;
+					std::memcpy(&recorded, data + k, sizeof(GLuint));
+					GLuint replayed = name(parameter.role, recorded);
+					std::memcpy(scratch.data() + k, &replayed, sizeof(GLuint));
+				}
+				argument.p = scratch.data();
+			} else {
+				argument.p = data;
+			}
+			break;
+		}
+		default:
+			argument.p = parameter.type == 'o' ? output(function, j) : nullptr;
+		}
+		return argument;
+	}
+
+	// Scratch memory for outputs that weren't captured: a small slot per parameter, and a large
+	// area for the last output (pixels, binaries, labels). calloc'd, so untouched pages cost nothing.
+	void* output(const GLTraceFunction& function, int j) {
+		const size_t slot = 64 << 10, large = 256 << 20;
+		if (!scratchOutput) scratchOutput.reset((unsigned char*)std::calloc(GL_TRACE_MAX_ARGUMENTS * slot + large, 1));
+		for (int k = j + 1; k < function.count; k++) {
+			if (function.parameters[k].type == 'o') return scratchOutput.get() + j * slot;
+		}
+		return scratchOutput.get() + GL_TRACE_MAX_ARGUMENTS * slot;
+	}
+
+	void write(const Value* values) {
+		auto found = mappings.find(values[0].bits);
+		if (found == mappings.end()) {
+			stats.missedWrites++;
+			return;
+		}
+		const Mapping& mapping = found->second;
+		uint64_t offset = values[1].bits;
+		size_t size = payloadSize(values[2].bits);
+		// The replay may have mapped a smaller range (or a smaller buffer) than the recording
+		if (offset < mapping.offset || offset - mapping.offset > mapping.length || size > mapping.length - (offset - mapping.offset)) {
+			stats.missedWrites++;
+			return;
+		}
+		std::memcpy(mapping.pointer + (offset - mapping.offset), payloadData(values[2].bits), size);
+	}
+
+	void execute(size_t begin, size_t end) {
+		GladGLArgument args[GL_TRACE_MAX_ARGUMENTS];
+		for (size_t r = begin; r < end; r++) {
+			const Record& record = records[r];
+			const Value* values = &this->values[record.firstValue];
+			if (record.function == WRITE) {
+				write(values);
+				continue;
+			}
+			const GLTraceFunction& function = functions[record.function];
+			for (int j = 0; j < function.count; j++) args[j] = argument(function, j, values);
+			GladGLArgument result;
+			result.u = 0;
+			if (!gladGLCall(record.function, args, &result)) {
+				stats.skipped++;
+				continue;
+			}
+			stats.calls++;
+			after(function, values, args, result);
+		}
+	}
+
+	// Remaps what the call created and follows buffers, mappings and the program in use
+	void after(const GLTraceFunction& function, const Value* values, const GladGLArgument* args, const GladGLArgument& result) {
+		for (int j = 0; j < function.count; j++) {
+			const GLTraceParameter& parameter = function.parameters[j];
+			if (parameter.type != 'o' || !std::islower((unsigned char)parameter.role) || values[j].tag != TRACE_PAYLOAD) continue;
+			const unsigned char* recorded = payloadData(values[j].bits);
+			auto& map = names[std::toupper((unsigned char)parameter.role) - 'A'];
+			for (size_t k = 0; k + sizeof(GLuint) <= payloadSize(values[j].bits); k += sizeof(GLuint)) {
+				GLuint before, now;
+				std::memcpy(&before, recorded + k, sizeof(GLuint));
+				std::memcpy(&now, (const unsigned char*)args[j].p + k, sizeof(GLuint));
+				map[before] = now;
+			}
+		}
+		const Value& recordedResult = values[function.count];
+		switch (function.result.role) {
+		case 'P':
+			names['P' - 'A'][recordedResult.bits] = (GLuint)result.u;
+			break;
+		case 'L':
+			locations[locationKey(locationProgram(function, values), recordedResult.bits)] = (GLint)result.i;
+			break;
+		case 'Y':
+			syncs[recordedResult.bits] = (GLsync)result.p;
+			break;
+		}
+		switch (function.special) {
+		case TRACE_BIND_BUFFER:
+			bindings[values[0].bits] = values[1].bits;
+			break;
+		case TRACE_BIND_BUFFER_INDEXED:
+			bindings[values[0].bits] = values[2].bits;
+			break;
+		case TRACE_MAP:
+		case TRACE_MAP_NAMED:
+		case TRACE_MAP_RANGE:
+		case TRACE_MAP_NAMED_RANGE: {
+			bool named = function.special == TRACE_MAP_NAMED || function.special == TRACE_MAP_NAMED_RANGE;
+			bool range = function.special == TRACE_MAP_RANGE || function.special == TRACE_MAP_NAMED_RANGE;
+			uint64_t buffer = named ? values[0].bits : bindings[values[0].bits];
+			if (!result.p) break;
+			GLint64 length = 0;
+			if (range) length = (GLint64)values[2].bits;
+			else if (named) glGetNamedBufferParameteri64v((GLuint)args[0].u, GL_BUFFER_SIZE, &length);
+			else glGetBufferParameteri64v((GLenum)args[0].u, GL_BUFFER_SIZE, &length);
+			mappings[buffer] = {(unsigned char*)result.p, range ? (size_t)values[1].bits : 0, (size_t)std::max<GLint64>(length, 0)};
+			break;
+		}
+		case TRACE_UNMAP:
+			mappings.erase(bindings[values[0].bits]);
+			break;
+		case TRACE_UNMAP_NAMED:
+			mappings.erase(values[0].bits);
+			break;
+		case TRACE_USE_PROGRAM:
+			currentProgram = values[0].bits;
+			break;
+		case TRACE_GET_ERROR:
+			stats.errorMismatches += result.u != recordedResult.bits;
+			break;
+		default:
+			break;
+		}
+	}
+
+	int width = 0, height = 0;
+	GLuint framebuffer = 0;
+	size_t setupEnd = SIZE_MAX;
+	std::vector<GLTraceFunction> functions;
+	std::vector<Record> records;
+	std::vector<Value> values;
+	std::vector<Frame> frames;
+	std::vector<unsigned char> blob;
+	std::vector<std::pair<size_t, size_t>> payloads;  // offset and size in blob
+
+	// Replay state, by recorded names
+	std::unordered_map<uint64_t, GLuint> names[26];
+	std::unordered_map<uint64_t, GLint> locations;
+	std::unordered_map<uint64_t, GLsync> syncs;
+	std::unordered_map<uint64_t, uint64_t> bindings;
+	std::unordered_map<uint64_t, Mapping> mappings;
+	uint64_t currentProgram = 0;
+	std::vector<unsigned char> temporary[GL_TRACE_MAX_ARGUMENTS];
+	std::unique_ptr<unsigned char, decltype(&std::free)> scratchOutput{nullptr, &std::free};
+	GLTraceReplayStats stats;
+};
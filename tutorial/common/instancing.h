@@ -0,0 +1,108 @@
+#pragma once
+// GPU instancing
+// InstanceBuffer streams one model matrix per instance into an instanced vertex attribute.
+// A mat4 attribute takes four consecutive locations (one vec4 column each), which advance
+// once per instance (divisor 1) instead of once per vertex. The whole set of instances is
+// then drawn with a single glDrawElementsInstanced.
+// The matrices either live in the InstanceBuffer's own buffer (update with a pointer) or
+// are streamed through a RingBuffer each frame (update with a ring).
+//
+// Vertex shader side:
+//	layout(location = 3) in mat4 instanceModel;
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstring>
+
+#include "gl_state_cache.h"
+#include "mesh_builder.h"
+#include "ring_buffer.h"
+
+class InstanceBuffer {
+public:
+	static constexpr GLuint DEFAULT_LOCATION = 3;
+
+	void create(GLuint firstLocation = DEFAULT_LOCATION) {
+		location = firstLocation;
+		glGenBuffers(1, &buffer);
+		source = buffer;
+		sourceOffset = 0;
+	}
+
+	void destroy(GLStateCache& glState) {
+		glState.forgetBuffer(buffer);
+		glDeleteBuffers(1, &buffer);
+		buffer = 0;
+		capacity = 0;
+	}
+
+	// Adds the per-instance matrix attribute to a VAO.
+	void attach(GLStateCache& glState, GLuint vertexArray) {
+		this->vertexArray = vertexArray;
+		rebase(glState, vertexArray, 0);
+		for (GLuint column = 0; column < 4; column++) {
+			glState.enableVertexAttribArray(location + column);
+			glVertexAttribDivisor(location + column, 1);
+		}
+	}
+	void attach(GLStateCache& glState, const Mesh& mesh) { attach(glState, mesh.vertexArray); }
+
+	// Points the attribute at firstInstance, so the next draw's instance 0 reads that matrix.
+	// Stands in for the baseInstance of glDraw*BaseInstance on contexts older than GL 4.2.
+	void rebase(GLStateCache& glState, GLuint vertexArray, size_t firstInstance) {
+		glState.bindVertexArray(vertexArray);
+		glState.bindBuffer(GL_ARRAY_BUFFER, source);
+		for (GLuint column = 0; column < 4; column++) {
+			glState.vertexAttribPointer(location + column, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+				(void*)(sourceOffset + firstInstance * sizeof(glm::mat4) + column * sizeof(glm::vec4)));
+		}
+	}
+
+	// Replaces the instance data. The old storage is orphaned, so a frame the GPU is
+	// still drawing with the previous matrices never blocks the upload.
+	void update(GLStateCache& glState, const glm::mat4* matrices, size_t count) {
+		glState.bindBuffer(GL_ARRAY_BUFFER, buffer);
+		size_t bytes = count * sizeof(glm::mat4);
+		if (bytes > capacity) capacity = bytes;
+		glState.bufferData(GL_ARRAY_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+		glState.bufferSubData(GL_ARRAY_BUFFER, 0, bytes, matrices);
+		instances = count;
+		if (source != buffer || sourceOffset != 0) {
+			source = buffer;
+			sourceOffset = 0;
+			if (vertexArray) rebase(glState, vertexArray, 0);
+		}
+	}
+
+	// Writes the matrices into this frame's region of the ring and points the attribute
+	// there. Returns false (keeping the previous data) if they don't fit.
+	bool update(GLStateCache& glState, RingBuffer& ring, const glm::mat4* matrices, size_t count) {
+		RingAllocation allocation = ring.allocate(count * sizeof(glm::mat4), sizeof(glm::vec4));
+		if (!allocation.data) return false;
+		std::memcpy(allocation.data, matrices, allocation.size);
+		ring.flush();
+		instances = count;
+		source = ring.handle();
+		sourceOffset = (size_t)allocation.offset;
+		if (vertexArray) rebase(glState, vertexArray, 0);
+		return true;
+	}
+
+	size_t count() const { return instances; }
+	GLuint handle() const { return buffer; }
+
+	// Draws every instance of the mesh in one call.
+	void draw(GLStateCache& glState, const Mesh& mesh) const {
+		glState.bindVertexArray(mesh.vertexArray);
+		glDrawElementsInstanced(GL_TRIANGLES, mesh.indexCount, mesh.indexType, (void*)0, (GLsizei)instances);
+	}
+
+private:
+	GLuint buffer = 0;
+	GLuint vertexArray = 0;     // the VAO the attribute was attached to
+	GLuint source = 0;          // where the matrices currently are: buffer or a ring
+	size_t sourceOffset = 0;
+	GLuint location = DEFAULT_LOCATION;
+	size_t capacity = 0;
+	size_t instances = 0;
+};
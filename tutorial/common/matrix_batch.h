@@ -0,0 +1,146 @@
+#pragma once
+// Batched matrix multiply and inverse
+// glm_mat4_mul and glm_mat4_inverse (glm/simd/matrix.h) work on one matrix at a time, four
+// floats per register. Here the kernels put one matrix in each lane instead: 4, 8 or 16
+// matrices per step with SSE, AVX2 or AVX-512, dispatched at run time like
+// batch_transform.h.
+//	Mat4Array:        general 4x4 matrices
+//	Affine4x3Array:   affine transforms, the last row implicitly (0, 0, 0, 1); a multiply
+//	                  is 36 multiply-adds instead of 64, an inverse a 3x3 one
+// Storage is blocked (AoSoA): MATRIX_BLOCK matrices per block, and within a block the
+// same element of all of them side by side. A step reads whole cache lines from one
+// contiguous block, where one stream per element would walk 16 pages at once.
+// updateWorldMatrices() runs a whole transform hierarchy level by level, gathering each
+// node's parent. The normal matrix transpose(inverse(mat3(world))) is the affine inverse's
+// 3x3 part read transposed, see Affine4x3Array::normalMatrix().
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "aligned_memory.h"
+#include "simd_dispatch.h"
+
+const int MATRIX_BLOCK = 16;
+
+// Where matrix i's first element is; element e is MATRIX_BLOCK * e further. Elements are
+// column-major (column c, row r), as glm::value_ptr orders them: 4c + r for a 4x4 matrix,
+// 3c + r (r < 3) for an affine one, whose column 3 is the translation.
+template <int ELEMENTS>
+inline size_t matrixSlot(size_t i) {
+	return (i / MATRIX_BLOCK) * (MATRIX_BLOCK * ELEMENTS) + i % MATRIX_BLOCK;
+}
+
+template <int ELEMENTS>
+inline glm::mat4 getMatrix(const float* data, size_t i) {
+	const int ROWS = ELEMENTS / 4;
+	const float* p = data + matrixSlot<ELEMENTS>(i);
+	glm::mat4 m(1.0f);
+	for (int c = 0; c < 4; c++) {
+		for (int r = 0; r < ROWS; r++) m[c][r] = p[(ROWS * c + r) * MATRIX_BLOCK];
+	}
+	return m;
+}
+
+// An affine matrix drops m's last row.
+template <int ELEMENTS>
+inline void setMatrix(float* data, size_t i, const glm::mat4& m) {
+	const int ROWS = ELEMENTS / 4;
+	float* p = data + matrixSlot<ELEMENTS>(i);
+	for (int c = 0; c < 4; c++) {
+		for (int r = 0; r < ROWS; r++) p[(ROWS * c + r) * MATRIX_BLOCK] = m[c][r];
+	}
+}
+
+template <int ELEMENTS>
+struct MatrixArray {
+	AlignedVector<float> data;
+
+	// Slots are 32-bit for the gathers: up to 2^31 / ELEMENTS matrices.
+	void resize(size_t count) {
+		matrices = count;
+		data.resize((count + MATRIX_BLOCK - 1) / MATRIX_BLOCK * MATRIX_BLOCK * ELEMENTS);
+	}
+	size_t size() const { return matrices; }
+
+	glm::mat4 get(size_t i) const { return getMatrix<ELEMENTS>(data.data(), i); }
+	void set(size_t i, const glm::mat4& m) { setMatrix<ELEMENTS>(data.data(), i, m); }
+
+	// On an affine inverse (inverseAffine), the original's normal matrix
+	// transpose(inverse(mat3(m))); no separate pass needed.
+	glm::mat3 normalMatrix(size_t i) const { return glm::transpose(glm::mat3(get(i))); }
+
+private:
+	size_t matrices = 0;
+};
+
+typedef MatrixArray<16> Mat4Array;
+typedef MatrixArray<12> Affine4x3Array;
+
+namespace matrix_batch_scalar {
+#include "matrix_batch.inl"
+}
+
+#if SIMD_DISPATCH_X86
+SIMD_TARGET_SSE41
+namespace matrix_batch_sse41 {
+#define SIMD_LANES_SSE41
+#include "matrix_batch.inl"
+#undef SIMD_LANES_SSE41
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX2
+namespace matrix_batch_avx2 {
+#define SIMD_LANES_AVX2
+#include "matrix_batch.inl"
+#undef SIMD_LANES_AVX2
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX512
+namespace matrix_batch_avx512 {
+#define SIMD_LANES_AVX512
+#include "matrix_batch.inl"
+#undef SIMD_LANES_AVX512
+}
+SIMD_TARGET_END
+#endif
+
+// The kernels for one level (clamped to what was compiled in). They take MatrixArray data
+// and run over matrices [begin, end). For the multiplies, out[i] = a[i] * b[i], or
+// a[aIndex[i]] * b[i] with an index array; out may be b but not a.
+struct MatrixBatchKernels {
+	SimdLevel level;
+	int width; // matrices per step
+	void (*multiply)(const float* a, const uint32_t* aIndex, const float* b, float* out, size_t begin, size_t end);
+	void (*multiplyAffine)(const float* a, const uint32_t* aIndex, const float* b, float* out, size_t begin, size_t end);
+	void (*inverse)(const float* in, float* out, size_t begin, size_t end);
+	void (*inverseAffine)(const float* in, float* out, size_t begin, size_t end);
+};
+
+#define MATRIX_BATCH_KERNELS(level, ns) {level, ns::WIDTH, ns::multiply, ns::multiplyAffine, ns::inverse, ns::inverseAffine}
+
+inline MatrixBatchKernels matrixBatchKernels(SimdLevel level = simdLevel()) {
+#if SIMD_DISPATCH_X86
+	if (level >= SIMD_AVX512) return MATRIX_BATCH_KERNELS(SIMD_AVX512, matrix_batch_avx512);
+	if (level >= SIMD_AVX2) return MATRIX_BATCH_KERNELS(SIMD_AVX2, matrix_batch_avx2);
+	if (level >= SIMD_SSE41) return MATRIX_BATCH_KERNELS(SIMD_SSE41, matrix_batch_sse41);
+#endif
+	return MATRIX_BATCH_KERNELS(SIMD_SCALAR, matrix_batch_scalar);
+}
+
+#undef MATRIX_BATCH_KERNELS
+
+// A transform hierarchy stored breadth first: levelBegin[l] is the first node at depth l
+// (levelBegin[0] = 0, roots; the last entry is the node count), and parent[i] < levelBegin[l]
+// for every node i at depth l > 0. world[i] = world[parent[i]] * local[i].
+inline void updateWorldMatrices(const Affine4x3Array& local, const uint32_t* parent, const std::vector<size_t>& levelBegin,
+	Affine4x3Array& world, SimdLevel level = simdLevel()) {
+	if (levelBegin.size() < 2) return;
+	const MatrixBatchKernels kernels = matrixBatchKernels(level);
+	for (size_t i = 0; i < levelBegin[1]; i++) world.set(i, local.get(i));
+	for (size_t l = 1; l + 1 < levelBegin.size(); l++) {
+		kernels.multiplyAffine(world.data.data(), parent, local.data.data(), world.data.data(), levelBegin[l], levelBegin[l + 1]);
+	}
+}
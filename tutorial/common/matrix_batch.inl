@@ -0,0 +1,153 @@
+// Batched matrix kernels, compiled once per instruction set (see simd_lanes.inl). One lane
+// per matrix: WIDTH divides MATRIX_BLOCK, so element e of matrices i .. i + WIDTH - 1
+// (i a multiple of WIDTH) is one load at slot(i) + e * MATRIX_BLOCK.
+// No include guard on purpose.
+#include "simd_lanes.inl"
+
+// Loads element 0 of every lane's matrix; element e is at + e * MATRIX_BLOCK.
+template <int ELEMENTS>
+inline void loadElements(const float* data, const uint32_t* index, size_t i, Lanes* m) {
+	if (index) {
+		uint32_t slots[WIDTH];
+		for (int k = 0; k < WIDTH; k++) slots[k] = (uint32_t)matrixSlot<ELEMENTS>(index[i + k]);
+		for (int e = 0; e < ELEMENTS; e++) m[e] = gather(data + e * MATRIX_BLOCK, slots);
+	} else {
+		const float* p = data + matrixSlot<ELEMENTS>(i);
+		for (int e = 0; e < ELEMENTS; e++) m[e] = load(p + e * MATRIX_BLOCK);
+	}
+}
+
+// out[i] = a[i or aIndex[i]] * b[i] for i in [begin, end). out may be b, not a.
+inline void multiply(const float* a, const uint32_t* aIndex, const float* b, float* out, size_t begin, size_t end) {
+	size_t i = begin;
+	for (; i < end && i % WIDTH; i++) setMatrix<16>(out, i, getMatrix<16>(a, aIndex ? aIndex[i] : i) * getMatrix<16>(b, i));
+	for (; i + WIDTH <= end; i += WIDTH) {
+		Lanes m[16];
+		loadElements<16>(a, aIndex, i, m);
+		const float* p = b + matrixSlot<16>(i);
+		float* q = out + matrixSlot<16>(i);
+		// Column by column, so out == b only ever overwrites a column already read
+		for (int c = 0; c < 4; c++) {
+			Lanes b0 = load(p + (4 * c) * MATRIX_BLOCK), b1 = load(p + (4 * c + 1) * MATRIX_BLOCK);
+			Lanes b2 = load(p + (4 * c + 2) * MATRIX_BLOCK), b3 = load(p + (4 * c + 3) * MATRIX_BLOCK);
+			for (int r = 0; r < 4; r++) {
+				store(q + (4 * c + r) * MATRIX_BLOCK, madd(m[12 + r], b3, madd(m[8 + r], b2, madd(m[4 + r], b1, mul(m[r], b0)))));
+			}
+		}
+	}
+	for (; i < end; i++) setMatrix<16>(out, i, getMatrix<16>(a, aIndex ? aIndex[i] : i) * getMatrix<16>(b, i));
+}
+
+// The affine case: the last rows are (0, 0, 0, 1), so only the upper 3x4 is computed.
+inline void multiplyAffine(const float* a, const uint32_t* aIndex, const float* b, float* out, size_t begin, size_t end) {
+	size_t i = begin;
+	for (; i < end && i % WIDTH; i++) setMatrix<12>(out, i, getMatrix<12>(a, aIndex ? aIndex[i] : i) * getMatrix<12>(b, i));
+	for (; i + WIDTH <= end; i += WIDTH) {
+		Lanes m[12];
+		loadElements<12>(a, aIndex, i, m);
+		const float* p = b + matrixSlot<12>(i);
+		float* q = out + matrixSlot<12>(i);
+		for (int c = 0; c < 4; c++) {
+			Lanes b0 = load(p + (3 * c) * MATRIX_BLOCK), b1 = load(p + (3 * c + 1) * MATRIX_BLOCK), b2 = load(p + (3 * c + 2) * MATRIX_BLOCK);
+			for (int r = 0; r < 3; r++) {
+				Lanes product = madd(m[6 + r], b2, madd(m[3 + r], b1, mul(m[r], b0)));
+				if (c == 3) product = add(product, m[9 + r]); // translation: b's w is 1
+				store(q + (3 * c + r) * MATRIX_BLOCK, product);
+			}
+		}
+	}
+	for (; i < end; i++) setMatrix<12>(out, i, getMatrix<12>(a, aIndex ? aIndex[i] : i) * getMatrix<12>(b, i));
+}
+
+// out[i] = inverse(in[i]), by the cofactors glm::inverse uses. out may be in.
+inline void inverse(const float* in, float* out, size_t begin, size_t end) {
+	size_t i = begin;
+	for (; i < end && i % WIDTH; i++) setMatrix<16>(out, i, glm::inverse(getMatrix<16>(in, i)));
+	for (; i + WIDTH <= end; i += WIDTH) {
+		const float* p = in + matrixSlot<16>(i);
+		Lanes m[4][4];
+		for (int c = 0; c < 4; c++) {
+			for (int r = 0; r < 4; r++) m[c][r] = load(p + (4 * c + r) * MATRIX_BLOCK);
+		}
+		auto minor = [&](int c0, int r0, int c1, int r1) { return sub(mul(m[c0][r0], m[c1][r1]), mul(m[c1][r0], m[c0][r1])); };
+		Lanes coef00 = minor(2, 2, 3, 3), coef02 = minor(1, 2, 3, 3), coef03 = minor(1, 2, 2, 3);
+		Lanes coef04 = minor(2, 1, 3, 3), coef06 = minor(1, 1, 3, 3), coef07 = minor(1, 1, 2, 3);
+		Lanes coef08 = minor(2, 1, 3, 2), coef10 = minor(1, 1, 3, 2), coef11 = minor(1, 1, 2, 2);
+		Lanes coef12 = minor(2, 0, 3, 3), coef14 = minor(1, 0, 3, 3), coef15 = minor(1, 0, 2, 3);
+		Lanes coef16 = minor(2, 0, 3, 2), coef18 = minor(1, 0, 3, 2), coef19 = minor(1, 0, 2, 2);
+		Lanes coef20 = minor(2, 0, 3, 1), coef22 = minor(1, 0, 3, 1), coef23 = minor(1, 0, 2, 1);
+		// glm's Fac0..5 and Vec0..3, one lane pack per vector component
+		const Lanes fac[6][4] = {
+			{coef00, coef00, coef02, coef03}, {coef04, coef04, coef06, coef07}, {coef08, coef08, coef10, coef11},
+			{coef12, coef12, coef14, coef15}, {coef16, coef16, coef18, coef19}, {coef20, coef20, coef22, coef23},
+		};
+		Lanes vec[4][4];
+		for (int r = 0; r < 4; r++) {
+			vec[r][0] = m[1][r];
+			vec[r][1] = vec[r][2] = vec[r][3] = m[0][r];
+		}
+		// Inv0 = Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2, and so on; signs alternate
+		const int terms[4][3][2] = {
+			{{1, 0}, {2, 1}, {3, 2}}, {{0, 0}, {2, 3}, {3, 4}}, {{0, 1}, {1, 3}, {3, 5}}, {{0, 2}, {1, 4}, {2, 5}},
+		};
+		Lanes inv[4][4];
+		for (int c = 0; c < 4; c++) {
+			for (int k = 0; k < 4; k++) {
+				Lanes value = add(sub(mul(vec[terms[c][0][0]][k], fac[terms[c][0][1]][k]), mul(vec[terms[c][1][0]][k], fac[terms[c][1][1]][k])),
+					mul(vec[terms[c][2][0]][k], fac[terms[c][2][1]][k]));
+				inv[c][k] = ((c + k) & 1) ? sub(broadcast(0.0f), value) : value;
+			}
+		}
+		Lanes determinant = add(add(mul(m[0][0], inv[0][0]), mul(m[0][1], inv[1][0])), add(mul(m[0][2], inv[2][0]), mul(m[0][3], inv[3][0])));
+		Lanes oneOverDeterminant = div(broadcast(1.0f), determinant);
+		float* q = out + matrixSlot<16>(i);
+		for (int c = 0; c < 4; c++) {
+			for (int r = 0; r < 4; r++) store(q + (4 * c + r) * MATRIX_BLOCK, mul(inv[c][r], oneOverDeterminant));
+		}
+	}
+	for (; i < end; i++) setMatrix<16>(out, i, glm::inverse(getMatrix<16>(in, i)));
+}
+
+// Affine inverse: inverse of the 3x3 part (glm's mat3 cofactors), translation -inverse * t.
+inline glm::mat4 inverseAffine(const glm::mat4& m) {
+	glm::mat3 linear = glm::inverse(glm::mat3(m));
+	glm::mat4 result(linear);
+	result[3] = glm::vec4(-(linear * glm::vec3(m[3])), 1.0f);
+	return result;
+}
+
+inline void inverseAffine(const float* in, float* out, size_t begin, size_t end) {
+	size_t i = begin;
+	for (; i < end && i % WIDTH; i++) setMatrix<12>(out, i, inverseAffine(getMatrix<12>(in, i)));
+	for (; i + WIDTH <= end; i += WIDTH) {
+		const float* p = in + matrixSlot<12>(i);
+		Lanes m[4][3];
+		for (int c = 0; c < 4; c++) {
+			for (int r = 0; r < 3; r++) m[c][r] = load(p + (3 * c + r) * MATRIX_BLOCK);
+		}
+		auto minor = [&](int c0, int r0, int c1, int r1) { return sub(mul(m[c0][r0], m[c1][r1]), mul(m[c1][r0], m[c0][r1])); };
+		Lanes cofactor00 = minor(1, 1, 2, 2), cofactor01 = minor(0, 1, 2, 2), cofactor02 = minor(0, 1, 1, 2);
+		Lanes oneOverDeterminant = div(broadcast(1.0f),
+			add(sub(mul(m[0][0], cofactor00), mul(m[1][0], cofactor01)), mul(m[2][0], cofactor02)));
+		Lanes zero = broadcast(0.0f);
+		Lanes inv[3][3];
+		inv[0][0] = mul(cofactor00, oneOverDeterminant);
+		inv[1][0] = mul(sub(zero, minor(1, 0, 2, 2)), oneOverDeterminant);
+		inv[2][0] = mul(minor(1, 0, 2, 1), oneOverDeterminant);
+		inv[0][1] = mul(sub(zero, cofactor01), oneOverDeterminant);
+		inv[1][1] = mul(minor(0, 0, 2, 2), oneOverDeterminant);
+		inv[2][1] = mul(sub(zero, minor(0, 0, 2, 1)), oneOverDeterminant);
+		inv[0][2] = mul(cofactor02, oneOverDeterminant);
+		inv[1][2] = mul(sub(zero, minor(0, 0, 1, 2)), oneOverDeterminant);
+		inv[2][2] = mul(minor(0, 0, 1, 1), oneOverDeterminant);
+		float* q = out + matrixSlot<12>(i);
+		for (int c = 0; c < 3; c++) {
+			for (int r = 0; r < 3; r++) store(q + (3 * c + r) * MATRIX_BLOCK, inv[c][r]);
+		}
+		for (int r = 0; r < 3; r++) {
+			Lanes t = madd(inv[2][r], m[3][2], madd(inv[1][r], m[3][1], mul(inv[0][r], m[3][0])));
+			store(q + (9 + r) * MATRIX_BLOCK, sub(zero, t));
+		}
+	}
+	for (; i < end; i++) setMatrix<12>(out, i, inverseAffine(getMatrix<12>(in, i)));
+}
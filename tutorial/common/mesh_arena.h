@@ -0,0 +1,187 @@
+#pragma once
+// Mesh arena and indirect draws
+// MeshArena packs many meshes into one VAO with one shared vertex buffer and one shared
+// index buffer. Each mesh is remembered as a MeshRange (first index, index count, base
+// vertex), so switching meshes needs no bind at all.
+// IndirectBatch collects one DrawElementsIndirectCommand per visible mesh and submits the
+// whole list with a single glMultiDrawElementsIndirect (GL 4.3). Older contexts get the
+// same commands as a loop of glDrawElementsInstancedBaseVertex(BaseInstance) calls, still
+// without any program or VAO changes in between.
+//
+// Per-draw data (the model matrix ...) comes from an InstanceBuffer attached to the arena:
+// a command's baseInstance selects its first matrix.
+#include <glad/gl.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "gl_state_cache.h"
+#include "instancing.h"
+#include "mesh_builder.h"
+
+// Layout fixed by GL for GL_DRAW_INDIRECT_BUFFER.
+struct DrawElementsIndirectCommand {
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+struct MeshRange {
+	GLuint firstIndex = 0;
+	GLuint indexCount = 0;
+	GLint baseVertex = 0;
+	GLuint vertexCount = 0;
+};
+
+template <typename Layout = MeshLayoutFloat>
+class MeshArena {
+public:
+	GLuint vertexArray = 0;
+	GLuint vertexBuffer = 0;
+	GLuint indexBuffer = 0;
+	GLenum indexType = GL_UNSIGNED_SHORT;
+	size_t vertexBytes = 0;
+	size_t indexBytes = 0;
+
+	// Appends a mesh to the arena. Indices stay relative to the mesh's own vertices;
+	// baseVertex moves them at draw time.
+	MeshRange add(const MeshBuilder& builder) {
+		const std::vector<MeshVertex>& meshVertices = builder.getVertices();
+		const std::vector<uint32_t>& meshIndices = builder.getIndices();
+		MeshRange range;
+		range.firstIndex = (GLuint)indices.size();
+		range.indexCount = (GLuint)meshIndices.size();
+		range.baseVertex = (GLint)vertexCount;
+		range.vertexCount = (GLuint)meshVertices.size();
+
+		std::vector<unsigned char> packed = Layout::pack(meshVertices.data(), meshVertices.size());
+		vertexData.insert(vertexData.end(), packed.begin(), packed.end());
+		indices.insert(indices.end(), meshIndices.begin(), meshIndices.end());
+		vertexCount += meshVertices.size();
+		if (meshVertices.size() > 0xFFFF) wideIndices = true;
+		return range;
+	}
+
+	// Creates the GL buffers from everything added so far and drops the CPU copies.
+	// 16-bit indices are used unless a single mesh has more than 65535 vertices.
+	void upload(GLStateCache& glState) {
+		indexType = wideIndices ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+		std::vector<uint8_t> indexData;
+		if (indexType == GL_UNSIGNED_SHORT) {
+			indexData.resize(indices.size() * sizeof(uint16_t));
+			uint16_t* out = (uint16_t*)indexData.data();
+			for (size_t i = 0; i < indices.size(); i++) out[i] = (uint16_t)indices[i];
+		} else {
+			indexData.resize(indices.size() * sizeof(uint32_t));
+			std::memcpy(indexData.data(), indices.data(), indexData.size());
+		}
+		vertexBytes = vertexData.size();
+		indexBytes = indexData.size();
+
+		glGenVertexArrays(1, &vertexArray);
+		glState.bindVertexArray(vertexArray);
+
+		glGenBuffers(1, &vertexBuffer);
+		glState.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+		glState.bufferData(GL_ARRAY_BUFFER, vertexData.size(), vertexData.data(), GL_STATIC_DRAW);
+
+		glGenBuffers(1, &indexBuffer);
+		glState.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexData.size(), indexData.data(), GL_STATIC_DRAW);
+
+		Layout::setup(glState);
+
+		std::vector<unsigned char>().swap(vertexData);
+		std::vector<uint32_t>().swap(indices);
+	}
+
+	size_t indexSize() const { return indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t); }
+
+	void destroy(GLStateCache& glState) {
+		glState.forgetBuffer(vertexBuffer);
+		glState.forgetBuffer(indexBuffer);
+		glState.forgetVertexArray(vertexArray);
+		glDeleteBuffers(1, &vertexBuffer);
+		glDeleteBuffers(1, &indexBuffer);
+		glDeleteVertexArrays(1, &vertexArray);
+		vertexArray = vertexBuffer = indexBuffer = 0;
+	}
+
+private:
+	std::vector<unsigned char> vertexData;
+	std::vector<uint32_t> indices;
+	size_t vertexCount = 0;
+	bool wideIndices = false;
+};
+
+class IndirectBatch {
+public:
+	// allowMultiDraw = false forces the per-command loop, for comparisons.
+	void create(bool allowMultiDraw = true) {
+		multiDraw = allowMultiDraw && GLAD_GL_VERSION_4_3 != 0;
+		baseInstance = GLAD_GL_VERSION_4_2 != 0;
+		if (multiDraw) glGenBuffers(1, &buffer);
+	}
+
+	void destroy(GLStateCache& glState) {
+		if (buffer) {
+			glState.forgetBuffer(buffer);
+			glDeleteBuffers(1, &buffer);
+		}
+		buffer = 0;
+		capacity = 0;
+	}
+
+	void clear() { commands.clear(); }
+
+	// Queues instanceCount instances of a mesh, reading per-instance data from firstInstance on.
+	void add(const MeshRange& range, GLuint instanceCount = 1, GLuint firstInstance = 0) {
+		commands.push_back({range.indexCount, instanceCount, range.firstIndex, range.baseVertex, firstInstance});
+	}
+
+	size_t size() const { return commands.size(); }
+	bool multiDrawIndirect() const { return multiDraw; }
+
+	// Draws every queued command and returns the number of GL draw calls it took.
+	// Without GL 4.2 base instances, instance data is reached by moving the instance
+	// attribute pointers to each command's first instance instead.
+	template <typename Layout>
+	int submit(GLStateCache& glState, const MeshArena<Layout>& arena, InstanceBuffer* instances = nullptr) {
+		if (commands.empty()) return 0;
+		glState.bindVertexArray(arena.vertexArray);
+
+		if (multiDraw) {
+			// Orphan and refill: the commands of the previous frame may still be in flight.
+			glState.bindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer);
+			size_t bytes = commands.size() * sizeof(DrawElementsIndirectCommand);
+			if (bytes > capacity) capacity = bytes;
+			glState.bufferData(GL_DRAW_INDIRECT_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+			glState.bufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, bytes, commands.data());
+			glMultiDrawElementsIndirect(GL_TRIANGLES, arena.indexType, (void*)0, (GLsizei)commands.size(), 0);
+			return 1;
+		}
+
+		for (const DrawElementsIndirectCommand& command : commands) {
+			void* offset = (void*)(command.firstIndex * arena.indexSize());
+			if (baseInstance) {
+				glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, command.count, arena.indexType, offset,
+					command.instanceCount, command.baseVertex, command.baseInstance);
+			} else {
+				if (instances) instances->rebase(glState, arena.vertexArray, command.baseInstance);
+				glDrawElementsInstancedBaseVertex(GL_TRIANGLES, command.count, arena.indexType, offset,
+					command.instanceCount, command.baseVertex);
+			}
+		}
+		if (!baseInstance && instances) instances->rebase(glState, arena.vertexArray, 0);
+		return (int)commands.size();
+	}
+
+private:
+	std::vector<DrawElementsIndirectCommand> commands;
+	GLuint buffer = 0;
+	size_t capacity = 0;
+	bool multiDraw = false;
+	bool baseInstance = false;
+};
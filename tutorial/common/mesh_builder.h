@@ -0,0 +1,230 @@
+#pragma once
+// Indexed mesh builder
+// Takes triangle soup (every corner a separate vertex, as glDrawArrays wants it), welds
+// corners that are the same vertex and emits an interleaved vertex buffer plus an index
+// buffer for glDrawElements. Positions are matched through a spatial hash with a small
+// tolerance, so the cost stays linear in the number of corners.
+// Corners are only welded if their colours and normals match too (see MeshBuilder::Weld),
+// otherwise a hard edge or a colour seam would be smeared.
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+#include <glm/ext/vector_int3_sized.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "gl_state_cache.h"
+#include "vertex_layout.h"
+
+// Interleaved vertex: what one glDrawElements index refers to.
+struct MeshVertex {
+	glm::vec3 position;
+	glm::vec3 color;
+	glm::vec3 normal;
+};
+
+// Full precision: 36 bytes per vertex.
+typedef VertexLayout<
+	VertexAttribute<0, &MeshVertex::position, Float3>,
+	VertexAttribute<1, &MeshVertex::color, Float3>,
+	VertexAttribute<2, &MeshVertex::normal, Float3>
+> MeshLayoutFloat;
+
+// Quantized: half-float position, 8-bit colour, 10-bit normal. 16 bytes per vertex.
+typedef VertexLayout<
+	VertexAttribute<0, &MeshVertex::position, HalfFloat4>,
+	VertexAttribute<1, &MeshVertex::color, Unorm4x8>,
+	VertexAttribute<2, &MeshVertex::normal, Snorm3x10_1x2>
+> MeshLayoutPacked;
+
+class MeshBuilder {
+public:
+	// Which attributes besides the position have to match for two corners to be welded.
+	enum Weld {
+		WELD_POSITION_ONLY = 0,
+		WELD_COLOR = 1,
+		WELD_NORMAL = 2,
+		WELD_ALL = WELD_COLOR | WELD_NORMAL,
+	};
+
+	explicit MeshBuilder(float epsilon = 1e-5f, unsigned int weld = WELD_ALL)
+		: epsilon(epsilon), cellSize(4.0f * epsilon), weld(weld) {}
+
+	void reserve(size_t corners) {
+		vertices.reserve(corners);
+		indices.reserve(corners);
+		next.reserve(corners);
+		cells.reserve(corners);
+	}
+
+	// Returns the index of an existing matching vertex, or adds a new one.
+	uint32_t addVertex(const MeshVertex& vertex) {
+		corners++;
+		glm::i64vec3 lo = cell(vertex.position - epsilon);
+		glm::i64vec3 hi = cell(vertex.position + epsilon);
+
+		// A vertex near a cell border may have its twin in the neighbouring cell.
+		for (int64_t x = lo.x; x <= hi.x; x++) {
+			for (int64_t y = lo.y; y <= hi.y; y++) {
+				for (int64_t z = lo.z; z <= hi.z; z++) {
+					auto it = cells.find(cellKey(x, y, z));
+					if (it == cells.end()) continue;
+					for (uint32_t i = it->second; i != NONE; i = next[i]) {
+						if (matches(vertices[i], vertex)) return i;
+					}
+				}
+			}
+		}
+
+		uint32_t index = (uint32_t)vertices.size();
+		vertices.push_back(vertex);
+		glm::i64vec3 home = cell(vertex.position);
+		auto inserted = cells.emplace(cellKey(home.x, home.y, home.z), index);
+		next.push_back(inserted.second ? NONE : inserted.first->second);
+		inserted.first->second = index;
+		return index;
+	}
+
+	void addTriangle(const MeshVertex& v0, const MeshVertex& v1, const MeshVertex& v2) {
+		indices.push_back(addVertex(v0));
+		indices.push_back(addVertex(v1));
+		indices.push_back(addVertex(v2));
+	}
+
+	// Adds non-indexed triangles given as separate tightly packed vec3 streams.
+	// colors and normals may be null.
+	void addTriangleSoup(const GLfloat* positions, const GLfloat* colors, const GLfloat* normals, size_t cornerCount) {
+		reserve(vertices.size() + cornerCount);
+		for (size_t i = 0; i < cornerCount; i++) {
+			MeshVertex vertex;
+			vertex.position = glm::vec3(positions[3 * i], positions[3 * i + 1], positions[3 * i + 2]);
+			vertex.color = colors ? glm::vec3(colors[3 * i], colors[3 * i + 1], colors[3 * i + 2]) : glm::vec3(1.0f);
+			vertex.normal = normals ? glm::vec3(normals[3 * i], normals[3 * i + 1], normals[3 * i + 2]) : glm::vec3(0.0f);
+			indices.push_back(addVertex(vertex));
+		}
+	}
+
+	const std::vector<MeshVertex>& getVertices() const { return vertices; }
+	const std::vector<uint32_t>& getIndices() const { return indices; }
+	size_t cornerCount() const { return corners; }
+
+	// 16-bit indices whenever the vertex count allows it.
+	GLenum indexType() const {
+		return vertices.size() <= 0xFFFF ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+	}
+
+	// The index buffer in the width given by indexType().
+	std::vector<uint8_t> indexData() const {
+		std::vector<uint8_t> data;
+		if (indexType() == GL_UNSIGNED_SHORT) {
+			data.resize(indices.size() * sizeof(uint16_t));
+			uint16_t* out = (uint16_t*)data.data();
+			for (size_t i = 0; i < indices.size(); i++) out[i] = (uint16_t)indices[i];
+		} else {
+			data.resize(indices.size() * sizeof(uint32_t));
+			std::memcpy(data.data(), indices.data(), data.size());
+		}
+		return data;
+	}
+
+private:
+	static constexpr uint32_t NONE = ~0u;
+
+	glm::i64vec3 cell(const glm::vec3& position) const {
+		return glm::i64vec3(cellCoordinate(position.x), cellCoordinate(position.y), cellCoordinate(position.z));
+	}
+
+	// Quantized in double and clamped before the conversion, so any float position
+	// (even an infinite or NaN one) lands in a valid cell; beyond 2^52 cells from the
+	// origin everything shares the outermost cell.
+	int64_t cellCoordinate(float x) const {
+		const double limit = 4503599627370496.0;  // 2^52
+		double c = std::floor((double)x / cellSize);
+		if (!(c > -limit)) c = -limit;
+		if (c > limit) c = limit;
+		return (int64_t)c;
+	}
+
+	// Mixes all 64 bits of each axis. Different cells may still share a key; that only
+	// costs a few extra comparisons, since matches() checks the real positions.
+	static uint64_t cellKey(int64_t x, int64_t y, int64_t z) {
+		uint64_t key = (uint64_t)x * 0x9E3779B97F4A7C15ull;
+		key ^= (uint64_t)y * 0xC2B2AE3D27D4EB4Full + (key << 6) + (key >> 2);
+		key ^= (uint64_t)z * 0x165667B19E3779F9ull + (key << 6) + (key >> 2);
+		return key;
+	}
+
+	bool near(const glm::vec3& a, const glm::vec3& b) const {
+		glm::vec3 d = glm::abs(a - b);
+		return d.x <= epsilon && d.y <= epsilon && d.z <= epsilon;
+	}
+
+	bool matches(const MeshVertex& a, const MeshVertex& b) const {
+		if (!near(a.position, b.position)) return false;
+		if ((weld & WELD_COLOR) && !near(a.color, b.color)) return false;
+		if ((weld & WELD_NORMAL) && !near(a.normal, b.normal)) return false;
+		return true;
+	}
+
+	float epsilon;
+	float cellSize;
+	unsigned int weld;
+	size_t corners = 0;
+	std::vector<MeshVertex> vertices;
+	std::vector<uint32_t> indices;
+	// Spatial hash: first vertex of each cell, then a chain through next[].
+	std::unordered_map<uint64_t, uint32_t> cells;
+	std::vector<uint32_t> next;
+};
+
+// An indexed mesh on the GPU: one VAO, one interleaved VBO, one index buffer.
+struct Mesh {
+	GLuint vertexArray = 0;
+	GLuint vertexBuffer = 0;
+	GLuint indexBuffer = 0;
+	GLsizei indexCount = 0;
+	GLenum indexType = GL_UNSIGNED_INT;
+	size_t vertexBytes = 0;
+
+	// Attribute locations 0, 1, 2 receive position, colour and normal, stored as Layout says.
+	template <typename Layout = MeshLayoutFloat>
+	void upload(GLStateCache& glState, const MeshBuilder& builder) {
+		const std::vector<MeshVertex>& vertices = builder.getVertices();
+		std::vector<unsigned char> vertexData = Layout::pack(vertices.data(), vertices.size());
+		std::vector<uint8_t> indices = builder.indexData();
+		vertexBytes = vertexData.size();
+		indexCount = (GLsizei)builder.getIndices().size();
+		indexType = builder.indexType();
+
+		glGenVertexArrays(1, &vertexArray);
+		glState.bindVertexArray(vertexArray);
+
+		glGenBuffers(1, &vertexBuffer);
+		glState.bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+		glState.bufferData(GL_ARRAY_BUFFER, vertexData.size(), vertexData.data(), GL_STATIC_DRAW);
+
+		glGenBuffers(1, &indexBuffer);
+		glState.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size(), indices.data(), GL_STATIC_DRAW);
+
+		Layout::setup(glState);
+	}
+
+	void draw(GLStateCache& glState) const {
+		glState.bindVertexArray(vertexArray);
+		glDrawElements(GL_TRIANGLES, indexCount, indexType, (void*)0);
+	}
+
+	void destroy(GLStateCache& glState) {
+		glState.forgetBuffer(vertexBuffer);
+		glState.forgetBuffer(indexBuffer);
+		glState.forgetVertexArray(vertexArray);
+		glDeleteBuffers(1, &vertexBuffer);
+		glDeleteBuffers(1, &indexBuffer);
+		glDeleteVertexArrays(1, &vertexArray);
+		vertexArray = vertexBuffer = indexBuffer = 0;
+	}
+};
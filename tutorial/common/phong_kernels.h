@@ -0,0 +1,83 @@
+#pragma once
+// SIMD Phong fragment stage for the software rasterizer
+// 03's fragment shader (ambient + attenuated diffuse + specular, times the base colour) as
+// SoA kernels that depth-test and shade 1, 4, 8 or 16 pixels per step. The kernel source is
+// phong_kernels.inl; it's compiled once per SimdLevel and the best one the CPU supports is
+// picked at run time (see simd_dispatch.h).
+//
+// Varyings, as 03's vertex shader writes them: world position (3), base colour (3), normal (3).
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "simd_dispatch.h"
+#include "software_raster.h"
+
+struct PhongUniforms {
+	glm::vec3 lightPosition;
+	glm::vec3 lightColor;
+	float lightPower;
+	glm::vec3 cameraPosition;
+	glm::vec3 materialDiffuse;
+	glm::vec3 materialAmbient;
+	glm::vec3 materialSpecular;
+	float materialShininess;
+};
+
+namespace phong_scalar {
+#include "phong_kernels.inl"
+}
+
+#if SIMD_DISPATCH_X86
+SIMD_TARGET_SSE41
+namespace phong_sse41 {
+#define SIMD_LANES_SSE41
+#include "phong_kernels.inl"
+#undef SIMD_LANES_SSE41
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX2
+namespace phong_avx2 {
+#define SIMD_LANES_AVX2
+#include "phong_kernels.inl"
+#undef SIMD_LANES_AVX2
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX512
+namespace phong_avx512 {
+#define SIMD_LANES_AVX512
+#include "phong_kernels.inl"
+#undef SIMD_LANES_AVX512
+}
+SIMD_TARGET_END
+#endif
+
+// The kernels for one level (clamped to what was compiled in).
+struct PhongKernels {
+	SimdLevel level;
+	int width;  // pixels per step
+	size_t (*shadeSpan)(const RasterSpan& span, const void* uniforms);
+	void (*shadeFragments)(const float* const* varyings, size_t count, const void* uniforms, uint32_t* out);
+};
+
+inline PhongKernels phongKernels(SimdLevel level = simdLevel()) {
+#if SIMD_DISPATCH_X86
+	if (level >= SIMD_AVX512) return {SIMD_AVX512, phong_avx512::WIDTH, phong_avx512::shadeSpan, phong_avx512::shadeFragments};
+	if (level >= SIMD_AVX2) return {SIMD_AVX2, phong_avx2::WIDTH, phong_avx2::shadeSpan, phong_avx2::shadeFragments};
+	if (level >= SIMD_SSE41) return {SIMD_SSE41, phong_sse41::WIDTH, phong_sse41::shadeSpan, phong_sse41::shadeFragments};
+#endif
+	return {SIMD_SCALAR, phong_scalar::WIDTH, phong_scalar::shadeSpan, phong_scalar::shadeFragments};
+}
+
+// For SoftwareRasterizer::drawElements; uniforms must outlive the draw.
+inline SpanKernel phongSpanKernel(const PhongUniforms& uniforms, SimdLevel level = simdLevel()) {
+	SpanKernel kernel;
+	kernel.shade = phongKernels(level).shadeSpan;
+	kernel.uniforms = &uniforms;
+	kernel.varyings = 9;
+	return kernel;
+}
@@ -0,0 +1,164 @@
+// Phong span kernel, compiled once per instruction set (see simd_lanes.inl).
+// No include guard on purpose.
+#include "simd_lanes.inl"
+
+// log2 for x > 0: exponent + log2(mantissa), the latter from the atanh series
+// log2(m) = 2/ln(2) * (t + t^3/3 + t^5/5 + ...), t = (m - 1) / (m + 1) <= 1/3.
+inline Lanes log2(Lanes x) {
+	Lanes exponent, mantissa;
+	split(x, exponent, mantissa);
+	Lanes t = div(sub(mantissa, broadcast(1.0f)), add(mantissa, broadcast(1.0f)));
+	Lanes t2 = mul(t, t);
+	Lanes series = broadcast(1.0f / 9.0f);
+	series = add(mul(series, t2), broadcast(1.0f / 7.0f));
+	series = add(mul(series, t2), broadcast(1.0f / 5.0f));
+	series = add(mul(series, t2), broadcast(1.0f / 3.0f));
+	series = add(mul(series, t2), broadcast(1.0f));
+	return add(exponent, mul(mul(series, t), broadcast(2.8853900818f)));
+}
+
+// 2^y: 2^floor(y) from the exponent bits, 2^fraction from its Taylor series in ln(2).
+inline Lanes exp2(Lanes y) {
+	y = max(y, broadcast(-126.0f));
+	Lanes n = floor(y);
+	Lanes f = mul(sub(y, n), broadcast(0.6931471806f));
+	Lanes series = broadcast(1.0f / 5040.0f);
+	series = add(mul(series, f), broadcast(1.0f / 720.0f));
+	series = add(mul(series, f), broadcast(1.0f / 120.0f));
+	series = add(mul(series, f), broadcast(1.0f / 24.0f));
+	series = add(mul(series, f), broadcast(1.0f / 6.0f));
+	series = add(mul(series, f), broadcast(0.5f));
+	series = add(mul(series, f), broadcast(1.0f));
+	series = add(mul(series, f), broadcast(1.0f));
+	return mul(series, exp2Integer(n));
+}
+
+// x^p for x >= 0 (GLSL pow); 0 stays 0.
+inline Lanes pow(Lanes x, Lanes p) {
+	Mask positive = lessThan(broadcast(0.0f), x);
+	return select(positive, exp2(mul(p, log2(max(x, broadcast(1e-30f))))), broadcast(0.0f));
+}
+
+// fragmentShaderSource for WIDTH fragments: in[0..2] world position, in[3..5] base colour,
+// in[6..8] normal. The uniform products are folded into constants once per span.
+struct PhongConstants {
+	Lanes lightX, lightY, lightZ, cameraX, cameraY, cameraZ;
+	Lanes ambient[3], diffuse[3], specular[3];
+	Lanes lightPower, shininess;
+
+	explicit PhongConstants(const PhongUniforms& u) {
+		lightX = broadcast(u.lightPosition.x);
+		lightY = broadcast(u.lightPosition.y);
+		lightZ = broadcast(u.lightPosition.z);
+		cameraX = broadcast(u.cameraPosition.x);
+		cameraY = broadcast(u.cameraPosition.y);
+		cameraZ = broadcast(u.cameraPosition.z);
+		for (int c = 0; c < 3; c++) {
+			ambient[c] = broadcast(u.materialAmbient[c] * u.lightColor[c] * u.materialDiffuse[c]);
+			diffuse[c] = broadcast(u.lightColor[c] * u.materialDiffuse[c]);
+			specular[c] = broadcast(u.lightColor[c] * u.materialSpecular[c]);
+		}
+		lightPower = broadcast(u.lightPower);
+		shininess = broadcast(u.materialShininess);
+	}
+};
+
+inline Lanes dot(Lanes ax, Lanes ay, Lanes az, Lanes bx, Lanes by, Lanes bz) {
+	return add(add(mul(ax, bx), mul(ay, by)), mul(az, bz));
+}
+
+inline void phong(const Lanes* in, const PhongConstants& k, Lanes& r, Lanes& g, Lanes& b) {
+	const Lanes one = broadcast(1.0f), zero = broadcast(0.0f);
+	// Normalize the interpolated normal
+	Lanes nx = in[6], ny = in[7], nz = in[8];
+	Lanes normalScale = div(one, sqrt(dot(nx, ny, nz, nx, ny, nz)));
+	nx = mul(nx, normalScale);
+	ny = mul(ny, normalScale);
+	nz = mul(nz, normalScale);
+
+	// Diffuse component, with the light's distance attenuation
+	Lanes lx = sub(k.lightX, in[0]), ly = sub(k.lightY, in[1]), lz = sub(k.lightZ, in[2]);
+	Lanes lightDistance2 = dot(lx, ly, lz, lx, ly, lz);
+	Lanes lightScale = div(one, sqrt(lightDistance2));
+	lx = mul(lx, lightScale);
+	ly = mul(ly, lightScale);
+	lz = mul(lz, lightScale);
+	Lanes attenuation = div(k.lightPower, lightDistance2);
+	Lanes normalDotLight = dot(nx, ny, nz, lx, ly, lz);
+	Lanes diffuseStrength = max(normalDotLight, zero);
+
+	// Specular component: reflect(-L, N) = 2 dot(N, L) N - L
+	Lanes vx = sub(k.cameraX, in[0]), vy = sub(k.cameraY, in[1]), vz = sub(k.cameraZ, in[2]);
+	Lanes viewScale = div(one, sqrt(dot(vx, vy, vz, vx, vy, vz)));
+	Lanes twice = add(normalDotLight, normalDotLight);
+	Lanes rx = sub(mul(twice, nx), lx), ry = sub(mul(twice, ny), ly), rz = sub(mul(twice, nz), lz);
+	Lanes viewDotReflect = mul(dot(vx, vy, vz, rx, ry, rz), viewScale);
+	Lanes specularStrength = pow(max(viewDotReflect, zero), k.shininess);
+
+	// (ambient + diffuse + specular) * base colour
+	Lanes diffuseTerm = mul(diffuseStrength, attenuation), specularTerm = mul(specularStrength, attenuation);
+	Lanes* out[3] = {&r, &g, &b};
+	for (int c = 0; c < 3; c++) {
+		*out[c] = mul(add(add(k.ambient[c], mul(k.diffuse[c], diffuseTerm)), mul(k.specular[c], specularTerm)), in[3 + c]);
+	}
+}
+
+// SpanKernel::shade: WIDTH pixels per step. Full steps read and write the rows directly;
+// the last, partial one goes through a local copy so nothing outside the span (possibly
+// another tile's pixels, on another thread) is touched.
+inline size_t shadeSpan(const RasterSpan& span, const void* uniforms) {
+	const PhongConstants constants(*(const PhongUniforms*)uniforms);
+	const Lanes lane = ramp();
+	size_t shaded = 0;
+
+	for (int x = span.begin; x <= span.end; x += WIDTH) {
+		const int count = std::min(WIDTH, span.end - x + 1);
+		float depthCopy[WIDTH];
+		float* depth = span.depthRow + x;
+		if (count < WIDTH) {
+			for (int i = 0; i < WIDTH; i++) depthCopy[i] = i < count ? depth[i] : -1.0f; // never passes
+			depth = depthCopy;
+		}
+
+		// Depth test (GL_LESS)
+		Lanes z = add(broadcast(span.zRow), mul(broadcast(span.zDx), add(broadcast((float)(x - span.zOriginX)), lane)));
+		Lanes stored = load(depth);
+		Mask pass = lessThan(z, stored);
+		unsigned bits = maskBits(pass);
+		if (bits == 0) continue;
+		store(depth, select(pass, z, stored));
+		if (count < WIDTH) {
+			for (int i = 0; i < count; i++) span.depthRow[x + i] = depthCopy[i];
+		}
+
+		// Perspective-correct varyings
+		Lanes step = add(broadcast((float)(x - span.begin)), lane);
+		Lanes w = div(broadcast(1.0f), add(broadcast(span.inverseW), mul(broadcast(span.inverseWDx), step)));
+		Lanes in[9];
+		for (int k = 0; k < 9; k++) in[k] = mul(add(broadcast(span.varyingsOverW[k]), mul(broadcast(span.varyingsOverWDx[k]), step)), w);
+
+		Lanes r, g, b;
+		phong(in, constants, r, g, b);
+		uint32_t colors[WIDTH];
+		packColor(r, g, b, colors);
+		for (int i = 0; i < WIDTH; i++) {
+			if (bits & (1u << i)) {
+				span.colorRow[x + i] = colors[i];
+				shaded++;
+			}
+		}
+	}
+	return shaded;
+}
+
+// Shading alone, for the benchmark: count fragments stored SoA (in[k][i]), count a multiple of WIDTH.
+inline void shadeFragments(const float* const* in, size_t count, const void* uniforms, uint32_t* out) {
+	const PhongConstants constants(*(const PhongUniforms*)uniforms);
+	for (size_t i = 0; i < count; i += WIDTH) {
+		Lanes varyings[9];
+		for (int k = 0; k < 9; k++) varyings[k] = load(in[k] + i);
+		Lanes r, g, b;
+		phong(varyings, constants, r, g, b);
+		packColor(r, g, b, out + i);
+	}
+}
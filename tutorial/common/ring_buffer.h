@@ -0,0 +1,165 @@
+#pragma once
+// Streaming ring buffer for per-frame data
+// One buffer split into REGIONS regions, one per frame in flight. Each frame sub-allocates
+// from its region; at the end of the frame a fence marks the region as used by the GPU.
+// When the ring comes back around to a region, beginFrame() waits on that fence, so the
+// CPU never overwrites data the GPU is still reading and the driver never has to guess.
+//
+// GL 4.4: the buffer is created with glBufferStorage and mapped once, persistent and
+// coherent. allocate() hands out pointers straight into GPU visible memory.
+// Older contexts: allocations go to a CPU copy of the region and flush() sends the new
+// bytes with glBufferSubData. Call flush() before drawing with anything allocated this
+// frame; with a persistent mapping it does nothing.
+#include <glad/gl.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+struct RingBufferStats {
+	unsigned int allocations = 0;
+	unsigned int overflows = 0;   // allocations that didn't fit in the region
+	size_t bytes = 0;             // bytes handed out
+	size_t paddingBytes = 0;      // bytes skipped to satisfy alignments
+	unsigned int stalls = 0;      // beginFrame() calls that had to wait for the GPU
+	double stallMilliseconds = 0.0;
+
+	void print(const char* label) const {
+		std::printf("%s: %u allocations, %zu bytes (+%zu padding), %u overflows, %u stalls (%.3f ms)\n",
+			label, allocations, bytes, paddingBytes, overflows, stalls, stallMilliseconds);
+	}
+};
+
+struct RingAllocation {
+	void* data = nullptr;  // where to write; null if the region is full
+	GLintptr offset = 0;   // offset in the GL buffer, for attribute pointers and glBindBufferRange
+	size_t size = 0;
+};
+
+class RingBuffer {
+public:
+	static constexpr int REGIONS = 3;
+
+	RingBuffer() = default;
+	RingBuffer(const RingBuffer&) = delete;
+	RingBuffer& operator=(const RingBuffer&) = delete;
+	~RingBuffer() { destroy(); }
+
+	// regionSize is the most a single frame can allocate.
+	// The buffer can be used with any target; it's only ever bound to GL_COPY_WRITE_BUFFER
+	// here, which keeps GLStateCache's view of GL_ARRAY_BUFFER intact.
+	void create(size_t regionSize) {
+		this->regionSize = regionSize;
+		persistent = GLAD_GL_VERSION_4_4 != 0;
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		if (persistent) {
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_COPY_WRITE_BUFFER, regionSize * REGIONS, nullptr, flags);
+			mapped = (unsigned char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, regionSize * REGIONS, flags);
+		} else {
+			glBufferData(GL_COPY_WRITE_BUFFER, regionSize * REGIONS, nullptr, GL_STREAM_DRAW);
+			staging.resize(regionSize);
+		}
+		region = REGIONS - 1;
+	}
+
+	void destroy() {
+		for (GLsync& fence : fences) {
+			if (fence) glDeleteSync(fence);
+			fence = 0;
+		}
+		if (buffer) {
+			if (mapped) {
+				glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+				glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+			}
+			glDeleteBuffers(1, &buffer);
+		}
+		buffer = 0;
+		mapped = nullptr;
+	}
+
+	// Moves on to the next region, waiting for the GPU if it still reads from it.
+	void beginFrame() {
+		region = (region + 1) % REGIONS;
+		head = 0;
+		flushed = 0;
+		GLsync& fence = fences[region];
+		if (!fence) return;
+
+		GLenum status = glClientWaitSync(fence, 0, 0);
+		if (status == GL_TIMEOUT_EXPIRED) {
+			auto start = std::chrono::steady_clock::now();
+			do {
+				status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+			} while (status == GL_TIMEOUT_EXPIRED);
+			stats.stalls++;
+			stats.stallMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+		glDeleteSync(fence);
+		fence = 0;
+	}
+
+	// Hands out size bytes of the current region, aligned to alignment (a power of two).
+	RingAllocation allocate(size_t size, size_t alignment = 16) {
+		RingAllocation allocation;
+		size_t base = region * regionSize;
+		// Align the absolute buffer offset, which is what GL checks.
+		size_t aligned = (base + head + alignment - 1) & ~(alignment - 1);
+		size_t start = aligned - base;
+		if (start + size > regionSize) {
+			stats.overflows++;
+			return allocation;
+		}
+		stats.allocations++;
+		stats.bytes += size;
+		stats.paddingBytes += start - head;
+		head = start + size;
+
+		allocation.offset = (GLintptr)aligned;
+		allocation.size = size;
+		allocation.data = persistent ? mapped + aligned : staging.data() + start;
+		return allocation;
+	}
+
+	// Makes everything allocated so far visible to GL.
+	void flush() {
+		if (persistent || flushed >= head) return;
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, region * regionSize + flushed, head - flushed, staging.data() + flushed);
+		flushed = head;
+	}
+
+	// Fences the region after the last command that reads from it.
+	RingBufferStats endFrame() {
+		flush();
+		fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		RingBufferStats finished = stats;
+		stats = RingBufferStats();
+		return finished;
+	}
+
+	GLuint handle() const { return buffer; }
+	bool persistentMapping() const { return persistent; }
+
+	// Offset alignment glBindBufferRange requires for GL_UNIFORM_BUFFER.
+	static size_t uniformAlignment() {
+		GLint alignment = 256;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		return (size_t)alignment;
+	}
+
+private:
+	GLuint buffer = 0;
+	size_t regionSize = 0;
+	bool persistent = false;
+	unsigned char* mapped = nullptr;
+	std::vector<unsigned char> staging;
+	GLsync fences[REGIONS] = {};
+	int region = 0;
+	size_t head = 0;
+	size_t flushed = 0;
+	RingBufferStats stats;
+};
@@ -0,0 +1,186 @@
+#pragma once
+// Program binary cache
+// Linked programs are saved with glGetProgramBinary and restored with glProgramBinary
+// on the next launch, which skips compiling and linking entirely.
+// Entries are keyed by a hash of the shader sources and the driver's vendor, renderer
+// and version strings. A rejected binary (driver update, other GPU) is simply rebuilt.
+//
+//	ShaderCache cache;
+//	uint64_t key = cache.key({vertexSource, fragmentSource});
+//	GLuint program = cache.load(key);
+//	if (program == 0) {
+//		program = glCreateProgram();
+//		cache.prepare(program);
+//		... attach, link ...
+//		cache.store(key, program);
+//	}
+#include <glad/gl.h>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <random>
+#include <string>
+#include <vector>
+
+class ShaderCache {
+public:
+	explicit ShaderCache(std::string directory = ".shader_cache") : directory(std::move(directory)) {
+		// glGetProgramBinary is core in 4.1; older contexts may still report zero formats.
+		// The function pointers can't tell: after gladLoadGLOnDemand every one is a trampoline.
+		GLint formats = 0;
+		if (GLAD_GL_VERSION_4_1 || gladGLHasExtension("GL_ARB_get_program_binary")) {
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		}
+		supported = formats > 0;
+
+		driver = glString(GL_VENDOR);
+		driver += '\n';
+		driver += glString(GL_RENDERER);
+		driver += '\n';
+		driver += glString(GL_VERSION);
+	}
+
+	bool enabled() const { return supported; }
+
+	// Hash of the shader sources and the driver that will run them.
+	uint64_t key(std::initializer_list<const char*> sources) const {
+		uint64_t hash = FNV_OFFSET;
+		for (const char* source : sources) {
+			hash = fnv1a(hash, source, std::char_traits<char>::length(source));
+			hash = fnv1a(hash, "", 1); // separator, so "ab"+"c" != "a"+"bc"
+		}
+		return fnv1a(hash, driver.data(), driver.size());
+	}
+
+	// Returns a linked program created from the cached binary, or 0 on a miss.
+	GLuint load(uint64_t key) {
+		if (!supported) return 0;
+
+		std::ifstream file(path(key), std::ios::binary);
+		if (!file) {
+			misses++;
+			return 0;
+		}
+
+		Header header;
+		file.read((char*)&header, sizeof(header));
+		if (!file || header.magic != MAGIC || header.key != key || header.length == 0) {
+			return reject(key);
+		}
+		std::vector<char> binary(header.length);
+		file.read(binary.data(), binary.size());
+		if (!file) {
+			return reject(key);
+		}
+
+		GLuint program = glCreateProgram();
+		glProgramBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+
+		// The driver refuses binaries it can't use (format mismatch, driver update ...).
+		GLint linked = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &linked);
+		if (!linked) {
+			glDeleteProgram(program);
+			// Clear the error glProgramBinary may have raised for an unknown format.
+			while (glGetError() != GL_NO_ERROR) {}
+			return reject(key);
+		}
+		hits++;
+		return program;
+	}
+
+	// Call before glLinkProgram so the driver keeps a retrievable binary.
+	void prepare(GLuint program) const {
+		if (supported) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	// Saves a successfully linked program. Returns false if nothing was written.
+	bool store(uint64_t key, GLuint program) {
+		if (!supported) return false;
+
+		GLint linked = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &linked);
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (!linked || length <= 0) return false;
+
+		Header header;
+		header.key = key;
+		std::vector<char> binary(length);
+		GLsizei written = 0;
+		glGetProgramBinary(program, length, &written, &header.format, binary.data());
+		if (written <= 0) return false;
+		header.length = (uint32_t)written;
+
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+
+		// Several processes may store the same entry at once:
+		// write to a private file first, then rename it into place.
+		std::string target = path(key);
+		std::string temporary = target + "." + std::to_string(std::random_device()()) + ".tmp";
+		{
+			std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+			file.write((const char*)&header, sizeof(header));
+			file.write(binary.data(), written);
+			if (!file) {
+				std::remove(temporary.c_str());
+				return false;
+			}
+		}
+		std::filesystem::rename(temporary, target, error);
+		if (error) {
+			std::remove(temporary.c_str());
+			return false;
+		}
+		return true;
+	}
+
+	unsigned int hits = 0;
+	unsigned int misses = 0;
+	unsigned int rejected = 0;
+
+private:
+	static const uint32_t MAGIC = 0x42504C47; // "GLPB"
+	static const uint64_t FNV_OFFSET = 1469598103934665603ull;
+	static const uint64_t FNV_PRIME = 1099511628211ull;
+
+	struct Header {
+		uint32_t magic = MAGIC;
+		GLenum format = 0;
+		uint64_t key = 0;
+		uint32_t length = 0;
+		uint32_t reserved = 0;
+	};
+
+	static uint64_t fnv1a(uint64_t hash, const char* data, size_t size) {
+		for (size_t i = 0; i < size; i++) {
+			hash ^= (unsigned char)data[i];
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+
+	static std::string glString(GLenum name) {
+		const char* value = (const char*)glGetString(name);
+		return value != NULL ? value : "";
+	}
+
+	std::string path(uint64_t key) const {
+		char name[32];
+		std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+		return directory + "/" + name;
+	}
+
+	GLuint reject(uint64_t key) {
+		rejected++;
+		std::remove(path(key).c_str());
+		return 0;
+	}
+
+	std::string directory;
+	std::string driver;
+	bool supported = false;
+};
@@ -0,0 +1,193 @@
+#pragma once
+// Asynchronous shader manager
+// submit() hands every compile and link to the driver right away and never asks for
+// the result, so the driver is free to work on all programs at once.
+// poll() is called once per frame and picks up finished programs without stalling:
+//  - with GL_KHR_parallel_shader_compile, GL_COMPLETION_STATUS_KHR tells us when the
+//    result is available, so the status queries are free;
+//  - without it, status queries are deferred by a few frames and made for one program
+//    per poll, so any remaining wait is spread out instead of serialised at startup.
+// Until a program is ready, program() returns its fallback.
+#include <glad/gl.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "shader_cache.h"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+class ShaderManager {
+public:
+	// Programs found in the cache are ready immediately and fresh links are stored in it.
+	explicit ShaderManager(ShaderCache* cache = nullptr, int deferFrames = 2)
+		: cache(cache), deferFrames(deferFrames) {
+		parallel = gladGLHasExtension("GL_KHR_parallel_shader_compile");
+	}
+
+	ShaderManager(const ShaderManager&) = delete;
+	ShaderManager& operator=(const ShaderManager&) = delete;
+
+	~ShaderManager() {
+		for (Entry& entry : entries) deleteShaders(entry);
+	}
+
+	bool parallelCompile() const { return parallel; }
+
+	// Starts compiling and linking a program. Returns a handle for program().
+	// fallback is another handle whose program is used until this one is ready.
+	int submit(const char* name, const char* vertexSource, const char* fragmentSource, int fallback = -1) {
+		Entry entry;
+		entry.name = name;
+		entry.fallback = fallback;
+		entry.submitFrame = frame;
+
+		if (cache != nullptr) {
+			entry.key = cache->key({vertexSource, fragmentSource});
+			entry.program = cache->load(entry.key);
+			if (entry.program != 0) {
+				entry.state = READY;
+				entries.push_back(entry);
+				return (int)entries.size() - 1;
+			}
+		}
+
+		entry.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+		glShaderSource(entry.vertexShader, 1, &vertexSource, nullptr);
+		glCompileShader(entry.vertexShader);
+
+		entry.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+		glShaderSource(entry.fragmentShader, 1, &fragmentSource, nullptr);
+		glCompileShader(entry.fragmentShader);
+
+		// Linking right away lets the driver chain the link behind the compiles.
+		entry.program = glCreateProgram();
+		if (cache != nullptr) cache->prepare(entry.program);
+		glAttachShader(entry.program, entry.vertexShader);
+		glAttachShader(entry.program, entry.fragmentShader);
+		glLinkProgram(entry.program);
+
+		entry.state = PENDING;
+		entries.push_back(entry);
+		return (int)entries.size() - 1;
+	}
+
+	// Collects finished programs. Returns the handles that became ready in this call.
+	std::vector<int> poll() {
+		std::vector<int> finished;
+		bool queried = false;
+		for (int i = 0; i < (int)entries.size(); i++) {
+			Entry& entry = entries[i];
+			if (entry.state != PENDING) continue;
+
+			if (parallel) {
+				GLint done = GL_FALSE;
+				glGetProgramiv(entry.program, GL_COMPLETION_STATUS_KHR, &done);
+				if (!done) continue;
+			} else {
+				// Without completion queries every status query may block: give the driver a
+				// head start and only make one such query per poll.
+				if (frame - entry.submitFrame < deferFrames || queried) continue;
+				queried = true;
+			}
+
+			if (finish(entry)) finished.push_back(i);
+		}
+		frame++;
+		return finished;
+	}
+
+	// Blocks until the program is linked. Returns false if it failed.
+	bool wait(int handle) {
+		Entry& entry = entries[handle];
+		if (entry.state == PENDING) finish(entry);
+		return entry.state == READY;
+	}
+
+	// The program to draw with now: the real one once it's ready, else its fallback chain.
+	GLuint program(int handle) const {
+		while (handle >= 0) {
+			const Entry& entry = entries[handle];
+			if (entry.state == READY) return entry.program;
+			handle = entry.fallback;
+		}
+		return 0;
+	}
+
+	bool ready(int handle) const { return entries[handle].state == READY; }
+	bool failed(int handle) const { return entries[handle].state == FAILED; }
+
+	bool allDone() const {
+		for (const Entry& entry : entries) {
+			if (entry.state == PENDING) return false;
+		}
+		return true;
+	}
+
+	void destroy() {
+		for (Entry& entry : entries) {
+			deleteShaders(entry);
+			if (entry.program != 0) glDeleteProgram(entry.program);
+			entry.program = 0;
+		}
+		entries.clear();
+	}
+
+private:
+	enum State { PENDING, READY, FAILED };
+
+	struct Entry {
+		std::string name;
+		GLuint vertexShader = 0;
+		GLuint fragmentShader = 0;
+		GLuint program = 0;
+		int fallback = -1;
+		int submitFrame = 0;
+		uint64_t key = 0;
+		State state = PENDING;
+	};
+
+	// Reads the results of a program whose work is done (or has to be waited for).
+	bool finish(Entry& entry) {
+		GLint success = GL_FALSE;
+		glGetProgramiv(entry.program, GL_LINK_STATUS, &success);
+		if (success) {
+			entry.state = READY;
+			if (cache != nullptr) cache->store(entry.key, entry.program);
+		} else {
+			entry.state = FAILED;
+			reportShader(entry, entry.vertexShader, "Vertex");
+			reportShader(entry, entry.fragmentShader, "Fragment");
+			GLchar infoLog[512];
+			glGetProgramInfoLog(entry.program, 512, NULL, infoLog);
+			std::cout << entry.name << ": shader program linking failed:\n" << infoLog << std::endl;
+		}
+		deleteShaders(entry);
+		return entry.state == READY;
+	}
+
+	static void reportShader(const Entry& entry, GLuint shader, const char* stage) {
+		GLint success = GL_FALSE;
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		if (!success) {
+			GLchar infoLog[512];
+			glGetShaderInfoLog(shader, 512, NULL, infoLog);
+			std::cout << entry.name << ": " << stage << " shader compilation failed:\n" << infoLog << std::endl;
+		}
+	}
+
+	static void deleteShaders(Entry& entry) {
+		if (entry.vertexShader != 0) glDeleteShader(entry.vertexShader);
+		if (entry.fragmentShader != 0) glDeleteShader(entry.fragmentShader);
+		entry.vertexShader = 0;
+		entry.fragmentShader = 0;
+	}
+
+	ShaderCache* cache;
+	int deferFrames;
+	int frame = 0;
+	bool parallel = false;
+	std::vector<Entry> entries;
+};
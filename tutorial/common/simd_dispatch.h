@@ -0,0 +1,80 @@
+#pragma once
+// Runtime instruction set dispatch
+// GLM's platform detection (glm/simd/platform.h) says what the compiler targets; it's a floor.
+// Kernels that want more (SSE4.1, AVX2 + FMA, AVX-512) are compiled again inside
+// SIMD_TARGET_* regions and picked at run time from what the CPU reports, so one binary
+// runs everywhere and uses the widest registers where there are some.
+//
+// Variants beyond scalar are built for x86 with GCC or Clang; elsewhere (ARM, MSVC) only the
+// scalar kernels exist. SIMD_LEVEL=scalar|sse41|avx2|avx512 in the environment caps the level,
+// which is how the variants are compared against each other.
+#include <glm/glm.hpp>
+#include <cstdlib>
+#include <cstring>
+
+enum SimdLevel {
+	SIMD_SCALAR = 0,
+	SIMD_SSE41 = 1,
+	SIMD_AVX2 = 2,
+	SIMD_AVX512 = 3, // AVX-512F
+};
+
+#if (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#define SIMD_DISPATCH_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_DISPATCH_X86 0
+#endif
+
+// Everything defined between SIMD_TARGET_<ISA> and SIMD_TARGET_END, templates included, is
+// compiled for that instruction set.
+#if SIMD_DISPATCH_X86 && defined(__clang__)
+#define SIMD_TARGET_SSE41 _Pragma("clang attribute push(__attribute__((target(\"sse4.1\"))), apply_to = function)")
+#define SIMD_TARGET_AVX2 _Pragma("clang attribute push(__attribute__((target(\"avx2,fma\"))), apply_to = function)")
+#define SIMD_TARGET_AVX512 _Pragma("clang attribute push(__attribute__((target(\"avx512f,avx2,fma\"))), apply_to = function)")
+#define SIMD_TARGET_END _Pragma("clang attribute pop")
+#elif SIMD_DISPATCH_X86
+#define SIMD_TARGET_SSE41 _Pragma("GCC push_options") _Pragma("GCC target(\"sse4.1\")")
+#define SIMD_TARGET_AVX2 _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma\")")
+#define SIMD_TARGET_AVX512 _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx2,fma\")")
+#define SIMD_TARGET_END _Pragma("GCC pop_options")
+#endif
+
+inline const char* simdLevelName(SimdLevel level) {
+	switch (level) {
+	case SIMD_AVX512: return "AVX-512";
+	case SIMD_AVX2: return "AVX2";
+	case SIMD_SSE41: return "SSE4.1";
+	default: return "scalar";
+	}
+}
+
+// What the CPU (and the build) supports.
+inline SimdLevel detectSimdLevel() {
+#if SIMD_DISPATCH_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	return SIMD_AVX2; // the whole program already requires it
+#else
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SIMD_AVX2;
+	if (__builtin_cpu_supports("sse4.1")) return SIMD_SSE41;
+#endif
+#endif
+	return SIMD_SCALAR;
+}
+
+// The level kernels should use: detected, capped by SIMD_LEVEL.
+inline SimdLevel simdLevel() {
+	static const SimdLevel level = []() {
+		SimdLevel detected = detectSimdLevel();
+		const char* cap = std::getenv("SIMD_LEVEL");
+		if (!cap) return detected;
+		SimdLevel requested = SIMD_AVX512;
+		if (std::strcmp(cap, "scalar") == 0) requested = SIMD_SCALAR;
+		else if (std::strcmp(cap, "sse41") == 0) requested = SIMD_SSE41;
+		else if (std::strcmp(cap, "avx2") == 0) requested = SIMD_AVX2;
+		return requested < detected ? requested : detected;
+	}();
+	return level;
+}
@@ -0,0 +1,194 @@
+// Lanes: WIDTH floats in one register, for SoA kernels compiled once per instruction set.
+// A kernel .inl includes this first; its header includes the kernel inside a namespace per
+// SimdLevel, with SIMD_LANES_SSE41, SIMD_LANES_AVX2 or SIMD_LANES_AVX512 defined inside the
+// matching SIMD_TARGET_* region (none for the scalar build).
+// No include guard on purpose.
+
+#if defined(SIMD_LANES_AVX512)
+typedef __m512 Lanes;
+const int WIDTH = 16;
+inline Lanes load(const float* p) { return _mm512_loadu_ps(p); }
+inline void store(float* p, Lanes a) { _mm512_storeu_ps(p, a); }
+inline Lanes broadcast(float x) { return _mm512_set1_ps(x); }
+// base[index[0]], ..., base[index[WIDTH - 1]]
+inline Lanes gather(const float* base, const uint32_t* index) {
+	// The masked form with a defined source; the plain one trips GCC's -Wmaybe-uninitialized
+	return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xffff, _mm512_loadu_si512(index), base, 4);
+}
+inline Lanes add(Lanes a, Lanes b) { return _mm512_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm512_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm512_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm512_div_ps(a, b); }
+inline Lanes madd(Lanes a, Lanes b, Lanes c) { return _mm512_fmadd_ps(a, b, c); }
+// Zero-masked forms for the same reason as gather
+inline Lanes sqrt(Lanes a) { return _mm512_maskz_sqrt_ps(0xffff, a); }
+inline Lanes min(Lanes a, Lanes b) { return _mm512_maskz_min_ps(0xffff, a, b); }
+inline Lanes max(Lanes a, Lanes b) { return _mm512_maskz_max_ps(0xffff, a, b); }
+// Bit k set where a[k] >= b[k]
+inline unsigned greaterEqualMask(Lanes a, Lanes b) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+// 0, 1, ..., WIDTH - 1
+inline Lanes ramp() { return _mm512_setr_ps(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15); }
+inline Lanes floor(Lanes a) { return _mm512_maskz_roundscale_ps(0xffff, a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+// Per lane comparisons for select; maskBits gives bit k for lane k
+typedef __mmask16 Mask;
+inline Mask lessThan(Lanes a, Lanes b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+inline Lanes select(Mask mask, Lanes a, Lanes b) { return _mm512_mask_blend_ps(mask, b, a); }
+inline unsigned maskBits(Mask mask) { return mask; }
+// x = mantissa * 2^exponent, mantissa in [1, 2); x > 0 and normal
+inline void split(Lanes x, Lanes& exponent, Lanes& mantissa) {
+	__m512i bits = _mm512_castps_si512(x);
+	exponent = _mm512_maskz_cvtepi32_ps(0xffff, _mm512_sub_epi32(_mm512_maskz_srli_epi32(0xffff, bits, 23), _mm512_set1_epi32(127)));
+	mantissa = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007FFFFF)), _mm512_set1_epi32(0x3F800000)));
+}
+// 2^n for integral n in [-126, 127]
+inline Lanes exp2Integer(Lanes n) {
+	__m512i e = _mm512_add_epi32(_mm512_maskz_cvtps_epi32(0xffff, n), _mm512_set1_epi32(127));
+	return _mm512_castsi512_ps(_mm512_maskz_slli_epi32(0xffff, e, 23));
+}
+// [0, 1] colour channels to WIDTH RGBA8 pixels with alpha 255, rounded like a UNORM conversion
+inline void packColor(Lanes r, Lanes g, Lanes b, uint32_t* out) {
+	const Lanes scale = broadcast(255.0f), bias = broadcast(0.5f), zero = broadcast(0.0f), one = broadcast(1.0f);
+	__m512i ri = _mm512_maskz_cvttps_epi32(0xffff, add(mul(min(max(r, zero), one), scale), bias));
+	__m512i gi = _mm512_maskz_cvttps_epi32(0xffff, add(mul(min(max(g, zero), one), scale), bias));
+	__m512i bi = _mm512_maskz_cvttps_epi32(0xffff, add(mul(min(max(b, zero), one), scale), bias));
+	__m512i gb = _mm512_or_si512(_mm512_maskz_slli_epi32(0xffff, gi, 8), _mm512_maskz_slli_epi32(0xffff, bi, 16));
+	_mm512_storeu_si512(out, _mm512_or_si512(_mm512_or_si512(ri, gb), _mm512_set1_epi32((int)0xFF000000)));
+}
+
+#elif defined(SIMD_LANES_AVX2)
+typedef __m256 Lanes;
+const int WIDTH = 8;
+inline Lanes load(const float* p) { return _mm256_loadu_ps(p); }
+inline void store(float* p, Lanes a) { _mm256_storeu_ps(p, a); }
+inline Lanes broadcast(float x) { return _mm256_set1_ps(x); }
+inline Lanes gather(const float* base, const uint32_t* index) {
+	return _mm256_i32gather_ps(base, _mm256_loadu_si256((const __m256i*)index), 4);
+}
+inline Lanes add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm256_div_ps(a, b); }
+inline Lanes sqrt(Lanes a) { return _mm256_sqrt_ps(a); }
+inline Lanes madd(Lanes a, Lanes b, Lanes c) { return _mm256_fmadd_ps(a, b, c); }
+inline Lanes min(Lanes a, Lanes b) { return _mm256_min_ps(a, b); }
+inline Lanes max(Lanes a, Lanes b) { return _mm256_max_ps(a, b); }
+inline unsigned greaterEqualMask(Lanes a, Lanes b) { return (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+inline Lanes ramp() { return _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7); }
+inline Lanes floor(Lanes a) { return _mm256_floor_ps(a); }
+typedef __m256 Mask;
+inline Mask lessThan(Lanes a, Lanes b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+inline Lanes select(Mask mask, Lanes a, Lanes b) { return _mm256_blendv_ps(b, a, mask); }
+inline unsigned maskBits(Mask mask) { return (unsigned)_mm256_movemask_ps(mask); }
+inline void split(Lanes x, Lanes& exponent, Lanes& mantissa) {
+	__m256i bits = _mm256_castps_si256(x);
+	exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+	mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+}
+inline Lanes exp2Integer(Lanes n) {
+	__m256i e = _mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127));
+	return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+}
+inline void packColor(Lanes r, Lanes g, Lanes b, uint32_t* out) {
+	const Lanes scale = broadcast(255.0f), bias = broadcast(0.5f), zero = broadcast(0.0f), one = broadcast(1.0f);
+	__m256i ri = _mm256_cvttps_epi32(add(mul(min(max(r, zero), one), scale), bias));
+	__m256i gi = _mm256_cvttps_epi32(add(mul(min(max(g, zero), one), scale), bias));
+	__m256i bi = _mm256_cvttps_epi32(add(mul(min(max(b, zero), one), scale), bias));
+	__m256i gb = _mm256_or_si256(_mm256_slli_epi32(gi, 8), _mm256_slli_epi32(bi, 16));
+	_mm256_storeu_si256((__m256i*)out, _mm256_or_si256(_mm256_or_si256(ri, gb), _mm256_set1_epi32((int)0xFF000000)));
+}
+
+#elif defined(SIMD_LANES_SSE41)
+// Plain SSE2 arithmetic, what glm/simd does for one vector, across four elements
+typedef __m128 Lanes;
+const int WIDTH = 4;
+inline Lanes load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, Lanes a) { _mm_storeu_ps(p, a); }
+inline Lanes broadcast(float x) { return _mm_set1_ps(x); }
+inline Lanes gather(const float* base, const uint32_t* index) {
+	return _mm_setr_ps(base[index[0]], base[index[1]], base[index[2]], base[index[3]]);
+}
+inline Lanes add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm_div_ps(a, b); }
+inline Lanes sqrt(Lanes a) { return _mm_sqrt_ps(a); }
+inline Lanes madd(Lanes a, Lanes b, Lanes c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline Lanes min(Lanes a, Lanes b) { return _mm_min_ps(a, b); }
+inline Lanes max(Lanes a, Lanes b) { return _mm_max_ps(a, b); }
+inline unsigned greaterEqualMask(Lanes a, Lanes b) { return (unsigned)_mm_movemask_ps(_mm_cmpge_ps(a, b)); }
+inline Lanes ramp() { return _mm_setr_ps(0, 1, 2, 3); }
+inline Lanes floor(Lanes a) { return _mm_floor_ps(a); }
+typedef __m128 Mask;
+inline Mask lessThan(Lanes a, Lanes b) { return _mm_cmplt_ps(a, b); }
+inline Lanes select(Mask mask, Lanes a, Lanes b) { return _mm_blendv_ps(b, a, mask); }
+inline unsigned maskBits(Mask mask) { return (unsigned)_mm_movemask_ps(mask); }
+inline void split(Lanes x, Lanes& exponent, Lanes& mantissa) {
+	__m128i bits = _mm_castps_si128(x);
+	exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+	mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+}
+inline Lanes exp2Integer(Lanes n) {
+	__m128i e = _mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127));
+	return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+}
+inline void packColor(Lanes r, Lanes g, Lanes b, uint32_t* out) {
+	const Lanes scale = broadcast(255.0f), bias = broadcast(0.5f), zero = broadcast(0.0f), one = broadcast(1.0f);
+	__m128i ri = _mm_cvttps_epi32(add(mul(min(max(r, zero), one), scale), bias));
+	__m128i gi = _mm_cvttps_epi32(add(mul(min(max(g, zero), one), scale), bias));
+	__m128i bi = _mm_cvttps_epi32(add(mul(min(max(b, zero), one), scale), bias));
+	__m128i gb = _mm_or_si128(_mm_slli_epi32(gi, 8), _mm_slli_epi32(bi, 16));
+	_mm_storeu_si128((__m128i*)out, _mm_or_si128(_mm_or_si128(ri, gb), _mm_set1_epi32((int)0xFF000000)));
+}
+
+#else
+typedef float Lanes;
+const int WIDTH = 1;
+inline Lanes load(const float* p) { return *p; }
+inline void store(float* p, Lanes a) { *p = a; }
+inline Lanes broadcast(float x) { return x; }
+inline Lanes gather(const float* base, const uint32_t* index) { return base[*index]; }
+inline Lanes add(Lanes a, Lanes b) { return a + b; }
+inline Lanes sub(Lanes a, Lanes b) { return a - b; }
+inline Lanes mul(Lanes a, Lanes b) { return a * b; }
+inline Lanes div(Lanes a, Lanes b) { return a / b; }
+inline Lanes sqrt(Lanes a) { return std::sqrt(a); }
+inline Lanes madd(Lanes a, Lanes b, Lanes c) { return a * b + c; }
+inline Lanes min(Lanes a, Lanes b) { return a < b ? a : b; }
+inline Lanes max(Lanes a, Lanes b) { return a > b ? a : b; }
+inline unsigned greaterEqualMask(Lanes a, Lanes b) { return a >= b ? 1u : 0u; }
+inline Lanes ramp() { return 0.0f; }
+inline Lanes floor(Lanes a) { return std::floor(a); }
+typedef bool Mask;
+inline Mask lessThan(Lanes a, Lanes b) { return a < b; }
+inline Lanes select(Mask mask, Lanes a, Lanes b) { return mask ? a : b; }
+inline unsigned maskBits(Mask mask) { return mask ? 1u : 0u; }
+inline void split(Lanes x, Lanes& exponent, Lanes& mantissa) {
+	int e;
+	mantissa = 2.0f * std::frexp(x, &e);
+	exponent = (float)(e - 1);
+}
+inline Lanes exp2Integer(Lanes n) { return std::ldexp(1.0f, (int)n); }
+inline void packColor(Lanes r, Lanes g, Lanes b, uint32_t* out) {
+	auto channel = [](float c) { return (uint32_t)(int)(min(max(c, 0.0f), 1.0f) * 255.0f + 0.5f); };
+	*out = channel(r) | channel(g) << 8 | channel(b) << 16 | 0xFF000000u;
+}
+#endif
+
+// Writes first + k for every bit k set in mask, in order; returns how many. out needs room
+// for WIDTH indices.
+inline size_t compressIndices(uint32_t* out, uint32_t first, unsigned mask) {
+#if defined(SIMD_LANES_AVX512)
+	__m512i indices = _mm512_add_epi32(_mm512_set1_epi32((int)first), _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+	_mm512_mask_compressstoreu_epi32(out, (__mmask16)mask, indices);
+	return (size_t)__builtin_popcount(mask);
+#else
+	// Every index is written, only the ones in mask advance
+	if (!mask) return 0;
+	size_t count = 0;
+	for (int k = 0; k < WIDTH; k++) {
+		out[count] = first + k;
+		count += (mask >> k) & 1;
+	}
+	return count;
+#endif
+}
@@ -0,0 +1,762 @@
+#pragma once
+// Tile-based software rasterizer
+// Runs the same pipeline as glDrawElements into a CPU framebuffer, for machines without a GPU:
+//	vertex stage:   the vertex shader (a C++ callable) runs once per referenced vertex
+//	setup and bin:  triangles are clipped in clip space, snapped to 1/256 pixel and set up
+//	                as integer edge functions, then appended to the bin of every TILE_SIZE
+//	                square tile they touch
+//	raster stage:   tiles are independent, so each one is a task: it walks its bin in
+//	                submission order, tests coverage (top-left fill rule, like GL), runs the
+//	                depth test (GL_LESS) and calls the fragment shader for what survives
+// Before any fragment is shaded, a hierarchical depth buffer (depth bounds per tile and per
+// HIZ_BLOCK square block) rejects whole tiles and blocks the triangle is behind, so occluded
+// fragments cost a row of edge arithmetic instead of a shader call.
+// All three stages run on a TaskPool; tiles with many triangles are balanced by stealing.
+// The framebuffer is RGBA8 plus a float depth buffer, bottom row first like glReadPixels,
+// so a frame can go straight into a FrameSink.
+// There is no culling of back faces, blending or MSAA; 03 uses none of them.
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "task_pool.h"
+
+// Float vertex attributes and an index buffer, described the way glVertexAttribPointer and
+// GL_ELEMENT_ARRAY_BUFFER describe them. Only pointers are kept; the data must outlive draws.
+class SoftwareVertexArray {
+public:
+	static constexpr int MAX_ATTRIBUTES = 8;
+
+	// stride in bytes, 0 for tightly packed
+	void attribPointer(int location, int components, size_t stride, const void* pointer) {
+		Attribute& attribute = attributes[location];
+		attribute.data = (const unsigned char*)pointer;
+		attribute.components = components;
+		attribute.stride = stride ? stride : components * sizeof(float);
+	}
+
+	void elementBuffer(const uint32_t* data, size_t count) {
+		indices = data;
+		indexCount = count;
+		vertices = 0;
+		for (size_t i = 0; i < count; i++) vertices = std::max<size_t>(vertices, data[i] + 1);
+	}
+
+	// Missing components read as (0, 0, 0, 1), like a GL attribute.
+	glm::vec4 fetch(int location, uint32_t vertex) const {
+		const Attribute& attribute = attributes[location];
+		glm::vec4 value(0.0f, 0.0f, 0.0f, 1.0f);
+		const float* data = (const float*)(attribute.data + vertex * attribute.stride);
+		for (int c = 0; c < attribute.components; c++) value[c] = data[c];
+		return value;
+	}
+
+	const uint32_t* indices = nullptr;
+	size_t indexCount = 0;
+	size_t vertices = 0;
+
+private:
+	struct Attribute {
+		const unsigned char* data = nullptr;
+		int components = 0;
+		size_t stride = 0;
+	};
+	Attribute attributes[MAX_ATTRIBUTES];
+};
+
+struct RasterStats {
+	size_t vertices = 0;
+	size_t triangles = 0;      // submitted
+	size_t clipped = 0;        // needed clipping (a clipped triangle may turn into several)
+	size_t rejected = 0;       // outside the view, degenerate or between pixel centres
+	size_t binned = 0;         // triangle-tile pairs
+	size_t fragments = 0;      // covered samples
+	size_t culled = 0;         // covered, but rejected by the hierarchical depth test
+	size_t shaded = 0;         // passed the depth test
+	double vertexMilliseconds = 0.0;
+	double binMilliseconds = 0.0;
+	double rasterMilliseconds = 0.0;
+
+	void add(const RasterStats& other) {
+		vertices += other.vertices;
+		triangles += other.triangles;
+		clipped += other.clipped;
+		rejected += other.rejected;
+		binned += other.binned;
+		fragments += other.fragments;
+		culled += other.culled;
+		shaded += other.shaded;
+		vertexMilliseconds += other.vertexMilliseconds;
+		binMilliseconds += other.binMilliseconds;
+		rasterMilliseconds += other.rasterMilliseconds;
+	}
+
+	void print(const char* label) const {
+		std::printf("%s: %zu vertices, %zu triangles (%zu clipped, %zu rejected), %zu tile bins\n",
+			label, vertices, triangles, clipped, rejected, binned);
+		std::printf("%s: %zu fragments, %zu culled by hierarchical Z, %zu shaded\n", label, fragments, culled, shaded);
+		std::printf("%s: %.3f ms vertex, %.3f ms bin, %.3f ms raster\n",
+			label, vertexMilliseconds, binMilliseconds, rasterMilliseconds);
+	}
+};
+
+// One row of a triangle inside a tile, ready for the fragment stage. Interpolated values
+// are planes stepped per pixel; z is evaluated per pixel from zRow (see rasterize()).
+struct RasterSpan {
+	int begin, end;                // covered pixels, inclusive
+	int zOriginX;                  // depth(x) = zRow + zDx * (x - zOriginX)
+	float zRow, zDx;
+	float inverseW, inverseWDx;    // 1/w at begin, and its step
+	const float* varyingsOverW;    // varying/w at begin
+	const float* varyingsOverWDx;  // and their steps
+	float* depthRow;
+	uint32_t* colorRow;
+};
+
+// A fragment stage compiled ahead of time instead of a per-fragment callable, e.g. one kernel
+// per instruction set (see phong_kernels.h). shade() depth-tests (GL_LESS), shades and writes
+// a whole span and returns the number of fragments shaded.
+struct SpanKernel {
+	size_t (*shade)(const RasterSpan& span, const void* uniforms) = nullptr;
+	const void* uniforms = nullptr;
+	int varyings = 0;
+};
+
+// VARYINGS: floats passed from the vertex to the fragment shader, interpolated with
+// perspective correction.
+template <int VARYINGS>
+class SoftwareRasterizer {
+public:
+	static constexpr int TILE_SIZE = 64;
+	static constexpr int SUBPIXEL_BITS = 8;
+	// Triangles are clipped to a band this far around the viewport; inside it, snapped
+	// coordinates and edge functions can't overflow.
+	static constexpr float GUARD_BAND_PIXELS = 4096.0f;
+	// Hierarchical depth: bounds are kept per tile and per HIZ_BLOCK square within it.
+	static constexpr int HIZ_BLOCK = 8;
+	static_assert(TILE_SIZE % HIZ_BLOCK == 0 && TILE_SIZE / HIZ_BLOCK <= 32, "blocks must tile a tile");
+
+	struct Vertex {
+		glm::vec4 position; // clip space, as gl_Position
+		float varyings[VARYINGS];
+	};
+
+	SoftwareRasterizer() = default;
+	SoftwareRasterizer(const SoftwareRasterizer&) = delete;
+	SoftwareRasterizer& operator=(const SoftwareRasterizer&) = delete;
+
+	void create(int width, int height, TaskPool* taskPool) {
+		this->width = width;
+		this->height = height;
+		pool = taskPool;
+		tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+		tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+		color.assign((size_t)width * height, 0);
+		depth.assign((size_t)width * height, 1.0f);
+		blocksX = (width + HIZ_BLOCK - 1) / HIZ_BLOCK;
+		blocksY = (height + HIZ_BLOCK - 1) / HIZ_BLOCK;
+		blockDepth.assign((size_t)blocksX * blocksY, DepthBounds{1.0f, 1.0f, false});
+		tileDepth.assign((size_t)tilesX * tilesY, DepthBounds{1.0f, 1.0f, false});
+		workerStats.assign(pool->threadCount(), WorkerStats());
+	}
+
+	void destroy() {
+		color.clear();
+		depth.clear();
+		blockDepth.clear();
+		tileDepth.clear();
+		chunks.clear();
+	}
+
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	// RGBA8, R in the lowest byte, bottom row first.
+	const uint32_t* colorBuffer() const { return color.data(); }
+	const float* depthBuffer() const { return depth.data(); }
+
+	// Coarse depth rejection before shading, on by default. Off, every covered fragment goes
+	// through the per-pixel depth test (for comparison; the image is the same).
+	void setHierarchicalDepth(bool enabled) { hierarchicalDepth = enabled; }
+
+	// glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT), one tile per task.
+	void clear(const glm::vec4& clearColor = glm::vec4(0.0f), float clearDepth = 1.0f) {
+		uint32_t packed = pack(clearColor);
+		pool->run((size_t)tilesX * tilesY, [&](size_t tile, unsigned int) {
+			int x0, y0, x1, y1;
+			tileRect(tile, x0, y0, x1, y1);
+			for (int y = y0; y < y1; y++) {
+				std::fill(&color[(size_t)y * width + x0], &color[(size_t)y * width + x1], packed);
+				std::fill(&depth[(size_t)y * width + x0], &depth[(size_t)y * width + x1], clearDepth);
+			}
+			tileDepth[tile] = DepthBounds{clearDepth, clearDepth, false};
+			for (int by = y0 / HIZ_BLOCK; by * HIZ_BLOCK < y1; by++) {
+				for (int bx = x0 / HIZ_BLOCK; bx * HIZ_BLOCK < x1; bx++) {
+					blockDepth[(size_t)by * blocksX + bx] = DepthBounds{clearDepth, clearDepth, false};
+				}
+			}
+		});
+	}
+
+	// glDrawElements(GL_TRIANGLES, ...).
+	// vertexShader(vertexArray, index, position, varyings) writes gl_Position and the varyings;
+	// fragmentShader(varyings) returns the fragment colour.
+	template <typename VertexShader, typename FragmentShader>
+	void drawElements(const SoftwareVertexArray& vertexArray, VertexShader vertexShader, FragmentShader fragmentShader) {
+		draw(vertexArray, vertexShader, [&](const RasterSpan& span) { return shadeSpan(span, fragmentShader); });
+	}
+
+	// Same, with the fragment stage done by a span kernel.
+	template <typename VertexShader>
+	void drawElements(const SoftwareVertexArray& vertexArray, VertexShader vertexShader, const SpanKernel& kernel) {
+		if (kernel.varyings != VARYINGS) {
+			std::printf("SoftwareRasterizer: span kernel expects %d varyings, not %d\n", kernel.varyings, VARYINGS);
+			return;
+		}
+		draw(vertexArray, vertexShader, [&](const RasterSpan& span) { return kernel.shade(span, kernel.uniforms); });
+	}
+
+	RasterStats endFrame() {
+		RasterStats finished;
+		for (WorkerStats& worker : workerStats) {
+			finished.add(worker.stats);
+			worker.stats = RasterStats();
+		}
+		return finished;
+	}
+
+private:
+	// spanShader(span) runs the fragment stage for one span and returns the fragments shaded.
+	template <typename VertexShader, typename SpanShader>
+	void draw(const SoftwareVertexArray& vertexArray, VertexShader vertexShader, SpanShader spanShader) {
+		const size_t triangleCount = vertexArray.indexCount / 3;
+		if (triangleCount == 0) return;
+		RasterStats& frame = workerStats[0].stats;
+		frame.vertices += vertexArray.vertices;
+		frame.triangles += triangleCount;
+
+		// Vertex stage
+		auto start = std::chrono::steady_clock::now();
+		shaded.resize(vertexArray.vertices);
+		const size_t VERTEX_BLOCK = 1024;
+		pool->run((vertexArray.vertices + VERTEX_BLOCK - 1) / VERTEX_BLOCK, [&](size_t block, unsigned int) {
+			size_t end = std::min(vertexArray.vertices, (block + 1) * VERTEX_BLOCK);
+			for (size_t v = block * VERTEX_BLOCK; v < end; v++) {
+				vertexShader(vertexArray, (uint32_t)v, shaded[v].position, shaded[v].varyings);
+			}
+		});
+		frame.vertexMilliseconds += millisecondsSince(start);
+
+		// Setup and binning: contiguous triangle ranges, so walking the chunks in order
+		// keeps the submission order within every tile.
+		start = std::chrono::steady_clock::now();
+		const size_t CHUNK_TRIANGLES = 256;
+		size_t chunkCount = std::min<size_t>((triangleCount + CHUNK_TRIANGLES - 1) / CHUNK_TRIANGLES, pool->threadCount() * 4);
+		if (chunks.size() < chunkCount) chunks.resize(chunkCount);
+		const size_t tileCount = (size_t)tilesX * tilesY;
+		pool->run(chunkCount, [&](size_t c, unsigned int worker) {
+			Chunk& chunk = chunks[c];
+			chunk.triangles.clear();
+			chunk.bins.resize(tileCount);
+			for (std::vector<uint32_t>& bin : chunk.bins) bin.clear();
+			size_t begin = triangleCount * c / chunkCount, end = triangleCount * (c + 1) / chunkCount;
+			for (size_t t = begin; t < end; t++) {
+				const uint32_t* index = &vertexArray.indices[t * 3];
+				assemble(shaded[index[0]], shaded[index[1]], shaded[index[2]], chunk, workerStats[worker].stats);
+			}
+		});
+		frame.binMilliseconds += millisecondsSince(start);
+
+		// Raster stage
+		start = std::chrono::steady_clock::now();
+		pool->run(tileCount, [&](size_t tile, unsigned int worker) {
+			RasterStats& stats = workerStats[worker].stats;
+			int x0, y0, x1, y1;
+			tileRect(tile, x0, y0, x1, y1);
+			for (size_t c = 0; c < chunkCount; c++) {
+				const Chunk& chunk = chunks[c];
+				for (uint32_t t : chunk.bins[tile]) {
+					rasterize(chunk.triangles[t], tile, x0, y0, x1, y1, spanShader, stats);
+				}
+			}
+		});
+		frame.rasterMilliseconds += millisecondsSince(start);
+	}
+
+	// A triangle after setup. Edge i is the one opposite vertex i; E(x, y) = a*x + b*y + c in
+	// subpixel units is >= 0 inside (the fill rule is folded into c).
+	// Everything that's interpolated is a plane over pixel coordinates, anchored at the
+	// bounding box's first pixel: value(x, y) = origin + dx * (x - minX) + dy * (y - minY).
+	struct Plane {
+		float origin, dx, dy;
+	};
+	struct Triangle {
+		int64_t a[3], b[3], c[3];
+		int minX, minY, maxX, maxY;   // covered pixels, inclusive
+		Plane z;                      // window depth (linear in screen space)
+		Plane inverseW;
+		// varying/w, one plane per varying, kept as separate arrays for the span kernels
+		float varyingOrigin[VARYINGS], varyingDx[VARYINGS], varyingDy[VARYINGS];
+	};
+
+	struct Chunk {
+		std::vector<Triangle> triangles;
+		std::vector<std::vector<uint32_t>> bins; // per tile: indices into triangles
+	};
+
+	// Depth bounds of a tile or block: every stored depth is in [zMin, zMax]. Depths only
+	// decrease under GL_LESS, so a zMax that is too large is still a bound; dirty marks one
+	// that may have become loose, and it's recomputed only when a tighter one could cull.
+	struct DepthBounds {
+		float zMin, zMax;
+		bool dirty;
+	};
+	// Slack for the difference between a plane evaluated at a corner here and per pixel in
+	// the span shader, so a coarse test never rejects a fragment the depth test would pass.
+	static constexpr float DEPTH_SLACK = 1.0f / (1 << 20);
+
+	struct alignas(64) WorkerStats {
+		RasterStats stats;
+	};
+
+	static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	static uint32_t pack(const glm::vec4& c) {
+		glm::vec4 v = glm::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f;
+		return (uint32_t)(int)v.r | (uint32_t)(int)v.g << 8 | (uint32_t)(int)v.b << 16 | (uint32_t)(int)v.a << 24;
+	}
+
+	void tileRect(size_t tile, int& x0, int& y0, int& x1, int& y1) const {
+		x0 = (int)(tile % tilesX) * TILE_SIZE;
+		y0 = (int)(tile / tilesX) * TILE_SIZE;
+		x1 = std::min(x0 + TILE_SIZE, width);
+		y1 = std::min(y0 + TILE_SIZE, height);
+	}
+
+	// Signed distance to clip plane p: near, far, left, right, bottom, top (guard band).
+	float planeDistance(const glm::vec4& v, int p) const {
+		switch (p) {
+		case 0: return v.z + v.w;
+		case 1: return v.w - v.z;
+		case 2: return v.x + guardX() * v.w;
+		case 3: return guardX() * v.w - v.x;
+		case 4: return v.y + guardY() * v.w;
+		default: return guardY() * v.w - v.y;
+		}
+	}
+	float guardX() const { return 1.0f + GUARD_BAND_PIXELS / (0.5f * width); }
+	float guardY() const { return 1.0f + GUARD_BAND_PIXELS / (0.5f * height); }
+
+	void assemble(const Vertex& v0, const Vertex& v1, const Vertex& v2, Chunk& chunk, RasterStats& stats) {
+		const Vertex* corners[3] = {&v0, &v1, &v2};
+		unsigned int outside[3] = {0, 0, 0};
+		for (int i = 0; i < 3; i++) {
+			for (int p = 0; p < 6; p++) {
+				if (planeDistance(corners[i]->position, p) < 0.0f) outside[i] |= 1u << p;
+			}
+		}
+		if (outside[0] & outside[1] & outside[2]) {
+			stats.rejected++;
+			return;
+		}
+		if ((outside[0] | outside[1] | outside[2]) == 0) {
+			setup(v0, v1, v2, chunk, stats);
+			return;
+		}
+
+		// Sutherland-Hodgman against the planes the triangle crosses, then a fan.
+		stats.clipped++;
+		Vertex polygon[2][9];
+		int count = 3;
+		for (int i = 0; i < 3; i++) polygon[0][i] = *corners[i];
+		int current = 0;
+		unsigned int crossed = outside[0] | outside[1] | outside[2];
+		for (int p = 0; p < 6 && count > 0; p++) {
+			if (!(crossed & (1u << p))) continue;
+			const Vertex* in = polygon[current];
+			Vertex* out = polygon[current ^ 1];
+			int outCount = 0;
+			for (int i = 0; i < count; i++) {
+				const Vertex& a = in[i];
+				const Vertex& b = in[(i + 1) % count];
+				float da = planeDistance(a.position, p), db = planeDistance(b.position, p);
+				if (da >= 0.0f) out[outCount++] = a;
+				if ((da >= 0.0f) != (db >= 0.0f)) {
+					float t = da / (da - db);
+					Vertex& v = out[outCount++];
+					v.position = a.position + (b.position - a.position) * t;
+					for (int k = 0; k < VARYINGS; k++) v.varyings[k] = a.varyings[k] + (b.varyings[k] - a.varyings[k]) * t;
+				}
+			}
+			count = outCount;
+			current ^= 1;
+		}
+		for (int i = 1; i + 1 < count; i++) {
+			setup(polygon[current][0], polygon[current][i], polygon[current][i + 1], chunk, stats);
+		}
+	}
+
+	void setup(const Vertex& v0, const Vertex& v1, const Vertex& v2, Chunk& chunk, RasterStats& stats) {
+		const Vertex* corners[3] = {&v0, &v1, &v2};
+		const float scale = (float)(1 << SUBPIXEL_BITS);
+		int64_t X[3], Y[3];
+		float z[3], inverseW[3];
+		for (int i = 0; i < 3; i++) {
+			const glm::vec4& p = corners[i]->position;
+			inverseW[i] = 1.0f / p.w;
+			// Viewport transform, then snap to the subpixel grid
+			X[i] = (int64_t)std::lround((p.x * inverseW[i] * 0.5f + 0.5f) * width * scale);
+			Y[i] = (int64_t)std::lround((p.y * inverseW[i] * 0.5f + 0.5f) * height * scale);
+			z[i] = p.z * inverseW[i] * 0.5f + 0.5f;
+		}
+
+		int64_t area = (X[1] - X[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (X[2] - X[0]);
+		if (area == 0) {
+			stats.rejected++;
+			return;
+		}
+		// No face culling: clockwise triangles are flipped to counter-clockwise.
+		int order[3] = {0, 1, 2};
+		if (area < 0) {
+			std::swap(order[1], order[2]);
+			area = -area;
+		}
+
+		Triangle triangle;
+		int64_t minX = INT64_MAX, minY = INT64_MAX, maxX = INT64_MIN, maxY = INT64_MIN;
+		for (int i = 0; i < 3; i++) {
+			minX = std::min(minX, X[i]);
+			maxX = std::max(maxX, X[i]);
+			minY = std::min(minY, Y[i]);
+			maxY = std::max(maxY, Y[i]);
+		}
+		for (int i = 0; i < 3; i++) {
+			// Edge i runs from vertex i+1 to vertex i+2.
+			int from = order[(i + 1) % 3], to = order[(i + 2) % 3];
+			int64_t a = Y[from] - Y[to], b = X[to] - X[from];
+			int64_t c = X[from] * Y[to] - Y[from] * X[to];
+			// Top-left rule: a pixel centre exactly on an edge belongs to one of the two
+			// triangles sharing it. The shared edge has (a, b) negated in the neighbour.
+			bool inclusive = a > 0 || (a == 0 && b > 0);
+			triangle.a[i] = a;
+			triangle.b[i] = b;
+			triangle.c[i] = inclusive ? c : c - 1;
+		}
+
+		// Pixel centres are at (x + 0.5, y + 0.5).
+		const int64_t half = 1 << (SUBPIXEL_BITS - 1);
+		triangle.minX = std::max<int>(0, (int)((minX - half + (1 << SUBPIXEL_BITS) - 1) >> SUBPIXEL_BITS));
+		triangle.minY = std::max<int>(0, (int)((minY - half + (1 << SUBPIXEL_BITS) - 1) >> SUBPIXEL_BITS));
+		triangle.maxX = std::min<int>(width - 1, (int)((maxX - half) >> SUBPIXEL_BITS));
+		triangle.maxY = std::min<int>(height - 1, (int)((maxY - half) >> SUBPIXEL_BITS));
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY) {
+			stats.rejected++;
+			return;
+		}
+
+		// Barycentric weight of vertex i is E_i / area; its value at the anchor pixel and its
+		// per-pixel steps turn every attribute into a plane.
+		const double inverseArea = 1.0 / (double)area;
+		const int64_t anchorX = ((int64_t)triangle.minX << SUBPIXEL_BITS) + half;
+		const int64_t anchorY = ((int64_t)triangle.minY << SUBPIXEL_BITS) + half;
+		double weight[3], weightDx[3], weightDy[3];
+		for (int i = 0; i < 3; i++) {
+			// c without the fill rule bias
+			int64_t c = triangle.c[i] + ((triangle.a[i] > 0 || (triangle.a[i] == 0 && triangle.b[i] > 0)) ? 0 : 1);
+			weight[i] = (double)(triangle.a[i] * anchorX + triangle.b[i] * anchorY + c) * inverseArea;
+			weightDx[i] = (double)(triangle.a[i] * (1 << SUBPIXEL_BITS)) * inverseArea;
+			weightDy[i] = (double)(triangle.b[i] * (1 << SUBPIXEL_BITS)) * inverseArea;
+		}
+		auto plane = [&](float v0, float v1, float v2) {
+			const float v[3] = {v0, v1, v2};
+			double origin = 0.0, dx = 0.0, dy = 0.0;
+			for (int i = 0; i < 3; i++) {
+				origin += weight[i] * v[order[i]];
+				dx += weightDx[i] * v[order[i]];
+				dy += weightDy[i] * v[order[i]];
+			}
+			return Plane{(float)origin, (float)dx, (float)dy};
+		};
+		triangle.z = plane(z[0], z[1], z[2]);
+		triangle.inverseW = plane(inverseW[0], inverseW[1], inverseW[2]);
+		for (int k = 0; k < VARYINGS; k++) {
+			Plane varying = plane(v0.varyings[k] * inverseW[0], v1.varyings[k] * inverseW[1], v2.varyings[k] * inverseW[2]);
+			triangle.varyingOrigin[k] = varying.origin;
+			triangle.varyingDx[k] = varying.dx;
+			triangle.varyingDy[k] = varying.dy;
+		}
+
+		uint32_t index = (uint32_t)chunk.triangles.size();
+		chunk.triangles.push_back(triangle);
+		for (int ty = triangle.minY / TILE_SIZE; ty <= triangle.maxY / TILE_SIZE; ty++) {
+			for (int tx = triangle.minX / TILE_SIZE; tx <= triangle.maxX / TILE_SIZE; tx++) {
+				if (!touchesTile(triangle, tx, ty)) continue;
+				chunk.bins[(size_t)ty * tilesX + tx].push_back(index);
+				stats.binned++;
+			}
+		}
+	}
+
+	// False if one edge has the whole tile (its pixel centres) outside.
+	bool touchesTile(const Triangle& triangle, int tx, int ty) const {
+		const int64_t half = 1 << (SUBPIXEL_BITS - 1);
+		int64_t x0 = ((int64_t)tx * TILE_SIZE << SUBPIXEL_BITS) + half;
+		int64_t y0 = ((int64_t)ty * TILE_SIZE << SUBPIXEL_BITS) + half;
+		int64_t size = (int64_t)(TILE_SIZE - 1) << SUBPIXEL_BITS;
+		for (int i = 0; i < 3; i++) {
+			// The tile corner furthest along the edge normal
+			int64_t x = triangle.a[i] > 0 ? x0 + size : x0;
+			int64_t y = triangle.b[i] > 0 ? y0 + size : y0;
+			if (triangle.a[i] * x + triangle.b[i] * y + triangle.c[i] < 0) return false;
+		}
+		return true;
+	}
+
+	// Covered pixels of row y within [x0, x1]: solves E_i(x) >= 0 for each edge.
+	static bool rowSpan(const Triangle& triangle, int x0, int x1, int y, int& begin, int& end) {
+		const int64_t half = 1 << (SUBPIXEL_BITS - 1);
+		const int64_t px = ((int64_t)x0 << SUBPIXEL_BITS) + half;
+		const int64_t py = ((int64_t)y << SUBPIXEL_BITS) + half;
+		begin = x0;
+		end = x1;
+		for (int i = 0; i < 3; i++) {
+			int64_t e = triangle.a[i] * px + triangle.b[i] * py + triangle.c[i];
+			int64_t step = triangle.a[i] * (1 << SUBPIXEL_BITS);
+			if (step > 0) {
+				if (e < 0) begin = (int)std::max<int64_t>(begin, x0 + (-e + step - 1) / step);
+			} else if (step < 0) {
+				if (e < 0) end = -1;
+				else end = (int)std::min<int64_t>(end, x0 + e / -step);
+			} else if (e < 0) {
+				end = -1;
+			}
+		}
+		return begin <= end;
+	}
+
+	// True if every pixel centre of [x0, x1] x [y0, y1] is inside the triangle.
+	static bool coversRect(const Triangle& triangle, int x0, int y0, int x1, int y1) {
+		const int64_t half = 1 << (SUBPIXEL_BITS - 1);
+		const int64_t left = ((int64_t)x0 << SUBPIXEL_BITS) + half, right = ((int64_t)x1 << SUBPIXEL_BITS) + half;
+		const int64_t bottom = ((int64_t)y0 << SUBPIXEL_BITS) + half, top = ((int64_t)y1 << SUBPIXEL_BITS) + half;
+		for (int i = 0; i < 3; i++) {
+			// The corner furthest against the edge normal
+			int64_t x = triangle.a[i] > 0 ? left : right;
+			int64_t y = triangle.b[i] > 0 ? bottom : top;
+			if (triangle.a[i] * x + triangle.b[i] * y + triangle.c[i] < 0) return false;
+		}
+		return true;
+	}
+
+	// The triangle's depth plane over the pixels [x0, x1] x [y0, y1], widened by DEPTH_SLACK.
+	static void depthRange(const Triangle& triangle, int x0, int y0, int x1, int y1, float& zNear, float& zFar) {
+		float ax = triangle.z.dx * (float)(x0 - triangle.minX), bx = triangle.z.dx * (float)(x1 - triangle.minX);
+		float ay = triangle.z.dy * (float)(y0 - triangle.minY), by = triangle.z.dy * (float)(y1 - triangle.minY);
+		zNear = triangle.z.origin + std::min(ax, bx) + std::min(ay, by) - DEPTH_SLACK;
+		zFar = triangle.z.origin + std::max(ax, bx) + std::max(ay, by) + DEPTH_SLACK;
+	}
+
+	// GL_LESS fails for anything at zNear or further if bounds.zMax <= zNear.
+	template <typename Refresh>
+	static bool occluded(DepthBounds& bounds, float zNear, Refresh refresh) {
+		if (zNear >= bounds.zMax) return true;
+		if (!bounds.dirty) return false;
+		refresh(bounds);
+		bounds.dirty = false;
+		return zNear >= bounds.zMax;
+	}
+
+	void refreshBlock(DepthBounds& bounds, int bx, int by) const {
+		const int x0 = bx * HIZ_BLOCK, x1 = std::min(x0 + HIZ_BLOCK, width);
+		const int y0 = by * HIZ_BLOCK, y1 = std::min(y0 + HIZ_BLOCK, height);
+		float zMin = depth[(size_t)y0 * width + x0], zMax = zMin;
+		for (int y = y0; y < y1; y++) {
+			for (int x = x0; x < x1; x++) {
+				float z = depth[(size_t)y * width + x];
+				zMin = std::min(zMin, z);
+				zMax = std::max(zMax, z);
+			}
+		}
+		bounds.zMin = zMin;
+		bounds.zMax = zMax;
+	}
+
+	// Tile bounds come from its blocks' (possibly loose) bounds, not from the depth buffer.
+	void refreshTile(DepthBounds& bounds, int x0, int y0, int x1, int y1) const {
+		float zMin = 1e30f, zMax = -1e30f;
+		for (int by = y0 / HIZ_BLOCK; by * HIZ_BLOCK < y1; by++) {
+			for (int bx = x0 / HIZ_BLOCK; bx * HIZ_BLOCK < x1; bx++) {
+				const DepthBounds& block = blockDepth[(size_t)by * blocksX + bx];
+				zMin = std::min(zMin, block.zMin);
+				zMax = std::max(zMax, block.zMax);
+			}
+		}
+		bounds.zMin = zMin;
+		bounds.zMax = zMax;
+	}
+
+	template <typename SpanShader>
+	void rasterize(const Triangle& triangle, size_t tile, int tileX0, int tileY0, int tileX1, int tileY1,
+		SpanShader& spanShader, RasterStats& stats) {
+		const int x0 = std::max(tileX0, triangle.minX), x1 = std::min(tileX1 - 1, triangle.maxX);
+		const int y0 = std::max(tileY0, triangle.minY), y1 = std::min(tileY1 - 1, triangle.maxY);
+		int begin, end;
+
+		// Whole tile behind what's already there: count the coverage, shade nothing.
+		float zNear, zFar;
+		if (hierarchicalDepth) {
+			depthRange(triangle, x0, y0, x1, y1, zNear, zFar);
+			if (occluded(tileDepth[tile], zNear, [&](DepthBounds& bounds) { refreshTile(bounds, tileX0, tileY0, tileX1, tileY1); })) {
+				for (int y = y0; y <= y1; y++) {
+					if (rowSpan(triangle, x0, x1, y, begin, end)) {
+						stats.fragments += end - begin + 1;
+						stats.culled += end - begin + 1;
+					}
+				}
+				return;
+			}
+		}
+
+		// Rows are walked a band of blocks at a time. Each block column of the band gets an
+		// occlusion bit up front; spans are cut at block edges and occluded pieces skipped.
+		const int blockX0 = x0 / HIZ_BLOCK, blockX1 = x1 / HIZ_BLOCK;
+		for (int bandY0 = y0; bandY0 <= y1;) {
+			const int by = bandY0 / HIZ_BLOCK;
+			const int bandY1 = std::min(y1, by * HIZ_BLOCK + HIZ_BLOCK - 1);
+			uint32_t occludedBlocks = 0, touchedBlocks = 0;
+			if (hierarchicalDepth) {
+				for (int bx = blockX0; bx <= blockX1; bx++) {
+					depthRange(triangle, std::max(x0, bx * HIZ_BLOCK), bandY0, std::min(x1, bx * HIZ_BLOCK + HIZ_BLOCK - 1), bandY1, zNear, zFar);
+					DepthBounds& bounds = blockDepth[(size_t)by * blocksX + bx];
+					auto refresh = [&](DepthBounds& b) {
+						refreshBlock(b, bx, by);
+						tileDepth[tile].dirty = true; // may tighten too
+					};
+					if (occluded(bounds, zNear, refresh)) {
+						occludedBlocks |= 1u << (bx - blockX0);
+					}
+				}
+			}
+
+			for (int y = bandY0; y <= bandY1; y++) {
+				if (!rowSpan(triangle, x0, x1, y, begin, end)) continue;
+				stats.fragments += end - begin + 1;
+				for (int pieceBegin = begin; pieceBegin <= end;) {
+					// Extend the piece over neighbouring blocks in the same state
+					const int bit = pieceBegin / HIZ_BLOCK - blockX0;
+					const bool skip = (occludedBlocks >> bit) & 1;
+					int pieceEnd = std::min(end, (pieceBegin / HIZ_BLOCK) * HIZ_BLOCK + HIZ_BLOCK - 1);
+					while (pieceEnd < end && (((occludedBlocks >> ((pieceEnd + 1) / HIZ_BLOCK - blockX0)) & 1) != 0) == skip) {
+						pieceEnd = std::min(end, pieceEnd + HIZ_BLOCK);
+					}
+					if (skip) {
+						stats.culled += pieceEnd - pieceBegin + 1;
+					} else {
+						for (int bx = pieceBegin / HIZ_BLOCK; bx <= pieceEnd / HIZ_BLOCK; bx++) touchedBlocks |= 1u << (bx - blockX0);
+						stats.shaded += shadeRow(triangle, y, pieceBegin, pieceEnd, spanShader);
+					}
+					pieceBegin = pieceEnd + 1;
+				}
+			}
+
+			// Depths only went down where this triangle was shaded. A block it covers entirely
+			// and lies in front of everywhere now holds exactly its plane; other blocks only
+			// get a lower zMin, and their zMax is tightened lazily.
+			if (hierarchicalDepth && touchedBlocks) {
+				DepthBounds& tileBounds = tileDepth[tile];
+				for (int bx = blockX0; bx <= blockX1; bx++) {
+					if (!((touchedBlocks >> (bx - blockX0)) & 1)) continue;
+					DepthBounds& bounds = blockDepth[(size_t)by * blocksX + bx];
+					const int rectX0 = bx * HIZ_BLOCK, rectY0 = by * HIZ_BLOCK;
+					const int rectX1 = std::min(rectX0 + HIZ_BLOCK, width) - 1, rectY1 = std::min(rectY0 + HIZ_BLOCK, height) - 1;
+					if (coversRect(triangle, rectX0, rectY0, rectX1, rectY1)) {
+						depthRange(triangle, rectX0, rectY0, rectX1, rectY1, zNear, zFar);
+						if (zFar < bounds.zMin) {
+							bounds = DepthBounds{zNear, zFar, false};
+							tileBounds.zMin = std::min(tileBounds.zMin, zNear);
+							continue;
+						}
+					} else {
+						depthRange(triangle, std::max(x0, rectX0), bandY0, std::min(x1, rectX1), bandY1, zNear, zFar);
+					}
+					bounds.zMin = std::min(bounds.zMin, zNear);
+					bounds.dirty = true;
+					tileBounds.zMin = std::min(tileBounds.zMin, zNear);
+				}
+				tileBounds.dirty = true;
+			}
+			bandY0 = bandY1 + 1;
+		}
+	}
+
+	// Sets up the span [begin, end] of row y and runs the fragment stage on it.
+	template <typename SpanShader>
+	size_t shadeRow(const Triangle& triangle, int y, int begin, int end, SpanShader& spanShader) {
+		// Planes at the first pixel of the span
+		const float fx = (float)(begin - triangle.minX), fy = (float)(y - triangle.minY);
+		float varyingsOverW[VARYINGS];
+		for (int k = 0; k < VARYINGS; k++) {
+			varyingsOverW[k] = triangle.varyingOrigin[k] + triangle.varyingDx[k] * fx + triangle.varyingDy[k] * fy;
+		}
+		RasterSpan span;
+		span.begin = begin;
+		span.end = end;
+		// Depth is evaluated per pixel rather than accumulated along the span, so its
+		// rounding error doesn't grow with the span length.
+		span.zOriginX = triangle.minX;
+		span.zRow = triangle.z.origin + triangle.z.dy * fy;
+		span.zDx = triangle.z.dx;
+		span.inverseW = triangle.inverseW.origin + triangle.inverseW.dx * fx + triangle.inverseW.dy * fy;
+		span.inverseWDx = triangle.inverseW.dx;
+		span.varyingsOverW = varyingsOverW;
+		span.varyingsOverWDx = triangle.varyingDx;
+		span.depthRow = &depth[(size_t)y * width];
+		span.colorRow = &color[(size_t)y * width];
+		return spanShader(span);
+	}
+
+	// The fragment stage for a per-fragment callable, one pixel at a time.
+	template <typename FragmentShader>
+	static size_t shadeSpan(const RasterSpan& span, FragmentShader& fragmentShader) {
+		size_t shadedCount = 0;
+		float inverseW = span.inverseW;
+		float varyingsOverW[VARYINGS];
+		for (int k = 0; k < VARYINGS; k++) varyingsOverW[k] = span.varyingsOverW[k];
+		for (int x = span.begin; x <= span.end; x++) {
+			float z = span.zRow + span.zDx * (float)(x - span.zOriginX);
+			if (z < span.depthRow[x]) { // GL_LESS
+				span.depthRow[x] = z;
+				shadedCount++;
+				float w = 1.0f / inverseW;
+				float varyings[VARYINGS];
+				for (int k = 0; k < VARYINGS; k++) varyings[k] = varyingsOverW[k] * w;
+				span.colorRow[x] = pack(fragmentShader((const float*)varyings));
+			}
+			inverseW += span.inverseWDx;
+			for (int k = 0; k < VARYINGS; k++) varyingsOverW[k] += span.varyingsOverWDx[k];
+		}
+		return shadedCount;
+	}
+
+	int width = 0;
+	int height = 0;
+	int tilesX = 0;
+	int tilesY = 0;
+	TaskPool* pool = nullptr;
+	std::vector<uint32_t> color;
+	std::vector<float> depth;
+	int blocksX = 0;
+	int blocksY = 0;
+	bool hierarchicalDepth = true;
+	std::vector<DepthBounds> blockDepth; // blocksX * blocksY
+	std::vector<DepthBounds> tileDepth;  // tilesX * tilesY
+	std::vector<Vertex> shaded;
+	std::vector<Chunk> chunks;
+	std::vector<WorkerStats> workerStats;
+};
@@ -0,0 +1,170 @@
+#pragma once
+// Work-stealing task pool
+// run(count, body) executes body(task, worker) for every task in [0, count) on a set of
+// persistent threads, the calling thread included, and returns when all of them are done.
+// Each worker starts with a contiguous block of the tasks in its own queue and takes them
+// from the front; a worker whose queue runs dry steals from the back of another one. Uneven
+// tasks (e.g. screen tiles with very different triangle counts) therefore balance out without
+// a shared counter that every task has to go through.
+// The threads live as long as the pool, so it can be run every frame.
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+inline unsigned int defaultThreadCount() {
+	unsigned int threads = std::thread::hardware_concurrency();
+	return threads > 0 ? threads : 1;
+}
+
+struct TaskPoolStats {
+	unsigned int runs = 0;
+	size_t tasks = 0;
+	size_t steals = 0;
+
+	void print(const char* label) const {
+		std::printf("%s: %u runs, %zu tasks, %zu stolen\n", label, runs, tasks, steals);
+	}
+};
+
+class TaskPool {
+public:
+	typedef std::function<void(size_t task, unsigned int worker)> Body;
+
+	TaskPool() = default;
+	TaskPool(const TaskPool&) = delete;
+	TaskPool& operator=(const TaskPool&) = delete;
+	~TaskPool() { destroy(); }
+
+	// threads counts the calling thread; 0 means one per hardware thread.
+	void create(unsigned int threads = 0) {
+		if (threads == 0) threads = defaultThreadCount();
+		queues.clear();
+		for (unsigned int i = 0; i < threads; i++) queues.emplace_back(new Queue());
+		stopping = false;
+		for (unsigned int i = 1; i < threads; i++) workers.emplace_back([this, i]() { workerLoop(i); });
+	}
+
+	void destroy() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		start.notify_all();
+		for (std::thread& worker : workers) worker.join();
+		workers.clear();
+		queues.clear();
+	}
+
+	unsigned int threadCount() const { return (unsigned int)queues.size(); }
+
+	void run(size_t count, const Body& taskBody) {
+		if (count == 0) return;
+		stats.runs++;
+		stats.tasks += count;
+		if (queues.size() <= 1 || count == 1) {
+			for (size_t task = 0; task < count; task++) taskBody(task, 0);
+			return;
+		}
+
+		body = &taskBody;
+		remaining.store(count);
+		size_t workerCount = queues.size();
+		for (size_t w = 0; w < workerCount; w++) {
+			std::lock_guard<std::mutex> lock(queues[w]->mutex);
+			for (size_t task = count * w / workerCount; task < count * (w + 1) / workerCount; task++) {
+				queues[w]->tasks.push_back(task);
+			}
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			generation++;
+		}
+		start.notify_all();
+
+		work(0);
+		std::unique_lock<std::mutex> lock(mutex);
+		done.wait(lock, [&]() { return remaining.load() == 0; });
+		body = nullptr;
+	}
+
+	TaskPoolStats endFrame() {
+		TaskPoolStats finished = stats;
+		finished.steals = steals.exchange(0);
+		stats = TaskPoolStats();
+		return finished;
+	}
+
+private:
+	struct Queue {
+		std::mutex mutex;
+		std::deque<size_t> tasks;
+	};
+
+	bool pop(unsigned int worker, size_t& task) {
+		Queue& own = *queues[worker];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (own.tasks.empty()) return false;
+		task = own.tasks.front();
+		own.tasks.pop_front();
+		return true;
+	}
+
+	bool steal(unsigned int worker, size_t& task) {
+		for (size_t k = 1; k < queues.size(); k++) {
+			Queue& victim = *queues[(worker + k) % queues.size()];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (victim.tasks.empty()) continue;
+			task = victim.tasks.back();
+			victim.tasks.pop_back();
+			steals++;
+			return true;
+		}
+		return false;
+	}
+
+	// Runs tasks until every queue is empty.
+	void work(unsigned int worker) {
+		size_t task;
+		while (pop(worker, task) || steal(worker, task)) {
+			(*body)(task, worker);
+			if (remaining.fetch_sub(1) == 1) {
+				std::lock_guard<std::mutex> lock(mutex);
+				done.notify_all();
+			}
+		}
+	}
+
+	void workerLoop(unsigned int worker) {
+		uint64_t seen = 0;
+		for (;;) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				start.wait(lock, [&]() { return stopping || generation != seen; });
+				if (stopping) return;
+				seen = generation;
+			}
+			work(worker);
+		}
+	}
+
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread> workers;
+	const Body* body = nullptr;       // set before any task is queued, cleared after the last one
+	std::atomic<size_t> remaining{0};
+	std::atomic<size_t> steals{0};
+	TaskPoolStats stats;
+
+	std::mutex mutex;
+	std::condition_variable start;    // workers: a run began or we're stopping
+	std::condition_variable done;     // run(): the last task finished
+	uint64_t generation = 0;
+	bool stopping = false;
+};
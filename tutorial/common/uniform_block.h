@@ -0,0 +1,207 @@
+#pragma once
+// Uniform upload cache
+// UniformBlock<T> keeps a CPU shadow copy of a std140 uniform block. set() only
+// touches the shadow copy and widens a dirty byte range when the value really changed;
+// upload() sends that whole range with a single glBufferSubData.
+// stream() instead writes the whole block into a RingBuffer every frame and binds that
+// range, which never makes the driver wait for the GPU to finish with the previous values.
+// UniformShadow does the same compare-before-upload for the plain uniforms of one program.
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "ring_buffer.h"
+
+struct UniformUploadStats {
+	unsigned int sets = 0;       // set() calls
+	unsigned int redundant = 0;  // set() calls with an unchanged value
+	unsigned int uploads = 0;    // GL calls actually issued
+	size_t bytes = 0;            // bytes sent to GL
+
+	void add(const UniformUploadStats& other) {
+		sets += other.sets;
+		redundant += other.redundant;
+		uploads += other.uploads;
+		bytes += other.bytes;
+	}
+	void print(const char* label) const {
+		std::printf("%s: %u sets, %u unchanged, %u uploads, %zu bytes\n", label, sets, redundant, uploads, bytes);
+	}
+};
+
+// T must be laid out like the std140 block in the shader,
+// e.g. vec3 members need alignas(16) and a float may follow a vec3 directly.
+template <typename T>
+class UniformBlock {
+public:
+	UniformBlock() = default;
+	UniformBlock(const UniformBlock&) = delete;
+	UniformBlock& operator=(const UniformBlock&) = delete;
+	~UniformBlock() { destroy(); }
+
+	// Creates the buffer and attaches it to the given binding point.
+	void create(GLuint bindingPoint, const T& initial = T()) {
+		binding = bindingPoint;
+		shadow = initial;
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(T), &shadow, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+		markClean();
+	}
+
+	void destroy() {
+		if (buffer != 0) glDeleteBuffers(1, &buffer);
+		buffer = 0;
+	}
+
+	// Points the named block of a program at our binding point.
+	// Returns false if the program has no such block or its size doesn't match T.
+	bool attach(GLuint program, const char* blockName) const {
+		GLuint index = glGetUniformBlockIndex(program, blockName);
+		if (index == GL_INVALID_INDEX) return false;
+		glUniformBlockBinding(program, index, binding);
+
+		GLint size = 0;
+		glGetActiveUniformBlockiv(program, index, GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+		return size == (GLint)sizeof(T);
+	}
+
+	template <typename M>
+	void set(M T::*member, const M& value) {
+		M& current = shadow.*member;
+		stats.sets++;
+		if (std::memcmp(&current, &value, sizeof(M)) == 0) {
+			stats.redundant++;
+			return;
+		}
+		current = value;
+
+		size_t begin = (size_t)((const char*)&current - (const char*)&shadow);
+		size_t end = begin + sizeof(M);
+		if (dirtyBegin > begin) dirtyBegin = begin;
+		if (dirtyEnd < end) dirtyEnd = end;
+	}
+
+	const T& values() const { return shadow; }
+	bool dirty() const { return dirtyBegin < dirtyEnd; }
+
+	// Sends every changed byte in one call. Returns true if anything was uploaded.
+	// After stream() the buffer missed every streamed change and the binding points into the
+	// ring, so the whole block is sent and the buffer bound again.
+	bool upload() {
+		if (streamed) {
+			dirtyBegin = 0;
+			dirtyEnd = sizeof(T);
+		}
+		if (!dirty()) return false;
+		glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, dirtyBegin, dirtyEnd - dirtyBegin, (const char*)&shadow + dirtyBegin);
+		if (streamed) {
+			glBindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+			streamed = false;
+		}
+		stats.uploads++;
+		stats.bytes += dirtyEnd - dirtyBegin;
+		markClean();
+		return true;
+	}
+
+	// Copies the whole block into this frame's region of the ring and binds it there.
+	// Needed every frame once used: the range is recycled after RingBuffer::REGIONS frames.
+	// Returns false if the ring region is full; the block then goes through upload() and
+	// is bound from its own buffer again, so the shader never reads a recycled range.
+	bool stream(RingBuffer& ring) {
+		if (uniformAlignment == 0) uniformAlignment = RingBuffer::uniformAlignment();
+		RingAllocation allocation = ring.allocate(sizeof(T), uniformAlignment);
+		if (!allocation.data) {
+			upload();
+			return false;
+		}
+		std::memcpy(allocation.data, &shadow, sizeof(T));
+		ring.flush();
+		glBindBufferRange(GL_UNIFORM_BUFFER, binding, ring.handle(), allocation.offset, sizeof(T));
+		stats.uploads++;
+		stats.bytes += sizeof(T);
+		markClean();
+		streamed = true;
+		return true;
+	}
+
+	GLuint handle() const { return buffer; }
+
+	UniformUploadStats endFrame() {
+		UniformUploadStats finished = stats;
+		stats = UniformUploadStats();
+		return finished;
+	}
+
+private:
+	void markClean() {
+		dirtyBegin = sizeof(T);
+		dirtyEnd = 0;
+	}
+
+	T shadow;
+	GLuint buffer = 0;
+	GLuint binding = 0;
+	size_t uniformAlignment = 0;
+	bool streamed = false;  // the binding points into a ring, not at buffer
+	size_t dirtyBegin = sizeof(T);
+	size_t dirtyEnd = 0;
+	UniformUploadStats stats;
+};
+
+// Shadow copy of the default-block uniforms of one program.
+// The program must be current when a set*() call uploads.
+class UniformShadow {
+public:
+	explicit UniformShadow(GLuint program = 0) : program(program) {}
+
+	GLint location(const char* name) {
+		return glGetUniformLocation(program, name);
+	}
+
+	void setMat4(GLint location, const glm::mat4& value) {
+		if (changed(location, &value[0][0], 16)) glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
+	}
+	void setVec3(GLint location, const glm::vec3& value) {
+		if (changed(location, &value[0], 3)) glUniform3f(location, value.x, value.y, value.z);
+	}
+	void setFloat(GLint location, float value) {
+		if (changed(location, &value, 1)) glUniform1f(location, value);
+	}
+
+	UniformUploadStats endFrame() {
+		UniformUploadStats finished = stats;
+		stats = UniformUploadStats();
+		return finished;
+	}
+
+private:
+	bool changed(GLint location, const float* value, size_t count) {
+		stats.sets++;
+		if (location < 0) {
+			// Inactive uniforms are silently ignored by GL as well.
+			stats.redundant++;
+			return false;
+		}
+		std::vector<float>& current = values[location];
+		if (current.size() == count && std::memcmp(current.data(), value, count * sizeof(float)) == 0) {
+			stats.redundant++;
+			return false;
+		}
+		current.assign(value, value + count);
+		stats.uploads++;
+		stats.bytes += count * sizeof(float);
+		return true;
+	}
+
+	GLuint program;
+	std::unordered_map<GLint, std::vector<float>> values;
+	UniformUploadStats stats;
+};
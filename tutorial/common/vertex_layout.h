@@ -0,0 +1,167 @@
+#pragma once
+// Compile-time vertex layouts
+// A layout is a list of attributes, each naming its shader location, the vertex member it
+// reads from and the format it's stored in:
+//
+//	typedef VertexLayout<
+//		VertexAttribute<0, &MeshVertex::position, HalfFloat4>,
+//		VertexAttribute<1, &MeshVertex::color, Unorm4x8>,
+//		VertexAttribute<2, &MeshVertex::normal, Snorm3x10_1x2>
+//	> PackedLayout; // 16 bytes per vertex instead of 36
+//
+// Offsets and stride are computed at compile time; pack() interleaves vertices into that
+// layout and setup() issues the matching glVertexAttribPointer calls.
+// Quantized formats go through glm/gtc/packing.hpp and are expanded back to floats by the
+// vertex fetch (normalized), so the shader inputs stay vec3.
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "gl_state_cache.h"
+
+// ---- Attribute formats --------------------------------------------------------------
+// Each format says how a glm::vec3 is stored and how GL should read it back.
+
+struct Float3 {
+	typedef glm::vec3 Stored;
+	static constexpr GLint components = 3;
+	static constexpr GLenum type = GL_FLOAT;
+	static constexpr GLboolean normalized = GL_FALSE;
+	static Stored pack(const glm::vec3& v) { return v; }
+};
+
+// Half-float positions: 8 bytes. Only ~11 bits of mantissa, so keep models near unit
+// scale and place them with the Model matrix.
+struct HalfFloat4 {
+	typedef glm::uint64 Stored;
+	static constexpr GLint components = 4;
+	static constexpr GLenum type = GL_HALF_FLOAT;
+	static constexpr GLboolean normalized = GL_FALSE;
+	static Stored pack(const glm::vec3& v) { return glm::packHalf4x16(glm::vec4(v, 1.0f)); }
+};
+
+// Colours in [0, 1]: 4 bytes.
+struct Unorm4x8 {
+	typedef glm::uint32 Stored;
+	static constexpr GLint components = 4;
+	static constexpr GLenum type = GL_UNSIGNED_BYTE;
+	static constexpr GLboolean normalized = GL_TRUE;
+	static Stored pack(const glm::vec3& v) { return glm::packUnorm4x8(glm::vec4(v, 1.0f)); }
+};
+
+// Unit vectors, 10 bits per component: 4 bytes.
+struct Snorm3x10_1x2 {
+	typedef glm::uint32 Stored;
+	static constexpr GLint components = 4;
+	static constexpr GLenum type = GL_INT_2_10_10_10_REV;
+	static constexpr GLboolean normalized = GL_TRUE;
+	static Stored pack(const glm::vec3& v) { return glm::packSnorm3x10_1x2(glm::vec4(v, 0.0f)); }
+};
+
+// Unit vectors, octahedral encoding with 16 bits per component: 4 bytes, more precise
+// than Snorm3x10_1x2. The shader receives a vec2 and decodes it with OCTAHEDRAL_DECODE_GLSL.
+struct Octahedral2x16 {
+	typedef glm::uint32 Stored;
+	static constexpr GLint components = 2;
+	static constexpr GLenum type = GL_SHORT;
+	static constexpr GLboolean normalized = GL_TRUE;
+	static Stored pack(const glm::vec3& v) {
+		// Zero normals (degenerate triangles), NaNs and infinities become +Z: the decode needs
+		// a direction.
+		float length = glm::abs(v.x) + glm::abs(v.y) + glm::abs(v.z);
+		if (!(length > 0.0f) || !(length <= FLT_MAX)) return glm::packSnorm2x16(glm::vec2(0.0f));
+		glm::vec3 n = v / length;
+		glm::vec2 e(n.x, n.y);
+		if (n.z < 0.0f) {
+			// Fold the lower hemisphere over the diagonals
+			e = (1.0f - glm::abs(glm::vec2(n.y, n.x))) * glm::vec2(n.x >= 0.0f ? 1.0f : -1.0f, n.y >= 0.0f ? 1.0f : -1.0f);
+		}
+		return glm::packSnorm2x16(e);
+	}
+};
+
+const char* const OCTAHEDRAL_DECODE_GLSL = R"(
+	vec3 octahedralDecode(vec2 e) {
+		vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+		if (n.z < 0.0) n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+		return normalize(n);
+	}
+)";
+
+// ---- Layout -------------------------------------------------------------------------
+
+template <GLuint Location, auto Member, typename Format>
+struct VertexAttribute {
+	static constexpr GLuint location = Location;
+	typedef Format format;
+	static constexpr size_t size = sizeof(typename Format::Stored);
+	static_assert(size % 4 == 0, "vertex attributes must stay 4-byte aligned");
+
+	template <typename Vertex>
+	static void write(unsigned char* destination, const Vertex& vertex) {
+		typename Format::Stored stored = Format::pack(vertex.*Member);
+		std::memcpy(destination, &stored, size);
+	}
+};
+
+template <typename... Attributes>
+struct VertexLayout {
+	static constexpr size_t attributeCount = sizeof...(Attributes);
+	static constexpr size_t stride = (Attributes::size + ...);
+
+	// Byte offset of the i-th attribute.
+	static constexpr size_t offset(size_t i) {
+		const size_t sizes[] = {Attributes::size...};
+		size_t result = 0;
+		for (size_t k = 0; k < i; k++) result += sizes[k];
+		return result;
+	}
+
+	// Interleaves the vertices into this layout.
+	template <typename Vertex>
+	static std::vector<unsigned char> pack(const Vertex* vertices, size_t count) {
+		std::vector<unsigned char> data(count * stride);
+		for (size_t v = 0; v < count; v++) {
+			writeAll(&data[v * stride], vertices[v], std::index_sequence_for<Attributes...>());
+		}
+		return data;
+	}
+
+	// Attribute pointers for the buffer currently bound (through glState) to GL_ARRAY_BUFFER.
+	static void setup(GLStateCache& glState, size_t baseOffset = 0) {
+		setupAll(glState, baseOffset, std::index_sequence_for<Attributes...>());
+	}
+
+	// Separate format / binding setup (GL 4.3): the buffer is attached later with
+	// glBindVertexBuffer(bindingIndex, buffer, offset, stride).
+	static void setupFormat(GLuint bindingIndex) {
+		formatAll(bindingIndex, std::index_sequence_for<Attributes...>());
+	}
+
+private:
+	template <typename Vertex, size_t... I>
+	static void writeAll(unsigned char* destination, const Vertex& vertex, std::index_sequence<I...>) {
+		(Attributes::write(destination + offset(I), vertex), ...);
+	}
+
+	template <size_t... I>
+	static void setupAll(GLStateCache& glState, size_t baseOffset, std::index_sequence<I...>) {
+		((glState.enableVertexAttribArray(Attributes::location),
+		  glState.vertexAttribPointer(Attributes::location, Attributes::format::components, Attributes::format::type,
+			  Attributes::format::normalized, (GLsizei)stride, (void*)(baseOffset + offset(I)))), ...);
+	}
+
+	template <size_t... I>
+	static void formatAll(GLuint bindingIndex, std::index_sequence<I...>) {
+		((glEnableVertexAttribArray(Attributes::location),
+		  glVertexAttribFormat(Attributes::location, Attributes::format::components, Attributes::format::type,
+			  Attributes::format::normalized, (GLuint)offset(I)),
+		  glVertexAttribBinding(Attributes::location, bindingIndex)), ...);
+	}
+};
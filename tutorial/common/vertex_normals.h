@@ -0,0 +1,220 @@
+#pragma once
+// Vertex normal generation for indexed meshes
+// 1. Face pass: face normals for 4, 8 or 16 triangles at a time (SoA), in chunks of
+//    triangles on a TaskPool. The kernel is vertex_normals.inl, compiled and dispatched per
+//    instruction set like frustum_cull.h. Each face writes only its own slot, so no locking
+//    is needed.
+// 2. Vertex pass: every vertex sums the faces around it, found through a vertex -> corner
+//    table that is built once per topology. Again each vertex writes only its own result.
+// Area weighting uses the raw cross product (its length is twice the triangle area);
+// angle weighting uses the unit face normal times the corner angle.
+// Corner normals additionally split at creases: a corner only sums the faces around its
+// vertex whose normal is within the crease angle of its own face.
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "simd_dispatch.h"
+#include "task_pool.h"
+
+enum NormalWeighting {
+	NORMAL_WEIGHT_AREA,
+	NORMAL_WEIGHT_ANGLE,
+};
+
+struct NormalOptions {
+	NormalWeighting weighting = NORMAL_WEIGHT_AREA;
+	// Faces meeting at a larger angle than this don't share normals (corner normals only).
+	float creaseAngle = glm::pi<float>();
+};
+
+// Where the face pass writes; cornerAngle is null unless the weighting is by angle.
+struct NormalFaceStreams {
+	float* faceX;
+	float* faceY;
+	float* faceZ;
+	float* unitX;
+	float* unitY;
+	float* unitZ;
+	float* cornerAngle;
+};
+
+namespace vertex_normals_scalar {
+#include "vertex_normals.inl"
+}
+
+#if SIMD_DISPATCH_X86
+SIMD_TARGET_SSE41
+namespace vertex_normals_sse41 {
+#define SIMD_LANES_SSE41
+#include "vertex_normals.inl"
+#undef SIMD_LANES_SSE41
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX2
+namespace vertex_normals_avx2 {
+#define SIMD_LANES_AVX2
+#include "vertex_normals.inl"
+#undef SIMD_LANES_AVX2
+}
+SIMD_TARGET_END
+
+SIMD_TARGET_AVX512
+namespace vertex_normals_avx512 {
+#define SIMD_LANES_AVX512
+#include "vertex_normals.inl"
+#undef SIMD_LANES_AVX512
+}
+SIMD_TARGET_END
+#endif
+
+// The face kernel for one level (clamped to what was compiled in).
+struct NormalKernels {
+	SimdLevel level;
+	int width; // triangles per step
+	void (*faceNormals)(const uint32_t* indices, const glm::vec3* positions, size_t begin, size_t end, const NormalFaceStreams& faces);
+};
+
+inline NormalKernels normalKernels(SimdLevel level = simdLevel()) {
+#if SIMD_DISPATCH_X86
+	if (level >= SIMD_AVX512) return {SIMD_AVX512, vertex_normals_avx512::WIDTH, vertex_normals_avx512::faceNormals};
+	if (level >= SIMD_AVX2) return {SIMD_AVX2, vertex_normals_avx2::WIDTH, vertex_normals_avx2::faceNormals};
+	if (level >= SIMD_SSE41) return {SIMD_SSE41, vertex_normals_sse41::WIDTH, vertex_normals_sse41::faceNormals};
+#endif
+	return {SIMD_SCALAR, vertex_normals_scalar::WIDTH, vertex_normals_scalar::faceNormals};
+}
+
+// Triangles and vertices per task. The triangle chunk is a multiple of every width, so only
+// the last one has a partial step.
+const size_t NORMAL_FACE_CHUNK = 16384;
+const size_t NORMAL_VERTEX_CHUNK = 4096;
+
+class NormalGenerator {
+public:
+	// pool may be null (or have one thread): everything then runs on the calling thread.
+	void create(TaskPool* taskPool = nullptr, SimdLevel level = simdLevel()) {
+		pool = taskPool;
+		kernels = normalKernels(level);
+	}
+	SimdLevel level() const { return kernels.level; }
+
+	// Builds the vertex -> corner table. Only needs to be redone when the indices change.
+	void setTopology(const uint32_t* triangleIndices, size_t indexCount, size_t vertexCount) {
+		indices.assign(triangleIndices, triangleIndices + indexCount);
+		vertices = vertexCount;
+
+		cornerStart.assign(vertexCount + 1, 0);
+		for (uint32_t index : indices) cornerStart[index + 1]++;
+		for (size_t v = 0; v < vertexCount; v++) cornerStart[v + 1] += cornerStart[v];
+
+		vertexCorners.resize(indexCount);
+		std::vector<uint32_t> fill(cornerStart.begin(), cornerStart.end() - 1);
+		for (size_t corner = 0; corner < indexCount; corner++) {
+			vertexCorners[fill[indices[corner]]++] = (uint32_t)corner;
+		}
+	}
+
+	size_t triangleCount() const { return indices.size() / 3; }
+
+	// One normal per vertex, smoothed over every face that uses it.
+	void computeVertexNormals(const glm::vec3* positions, glm::vec3* out, const NormalOptions& options = NormalOptions()) {
+		computeFaces(positions, options);
+		chunks(vertices, NORMAL_VERTEX_CHUNK, [&](size_t begin, size_t end) {
+			for (size_t v = begin; v < end; v++) {
+				glm::vec3 sum(0.0f);
+				for (uint32_t c = cornerStart[v]; c < cornerStart[v + 1]; c++) {
+					sum += cornerContribution(vertexCorners[c]);
+				}
+				out[v] = safeNormalize(sum);
+			}
+		});
+	}
+
+	// One normal per corner (per entry of the index buffer), split at creases.
+	// Welding corners with equal normals afterwards gives the final vertex buffer.
+	void computeCornerNormals(const glm::vec3* positions, glm::vec3* out, const NormalOptions& options = NormalOptions()) {
+		computeFaces(positions, options);
+		const float cosCrease = std::cos(options.creaseAngle);
+		chunks(vertices, NORMAL_VERTEX_CHUNK, [&](size_t begin, size_t end) {
+			for (size_t v = begin; v < end; v++) {
+				for (uint32_t c = cornerStart[v]; c < cornerStart[v + 1]; c++) {
+					uint32_t corner = vertexCorners[c];
+					glm::vec3 own = unitFace(corner / 3);
+					glm::vec3 sum(0.0f);
+					for (uint32_t k = cornerStart[v]; k < cornerStart[v + 1]; k++) {
+						uint32_t other = vertexCorners[k];
+						if (other == corner || glm::dot(own, unitFace(other / 3)) >= cosCrease) {
+							sum += cornerContribution(other);
+						}
+					}
+					out[corner] = safeNormalize(sum);
+				}
+			}
+		});
+	}
+
+private:
+	// Fills the face arrays: weighted face normals, unit face normals and corner angles.
+	void computeFaces(const glm::vec3* positions, const NormalOptions& options) {
+		const size_t triangles = triangleCount();
+		faceX.resize(triangles);
+		faceY.resize(triangles);
+		faceZ.resize(triangles);
+		unitX.resize(triangles);
+		unitY.resize(triangles);
+		unitZ.resize(triangles);
+		angleWeighted = options.weighting == NORMAL_WEIGHT_ANGLE;
+		if (angleWeighted) cornerAngle.resize(triangles * 3);
+
+		NormalFaceStreams faces = {faceX.data(), faceY.data(), faceZ.data(), unitX.data(), unitY.data(), unitZ.data(),
+			angleWeighted ? cornerAngle.data() : nullptr};
+		chunks(triangles, NORMAL_FACE_CHUNK, [&](size_t begin, size_t end) {
+			kernels.faceNormals(indices.data(), positions, begin, end, faces);
+		});
+	}
+
+	// Runs body(begin, end) over [0, count) in chunks on the pool, or as one chunk without one.
+	template <typename Body>
+	void chunks(size_t count, size_t chunkSize, const Body& body) {
+		size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+		if (!pool || pool->threadCount() <= 1 || chunkCount <= 1) {
+			body((size_t)0, count);
+			return;
+		}
+		pool->run(chunkCount, [&](size_t chunk, unsigned int) {
+			size_t begin = chunk * chunkSize;
+			body(begin, std::min(count, begin + chunkSize));
+		});
+	}
+
+	glm::vec3 unitFace(size_t triangle) const {
+		return glm::vec3(unitX[triangle], unitY[triangle], unitZ[triangle]);
+	}
+
+	glm::vec3 cornerContribution(uint32_t corner) const {
+		size_t triangle = corner / 3;
+		if (angleWeighted) return unitFace(triangle) * cornerAngle[corner];
+		return glm::vec3(faceX[triangle], faceY[triangle], faceZ[triangle]);
+	}
+
+	static glm::vec3 safeNormalize(const glm::vec3& v) {
+		float length2 = glm::dot(v, v);
+		return length2 > 0.0f ? v / std::sqrt(length2) : glm::vec3(0.0f);
+	}
+
+	std::vector<uint32_t> indices;
+	size_t vertices = 0;
+	std::vector<uint32_t> cornerStart;   // per vertex: first entry in vertexCorners
+	std::vector<uint32_t> vertexCorners; // corners grouped by vertex
+	std::vector<float> faceX, faceY, faceZ; // area weighted face normals
+	std::vector<float> unitX, unitY, unitZ; // unit face normals
+	std::vector<float> cornerAngle;
+	bool angleWeighted = false;
+	TaskPool* pool = nullptr;
+	NormalKernels kernels = normalKernels(SIMD_SCALAR);
+};
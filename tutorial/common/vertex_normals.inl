@@ -0,0 +1,74 @@
+// Face normal kernel, compiled once per instruction set (see simd_lanes.inl).
+// No include guard on purpose.
+#include "simd_lanes.inl"
+
+// Stores the first valid lanes of a.
+inline void storeValid(float* p, Lanes a, size_t valid) {
+	if (valid == (size_t)WIDTH) {
+		store(p, a);
+		return;
+	}
+	float lanes[WIDTH];
+	store(lanes, a);
+	for (size_t k = 0; k < valid; k++) p[k] = lanes[k];
+}
+
+// Weighted and unit face normals (and corner angles if faces.cornerAngle is set) of the
+// triangles in [begin, end), WIDTH at a time. The last step of a range that isn't a multiple
+// of WIDTH repeats its last triangle in the unused lanes and only keeps the valid ones.
+inline void faceNormals(const uint32_t* indices, const glm::vec3* positions, size_t begin, size_t end, const NormalFaceStreams& faces) {
+	const Lanes tiny = broadcast(1e-30f), one = broadcast(1.0f), zero = broadcast(0.0f);
+	for (size_t t = begin; t < end; t += WIDTH) {
+		const size_t valid = end - t < (size_t)WIDTH ? end - t : (size_t)WIDTH;
+		float p[9][WIDTH];
+		for (int k = 0; k < WIDTH; k++) {
+			const uint32_t* triangle = &indices[3 * (t + ((size_t)k < valid ? k : valid - 1))];
+			for (int corner = 0; corner < 3; corner++) {
+				const glm::vec3& position = positions[triangle[corner]];
+				p[3 * corner + 0][k] = position.x;
+				p[3 * corner + 1][k] = position.y;
+				p[3 * corner + 2][k] = position.z;
+			}
+		}
+		Lanes ax = load(p[0]), ay = load(p[1]), az = load(p[2]);
+		Lanes bx = load(p[3]), by = load(p[4]), bz = load(p[5]);
+		Lanes cx = load(p[6]), cy = load(p[7]), cz = load(p[8]);
+
+		// Edges leaving each corner
+		Lanes abx = sub(bx, ax), aby = sub(by, ay), abz = sub(bz, az);
+		Lanes acx = sub(cx, ax), acy = sub(cy, ay), acz = sub(cz, az);
+		Lanes bcx = sub(cx, bx), bcy = sub(cy, by), bcz = sub(cz, bz);
+
+		// ab x ac; its length is twice the area
+		Lanes nx = sub(mul(aby, acz), mul(abz, acy));
+		Lanes ny = sub(mul(abz, acx), mul(abx, acz));
+		Lanes nz = sub(mul(abx, acy), mul(aby, acx));
+		// Degenerate triangles get a zero unit normal instead of NaNs.
+		Lanes invLength = div(one, sqrt(max(madd(nz, nz, madd(ny, ny, mul(nx, nx))), tiny)));
+
+		storeValid(&faces.faceX[t], nx, valid);
+		storeValid(&faces.faceY[t], ny, valid);
+		storeValid(&faces.faceZ[t], nz, valid);
+		storeValid(&faces.unitX[t], mul(nx, invLength), valid);
+		storeValid(&faces.unitY[t], mul(ny, invLength), valid);
+		storeValid(&faces.unitZ[t], mul(nz, invLength), valid);
+		if (!faces.cornerAngle) continue;
+
+		// Cosines of the corner angles; acos has no SIMD form, so it's done per lane.
+		Lanes ab2 = madd(abz, abz, madd(aby, aby, mul(abx, abx)));
+		Lanes ac2 = madd(acz, acz, madd(acy, acy, mul(acx, acx)));
+		Lanes bc2 = madd(bcz, bcz, madd(bcy, bcy, mul(bcx, bcx)));
+		Lanes abac = madd(abz, acz, madd(aby, acy, mul(abx, acx)));
+		Lanes abbc = madd(abz, bcz, madd(aby, bcy, mul(abx, bcx)));
+		Lanes acbc = madd(acz, bcz, madd(acy, bcy, mul(acx, bcx)));
+		float cosines[3][WIDTH];
+		store(cosines[0], div(abac, sqrt(max(mul(ab2, ac2), tiny))));
+		store(cosines[1], sub(zero, div(abbc, sqrt(max(mul(ab2, bc2), tiny)))));
+		store(cosines[2], div(acbc, sqrt(max(mul(ac2, bc2), tiny))));
+		for (size_t k = 0; k < valid; k++) {
+			for (int corner = 0; corner < 3; corner++) {
+				faces.cornerAngle[3 * (t + k) + corner] = std::acos(glm::clamp(cosines[corner][k], -1.0f, 1.0f));
+			}
+		}
+	}
+}